@@ -95,6 +95,7 @@ namespace blaze {}
 //                <li> \ref views_submatrices </li>
 //                <li> \ref views_rows </li>
 //                <li> \ref views_columns </li>
+//                <li> \ref views_selections </li>
 //             </ul>
 //          </li>
 //          <li> Arithmetic Operations
@@ -151,7 +152,7 @@ namespace blaze {}
 //
 // In order for \b Blaze to work properly, the Boost library must be installed on the system. It
 // is recommended to use the newest Boost library available, but \b Blaze requires at minimum the
-// Boost version 1.39. If you don't have Boost installed on your system, you can download it for
+// Boost version 1.53. If you don't have Boost installed on your system, you can download it for
 // free from 'http://www.boost.org'.
 //
 // Additionally, for maximum performance \b Blaze expects you to have a BLAS library installed
@@ -477,7 +478,9 @@ namespace blaze {}
 //
 // The \b Blaze library currently offers three dense vector types (\ref vector_types_static_vector,
 // \ref vector_types_dynamic_vector and \ref vector_types_hybrid_vector) and one sparse vector type
-// (\ref vector_types_compressed_vector). All vectors can be specified as either column vectors
+// (\ref vector_types_compressed_vector). Additionally, the \ref vector_types_custom_vector allows
+// to use an existing array of elements as a dense vector. All vectors can be specified as either
+// column vectors
 
                           \f$\left(\begin{array}{*{1}{c}}
                           1 \\
@@ -571,6 +574,61 @@ namespace blaze {}
 //  - \c TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
 //             vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
 //
+//
+// \n \section vector_types_custom_vector CustomVector
+// <hr>
+//
+// The blaze::CustomVector class template provides the functionality to represent an external
+// array of elements of arbitrary type and a fixed size as a native \b Blaze dense vector data
+// structure. Thus in contrast to all other dense vector types a custom vector does not perform
+// any kind of memory allocation by itself, but it is provided with an existing array of elements
+// during construction. It can be included via the header file
+
+   \code
+   #include <blaze/math/CustomVector.h>
+   \endcode
+
+// The type of the elements, the properties of the given array of elements and the transpose
+// flag of the vector can be specified via the following four template parameters:
+
+   \code
+   template< typename Type, bool AF, bool PF, bool TF >
+   class CustomVector;
+   \endcode
+
+//  - \c Type: specifies the type of the vector elements. CustomVector can be used with any
+//             non-cv-qualified, non-reference, non-pointer element type.
+//  - \c AF  : specifies whether the represented, external arrays are properly aligned with
+//             respect to the available instruction set (SSE, AVX, ...) (\c blaze::aligned)
+//             or not (\c blaze::unaligned).
+//  - \c PF  : specifies whether the represented, external arrays are properly padded with
+//             respect to the available instruction set (\c blaze::padded) or not
+//             (\c blaze::unpadded).
+//  - \c TF  : specifies whether the vector is a row vector (\c blaze::rowVector) or a column
+//             vector (\c blaze::columnVector). The default value is \c blaze::columnVector.
+//
+// The custom vector neither allocates nor deallocates the given array and a copy of a custom
+// vector represents the same array. Aligned arrays can for instance be acquired via the
+// blaze::allocate() function, padded arrays have to provide zero-initialized elements up to
+// a multiple of the number of values per intrinsic element:
+
+   \code
+   using blaze::CustomVector;
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   std::vector<double> memory( 10UL );
+   CustomVector<double,unaligned,unpadded> a( &memory[0], 10UL );
+
+   double* array = blaze::allocate<double>( 12UL );
+   // ... Initialization of the elements and zero-initialization of the two padding elements
+   CustomVector<double,aligned,padded> b( array, 10UL, 12UL );
+
+   b = a * 2.0;  // Assignment to the elements of the external array
+   \endcode
+
 //
 // \n \section vector_types_compressed_vector CompressedVector
 // <hr>
@@ -1088,6 +1146,43 @@ namespace blaze {}
 
 // Note that both functions can only be used for vectors with built-in or complex element type!
 //
+// \n \section vector_operations_reductions Reductions and Norms
+// <hr>
+//
+// The elements of a dense vector can be reduced to a single value via the \c sum(), \c prod(),
+// \c min(), and \c max() functions. The \c argmin() and \c argmax() functions return the index
+// of the first smallest or largest element, respectively. Additionally, the \c l1Norm(),
+// \c l2Norm(), \c linfNorm(), \c sqrNorm(), and \c lpNorm() functions compute the according
+// vector norms:
+
+   \code
+   blaze::DynamicVector<double,columnVector> v( 100UL );
+   // ... Initialization
+
+   const double s  = sum ( v );       // Sum of all elements
+   const double mx = max ( v );       // Largest element
+   const size_t i  = argmax( v );     // Index of the largest element
+   const double n1 = l1Norm( v );     // Sum of the absolute values
+   const double n2 = l2Norm( v );     // Euclidean norm (identical to length())
+   const double n3 = lpNorm( v, 3 );  // General p-norm
+   \endcode
+
+// All of these functions are also available for dense matrices. For matrices, it is in addition
+// possible to reduce either each row (\c rowwise) or each column (\c columnwise), which results
+// in a dense column or row vector, respectively:
+
+   \code
+   blaze::DynamicMatrix<double> A( 50UL, 80UL );
+   blaze::DynamicVector<double,columnVector> r;
+   blaze::DynamicVector<double,rowVector> c;
+
+   r = blaze::sum<rowwise>( A );     // Sum of each row
+   c = blaze::max<columnwise>( A );  // Largest element of each column
+   \endcode
+
+// Custom reduction operations can be applied via the \c reduce() function, which accepts any
+// binary, associative operation (see \ref blaze::Add for an example of a suitable functor).
+//
 // \n \section vector_operators_abs Absolute Values
 // <hr>
 //
@@ -1156,6 +1251,12 @@ namespace blaze {}
 //
 // The \b Blaze library currently offers two dense matrix types (\ref matrix_types_static_matrix
 // and \ref matrix_types_dynamic_matrix) and one sparse matrix type (\ref matrix_types_compressed_matrix).
+// Additionally, the \ref matrix_types_quantized_matrix provides 8-bit quantized dense matrices, the
+// \ref matrix_types_delta_compressed_matrix provides a compact read-only sparse matrix, and the
+// \ref matrix_types_custom_matrix allows to use an existing array of elements as a dense matrix.
+// The \ref matrix_types_symmetric_matrix and the triangular \ref matrix_types_lower_matrix and
+// \ref matrix_types_upper_matrix store only half of a square matrix, the \ref matrix_types_banded_matrix
+// and the \ref matrix_types_diagonal_matrix only store the diagonals of their band.
 // All matrices can either be stored as row-major matrices or column-major matrices. Per default,
 // all matrices in \b Blaze are row-major matrices.
 //
@@ -1237,6 +1338,264 @@ namespace blaze {}
 //             The default value is blaze::rowMajor.
 //
 //
+// \n \section matrix_types_quantized_matrix QuantizedMatrix
+// <hr>
+//
+// The blaze::QuantizedMatrix class is the representation of an arbitrary sized, row-major dense
+// matrix of 8-bit integral values with a scaling factor and a zero point per row, as for instance
+// used for quantized inference. It can be included via the header file
+
+   \code
+   #include <blaze/math/QuantizedMatrix.h>
+   \endcode
+
+// A QuantizedMatrix can be created from any dense matrix, which quantizes each row onto the range
+// \f$ [-128..127] \f$. It can be multiplied with vectors and column-major matrices of 8-bit
+// integral values, which results in 32-bit integral values:
+
+   \code
+   blaze::DynamicMatrix<float> W( 256UL, 1024UL );
+   blaze::DynamicMatrix<blaze::int8_t,blaze::columnMajor> B( 1024UL, 64UL );
+   // ... Initialization
+
+   blaze::QuantizedMatrix A( W );
+   blaze::DynamicMatrix<blaze::int32_t> C( A * B );  // Exact 32-bit accumulation
+   \endcode
+
+//
+// \n \section matrix_types_delta_compressed_matrix DeltaCompressedMatrix
+// <hr>
+//
+// The blaze::DeltaCompressedMatrix class template is a read-only, row-major representation of a
+// sparse matrix for bandwidth bound sparse matrix/vector multiplications. Instead of a full
+// column index per non-zero element it stores 8-bit, 16-bit or 32-bit differences between
+// consecutive column indices (depending on the largest difference within each row) and, in case
+// the matrix contains at most 256 distinct values, 8-bit indices into a value dictionary. It can
+// be included via the header file
+
+   \code
+   #include <blaze/math/DeltaCompressedMatrix.h>
+   \endcode
+
+// A DeltaCompressedMatrix is created from any sparse matrix and can be multiplied with a dense
+// vector, optionally by means of a thread pool:
+
+   \code
+   blaze::CompressedMatrix<double> S( 100000UL, 100000UL );
+   blaze::DynamicVector<double> x( 100000UL ), y;
+   // ... Initialization
+
+   blaze::DeltaCompressedMatrix<double> A( S );  // Use of a value dictionary if possible
+   y = A * x;
+
+   blaze::ThreadPool pool( 8UL );
+   multiply( pool, y, A, x );  // Parallel multiplication
+   \endcode
+
+// The memory() function returns the size of the compressed representation. In case AVX2 is
+// available, the deltas of single and double precision matrices are decoded via vectorized
+// prefix sums and the vector elements are collected via gather instructions.
+//
+//
+// \n \section matrix_types_symmetric_matrix SymmetricMatrix
+// <hr>
+//
+// The blaze::SymmetricMatrix class template is the representation of an arbitrary sized,
+// symmetric dense matrix, which only stores the lower half of the matrix in a packed array. It
+// can be included via the header file
+
+   \code
+   #include <blaze/math/SymmetricMatrix.h>
+   \endcode
+
+// The type of the elements can be specified via the template parameter:
+
+   \code
+   template< typename Type >
+   class SymmetricMatrix;
+   \endcode
+
+// A SymmetricMatrix can be created from any symmetric dense matrix. Its multiplication with
+// dense vectors (SYMV) and dense matrices (SYMM) uses each stored element for both halves of
+// the matrix:
+
+   \code
+   blaze::DynamicMatrix<double> D( 500UL, 500UL );
+   blaze::DynamicVector<double> x( 500UL );
+   // ... Initialization of the symmetric matrix D and the vector x
+
+   blaze::SymmetricMatrix<double> A( D );   // Requires only half of the memory of D
+   blaze::DynamicVector<double> y( A * x );
+   \endcode
+
+//
+// \n \section matrix_types_lower_matrix LowerMatrix
+// <hr>
+//
+// The blaze::LowerMatrix class template is the representation of an arbitrary sized, lower
+// triangular dense matrix, which only stores the lower part of the matrix in a packed array.
+// It can be included via the header file
+
+   \code
+   #include <blaze/math/LowerMatrix.h>
+   \endcode
+
+// The type of the elements can be specified via the template parameter:
+
+   \code
+   template< typename Type >
+   class LowerMatrix;
+   \endcode
+
+// Lower matrices can be multiplied with dense vectors (TRMV) and dense matrices (TRMM). Lower
+// triangular systems can be solved via the solve() function (TRSV):
+
+   \code
+   blaze::LowerMatrix<double> L( 500UL );
+   blaze::DynamicVector<double> b( 500UL ), x;
+   // ... Initialization of L and b
+
+   solve( x, L, b );  // Forward substitution
+   \endcode
+
+//
+// \n \section matrix_types_upper_matrix UpperMatrix
+// <hr>
+//
+// The blaze::UpperMatrix class template is the representation of an arbitrary sized, upper
+// triangular dense matrix, which only stores the upper part of the matrix in a packed array.
+// It can be included via the header file
+
+   \code
+   #include <blaze/math/UpperMatrix.h>
+   \endcode
+
+// The type of the elements can be specified via the template parameter:
+
+   \code
+   template< typename Type >
+   class UpperMatrix;
+   \endcode
+
+// Upper matrices provide the same operations as lower matrices:
+
+   \code
+   blaze::UpperMatrix<double> U( 500UL );
+   blaze::DynamicVector<double> b( 500UL ), x;
+   // ... Initialization of U and b
+
+   solve( x, U, b );  // Backward substitution
+   \endcode
+
+//
+// \n \section matrix_types_banded_matrix BandedMatrix
+// <hr>
+//
+// The blaze::BandedMatrix class template is the representation of an arbitrary sized, square
+// dense matrix with a fixed number of subdiagonals and superdiagonals. Each diagonal of the band
+// is stored in a contiguous array. It can be included via the header file
+
+   \code
+   #include <blaze/math/BandedMatrix.h>
+   \endcode
+
+// The type of the elements and the number of subdiagonals and superdiagonals can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, size_t KL, size_t KU >
+   class BandedMatrix;
+   \endcode
+
+// The multiplication with dense vectors and matrices, the scaling by a scalar value and the
+// solution of banded systems via a banded LU decomposition only touch the elements of the band.
+// The matrix/vector multiplication processes the band diagonal by diagonal and is vectorized:
+
+   \code
+   blaze::BandedMatrix<double,3UL,3UL> A( 500UL );  // 7-point stencil
+   blaze::DynamicVector<double> x( 500UL ), y, b( 500UL ), z;
+   // ... Initialization of A, x and b
+
+   y = A * x;         // Banded matrix/vector multiplication
+   A *= 0.5;          // Scaling of the band
+   solve( z, A, b );  // Banded LU decomposition and substitution
+   \endcode
+
+// Note that the LU decomposition is performed without pivoting in order to preserve the band.
+// The system matrix is therefore expected to be diagonally dominant or positive definite.
+//
+//
+// \n \section matrix_types_diagonal_matrix DiagonalMatrix
+// <hr>
+//
+// The blaze::DiagonalMatrix class template is the representation of an arbitrary sized diagonal
+// matrix. It is a banded matrix without subdiagonals and superdiagonals and can be included via
+// the header file
+
+   \code
+   #include <blaze/math/DiagonalMatrix.h>
+   \endcode
+
+// A diagonal matrix can be directly created from the vector of its diagonal elements, which
+// for instance allows a simple Jacobi preconditioning:
+
+   \code
+   blaze::DynamicVector<double> d( 500UL ), r( 500UL ), z;
+   // ... Initialization of d and r
+
+   blaze::DiagonalMatrix<double> D( d );
+   solve( z, D, r );  // Element-wise division of r by d
+   \endcode
+
+//
+// \n \section matrix_types_custom_matrix CustomMatrix
+// <hr>
+//
+// The blaze::CustomMatrix class template provides the functionality to represent an external
+// array of elements of arbitrary type and a fixed size as a native \b Blaze dense matrix data
+// structure. It can be included via the header file
+
+   \code
+   #include <blaze/math/CustomMatrix.h>
+   \endcode
+
+// The type of the elements, the properties of the given array of elements and the storage order
+// of the matrix can be specified via the following four template parameters:
+
+   \code
+   template< typename Type, bool AF, bool PF, bool SO >
+   class CustomMatrix;
+   \endcode
+
+//  - \c Type: specifies the type of the matrix elements. CustomMatrix can be used with any
+//             non-cv-qualified, non-reference, non-pointer element type.
+//  - \c AF  : specifies whether the represented, external arrays are properly aligned with
+//             respect to the available instruction set (SSE, AVX, ...) (\c blaze::aligned)
+//             or not (\c blaze::unaligned).
+//  - \c PF  : specifies whether the represented, external arrays are properly padded with
+//             respect to the available instruction set (\c blaze::padded) or not
+//             (\c blaze::unpadded).
+//  - \c SO  : specifies the storage order (\c blaze::rowMajor, \c blaze::columnMajor) of the
+//             matrix. The default value is \c blaze::rowMajor.
+//
+// In addition to the number of rows and columns a custom matrix can be given the spacing
+// between two rows (or columns in case of a column-major matrix). This allows to represent
+// blocks of larger arrays and arrays with a row stride imposed by another library without
+// copying any elements:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   std::vector<double> memory( 20UL );  // 4x5 row-major array
+   CustomMatrix<double,unaligned,unpadded,rowMajor> A( &memory[6], 2UL, 3UL, 5UL );
+
+   blaze::DynamicVector<double> x( 3UL, 1.0 ), y;
+   y = A * x;  // Multiplication with the 2x3 block of the array
+   \endcode
+
 // \n <center> Previous: \ref vector_operations &nbsp; &nbsp; Next: \ref matrix_operations </center>
 */
 //*************************************************************************************************
@@ -2990,7 +3349,7 @@ namespace blaze {}
 //**Columns****************************************************************************************
 /*!\page views_columns Columns
 //
-// <center> Previous: \ref views_rows &nbsp; &nbsp; Next: \ref addition </center> \n
+// <center> Previous: \ref views_rows &nbsp; &nbsp; Next: \ref views_selections </center> \n
 //
 //
 // \tableofcontents
@@ -3300,7 +3659,135 @@ namespace blaze {}
 // Although \b Blaze performs the resulting matrix/vector multiplication as efficiently as possible
 // using a column-major storage order for matrix B would result in a more efficient evaluation.
 //
-// \n <center> Previous: \ref views_rows &nbsp; &nbsp; Next: \ref addition </center>
+// \n <center> Previous: \ref views_rows &nbsp; &nbsp; Next: \ref views_selections </center>
+*/
+//*************************************************************************************************
+
+
+//**Selections*************************************************************************************
+/*!\page views_selections Selections
+//
+// <center> Previous: \ref views_columns &nbsp; &nbsp; Next: \ref addition </center> \n
+//
+//
+// \tableofcontents
+//
+//
+// Whereas subvectors, submatrices, rows and columns refer to a contiguous part of a vector or
+// matrix, selections provide views on an arbitrary set of elements, rows or columns of a dense
+// vector or matrix. As all other views, selections act as a reference to the selected elements
+// and can be used on both sides of an assignment as long as the underlying vector or matrix is
+// not resized or entirely destroyed. \b Blaze provides four selection types: the
+// \ref views_dense_elements, the \ref views_dense_strided_subvector, the \ref views_dense_rows
+// and the \ref views_dense_columns.
+//
+//
+// \n \section views_dense_elements DenseElements
+// <hr>
+//
+// The blaze::DenseElements class template represents a view on an arbitrary selection of elements
+// of a dense vector. It can be included via the header file
+
+   \code
+   #include <blaze/math/DenseElements.h>
+   \endcode
+
+// An element selection is created via the \c elements() function, which expects the vector and
+// a list of indices, given either as a \c std::vector or as an array and its size. The indices
+// may be given in arbitrary order and may contain duplicates:
+
+   \code
+   blaze::DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization
+
+   std::vector<size_t> indices;
+   indices.push_back( 42UL );
+   indices.push_back(  7UL );
+   indices.push_back( 13UL );
+
+   y = elements( x, indices );        // Gathering the elements 42, 7, and 13 of x
+   elements( x, indices ) = 2.0 * y;  // Writing to the elements 42, 7, and 13 of x
+   \endcode
+
+// \n \section views_dense_strided_subvector DenseStridedSubvector
+// <hr>
+//
+// The blaze::DenseStridedSubvector class template represents a view on every \a stride-th element
+// of a dense vector. It can be included via the header file
+
+   \code
+   #include <blaze/math/DenseStridedSubvector.h>
+   \endcode
+
+// A strided subvector is created via the \c subvector() function with an additional, possibly
+// negative stride argument. The \c reverse() function provides the special case of a stride of
+// -1 over the complete vector:
+
+   \code
+   blaze::DynamicVector<double> x( 100UL ), y( 50UL );
+   // ... Initialization
+
+   y = subvector( x, 0UL, 50UL, 2L );    // The elements 0, 2, 4, ..., 98 of x
+   subvector( x, 99UL, 50UL, -2L ) = y;  // The elements 99, 97, ..., 1 of x
+
+   blaze::DynamicVector<double> z( reverse( x ) );  // The elements of x in reverse order
+   \endcode
+
+// \n \section views_dense_rows DenseRows
+// <hr>
+//
+// The blaze::DenseRows class template represents a view on an arbitrary selection of rows of a
+// dense matrix, the blaze::DenseColumns class template the according view on a selection of
+// columns. They can be included via the header files
+
+   \code
+   #include <blaze/math/DenseRows.h>
+   #include <blaze/math/DenseColumns.h>
+   \endcode
+
+// Row and column selections are created via the \c rows() and \c columns() functions and can be
+// used as any other dense matrix, for instance to process a mini-batch of samples:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> X( 10000UL, 64UL ), W( 64UL, 10UL ), Y;
+   // ... Initialization
+
+   std::vector<size_t> batch;
+   // ... Selection of the row indices of the current batch
+
+   Y = rows( X, batch ) * W;  // Multiplication of the selected rows with W
+   rows( X, batch ) *= 0.5;   // Scaling of the selected rows
+   \endcode
+
+// \n \section views_dense_columns DenseColumns
+// <hr>
+//
+// The blaze::DenseColumns class template is the column counterpart of the \ref views_dense_rows
+// class template and is created via the \c columns() function:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 64UL, 1000UL );
+   // ... Initialization
+
+   std::vector<size_t> indices;
+   // ... Selection of the column indices
+
+   columns( A, indices ) = 0.0;
+   \endcode
+
+// \n \section views_selections_performance Performance
+// <hr>
+//
+// Selections don't copy any elements. In case a row selection refers to a row-major matrix or
+// a column selection refers to a column-major matrix, every selected row or column is stored
+// contiguously and all operations are vectorized exactly as on the matrix itself. In all other
+// cases and for element selections and strided subvectors the elements of an intrinsic element
+// are scattered in memory. They are loaded via gather operations, which on 64-bit AVX2 platforms
+// map to the according gather instructions. Since AVX2 doesn't offer scatter instructions, stores to such selections are performed
+// element by element. In case the list of indices contains duplicates, a write operation is
+// performed for every occurrence of an index and the last write wins.
+//
+// \n <center> Previous: \ref views_columns &nbsp; &nbsp; Next: \ref addition </center>
 */
 //*************************************************************************************************
 
@@ -3308,7 +3795,7 @@ namespace blaze {}
 //**Addition***************************************************************************************
 /*!\page addition Addition
 //
-// <center> Previous: \ref views_columns &nbsp; &nbsp; Next: \ref subtraction </center> \n
+// <center> Previous: \ref views_selections &nbsp; &nbsp; Next: \ref subtraction </center> \n
 //
 // The addition of vectors and matrices is as intuitive as the addition of scalar values. For both
 // the vector addition as well as the matrix addition the addition operator can be used. It even
@@ -3367,7 +3854,7 @@ namespace blaze {}
    M3 = M1 + M2;  // Vectorized addition of two row-major, single precision dense matrices
    \endcode
 
-// \n <center> Previous: \ref views_columns &nbsp; &nbsp; Next: \ref subtraction </center>
+// \n <center> Previous: \ref views_selections &nbsp; &nbsp; Next: \ref subtraction </center>
 */
 //*************************************************************************************************
 
@@ -3789,6 +4276,32 @@ namespace blaze {}
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+//
+// \n \section openmp_thread_placement Thread Placement
+// <hr>
+//
+// The first touch principle only pays off if the threads are not migrated between the locality
+// domains after the initialization. Since \b Blaze assigns contiguous blocks of elements (or
+// rows) to the threads in the order of their thread IDs, the threads should be bound to the
+// cores such that consecutive threads share a locality domain. For the OpenMP backend, this is
+// achieved via the standard OpenMP environment variables:
+
+   \code
+   export OMP_PLACES=cores       // One place per physical core
+   export OMP_PROC_BIND=spread   // Distribute the threads across all sockets
+   \endcode
+
+// For the thread team backend (see the \c BLAZE_USE_THREAD_TEAM switch in the configuration file
+// <em>./blaze/config/SMP.h</em>), the placement is selected via \c BLAZE_THREAD_TEAM_PLACEMENT
+// and can be restricted to a subset of the logical CPUs via the \c BLAZE_CPUSET environment
+// variable. Alternatively, the logical CPUs can be specified explicitly via the
+// \c setThreadAffinity() function and the Topology class:
+
+   \code
+   const blaze::Topology topology;
+   blaze::setThreadAffinity( topology.place( blaze::getNumThreads(), blaze::Topology::spread ) );
+   \endcode
+
 // \n <center> Previous: \ref matrix_matrix_multiplication &nbsp; &nbsp; Next: \ref serial_execution </center>
 */
 //*************************************************************************************************
@@ -4032,6 +4545,144 @@ namespace blaze {}
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
 //
+// \n \section matrix_serialization_sparse Sparse Matrices
+//
+// The non-zero elements of sparse vectors and matrices are written in blocks: The number of
+// non-zero elements of all rows (or columns) is written as a single array, followed by blocks
+// of indices and values that are written via few large write operations. By default, the
+// indices are stored as plain 64-bit integers. Alternatively, the indices can be stored as
+// delta-encoded variable length integers, which considerably reduces the size of the archive
+// at the cost of some additional encoding work. The compression can be selected explicitly
+// via the MatrixSerializer (or VectorSerializer) class or globally via the configuration file
+// <em>./blaze/config/Serialization.h</em>:
+
+   \code
+   blaze::CompressedMatrix<double> S;
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "matrix.blaze" );
+
+   // Serialization of S with delta-encoded indices
+   blaze::MatrixSerializer( true ).serialize( archive, S );
+   \endcode
+
+// The deserialization automatically detects the format of the archive. Archives written by
+// older versions of \b Blaze, which store the index and value of every single non-zero element
+// separately, can still be read.
+//
+// \n \section matrix_serialization_mapped Memory-Mapped Matrices
+//
+// For very large matrices the portable archive format has the disadvantage that every single
+// element has to be read and converted before the matrix can be used. As an alternative, the
+// serializeMapped() function writes a matrix in the native in-memory representation of the
+// platform. Such a file can be mapped into the address space of the process via the
+// \c MappedDenseMatrix and \c MappedSparseMatrix class templates without copying any element.
+// The pages of the file are loaded on demand as soon as the elements are accessed:
+
+   \code
+   // Serialization
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+
+      // ... Resizing and initialization
+
+      blaze::serializeMapped( "A.blazemap", A );
+      blaze::serializeMapped( "B.blazemap", B );
+   }
+
+   // Mapping
+   {
+      blaze::MappedDenseMatrix<double,blaze::rowMajor> A( "A.blazemap" );
+      blaze::MappedSparseMatrix<double,blaze::columnMajor> B( "B.blazemap" );
+      blaze::DynamicVector<double> x, y;
+
+      // ... Resizing and initialization
+
+      y = A * x + B * x;
+   }
+   \endcode
+
+// The rows (or columns) of a mapped dense matrix start at 64-byte boundaries and are padded with
+// zeros, which enables the use of the vectorized kernels. The non-zero elements of a mapped
+// sparse matrix are stored in the same layout as the elements of a \c CompressedMatrix. Both
+// matrix types are read-only, i.e. the elements cannot be modified. Additionally, the following
+// rules apply:
+//
+//  - only matrices with numeric element types can be mapped
+//  - the element type and the storage order of the mapped matrix must match those of the
+//    serialized matrix
+//  - the file can only be mapped on platforms with the same byte order and the same size of
+//    the \c size_t type
+//
+// In case the file cannot be mapped or doesn't contain a matrix of the expected type, a
+// \a std::runtime_error exception is thrown.
+//
+// \n \section matrix_serialization_text Matrix Market and CSV Files
+//
+// For the exchange of matrices with other software, \b Blaze can read and write matrices in the
+// text based Matrix Market exchange format and in the CSV format. Both formats can be read into
+// a \c CompressedMatrix or a \c DynamicMatrix of either storage order:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicMatrix<float,blaze::columnMajor> B;
+
+   blaze::readMatrixMarket( "A.mtx", A );  // Reading a Matrix Market file
+   blaze::readCSV( "B.csv", B, ';' );      // Reading a semicolon-separated CSV file
+
+   blaze::writeMatrixMarket( "C.mtx", A * B );  // Writing in Matrix Market format
+   blaze::writeCSV( "D.csv", B );               // Writing a comma-separated CSV file
+   \endcode
+
+// Since the parsing of text files is usually much more expensive than reading the file itself,
+// all four functions optionally take a \c ThreadPool as first argument. In this case the file
+// is mapped into memory, split into line-aligned chunks, and all chunks are parsed (or
+// formatted) in parallel:
+
+   \code
+   blaze::ThreadPool pool( 8UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+
+   blaze::readMatrixMarket( pool, "A.mtx", A );
+   \endcode
+
+// The Matrix Market reader supports the \c coordinate and \c array formats, the \c real,
+// \c integer, \c complex, and \c pattern fields, and the \c general, \c symmetric,
+// \c skew-symmetric, and \c hermitian structures. The entries of a coordinate file may appear in
+// any order and duplicate entries are summed up. Sparse matrices are written in the \c coordinate
+// format, dense matrices in the \c array format. CSV files can only contain non-complex values.
+// In case a file cannot be read or doesn't conform to the format, a \a std::runtime_error
+// exception is thrown.
+//
+//
+// \n \section matrix_serialization_panels Out-of-Core Matrix/Vector Multiplications
+//
+// Matrices that don't fit into main memory can be multiplied with a vector directly from a file.
+// For that purpose the serializePanels() function writes a matrix as a sequence of row panels,
+// i.e. blocks of consecutive rows, and the \c PanelMatrix class template streams these panels
+// through a fixed-size buffer. Only two panels are kept in memory at any point in time:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   blaze::serializePanels( "A.panels", A, 10000UL );  // Writing panels of 10000 rows each
+
+   blaze::PanelMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > B( "A.panels" );
+   blaze::DynamicVector<double,blaze::columnVector> x( B.columns() ), y( B.rows() ), z( B.columns() );
+
+   B.multiply( x, y );       // Computation of y = A * x
+   B.transMultiply( y, z );  // Computation of z = trans(A) * y
+   \endcode
+
+// The template argument of \c PanelMatrix is the type of a single panel and must be a row-major
+// \c CompressedMatrix or \c DynamicMatrix, depending on whether a sparse or a dense matrix was
+// written, and the sizes of the given vectors must match the size of the matrix. Optionally, both
+// multiplication functions take a \c ThreadPool as first argument. In this case the next panel is
+// read by a worker thread while the current panel is multiplied. In case the file cannot be read
+// or doesn't match the panel type, a \a std::runtime_error exception is thrown.
+//
 // \n <center> Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref intra_statement_optimization </center> \n
 */
 //*************************************************************************************************
@@ -4228,6 +4879,21 @@ namespace blaze {}
 // whether streaming is beneficial or hurtful for performance.
 //
 //
+// \n \section serialization Serialization
+//
+// Sparse vectors and matrices are serialized in blocks of indices and values (see
+// \ref matrix_serialization_sparse). The configuration file <em>./blaze/config/Serialization.h</em>
+// selects the default format of the indices:
+
+   \code
+   const bool compressSparseIndices = false;
+   \endcode
+
+// If \a compressSparseIndices is set to \a true the indices are stored as delta-encoded variable
+// length integers, if it is set to \a false the indices are stored as plain 64-bit integers. The
+// setting has no influence on the deserialization of archives.
+//
+//
 // \n <center> Previous: \ref intra_statement_optimization </center>
 */
 //*************************************************************************************************
@@ -41,17 +41,30 @@
 //*************************************************************************************************
 
 #include <blaze/math/Accuracy.h>
+#include <blaze/math/Async.h>
+#include <blaze/math/BandedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DeltaCompressedMatrix.h>
+#include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Functors.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/HybridVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedDenseMatrix.h>
+#include <blaze/math/MappedSparseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/QuantizedMatrix.h>
 #include <blaze/math/Quaternion.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RotationMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
@@ -59,9 +72,11 @@
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
+#include <blaze/math/SymmetricMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/math/TypeTraits.h>
+#include <blaze/math/UpperMatrix.h>
 #include <blaze/math/Views.h>
 
 #endif
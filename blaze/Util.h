@@ -47,6 +47,7 @@
 #include <blaze/util/AlignmentTrait.h>
 #include <blaze/util/Algorithm.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
@@ -56,11 +57,14 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EmptyType.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/Future.h>
 #include <blaze/util/InputString.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Logging.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
@@ -80,10 +84,13 @@
 #include <blaze/util/Suffix.h>
 #include <blaze/util/SystemClock.h>
 #include <blaze/util/SystemClockID.h>
+#include <blaze/util/TaskGroup.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/ThreadTeam.h>
 #include <blaze/util/Time.h>
 #include <blaze/util/Timing.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/TypeTraits.h>
@@ -48,3 +48,64 @@
 */
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the thread team based shared-memory parallelization.
+// \ingroup config
+//
+// This compilation switch selects the ThreadTeam based shared-memory parallelization as SMP
+// backend. In case the switch is set to 1 and the OpenMP parallelization is not enabled, all
+// SMP assignments of dense vectors and dense matrices are executed by a team of persistent
+// worker threads (see the ThreadTeam class description). In contrast to the OpenMP backend,
+// which opens a new parallel region for every SMP assignment, the persistent worker threads
+// spin briefly before they park and start a new parallel assignment within microseconds. In
+// case the switch is set to 0 or OpenMP is enabled, the thread team backend is not used. Note
+// that this switch can also be set via the command line (e.g. \c -DBLAZE_USE_THREAD_TEAM=1).
+//
+// Possible settings for the thread team switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#ifndef BLAZE_USE_THREAD_TEAM
+#define BLAZE_USE_THREAD_TEAM 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of spin iterations of idle thread team workers.
+// \ingroup config
+//
+// This value specifies the number of iterations an idle worker thread of the SMP thread team
+// spins on the broadcast slot of the team before it parks. Larger values reduce the start-up
+// latency of consecutive SMP assignments at the cost of CPU time of idle worker threads.
+//
+// The default setting for the number of spin iterations is 20000.
+*/
+#define BLAZE_THREAD_TEAM_SPIN_COUNT 20000
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Placement of the thread team workers.
+// \ingroup config
+//
+// This value specifies how the worker threads of the SMP thread team are placed on the logical
+// CPUs of the system (see the Topology class description). In case the value is set to 0, the
+// operating system is free to migrate the worker threads between cores. In case the value is
+// set to 1, the worker threads are packed densely onto the cores of the first socket before the
+// next socket is used (compact placement). In case the value is set to 2, the worker threads
+// are distributed across all sockets and cores before any SMT sibling is used (spread placement).
+// In both latter cases the ranks of the team are numbered contiguously per NUMA node, i.e. the
+// contiguous blocks of rows assigned to the ranks of a single NUMA node are adjacent. Note that
+// the set of logical CPUs used for the placement can be restricted at run time via the
+// \c BLAZE_CPUSET environment variable (e.g. \c BLAZE_CPUSET=0-7,16-23).
+//
+// Possible settings for the placement:
+//  - Unpinned: \b 0
+//  - Compact : \b 1 (default)
+//  - Spread  : \b 2
+*/
+#define BLAZE_THREAD_TEAM_PLACEMENT 1
+//*************************************************************************************************
@@ -0,0 +1,56 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Serialization.h
+//  \brief Configuration of the sparse serialization format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!rief Configuration of the index compression of serialized sparse vectors and matrices.
+// \ingroup config
+//
+// Sparse vectors and matrices are serialized in blocks of indices and values. By default the
+// indices are stored as plain 64-bit integers, which allows a very fast (de-)serialization.
+// Alternatively, the indices within each row/column can be stored as delta-encoded variable
+// length integers, which usually shrinks the index data by a factor of four to eight at the
+// cost of additional encoding and decoding work.
+//
+// Via this compilation switch the default index compression of the MatrixSerializer and the
+// VectorSerializer can be selected. If set to \a true the indices are compressed by default,
+// if set to \a false the indices are stored uncompressed. Note that this setting only affects
+// the serialization; the deserialization automatically detects the format of an archive.
+*/
+const bool compressSparseIndices = false;
+//*************************************************************************************************
+
+} // namespace blaze
@@ -894,4 +894,95 @@ const size_t OPENMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t OPENMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  THREAD TEAM THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread team dense vector assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment of a plain dense vector can be executed in
+// parallel by the SMP thread team. In case the number of elements of the target vector is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements
+// is below this threshold the operation is executed single-threaded.
+//
+// The default setting for this threshold is 8000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel. Due to the low start-up latency of the
+// persistent worker threads, this threshold is considerably smaller than the according OpenMP
+// threshold. This threshold is only used in case the thread team backend is enabled (see the
+// \c BLAZE_USE_THREAD_TEAM switch in the <tt>./blaze/config/SMP.h</tt> configuration file).
+*/
+const size_t THREAD_TEAM_DVECASSIGN_THRESHOLD = 8000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread team dense vector/dense vector addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector addition can be executed in parallel
+// by the SMP thread team. In case the number of elements of the target vector is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of elements is below
+// this threshold the operation is executed single-threaded.
+//
+// The default setting for this threshold is 8000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t THREAD_TEAM_DVECDVECADD_THRESHOLD = 8000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread team dense vector/dense vector subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector subtraction can be executed in
+// parallel by the SMP thread team. In case the number of elements of the target vector is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements
+// is below this threshold the operation is executed single-threaded.
+//
+// The default setting for this threshold is 8000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t THREAD_TEAM_DVECDVECSUB_THRESHOLD = 8000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread team dense vector/dense vector multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector multiplication can be executed in
+// parallel by the SMP thread team. In case the number of elements of the target vector is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements
+// is below this threshold the operation is executed single-threaded.
+//
+// The default setting for this threshold is 8000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t THREAD_TEAM_DVECDVECMULT_THRESHOLD = 8000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread team dense vector/scalar multiplication/division threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/scalar multiplication/division can be executed in
+// parallel by the SMP thread team. In case the number of elements of the target vector is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements
+// is below this threshold the operation is executed single-threaded.
+//
+// The default setting for this threshold is 11000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t THREAD_TEAM_DVECSCALARMULT_THRESHOLD = 11000UL;
+//*************************************************************************************************
+
 } // namespace blaze
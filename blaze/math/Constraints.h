@@ -50,8 +50,10 @@
 #include <blaze/math/constraints/DivExpr.h>
 #include <blaze/math/constraints/EvalExpr.h>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/constraints/MapExpr.h>
 #include <blaze/math/constraints/MatAbsExpr.h>
 #include <blaze/math/constraints/MatEvalExpr.h>
+#include <blaze/math/constraints/MatMapExpr.h>
 #include <blaze/math/constraints/MatMatAddExpr.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatMatSubExpr.h>
@@ -75,6 +77,7 @@
 #include <blaze/math/constraints/TVecMatMultExpr.h>
 #include <blaze/math/constraints/VecAbsExpr.h>
 #include <blaze/math/constraints/VecEvalExpr.h>
+#include <blaze/math/constraints/VecMapExpr.h>
 #include <blaze/math/constraints/VecScalarDivExpr.h>
 #include <blaze/math/constraints/VecScalarMultExpr.h>
 #include <blaze/math/constraints/Vector.h>
@@ -47,6 +47,8 @@
 #include <blaze/math/expressions/DMatDMatSubExpr.h>
 #include <blaze/math/expressions/DMatDVecMultExpr.h>
 #include <blaze/math/expressions/DMatEvalExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSMatAddExpr.h>
@@ -602,12 +604,6 @@ bool isDiagonal( const DenseMatrix<MT,SO>& dm );
 
 template< typename MT, bool SO >
 bool isSymmetric( const DenseMatrix<MT,SO>& dm );
-
-template< typename MT, bool SO >
-const typename MT::ElementType min( const DenseVector<MT,SO>& dm );
-
-template< typename MT, bool SO >
-const typename MT::ElementType max( const DenseVector<MT,SO>& dm );
 //@}
 //*************************************************************************************************
 
@@ -745,100 +741,6 @@ bool isSymmetric( const DenseMatrix<MT,SO>& dm )
 }
 //*************************************************************************************************
 
-
-//*************************************************************************************************
-/*!\brief Returns the smallest element of the dense matrix.
-// \ingroup dense_matrix
-//
-// \param dm The given dense matrix.
-// \return The smallest dense matrix element.
-//
-// This function returns the smallest element of the given dense matrix. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
-*/
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order
-const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
-{
-   using blaze::min;
-
-   typedef typename MT::ElementType    ET;
-   typedef typename MT::CompositeType  CT;
-
-   CT A( ~dm );  // Evaluation of the dense matrix operand
-
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET minimum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         minimum = min( minimum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            minimum = min( minimum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         minimum = min( minimum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            minimum = min( minimum, A(i,j) );
-   }
-
-   return minimum;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the largest element of the dense matrix.
-// \ingroup dense_matrix
-//
-// \param dm The given dense matrix.
-// \return The largest dense matrix element.
-//
-// This function returns the largest element of the given dense matrix. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
-*/
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Transpose flag
-const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
-{
-   using blaze::max;
-
-   typedef typename MT::ElementType    ET;
-   typedef typename MT::CompositeType  CT;
-
-   CT A( ~dm );  // Evaluation of the dense matrix operand
-
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET maximum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         maximum = max( maximum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            maximum = max( maximum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         maximum = max( maximum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            maximum = max( maximum, A(i,j) );
-   }
-
-   return maximum;
-}
-//*************************************************************************************************
-
 } // namespace blaze
 
 #endif
@@ -48,6 +48,8 @@
 #include <blaze/math/expressions/DVecDVecMultExpr.h>
 #include <blaze/math/expressions/DVecDVecSubExpr.h>
 #include <blaze/math/expressions/DVecEvalExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/expressions/DVecScalarDivExpr.h>
 #include <blaze/math/expressions/DVecScalarMultExpr.h>
 #include <blaze/math/expressions/DVecSVecAddExpr.h>
@@ -396,12 +398,6 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 
 template< typename VT, bool TF >
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv );
-
-template< typename VT, bool TF >
-const typename VT::ElementType min( const DenseVector<VT,TF>& dv );
-
-template< typename VT, bool TF >
-const typename VT::ElementType max( const DenseVector<VT,TF>& dv );
 //@}
 //*************************************************************************************************
 
@@ -471,6 +467,8 @@ bool isnan( const DenseVector<VT,TF>& dv )
 //    </tr>
 // </table>
 //
+// The length is identical to the L2 norm of the vector (see the l2Norm() function).
+//
 // \b Note: This operation is only defined for numeric data types. In case the element type is
 // not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
 // length() function results in a compile time error!
@@ -479,15 +477,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType                ElementType;
-   typedef typename CMathTrait<ElementType>::Type  LengthType;
-
-   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
-
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   return l2Norm( ~dv );
 }
 //*************************************************************************************************
 
@@ -499,7 +489,8 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 // \param dv The given dense vector.
 // \return The square length of the dense vector.
 //
-// This function calculates the actual square length of the dense vector.
+// This function calculates the actual square length of the dense vector. The square length is
+// identical to the squared L2 norm of the vector (see the sqrNorm() function).
 //
 // \b Note: This operation is only defined for numeric data types. In case the element type is
 // not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
@@ -509,80 +500,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType  ElementType;
-
-   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
-
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the smallest element of the dense vector.
-// \ingroup dense_vector
-//
-// \param dv The given dense vector.
-// \return The smallest dense vector element.
-//
-// This function returns the smallest element of the given dense vector. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
-*/
-template< typename VT  // Type of the dense vector
-        , bool TF >    // Transpose flag
-const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
-{
-   using blaze::min;
-
-   typedef typename VT::ElementType    ET;
-   typedef typename VT::CompositeType  CT;
-
-   CT a( ~dv );  // Evaluation of the dense vector operand
-
-   if( a.size() == 0UL ) return ET();
-
-   ET minimum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      minimum = min( minimum, a[i] );
-   return minimum;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the largest element of the dense vector.
-// \ingroup dense_vector
-//
-// \param dv The given dense vector.
-// \return The largest dense vector element.
-//
-// This function returns the largest element of the given dense vector. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
-*/
-template< typename VT  // Type of the dense vector
-        , bool TF >    // Transpose flag
-const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
-{
-   using blaze::max;
-
-   typedef typename VT::ElementType    ET;
-   typedef typename VT::CompositeType  CT;
-
-   CT a( ~dv );  // Evaluation of the dense vector operand
-
-   if( a.size() == 0UL ) return ET();
-
-   ET maximum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      maximum = max( maximum, a[i] );
-   return maximum;
+   return sqrNorm( ~dv );
 }
 //*************************************************************************************************
 
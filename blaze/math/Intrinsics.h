@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/ConversionTrait.h>
 #include <blaze/math/intrinsics/DerivedTypes.h>
 #include <blaze/math/intrinsics/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
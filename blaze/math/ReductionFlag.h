@@ -0,0 +1,107 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ReductionFlag.h
+//  \brief Header file for the reduction flags
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REDUCTIONFLAG_H_
+#define _BLAZE_MATH_REDUCTIONFLAG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION FLAGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduction flag for row-wise reduction operations.
+//
+// This flag can be used to perform row-wise reduction operations on matrices. Row-wise
+// reductions combine the elements of each single row of a matrix and therefore result in a
+// column vector with one element per row. For instance, given the following matrix
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 2 & 3 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)\f]\n
+
+// the row-wise sum results in the column vector \f$ (6,15)^T \f$:
+
+   \code
+   using blaze::rowwise;
+
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   // ... Initialization
+   blaze::DynamicVector<int,blaze::columnVector> s( blaze::sum<rowwise>( A ) );
+   \endcode
+*/
+const size_t rowwise = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduction flag for column-wise reduction operations.
+//
+// This flag can be used to perform column-wise reduction operations on matrices. Column-wise
+// reductions combine the elements of each single column of a matrix and therefore result in a
+// row vector with one element per column. For instance, given the following matrix
+
+                          \f[\left(\begin{array}{*{3}{c}}
+                          1 & 2 & 3 \\
+                          4 & 5 & 6 \\
+                          \end{array}\right)\f]\n
+
+// the column-wise sum results in the row vector \f$ (5,7,9) \f$:
+
+   \code
+   using blaze::columnwise;
+
+   blaze::DynamicMatrix<int> A( 2UL, 3UL );
+   // ... Initialization
+   blaze::DynamicVector<int,blaze::rowVector> s( blaze::sum<columnwise>( A ) );
+   \endcode
+*/
+const size_t columnwise = 1UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,5 +45,6 @@
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/TaskGraphSection.h>
 
 #endif
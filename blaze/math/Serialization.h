@@ -40,6 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/serialization/CSV.h>
+#include <blaze/math/serialization/MappedSerializer.h>
+#include <blaze/math/serialization/MatrixMarket.h>
+#include <blaze/math/serialization/PanelMatrix.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/serialization/VectorSerializer.h>
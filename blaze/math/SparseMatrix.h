@@ -45,6 +45,7 @@
 #include <blaze/math/expressions/SMatAbsExpr.h>
 #include <blaze/math/expressions/SMatDVecMultExpr.h>
 #include <blaze/math/expressions/SMatEvalExpr.h>
+#include <blaze/math/expressions/SMatMapExpr.h>
 #include <blaze/math/expressions/SMatScalarDivExpr.h>
 #include <blaze/math/expressions/SMatScalarMultExpr.h>
 #include <blaze/math/expressions/SMatSMatAddExpr.h>
@@ -47,6 +47,7 @@
 #include <blaze/math/expressions/SVecAbsExpr.h>
 #include <blaze/math/expressions/SVecDVecMultExpr.h>
 #include <blaze/math/expressions/SVecEvalExpr.h>
+#include <blaze/math/expressions/SVecMapExpr.h>
 #include <blaze/math/expressions/SVecScalarDivExpr.h>
 #include <blaze/math/expressions/SVecScalarMultExpr.h>
 #include <blaze/math/expressions/SVecSVecAddExpr.h>
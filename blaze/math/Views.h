@@ -41,7 +41,11 @@
 //*************************************************************************************************
 
 #include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseColumns.h>
+#include <blaze/math/DenseElements.h>
 #include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseRows.h>
+#include <blaze/math/DenseStridedSubvector.h>
 #include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/DenseSubvector.h>
 #include <blaze/math/SparseColumn.h>
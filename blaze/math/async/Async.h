@@ -0,0 +1,315 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/async/Async.h
+//  \brief Header file for the asynchronous evaluation of vector and matrix expressions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ASYNC_ASYNC_H_
+#define _BLAZE_MATH_ASYNC_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/util/Future.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/ThreadPool.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the asynchronous assignment of a vector expression to a vector.
+// \ingroup math
+//
+// The AsyncVectorAssignment functor stores a reference to the target vector and a copy of the
+// right-hand side vector expression. Views (as for instance rows or subvectors) are usually
+// created as temporaries and are therefore copied as well. Only in case the right-hand side
+// operand is a plain vector (i.e. neither an expression nor a view), a reference to the
+// vector is stored.
+*/
+template< typename VT1    // Type of the target vector
+        , typename VT2 >  // Type of the right-hand side vector
+struct AsyncVectorAssignment
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side vector.
+   typedef typename SelectType< IsExpression<VT2>::value || IsView<VT2>::value
+                              , const VT2, const VT2& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncVectorAssignment functor.
+   //
+   // \param lhs The target vector.
+   // \param rhs The right-hand side vector to be assigned.
+   */
+   inline AsyncVectorAssignment( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target vector
+      , rhs_( rhs )  // The right-hand side vector
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluation of the assignment.
+   //
+   // \return void
+   //
+   // The assignment is performed via the assignment operator of the target vector, which
+   // performs the necessary aliasing checks and evaluates aliased expressions into a
+   // temporary vector.
+   */
+   inline void operator()() const {
+      lhs_ = rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1&    lhs_;  //!< The target vector.
+   Operand rhs_;  //!< The right-hand side vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the asynchronous assignment of a matrix expression to a matrix.
+// \ingroup math
+//
+// The AsyncMatrixAssignment functor stores a reference to the target matrix and a copy of the
+// right-hand side matrix expression. Views (as for instance rows or subvectors) are usually
+// created as temporaries and are therefore copied as well. Only in case the right-hand side
+// operand is a plain matrix (i.e. neither an expression nor a view), a reference to the
+// matrix is stored.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+struct AsyncMatrixAssignment
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side matrix.
+   typedef typename SelectType< IsExpression<MT2>::value || IsView<MT2>::value
+                              , const MT2, const MT2& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncMatrixAssignment functor.
+   //
+   // \param lhs The target matrix.
+   // \param rhs The right-hand side matrix to be assigned.
+   */
+   inline AsyncMatrixAssignment( MT1& lhs, const MT2& rhs )
+      : lhs_( lhs )  // The target matrix
+      , rhs_( rhs )  // The right-hand side matrix
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluation of the assignment.
+   //
+   // \return void
+   //
+   // The assignment is performed via the assignment operator of the target matrix, which
+   // performs the necessary aliasing checks and evaluates aliased expressions into a
+   // temporary matrix.
+   */
+   inline void operator()() const {
+      lhs_ = rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1&    lhs_;  //!< The target matrix.
+   Operand rhs_;  //!< The right-hand side matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous evaluation functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline Future async( ThreadPool& pool, Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs,
+                     const Future& d1 = Future(), const Future& d2 = Future() );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future async( ThreadPool& pool, Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                     const Future& d1 = Future(), const Future& d2 = Future() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector (expression) to a vector.
+// \ingroup math
+//
+// \param pool The thread pool executing the assignment.
+// \param lhs The target vector.
+// \param rhs The right-hand side vector (expression) to be assigned.
+// \param d1 The future of the first task that has to be completed before the assignment.
+// \param d2 The future of the second task that has to be completed before the assignment.
+// \return The future of the assignment.
+//
+// This function schedules the assignment \f$ lhs = rhs \f$ for execution by the given thread
+// pool and immediately returns a future referring to the assignment (see the Future class
+// description). The assignment is started as soon as the (optional) dependencies \a d1 and
+// \a d2 have been completed:
+
+   \code
+   blaze::ThreadPool pool( 4 );
+
+   blaze::DynamicMatrix<double> A( 1000UL, 1000UL ), B( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL ), y( 1000UL ), z;
+   // ... Initialization of the matrices and vectors
+
+   blaze::Future fy( blaze::async( pool, y, A * x ) );       // Evaluation of y = A * x
+   blaze::Future fz( blaze::async( pool, z, B * y, fy ) );   // Evaluation of z = B * y after y = A * x
+
+   // ... Performing other work in the meantime
+
+   fz.get();  // Waiting for the completion of both assignments
+   \endcode
+
+// The assignment is performed via the assignment operator of the target vector, i.e. it is
+// subject to the same size checks and aliasing checks as a synchronous assignment: in case the
+// target vector is part of the right-hand side expression (see the \c canAlias() and
+// \c isAliased() functions), the expression is evaluated into a temporary vector first. Any
+// exception thrown during the assignment (as for instance a \a std::invalid_argument exception
+// in case of a size mismatch) is rethrown by the Future::get() function.
+//
+// Please note that all vector and matrix operands of the right-hand side expression are
+// referenced, not copied (in contrast to the expression itself and all views, which are copied
+// and may therefore be temporaries as for instance in \c async( pool, y, row( A, 2UL ) )).
+// Therefore the target vector and all vectors and matrices used within the expression must
+// not be destroyed, modified or read (in case of the target vector) until the assignment has
+// been completed. Assignments that write an operand of the expression have to be specified as
+// dependencies. Also note that the expression is created (and its operands are checked for
+// size consistency) before the dependencies have been completed. Therefore operands that are
+// computed by dependencies must already have their final size.
+*/
+template< typename VT1    // Type of the target vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side vector
+inline Future async( ThreadPool& pool, Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs,
+                     const Future& d1, const Future& d2 )
+{
+   return launch( pool, AsyncVectorAssignment<VT1,VT2>( ~lhs, ~rhs ), d1, d2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix (expression) to a matrix.
+// \ingroup math
+//
+// \param pool The thread pool executing the assignment.
+// \param lhs The target matrix.
+// \param rhs The right-hand side matrix (expression) to be assigned.
+// \param d1 The future of the first task that has to be completed before the assignment.
+// \param d2 The future of the second task that has to be completed before the assignment.
+// \return The future of the assignment.
+//
+// This function schedules the assignment \f$ lhs = rhs \f$ for execution by the given thread
+// pool and immediately returns a future referring to the assignment (see the Future class
+// description). The assignment is started as soon as the (optional) dependencies \a d1 and
+// \a d2 have been completed. The following example demonstrates the overlapping of two
+// independent matrix multiplications with other work:
+
+   \code
+   blaze::ThreadPool pool( 4 );
+
+   blaze::DynamicMatrix<double> A, B, C, D, E, F;
+   // ... Initialization of the matrices
+
+   blaze::Future f1( blaze::async( pool, C, A * B ) );  // Evaluation of C = A * B
+   blaze::Future f2( blaze::async( pool, F, D * E ) );  // Evaluation of F = D * E
+
+   // ... Performing I/O in the meantime
+
+   f1.get();
+   f2.get();
+   \endcode
+
+// The assignment is performed via the assignment operator of the target matrix, i.e. it is
+// subject to the same size checks and aliasing checks as a synchronous assignment: in case the
+// target matrix is part of the right-hand side expression (see the \c canAlias() and
+// \c isAliased() functions), the expression is evaluated into a temporary matrix first. Any
+// exception thrown during the assignment (as for instance a \a std::invalid_argument exception
+// in case of a size mismatch) is rethrown by the Future::get() function.
+//
+// Please note that all vector and matrix operands of the right-hand side expression are
+// referenced, not copied (in contrast to the expression itself and all views, which are copied
+// and may therefore be temporaries as for instance in \c async( pool, y, row( A, 2UL ) )).
+// Therefore the target matrix and all vectors and matrices used within the expression must
+// not be destroyed, modified or read (in case of the target matrix) until the assignment has
+// been completed. Assignments that write an operand of the expression have to be specified as
+// dependencies. Also note that the expression is created (and its operands are checked for
+// size consistency) before the dependencies have been completed. Therefore operands that are
+// computed by dependencies must already have their final size.
+*/
+template< typename MT1  // Type of the target matrix
+        , bool SO1      // Storage order of the target matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future async( ThreadPool& pool, Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                     const Future& d1, const Future& d2 )
+{
+   return launch( pool, AsyncMatrixAssignment<MT1,MT2>( ~lhs, ~rhs ), d1, d2 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
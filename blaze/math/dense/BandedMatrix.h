@@ -0,0 +1,1223 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandedMatrix.h
+//  \brief Header file for the implementation of a banded dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/PMatDMatMultExpr.h>
+#include <blaze/math/expressions/PMatDVecMultExpr.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/DMatDMatMultExprTrait.h>
+#include <blaze/math/traits/DMatDVecMultExprTrait.h>
+#include <blaze/math/traits/DMatScalarMultExprTrait.h>
+#include <blaze/math/traits/DMatTDMatMultExprTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup banded_matrix BandedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Banded dense matrix with diagonal-wise storage.
+// \ingroup banded_matrix
+//
+// The BandedMatrix class template represents a square \f$ N \times N \f$ dense matrix of
+// arbitrary element type with \a KL subdiagonals and \a KU superdiagonals, i.e. a matrix with
+// \f$ a_{ij} = 0 \f$ for all \f$ j+KL < i \f$ and all \f$ i+KU < j \f$. Only the
+// \f$ KL+KU+1 \f$ diagonals of the band are stored. Each diagonal is stored contiguously and
+// is indexed by the row index, i.e. the diagonal \a k (with \f$ 0 \le k \le KL+KU \f$) holds
+// the elements \f$ a_{i,i+k-KL} \f$ at the positions \a i. Thus the main diagonal is stored as
+// diagonal \a KL and a banded matrix requires \f$ (KL+KU+1) N \f$ elements. Read access is
+// possible to all elements of the matrix, write access is restricted to the band:
+
+   \code
+   using blaze::BandedMatrix;
+   using blaze::DynamicVector;
+
+   BandedMatrix<double,1UL,1UL> T( 1000UL );  // Tridiagonal matrix
+   T(2,1) = -1.0;  // Valid write access to the first subdiagonal
+   T(0,2);         // Read access outside the band, which returns 0
+
+   DynamicVector<double> b( 1000UL, 1.0 ), x;
+   // ... Initialization of the diagonals of T
+
+   DynamicVector<double> y( T * b );  // Banded matrix/vector multiplication
+   solve( x, T, b );                  // Banded LU decomposition and substitution
+   \endcode
+
+// The multiplication of a banded matrix with a dense vector or dense matrix, the scaling by a
+// scalar value and the solution of banded systems via solve() use dedicated kernels, whose
+// cost is proportional to the number of stored elements. The multiplication with a dense
+// vector processes the matrix diagonal by diagonal and is vectorized for all element types
+// supporting a vectorized addition and multiplication. Additionally, a banded matrix can be
+// used in all other dense matrix operations, in which it behaves like a row-major dense matrix.
+// However, these operations are neither vectorized nor restricted to the band.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+class BandedMatrix : public DenseMatrix< BandedMatrix<Type,KL,KU>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BandedMatrix<Type,KL,KU>         This;            //!< Type of this BandedMatrix instance.
+   typedef DynamicMatrix<Type,rowMajor>     ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,columnMajor>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,columnMajor>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the matrix elements.
+   typedef const Type                       ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                            Reference;       //!< Reference to a non-constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows of a banded matrix are not stored
+       contiguously, the \a vectorizable compilation flag is set to \a false. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandedMatrix();
+   explicit inline BandedMatrix( size_t n );
+   explicit inline BandedMatrix( size_t n, const Type& init );
+
+   template< typename MT, bool SO >
+   explicit inline BandedMatrix( const DenseMatrix<MT,SO>& dm );
+
+            inline BandedMatrix( const BandedMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BandedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference   operator()( size_t i, size_t j );
+   inline ReturnType  operator()( size_t i, size_t j ) const;
+   inline Type*       data  ();
+   inline const Type* data  () const;
+   inline Type*       data  ( size_t k );
+   inline const Type* data  ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandedMatrix& operator=( const BandedMatrix& rhs );
+
+   template< typename MT, bool SO >
+   inline BandedMatrix& operator=( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BandedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BandedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows    () const;
+   inline size_t columns () const;
+   inline size_t capacity() const;
+   inline void   reset   ();
+   inline void   clear   ();
+   inline void   swap    ( BandedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated diagonals of the band.
+                             /*!< The diagonal \a k starts at the offset \f$ kN \f$ and holds
+                                  the element \f$ a_{i,i+k-KL} \f$ at the position \a i. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>::BandedMatrix()
+   : n_( 0UL  )  // The current number of rows and columns of the matrix
+   , v_( NULL )  // The diagonals of the band
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All matrix elements are initialized to the default value of the element type.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>::BandedMatrix( size_t n )
+   : n_( n )                                // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( (KL+KU+1UL)*n ) )  // The diagonals of the band
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all elements of the band.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the elements of the band.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>::BandedMatrix( size_t n, const Type& init )
+   : n_( n )                                // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( (KL+KU+1UL)*n ) )  // The diagonals of the band
+{
+   std::fill( v_, v_+capacity(), init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense matrix.
+//
+// \param dm Banded dense matrix to be copied.
+// \exception std::invalid_argument Invalid setup of banded matrix.
+//
+// This constructor copies the band of the given dense matrix. In case the given matrix is not
+// square or has non-default elements outside the band, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline BandedMatrix<Type,KL,KU>::BandedMatrix( const DenseMatrix<MT,SO>& dm )
+   : n_( (~dm).rows() )  // The current number of rows and columns of the matrix
+   , v_( NULL )          // The diagonals of the band
+{
+   if( (~dm).columns() != n_ )
+      throw std::invalid_argument( "Invalid setup of banded matrix" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         if( ( j+KL < i || i+KU < j ) && !isDefault( (~dm)(i,j) ) )
+            throw std::invalid_argument( "Invalid setup of banded matrix" );
+      }
+   }
+
+   v_ = allocate<Type>( capacity() );
+   reset();
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const size_t jbegin( ( i > KL )?( i-KL ):( 0UL ) );
+      const size_t jend  ( std::min( i+KU+1UL, n_ ) );
+      for( size_t j=jbegin; j<jend; ++j )
+         v_[(j+KL-i)*n_+i] = (~dm)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>::BandedMatrix( const BandedMatrix& m )
+   : n_( m.n_ )                            // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( m.capacity() ) )  // The diagonals of the band
+{
+   std::copy( m.v_, m.v_+capacity(), v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BandedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>::~BandedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[i-KL..i+KU]\f$.
+// \return Reference to the accessed value.
+//
+// Only the elements of the band can be accessed via this function.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline typename BandedMatrix<Type,KL,KU>::Reference
+   BandedMatrix<Type,KL,KU>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( i<=j+KL && j<=i+KU, "Invalid access to an element outside the band" );
+   return v_[(j+KL-i)*n_+i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The accessed value.
+//
+// In case the accessed element lies outside the band, the default value of the element type
+// is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline typename BandedMatrix<Type,KL,KU>::ReturnType
+   BandedMatrix<Type,KL,KU>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return ( j+KL < i || i+KU < j )?( Type() ):( v_[(j+KL-i)*n_+i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored diagonals.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline Type* BandedMatrix<Type,KL,KU>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored diagonals.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline const Type* BandedMatrix<Type,KL,KU>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored diagonal \a k.
+//
+// \param k The index of the diagonal. The index has to be in the range \f$[0..KL+KU]\f$.
+// \return Pointer to the \a N elements of the diagonal \a k.
+//
+// The diagonal \a k holds the element \f$ a_{i,i+k-KL} \f$ at the position \a i, i.e. the
+// main diagonal is the diagonal \a KL. The positions without a matrix element (the first
+// \f$ KL-k \f$ positions of a subdiagonal and the last \f$ k-KL \f$ positions of a
+// superdiagonal) are unused.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline Type* BandedMatrix<Type,KL,KU>::data( size_t k )
+{
+   BLAZE_USER_ASSERT( k <= KL+KU, "Invalid diagonal access index" );
+   return v_ + k*n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored diagonal \a k.
+//
+// \param k The index of the diagonal. The index has to be in the range \f$[0..KL+KU]\f$.
+// \return Pointer to the \a N elements of the diagonal \a k.
+//
+// The diagonal \a k holds the element \f$ a_{i,i+k-KL} \f$ at the position \a i, i.e. the
+// main diagonal is the diagonal \a KL. The positions without a matrix element (the first
+// \f$ KL-k \f$ positions of a subdiagonal and the last \f$ k-KL \f$ positions of a
+// superdiagonal) are unused.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline const Type* BandedMatrix<Type,KL,KU>::data( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k <= KL+KU, "Invalid diagonal access index" );
+   return v_ + k*n_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline BandedMatrix<Type,KL,KU>& BandedMatrix<Type,KL,KU>::operator=( const BandedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BandedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Banded dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to banded matrix.
+//
+// In case the given matrix is not square or has non-default elements outside the band, a
+// \a std::invalid_argument exception is thrown and the banded matrix remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline BandedMatrix<Type,KL,KU>& BandedMatrix<Type,KL,KU>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   try {
+      BandedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::invalid_argument( "Invalid assignment to banded matrix" );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a banded matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+//
+// Only the stored diagonals are scaled. In case the product of an element and the scalar value
+// is of the element type of the matrix, the scaling is vectorized.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t KL         // Number of subdiagonals
+        , size_t KU >       // Number of superdiagonals
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BandedMatrix<Type,KL,KU> >::Type&
+   BandedMatrix<Type,KL,KU>::operator*=( Other rhs )
+{
+   if( IsSame< typename MultTrait<Type,Other>::Type, Type >::value ) {
+      packedScale( v_, Type( rhs ), capacity() );
+   }
+   else {
+      for( size_t i=0UL; i<capacity(); ++i )
+         v_[i] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a banded matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// Only the stored diagonals are divided.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t KL         // Number of subdiagonals
+        , size_t KU >       // Number of superdiagonals
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BandedMatrix<Type,KL,KU> >::Type&
+   BandedMatrix<Type,KL,KU>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t i=0UL; i<capacity(); ++i )
+      v_[i] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline size_t BandedMatrix<Type,KL,KU>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline size_t BandedMatrix<Type,KL,KU>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements, i.e. \f$ (KL+KU+1) N \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline size_t BandedMatrix<Type,KL,KU>::capacity() const
+{
+   return (KL+KU+1UL)*n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline void BandedMatrix<Type,KL,KU>::reset()
+{
+   std::fill( v_, v_+capacity(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline void BandedMatrix<Type,KL,KU>::clear()
+{
+   BandedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline void BandedMatrix<Type,KL,KU>::swap( BandedMatrix& m ) /* throw() */
+{
+   std::swap( n_, m.n_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t KL         // Number of subdiagonals
+        , size_t KU >       // Number of superdiagonals
+template< typename Other >  // Data type of the foreign expression
+inline bool BandedMatrix<Type,KL,KU>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t KL         // Number of subdiagonals
+        , size_t KU >       // Number of superdiagonals
+template< typename Other >  // Data type of the foreign expression
+inline bool BandedMatrix<Type,KL,KU>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandedMatrix functions */
+//@{
+template< typename Type, size_t KL, size_t KU, typename VT >
+inline void multiply( DynamicVector<Type,columnVector>& y, const BandedMatrix<Type,KL,KU>& A,
+                      const DenseVector<VT,columnVector>& x );
+
+template< typename Type, size_t KL, size_t KU, typename MT, bool SO >
+inline void multiply( DynamicMatrix<Type,rowMajor>& C, const BandedMatrix<Type,KL,KU>& A,
+                      const DenseMatrix<MT,SO>& B );
+
+template< typename Type, size_t KL, size_t KU, typename VT >
+inline void solve( DynamicVector<Type,columnVector>& x, const BandedMatrix<Type,KL,KU>& A,
+                   const DenseVector<VT,columnVector>& b );
+
+template< typename Type, size_t KL, size_t KU >
+inline void swap( BandedMatrix<Type,KL,KU>& a, BandedMatrix<Type,KL,KU>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a banded matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup banded_matrix
+//
+// \param y The resulting dense vector.
+// \param A The left-hand side banded matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function implements the banded matrix/vector multiplication. The matrix is processed
+// diagonal by diagonal, i.e. each stored diagonal is multiplied element-wise with the according
+// shifted range of \a x and added to \a y. Thus all memory accesses are contiguous and the
+// total cost is \f$ O((KL+KU+1) N) \f$. In contrast to the multiplication operator, the given
+// result vector is reused.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename VT >  // Type of the right-hand side dense vector
+inline void multiply( DynamicVector<Type,columnVector>& y, const BandedMatrix<Type,KL,KU>& A,
+                      const DenseVector<VT,columnVector>& x )
+{
+   typedef DynamicVector<Type,columnVector>  VectorType;
+   typedef typename If< IsSame<VT,VectorType>, const VectorType&, const VectorType >::Type  Operand;
+
+   if( A.columns() != (~x).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   Operand tmp( ~x );
+
+   if( static_cast<const void*>( &y ) == static_cast<const void*>( &tmp ) ) {
+      VectorType res;
+      multiply( res, A, tmp );
+      y.swap( res );
+      return;
+   }
+
+   const size_t n( A.rows() );
+
+   y.resize( n, false );
+   reset( y );
+
+   const Type* xp( tmp.data() );
+   Type* yp( y.data() );
+
+   for( size_t k=0UL; k<=KL+KU; ++k )
+   {
+      const size_t ibegin( ( k < KL )?( std::min( KL-k, n ) ):( 0UL ) );
+      const size_t iend  ( ( k > KL )?( n - std::min( k-KL, n ) ):( n ) );
+
+      if( ibegin < iend ) {
+         packedMultAdd( yp+ibegin, A.data( k )+ibegin, xp+ibegin+k-KL, iend-ibegin );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a banded matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup banded_matrix
+//
+// \param C The resulting row-major dense matrix.
+// \param A The left-hand side banded matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function implements the banded matrix/matrix multiplication. Row \a i of the result is
+// computed as the sum of the rows \f$ i-KL \ldots i+KU \f$ of \a B, scaled by the according
+// elements of the band. In contrast to the multiplication operator, the given result matrix
+// is reused.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void multiply( DynamicMatrix<Type,rowMajor>& C, const BandedMatrix<Type,KL,KU>& A,
+                      const DenseMatrix<MT,SO>& B )
+{
+   typedef DynamicMatrix<Type,rowMajor>  MatrixType;
+   typedef typename If< IsSame<MT,MatrixType>, const MatrixType&, const MatrixType >::Type  Operand;
+
+   if( A.columns() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   Operand tmp( ~B );
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &tmp ) ) {
+      MatrixType res;
+      multiply( res, A, tmp );
+      C.swap( res );
+      return;
+   }
+
+   const size_t n( A.rows() );
+   const size_t k( tmp.columns() );
+
+   C.resize( n, k, false );
+   reset( C );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t jbegin( ( i > KL )?( i-KL ):( 0UL ) );
+      const size_t jend  ( std::min( i+KU+1UL, n ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         packedAxpy( C.data( i ), tmp.data( j ), A.data( j+KL-i )[i], k );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backward substitution for a banded matrix without subdiagonals.
+// \ingroup banded_matrix
+//
+// \param x The right-hand side vector, which is overwritten by the solution.
+// \param U The upper part of the banded matrix (the subdiagonals are ignored).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline void bandedBackwardSubstitution( Type* x, const BandedMatrix<Type,KL,KU>& U )
+{
+   const size_t n( U.rows() );
+   const Type* diag( U.data( KL ) );
+
+   for( size_t i=n; i-- > 0UL; ) {
+      const size_t jend( std::min( i+KU+1UL, n ) );
+      for( size_t j=i+1UL; j<jend; ++j )
+         x[i] -= U.data( j+KL-i )[i] * x[j];
+      x[i] /= diag[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the banded system \f$ A*\vec{x}=\vec{b} \f$.
+// \ingroup banded_matrix
+//
+// \param x The resulting solution vector.
+// \param A The banded system matrix.
+// \param b The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the given banded system via an LU decomposition of a copy of the band,
+// followed by a backward substitution. For a tridiagonal matrix this corresponds to the Thomas
+// algorithm. The total cost is \f$ O(KL \cdot KU \cdot N) \f$ for the decomposition and
+// \f$ O((KL+KU+1) N) \f$ for the substitution. In case the matrix has no subdiagonals, no
+// decomposition and no copy of the band are required. Since the decomposition is performed
+// without pivoting in order to preserve the band structure, the system matrix is expected to be
+// non-singular and either diagonally dominant or symmetric positive definite, as for instance
+// the matrices of spline interpolations and finite difference discretizations. \a x and \a b
+// may refer to the same vector.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename VT >  // Type of the right-hand side dense vector
+inline void solve( DynamicVector<Type,columnVector>& x, const BandedMatrix<Type,KL,KU>& A,
+                   const DenseVector<VT,columnVector>& b )
+{
+   if( A.columns() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   x = ~b;
+
+   Type* xp( x.data() );
+
+   if( KL == 0UL ) {
+      bandedBackwardSubstitution( xp, A );
+      return;
+   }
+
+   const size_t n( A.rows() );
+   BandedMatrix<Type,KL,KU> LU( A );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const Type pivot( LU(k,k) );
+      const size_t iend( std::min( k+KL+1UL, n ) );
+      const size_t jend( std::min( k+KU+1UL, n ) );
+
+      for( size_t i=k+1UL; i<iend; ++i ) {
+         const Type l( LU(i,k) / pivot );
+         for( size_t j=k+1UL; j<jend; ++j )
+            LU(i,j) -= l * LU(k,j);
+         xp[i] -= l * xp[k];
+      }
+   }
+
+   bandedBackwardSubstitution( xp, LU );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two banded matrices.
+// \ingroup banded_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline void swap( BandedMatrix<Type,KL,KU>& a, BandedMatrix<Type,KL,KU>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a banded matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup banded_matrix
+//
+// \param mat The left-hand side banded matrix.
+// \param vec The right-hand side dense vector.
+// \return The expression representing the banded matrix/vector multiplication.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename VT >  // Type of the right-hand side dense vector
+inline const PMatDVecMultExpr< BandedMatrix<Type,KL,KU>, VT >
+   operator*( const BandedMatrix<Type,KL,KU>& mat, const DenseVector<VT,columnVector>& vec )
+{
+   if( mat.columns() != (~vec).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   return PMatDVecMultExpr< BandedMatrix<Type,KL,KU>, VT >( mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a banded matrix and a dense matrix
+//        (\f$ C=A*B \f$).
+// \ingroup banded_matrix
+//
+// \param lhs The left-hand side banded matrix.
+// \param rhs The right-hand side dense matrix.
+// \return The expression representing the banded matrix/matrix multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline const PMatDMatMultExpr< BandedMatrix<Type,KL,KU>, MT >
+   operator*( const BandedMatrix<Type,KL,KU>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   if( lhs.columns() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   return PMatDMatMultExpr< BandedMatrix<Type,KL,KU>, MT >( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the banded scaling operators.
+// \ingroup banded_matrix
+//
+// The banded scaling operators are selected in case the product of an element of the banded
+// matrix and the scalar value is of the element type of the matrix. In all other cases the
+// default dense matrix/scalar multiplication is used.
+*/
+template< typename Type  // Data type of the matrix
+        , typename ST >  // Type of the scalar value
+struct BandedScaling
+{
+   enum { value = IsNumeric<ST>::value && IsSame< typename MultTrait<Type,ST>::Type, Type >::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a banded matrix and a scalar value
+//        (\f$ A=B*s \f$).
+// \ingroup banded_matrix
+//
+// \param mat The left-hand side banded matrix.
+// \param scalar The right-hand side scalar value for the multiplication.
+// \return The scaled banded matrix.
+//
+// In contrast to the default dense matrix/scalar multiplication, which would evaluate all
+// \f$ N^2 \f$ elements, only the stored diagonals are scaled by a vectorized kernel and the
+// result is again a banded matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU      // Number of superdiagonals
+        , typename ST >  // Type of the right-hand side scalar
+inline const typename EnableIf< BandedScaling<Type,ST>, BandedMatrix<Type,KL,KU> >::Type
+   operator*( const BandedMatrix<Type,KL,KU>& mat, ST scalar )
+{
+   BandedMatrix<Type,KL,KU> res( mat );
+   res *= scalar;
+   return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a scalar value and a banded matrix
+//        (\f$ A=s*B \f$).
+// \ingroup banded_matrix
+//
+// \param scalar The left-hand side scalar value for the multiplication.
+// \param mat The right-hand side banded matrix.
+// \return The scaled banded matrix.
+//
+// In contrast to the default scalar/dense matrix multiplication, which would evaluate all
+// \f$ N^2 \f$ elements, only the stored diagonals are scaled by a vectorized kernel and the
+// result is again a banded matrix.
+*/
+template< typename ST    // Type of the left-hand side scalar
+        , typename Type  // Data type of the matrix
+        , size_t KL      // Number of subdiagonals
+        , size_t KU >    // Number of superdiagonals
+inline const typename EnableIf< BandedScaling<Type,ST>, BandedMatrix<Type,KL,KU> >::Type
+   operator*( ST scalar, const BandedMatrix<Type,KL,KU>& mat )
+{
+   BandedMatrix<Type,KL,KU> res( mat );
+   res *= scalar;
+   return res;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t KL, size_t KU, typename VT >
+struct DMatDVecMultExprTrait< BandedMatrix<T,KL,KU>, VT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseVector<VT>::value && IsColumnVector<VT>::value
+                              , const PMatDVecMultExpr< BandedMatrix<T,KL,KU>, VT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t KL, size_t KU, typename MT >
+struct DMatDMatMultExprTrait< BandedMatrix<T,KL,KU>, MT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseMatrix<MT>::value && IsRowMajorMatrix<MT>::value
+                              , const PMatDMatMultExpr< BandedMatrix<T,KL,KU>, MT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t KL, size_t KU, typename MT >
+struct DMatTDMatMultExprTrait< BandedMatrix<T,KL,KU>, MT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseMatrix<MT>::value && IsColumnMajorMatrix<MT>::value
+                              , const PMatDMatMultExpr< BandedMatrix<T,KL,KU>, MT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t KL, size_t KU, typename ST >
+struct DMatScalarMultExprTrait< BandedMatrix<T,KL,KU>, ST >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< BandedScaling<T,ST>::value
+                              , const BandedMatrix<T,KL,KU>
+                              , typename DMatScalarMultExprTraitHelper< BandedMatrix<T,KL,KU>, ST
+                                                                      , IsNumeric<ST>::value >::Type
+                              >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
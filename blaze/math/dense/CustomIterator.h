@@ -0,0 +1,714 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CustomIterator.h
+//  \brief Header file for the CustomIterator class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CUSTOMITERATOR_H_
+#define _BLAZE_MATH_DENSE_CUSTOMITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator for custom vectors and matrices.
+// \ingroup math
+//
+// The CustomIterator represents a generic random-access iterator that can be used for the
+// CustomVector class template and for specific rows/columns of the CustomMatrix class template.
+// In contrast to the DenseIterator it does not rely on the allocation strategy of the Blaze
+// containers: In case the underlying memory is unaligned (\a AF is set to \a blaze::unaligned)
+// all intrinsic loads are performed as unaligned loads, in case the memory is unpadded (\a PF
+// is set to \a blaze::unpadded) the final, incomplete intrinsic element of the vector/row/column
+// is loaded element-wise and the remaining values are set to zero. Therefore the iterator needs
+// to know the end of the range it iterates over.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+class CustomIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+   typedef Type                             ValueType;         //!< Type of the underlying elements.
+   typedef Type*                            PointerType;       //!< Pointer return type.
+   typedef Type&                            ReferenceType;     //!< Reference return type.
+   typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+   // STL iterator requirements
+   typedef IteratorCategory  iterator_category;  //!< The iterator category.
+   typedef ValueType         value_type;         //!< Type of the underlying elements.
+   typedef PointerType       pointer;            //!< Pointer return type.
+   typedef ReferenceType     reference;          //!< Reference return type.
+   typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+
+   //! Intrinsic type of the elements.
+   typedef typename IntrinsicTrait<Type>::Type  IntrinsicType;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomIterator();
+   explicit inline CustomIterator( Type* ptr, Type* end );
+
+   template< typename Other >
+   inline CustomIterator( const CustomIterator<Other,AF,PF>& it );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline CustomIterator& operator+=( ptrdiff_t inc );
+   inline CustomIterator& operator-=( ptrdiff_t inc );
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   inline CustomIterator&      operator++();
+   inline const CustomIterator operator++( int );
+   inline CustomIterator&      operator--();
+   inline const CustomIterator operator--( int );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline ReferenceType operator[]( size_t index ) const;
+   inline ReferenceType operator* () const;
+   inline PointerType   operator->() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline PointerType base() const;
+   inline PointerType last() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   inline const IntrinsicType load () const;
+   inline const IntrinsicType loadu() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PointerType ptr_;  //!< Pointer to the current element.
+   PointerType end_;  //!< Pointer one past the last element of the range.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the CustomIterator class.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>::CustomIterator()
+   : ptr_( NULL )  // Pointer to the current element
+   , end_( NULL )  // Pointer one past the last element of the range
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the CustomIterator class.
+//
+// \param ptr Pointer to the initial element.
+// \param end Pointer one past the last element of the range.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>::CustomIterator( Type* ptr, Type* end )
+   : ptr_( ptr )  // Pointer to the current element
+   , end_( end )  // Pointer one past the last element of the range
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different CustomIterator instances.
+//
+// \param it The foreign CustomIterator instance to be copied.
+*/
+template< typename Type     // Type of the elements
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Type of the foreign elements
+inline CustomIterator<Type,AF,PF>::CustomIterator( const CustomIterator<Other,AF,PF>& it )
+   : ptr_( it.base() )  // Pointer to the current element
+   , end_( it.last() )  // Pointer one past the last element of the range
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return Reference to the incremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator+=( ptrdiff_t inc )
+{
+   ptr_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return Reference to the decremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator-=( ptrdiff_t dec )
+{
+   ptr_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator++()
+{
+   ++ptr_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> CustomIterator<Type,AF,PF>::operator++( int )
+{
+   return CustomIterator( ptr_++, end_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomIterator<Type,AF,PF>& CustomIterator<Type,AF,PF>::operator--()
+{
+   --ptr_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> CustomIterator<Type,AF,PF>::operator--( int )
+{
+   return CustomIterator( ptr_--, end_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::ReferenceType
+   CustomIterator<Type,AF,PF>::operator[]( size_t index ) const
+{
+   return ptr_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Reference to the current element.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::ReferenceType
+   CustomIterator<Type,AF,PF>::operator*() const
+{
+   return *ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Pointer to the element at the current iterator position.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType
+   CustomIterator<Type,AF,PF>::operator->() const
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the underlying member of the iterator.
+//
+// \return Pointer to the current memory location.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType CustomIterator<Type,AF,PF>::base() const
+{
+   return ptr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the end of the range the iterator is traversing.
+//
+// \return Pointer one past the last element of the range.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomIterator<Type,AF,PF>::PointerType CustomIterator<Type,AF,PF>::last() const
+{
+   return end_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Aligned load of the intrinsic element at the current iterator position.
+//
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of the intrinsic element of the current element. In
+// case the underlying memory is not guaranteed to be aligned, an unaligned load is performed
+// instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const typename CustomIterator<Type,AF,PF>::IntrinsicType
+   CustomIterator<Type,AF,PF>::load() const
+{
+   if( AF && ( PF || end_ - ptr_ >= ptrdiff_t( IntrinsicTrait<Type>::size ) ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( ptr_ ), "Invalid alignment detected" );
+      return blaze::load( ptr_ );
+   }
+   else return loadu();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of the intrinsic element at the current iterator position.
+//
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of the intrinsic element of the current element.
+// In case the underlying memory is unpadded and the current intrinsic element exceeds the end
+// of the range, the remaining elements are loaded element-wise and the rest of the intrinsic
+// element is set to zero. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Type of the elements
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const typename CustomIterator<Type,AF,PF>::IntrinsicType
+   CustomIterator<Type,AF,PF>::loadu() const
+{
+   if( PF || end_ - ptr_ >= ptrdiff_t( IntrinsicTrait<Type>::size ) ) {
+      return blaze::loadu( ptr_ );
+   }
+   else {
+      typename RemoveConst<Type>::Type array[IntrinsicTrait<Type>::size];
+      for( ptrdiff_t j=0L; j<ptrdiff_t( IntrinsicTrait<Type>::size ); ++j )
+         array[j] = ( j < end_-ptr_ )?( ptr_[j] ):( Type() );
+      return blaze::loadu( array );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomIterator operators */
+//@{
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator==( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator!=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator<( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator>( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator<=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename T1, typename T2, bool AF, bool PF >
+inline bool operator>=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator+( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator+( ptrdiff_t inc, const CustomIterator<Type,AF,PF>& it );
+
+template< typename Type, bool AF, bool PF >
+inline const CustomIterator<Type,AF,PF> operator-( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc );
+
+template< typename Type, bool AF, bool PF >
+inline ptrdiff_t operator-( const CustomIterator<Type,AF,PF>& lhs, const CustomIterator<Type,AF,PF>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator==( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() == rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator!=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() != rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator<( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() < rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator>( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() > rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is less or equal, \a false if not.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator<=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() <= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename T1  // Element type of the left-hand side iterator
+        , typename T2  // Element type of the right-hand side iterator
+        , bool AF      // Alignment flag
+        , bool PF >    // Padding flag
+inline bool operator>=( const CustomIterator<T1,AF,PF>& lhs, const CustomIterator<T2,AF,PF>& rhs )
+{
+   return lhs.base() >= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a CustomIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator+( const CustomIterator<Type,AF,PF>& it, ptrdiff_t inc )
+{
+   return CustomIterator<Type,AF,PF>( it.base() + inc, it.last() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a CustomIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator+( ptrdiff_t inc, const CustomIterator<Type,AF,PF>& it )
+{
+   return CustomIterator<Type,AF,PF>( it.base() + inc, it.last() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a CustomIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const CustomIterator<Type,AF,PF> operator-( const CustomIterator<Type,AF,PF>& it, ptrdiff_t dec )
+{
+   return CustomIterator<Type,AF,PF>( it.base() - dec, it.last() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two CustomIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename Type  // Element type of the iterator
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline ptrdiff_t operator-( const CustomIterator<Type,AF,PF>& lhs, const CustomIterator<Type,AF,PF>& rhs )
+{
+   return lhs.base() - rhs.base();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
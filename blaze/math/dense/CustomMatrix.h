@@ -0,0 +1,4569 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CustomMatrix.h
+//  \brief Header file for the implementation of a customizable matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CUSTOMMATRIX_H_
+#define _BLAZE_MATH_DENSE_CUSTOMMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/CustomIterator.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/views/AlignmentFlag.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Streaming.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_matrix CustomMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a customizable matrix.
+// \ingroup custom_matrix
+//
+// The CustomMatrix class template provides the functionality to represent an external array of
+// elements of arbitrary type and a fixed size as a native \b Blaze dense matrix data structure.
+// Thus in contrast to all other dense matrix types a custom matrix does not perform any kind
+// of memory allocation by itself, but it is provided with an existing array of element during
+// construction. A custom matrix can therefore be considered an alias to the existing array.
+// The type of the elements, the properties of the given array of elements and the storage order
+// of the matrix can be specified via the following four template parameters:
+
+   \code
+   template< typename Type, bool AF, bool PF, bool SO >
+   class CustomMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CustomMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - AF  : specifies whether the represented, external arrays are properly aligned with
+//          respect to the available instruction set (SSE, AVX, ...) (\a blaze::aligned) or
+//          not (\a blaze::unaligned).
+//  - PF  : specifies whether the represented, external arrays are properly padded with
+//          respect to the available instruction set (\a blaze::padded) or not
+//          (\a blaze::unpadded).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The following examples give an impression of several possible types of custom matrices:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   // Definition of a custom row-major matrix for unaligned, unpadded integer arrays
+   typedef CustomMatrix<int,unaligned,unpadded,rowMajor>  UnalignedUnpadded;
+
+   // Definition of a custom column-major matrix for unaligned but padded 'float' arrays
+   typedef CustomMatrix<float,unaligned,padded,columnMajor>  UnalignedPadded;
+
+   // Definition of a custom row-major matrix for aligned, unpadded 'double' arrays
+   typedef CustomMatrix<double,aligned,unpadded,rowMajor>  AlignedUnpadded;
+
+   // Definition of a custom column-major matrix for aligned, padded 'complex<double>' arrays
+   typedef CustomMatrix<complex<double>,aligned,padded,columnMajor>  AlignedPadded;
+   \endcode
+
+// \n \section custommatrix_special_properties Special Properties of Custom Matrices
+//
+// In comparison with the remaining \b Blaze dense matrix types CustomMatrix has several special
+// characteristics. All of these result from the fact that a custom matrix is not performing any
+// kind of memory allocation, but instead is given an existing array of elements:
+//
+//  - The custom matrix neither allocates nor deallocates the array. The array has to outlive
+//    all custom matrices that refer to it and a custom matrix can not be resized.
+//  - Copy construction creates a new custom matrix that represents the same array as the
+//    original custom matrix. Copy assignment on the other hand does not change which array is
+//    represented, but assigns the values of the right-hand side matrix to the array.
+//  - The rows (in case of a row-major matrix) or columns (in case of a column-major matrix) may
+//    be separated by an arbitrary \a spacing, i.e. the number of elements between the beginning
+//    of two consecutive rows/columns. This enables the representation of sub-blocks of larger
+//    external arrays as well as arrays with a row/column stride imposed by another library.
+//  - In case the custom matrix is specified as \a aligned the passed array must be aligned
+//    according to the requirements of the used instruction set (SSE, AVX, ...) and the spacing
+//    must be a multiple of the number of values per intrinsic element, such that every row or
+//    column is aligned. Otherwise a \a std::invalid_argument exception is thrown. An unaligned
+//    custom matrix can represent arbitrary arrays; in this case all intrinsic loads and stores
+//    are performed as unaligned operations.
+//  - In case the custom matrix is specified as \a padded the spacing must be a multiple of the
+//    number of values per intrinsic element and the padding elements at the end of each row or
+//    column must be zero. In case of an unpadded matrix the final, incomplete intrinsic element
+//    of each row or column is processed element-wise.
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   // Representing a 2x3 block of an external 4x5 row-major array of values
+   std::vector<double> memory( 20UL );
+   CustomMatrix<double,unaligned,unpadded,rowMajor> A( &memory[6], 2UL, 3UL, 5UL );
+
+   // Representing an aligned and padded 3x3 matrix with a spacing of 4 elements (for AVX)
+   double* array = blaze::allocate<double>( 12UL );
+   // ... Initialization of the values and the padding elements
+   CustomMatrix<double,aligned,padded,rowMajor> B( array, 3UL, 3UL, 4UL );
+   \endcode
+
+// \n \section custommatrix_arithmetic_operations Arithmetic Operations
+//
+// The use of CustomMatrix is very natural and intuitive. All operations (addition, subtraction,
+// multiplication, scaling, ...) can be performed on all possible combinations of row-major and
+// column-major dense and sparse matrices with fitting element types. Since the custom matrix
+// exposes the same intrinsic load/store interface as the other dense matrix types, all
+// vectorized and shared memory parallel kernels are available for custom matrices:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   std::vector<double> memory1( 6UL ), memory2( 6UL );
+
+   CustomMatrix<double,unaligned,unpadded,rowMajor> A( &memory1[0], 2UL, 3UL );
+   A(0,0) = 1.0; A(0,1) = 2.0; A(0,2) = 3.0;  // Initialization of the first row
+   A(1,0) = 4.0; A(1,1) = 5.0; A(1,2) = 6.0;  // Initialization of the second row
+
+   CustomMatrix<double,unaligned,unpadded,columnMajor> B( &memory2[0], 2UL, 3UL );
+   B = 2.0;                                    // Homogeneous initialization of all elements
+
+   DynamicMatrix<double> C( A + B );  // Matrix addition
+   DynamicMatrix<double> D( A * trans( B ) );  // Matrix multiplication
+
+   A *= 2.0;      // In-place scaling of matrix A
+   A += B;        // Addition assignment
+   A -= 2.0 * B;  // Subtraction assignment
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool AF                          // Alignment flag
+        , bool PF                          // Padding flag
+        , bool SO = defaultStorageOrder >  // Storage order
+class CustomMatrix : public DenseMatrix< CustomMatrix<Type,AF,PF,SO>, SO >
+{
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CustomMatrix<Type,AF,PF,SO>        This;            //!< Type of this CustomMatrix instance.
+   typedef DynamicMatrix<Type,SO>             ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>            OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>            TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                               ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type                  IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                        ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                        CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                              Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                        ConstReference;  //!< Reference to a constant matrix value.
+   typedef CustomIterator<Type,AF,PF>         Iterator;        //!< Iterator over non-constant elements.
+   typedef CustomIterator<const Type,AF,PF>   ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. In case the element type of the matrix is a vectorizable
+       data type, the \a vectorizable compilation flag is set to \a true, otherwise it is set to
+       \a false. Note that this is independent of the alignment and padding of the represented
+       array. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomMatrix();
+   explicit inline CustomMatrix( Type* ptr, size_t m, size_t n );
+   explicit inline CustomMatrix( Type* ptr, size_t m, size_t n, size_t nn );
+
+   inline CustomMatrix( const CustomMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Type*          data  ();
+   inline const Type*    data  () const;
+   inline Type*          data  ( size_t i );
+   inline const Type*    data  ( size_t i ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename Other, size_t M, size_t N >
+   inline CustomMatrix& operator=( const Other (&array)[M][N] );
+
+                                     inline CustomMatrix& operator= ( const Type& set );
+                                     inline CustomMatrix& operator= ( const CustomMatrix& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        spacing() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t i ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+                              inline void          clear();
+   template< typename Other > inline CustomMatrix& scale( Other scalar );
+                              inline void          swap( CustomMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load  ( size_t i, size_t j ) const;
+   inline IntrinsicType loadu ( size_t i, size_t j ) const;
+   inline void          store ( size_t i, size_t j, const IntrinsicType& value );
+   inline void          storeu( size_t i, size_t j, const IntrinsicType& value );
+   inline void          stream( size_t i, size_t j, const IntrinsicType& value );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT > inline void addAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,!SO>& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename MT > inline void subAssign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,!SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;   //!< The number of rows of the matrix.
+   size_t n_;   //!< The number of columns of the matrix.
+   size_t nn_;  //!< The number of elements between the beginning of two rows.
+   Type* v_;    //!< The custom array of elements.
+                /*!< Access to the matrix elements is gained via the function call
+                     operator. The memory layout of the elements is
+                     \f[\left(\begin{array}{*{5}{c}}
+                     0            & 1             & 2             & \cdots & N-1         \\
+                     N            & N+1           & N+2           & \cdots & 2 \cdot N-1 \\
+                     \vdots       & \vdots        & \vdots        & \ddots & \vdots      \\
+                     M \cdot N-N  & M \cdot N-N+1 & M \cdot N-N+2 & \cdots & M \cdot N-1 \\
+                     \end{array}\right)\f],
+                     where \f$ N \f$ denotes the spacing between two rows. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomMatrix.
+//
+// The default constructor creates an empty custom matrix that does not represent any array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix()
+   : m_ ( 0UL  )  // The number of rows of the matrix
+   , n_ ( 0UL  )  // The number of columns of the matrix
+   , nn_( 0UL  )  // The number of elements between two rows
+   , v_ ( NULL )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an unpadded custom matrix of size \f$ m \times n \f$.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \exception std::invalid_argument Invalid array of elements.
+// \exception std::invalid_argument Invalid alignment detected.
+//
+// This constructor creates an unpadded custom matrix of size \f$ m \times n \f$, whose rows
+// are stored contiguously in the given array. The construction fails if ...
+//
+//  - ... the passed pointer is NULL;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...) or the number of
+//    columns is not a multiple of the number of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown. Note that this constructor
+// is only available for unpadded custom matrices, i.e. its use results in a compilation error in
+// case the padding flag \a PF is set to \a padded.
+//
+// \b Note: The custom matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n )
+   : m_ ( m   )  // The number of rows of the matrix
+   , n_ ( n   )  // The number of columns of the matrix
+   , nn_( n   )  // The number of elements between two rows
+   , v_ ( ptr )  // The custom array of elements
+{
+   BLAZE_STATIC_ASSERT( !PF );
+
+   if( ptr == NULL )
+      throw std::invalid_argument( "Invalid array of elements" );
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % IT::size != 0UL ) )
+      throw std::invalid_argument( "Invalid alignment detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a custom matrix of size \f$ m \times n \f$ with a given spacing.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param nn The total number of elements between two rows.
+// \exception std::invalid_argument Invalid array of elements.
+// \exception std::invalid_argument Invalid spacing specified.
+// \exception std::invalid_argument Invalid alignment detected.
+// \exception std::invalid_argument Insufficient capacity for padded matrix.
+//
+// This constructor creates a custom matrix of size \f$ m \times n \f$, whose rows are
+// separated by \a nn elements in the given array. The construction fails if ...
+//
+//  - ... the passed pointer is NULL;
+//  - ... the spacing \a nn is smaller than the number of columns;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...) or the spacing is not
+//    a multiple of the number of values per intrinsic element;
+//  - ... the padding flag \a PF is set to \a padded, but the spacing is not a multiple of the
+//    number of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown. In case of a padded
+// custom matrix the padding elements at the end of each row have to be zero.
+//
+// \b Note: The custom matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n, size_t nn )
+   : m_ ( m   )  // The number of rows of the matrix
+   , n_ ( n   )  // The number of columns of the matrix
+   , nn_( nn  )  // The number of elements between two rows
+   , v_ ( ptr )  // The custom array of elements
+{
+   if( ptr == NULL )
+      throw std::invalid_argument( "Invalid array of elements" );
+
+   if( nn_ < n_ )
+      throw std::invalid_argument( "Invalid spacing specified" );
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % IT::size != 0UL ) )
+      throw std::invalid_argument( "Invalid alignment detected" );
+
+   if( PF && nn_ % IT::size != 0UL )
+      throw std::invalid_argument( "Insufficient capacity for padded matrix" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CustomMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor initializes the custom matrix as an exact copy of the given custom
+// matrix, i.e. the new custom matrix represents the same array of elements as \a m.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( const CustomMatrix& m )
+   : m_ ( m.m_  )  // The number of rows of the matrix
+   , n_ ( m.n_  )  // The number of columns of the matrix
+   , nn_( m.nn_ )  // The number of elements between two rows
+   , v_ ( m.v_  )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::Reference
+   CustomMatrix<Type,AF,PF,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::ConstReference
+   CustomMatrix<Type,AF,PF,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the array of elements represented by the custom matrix.
+// Note that you can NOT assume that all matrix elements lie adjacent to each other! The rows
+// (or columns) of the custom matrix may be separated by the specified spacing.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline Type* CustomMatrix<Type,AF,PF,SO>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the array of elements represented by the custom matrix.
+// Note that you can NOT assume that all matrix elements lie adjacent to each other! The rows
+// (or columns) of the custom matrix may be separated by the specified spacing.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline const Type* CustomMatrix<Type,AF,PF,SO>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline Type* CustomMatrix<Type,AF,PF,SO>::data( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline const Type* CustomMatrix<Type,AF,PF,SO>::data( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::Iterator
+   CustomMatrix<Type,AF,PF,SO>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return Iterator( v_ + i*nn_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::ConstIterator
+   CustomMatrix<Type,AF,PF,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::ConstIterator
+   CustomMatrix<Type,AF,PF,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::Iterator
+   CustomMatrix<Type,AF,PF,SO>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return Iterator( v_ + i*nn_ + n_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::ConstIterator
+   CustomMatrix<Type,AF,PF,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ + n_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::ConstIterator
+   CustomMatrix<Type,AF,PF,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return ConstIterator( v_ + i*nn_ + n_, v_ + i*nn_ + n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid array size.
+//
+// This assignment operator offers the option to directly set all elements of the matrix:
+
+   \code
+   const real init[3][3] = { { 1, 2, 3 },
+                             { 4, 5 },
+                             { 7, 8, 9 } };
+   std::vector<real> memory( 9UL );
+   blaze::CustomMatrix<real,blaze::unaligned,blaze::unpadded> A( &memory[0], 3UL, 3UL );
+   A = init;
+   \endcode
+
+// The matrix is assigned the values from the given array. Missing values are initialized with
+// default values (as e.g. the value 6 in the example). Since the size of a custom matrix can not
+// be changed, a \a std::invalid_argument exception is thrown in case the size of the array does
+// not match the size of the custom matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool AF         // Alignment flag
+        , bool PF         // Padding flag
+        , bool SO >       // Storage order
+template< typename Other  // Data type of the initialization array
+        , size_t M        // Number of rows of the initialization array
+        , size_t N >      // Number of columns of the initialization array
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator=( const Other (&array)[M][N] )
+{
+   if( m_ != M || n_ != N )
+      throw std::invalid_argument( "Invalid array size" );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         v_[i*nn_+j] = array[i][j];
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator=( const Type& rhs )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[i*nn_+j] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CustomMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix, i.e. the values of the represented
+// array are overwritten. In case the current sizes of the two matrices don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator=( const CustomMatrix& rhs )
+{
+   if( rhs.rows() != m_ || rhs.columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( &rhs == this ) return *this;
+
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseMatrix<MT>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// Since the size of a custom matrix can not be changed, the right-hand side matrix must be a
+// square matrix with the same number of rows as the number of columns of the custom matrix.
+// Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const ResultType tmp( *this * (~rhs) );
+   smpAssign( *this, tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomMatrix<Type,AF,PF,SO> >::Type&
+   CustomMatrix<Type,AF,PF,SO>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomMatrix<Type,AF,PF,SO> >::Type&
+   CustomMatrix<Type,AF,PF,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns, i.e. the
+// total number of elements of a row/column. In case the storage order is set to \a rowMajor
+// the function returns the spacing between two rows, in case the storage flag is set to
+// \a columnMajor the function returns the spacing between two columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::spacing() const
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::capacity() const
+{
+   return m_ * nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::capacity( size_t i ) const
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         if( !isDefault( v_[i*nn_+j] ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline size_t CustomMatrix<Type,AF,PF,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t jend( i*nn_ + n_ );
+   size_t nonzeros( 0UL );
+
+   for( size_t j=i*nn_; j<jend; ++j )
+      if( !isDefault( v_[j] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::reset()
+{
+   using blaze::reset;
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         reset( v_[i*nn_+j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+//
+// This function resets the values in the specified row to their default value. Note that
+// the capacity of the row remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::reset( size_t i )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   for( size_t j=0UL; j<n_; ++j )
+      reset( v_[i*nn_+j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the matrix to its default state.
+//
+// \return void
+//
+// This function clears the custom matrix to its default state, i.e. after the clear() function
+// the custom matrix does not represent any array anymore and its size is \f$ 0 \times 0 \f$.
+// The values of the previously represented array are not affected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::clear()
+{
+   m_  = 0UL;
+   n_  = 0UL;
+   nn_ = 0UL;
+   v_  = NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CustomMatrix<Type,AF,PF,SO>& CustomMatrix<Type,AF,PF,SO>::scale( Other scalar )
+{
+   for( size_t i=0UL; i<m_; ++i )
+      for( size_t j=0UL; j<n_; ++j )
+         v_[i*nn_+j] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+//
+// This function swaps the represented arrays of the two custom matrices, the values of the
+// arrays are not affected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::swap( CustomMatrix& m ) /* throw() */
+{
+   std::swap( m_ , m.m_  );
+   std::swap( n_ , m.n_  );
+   std::swap( nn_, m.nn_ );
+   std::swap( v_ , m.v_  );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomMatrix<Type,AF,PF,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the conAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF           // Padding flag
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomMatrix<Type,AF,PF,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each row/column of the matrix are guaranteed to conform
+// to the alignment restrictions of the element type \a Type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline bool CustomMatrix<Type,AF,PF,SO>::isAligned() const
+{
+   return AF;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline bool CustomMatrix<Type,AF,PF,SO>::canSMPAssign() const
+{
+   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case the matrix is unaligned, the function performs
+// an unaligned load instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::IntrinsicType
+   CustomMatrix<Type,AF,PF,SO>::load( size_t i, size_t j ) const
+{
+   using blaze::load;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j % IT::size == 0UL, "Invalid column access index" );
+
+   if( AF && ( PF || j + IT::size <= n_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+      return load( v_+i*nn_+j );
+   }
+   else return loadu( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case of an unpadded matrix the final, incomplete
+// intrinsic element of each row/column is loaded element-wise and the remaining values are set
+// to zero. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline typename CustomMatrix<Type,AF,PF,SO>::IntrinsicType
+   CustomMatrix<Type,AF,PF,SO>::loadu( size_t i, size_t j ) const
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   if( PF || j + IT::size <= n_ ) {
+      BLAZE_INTERNAL_ASSERT( j + IT::size <= nn_, "Invalid column access index" );
+      return loadu( v_+i*nn_+j );
+   }
+   else {
+      Type array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( j+k < n_ )?( v_[i*nn_+j+k] ):( Type() );
+      return loadu( array );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case the matrix is unaligned, the function performs
+// an unaligned store instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::store( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::store;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j % IT::size == 0UL, "Invalid column access index" );
+
+   if( AF && ( PF || j + IT::size <= n_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+      store( v_+i*nn_+j, value );
+   }
+   else storeu( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case of an unpadded matrix the final, incomplete
+// intrinsic element of each row/column is stored element-wise. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   if( PF || j + IT::size <= n_ ) {
+      BLAZE_INTERNAL_ASSERT( j + IT::size <= nn_, "Invalid column access index" );
+      storeu( v_+i*nn_+j, value );
+   }
+   else {
+      Type array[IT::size];
+      storeu( array, value );
+      for( size_t k=0UL; k<n_-j; ++k )
+         v_[i*nn_+j+k] = array[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific intrinsic element of the
+// dense matrix. The row index must be smaller than the number of rows and the column index
+// must be smaller than the number of columns. Additionally, the column index (in case of a
+// row-major matrix) or the row index (in case of a column-major matrix) must be a multiple of
+// the number of values inside the intrinsic element. In case the matrix is unaligned, the
+// function performs an unaligned store instead. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::stream( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::stream;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j % IT::size == 0UL, "Invalid column access index" );
+
+   if( AF && ( PF || j + IT::size <= n_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i*nn_+j ), "Invalid alignment detected" );
+      stream( v_+i*nn_+j, value );
+   }
+   else storeu( i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jend( n_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         v_[i*nn_+j    ] = (~rhs)(i,j    );
+         v_[i*nn_+j+1UL] = (~rhs)(i,j+1UL);
+      }
+      if( jend < n_ ) {
+         v_[i*nn_+jend] = (~rhs)(i,jend);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   if( AF && useStreaming && m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; j+=IT::size )
+            stream( i, j, (~rhs).load(i,j) );
+   }
+   else
+   {
+      const size_t jend( n_ & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % (IT::size*4UL) ) ) == jend, "Invalid end calculation" );
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         typename MT::ConstIterator it( (~rhs).begin(i) );
+         for( size_t j=0UL; j<jend; j+=IT::size*4UL ) {
+            store( i, j             , it.load() ); it += IT::size;
+            store( i, j+IT::size    , it.load() ); it += IT::size;
+            store( i, j+IT::size*2UL, it.load() ); it += IT::size;
+            store( i, j+IT::size*3UL, it.load() ); it += IT::size;
+         }
+         for( size_t j=jend; j<n_; j+=IT::size, it+=IT::size ) {
+            store( i, j, it.load() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block ) {
+         const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               v_[i*nn_+j] = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jend( n_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         v_[i*nn_+j    ] += (~rhs)(i,j    );
+         v_[i*nn_+j+1UL] += (~rhs)(i,j+1UL);
+      }
+      if( jend < n_ ) {
+         v_[i*nn_+jend] += (~rhs)(i,jend);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::addAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t jend( n_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % (IT::size*4UL) ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      typename MT::ConstIterator it( (~rhs).begin(i) );
+      for( size_t j=0UL; j<jend; j+=IT::size*4UL ) {
+         store( i, j             , load(i,j             ) + it.load() ); it += IT::size;
+         store( i, j+IT::size    , load(i,j+IT::size    ) + it.load() ); it += IT::size;
+         store( i, j+IT::size*2UL, load(i,j+IT::size*2UL) + it.load() ); it += IT::size;
+         store( i, j+IT::size*3UL, load(i,j+IT::size*3UL) + it.load() ); it += IT::size;
+      }
+      for( size_t j=jend; j<n_; j+=IT::size, it+=IT::size ) {
+         store( i, j, load(i,j) + it.load() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block ) {
+         const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               v_[i*nn_+j] += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::addAssign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::addAssign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] += element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jend( n_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         v_[i*nn_+j    ] -= (~rhs)(i,j    );
+         v_[i*nn_+j+1UL] -= (~rhs)(i,j+1UL);
+      }
+      if( jend < n_ ) {
+         v_[i*nn_+jend] -= (~rhs)(i,jend);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,SO>::subAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t jend( n_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( n_ - ( n_ % (IT::size*4UL) ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      typename MT::ConstIterator it( (~rhs).begin(i) );
+      for( size_t j=0UL; j<jend; j+=IT::size*4UL ) {
+         store( i, j             , load(i,j             ) - it.load() ); it += IT::size;
+         store( i, j+IT::size    , load(i,j+IT::size    ) - it.load() ); it += IT::size;
+         store( i, j+IT::size*2UL, load(i,j+IT::size*2UL) - it.load() ); it += IT::size;
+         store( i, j+IT::size*3UL, load(i,j+IT::size*3UL) - it.load() ); it += IT::size;
+      }
+      for( size_t j=jend; j<n_; j+=IT::size, it+=IT::size ) {
+         store( i, j, load(i,j) - it.load() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t ii=0UL; ii<m_; ii+=block ) {
+      const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+      for( size_t jj=0UL; jj<n_; jj+=block ) {
+         const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               v_[i*nn_+j] -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::subAssign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i*nn_+element->index()] -= element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,SO>::subAssign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()*nn_+j] -= element->value();
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-MAJOR MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of CustomMatrix for column-major matrices.
+// \ingroup custom_matrix
+//
+// This specialization of CustomMatrix adapts the class template to the requirements of
+// column-major matrices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+class CustomMatrix<Type,AF,PF,true> : public DenseMatrix< CustomMatrix<Type,AF,PF,true>, true >
+{
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CustomMatrix<Type,AF,PF,true>      This;            //!< Type of this CustomMatrix instance.
+   typedef DynamicMatrix<Type,true>           ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,false>          OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,false>          TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                               ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type                  IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                        ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                        CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                              Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                        ConstReference;  //!< Reference to a constant matrix value.
+   typedef CustomIterator<Type,AF,PF>         Iterator;        //!< Iterator over non-constant elements.
+   typedef CustomIterator<const Type,AF,PF>   ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. In case the element type of the matrix is a vectorizable
+       data type, the \a vectorizable compilation flag is set to \a true, otherwise it is set to
+       \a false. Note that this is independent of the alignment and padding of the represented
+       array. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomMatrix();
+   explicit inline CustomMatrix( Type* ptr, size_t m, size_t n );
+   explicit inline CustomMatrix( Type* ptr, size_t m, size_t n, size_t nn );
+
+   inline CustomMatrix( const CustomMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Type*          data  ();
+   inline const Type*    data  () const;
+   inline Type*          data  ( size_t i );
+   inline const Type*    data  ( size_t i ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename Other, size_t M, size_t N >
+   inline CustomMatrix& operator=( const Other (&array)[M][N] );
+
+                                     inline CustomMatrix& operator= ( const Type& set );
+                                     inline CustomMatrix& operator= ( const CustomMatrix& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator= ( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CustomMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CustomMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        spacing() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t i ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+                              inline void          clear();
+   template< typename Other > inline CustomMatrix& scale( Other scalar );
+                              inline void          swap( CustomMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && MT::vectorizable &&
+                     IsSame<Type,typename MT::ElementType>::value &&
+                     IntrinsicTrait<Type>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load  ( size_t i, size_t j ) const;
+   inline IntrinsicType loadu ( size_t i, size_t j ) const;
+   inline void          store ( size_t i, size_t j, const IntrinsicType& value );
+   inline void          storeu( size_t i, size_t j, const IntrinsicType& value );
+   inline void          stream( size_t i, size_t j, const IntrinsicType& value );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAssign<MT> >::Type
+      assign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedAddAssign<MT> >::Type
+      addAssign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT > inline void addAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void addAssign( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT >
+   inline typename DisableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT >
+   inline typename EnableIf< VectorizedSubAssign<MT> >::Type
+      subAssign( const DenseMatrix<MT,true>& rhs );
+
+   template< typename MT > inline void subAssign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,true>&  rhs );
+   template< typename MT > inline void subAssign( const SparseMatrix<MT,false>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;   //!< The number of rows of the matrix.
+   size_t mm_;  //!< The number of elements between the beginning of two columns.
+   size_t n_;   //!< The number of columns of the matrix.
+   Type* v_;    //!< The custom array of elements.
+                /*!< Access to the matrix elements is gained via the function call
+                     operator. The memory layout of the elements is
+                     \f[\left(\begin{array}{*{5}{c}}
+                     0            & M             & 2 \cdot M     & \cdots & N \cdot M-M \\
+                     1            & M+1           & 2 \cdot M+1   & \cdots & N \cdot M-M+1 \\
+                     \vdots       & \vdots        & \vdots        & \ddots & \vdots      \\
+                     M-1          & 2 \cdot M-1   & 3 \cdot M-1   & \cdots & N \cdot M-1 \\
+                     \end{array}\right)\f],
+                     where \f$ M \f$ denotes the spacing between two columns. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for CustomMatrix.
+//
+// The default constructor creates an empty custom matrix that does not represent any array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>::CustomMatrix()
+   : m_ ( 0UL  )  // The number of rows of the matrix
+   , mm_( 0UL  )  // The number of elements between two columns
+   , n_ ( 0UL  )  // The number of columns of the matrix
+   , v_ ( NULL )  // The custom array of elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an unpadded custom matrix of size \f$ m \times n \f$.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \exception std::invalid_argument Invalid array of elements.
+// \exception std::invalid_argument Invalid alignment detected.
+//
+// This constructor creates an unpadded custom matrix of size \f$ m \times n \f$, whose columns
+// are stored contiguously in the given array. The construction fails if ...
+//
+//  - ... the passed pointer is NULL;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...) or the number of
+//    rows is not a multiple of the number of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown. Note that this constructor
+// is only available for unpadded custom matrices, i.e. its use results in a compilation error in
+// case the padding flag \a PF is set to \a padded.
+//
+// \b Note: The custom matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t n )
+   : m_ ( m   )  // The number of rows of the matrix
+   , mm_( m   )  // The number of elements between two columns
+   , n_ ( n   )  // The number of columns of the matrix
+   , v_ ( ptr )  // The custom array of elements
+{
+   BLAZE_STATIC_ASSERT( !PF );
+
+   if( ptr == NULL )
+      throw std::invalid_argument( "Invalid array of elements" );
+
+   if( AF && ( !checkAlignment( ptr ) || mm_ % IT::size != 0UL ) )
+      throw std::invalid_argument( "Invalid alignment detected" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a custom matrix of size \f$ m \times n \f$ with a given spacing.
+//
+// \param ptr The array of elements to be used by the matrix.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param nn The total number of elements between two columns.
+// \exception std::invalid_argument Invalid array of elements.
+// \exception std::invalid_argument Invalid spacing specified.
+// \exception std::invalid_argument Invalid alignment detected.
+// \exception std::invalid_argument Insufficient capacity for padded matrix.
+//
+// This constructor creates a custom matrix of size \f$ m \times n \f$, whose columns are
+// separated by \a nn elements in the given array. The construction fails if ...
+//
+//  - ... the passed pointer is NULL;
+//  - ... the spacing \a nn is smaller than the number of rows;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer is not properly
+//    aligned according to the available instruction set (SSE, AVX, ...) or the spacing is not
+//    a multiple of the number of values per intrinsic element;
+//  - ... the padding flag \a PF is set to \a padded, but the spacing is not a multiple of the
+//    number of values per intrinsic element.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown. In case of a padded
+// custom matrix the padding elements at the end of each column have to be zero.
+//
+// \b Note: The custom matrix does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t n, size_t nn )
+   : m_ ( m   )  // The number of rows of the matrix
+   , mm_( nn  )  // The number of elements between two columns
+   , n_ ( n   )  // The number of columns of the matrix
+   , v_ ( ptr )  // The custom array of elements
+{
+   if( ptr == NULL )
+      throw std::invalid_argument( "Invalid array of elements" );
+
+   if( mm_ < m_ )
+      throw std::invalid_argument( "Invalid spacing specified" );
+
+   if( AF && ( !checkAlignment( ptr ) || mm_ % IT::size != 0UL ) )
+      throw std::invalid_argument( "Invalid alignment detected" );
+
+   if( PF && mm_ % IT::size != 0UL )
+      throw std::invalid_argument( "Insufficient capacity for padded matrix" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for CustomMatrix.
+//
+// \param m Matrix to be copied.
+//
+// The copy constructor initializes the custom matrix as an exact copy of the given custom
+// matrix, i.e. the new custom matrix represents the same array of elements as \a m.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( const CustomMatrix& m )
+   : m_ ( m.m_  )  // The number of rows of the matrix
+   , mm_( m.mm_ )  // The number of elements between two columns
+   , n_ ( m.n_  )  // The number of columns of the matrix
+   , v_ ( m.v_  )  // The custom array of elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::Reference
+   CustomMatrix<Type,AF,PF,true>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i+j*mm_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::ConstReference
+   CustomMatrix<Type,AF,PF,true>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i+j*mm_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the array of elements represented by the custom matrix.
+// Note that you can NOT assume that all matrix elements lie adjacent to each other! The rows
+// (or columns) of the custom matrix may be separated by the specified spacing.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline Type* CustomMatrix<Type,AF,PF,true>::data()
+{
+   return v_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the array of elements represented by the custom matrix.
+// Note that you can NOT assume that all matrix elements lie adjacent to each other! The rows
+// (or columns) of the custom matrix may be separated by the specified spacing.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const Type* CustomMatrix<Type,AF,PF,true>::data() const
+{
+   return v_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline Type* CustomMatrix<Type,AF,PF,true>::data( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return v_ + i*mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage for the elements in row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline const Type* CustomMatrix<Type,AF,PF,true>::data( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return v_ + i*mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::Iterator
+   CustomMatrix<Type,AF,PF,true>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return Iterator( v_ + i*mm_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::ConstIterator
+   CustomMatrix<Type,AF,PF,true>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + i*mm_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::ConstIterator
+   CustomMatrix<Type,AF,PF,true>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + i*mm_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::Iterator
+   CustomMatrix<Type,AF,PF,true>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return Iterator( v_ + i*mm_ + m_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::ConstIterator
+   CustomMatrix<Type,AF,PF,true>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + i*mm_ + m_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::ConstIterator
+   CustomMatrix<Type,AF,PF,true>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix column access index" );
+   return ConstIterator( v_ + i*mm_ + m_, v_ + i*mm_ + m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array assignment to all matrix elements.
+//
+// \param array \f$ M \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid array size.
+//
+// This assignment operator offers the option to directly set all elements of the matrix:
+
+   \code
+   const real init[3][3] = { { 1, 2, 3 },
+                             { 4, 5 },
+                             { 7, 8, 9 } };
+   std::vector<real> memory( 9UL );
+   blaze::CustomMatrix<real,blaze::unaligned,blaze::unpadded> A( &memory[0], 3UL, 3UL );
+   A = init;
+   \endcode
+
+// The matrix is assigned the values from the given array. Missing values are initialized with
+// default values (as e.g. the value 6 in the example). Since the size of a custom matrix can not
+// be changed, a \a std::invalid_argument exception is thrown in case the size of the array does
+// not match the size of the custom matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool AF         // Alignment flag
+        , bool PF >       // Padding flag
+template< typename Other  // Data type of the initialization array
+        , size_t M        // Number of rows of the initialization array
+        , size_t N >      // Number of columns of the initialization array
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator=( const Other (&array)[M][N] )
+{
+   if( m_ != M || n_ != N )
+      throw std::invalid_argument( "Invalid array size" );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         v_[i+j*mm_] = array[i][j];
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param rhs Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator=( const Type& rhs )
+{
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         v_[i+j*mm_] = rhs;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for CustomMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix, i.e. the values of the represented
+// array are overwritten. In case the current sizes of the two matrices don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator=( const CustomMatrix& rhs )
+{
+   if( rhs.rows() != m_ || rhs.columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( &rhs == this ) return *this;
+
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The matrix is initialized as a copy of the given matrix. In case the current sizes of the two
+// matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseMatrix<MT>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( this ) ) {
+      const typename MT::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// Since the size of a custom matrix can not be changed, the right-hand side matrix must be a
+// square matrix with the same number of rows as the number of columns of the custom matrix.
+// Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const ResultType tmp( *this * (~rhs) );
+   smpAssign( *this, tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomMatrix<Type,AF,PF,true> >::Type&
+   CustomMatrix<Type,AF,PF,true>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CustomMatrix<Type,AF,PF,true> >::Type&
+   CustomMatrix<Type,AF,PF,true>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::rows() const
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::columns() const
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns, i.e. the
+// total number of elements of a row/column. In case the storage order is set to \a rowMajor
+// the function returns the spacing between two rows, in case the storage flag is set to
+// \a columnMajor the function returns the spacing between two columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::spacing() const
+{
+   return mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::capacity() const
+{
+   return n_ * mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::capacity( size_t i ) const
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < columns(), "Invalid column access index" );
+   return mm_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         if( !isDefault( v_[i+j*mm_] ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomMatrix<Type,AF,PF,true>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t iend( j*mm_ + m_ );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=j*mm_; i<iend; ++i )
+      if( !isDefault( v_[i] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::reset()
+{
+   using blaze::reset;
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         reset( v_[i+j*mm_] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified column to the default initial values.
+//
+// \param j The index of the column.
+// \return void
+//
+// This function resets the values in the specified column to their default value. Note that
+// the capacity of the column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::reset( size_t j )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   for( size_t i=0UL; i<m_; ++i )
+      reset( v_[i+j*mm_] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the matrix to its default state.
+//
+// \return void
+//
+// This function clears the custom matrix to its default state, i.e. after the clear() function
+// the custom matrix does not represent any array anymore and its size is \f$ 0 \times 0 \f$.
+// The values of the previously represented array are not affected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::clear()
+{
+   m_  = 0UL;
+   mm_ = 0UL;
+   n_  = 0UL;
+   v_  = NULL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the scalar value
+inline CustomMatrix<Type,AF,PF,true>& CustomMatrix<Type,AF,PF,true>::scale( Other scalar )
+{
+   for( size_t j=0UL; j<n_; ++j )
+      for( size_t i=0UL; i<m_; ++i )
+         v_[i+j*mm_] *= scalar;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+//
+// This function swaps the represented arrays of the two custom matrices, the values of the
+// arrays are not affected.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::swap( CustomMatrix& m ) /* throw() */
+{
+   std::swap( m_ , m.m_  );
+   std::swap( mm_, m.mm_ );
+   std::swap( n_ , m.n_  );
+   std::swap( v_ , m.v_  );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomMatrix<Type,AF,PF,true>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the conAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomMatrix<Type,AF,PF,true>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each row/column of the matrix are guaranteed to conform
+// to the alignment restrictions of the element type \a Type.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline bool CustomMatrix<Type,AF,PF,true>::isAligned() const
+{
+   return AF;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline bool CustomMatrix<Type,AF,PF,true>::canSMPAssign() const
+{
+   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case the matrix is unaligned, the function performs
+// an unaligned load instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::IntrinsicType
+   CustomMatrix<Type,AF,PF,true>::load( size_t i, size_t j ) const
+{
+   using blaze::load;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( i % IT::size == 0UL, "Invalid row access index"    );
+
+   if( AF && ( PF || i + IT::size <= m_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+      return load( v_+i+j*mm_ );
+   }
+   else return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case of an unpadded matrix the final, incomplete
+// intrinsic element of each row/column is loaded element-wise and the remaining values are set
+// to zero. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomMatrix<Type,AF,PF,true>::IntrinsicType
+   CustomMatrix<Type,AF,PF,true>::loadu( size_t i, size_t j ) const
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   if( PF || i + IT::size <= m_ ) {
+      BLAZE_INTERNAL_ASSERT( i + IT::size <= mm_, "Invalid row access index" );
+      return loadu( v_+i+j*mm_ );
+   }
+   else {
+      Type array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( i+k < m_ )?( v_[i+k+j*mm_] ):( Type() );
+      return loadu( array );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case the matrix is unaligned, the function performs
+// an unaligned store instead. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::store( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::store;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( i % IT::size == 0UL, "Invalid row access index"    );
+
+   if( AF && ( PF || i + IT::size <= m_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+      store( v_+i+j*mm_, value );
+   }
+   else storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. In case of an unpadded matrix the final, incomplete
+// intrinsic element of each row/column is stored element-wise. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::storeu( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::storeu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+
+   if( PF || i + IT::size <= m_ ) {
+      BLAZE_INTERNAL_ASSERT( i + IT::size <= mm_, "Invalid row access index" );
+      storeu( v_+i+j*mm_, value );
+   }
+   else {
+      Type array[IT::size];
+      storeu( array, value );
+      for( size_t k=0UL; k<m_-i; ++k )
+         v_[i+k+j*mm_] = array[k];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific intrinsic element of the
+// dense matrix. The row index must be smaller than the number of rows and the column index
+// must be smaller than the number of columns. Additionally, the column index (in case of a
+// row-major matrix) or the row index (in case of a column-major matrix) must be a multiple of
+// the number of values inside the intrinsic element. In case the matrix is unaligned, the
+// function performs an unaligned store instead. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::stream( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::stream;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( i < m_            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < n_            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( i % IT::size == 0UL, "Invalid row access index"    );
+
+   if( AF && ( PF || i + IT::size <= m_ ) ) {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( v_+i+j*mm_ ), "Invalid alignment detected" );
+      stream( v_+i+j*mm_, value );
+   }
+   else storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::assign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t iend( m_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         v_[i    +j*mm_] = (~rhs)(i    ,j);
+         v_[i+1UL+j*mm_] = (~rhs)(i+1UL,j);
+      }
+      if( iend < m_ ) {
+         v_[iend+j*mm_] = (~rhs)(iend,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::assign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   if( AF && useStreaming && m_*n_ > ( cacheSize / ( sizeof(Type) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   {
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; i+=IT::size )
+            stream( i, j, (~rhs).load(i,j) );
+   }
+   else
+   {
+      const size_t iend( m_ & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         typename MT::ConstIterator it( (~rhs).begin(j) );
+         for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+            store( i             , j, it.load() ); it += IT::size;
+            store( i+IT::size    , j, it.load() ); it += IT::size;
+            store( i+IT::size*2UL, j, it.load() ); it += IT::size;
+            store( i+IT::size*3UL, j, it.load() ); it += IT::size;
+         }
+         for( size_t i=iend; i<m_; i+=IT::size, it+=IT::size ) {
+            store( i, j, it.load() );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,true>::assign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block ) {
+         const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               v_[i+j*mm_] = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::assign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::assign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t iend( m_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         v_[i    +j*mm_] += (~rhs)(i    ,j);
+         v_[i+1UL+j*mm_] += (~rhs)(i+1UL,j);
+      }
+      if( iend < m_ ) {
+         v_[iend+j*mm_] += (~rhs)(iend,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedAddAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::addAssign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t iend( m_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      typename MT::ConstIterator it( (~rhs).begin(j) );
+      for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+         store( i             , j, load(i             ,j) + it.load() ); it += IT::size;
+         store( i+IT::size    , j, load(i+IT::size    ,j) + it.load() ); it += IT::size;
+         store( i+IT::size*2UL, j, load(i+IT::size*2UL,j) + it.load() ); it += IT::size;
+         store( i+IT::size*3UL, j, load(i+IT::size*3UL,j) + it.load() ); it += IT::size;
+      }
+      for( size_t i=iend; i<m_; i+=IT::size, it+=IT::size ) {
+         store( i, j, load(i,j) + it.load() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,true>::addAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block ) {
+         const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               v_[i+j*mm_] += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::addAssign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::addAssign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t iend( m_ & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         v_[i    +j*mm_] -= (~rhs)(i    ,j);
+         v_[i+1UL+j*mm_] -= (~rhs)(i+1UL,j);
+      }
+      if( iend < m_ ) {
+         v_[iend+j*mm_] -= (~rhs)(iend,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename CustomMatrix<Type,AF,PF,true>::BLAZE_TEMPLATE VectorizedSubAssign<MT> >::Type
+   CustomMatrix<Type,AF,PF,true>::subAssign( const DenseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   const size_t iend( m_ & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( m_ - ( m_ % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      typename MT::ConstIterator it( (~rhs).begin(j) );
+      for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+         store( i             , j, load(i             ,j) - it.load() ); it += IT::size;
+         store( i+IT::size    , j, load(i+IT::size    ,j) - it.load() ); it += IT::size;
+         store( i+IT::size*2UL, j, load(i+IT::size*2UL,j) - it.load() ); it += IT::size;
+         store( i+IT::size*3UL, j, load(i+IT::size*3UL,j) - it.load() ); it += IT::size;
+      }
+      for( size_t i=iend; i<m_; i+=IT::size, it+=IT::size ) {
+         store( i, j, load(i,j) - it.load() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side dense matrix
+inline void CustomMatrix<Type,AF,PF,true>::subAssign( const DenseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n_; jj+=block ) {
+      const size_t jend( ( n_<(jj+block) )?( n_ ):( jj+block ) );
+      for( size_t ii=0UL; ii<m_; ii+=block ) {
+         const size_t iend( ( m_<(ii+block) )?( m_ ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               v_[i+j*mm_] -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::subAssign( const SparseMatrix<MT,true>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      for( typename MT::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         v_[element->index()+j*mm_] -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CustomMatrix<Type,AF,PF,true>::subAssign( const SparseMatrix<MT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<m_; ++i )
+      for( typename MT::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         v_[i+element->index()*mm_] -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomMatrix operators */
+//@{
+template< typename Type, bool AF, bool PF, bool SO >
+inline void reset( CustomMatrix<Type,AF,PF,SO>& m );
+
+template< typename Type, bool AF, bool PF, bool SO >
+inline void clear( CustomMatrix<Type,AF,PF,SO>& m );
+
+template< typename Type, bool AF, bool PF, bool SO >
+inline bool isDefault( const CustomMatrix<Type,AF,PF,SO>& m );
+
+template< typename Type, bool AF, bool PF, bool SO >
+inline void swap( CustomMatrix<Type,AF,PF,SO>& a, CustomMatrix<Type,AF,PF,SO>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given custom matrix.
+// \ingroup custom_matrix
+//
+// \param m The custom matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void reset( CustomMatrix<Type,AF,PF,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given custom matrix.
+// \ingroup custom_matrix
+//
+// \param m The custom matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void clear( CustomMatrix<Type,AF,PF,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given custom matrix is in default state.
+// \ingroup custom_matrix
+//
+// \param m The custom matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+//
+// This function checks whether the matrix is in default state. For instance, in case the
+// matrix is instantiated for a built-in integral or floating point data type, the function
+// returns \a true in case all matrix elements are 0 and \a false in case any matrix element
+// is not 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline bool isDefault( const CustomMatrix<Type,AF,PF,SO>& m )
+{
+   if( SO == rowMajor ) {
+      for( size_t i=0UL; i<m.rows(); ++i )
+         for( size_t j=0UL; j<m.columns(); ++j )
+            if( !isDefault( m(i,j) ) ) return false;
+   }
+   else {
+      for( size_t j=0UL; j<m.columns(); ++j )
+         for( size_t i=0UL; i<m.rows(); ++i )
+            if( !isDefault( m(i,j) ) ) return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom matrices.
+// \ingroup custom_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void swap( CustomMatrix<Type,AF,PF,SO>& a, CustomMatrix<Type,AF,PF,SO>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool AF, bool PF, bool SO >
+struct SubmatrixTrait< CustomMatrix<T1,AF,PF,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool AF, bool PF, bool SO >
+struct RowTrait< CustomMatrix<T1,AF,PF,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool AF, bool PF, bool SO >
+struct ColumnTrait< CustomMatrix<T1,AF,PF,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
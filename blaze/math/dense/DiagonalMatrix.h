@@ -0,0 +1,244 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DiagonalMatrix.h
+//  \brief Header file for the implementation of a diagonal dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DIAGONALMATRIX_H_
+#define _BLAZE_MATH_DENSE_DIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/dense/BandedMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup diagonal_matrix DiagonalMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Diagonal dense matrix.
+// \ingroup diagonal_matrix
+//
+// The DiagonalMatrix class template represents a diagonal \f$ N \times N \f$ dense matrix of
+// arbitrary element type, i.e. a matrix with \f$ a_{ij} = 0 \f$ for all \f$ i \neq j \f$. It
+// is a banded matrix without subdiagonals and superdiagonals (see BandedMatrix) and therefore
+// only stores the \a N elements of its diagonal in a single contiguous array. In addition to
+// the functionality of a banded matrix, a diagonal matrix can be directly created from the
+// dense vector of its diagonal elements:
+
+   \code
+   using blaze::DiagonalMatrix;
+   using blaze::DynamicVector;
+
+   DynamicVector<double> d( 1000UL, 2.0 ), r( 1000UL, 1.0 ), z;
+
+   DiagonalMatrix<double> D( d );  // Diagonal matrix with the diagonal elements d
+   D(2,1);                         // Read access to an off-diagonal element, which returns 0
+
+   DynamicVector<double> y( D * r );  // Element-wise scaling of r by d
+   solve( z, D, r );                  // Element-wise division of r by d (Jacobi preconditioning)
+   \endcode
+
+// All operations of a banded matrix are available, i.e. the multiplication with dense vectors
+// and matrices, the scaling by a scalar value and the solution of diagonal systems via solve()
+// use the dedicated banded kernels, whose cost is proportional to \a N.
+*/
+template< typename Type >  // Data type of the matrix
+class DiagonalMatrix : public BandedMatrix<Type,0UL,0UL>
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef BandedMatrix<Type,0UL,0UL>  BaseType;  //!< Base type of this DiagonalMatrix instance.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DiagonalMatrix<Type>  This;  //!< Type of this DiagonalMatrix instance.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DiagonalMatrix();
+   explicit inline DiagonalMatrix( size_t n );
+   explicit inline DiagonalMatrix( size_t n, const Type& init );
+
+   template< typename VT >
+   explicit inline DiagonalMatrix( const DenseVector<VT,columnVector>& dv );
+
+   template< typename MT, bool SO >
+   explicit inline DiagonalMatrix( const DenseMatrix<MT,SO>& dm );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO >
+   inline DiagonalMatrix& operator=( const DenseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DiagonalMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline DiagonalMatrix<Type>::DiagonalMatrix()
+   : BaseType()  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All diagonal elements are initialized to the default value of the element type.
+*/
+template< typename Type >  // Data type of the matrix
+inline DiagonalMatrix<Type>::DiagonalMatrix( size_t n )
+   : BaseType( n )  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all diagonal elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the diagonal elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline DiagonalMatrix<Type>::DiagonalMatrix( size_t n, const Type& init )
+   : BaseType( n, init )  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from the dense vector of diagonal elements.
+//
+// \param dv The dense vector of diagonal elements.
+//
+// This constructor creates a \f$ N \times N \f$ diagonal matrix, where \a N is the size of the
+// given vector, and initializes the diagonal with the elements of the vector.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename VT >    // Type of the dense vector
+inline DiagonalMatrix<Type>::DiagonalMatrix( const DenseVector<VT,columnVector>& dv )
+   : BaseType( (~dv).size() )  // Initialization of the base class
+{
+   Type* diag( this->data() );
+
+   for( size_t i=0UL; i<(~dv).size(); ++i )
+      diag[i] = (~dv)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense matrix.
+//
+// \param dm Diagonal dense matrix to be copied.
+// \exception std::invalid_argument Invalid setup of banded matrix.
+//
+// This constructor copies the diagonal of the given dense matrix. In case the given matrix is
+// not square or has non-default off-diagonal elements, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline DiagonalMatrix<Type>::DiagonalMatrix( const DenseMatrix<MT,SO>& dm )
+   : BaseType( dm )  // Initialization of the base class
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Diagonal dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to banded matrix.
+//
+// In case the given matrix is not square or has non-default off-diagonal elements, a
+// \a std::invalid_argument exception is thrown and the diagonal matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline DiagonalMatrix<Type>& DiagonalMatrix<Type>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   BaseType::operator=( ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,11 +44,20 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t, size_t > class BandedMatrix;
+template< typename, bool, bool, bool > class CustomMatrix;
+template< typename, bool, bool, bool > class CustomVector;
+template< typename > class DiagonalMatrix;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename > class LowerMatrix;
+template< typename, bool > class MappedDenseMatrix;
+class QuantizedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
+template< typename > class SymmetricMatrix;
+template< typename > class UpperMatrix;
 
 } // namespace blaze
 
@@ -0,0 +1,712 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedDenseMatrix.h
+//  \brief Header file for the implementation of a memory-mapped dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDDENSEMATRIX_H_
+#define _BLAZE_MATH_DENSE_MAPPEDDENSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/MappedSerializer.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/views/AlignmentFlag.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_dense_matrix MappedDenseMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Read-only dense matrix mapped from a file.
+// \ingroup mapped_dense_matrix
+//
+// The MappedDenseMatrix class template represents a dense matrix that has been written by the
+// serializeMapped() function. Instead of reading and converting the elements of the matrix,
+// the complete file is mapped into the address space of the process and the elements are used
+// directly from the mapped memory. Therefore the construction of a MappedDenseMatrix does not
+// copy any element and its cost is independent of the size of the matrix. The pages of the file
+// are loaded on demand by the operating system when the elements are accessed for the first time.
+// The type of the elements and the storage order of the matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedDenseMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedDenseMatrix can be used with any
+//          numeric element type. The element type has to match the element type of the file.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The storage order has to match the storage order of the file. The default value
+//          is blaze::rowMajor.
+//
+// Since every row (row-major) or column (column-major) of the file starts at a 64-byte boundary
+// and is padded with zeros, the elements are accessed via an aligned and padded CustomMatrix and
+// a MappedDenseMatrix can be used with all vectorized kernels:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::serializeMapped( "A.blazemap", A );
+
+   blaze::MappedDenseMatrix<double,blaze::rowMajor> B( "A.blazemap" );
+   blaze::DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = B * x;
+   \endcode
+
+// A MappedDenseMatrix is a read-only matrix, i.e. its elements cannot be modified. In case the
+// file cannot be mapped or doesn't contain a matrix of the expected type and storage order, a
+// \a std::runtime_error exception is thrown. Note that the file must not be truncated or modified
+// by another process while it is mapped.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class MappedDenseMatrix : private MemoryMap
+                        , public DenseMatrix< MappedDenseMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef CustomMatrix<Type,aligned,padded,SO>  MT;  //!< Type of the matrix representing the mapped elements.
+   typedef IntrinsicTrait<Type>                  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedDenseMatrix<Type,SO>   This;            //!< Type of this MappedDenseMatrix instance.
+   typedef DynamicMatrix<Type,SO>       ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>      OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,!SO>      TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                         ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type            IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                  ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                  CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                  Reference;       //!< Reference to a matrix value.
+   typedef const Type&                  ConstReference;  //!< Reference to a constant matrix value.
+   typedef typename MT::ConstIterator   Iterator;        //!< Iterator over non-constant elements.
+   typedef typename MT::ConstIterator   ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. In case the element type of the matrix is a vectorizable
+       data type, the \a vectorizable compilation flag is set to \a true, otherwise it is set to
+       \a false. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedDenseMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline const Type*    data  () const;
+   inline const Type*    data  ( size_t i ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t spacing() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t i ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+
+   using MemoryMap::filename;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load ( size_t i, size_t j ) const;
+   inline IntrinsicType loadu( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT matrix_;  //!< The custom matrix representing the mapped elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a MappedDenseMatrix.
+//
+// \param filename The name of the matrix file.
+// \exception std::runtime_error Unable to map file.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This constructor maps the given file into memory and validates its header. In case the file
+// cannot be mapped or in case it doesn't contain a dense matrix with element type \a Type and
+// storage order \a SO, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedDenseMatrix<Type,SO>::MappedDenseMatrix( const std::string& filename )
+   : MemoryMap( filename )  // The mapped matrix file
+   , matrix_  ()            // The custom matrix representing the mapped elements
+{
+   const MappedHeader& header( MappedSerializer::header<Type,true,SO>( *this ) );
+
+   MT tmp( reinterpret_cast<Type*>( MemoryMap::data() + header.dataOffset ),
+           header.rows, header.columns, header.number );
+   matrix_.swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::ConstReference
+   MappedDenseMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   return matrix_( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the mapped element storage of the matrix. Note that you
+// can NOT assume that all matrix elements lie adjacent to each other! The rows (row-major) or
+// columns (column-major) of the matrix are padded with zeros to a multiple of 64 bytes.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const Type* MappedDenseMatrix<Type,SO>::data() const
+{
+   return matrix_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const Type* MappedDenseMatrix<Type,SO>::data( size_t i ) const
+{
+   return matrix_.data( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::ConstIterator
+   MappedDenseMatrix<Type,SO>::begin( size_t i ) const
+{
+   return matrix_.cbegin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// This function returns a row/column iterator to the first element of row/column \a i. In case
+// the storage order is set to \a rowMajor the function returns an iterator to the first element
+// of row \a i, in case the storage flag is set to \a columnMajor the function returns an iterator
+// to the first element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::ConstIterator
+   MappedDenseMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   return matrix_.cbegin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::ConstIterator
+   MappedDenseMatrix<Type,SO>::end( size_t i ) const
+{
+   return matrix_.cend( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator just past
+// the last element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator just past the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::ConstIterator
+   MappedDenseMatrix<Type,SO>::cend( size_t i ) const
+{
+   return matrix_.cend( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::rows() const
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::columns() const
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+//
+// This function returns the spacing between the beginning of two rows/columns, i.e. the
+// total number of elements of a row/column including the zero padding elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::spacing() const
+{
+   return matrix_.spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::capacity() const
+{
+   return matrix_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::capacity( size_t i ) const
+{
+   return matrix_.capacity( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the dense matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::nonZeros() const
+{
+   return matrix_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedDenseMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   return matrix_.nonZeros( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedDenseMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the conAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedDenseMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a true in case the matrix is aligned, \a false if not.
+//
+// This function returns whether the matrix is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each row/column of the matrix are guaranteed to conform
+// to the alignment restrictions of the element type \a Type. Since every row/column of a mapped
+// matrix file starts at a 64-byte boundary, this function always returns \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool MappedDenseMatrix<Type,SO>::isAligned() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool MappedDenseMatrix<Type,SO>::canSMPAssign() const
+{
+   return matrix_.canSMPAssign();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::IntrinsicType
+   MappedDenseMatrix<Type,SO>::load( size_t i, size_t j ) const
+{
+   return matrix_.load( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of an intrinsic element of the matrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of a specific intrinsic element of the dense matrix.
+// The row index must be smaller than the number of rows and the column index must be smaller
+// than the number of columns. Additionally, the column index (in case of a row-major matrix)
+// or the row index (in case of a column-major matrix) must be a multiple of the number of
+// values inside the intrinsic element. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedDenseMatrix<Type,SO>::IntrinsicType
+   MappedDenseMatrix<Type,SO>::loadu( size_t i, size_t j ) const
+{
+   return matrix_.loadu( i, j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< MappedDenseMatrix<T1,SO> >
+{
+   typedef DynamicMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< MappedDenseMatrix<T1,SO> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< MappedDenseMatrix<T1,SO> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,394 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedKernels.h
+//  \brief Header file for the computational kernels of packed dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+#define _BLAZE_MATH_DENSE_PACKEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized packed kernels.
+// \ingroup dense_matrix
+//
+// The packed kernels operate on the contiguous rows of packed triangular and symmetric matrices
+// and on the contiguous diagonals of banded matrices. Since these rows and diagonals start at
+// arbitrary addresses, the vectorized kernels exclusively use unaligned loads and stores. They
+// are selected in case the element type provides both a vectorized addition and multiplication.
+*/
+template< typename T >  // Type of the elements
+struct PackedVectorized
+{
+   enum { value = IsVectorizable<T>::value &&
+                  IntrinsicTrait<T>::addition && IntrinsicTrait<T>::multiplication };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of two arrays (\f$ \sum_j a_j x_j \f$).
+// \ingroup dense_matrix
+//
+// \param a The first array.
+// \param x The second array.
+// \param n The number of elements.
+// \return The dot product of the two arrays.
+*/
+template< typename T >  // Type of the elements
+inline typename DisableIf< PackedVectorized<T>, T >::Type
+   packedDot( const T* a, const T* x, size_t n )
+{
+   T res = T();
+   for( size_t j=0UL; j<n; ++j )
+      res += a[j] * x[j];
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of two arrays (\f$ \sum_j a_j x_j \f$).
+// \ingroup dense_matrix
+//
+// \param a The first array.
+// \param x The second array.
+// \param n The number of elements.
+// \return The dot product of the two arrays.
+*/
+template< typename T >  // Type of the elements
+inline typename EnableIf< PackedVectorized<T>, T >::Type
+   packedDot( const T* a, const T* x, size_t n )
+{
+   typedef IntrinsicTrait<T>  IT;
+
+   typename IT::Type xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+IT::size*2UL) <= n; j+=IT::size*2UL ) {
+      xmm1 = xmm1 + loadu( a+j          ) * loadu( x+j          );
+      xmm2 = xmm2 + loadu( a+j+IT::size ) * loadu( x+j+IT::size );
+   }
+   if( (j+IT::size) <= n ) {
+      xmm1 = xmm1 + loadu( a+j ) * loadu( x+j );
+      j += IT::size;
+   }
+
+   T res = sum( xmm1 + xmm2 );
+   for( ; j<n; ++j )
+      res += a[j] * x[j];
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaled addition of an array (\f$ y_j += s \cdot a_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array.
+// \param a The array to be scaled and added.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline typename DisableIf< PackedVectorized<T> >::Type
+   packedAxpy( T* y, const T* a, const T& s, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j )
+      y[j] += s * a[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaled addition of an array (\f$ y_j += s \cdot a_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array.
+// \param a The array to be scaled and added.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline typename EnableIf< PackedVectorized<T> >::Type
+   packedAxpy( T* y, const T* a, const T& s, size_t n )
+{
+   typedef IntrinsicTrait<T>  IT;
+
+   const typename IT::Type factor( set( s ) );
+   size_t j( 0UL );
+
+   for( ; (j+IT::size*2UL) <= n; j+=IT::size*2UL ) {
+      storeu( y+j         , loadu( y+j          ) + factor * loadu( a+j          ) );
+      storeu( y+j+IT::size, loadu( y+j+IT::size ) + factor * loadu( a+j+IT::size ) );
+   }
+   if( (j+IT::size) <= n ) {
+      storeu( y+j, loadu( y+j ) + factor * loadu( a+j ) );
+      j += IT::size;
+   }
+   for( ; j<n; ++j )
+      y[j] += s * a[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused dot product and scaled addition (\f$ y_j += s \cdot a_j \f$ and
+//        \f$ \sum_j a_j x_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array of the scaled addition.
+// \param a The shared array.
+// \param x The second array of the dot product.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return The dot product of \a a and \a x.
+//
+// This kernel traverses the shared array \a a only once and is the building block of the
+// symmetric matrix/vector multiplication, which uses each stored element twice.
+*/
+template< typename T >  // Type of the elements
+inline typename DisableIf< PackedVectorized<T>, T >::Type
+   packedDotAxpy( T* y, const T* a, const T* x, const T& s, size_t n )
+{
+   T res = T();
+   for( size_t j=0UL; j<n; ++j ) {
+      res  += a[j] * x[j];
+      y[j] += s * a[j];
+   }
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused dot product and scaled addition (\f$ y_j += s \cdot a_j \f$ and
+//        \f$ \sum_j a_j x_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array of the scaled addition.
+// \param a The shared array.
+// \param x The second array of the dot product.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return The dot product of \a a and \a x.
+//
+// This kernel traverses the shared array \a a only once and is the building block of the
+// symmetric matrix/vector multiplication, which uses each stored element twice.
+*/
+template< typename T >  // Type of the elements
+inline typename EnableIf< PackedVectorized<T>, T >::Type
+   packedDotAxpy( T* y, const T* a, const T* x, const T& s, size_t n )
+{
+   typedef IntrinsicTrait<T>  IT;
+
+   const typename IT::Type factor( set( s ) );
+   typename IT::Type xmm1;
+   size_t j( 0UL );
+
+   for( ; (j+IT::size) <= n; j+=IT::size ) {
+      const typename IT::Type a1( loadu( a+j ) );
+      xmm1 = xmm1 + a1 * loadu( x+j );
+      storeu( y+j, loadu( y+j ) + factor * a1 );
+   }
+
+   T res = sum( xmm1 );
+   for( ; j<n; ++j ) {
+      res  += a[j] * x[j];
+      y[j] += s * a[j];
+   }
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default element-wise multiplication and addition of two arrays
+//        (\f$ y_j += a_j \cdot x_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array.
+// \param a The first array of the element-wise product.
+// \param x The second array of the element-wise product.
+// \param n The number of elements.
+// \return void
+//
+// This kernel is the building block of the banded matrix/vector multiplication, which processes
+// the matrix diagonal by diagonal.
+*/
+template< typename T >  // Type of the elements
+inline typename DisableIf< PackedVectorized<T> >::Type
+   packedMultAdd( T* y, const T* a, const T* x, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j )
+      y[j] += a[j] * x[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized element-wise multiplication and addition of two arrays
+//        (\f$ y_j += a_j \cdot x_j \f$).
+// \ingroup dense_matrix
+//
+// \param y The target array.
+// \param a The first array of the element-wise product.
+// \param x The second array of the element-wise product.
+// \param n The number of elements.
+// \return void
+//
+// This kernel is the building block of the banded matrix/vector multiplication, which processes
+// the matrix diagonal by diagonal.
+*/
+template< typename T >  // Type of the elements
+inline typename EnableIf< PackedVectorized<T> >::Type
+   packedMultAdd( T* y, const T* a, const T* x, size_t n )
+{
+   typedef IntrinsicTrait<T>  IT;
+
+   size_t j( 0UL );
+
+   for( ; (j+IT::size*2UL) <= n; j+=IT::size*2UL ) {
+      storeu( y+j         , loadu( y+j          ) + loadu( a+j          ) * loadu( x+j          ) );
+      storeu( y+j+IT::size, loadu( y+j+IT::size ) + loadu( a+j+IT::size ) * loadu( x+j+IT::size ) );
+   }
+   if( (j+IT::size) <= n ) {
+      storeu( y+j, loadu( y+j ) + loadu( a+j ) * loadu( x+j ) );
+      j += IT::size;
+   }
+   for( ; j<n; ++j )
+      y[j] += a[j] * x[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaling of an array (\f$ a_j *= s \f$).
+// \ingroup dense_matrix
+//
+// \param a The array to be scaled.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline typename DisableIf< PackedVectorized<T> >::Type
+   packedScale( T* a, const T& s, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j )
+      a[j] *= s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaling of an array (\f$ a_j *= s \f$).
+// \ingroup dense_matrix
+//
+// \param a The array to be scaled.
+// \param s The scaling factor.
+// \param n The number of elements.
+// \return void
+*/
+template< typename T >  // Type of the elements
+inline typename EnableIf< PackedVectorized<T> >::Type
+   packedScale( T* a, const T& s, size_t n )
+{
+   typedef IntrinsicTrait<T>  IT;
+
+   const typename IT::Type factor( set( s ) );
+   size_t j( 0UL );
+
+   for( ; (j+IT::size*2UL) <= n; j+=IT::size*2UL ) {
+      storeu( a+j         , loadu( a+j          ) * factor );
+      storeu( a+j+IT::size, loadu( a+j+IT::size ) * factor );
+   }
+   if( (j+IT::size) <= n ) {
+      storeu( a+j, loadu( a+j ) * factor );
+      j += IT::size;
+   }
+   for( ; j<n; ++j )
+      a[j] *= s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
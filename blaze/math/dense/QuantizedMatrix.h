@@ -0,0 +1,1003 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/QuantizedMatrix.h
+//  \brief Header file for the implementation of a quantized 8-bit integral dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_QUANTIZEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_QUANTIZEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup quantized_matrix QuantizedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Dense row-major matrix of quantized 8-bit integral values.
+// \ingroup quantized_matrix
+//
+// The QuantizedMatrix class represents a dense, row-major \f$ M \times N \f$ matrix of 8-bit
+// integral values with a per-row scaling factor and zero point. The real value of an element
+// is given by
+
+                  \f[ a_{ij} = s_i \cdot ( q_{ij} - z_i ), \f]
+
+// where \f$ q_{ij} \f$ is the stored 8-bit value, \f$ s_i \f$ is the scaling factor and
+// \f$ z_i \f$ is the zero point of row \a i. A QuantizedMatrix can either be set up manually
+// or can be created from an arbitrary dense matrix, in which case each row is quantized
+// asymmetrically onto the range \f$ [-128..127] \f$:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::QuantizedMatrix;
+   using blaze::columnVector;
+
+   DynamicMatrix<float> W( 256UL, 1024UL );
+   // ... Initialization of the weights
+
+   QuantizedMatrix A( W );  // Per-row quantization of the weights
+
+   DynamicVector<float,columnVector> v( 1024UL );
+   DynamicVector<int8_t,columnVector> x;
+   // ... Initialization of the activations
+
+   const float s( quantize( x, v ) );  // Symmetric quantization of the activations
+
+   DynamicVector<int32_t,columnVector> y( A * x );  // Exact 8-bit x 8-bit -> 32-bit product
+   \endcode
+
+// The multiplication of a QuantizedMatrix with a vector or matrix of 8-bit integral values
+// results in 32-bit integral values and already accounts for the zero points of the matrix
+// (i.e. the result is \f$ \sum_j ( q_{ij} - z_i ) \cdot x_j \f$). The real result can be
+// obtained by scaling each element of row \a i with \f$ s_i \f$ and the scaling factor of
+// the right-hand side operand. All products are computed exactly via 32-bit accumulation.
+// Note however that the accumulation may overflow for more than 65793 columns.
+//
+// In order to enable vectorization, each row of the matrix is padded with zeros according to
+// the intrinsic 8-bit integral type (see the spacing() function).
+*/
+class QuantizedMatrix
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<int8_t>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef QuantizedMatrix  This;            //!< Type of this QuantizedMatrix instance.
+   typedef int8_t           ElementType;     //!< Type of the matrix elements.
+   typedef int8_t&          Reference;       //!< Reference to a non-constant matrix value.
+   typedef const int8_t&    ConstReference;  //!< Reference to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline QuantizedMatrix();
+   explicit inline QuantizedMatrix( size_t m, size_t n );
+
+   template< typename MT, bool SO >
+   explicit inline QuantizedMatrix( const DenseMatrix<MT,SO>& dm );
+
+            inline QuantizedMatrix( const QuantizedMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~QuantizedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline int8_t*        data  ();
+   inline const int8_t*  data  () const;
+   inline int8_t*        data  ( size_t i );
+   inline const int8_t*  data  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline QuantizedMatrix& operator=( const QuantizedMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   rows     () const;
+   inline size_t   columns  () const;
+   inline size_t   spacing  () const;
+   inline float&   scale    ( size_t i );
+   inline float    scale    ( size_t i ) const;
+   inline int32_t& zeroPoint( size_t i );
+   inline int32_t  zeroPoint( size_t i ) const;
+   inline void     reset    ();
+   inline void     clear    ();
+   inline void     swap     ( QuantizedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t adjustColumns( size_t minColumns ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                  //!< The current number of rows of the matrix.
+   size_t n_;                  //!< The current number of columns of the matrix.
+   size_t nn_;                 //!< The alignment adjusted number of columns.
+   int8_t* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+                               /*!< Access to the matrix elements is gained via the function
+                                    call operator. The memory layout of the matrix elements
+                                    is row-major and each row is padded with zeros. */
+   float*   scale_;            //!< The scaling factors of the rows.
+   int32_t* zero_;             //!< The zero points of the rows.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for QuantizedMatrix.
+*/
+inline QuantizedMatrix::QuantizedMatrix()
+   : m_    ( 0UL  )  // The current number of rows of the matrix
+   , n_    ( 0UL  )  // The current number of columns of the matrix
+   , nn_   ( 0UL  )  // The alignment adjusted number of columns
+   , v_    ( NULL )  // The matrix elements
+   , scale_( NULL )  // The scaling factors of the rows
+   , zero_ ( NULL )  // The zero points of the rows
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// All matrix elements and zero points are initialized to 0, all scaling factors are set to 1.
+*/
+inline QuantizedMatrix::QuantizedMatrix( size_t m, size_t n )
+   : m_    ( m )                              // The current number of rows of the matrix
+   , n_    ( n )                              // The current number of columns of the matrix
+   , nn_   ( adjustColumns( n ) )             // The alignment adjusted number of columns
+   , v_    ( allocate<int8_t>( m_*nn_ ) )     // The matrix elements
+   , scale_( allocate<float>( m_ ) )          // The scaling factors of the rows
+   , zero_ ( allocate<int32_t>( m_ ) )        // The zero points of the rows
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Quantization of the given dense matrix.
+//
+// \param dm Dense matrix to be quantized.
+//
+// This constructor quantizes each row of the given dense matrix asymmetrically: The scaling
+// factor and zero point of each row are chosen such that the range between the minimum and the
+// maximum element of the row (including 0) is mapped onto the full range \f$ [-128..127] \f$
+// and that 0 is represented exactly. Rows consisting of zeros only receive the scaling factor
+// 1 and the zero point 0.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline QuantizedMatrix::QuantizedMatrix( const DenseMatrix<MT,SO>& dm )
+   : m_    ( (~dm).rows() )                   // The current number of rows of the matrix
+   , n_    ( (~dm).columns() )                // The current number of columns of the matrix
+   , nn_   ( adjustColumns( n_ ) )            // The alignment adjusted number of columns
+   , v_    ( allocate<int8_t>( m_*nn_ ) )     // The matrix elements
+   , scale_( allocate<float>( m_ ) )          // The scaling factors of the rows
+   , zero_ ( allocate<int32_t>( m_ ) )        // The zero points of the rows
+{
+   using std::floor;
+   using std::max;
+   using std::min;
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      float low( 0.0F ), high( 0.0F );
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         const float value( static_cast<float>( (~dm)(i,j) ) );
+         low  = min( low , value );
+         high = max( high, value );
+      }
+
+      if( high > low ) {
+         scale_[i] = ( high - low ) / 255.0F;
+         zero_[i]  = static_cast<int32_t>( floor( -128.0F - low / scale_[i] + 0.5F ) );
+         zero_[i]  = min( max( zero_[i], -128 ), 127 );
+      }
+      else {
+         scale_[i] = 1.0F;
+         zero_[i]  = 0;
+      }
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         const float value( static_cast<float>( (~dm)(i,j) ) );
+         const int32_t q( static_cast<int32_t>( floor( value / scale_[i] + 0.5F ) ) + zero_[i] );
+         v_[i*nn_+j] = static_cast<int8_t>( min( max( q, -128 ), 127 ) );
+      }
+
+      for( size_t j=n_; j<nn_; ++j )
+         v_[i*nn_+j] = 0;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for QuantizedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+inline QuantizedMatrix::QuantizedMatrix( const QuantizedMatrix& m )
+   : m_    ( m.m_  )                          // The current number of rows of the matrix
+   , n_    ( m.n_  )                          // The current number of columns of the matrix
+   , nn_   ( m.nn_ )                          // The alignment adjusted number of columns
+   , v_    ( allocate<int8_t>( m_*nn_ ) )     // The matrix elements
+   , scale_( allocate<float>( m_ ) )          // The scaling factors of the rows
+   , zero_ ( allocate<int32_t>( m_ ) )        // The zero points of the rows
+{
+   std::copy( m.v_, m.v_+m_*nn_, v_ );
+   std::copy( m.scale_, m.scale_+m_, scale_ );
+   std::copy( m.zero_, m.zero_+m_, zero_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for QuantizedMatrix.
+*/
+inline QuantizedMatrix::~QuantizedMatrix()
+{
+   deallocate( v_ );
+   deallocate( scale_ );
+   deallocate( zero_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+inline QuantizedMatrix::Reference QuantizedMatrix::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+inline QuantizedMatrix::ConstReference QuantizedMatrix::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[i*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the quantized matrix. Note that
+// you can NOT assume that all matrix elements lie adjacent to each other! Each row is padded
+// with zeros according to the spacing() function.
+*/
+inline int8_t* QuantizedMatrix::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the quantized matrix. Note that
+// you can NOT assume that all matrix elements lie adjacent to each other! Each row is padded
+// with zeros according to the spacing() function.
+*/
+inline const int8_t* QuantizedMatrix::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+inline int8_t* QuantizedMatrix::data( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+inline const int8_t* QuantizedMatrix::data( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid dense matrix row access index" );
+   return v_ + i*nn_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for QuantizedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+inline QuantizedMatrix& QuantizedMatrix::operator=( const QuantizedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   QuantizedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+inline size_t QuantizedMatrix::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+inline size_t QuantizedMatrix::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// This function returns the spacing between the beginning of two rows, i.e. the total number
+// of elements of a row, including the zero padding.
+*/
+inline size_t QuantizedMatrix::spacing() const
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scaling factor of row \a i.
+//
+// \param i The row index.
+// \return Reference to the scaling factor of row \a i.
+*/
+inline float& QuantizedMatrix::scale( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return scale_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scaling factor of row \a i.
+//
+// \param i The row index.
+// \return The scaling factor of row \a i.
+*/
+inline float QuantizedMatrix::scale( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return scale_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the zero point of row \a i.
+//
+// \param i The row index.
+// \return Reference to the zero point of row \a i.
+*/
+inline int32_t& QuantizedMatrix::zeroPoint( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return zero_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the zero point of row \a i.
+//
+// \param i The row index.
+// \return The zero point of row \a i.
+*/
+inline int32_t QuantizedMatrix::zeroPoint( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return zero_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all matrix elements and zero points to 0 and all scaling factors to 1.
+*/
+inline void QuantizedMatrix::reset()
+{
+   std::fill( v_, v_+m_*nn_, int8_t( 0 ) );
+   std::fill( scale_, scale_+m_, 1.0F );
+   std::fill( zero_, zero_+m_, int32_t( 0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+inline void QuantizedMatrix::clear()
+{
+   QuantizedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void QuantizedMatrix::swap( QuantizedMatrix& m ) /* throw() */
+{
+   std::swap( m_ , m.m_  );
+   std::swap( n_ , m.n_  );
+   std::swap( nn_, m.nn_ );
+   std::swap( v_ , m.v_  );
+   std::swap( scale_, m.scale_ );
+   std::swap( zero_ , m.zero_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adjusting the number columns of the matrix according to the intrinsic 8-bit type.
+//
+// \param minColumns The minimum necessary number of columns.
+// \return The adjusted number of columns.
+*/
+inline size_t QuantizedMatrix::adjustColumns( size_t minColumns ) const
+{
+   return minColumns + ( IT::size - ( minColumns % IT::size ) ) % IT::size;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  QUANTIZED DOT PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exact dot product of two aligned, zero padded arrays of 8-bit integral values.
+// \ingroup quantized_matrix
+//
+// \param a The first array.
+// \param b The second array.
+// \param n The padded number of elements (a multiple of the intrinsic 8-bit size).
+// \return The dot product of the two arrays.
+*/
+inline int32_t qdot( const int8_t* a, const int8_t* b, size_t n )
+{
+#if BLAZE_SSE2_MODE
+   typedef IntrinsicTrait<int8_t>  IT;
+
+   BLAZE_INTERNAL_ASSERT( n % IT::size == 0UL, "Invalid number of elements detected" );
+
+   sse_int32_t xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+IT::size) < n; j+=IT::size*2UL ) {
+      xmm1 = xmm1 + madd( load( a+j          ), load( b+j          ) );
+      xmm2 = xmm2 + madd( load( a+j+IT::size ), load( b+j+IT::size ) );
+   }
+   if( j < n ) {
+      xmm1 = xmm1 + madd( load( a+j ), load( b+j ) );
+   }
+
+   return sum( xmm1 + xmm2 );
+#else
+   int32_t res( 0 );
+   for( size_t j=0UL; j<n; ++j )
+      res += static_cast<int32_t>( a[j] ) * static_cast<int32_t>( b[j] );
+   return res;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exact 2x2 block of dot products of aligned, zero padded arrays of 8-bit integral values.
+// \ingroup quantized_matrix
+//
+// \param a1 The first array of the left-hand side.
+// \param a2 The second array of the left-hand side.
+// \param b1 The first array of the right-hand side.
+// \param b2 The second array of the right-hand side.
+// \param n The padded number of elements (a multiple of the intrinsic 8-bit size).
+// \param c Array for the four dot products \f$ (a1,b1), (a1,b2), (a2,b1), (a2,b2) \f$.
+// \return void
+//
+// This kernel reuses each loaded operand for two dot products and is therefore the main
+// building block of the quantized matrix/matrix multiplication.
+*/
+inline void qdot( const int8_t* a1, const int8_t* a2, const int8_t* b1, const int8_t* b2,
+                  size_t n, int32_t (&c)[4] )
+{
+#if BLAZE_SSE2_MODE
+   typedef IntrinsicTrait<int8_t>  IT;
+
+   BLAZE_INTERNAL_ASSERT( n % IT::size == 0UL, "Invalid number of elements detected" );
+
+   sse_int32_t xmm1, xmm2, xmm3, xmm4;
+
+   for( size_t j=0UL; j<n; j+=IT::size ) {
+      const sse_int8_t x1( load( a1+j ) );
+      const sse_int8_t x2( load( a2+j ) );
+      const sse_int8_t y1( load( b1+j ) );
+      const sse_int8_t y2( load( b2+j ) );
+      xmm1 = xmm1 + madd( x1, y1 );
+      xmm2 = xmm2 + madd( x1, y2 );
+      xmm3 = xmm3 + madd( x2, y1 );
+      xmm4 = xmm4 + madd( x2, y2 );
+   }
+
+   c[0] = sum( xmm1 );
+   c[1] = sum( xmm2 );
+   c[2] = sum( xmm3 );
+   c[3] = sum( xmm4 );
+#else
+   c[0] = qdot( a1, b1, n );
+   c[1] = qdot( a1, b2, n );
+   c[2] = qdot( a2, b1, n );
+   c[3] = qdot( a2, b2, n );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name QuantizedMatrix functions */
+//@{
+template< typename VT >
+inline float quantize( DynamicVector<int8_t,columnVector>& x, const DenseVector<VT,false>& v );
+
+inline const DynamicMatrix<float,rowMajor> dequantize( const QuantizedMatrix& A );
+
+inline void multiply( DynamicVector<int32_t,columnVector>& y, const QuantizedMatrix& A,
+                      const DynamicVector<int8_t,columnVector>& x );
+
+inline void multiply( DynamicMatrix<int32_t,rowMajor>& C, const QuantizedMatrix& A,
+                      const DynamicMatrix<int8_t,columnMajor>& B );
+
+inline void swap( QuantizedMatrix& a, QuantizedMatrix& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric quantization of a dense column vector.
+// \ingroup quantized_matrix
+//
+// \param x The resulting vector of 8-bit integral values.
+// \param v The dense vector to be quantized.
+// \return The scaling factor of the quantized vector.
+//
+// This function quantizes the given dense vector symmetrically onto the range \f$ [-127..127] \f$,
+// i.e. the element with the largest absolute value is mapped to either -127 or 127. The real
+// values are given by the product of the returned scaling factor with the elements of \a x.
+// In case \a v consists of zeros only, the scaling factor 1 is returned.
+*/
+template< typename VT >  // Type of the dense vector
+inline float quantize( DynamicVector<int8_t,columnVector>& x, const DenseVector<VT,false>& v )
+{
+   using std::abs;
+   using std::floor;
+   using std::max;
+   using std::min;
+
+   const size_t n( (~v).size() );
+
+   float high( 0.0F );
+   for( size_t j=0UL; j<n; ++j )
+      high = max( high, abs( static_cast<float>( (~v)[j] ) ) );
+
+   const float scale( ( high > 0.0F )?( high / 127.0F ):( 1.0F ) );
+
+   x.resize( n, false );
+   for( size_t j=0UL; j<n; ++j ) {
+      const float value( floor( static_cast<float>( (~v)[j] ) / scale + 0.5F ) );
+      x[j] = static_cast<int8_t>( min( max( value, -127.0F ), 127.0F ) );
+   }
+
+   return scale;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dequantization of a quantized matrix.
+// \ingroup quantized_matrix
+//
+// \param A The quantized matrix.
+// \return The single precision matrix represented by \a A.
+*/
+inline const DynamicMatrix<float,rowMajor> dequantize( const QuantizedMatrix& A )
+{
+   DynamicMatrix<float,rowMajor> res( A.rows(), A.columns() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const float   scale( A.scale( i ) );
+      const int32_t zero ( A.zeroPoint( i ) );
+      for( size_t j=0UL; j<A.columns(); ++j )
+         res(i,j) = scale * static_cast<float>( static_cast<int32_t>( A(i,j) ) - zero );
+   }
+
+   return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a quantized matrix and a vector of 8-bit integral values
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup quantized_matrix
+//
+// \param y The resulting vector of 32-bit integral values.
+// \param A The left-hand side quantized matrix.
+// \param x The right-hand side vector of 8-bit integral values.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes \f$ y_i = \sum_j ( q_{ij} - z_i ) \cdot x_j \f$ with exact 32-bit
+// accumulation. In contrast to the multiplication operator, the given result vector is reused.
+*/
+inline void multiply( DynamicVector<int32_t,columnVector>& y, const QuantizedMatrix& A,
+                      const DynamicVector<int8_t,columnVector>& x )
+{
+   if( A.columns() != x.size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   int32_t xsum( 0 );
+   for( size_t j=0UL; j<x.size(); ++j )
+      xsum += x[j];
+
+   y.resize( A.rows(), false );
+
+   const size_t nn( A.spacing() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      y[i] = qdot( A.data( i ), x.data(), nn ) - A.zeroPoint( i ) * xsum;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a quantized matrix and a column-major matrix of 8-bit integral values
+//        (\f$ C=A*B \f$).
+// \ingroup quantized_matrix
+//
+// \param C The resulting row-major matrix of 32-bit integral values.
+// \param A The left-hand side quantized matrix.
+// \param B The right-hand side column-major matrix of 8-bit integral values.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes \f$ c_{ij} = \sum_k ( q_{ik} - z_i ) \cdot b_{kj} \f$ with exact
+// 32-bit accumulation. Due to the column-major storage order of \a B all products are computed
+// as dot products of contiguous, zero padded rows of \a A and columns of \a B. In contrast to
+// the multiplication operator, the given result matrix is reused.
+*/
+inline void multiply( DynamicMatrix<int32_t,rowMajor>& C, const QuantizedMatrix& A,
+                      const DynamicMatrix<int8_t,columnMajor>& B )
+{
+   if( A.columns() != B.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   BLAZE_INTERNAL_ASSERT( A.spacing() == B.spacing(), "Invalid matrix spacing detected" );
+
+   const size_t M ( A.rows()    );
+   const size_t N ( B.columns() );
+   const size_t nn( A.spacing() );
+
+   DynamicVector<int32_t,rowVector> bsum( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      bsum[j] = 0;
+      for( size_t k=0UL; k<B.rows(); ++k )
+         bsum[j] += B(k,j);
+   }
+
+   C.resize( M, N, false );
+
+   int32_t c[4];
+   size_t i( 0UL );
+
+   for( ; (i+2UL) <= M; i+=2UL )
+   {
+      const int32_t z1( A.zeroPoint( i     ) );
+      const int32_t z2( A.zeroPoint( i+1UL ) );
+      size_t j( 0UL );
+
+      for( ; (j+2UL) <= N; j+=2UL ) {
+         qdot( A.data( i ), A.data( i+1UL ), B.data( j ), B.data( j+1UL ), nn, c );
+         C(i    ,j    ) = c[0] - z1 * bsum[j    ];
+         C(i    ,j+1UL) = c[1] - z1 * bsum[j+1UL];
+         C(i+1UL,j    ) = c[2] - z2 * bsum[j    ];
+         C(i+1UL,j+1UL) = c[3] - z2 * bsum[j+1UL];
+      }
+      if( j < N ) {
+         C(i    ,j) = qdot( A.data( i     ), B.data( j ), nn ) - z1 * bsum[j];
+         C(i+1UL,j) = qdot( A.data( i+1UL ), B.data( j ), nn ) - z2 * bsum[j];
+      }
+   }
+   if( i < M ) {
+      const int32_t z1( A.zeroPoint( i ) );
+      for( size_t j=0UL; j<N; ++j ) {
+         C(i,j) = qdot( A.data( i ), B.data( j ), nn ) - z1 * bsum[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two quantized matrices.
+// \ingroup quantized_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void swap( QuantizedMatrix& a, QuantizedMatrix& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a quantized matrix and a vector of
+//        8-bit integral values (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup quantized_matrix
+//
+// \param mat The left-hand side quantized matrix.
+// \param vec The right-hand side vector of 8-bit integral values.
+// \return The resulting vector of 32-bit integral values.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+inline const DynamicVector<int32_t,columnVector>
+   operator*( const QuantizedMatrix& mat, const DynamicVector<int8_t,columnVector>& vec )
+{
+   DynamicVector<int32_t,columnVector> res;
+   multiply( res, mat, vec );
+   return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a quantized matrix and a column-major
+//        matrix of 8-bit integral values (\f$ C=A*B \f$).
+// \ingroup quantized_matrix
+//
+// \param lhs The left-hand side quantized matrix.
+// \param rhs The right-hand side column-major matrix of 8-bit integral values.
+// \return The resulting row-major matrix of 32-bit integral values.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+inline const DynamicMatrix<int32_t,rowMajor>
+   operator*( const QuantizedMatrix& lhs, const DynamicMatrix<int8_t,columnMajor>& rhs )
+{
+   DynamicMatrix<int32_t,rowMajor> res;
+   multiply( res, lhs, rhs );
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
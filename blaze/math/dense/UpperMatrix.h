@@ -0,0 +1,923 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/UpperMatrix.h
+//  \brief Header file for the implementation of a packed upper triangular dense matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_UPPERMATRIX_H_
+#define _BLAZE_MATH_DENSE_UPPERMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/PackedKernels.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/PMatDMatMultExpr.h>
+#include <blaze/math/expressions/PMatDVecMultExpr.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/DMatDMatMultExprTrait.h>
+#include <blaze/math/traits/DMatDVecMultExprTrait.h>
+#include <blaze/math/traits/DMatTDMatMultExprTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsColumnVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup upper_matrix UpperMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Packed upper triangular dense matrix.
+// \ingroup upper_matrix
+//
+// The UpperMatrix class template represents an upper triangular \f$ N \times N \f$ dense matrix
+// of arbitrary element type, i.e. a matrix with \f$ a_{ij} = 0 \f$ for all \f$ j < i \f$. Only
+// the upper part of the matrix is stored. It is stored row-wise in a single packed array, i.e.
+// row \a i consists of the \f$ N-i \f$ elements \f$ a_{ii} \ldots a_{i,N-1} \f$ and starts at
+// the offset \f$ i(2N-i+1)/2 \f$. Thus an upper matrix requires only \f$ N(N+1)/2 \f$ elements.
+// Read access is possible to all elements of the matrix, write access is restricted to the
+// upper part:
+
+   \code
+   using blaze::UpperMatrix;
+   using blaze::DynamicVector;
+
+   UpperMatrix<double> U( 1000UL );
+   U(1,2) = 4.0;  // Valid write access to the upper part
+   U(2,1);        // Read access to the lower part, which returns 0
+
+   DynamicVector<double> b( 1000UL, 1.0 ), x;
+   // ... Initialization of the diagonal of U
+
+   DynamicVector<double> y( U * b );  // Triangular matrix/vector multiplication (TRMV)
+   solve( x, U, b );                  // Backward substitution (TRSV)
+   \endcode
+
+// The multiplication of an upper matrix with a dense vector or dense matrix and the solution of
+// triangular systems via solve() use dedicated kernels, which only touch the stored elements.
+// Additionally, an upper matrix can be used in all other dense matrix operations, in which it
+// behaves like a row-major dense matrix. However, since the elements are not stored in padded
+// rows, these operations are not vectorized.
+*/
+template< typename Type >  // Data type of the matrix
+class UpperMatrix : public DenseMatrix< UpperMatrix<Type>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef UpperMatrix<Type>                This;            //!< Type of this UpperMatrix instance.
+   typedef DynamicMatrix<Type,rowMajor>     ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,columnMajor>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,columnMajor>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the matrix elements.
+   typedef const Type                       ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                            Reference;       //!< Reference to a non-constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows of an upper matrix are neither
+       complete nor padded, the \a vectorizable compilation flag is set to \a false. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline UpperMatrix();
+   explicit inline UpperMatrix( size_t n );
+   explicit inline UpperMatrix( size_t n, const Type& init );
+
+   template< typename MT, bool SO >
+   explicit inline UpperMatrix( const DenseMatrix<MT,SO>& dm );
+
+            inline UpperMatrix( const UpperMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~UpperMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference   operator()( size_t i, size_t j );
+   inline ReturnType  operator()( size_t i, size_t j ) const;
+   inline Type*       data  ();
+   inline const Type* data  () const;
+   inline Type*       data  ( size_t i );
+   inline const Type* data  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline UpperMatrix& operator=( const UpperMatrix& rhs );
+
+   template< typename MT, bool SO >
+   inline UpperMatrix& operator=( const DenseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows    () const;
+   inline size_t columns () const;
+   inline size_t capacity() const;
+   inline void   reset   ();
+   inline void   clear   ();
+   inline void   swap    ( UpperMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                //!< The current number of rows and columns of the matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated packed upper part of the matrix.
+                             /*!< The upper part of the matrix is stored row-wise, row \a i
+                                  starts at the offset \f$ i(2N-i+1)/2 \f$. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for UpperMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>::UpperMatrix()
+   : n_( 0UL  )  // The current number of rows and columns of the matrix
+   , v_( NULL )  // The packed upper part of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All matrix elements are initialized to the default value of the element type.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>::UpperMatrix( size_t n )
+   : n_( n )                                // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( n*(n+1UL)/2UL ) )  // The packed upper part of the matrix
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all \f$ n \times n \f$ matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the matrix elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>::UpperMatrix( size_t n, const Type& init )
+   : n_( n )                                // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( n*(n+1UL)/2UL ) )  // The packed upper part of the matrix
+{
+   std::fill( v_, v_+capacity(), init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a dense matrix.
+//
+// \param dm Upper triangular dense matrix to be copied.
+// \exception std::invalid_argument Invalid setup of upper matrix.
+//
+// This constructor copies the upper part of the given dense matrix. In case the given matrix
+// is not square or has non-default elements in its lower part, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline UpperMatrix<Type>::UpperMatrix( const DenseMatrix<MT,SO>& dm )
+   : n_( (~dm).rows() )  // The current number of rows and columns of the matrix
+   , v_( NULL )          // The packed upper part of the matrix
+{
+   if( (~dm).columns() != n_ )
+      throw std::invalid_argument( "Invalid setup of upper matrix" );
+
+   for( size_t i=1UL; i<n_; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         if( !isDefault( (~dm)(i,j) ) )
+            throw std::invalid_argument( "Invalid setup of upper matrix" );
+      }
+   }
+
+   v_ = allocate<Type>( capacity() );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      Type* row( data( i ) );
+      for( size_t j=i; j<n_; ++j )
+         row[j-i] = (~dm)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for UpperMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>::UpperMatrix( const UpperMatrix& m )
+   : n_( m.n_ )                            // The current number of rows and columns of the matrix
+   , v_( allocate<Type>( m.capacity() ) )  // The packed upper part of the matrix
+{
+   std::copy( m.v_, m.v_+capacity(), v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for UpperMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>::~UpperMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// Write access is restricted to the upper part of the matrix, i.e. the column index \a j must
+// not be smaller than the row index \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename UpperMatrix<Type>::Reference
+   UpperMatrix<Type>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( i<=j, "Invalid access to the lower part of an upper matrix" );
+   return v_[i*(2UL*n_-i+1UL)/2UL+j-i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The accessed value, which is 0 for all elements of the lower part.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename UpperMatrix<Type>::ReturnType
+   UpperMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return ( j < i )?( Type() ):( v_[i*(2UL*n_-i+1UL)/2UL+j-i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Data type of the matrix
+inline Type* UpperMatrix<Type>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Data type of the matrix
+inline const Type* UpperMatrix<Type>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed elements of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the \f$ N-i \f$ stored elements \f$ a_{ii} \ldots a_{i,N-1} \f$ of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline Type* UpperMatrix<Type>::data( size_t i )
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return v_ + i*(2UL*n_-i+1UL)/2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed elements of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the \f$ N-i \f$ stored elements \f$ a_{ii} \ldots a_{i,N-1} \f$ of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline const Type* UpperMatrix<Type>::data( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid dense matrix row access index" );
+   return v_ + i*(2UL*n_-i+1UL)/2UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for UpperMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline UpperMatrix<Type>& UpperMatrix<Type>::operator=( const UpperMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   UpperMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Upper triangular dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to upper matrix.
+//
+// In case the given matrix is not square or has non-default elements in its lower part, a
+// \a std::invalid_argument exception is thrown and the upper matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order of the dense matrix
+inline UpperMatrix<Type>& UpperMatrix<Type>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   try {
+      UpperMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::invalid_argument( "Invalid assignment to upper matrix" );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t UpperMatrix<Type>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t UpperMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements, i.e. \f$ N(N+1)/2 \f$.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t UpperMatrix<Type>::capacity() const
+{
+   return n_*(n_+1UL)/2UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void UpperMatrix<Type>::reset()
+{
+   std::fill( v_, v_+capacity(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type >  // Data type of the matrix
+inline void UpperMatrix<Type>::clear()
+{
+   UpperMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the matrix
+inline void UpperMatrix<Type>::swap( UpperMatrix& m ) /* throw() */
+{
+   std::swap( n_, m.n_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool UpperMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool UpperMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name UpperMatrix functions */
+//@{
+template< typename Type, typename VT >
+inline void multiply( DynamicVector<Type,columnVector>& y, const UpperMatrix<Type>& A,
+                      const DenseVector<VT,columnVector>& x );
+
+template< typename Type, typename MT, bool SO >
+inline void multiply( DynamicMatrix<Type,rowMajor>& C, const UpperMatrix<Type>& A,
+                      const DenseMatrix<MT,SO>& B );
+
+template< typename Type, typename VT >
+inline void solve( DynamicVector<Type,columnVector>& x, const UpperMatrix<Type>& A,
+                   const DenseVector<VT,columnVector>& b );
+
+template< typename Type >
+inline void swap( UpperMatrix<Type>& a, UpperMatrix<Type>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of an upper matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup upper_matrix
+//
+// \param y The resulting dense vector.
+// \param A The left-hand side upper matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function implements the triangular matrix/vector multiplication (TRMV). Each element of
+// the result is computed as the dot product of a packed row with the trailing elements of \a x.
+// In contrast to the multiplication operator, the given result vector is reused.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void multiply( DynamicVector<Type,columnVector>& y, const UpperMatrix<Type>& A,
+                      const DenseVector<VT,columnVector>& x )
+{
+   typedef DynamicVector<Type,columnVector>  VectorType;
+   typedef typename If< IsSame<VT,VectorType>, const VectorType&, const VectorType >::Type  Operand;
+
+   if( A.columns() != (~x).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   Operand tmp( ~x );
+
+   if( static_cast<const void*>( &y ) == static_cast<const void*>( &tmp ) ) {
+      VectorType res;
+      multiply( res, A, tmp );
+      y.swap( res );
+      return;
+   }
+
+   const size_t n( A.rows() );
+
+   y.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] = packedDot( A.data( i ), tmp.data()+i, n-i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of an upper matrix and a dense matrix (\f$ C=A*B \f$).
+// \ingroup upper_matrix
+//
+// \param C The resulting row-major dense matrix.
+// \param A The left-hand side upper matrix.
+// \param B The right-hand side dense matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function implements the triangular matrix/matrix multiplication (TRMM). Row \a i of the
+// result is computed as the sum of the rows \f$ i \ldots N-1 \f$ of \a B, scaled by the stored
+// elements of row \a i of \a A. In contrast to the multiplication operator, the given result
+// matrix is reused.
+*/
+template< typename Type  // Data type of the matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void multiply( DynamicMatrix<Type,rowMajor>& C, const UpperMatrix<Type>& A,
+                      const DenseMatrix<MT,SO>& B )
+{
+   typedef DynamicMatrix<Type,rowMajor>  MatrixType;
+   typedef typename If< IsSame<MT,MatrixType>, const MatrixType&, const MatrixType >::Type  Operand;
+
+   if( A.columns() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   Operand tmp( ~B );
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &tmp ) ) {
+      MatrixType res;
+      multiply( res, A, tmp );
+      C.swap( res );
+      return;
+   }
+
+   const size_t n( A.rows() );
+   const size_t k( tmp.columns() );
+
+   C.resize( n, k, false );
+   reset( C );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const Type* a( A.data( i ) );
+      for( size_t j=i; j<n; ++j ) {
+         packedAxpy( C.data( i ), tmp.data( j ), a[j-i], k );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the upper triangular system \f$ A*\vec{x}=\vec{b} \f$.
+// \ingroup upper_matrix
+//
+// \param x The resulting solution vector.
+// \param A The upper triangular system matrix.
+// \param b The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the given upper triangular system via backward substitution (TRSV). The
+// system matrix is expected to be non-singular, i.e. all diagonal elements must be non-zero.
+// \a x and \a b may refer to the same vector.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void solve( DynamicVector<Type,columnVector>& x, const UpperMatrix<Type>& A,
+                   const DenseVector<VT,columnVector>& b )
+{
+   if( A.columns() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   x = ~b;
+
+   const size_t n( A.rows() );
+   Type* xp( x.data() );
+
+   for( size_t i=n; i-- > 0UL; ) {
+      const Type* a( A.data( i ) );
+      xp[i] = ( xp[i] - packedDot( a+1UL, xp+i+1UL, n-i-1UL ) ) / a[0];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two upper matrices.
+// \ingroup upper_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the matrices
+inline void swap( UpperMatrix<Type>& a, UpperMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of an upper matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup upper_matrix
+//
+// \param mat The left-hand side upper matrix.
+// \param vec The right-hand side dense vector.
+// \return The expression representing the packed matrix/vector multiplication.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline const PMatDVecMultExpr< UpperMatrix<Type>, VT >
+   operator*( const UpperMatrix<Type>& mat, const DenseVector<VT,columnVector>& vec )
+{
+   if( mat.columns() != (~vec).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   return PMatDVecMultExpr< UpperMatrix<Type>, VT >( mat, ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of an upper matrix and a dense matrix
+//        (\f$ C=A*B \f$).
+// \ingroup upper_matrix
+//
+// \param lhs The left-hand side upper matrix.
+// \param rhs The right-hand side dense matrix.
+// \return The expression representing the packed matrix/matrix multiplication.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline const PMatDMatMultExpr< UpperMatrix<Type>, MT >
+   operator*( const UpperMatrix<Type>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   if( lhs.columns() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   return PMatDMatMultExpr< UpperMatrix<Type>, MT >( lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename VT >
+struct DMatDVecMultExprTrait< UpperMatrix<T>, VT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseVector<VT>::value && IsColumnVector<VT>::value
+                              , const PMatDVecMultExpr< UpperMatrix<T>, VT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename MT >
+struct DMatDMatMultExprTrait< UpperMatrix<T>, MT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseMatrix<MT>::value && IsRowMajorMatrix<MT>::value
+                              , const PMatDMatMultExpr< UpperMatrix<T>, MT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename MT >
+struct DMatTDMatMultExprTrait< UpperMatrix<T>, MT >
+{
+ public:
+   //**********************************************************************************************
+   typedef typename SelectType< IsDenseMatrix<MT>::value && IsColumnMajorMatrix<MT>::value
+                              , const PMatDMatMultExpr< UpperMatrix<T>, MT >, INVALID_TYPE >::Type  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -87,6 +87,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -241,6 +242,31 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target matrix is a row-major matrix with the resulting element type of the
+       multiplication and at least one of the two matrix operands has a different element type,
+       which can be converted in registers into the resulting element type (mixed precision
+       matrix/matrix multiplication, as for instance the multiplication of two half precision
+       matrices), the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      typedef typename T1::ElementType  ET;
+      typedef typename T2::ElementType  MET1;
+      typedef typename T3::ElementType  MET2;
+      enum { value = T1::vectorizable && T3::vectorizable && IsRowMajorMatrix<T1>::value &&
+                     IsSame<ET,typename MultTrait<MET1,MET2>::Type>::value &&
+                     ( IsSame<ET,MET1>::value || IntrinsicConversionTrait<MET1,ET>::value ) &&
+                     ( IsSame<ET,MET2>::value || IntrinsicConversionTrait<MET2,ET>::value ) &&
+                     !( IsSame<ET,MET1>::value && IsSame<ET,MET2>::value ) &&
+                     IntrinsicTrait<ET>::addition &&
+                     IntrinsicTrait<ET>::subtraction &&
+                     IntrinsicTrait<ET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDMatMultExpr<MT1,MT2>                   This;           //!< Type of this DMatDMatMultExpr instance.
@@ -519,7 +545,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , UseMixedPrecisionKernel<MT3,MT4,MT5> > >::Type
       selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -733,6 +760,91 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default assignment to row-major dense matrices******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default assignment of a dense matrix-dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment of a dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix in case the operands are stored with
+   // a lower precision than the target matrix (as for instance two half precision matrices and a
+   // single precision target matrix). The elements of the right-hand side operand are loaded in
+   // their storage precision and converted in registers to the element type of the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<MT3,MT4,MT5> >::Type
+      selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT5::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+         size_t i( 0UL );
+         for( ; (i+4UL) <= M; i+=4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i    ,k) ) ) );
+               const IntrinsicType a2( set( ElementType( A(i+1UL,k) ) ) );
+               const IntrinsicType a3( set( ElementType( A(i+2UL,k) ) ) );
+               const IntrinsicType a4( set( ElementType( A(i+3UL,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+                  xmm2[r] = xmm2[r] + a2 * b1[r];
+                  xmm3[r] = xmm3[r] + a3 * b1[r];
+                  xmm4[r] = xmm4[r] + a4 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i    , j+r*IT::size, xmm1[r] );
+               (~C).store( i+1UL, j+r*IT::size, xmm2[r] );
+               (~C).store( i+2UL, j+r*IT::size, xmm3[r] );
+               (~C).store( i+3UL, j+r*IT::size, xmm4[r] );
+            }
+         }
+         for( ; i<M; ++i ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i, j+r*IT::size, xmm1[r] );
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jend; j<N; ++j ) {
+            ElementType tmp = ElementType();
+            for( size_t k=0UL; k<K; ++k ) {
+               tmp += ElementType( A(i,k) ) * ElementType( B(k,j) );
+            }
+            C(i,j) = tmp;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense matrices (default)*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
@@ -1080,7 +1192,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , UseMixedPrecisionKernel<MT3,MT4,MT5> > >::Type
       selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -1320,6 +1433,91 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default addition assignment to row-major dense matrices*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default addition assignment of a dense matrix-dense matrix
+   //        multiplication (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment of a dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix in case the operands are stored with
+   // a lower precision than the target matrix (as for instance two half precision matrices and a
+   // single precision target matrix). The elements of the right-hand side operand are loaded in
+   // their storage precision and converted in registers to the element type of the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<MT3,MT4,MT5> >::Type
+      selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT5::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+         size_t i( 0UL );
+         for( ; (i+4UL) <= M; i+=4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i    ,k) ) ) );
+               const IntrinsicType a2( set( ElementType( A(i+1UL,k) ) ) );
+               const IntrinsicType a3( set( ElementType( A(i+2UL,k) ) ) );
+               const IntrinsicType a4( set( ElementType( A(i+3UL,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+                  xmm2[r] = xmm2[r] + a2 * b1[r];
+                  xmm3[r] = xmm3[r] + a3 * b1[r];
+                  xmm4[r] = xmm4[r] + a4 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i    , j+r*IT::size, (~C).load(i    ,j+r*IT::size) + xmm1[r] );
+               (~C).store( i+1UL, j+r*IT::size, (~C).load(i+1UL,j+r*IT::size) + xmm2[r] );
+               (~C).store( i+2UL, j+r*IT::size, (~C).load(i+2UL,j+r*IT::size) + xmm3[r] );
+               (~C).store( i+3UL, j+r*IT::size, (~C).load(i+3UL,j+r*IT::size) + xmm4[r] );
+            }
+         }
+         for( ; i<M; ++i ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i, j+r*IT::size, (~C).load(i,j+r*IT::size) + xmm1[r] );
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jend; j<N; ++j ) {
+            ElementType tmp = ElementType();
+            for( size_t k=0UL; k<K; ++k ) {
+               tmp += ElementType( A(i,k) ) * ElementType( B(k,j) );
+            }
+            C(i,j) += tmp;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense matrices (default)**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense matrix multiplication
@@ -1636,7 +1834,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<MT3,MT4,MT5>
+                                       , UseMixedPrecisionKernel<MT3,MT4,MT5> > >::Type
       selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       const size_t M( A.rows()    );
@@ -1876,6 +2075,91 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default subtraction assignment to row-major dense matrices******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default subtraction assignment of a dense matrix-dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment of a dense matrix-dense matrix
+   // multiplication expression to a row-major dense matrix in case the operands are stored with
+   // a lower precision than the target matrix (as for instance two half precision matrices and a
+   // single precision target matrix). The elements of the right-hand side operand are loaded in
+   // their storage precision and converted in registers to the element type of the target matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<MT3,MT4,MT5> >::Type
+      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT5::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+         size_t i( 0UL );
+         for( ; (i+4UL) <= M; i+=4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i    ,k) ) ) );
+               const IntrinsicType a2( set( ElementType( A(i+1UL,k) ) ) );
+               const IntrinsicType a3( set( ElementType( A(i+2UL,k) ) ) );
+               const IntrinsicType a4( set( ElementType( A(i+3UL,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+                  xmm2[r] = xmm2[r] + a2 * b1[r];
+                  xmm3[r] = xmm3[r] + a3 * b1[r];
+                  xmm4[r] = xmm4[r] + a4 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i    , j+r*IT::size, (~C).load(i    ,j+r*IT::size) - xmm1[r] );
+               (~C).store( i+1UL, j+r*IT::size, (~C).load(i+1UL,j+r*IT::size) - xmm2[r] );
+               (~C).store( i+2UL, j+r*IT::size, (~C).load(i+2UL,j+r*IT::size) - xmm3[r] );
+               (~C).store( i+3UL, j+r*IT::size, (~C).load(i+3UL,j+r*IT::size) - xmm4[r] );
+            }
+         }
+         for( ; i<M; ++i ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<K; ++k ) {
+               IntrinsicType b1[CT::ratio];
+               convert( B.load(k,j), b1 );
+               const IntrinsicType a1( set( ElementType( A(i,k) ) ) );
+               for( size_t r=0UL; r<CT::ratio; ++r ) {
+                  xmm1[r] = xmm1[r] + a1 * b1[r];
+               }
+            }
+            for( size_t r=0UL; r<CT::ratio; ++r ) {
+               (~C).store( i, j+r*IT::size, (~C).load(i,j+r*IT::size) - xmm1[r] );
+            }
+         }
+      }
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jend; j<N; ++j ) {
+            ElementType tmp = ElementType();
+            for( size_t k=0UL; k<K; ++k ) {
+               tmp += ElementType( A(i,k) ) * ElementType( B(k,j) );
+            }
+            C(i,j) -= tmp;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense matrices (default)*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense matrix multiplication
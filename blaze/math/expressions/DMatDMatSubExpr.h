@@ -55,6 +55,7 @@
 #include <blaze/math/traits/SubExprTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -578,6 +579,69 @@ class DMatDMatSubExpr : public DenseMatrix< DMatDMatSubExpr<MT1,MT2,SO>, SO >
    RightOperand rhs_;  //!< Right-hand side dense matrix of the subtraction expression.
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target matrix and both matrix operands are suited for a vectorized evaluation
+       and at least one of the operands has a different element type than the result of the
+       subtraction, which can be converted in registers into the resulting element type (mixed
+       precision subtraction), the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T >
+   struct UseMixedPrecisionKernel {
+      enum { value = !useAssign && T::vectorizable && MT1::vectorizable && MT2::vectorizable &&
+                     IsSame<typename T::ElementType,ElementType>::value &&
+                     ( IsSame<ET1,ElementType>::value ||
+                       IntrinsicConversionTrait<ET1,ElementType>::value ) &&
+                     ( IsSame<ET2,ElementType>::value ||
+                       IntrinsicConversionTrait<ET2,ElementType>::value ) &&
+                     !( IsSame<ET1,ElementType>::value && IsSame<ET2,ElementType>::value ) &&
+                     IntrinsicTrait<ElementType>::addition &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Number of intrinsic vectors per block of the mixed precision kernels.
+   enum { mixedRatio = ( int( IntrinsicConversionTrait<ET1,ElementType>::ratio ) >
+                         int( IntrinsicConversionTrait<ET2,ElementType>::ratio ) )
+                       ?( int( IntrinsicConversionTrait<ET1,ElementType>::ratio ) )
+                       :( int( IntrinsicConversionTrait<ET2,ElementType>::ratio ) ) };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Converted load function*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Loads a block of elements of a matrix operand in the resulting element type.
+   //
+   // \param m The dense matrix operand.
+   // \param i Access index for the row of the first element of the block.
+   // \param j Access index for the column of the first element of the block.
+   // \param xmm The resulting intrinsic vectors.
+   // \return void
+   //
+   // This function loads \a mixedRatio intrinsic vectors of the resulting element type starting
+   // at the given position (within a row in case of row-major matrices, within a column in case
+   // of column-major matrices). The elements of the operand are loaded in their storage precision
+   // and converted in registers.
+   */
+   template< typename MT >  // Type of the dense matrix operand
+   static inline void loadConverted( const MT& m, size_t i, size_t j, IntrinsicType* xmm )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT::ElementType,ElementType>  CT;
+
+      for( size_t k=0UL; k<size_t( mixedRatio ); k+=CT::ratio ) {
+         if( SO == rowMajor )
+            convert( m.load( i, j+k*IT::size ), xmm+k );
+         else
+            convert( m.load( i+k*IT::size, j ), xmm+k );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense matrix subtraction to a dense matrix.
@@ -605,6 +669,10 @@ class DMatDMatSubExpr : public DenseMatrix< DMatDMatSubExpr<MT1,MT2,SO>, SO >
       if( !IsExpression<MT1>::value && (~lhs).isAliased( &rhs.lhs_ ) ) {
          smpSubAssign( ~lhs, rhs.rhs_ );
       }
+      else if( IsComputation<MT1>::value && IsComputation<MT2>::value &&
+               canSMPAssignConcurrently( rhs.lhs_, rhs.rhs_ ) ) {
+         smpAssignDifference( ~lhs, rhs.lhs_, rhs.rhs_ );
+      }
       else {
          smpAssign   ( ~lhs, rhs.lhs_ );
          smpSubAssign( ~lhs, rhs.rhs_ );
@@ -728,6 +796,208 @@ class DMatDMatSubExpr : public DenseMatrix< DMatDMatSubExpr<MT1,MT2,SO>, SO >
    // No special implementation for the multiplication assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense matrixs*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision assignment of a dense matrix-dense matrix subtraction to a
+   //        dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the vectorized assignment of a dense matrix-dense matrix
+   // subtraction expression to a dense matrix with the same storage order in case the operands
+   // are stored with a lower precision than the result (as for instance a single precision and
+   // a double precision matrix). The elements of the operands are loaded in their storage
+   // precision and converted in registers.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline typename EnableIf< UseMixedPrecisionKernel<MT> >::Type
+      assign( DenseMatrix<MT,SO>& lhs, const DMatDMatSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( rhs.rows()    );
+      const size_t N( rhs.columns() );
+
+      if( SO == rowMajor ) {
+         const size_t jend( N - N % ( IT::size*mixedRatio ) );
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<jend; j+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i, j+k*IT::size, xmm1[k] - xmm2[k] );
+               }
+            }
+            for( size_t j=jend; j<N; ++j ) {
+               (~lhs)(i,j) = rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+      else {
+         const size_t iend( M - M % ( IT::size*mixedRatio ) );
+         for( size_t j=0UL; j<N; ++j ) {
+            for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i+k*IT::size, j, xmm1[k] - xmm2[k] );
+               }
+            }
+            for( size_t i=iend; i<M; ++i ) {
+               (~lhs)(i,j) = rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mixed precision addition assignment to dense matrixs****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision addition assignment of a dense matrix-dense matrix subtraction to a
+   //        dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side subtraction expression to be added.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment of a dense matrix-dense matrix
+   // subtraction expression to a dense matrix with the same storage order in case the operands
+   // are stored with a lower precision than the result (as for instance a single precision and
+   // a double precision matrix). The elements of the operands are loaded in their storage
+   // precision and converted in registers.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline typename EnableIf< UseMixedPrecisionKernel<MT> >::Type
+      addAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( rhs.rows()    );
+      const size_t N( rhs.columns() );
+
+      if( SO == rowMajor ) {
+         const size_t jend( N - N % ( IT::size*mixedRatio ) );
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<jend; j+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i, j+k*IT::size,
+                                (~lhs).load(i,j+k*IT::size) + ( xmm1[k] - xmm2[k] ) );
+               }
+            }
+            for( size_t j=jend; j<N; ++j ) {
+               (~lhs)(i,j) += rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+      else {
+         const size_t iend( M - M % ( IT::size*mixedRatio ) );
+         for( size_t j=0UL; j<N; ++j ) {
+            for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i+k*IT::size, j,
+                                (~lhs).load(i+k*IT::size,j) + ( xmm1[k] - xmm2[k] ) );
+               }
+            }
+            for( size_t i=iend; i<M; ++i ) {
+               (~lhs)(i,j) += rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mixed precision subtraction assignment to dense matrixs*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision subtraction assignment of a dense matrix-dense matrix subtraction to a
+   //        dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side subtraction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment of a dense matrix-dense matrix
+   // subtraction expression to a dense matrix with the same storage order in case the operands
+   // are stored with a lower precision than the result (as for instance a single precision and
+   // a double precision matrix). The elements of the operands are loaded in their storage
+   // precision and converted in registers.
+   */
+   template< typename MT >  // Type of the target dense matrix
+   friend inline typename EnableIf< UseMixedPrecisionKernel<MT> >::Type
+      subAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( rhs.rows()    );
+      const size_t N( rhs.columns() );
+
+      if( SO == rowMajor ) {
+         const size_t jend( N - N % ( IT::size*mixedRatio ) );
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=0UL; j<jend; j+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i, j+k*IT::size,
+                                (~lhs).load(i,j+k*IT::size) - ( xmm1[k] - xmm2[k] ) );
+               }
+            }
+            for( size_t j=jend; j<N; ++j ) {
+               (~lhs)(i,j) -= rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+      else {
+         const size_t iend( M - M % ( IT::size*mixedRatio ) );
+         for( size_t j=0UL; j<N; ++j ) {
+            for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+               IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+               loadConverted( rhs.lhs_, i, j, xmm1 );
+               loadConverted( rhs.rhs_, i, j, xmm2 );
+               for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+                  (~lhs).store( i+k*IT::size, j,
+                                (~lhs).load(i+k*IT::size,j) - ( xmm1[k] - xmm2[k] ) );
+               }
+            }
+            for( size_t i=iend; i<M; ++i ) {
+               (~lhs)(i,j) -= rhs.lhs_(i,j) - rhs.rhs_(i,j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT1 );
@@ -76,6 +76,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -237,6 +238,27 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix differs from the element type of the two
+       vectors, but can be converted in registers into the element type of the vectors
+       (mixed precision matrix/vector multiplication), the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      typedef typename T1::ElementType  ET1;
+      typedef typename T2::ElementType  MET1;
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<ET1,typename T3::ElementType>::value &&
+                     !IsSame<ET1,MET1>::value &&
+                     IntrinsicConversionTrait<MET1,ET1>::value &&
+                     IntrinsicTrait<ET1>::addition &&
+                     IntrinsicTrait<ET1>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>                     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -504,7 +526,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       y.assign( A * x );
@@ -608,6 +631,87 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default assignment of a dense matrix-dense vector multiplication (\f$
+   //        \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the dense matrix-dense
+   // vector multiplication in case the matrix is stored with a lower precision than the two vectors
+   // (as for instance a single precision matrix in combination with double precision vectors). The
+   // elements of the matrix are converted in registers to the element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i    ,j), a1 );
+            convert( A.load(i+1UL,j), a2 );
+            convert( A.load(i+2UL,j), a3 );
+            convert( A.load(i+3UL,j), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(j+k*IT::size) );
+               xmm1 = xmm1 + a1[k] * x1;
+               xmm2 = xmm2 + a2[k] * x1;
+               xmm3 = xmm3 + a3[k] * x1;
+               xmm4 = xmm4 + a4[k] * x1;
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i    ,j) * x[j];
+            y2 += A(i+1UL,j) * x[j];
+            y3 += A(i+2UL,j) * x[j];
+            y4 += A(i+3UL,j) * x[j];
+         }
+         y[i    ] = y1;
+         y[i+1UL] = y2;
+         y[i+2UL] = y3;
+         y[i+3UL] = y4;
+      }
+      for( ; i<M; ++i ) {
+         IntrinsicType xmm1;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + a1[k] * x.load(j+k*IT::size);
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i,j) * x[j];
+         }
+         y[i] = y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a dense matrix-dense vector multiplication
@@ -927,7 +1031,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultAddAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       y.addAssign( A * x );
@@ -1031,6 +1136,88 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default addition assignment to dense vectors*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default addition assignment of a dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the dense
+   // matrix-dense vector multiplication in case the matrix is stored with a lower precision than
+   // the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultAddAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i    ,j), a1 );
+            convert( A.load(i+1UL,j), a2 );
+            convert( A.load(i+2UL,j), a3 );
+            convert( A.load(i+3UL,j), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(j+k*IT::size) );
+               xmm1 = xmm1 + a1[k] * x1;
+               xmm2 = xmm2 + a2[k] * x1;
+               xmm3 = xmm3 + a3[k] * x1;
+               xmm4 = xmm4 + a4[k] * x1;
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i    ,j) * x[j];
+            y2 += A(i+1UL,j) * x[j];
+            y3 += A(i+2UL,j) * x[j];
+            y4 += A(i+3UL,j) * x[j];
+         }
+         y[i    ] += y1;
+         y[i+1UL] += y2;
+         y[i+2UL] += y3;
+         y[i+3UL] += y4;
+      }
+      for( ; i<M; ++i ) {
+         IntrinsicType xmm1;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + a1[k] * x.load(j+k*IT::size);
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i,j) * x[j];
+         }
+         y[i] += y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a dense matrix-dense vector multiplication
@@ -1324,7 +1511,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultSubAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       y.subAssign( A * x );
@@ -1428,6 +1616,88 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default subtraction assignment to dense vectors******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default subtraction assignment of a dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the dense
+   // matrix-dense vector multiplication in case the matrix is stored with a lower precision than
+   // the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultSubAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      size_t i( 0UL );
+
+      for( ; (i+4UL) <= M; i+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i    ,j), a1 );
+            convert( A.load(i+1UL,j), a2 );
+            convert( A.load(i+2UL,j), a3 );
+            convert( A.load(i+3UL,j), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(j+k*IT::size) );
+               xmm1 = xmm1 + a1[k] * x1;
+               xmm2 = xmm2 + a2[k] * x1;
+               xmm3 = xmm3 + a3[k] * x1;
+               xmm4 = xmm4 + a4[k] * x1;
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i    ,j) * x[j];
+            y2 += A(i+1UL,j) * x[j];
+            y3 += A(i+2UL,j) * x[j];
+            y4 += A(i+3UL,j) * x[j];
+         }
+         y[i    ] -= y1;
+         y[i+1UL] -= y2;
+         y[i+2UL] -= y3;
+         y[i+3UL] -= y4;
+      }
+      for( ; i<M; ++i ) {
+         IntrinsicType xmm1;
+         for( size_t j=0UL; j<jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + a1[k] * x.load(j+k*IT::size);
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t j=jend; j<N; ++j ) {
+            y1 += A(i,j) * x[j];
+         }
+         y[i] -= y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a dense matrix-dense vector multiplication
@@ -0,0 +1,1071 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatMapExpr.h
+//  \brief Header file for the dense matrix map expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATMAPEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMapExpr.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the dense matrix map() function.
+// \ingroup dense_matrix_expression
+//
+// The DMatMapExpr class represents the compile time expression for the element-wise application
+// of a unary custom operation to a dense matrix via the map() function (as for instance the
+// sqrt(), exp() or sin() function).
+*/
+template< typename MT  // Type of the dense matrix
+        , typename OP  // Type of the custom operation
+        , bool SO >    // Storage order
+class DMatMapExpr : public DenseMatrix< DMatMapExpr<MT,OP,SO>, SO >
+                  , private MatMapExpr
+                  , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType  ET;  //!< Element type of the dense matrix expression.
+   //**********************************************************************************************
+
+   //**Evaluation strategy*************************************************************************
+   //! Compilation switch for the evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the evaluation strategy of the map expression. In case the given dense matrix expression
+       of type \a MT requires an intermediate evaluation, \a useAssign will be set to 1 and the
+       map expression will be evaluated via the \a assign function family. Otherwise
+       \a useAssign will be set to 0 and the expression will be evaluated via the subscript
+       operator. */
+   enum { useAssign = RequiresEvaluation<MT>::value };
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct UseAssign {
+      enum { value = useAssign };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DMatMapExpr<MT,OP,SO>              This;           //!< Type of this DMatMapExpr instance.
+   typedef typename MT::ResultType            ResultType;     //!< Result type for expression template evaluations.
+   typedef typename MT::OppositeType          OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef typename MT::TransposeType         TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename MT::ElementType           ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ET>::Type  IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const ElementType                  ReturnType;     //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   typedef typename SelectType< useAssign, const ResultType, const DMatMapExpr& >::Type  CompositeType;
+
+   //! Composite data type of the dense matrix expression.
+   typedef typename SelectType< IsExpression<MT>::value, const MT, const MT& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the dense matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef ElementType                      ValueType;         //!< Type of the underlying elements.
+      typedef ElementType*                     PointerType;       //!< Pointer return type.
+      typedef ElementType&                     ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+
+      //! ConstIterator type of the dense matrix expression.
+      typedef typename MT::ConstIterator  IteratorType;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param it Iterator to the initial matrix element.
+      // \param op The custom unary operation.
+      */
+      explicit inline ConstIterator( IteratorType it, OP op )
+         : it_( it )  // Iterator to the current matrix element
+         , op_( op )  // The custom unary operation
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) {
+         it_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) {
+         it_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++it_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) {
+         return ConstIterator( it_++, op_ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() {
+         --it_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) {
+         return ConstIterator( it_--, op_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReturnType operator*() const {
+         return op_( *it_ );
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Access to the intrinsic elements of the matrix.
+      //
+      // \return The resulting intrinsic value.
+      */
+      inline IntrinsicType load() const {
+         return op_.load( it_.load() );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return it_ == rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return it_ != rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const {
+         return it_ < rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const {
+         return it_ > rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const {
+         return it_ <= rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const {
+         return it_ >= rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return it_ - rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) {
+         return ConstIterator( it.it_ + inc, it.op_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) {
+         return ConstIterator( it.it_ + inc, it.op_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) {
+         return ConstIterator( it.it_ - dec, it.op_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      IteratorType it_;  //!< Iterator to the current matrix element.
+      OP           op_;  //!< The custom unary operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = MT::vectorizable &&
+                         OP::template SIMDEnabled<ET>::value };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatMapExpr class.
+   //
+   // \param dm The dense matrix operand of the map expression.
+   // \param op The custom unary operation.
+   */
+   explicit inline DMatMapExpr( const MT& dm, OP op )
+      : dm_( dm )  // Dense matrix of the map expression
+      , op_( op )  // The custom unary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < dm_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < dm_.columns(), "Invalid column access index" );
+      return op_( dm_(i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the intrinsic elements of the matrix.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   inline IntrinsicType load( size_t i, size_t j ) const {
+      typedef IntrinsicTrait<ElementType>  IT;
+      BLAZE_INTERNAL_ASSERT( i < dm_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < dm_.columns(), "Invalid column access index" );
+      BLAZE_INTERNAL_ASSERT( !SO || ( i % IT::size == 0UL ), "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( SO  || ( j % IT::size == 0UL ), "Invalid column access index" );
+      return op_.load( dm_.load(i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \return Iterator to the first non-zero element of row \a i.
+   */
+   inline ConstIterator begin( size_t i ) const {
+      return ConstIterator( dm_.begin(i), op_ );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \return Iterator just past the last non-zero element of row \a i.
+   */
+   inline ConstIterator end( size_t i ) const {
+      return ConstIterator( dm_.end(i), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const {
+      return dm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const {
+      return dm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return IsComputation<MT>::value && dm_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const {
+      return dm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return dm_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dm_;  //!< Dense matrix of the map expression.
+   OP      op_;  //!< The custom unary operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix map expression to a row-major dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // map expression to a row-major dense matrix. Due to the explicit application of
+   // the SFINAE principle, this operator can only be selected by the compiler in case
+   // the operand requires an intermediate evaluation.
+   */
+   template< typename MT2 >  // Type of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( DenseMatrix<MT2,false>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      assign   ( ~lhs, rhs.dm_ );
+      smpAssign( ~lhs, map( ~lhs, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix map expression to a column-major dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // map expression to a column-major dense matrix. Due to the explicit application of
+   // the SFINAE principle, this operator can only be selected by the compiler in case
+   // the operand requires an intermediate evaluation.
+   */
+   template< typename MT2 >  // Type of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( DenseMatrix<MT2,true>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      assign   ( ~lhs, rhs.dm_ );
+      smpAssign( ~lhs, map( ~lhs, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix map expression to a sparse matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // map expression to a sparse matrix. Due to the explicit application of the SFINAE
+   // principle, this operator can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target sparse matrix
+           , bool SO2 >    // Storage order or the target sparse matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( SparseMatrix<MT2,SO2>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef typename SelectType< SO == SO2, ResultType, OppositeType >::Type  TmpType;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( OppositeType, !SO );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT2, TmpType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename TmpType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix map expression to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense
+   // matrix map expression to a dense matrix. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      addAssign( DenseMatrix<MT2,SO2>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix map expression to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix map expression to a dense matrix. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      subAssign( DenseMatrix<MT2,SO2>& lhs, const DMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( ResultType, SO );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( MT, SO );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Elementwise evaluation of the given custom operation on each single element of the
+//        dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \param op The custom unary operation.
+// \return The custom operation applied to each single element of \a dm.
+//
+// The \a map() function evaluates the given custom operation on each element of the input
+// matrix \a dm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a map() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = map( A, blaze::Sqrt() );
+   \endcode
+
+// The custom operation has to provide a function call operator for the scalar operation, a
+// \a load() function for the according intrinsic operation, and a nested \a SIMDEnabled class
+// template that evaluates whether the intrinsic operation is available for a given data type
+// (see for instance the Sqrt functor).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the custom operation
+inline const DMatMapExpr<MT,OP,SO> map( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,OP,SO>( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the square root of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The square root of each single element of \a dm.
+//
+// The \a sqrt() function computes the square root of each element of the input matrix \a dm. The
+// function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sqrt() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = sqrt( A );
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Sqrt,SO> sqrt( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Sqrt,SO>( ~dm, Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the exponential of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The exponential of each single element of \a dm.
+//
+// The \a exp() function computes the exponential of each element of the input matrix \a dm. The
+// function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a exp() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = exp( A );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Exp,SO> exp( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Exp,SO>( ~dm, Exp() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the natural logarithm of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The natural logarithm of each single element of \a dm.
+//
+// The \a log() function computes the natural logarithm of each element of the input matrix \a dm.
+// The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a log() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = log( A );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Log,SO> log( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Log,SO>( ~dm, Log() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sine of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The sine of each single element of \a dm.
+//
+// The \a sin() function computes the sine of each element of the input matrix \a dm. The function
+// returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sin() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = sin( A );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Sin,SO> sin( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Sin,SO>( ~dm, Sin() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the cosine of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The cosine of each single element of \a dm.
+//
+// The \a cos() function computes the cosine of each element of the input matrix \a dm. The
+// function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a cos() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = cos( A );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Cos,SO> cos( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Cos,SO>( ~dm, Cos() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the hyperbolic tangent of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The hyperbolic tangent of each single element of \a dm.
+//
+// The \a tanh() function computes the hyperbolic tangent of each element of the input matrix
+// \a dm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a tanh() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = tanh( A );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Tanh,SO> tanh( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Tanh,SO>( ~dm, Tanh() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rectified linear unit of each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \return The rectified linear unit of each single element of \a dm.
+//
+// The \a relu() function computes the rectified linear unit \f$ max(0,x) \f$ of each element
+// of the input matrix \a dm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a relu() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = relu( A );
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DMatMapExpr<MT,Relu,SO> relu( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Relu,SO>( ~dm, Relu() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the exponential value for each single element of the dense matrix \a dm.
+// \ingroup dense_matrix
+//
+// \param dm The input matrix.
+// \param exp The exponent.
+// \return Each single element of \a dm raised to the power of \a exp.
+//
+// The \a pow() function computes the exponential value for each element of the input matrix \a dm.
+// The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a pow() function:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = pow( A, 4.2 );
+   \endcode
+
+// For single and double precision elements the computation is vectorized via a polynomial
+// approximation with a maximum error of a few ulp (see the according intrinsic functions).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename ST >  // Type of the exponent
+inline const typename EnableIf< IsNumeric<ST>, DMatMapExpr<MT,Pow<ST>,SO> >::Type
+   pow( const DenseMatrix<MT,SO>& dm, ST exp )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DMatMapExpr<MT,Pow<ST>,SO>( ~dm, Pow<ST>( exp ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO, bool AF >
+struct SubmatrixExprTrait< DMatMapExpr<MT,OP,SO>, AF >
+{
+ public:
+   //**********************************************************************************************
+   typedef DMatMapExpr< typename SubmatrixExprTrait<const MT,AF>::Type, OP, SO >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO >
+struct RowExprTrait< DMatMapExpr<MT,OP,SO> >
+{
+ public:
+   //**********************************************************************************************
+   typedef DVecMapExpr< typename RowExprTrait<const MT>::Type, OP, true >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO >
+struct ColumnExprTrait< DMatMapExpr<MT,OP,SO> >
+{
+ public:
+   //**********************************************************************************************
+   typedef DVecMapExpr< typename ColumnExprTrait<const MT>::Type, OP, false >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
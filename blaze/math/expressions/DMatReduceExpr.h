@@ -0,0 +1,1088 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatAbsExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sqr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/traits/CMathTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix reduction operations.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense matrix expression.
+   typedef typename RemoveReference< typename MT::CompositeType >::Type  CT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = CT::vectorizable &&
+                  OP::template SIMDEnabled< typename CT::ElementType >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the result type of a row-wise or column-wise dense matrix reduction.
+// \ingroup dense_matrix
+//
+// The row-wise reduction (\a rowwise) of a dense matrix results in a column vector with one
+// element per row, the column-wise reduction (\a columnwise) results in a row vector with one
+// element per column.
+*/
+template< typename MT  // Type of the dense matrix
+        , size_t RF >  // Reduction flag
+struct DMatPartialReduceTrait
+{
+   //**********************************************************************************************
+   typedef DynamicVector< typename MT::ElementType
+                        , ( RF == rowwise )?( columnVector ):( rowVector ) >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TOTAL REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default serial reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default serial reduction of all elements of a row-major dense
+// matrix. It is used for all operands and reduction operations that cannot be vectorized.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< DMatReduceExprHelper<MT,OP>, typename MT::ElementType >::Type
+   dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   ET redux( A(0UL,0UL) );
+
+   for( size_t j=1UL; j<N; ++j ) {
+      redux = op( redux, ET( A(0UL,j) ) );
+   }
+
+   for( size_t i=1UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         redux = op( redux, ET( A(i,j) ) );
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized serial reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the intrinsic optimized serial reduction of all elements of a
+// row-major dense matrix. The vectorizable part of all rows is processed by four independent
+// intrinsic accumulators, the remaining elements of each row are combined afterwards.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< DMatReduceExprHelper<MT,OP>, typename MT::ElementType >::Type
+   dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename IT::Type           IntrinsicType;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   const size_t jpos( N - N % IT::size );
+
+   ET redux;
+
+   if( jpos != 0UL )
+   {
+      IntrinsicType xmm1( A.load( 0UL, 0UL ) );
+
+      if( jpos >= IT::size*4UL )
+      {
+         IntrinsicType xmm2( A.load( 0UL, IT::size     ) );
+         IntrinsicType xmm3( A.load( 0UL, IT::size*2UL ) );
+         IntrinsicType xmm4( A.load( 0UL, IT::size*3UL ) );
+
+         for( size_t i=0UL; i<M; ++i )
+         {
+            size_t j( ( i == 0UL )?( IT::size*4UL ):( 0UL ) );
+
+            for( ; ( j + IT::size*3UL ) < jpos; j+=IT::size*4UL ) {
+               xmm1 = op.load( xmm1, A.load( i, j              ) );
+               xmm2 = op.load( xmm2, A.load( i, j+IT::size     ) );
+               xmm3 = op.load( xmm3, A.load( i, j+IT::size*2UL ) );
+               xmm4 = op.load( xmm4, A.load( i, j+IT::size*3UL ) );
+            }
+            for( ; j<jpos; j+=IT::size ) {
+               xmm1 = op.load( xmm1, A.load( i, j ) );
+            }
+         }
+
+         xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+      }
+      else
+      {
+         for( size_t i=0UL; i<M; ++i ) {
+            for( size_t j=( ( i == 0UL )?( size_t( IT::size ) ):( 0UL ) ); j<jpos; j+=IT::size ) {
+               xmm1 = op.load( xmm1, A.load( i, j ) );
+            }
+         }
+      }
+
+      ET buffer[IT::size];
+      storeu( buffer, xmm1 );
+
+      redux = buffer[0UL];
+      for( size_t k=1UL; k<IT::size; ++k ) {
+         redux = op( redux, buffer[k] );
+      }
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jpos; j<N; ++j ) {
+            redux = op( redux, ET( A(i,j) ) );
+         }
+      }
+   }
+   else
+   {
+      redux = A(0UL,0UL);
+
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, ET( A(0UL,j) ) );
+      }
+
+      for( size_t i=1UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, ET( A(i,j) ) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial reduction of the given column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of all elements of a column-major dense matrix
+// by means of the reduction of the according row-major transpose matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename MT::ElementType dmatreduce( const DenseMatrix<MT,true>& dm, OP op )
+{
+   return dmatreduce( trans( ~dm ), op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARTIAL REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default serial row-wise reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param y The target vector for the reduction results (one element per row).
+// \param op The reduction operation.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< DMatReduceExprHelper<MT,OP> >::Type
+   dmatreduceRowwise( const DenseMatrix<MT,false>& dm, VT& y, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == M, "Invalid vector size" );
+
+   if( N == 0UL ) return;
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      ET redux( A(i,0UL) );
+
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, ET( A(i,j) ) );
+      }
+
+      y[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized serial row-wise reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param y The target vector for the reduction results (one element per row).
+// \param op The reduction operation.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< DMatReduceExprHelper<MT,OP> >::Type
+   dmatreduceRowwise( const DenseMatrix<MT,false>& dm, VT& y, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename IT::Type           IntrinsicType;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == M, "Invalid vector size" );
+
+   if( N == 0UL ) return;
+
+   const size_t jpos( N - N % IT::size );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      ET redux;
+      size_t j( 0UL );
+
+      if( jpos != 0UL )
+      {
+         IntrinsicType xmm1( A.load( i, 0UL ) );
+         j = IT::size;
+
+         if( jpos >= IT::size*4UL )
+         {
+            IntrinsicType xmm2( A.load( i, IT::size     ) );
+            IntrinsicType xmm3( A.load( i, IT::size*2UL ) );
+            IntrinsicType xmm4( A.load( i, IT::size*3UL ) );
+
+            for( j=IT::size*4UL; ( j + IT::size*3UL ) < jpos; j+=IT::size*4UL ) {
+               xmm1 = op.load( xmm1, A.load( i, j              ) );
+               xmm2 = op.load( xmm2, A.load( i, j+IT::size     ) );
+               xmm3 = op.load( xmm3, A.load( i, j+IT::size*2UL ) );
+               xmm4 = op.load( xmm4, A.load( i, j+IT::size*3UL ) );
+            }
+
+            xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+         }
+
+         for( ; j<jpos; j+=IT::size ) {
+            xmm1 = op.load( xmm1, A.load( i, j ) );
+         }
+
+         ET buffer[IT::size];
+         storeu( buffer, xmm1 );
+
+         redux = buffer[0UL];
+         for( size_t k=1UL; k<IT::size; ++k ) {
+            redux = op( redux, buffer[k] );
+         }
+      }
+      else {
+         redux = A(i,0UL);
+         j = 1UL;
+      }
+
+      for( ; j<N; ++j ) {
+         redux = op( redux, ET( A(i,j) ) );
+      }
+
+      y[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default serial column-wise reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param y The target vector for the reduction results (one element per column).
+// \param op The reduction operation.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< DMatReduceExprHelper<MT,OP> >::Type
+   dmatreduceColumnwise( const DenseMatrix<MT,false>& dm, VT& y, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == N, "Invalid vector size" );
+
+   if( M == 0UL ) return;
+
+   for( size_t j=0UL; j<N; ++j ) {
+      y[j] = A(0UL,j);
+   }
+
+   for( size_t i=1UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         y[j] = op( y[j], ET( A(i,j) ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized serial column-wise reduction of the given row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix.
+// \param y The target vector for the reduction results (one element per column).
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces the columns of a row-major dense matrix by combining whole rows: each
+// block of four intrinsic vectors of the result is kept in registers while the according part
+// of all rows is traversed.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< DMatReduceExprHelper<MT,OP> >::Type
+   dmatreduceColumnwise( const DenseMatrix<MT,false>& dm, VT& y, OP op )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename IT::Type           IntrinsicType;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   const size_t M( A.rows()    );
+   const size_t N( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( y.size() == N, "Invalid vector size" );
+
+   if( M == 0UL ) return;
+
+   const size_t jpos( N - N % IT::size );
+
+   size_t j( 0UL );
+
+   for( ; ( j + IT::size*3UL ) < jpos; j+=IT::size*4UL )
+   {
+      IntrinsicType xmm1( A.load( 0UL, j              ) );
+      IntrinsicType xmm2( A.load( 0UL, j+IT::size     ) );
+      IntrinsicType xmm3( A.load( 0UL, j+IT::size*2UL ) );
+      IntrinsicType xmm4( A.load( 0UL, j+IT::size*3UL ) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         xmm1 = op.load( xmm1, A.load( i, j              ) );
+         xmm2 = op.load( xmm2, A.load( i, j+IT::size     ) );
+         xmm3 = op.load( xmm3, A.load( i, j+IT::size*2UL ) );
+         xmm4 = op.load( xmm4, A.load( i, j+IT::size*3UL ) );
+      }
+
+      y.store( j             , xmm1 );
+      y.store( j+IT::size    , xmm2 );
+      y.store( j+IT::size*2UL, xmm3 );
+      y.store( j+IT::size*3UL, xmm4 );
+   }
+
+   for( ; j<jpos; j+=IT::size )
+   {
+      IntrinsicType xmm1( A.load( 0UL, j ) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         xmm1 = op.load( xmm1, A.load( i, j ) );
+      }
+
+      y.store( j, xmm1 );
+   }
+
+   for( ; j<N; ++j )
+   {
+      ET redux( A(0UL,j) );
+
+      for( size_t i=1UL; i<M; ++i ) {
+         redux = op( redux, ET( A(i,j) ) );
+      }
+
+      y[j] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial row-wise reduction of the given column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param y The target vector for the reduction results (one element per row).
+// \param op The reduction operation.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduceRowwise( const DenseMatrix<MT,true>& dm, VT& y, OP op )
+{
+   dmatreduceColumnwise( trans( ~dm ), y, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial column-wise reduction of the given column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix.
+// \param y The target vector for the reduction results (one element per column).
+// \param op The reduction operation.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename VT    // Type of the target vector
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduceColumnwise( const DenseMatrix<MT,true>& dm, VT& y, OP op )
+{
+   dmatreduceRowwise( trans( ~dm ), y, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dense matrix reduction functions */
+//@{
+template< typename MT, bool SO, typename OP >
+inline const typename MT::ElementType reduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< size_t RF, typename MT, bool SO, typename OP >
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   reduce( const DenseMatrix<MT,SO>& dm, OP op );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm );
+
+template< size_t RF, typename MT, bool SO >
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   sum( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm );
+
+template< size_t RF, typename MT, bool SO >
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   prod( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm );
+
+template< size_t RF, typename MT, bool SO >
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   min( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm );
+
+template< size_t RF, typename MT, bool SO >
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   max( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType sqrNorm( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline typename CMathTrait<typename MT::ElementType>::Type l2Norm( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType l1Norm( const DenseMatrix<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline const typename MT::ElementType linfNorm( const DenseMatrix<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of the given reduction operation.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of the given
+// reduction operation \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+   const double totalsum = reduce( A, blaze::Add() );
+   \endcode
+
+// As in case of the reduction of dense vectors the reduction operation must be associative:
+// the reduction is vectorized (in case the operand and the operation can be vectorized) and
+// is executed in parallel (in case the operand is large enough and shared-memory
+// parallelization is enabled). In case the matrix has either 0 rows or 0 columns, the default
+// value of the element type is returned (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const typename MT::ElementType reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a row-wise or column-wise reduction of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \param op The reduction operation.
+// \return The vector of reduction results.
+//
+// This function reduces either the rows (\a rowwise) or the columns (\a columnwise) of the
+// given dense matrix \a dm by means of the given reduction operation \a op. The row-wise
+// reduction results in a column vector with one element per row, the column-wise reduction
+// results in a row vector with one element per column:
+
+   \code
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   typedef blaze::DynamicVector<double,blaze::columnVector>  ColumnVector;
+   typedef blaze::DynamicVector<double,blaze::rowVector>     RowVector;
+
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+   ColumnVector rowmax( blaze::reduce<rowwise>( A, blaze::Max() ) );
+   RowVector    colsum( blaze::reduce<columnwise>( A, blaze::Add() ) );
+   \endcode
+
+// Note that due to the explicitly specified reduction flag the function cannot be found via
+// argument dependent lookup, i.e. it has to be called with namespace qualification (or after
+// a corresponding using declaration).
+
+// Both reductions are vectorized independent of the storage order of the matrix: reductions
+// along the storage order of the matrix are vectorized within each row/column, reductions
+// across the storage order are vectorized over the elements of the result vector. In case the
+// matrix has 0 columns (row-wise) or 0 rows (column-wise), all elements of the resulting vector
+// are default values.
+*/
+template< size_t RF      // Reduction flag
+        , typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT( RF == rowwise || RF == columnwise );
+
+   typedef typename MT::ElementType                      ET;
+   typedef typename DMatPartialReduceTrait<MT,RF>::Type  RT;
+
+   const size_t n( ( RF == rowwise )?( (~dm).rows() ):( (~dm).columns() ) );
+
+   RT y( n, ET() );
+
+   if( RF == rowwise )
+      dmatreduceRowwise( ~dm, y, op );
+   else
+      dmatreduceColumnwise( ~dm, y, op );
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sum of all elements of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The sum of all matrix elements.
+//
+// In case the matrix has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-wise or column-wise sum of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of row sums (\a rowwise) or column sums (\a columnwise).
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of all elements of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The product of all matrix elements.
+//
+// In case the matrix has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row-wise or column-wise product of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of row products (\a rowwise) or column products (\a columnwise).
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of row minima (\a rowwise) or column minima (\a columnwise).
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest dense matrix element.
+//
+// This function returns the largest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The vector of row maxima (\a rowwise) or column maxima (\a columnwise).
+*/
+template< size_t RF    // Reduction flag
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename DMatPartialReduceTrait<MT,RF>::Type
+   max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared Frobenius norm of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The sum of the squares of all matrix elements.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// sqrNorm() function results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType sqrNorm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   return sum( map( ~dm, Sqr() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Frobenius norm of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The Frobenius norm of the dense matrix.
+//
+// This function computes the Frobenius norm \f$ \sqrt{\sum_{ij} a_{ij}^2} \f$ of the given dense
+// matrix, i.e. the L2 norm of all matrix elements. The return type is the according floating
+// point type of the element type (see the CMathTrait class template).
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l2Norm() function results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename CMathTrait<typename MT::ElementType>::Type l2Norm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename MT::ElementType          ET;
+   typedef typename MT::CompositeType        CT;
+   typedef typename CMathTrait<ET>::Type  NormType;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   if( IsSame<ET,NormType>::value )
+      return std::sqrt( NormType( sqrNorm( ~dm ) ) );
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   NormType sum( 0 );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         const NormType value( A(i,j) );
+         sum += value * value;
+      }
+   }
+   return std::sqrt( sum );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm of all elements of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The sum of the absolute values of all matrix elements.
+//
+// This function computes the element-wise L1 norm \f$ \sum_{ij} |a_{ij}| \f$ of the given dense
+// matrix. The absolute values are computed on the fly, i.e. no temporary matrix is created.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType l1Norm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( abs( ~dm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm of all elements of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest absolute value of all matrix elements.
+//
+// This function computes the element-wise maximum norm \f$ \max_{ij} |a_{ij}| \f$ of the given
+// dense matrix. The absolute values are computed on the fly, i.e. no temporary matrix is
+// created.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const typename MT::ElementType linfNorm( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return max( abs( ~dm ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
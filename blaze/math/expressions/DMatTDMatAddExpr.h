@@ -54,6 +54,7 @@
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/RowExprTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -310,6 +311,10 @@ class DMatTDMatAddExpr : public DenseMatrix< DMatTDMatAddExpr<MT1,MT2>, false >
       else if( !IsExpression<MT2>::value && (~lhs).isAliased( &rhs.rhs_ ) ) {
          smpAddAssign( ~lhs, rhs.lhs_ );
       }
+      else if( IsComputation<MT1>::value && IsComputation<MT2>::value &&
+               canSMPAssignConcurrently( rhs.lhs_, rhs.rhs_ ) ) {
+         smpAssignSum( ~lhs, rhs.lhs_, rhs.rhs_ );
+      }
       else {
          smpAssign   ( ~lhs, rhs.lhs_ );
          smpAddAssign( ~lhs, rhs.rhs_ );
@@ -54,6 +54,7 @@
 #include <blaze/math/traits/SubExprTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsTemporary.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -307,6 +308,10 @@ class DMatTDMatSubExpr : public DenseMatrix< DMatTDMatSubExpr<MT1,MT2>, false >
       else if( !IsExpression<MT1>::value && (~lhs).isAliased( &rhs.lhs_ ) ) {
          smpSubAssign( ~lhs, rhs.rhs_ );
       }
+      else if( IsComputation<MT1>::value && IsComputation<MT2>::value &&
+               canSMPAssignConcurrently( rhs.lhs_, rhs.rhs_ ) ) {
+         smpAssignDifference( ~lhs, rhs.lhs_, rhs.rhs_ );
+      }
       else {
          smpAssign   ( ~lhs, rhs.lhs_ );
          smpSubAssign( ~lhs, rhs.rhs_ );
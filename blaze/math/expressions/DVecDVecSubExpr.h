@@ -558,6 +558,64 @@ class DVecDVecSubExpr : public DenseVector< DVecDVecSubExpr<VT1_,VT2_,TF>, TF >
    RightOperand rhs_;  //!< Right-hand side dense vector of the subtraction expression.
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target vector and both vector operands are suited for a vectorized evaluation
+       and at least one of the operands has a different element type than the result of the
+       subtraction, which can be converted in registers into the resulting element type (mixed
+       precision subtraction), the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T >
+   struct UseMixedPrecisionKernel {
+      enum { value = !useAssign && T::vectorizable && VT1_::vectorizable && VT2_::vectorizable &&
+                     IsSame<typename T::ElementType,ElementType>::value &&
+                     ( IsSame<ET1,ElementType>::value ||
+                       IntrinsicConversionTrait<ET1,ElementType>::value ) &&
+                     ( IsSame<ET2,ElementType>::value ||
+                       IntrinsicConversionTrait<ET2,ElementType>::value ) &&
+                     !( IsSame<ET1,ElementType>::value && IsSame<ET2,ElementType>::value ) &&
+                     IntrinsicTrait<ElementType>::addition &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Number of intrinsic vectors per block of the mixed precision kernels.
+   enum { mixedRatio = ( int( IntrinsicConversionTrait<ET1,ElementType>::ratio ) >
+                         int( IntrinsicConversionTrait<ET2,ElementType>::ratio ) )
+                       ?( int( IntrinsicConversionTrait<ET1,ElementType>::ratio ) )
+                       :( int( IntrinsicConversionTrait<ET2,ElementType>::ratio ) ) };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Converted load function*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Loads a block of elements of a vector operand in the resulting element type.
+   //
+   // \param v The dense vector operand.
+   // \param index Access index of the first element of the block.
+   // \param xmm The resulting intrinsic vectors.
+   // \return void
+   //
+   // This function loads \a mixedRatio intrinsic vectors of the resulting element type starting
+   // at the given index. The elements of the operand are loaded in their storage precision and
+   // converted in registers.
+   */
+   template< typename VT >  // Type of the dense vector operand
+   static inline void loadConverted( const VT& v, size_t index, IntrinsicType* xmm )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename VT::ElementType,ElementType>  CT;
+
+      for( size_t k=0UL; k<size_t( mixedRatio ); k+=CT::ratio ) {
+         convert( v.load( index+k*IT::size ), xmm+k );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense vector-dense vector subtraction to a dense vector.
@@ -583,6 +641,10 @@ class DVecDVecSubExpr : public DenseVector< DVecDVecSubExpr<VT1_,VT2_,TF>, TF >
       if( !IsComputation<VT1_>::value && (~lhs).isAliased( &rhs.lhs_ ) ) {
          smpSubAssign( ~lhs, rhs.rhs_ );
       }
+      else if( IsComputation<VT1_>::value && IsComputation<VT2_>::value &&
+               canSMPAssignConcurrently( rhs.lhs_, rhs.rhs_ ) ) {
+         smpAssignDifference( ~lhs, rhs.lhs_, rhs.rhs_ );
+      }
       else {
          smpAssign   ( ~lhs, rhs.lhs_ );
          smpSubAssign( ~lhs, rhs.rhs_ );
@@ -723,6 +785,135 @@ class DVecDVecSubExpr : public DenseVector< DVecDVecSubExpr<VT1_,VT2_,TF>, TF >
    // No special implementation for the multiplication assignment to sparse vectors.
    //**********************************************************************************************
 
+   //**Mixed precision assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision assignment of a dense vector-dense vector subtraction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side subtraction expression to be assigned.
+   // \return void
+   //
+   // This function implements the vectorized assignment of a dense vector-dense vector
+   // subtraction expression in case the operands are stored with a lower precision than the result
+   // (as for instance a single precision and a double precision vector). The elements of the
+   // operands are loaded in their storage precision and converted in registers.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline typename EnableIf< UseMixedPrecisionKernel<VT> >::Type
+      assign( DenseVector<VT,TF>& lhs, const DVecDVecSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N( rhs.size() );
+      const size_t iend( N - N % ( IT::size*mixedRatio ) );
+
+      for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+         IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+         loadConverted( rhs.lhs_, i, xmm1 );
+         loadConverted( rhs.rhs_, i, xmm2 );
+         for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+            (~lhs).store( i+k*IT::size, xmm1[k] - xmm2[k] );
+         }
+      }
+      for( size_t i=iend; i<N; ++i ) {
+         (~lhs)[i] = rhs.lhs_[i] - rhs.rhs_[i];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mixed precision addition assignment to dense vectors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision addition assignment of a dense vector-dense vector subtraction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side subtraction expression to be added.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment of a dense vector-dense vector
+   // subtraction expression in case the operands are stored with a lower precision than the result
+   // (as for instance a single precision and a double precision vector). The elements of the
+   // operands are loaded in their storage precision and converted in registers.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline typename EnableIf< UseMixedPrecisionKernel<VT> >::Type
+      addAssign( DenseVector<VT,TF>& lhs, const DVecDVecSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N( rhs.size() );
+      const size_t iend( N - N % ( IT::size*mixedRatio ) );
+
+      for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+         IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+         loadConverted( rhs.lhs_, i, xmm1 );
+         loadConverted( rhs.rhs_, i, xmm2 );
+         for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+            (~lhs).store( i+k*IT::size, (~lhs).load(i+k*IT::size) + ( xmm1[k] - xmm2[k] ) );
+         }
+      }
+      for( size_t i=iend; i<N; ++i ) {
+         (~lhs)[i] += rhs.lhs_[i] - rhs.rhs_[i];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mixed precision subtraction assignment to dense vectors*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision subtraction assignment of a dense vector-dense vector subtraction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side subtraction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment of a dense vector-dense vector
+   // subtraction expression in case the operands are stored with a lower precision than the result
+   // (as for instance a single precision and a double precision vector). The elements of the
+   // operands are loaded in their storage precision and converted in registers.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline typename EnableIf< UseMixedPrecisionKernel<VT> >::Type
+      subAssign( DenseVector<VT,TF>& lhs, const DVecDVecSubExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N( rhs.size() );
+      const size_t iend( N - N % ( IT::size*mixedRatio ) );
+
+      for( size_t i=0UL; i<iend; i+=IT::size*mixedRatio ) {
+         IntrinsicType xmm1[mixedRatio], xmm2[mixedRatio];
+         loadConverted( rhs.lhs_, i, xmm1 );
+         loadConverted( rhs.rhs_, i, xmm2 );
+         for( size_t k=0UL; k<size_t( mixedRatio ); ++k ) {
+            (~lhs).store( i+k*IT::size, (~lhs).load(i+k*IT::size) - ( xmm1[k] - xmm2[k] ) );
+         }
+      }
+      for( size_t i=iend; i<N; ++i ) {
+         (~lhs)[i] -= rhs.lhs_[i] - rhs.rhs_[i];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT1_ );
@@ -0,0 +1,668 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecReduceExpr.h
+//  \brief Header file for the dense vector reduction operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecAbsExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Sqr.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/traits/CMathTrait.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction operations.
+// \ingroup dense_vector
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   typedef typename RemoveReference< typename VT::CompositeType >::Type  CT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = CT::vectorizable &&
+                  OP::template SIMDEnabled< typename CT::ElementType >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default serial reduction of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default serial reduction of a dense vector. It is used for all
+// operands and reduction operations that cannot be vectorized.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF      // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename DisableIf< DVecReduceExprHelper<VT,OP>, typename VT::ElementType >::Type
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   const size_t N( tmp.size() );
+
+   if( N == 0UL ) return ET();
+
+   ET redux( tmp[0UL] );
+
+   for( size_t i=1UL; i<N; ++i ) {
+      redux = op( redux, ET( tmp[i] ) );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized serial reduction of the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the intrinsic optimized serial reduction of a dense vector. The
+// vector is processed by four independent intrinsic accumulators in order to hide the latency
+// of the reduction operation. Expression operands are evaluated element-wise on the fly, i.e.
+// the reduction of an expression (as for instance the sum of \f$ \vec{a}*\vec{b} \f$) does not
+// create a temporary vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF      // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIf< DVecReduceExprHelper<VT,OP>, typename VT::ElementType >::Type
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+   typedef IntrinsicTrait<ET>          IT;
+   typedef typename IT::Type           IntrinsicType;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   const size_t N( tmp.size() );
+
+   if( N == 0UL ) return ET();
+
+   const size_t ipos( N - N % IT::size );
+
+   ET redux;
+   size_t i( 0UL );
+
+   if( ipos != 0UL )
+   {
+      IntrinsicType xmm1( tmp.load( 0UL ) );
+      i = IT::size;
+
+      if( ipos >= IT::size*4UL )
+      {
+         IntrinsicType xmm2( tmp.load( IT::size     ) );
+         IntrinsicType xmm3( tmp.load( IT::size*2UL ) );
+         IntrinsicType xmm4( tmp.load( IT::size*3UL ) );
+
+         for( i=IT::size*4UL; ( i + IT::size*3UL ) < ipos; i+=IT::size*4UL ) {
+            xmm1 = op.load( xmm1, tmp.load( i             ) );
+            xmm2 = op.load( xmm2, tmp.load( i+IT::size    ) );
+            xmm3 = op.load( xmm3, tmp.load( i+IT::size*2UL ) );
+            xmm4 = op.load( xmm4, tmp.load( i+IT::size*3UL ) );
+         }
+
+         xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+      }
+
+      for( ; i<ipos; i+=IT::size ) {
+         xmm1 = op.load( xmm1, tmp.load( i ) );
+      }
+
+      ET buffer[IT::size];
+      storeu( buffer, xmm1 );
+
+      redux = buffer[0UL];
+      for( size_t k=1UL; k<IT::size; ++k ) {
+         redux = op( redux, buffer[k] );
+      }
+   }
+   else {
+      redux = tmp[0UL];
+      i = 1UL;
+   }
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, ET( tmp[i] ) );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Dense vector reduction functions */
+//@{
+template< typename VT, bool TF, typename OP >
+inline const typename VT::ElementType reduce( const DenseVector<VT,TF>& dv, OP op );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType sum( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType prod( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType min( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType max( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+size_t argmin( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+size_t argmax( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType sqrNorm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline typename CMathTrait<typename VT::ElementType>::Type l2Norm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType l1Norm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+inline const typename VT::ElementType linfNorm( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF, typename ST >
+typename VT::ElementType lpNorm( const DenseVector<VT,TF>& dv, ST p );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of the given reduction operation.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double totalsum = reduce( a, blaze::Add() );
+   const double totalmin = reduce( a, blaze::Min() );
+   \endcode
+
+// The reduction operation must be associative since the elements are combined in an unspecified
+// order: the reduction is vectorized by means of several independent intrinsic accumulators
+// (in case the operand and the operation can be vectorized) and is executed in parallel (in
+// case the operand is large enough and shared-memory parallelization is enabled). In case the
+// given vector is an expression, its elements are computed on the fly instead of creating a
+// temporary vector. In case the vector has a size of 0, the default value of the element type
+// is returned (e.g. 0 in case of fundamental data types).
+//
+// Custom reduction operations have to provide the same interface as the built-in operations
+// (see for instance the Add functor): the function call operator combines two scalar values,
+// the \a load() function combines two intrinsic vectors and the nested \a SIMDEnabled class
+// template indicates whether the \a load() function is available for a given element type.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline const typename VT::ElementType reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return smpReduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sum of all elements of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of all vector elements.
+//
+// This function computes the sum of all elements of the given dense vector. The function is
+// also evaluated efficiently for expressions (as for instance the sum of the element-wise
+// product \f$ \vec{a}*\vec{b} \f$), which are computed on the fly without temporary:
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+   const double s = sum( a * b );
+   \endcode
+
+// In case the vector has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of all elements of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The product of all vector elements.
+//
+// This function computes the product of all elements of the given dense vector. In case the
+// vector has a size of 0, the returned value is the default value (e.g. 0 in case of fundamental
+// data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType prod( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The smallest dense vector element.
+//
+// This function returns the smallest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest dense vector element.
+//
+// This function returns the largest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the first smallest dense vector element.
+//
+// This function returns the index of the first occurrence of the smallest element of the given
+// dense vector. The smallest element is determined by the vectorized min() function, its index
+// by a subsequent search that stops at the first match. In case the vector currently has a size
+// of 0, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+size_t argmin( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   if( tmp.size() == 0UL ) return 0UL;
+
+   const ET minimum( min( tmp ) );
+
+   for( size_t i=0UL; i<tmp.size(); ++i ) {
+      if( tmp[i] == minimum ) return i;
+   }
+
+   // The vector contains not-a-number elements
+   size_t index( 0UL );
+   for( size_t i=1UL; i<tmp.size(); ++i ) {
+      if( tmp[i] < tmp[index] ) index = i;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The index of the first largest dense vector element.
+//
+// This function returns the index of the first occurrence of the largest element of the given
+// dense vector. The largest element is determined by the vectorized max() function, its index
+// by a subsequent search that stops at the first match. In case the vector currently has a size
+// of 0, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+size_t argmax( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   if( tmp.size() == 0UL ) return 0UL;
+
+   const ET maximum( max( tmp ) );
+
+   for( size_t i=0UL; i<tmp.size(); ++i ) {
+      if( tmp[i] == maximum ) return i;
+   }
+
+   // The vector contains not-a-number elements
+   size_t index( 0UL );
+   for( size_t i=1UL; i<tmp.size(); ++i ) {
+      if( tmp[index] < tmp[i] ) index = i;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of the squares of all vector elements.
+//
+// This function computes the squared L2 norm \f$ \sum_i a_i^2 \f$ of the given dense vector.
+// The squares are computed on the fly, i.e. no temporary vector is created.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// sqrNorm() function results in a compile time error!
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType sqrNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename VT::ElementType );
+
+   return sum( map( ~dv, Sqr() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The L2 norm of the dense vector.
+//
+// This function computes the L2 norm (i.e. the Euclidean length) \f$ \sqrt{\sum_i a_i^2} \f$
+// of the given dense vector. The return type is the according floating point type of the
+// element type (see the CMathTrait class template). In case the element type differs from the
+// return type (as for instance for integral element types), the squares are accumulated in
+// the return type in order to avoid overflows.
+//
+// \b Note: This operation is only defined for numeric data types. In case the element type is
+// not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
+// l2Norm() function results in a compile time error!
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename CMathTrait<typename VT::ElementType>::Type l2Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType          ET;
+   typedef typename VT::CompositeType        CT;
+   typedef typename CMathTrait<ET>::Type  NormType;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   if( IsSame<ET,NormType>::value )
+      return std::sqrt( NormType( sqrNorm( ~dv ) ) );
+
+   CT tmp( ~dv );  // Evaluation of the dense vector operand
+
+   NormType sum( 0 );
+   for( size_t i=0UL; i<tmp.size(); ++i ) {
+      const NormType value( tmp[i] );
+      sum += value * value;
+   }
+   return std::sqrt( sum );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of the absolute values of all vector elements.
+//
+// This function computes the L1 norm \f$ \sum_i |a_i| \f$ of the given dense vector. The
+// absolute values are computed on the fly, i.e. no temporary vector is created.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType l1Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sum( abs( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the maximum norm of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest absolute value of all vector elements.
+//
+// This function computes the maximum norm (L-infinity norm) \f$ \max_i |a_i| \f$ of the given
+// dense vector. The absolute values are computed on the fly, i.e. no temporary vector is
+// created. In case the vector currently has a size of 0, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline const typename VT::ElementType linfNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return max( abs( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Lp norm of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \param p The order of the norm (must be positive).
+// \return The Lp norm of the dense vector.
+// \exception std::invalid_argument Invalid norm order.
+//
+// This function computes the Lp norm \f$ (\sum_i |a_i|^p)^{1/p} \f$ of the given dense vector.
+// For \f$ p=1 \f$ and \f$ p=2 \f$ the function is identical to the l1Norm() and l2Norm()
+// functions, respectively. In case the given order \a p is not positive, a
+// \a std::invalid_argument exception is thrown.
+//
+// \b Note: This operation is only defined for floating point data types. In case the element
+// type is not a floating point data type the attempt to use the lpNorm() function results in
+// a compile time error!
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename ST >  // Type of the norm order
+typename VT::ElementType lpNorm( const DenseVector<VT,TF>& dv, ST p )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( !( p > ST(0) ) )
+      throw std::invalid_argument( "Invalid norm order" );
+
+   if( p == ST(1) ) return l1Norm( ~dv );
+   if( p == ST(2) ) return l2Norm( ~dv );
+
+   using std::pow;
+
+   return pow( sum( pow( abs( ~dv ), ET(p) ) ), ET(1) / ET(p) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
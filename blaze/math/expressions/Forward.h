@@ -52,6 +52,7 @@ template< typename, typename > class DMatDMatMultExpr;
 template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
+template< typename, typename, bool > class DMatMapExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, typename, bool > class DMatSMatAddExpr;
@@ -72,6 +73,7 @@ template< typename, typename > class DVecDVecCrossExpr;
 template< typename, typename, bool > class DVecDVecMultExpr;
 template< typename, typename, bool > class DVecDVecSubExpr;
 template< typename, bool > class DVecEvalExpr;
+template< typename, typename, bool > class DVecMapExpr;
 template< typename, typename, bool > class DVecScalarDivExpr;
 template< typename, typename, bool > class DVecScalarMultExpr;
 template< typename, typename, bool > class DVecSVecAddExpr;
@@ -83,11 +85,14 @@ template< typename, bool > class DVecTransExpr;
 template< typename, bool > class DVecTransposer;
 template< typename, typename > class DVecTSVecMultExpr;
 template< typename, bool > struct Matrix;
+template< typename, typename > class PMatDMatMultExpr;
+template< typename, typename > class PMatDVecMultExpr;
 template< typename, bool > class SMatAbsExpr;
 template< typename, typename > class SMatDMatMultExpr;
 template< typename, typename, bool > class SMatDMatSubExpr;
 template< typename, typename > class SMatDVecMultExpr;
 template< typename, bool > class SMatEvalExpr;
+template< typename, typename, bool > class SMatMapExpr;
 template< typename, typename, bool > class SMatScalarDivExpr;
 template< typename, typename, bool > class SMatScalarMultExpr;
 template< typename, typename > class SMatSMatAddExpr;
@@ -108,6 +113,7 @@ template< typename, typename > class SVecDVecCrossExpr;
 template< typename, typename, bool > class SVecDVecMultExpr;
 template< typename, typename, bool > class SVecDVecSubExpr;
 template< typename, bool > class SVecEvalExpr;
+template< typename, typename, bool > class SVecMapExpr;
 template< typename, typename, bool > class SVecScalarDivExpr;
 template< typename, typename, bool > class SVecScalarMultExpr;
 template< typename, typename, bool > class SVecSVecAddExpr;
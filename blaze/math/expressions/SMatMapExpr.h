@@ -0,0 +1,868 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatMapExpr.h
+//  \brief Header file for the sparse matrix map expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATMAPEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMapExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SVecMapExpr.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnExprTrait.h>
+#include <blaze/math/traits/RowExprTrait.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SMATMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the sparse matrix map() function.
+// \ingroup sparse_matrix_expression
+//
+// The SMatMapExpr class represents the compile time expression for the element-wise application
+// of a unary custom operation to a sparse matrix via the map() function (as for instance the
+// sqrt(), exp() or sin() function).
+*/
+template< typename MT  // Type of the sparse matrix
+        , typename OP  // Type of the custom operation
+        , bool SO >    // Storage order
+class SMatMapExpr : public SparseMatrix< SMatMapExpr<MT,OP,SO>, SO >
+                  , private MatMapExpr
+                  , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ResultType     RT;  //!< Result type of the sparse matrix expression.
+   typedef typename MT::CompositeType  CT;  //!< Composite type of the sparse matrix expression.
+   //**********************************************************************************************
+
+   //**Evaluation strategy*************************************************************************
+   //! Compilation switch for the evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the evaluation strategy of the map expression. In case the given sparse matrix
+       expression of type \a MT requires an intermediate evaluation, \a useAssign will be set
+       to 1 and the map expression will be evaluated via the \a assign function family.
+       Otherwise \a useAssign will be set to 0 and the expression will be evaluated via the
+       subscript operator. */
+   enum { useAssign = RequiresEvaluation<MT>::value };
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct UseAssign {
+      enum { value = useAssign };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SMatMapExpr<MT,OP,SO>       This;           //!< Type of this SMatMapExpr instance.
+   typedef typename MT::ResultType     ResultType;     //!< Result type for expression template evaluations.
+   typedef typename MT::OppositeType   OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef typename MT::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename MT::ElementType    ElementType;    //!< Resulting element type.
+   typedef const ElementType           ReturnType;     //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   typedef typename SelectType< useAssign, const ResultType, const SMatMapExpr& >::Type  CompositeType;
+
+   //! Composite data type of the sparse matrix expression.
+   typedef typename SelectType< IsExpression<MT>::value, const MT, const MT& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the sparse matrix map expression.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sparse matrix expression.
+      typedef ValueIndexPair<ElementType>  Element;
+
+      //! Iterator type of the sparse matrix expression.
+      typedef typename RemoveReference<Operand>::Type::ConstIterator  IteratorType;
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying pointers.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying pointers.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param it Iterator over the elements of the sparse matrix expression.
+      // \param op The custom unary operation.
+      */
+      inline ConstIterator( IteratorType it, OP op )
+         : it_( it )  // Iterator over the elements of the sparse matrix expression
+         , op_( op )  // The custom unary operation
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented expression iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++it_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( op_( it_->value() ), it_->index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return op_( it_->value() );
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return it_->index();
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return it_ == rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return it_ != rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two expression iterators.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return The number of elements between the two expression iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return it_ - rhs.it_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      IteratorType it_;  //!< Iterator over the elements of the sparse matrix expression.
+      OP           op_;  //!< The custom unary operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatMapExpr class.
+   //
+   // \param sm The sparse matrix operand of the map expression.
+   // \param op The custom unary operation.
+   */
+   explicit inline SMatMapExpr( const MT& sm, OP op )
+      : sm_( sm )  // Sparse matrix of the map expression
+      , op_( op )  // The custom unary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < sm_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < sm_.columns(), "Invalid column access index" );
+      return op_( sm_(i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \return Iterator to the first non-zero element of row \a i.
+   */
+   inline ConstIterator begin( size_t i ) const {
+      return ConstIterator( sm_.begin(i), op_ );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of row \a i.
+   //
+   // \param i The row index.
+   // \return Iterator just past the last non-zero element of row \a i.
+   */
+   inline ConstIterator end( size_t i ) const {
+      return ConstIterator( sm_.end(i), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const {
+      return sm_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const {
+      return sm_.columns();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse matrix.
+   //
+   // \return The number of non-zero elements in the sparse matrix.
+   */
+   inline size_t nonZeros() const {
+      return sm_.nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the specified row.
+   //
+   // \param i The index of the row.
+   // \return The number of non-zero elements of row \a i.
+   */
+   inline size_t nonZeros( size_t i ) const {
+      return sm_.nonZeros(i);
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline Operand operand() const {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return sm_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return sm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return sm_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand sm_;  //!< Sparse matrix of the map expression.
+   OP      op_;  //!< The custom unary operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix map expression to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix
+   // map expression to a dense matrix. Due to the explicit application of the SFINAE
+   // principle, this operator can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( DenseMatrix<MT2,SO2>& lhs, const SMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      assign   ( ~lhs, rhs.sm_ );
+      smpAssign( ~lhs, map( ~lhs, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to row-major sparse matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix map expression to a row-major sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix
+   // map expression to a row-major sparse matrix. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2 >  // Type of the target sparse matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( SparseMatrix<MT2,false>& lhs, const SMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename MT2::Iterator  Iterator;
+
+      assign( ~lhs, rhs.sm_ );
+
+      const size_t m( rhs.rows() );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         const Iterator end( (~lhs).end(i) );
+         for( Iterator element=(~lhs).begin(i); element!=end; ++element ) {
+            element->value() = rhs.op_( element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to column-major sparse matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix map expression to a column-major sparse matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix
+   // map expression to a column-major sparse matrix. Due to the explicit application of
+   // the SFINAE principle, this operator can only be selected by the compiler in case
+   // the operand requires an intermediate evaluation.
+   */
+   template< typename MT2 >  // Type of the target sparse matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      assign( SparseMatrix<MT2,true>& lhs, const SMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      typedef typename MT2::Iterator  Iterator;
+
+      assign( ~lhs, rhs.sm_ );
+
+      const size_t n( rhs.columns() );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         const Iterator end( (~lhs).end(j) );
+         for( Iterator element=(~lhs).begin(j); element!=end; ++element ) {
+            element->value() = rhs.op_( element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix map expression to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sparse
+   // matrix map expression to a dense matrix. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      addAssign( DenseMatrix<MT2,SO2>& lhs, const SMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix map expression to a dense matrix.
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse
+   // matrix map expression to a dense matrix. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target sparse matrix
+   friend inline typename EnableIf< UseAssign<MT2> >::Type
+      subAssign( DenseMatrix<MT2,SO2>& lhs, const SMatMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_WITH_STORAGE_ORDER( MT, SO );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Elementwise evaluation of the given custom operation on each single element of the
+//        sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \param op The custom unary operation.
+// \return The custom operation applied to each single element of \a sm.
+//
+// The \a map() function evaluates the given custom operation on each element of the input
+// matrix \a sm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a map() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = map( A, blaze::Sqrt() );
+   \endcode
+
+// The custom operation has to provide a function call operator for the scalar operation, a
+// \a load() function for the according intrinsic operation, and a nested \a SIMDEnabled class
+// template that evaluates whether the intrinsic operation is available for a given data type
+// (see for instance the Sqrt functor).
+//
+// Note that the custom operation is only applied to the non-zero elements of the sparse matrix.
+// Therefore the operation must map zero to zero.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the custom operation
+inline const SMatMapExpr<MT,OP,SO> map( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatMapExpr<MT,OP,SO>( ~sm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the square root of each single element of the sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \return The square root of each single element of \a sm.
+//
+// The \a sqrt() function computes the square root of each non-zero element of the input matrix
+// \a sm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sqrt() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = sqrt( A );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatMapExpr<MT,Sqrt,SO> sqrt( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatMapExpr<MT,Sqrt,SO>( ~sm, Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sine of each single element of the sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \return The sine of each single element of \a sm.
+//
+// The \a sin() function computes the sine of each non-zero element of the input matrix \a sm. The
+// function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sin() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = sin( A );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatMapExpr<MT,Sin,SO> sin( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatMapExpr<MT,Sin,SO>( ~sm, Sin() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the hyperbolic tangent of each single element of the sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \return The hyperbolic tangent of each single element of \a sm.
+//
+// The \a tanh() function computes the hyperbolic tangent of each non-zero element of the input
+// matrix \a sm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a tanh() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = tanh( A );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatMapExpr<MT,Tanh,SO> tanh( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatMapExpr<MT,Tanh,SO>( ~sm, Tanh() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rectified linear unit of each single element of the sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \return The rectified linear unit of each single element of \a sm.
+//
+// The \a relu() function computes the rectified linear unit \f$ max(0,x) \f$ of each non-zero
+// element of the input matrix \a sm. The function returns an expression representing this
+// operation.\n
+// The following example demonstrates the use of the \a relu() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = relu( A );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SMatMapExpr<MT,Relu,SO> relu( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SMatMapExpr<MT,Relu,SO>( ~sm, Relu() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the exponential value for each single element of the sparse matrix \a sm.
+// \ingroup sparse_matrix
+//
+// \param sm The input matrix.
+// \param exp The exponent.
+// \return Each single element of \a sm raised to the power of \a exp.
+// \exception std::invalid_argument Invalid exponent for sparse matrix.
+//
+// The \a pow() function computes the exponential value for each non-zero element of the input
+// matrix \a sm. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a pow() function:
+
+   \code
+   blaze::CompressedMatrix<double> A, B;
+   // ... Resizing and initialization
+   B = pow( A, 4.2 );
+   \endcode
+
+// Since the operation is only applied to the non-zero elements of the sparse matrix, the exponent
+// must be positive. In case \a exp is not positive, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename ST >  // Type of the exponent
+inline const typename EnableIf< IsNumeric<ST>, SMatMapExpr<MT,Pow<ST>,SO> >::Type
+   pow( const SparseMatrix<MT,SO>& sm, ST exp )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !( exp > ST(0) ) )
+      throw std::invalid_argument( "Invalid exponent for sparse matrix" );
+
+   return SMatMapExpr<MT,Pow<ST>,SO>( ~sm, Pow<ST>( exp ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO, bool AF >
+struct SubmatrixExprTrait< SMatMapExpr<MT,OP,SO>, AF >
+{
+ public:
+   //**********************************************************************************************
+   typedef SMatMapExpr< typename SubmatrixExprTrait<const MT,AF>::Type, OP, SO >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO >
+struct RowExprTrait< SMatMapExpr<MT,OP,SO> >
+{
+ public:
+   //**********************************************************************************************
+   typedef SVecMapExpr< typename RowExprTrait<const MT>::Type, OP, true >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename OP, bool SO >
+struct ColumnExprTrait< SMatMapExpr<MT,OP,SO> >
+{
+ public:
+   //**********************************************************************************************
+   typedef SVecMapExpr< typename ColumnExprTrait<const MT>::Type, OP, false >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
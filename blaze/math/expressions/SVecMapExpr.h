@@ -0,0 +1,793 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SVecMapExpr.h
+//  \brief Header file for the sparse vector map expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SVECMAPEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SVECMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/constraints/SparseVector.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/VecMapExpr.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SVECMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the sparse vector map() function.
+// \ingroup sparse_vector_expression
+//
+// The SVecMapExpr class represents the compile time expression for the element-wise application
+// of a unary custom operation to a sparse vector via the map() function (as for instance the
+// sqrt(), exp() or sin() function).
+*/
+template< typename VT  // Type of the sparse vector
+        , typename OP  // Type of the custom operation
+        , bool TF >    // Transpose flag
+class SVecMapExpr : public SparseVector< SVecMapExpr<VT,OP,TF>, TF >
+                  , private VecMapExpr
+                  , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename VT::ResultType     RT;  //!< Result type of the sparse vector expression.
+   typedef typename VT::CompositeType  CT;  //!< Composite type of the sparse vector expression.
+   typedef typename VT::TransposeType  TT;  //!< Transpose type of the sparse vector expression.
+   typedef typename VT::ElementType    ET;  //!< Element type of the sparse vector expression.
+   //**********************************************************************************************
+
+   //**Evaluation strategy*************************************************************************
+   //! Compilation switch for the evaluation strategy of the map expression.
+   /*! The \a useAssign compile time constant expression represents a compilation switch for
+       the evaluation strategy of the map expression. In case the given sparse vector
+       expression of type \a VT requires an intermediate evaluation, \a useAssign will be set
+       to 1 and the map expression will be evaluated via the \a assign function family.
+       Otherwise \a useAssign will be set to 0 and the expression will be evaluated via the
+       subscript operator. */
+   enum { useAssign = RequiresEvaluation<VT>::value };
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2_ >
+   struct UseAssign {
+      enum { value = useAssign };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SVecMapExpr<VT,OP,TF>  This;           //!< Type of this SVecMapExpr instance.
+   typedef RT                     ResultType;     //!< Result type for expression template evaluations.
+   typedef TT                     TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef ET                     ElementType;    //!< Resulting element type.
+   typedef const ElementType      ReturnType;     //!< Return type for expression template evaluations.
+
+   //! Data type for composite expression templates.
+   typedef typename SelectType< useAssign, const ResultType, const SVecMapExpr& >::Type  CompositeType;
+
+   //! Composite data type of the sparse vector expression.
+   typedef typename SelectType< IsExpression<VT>::value, const VT, const VT& >::Type  Operand;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = VT::smpAssignable };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the sparse vector map expression.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sparse vector expression.
+      typedef ValueIndexPair<ElementType>  Element;
+
+      //! Iterator type of the sparse vector expression.
+      typedef typename RemoveReference<Operand>::Type::ConstIterator  IteratorType;
+
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Element                    ValueType;         //!< Type of the underlying pointers.
+      typedef ValueType*                 PointerType;       //!< Pointer return type.
+      typedef ValueType&                 ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying pointers.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param it Iterator over the elements of the sparse vector expression.
+      // \param op The custom unary operation.
+      */
+      inline ConstIterator( IteratorType it, OP op )
+         : it_( it )  // Iterator over the elements of the sparse vector expression
+         , op_( op )  // The custom unary operation
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented expression iterator.
+      */
+      inline ConstIterator& operator++() {
+         ++it_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( op_( it_->value() ), it_->index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return Reference to the sparse vector element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline ReturnType value() const {
+         return op_( it_->value() );
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return it_->index();
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return it_ == rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return it_ != rhs.it_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two expression iterators.
+      //
+      // \param rhs The right-hand side expression iterator.
+      // \return The number of elements between the two expression iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return it_ - rhs.it_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      IteratorType it_;  //!< Iterator over the elements of the sparse vector expression.
+      OP           op_;  //!< The custom unary operation.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SVecMapExpr class.
+   //
+   // \param sv The sparse vector operand of the map expression.
+   // \param op The custom unary operation.
+   */
+   explicit inline SVecMapExpr( const VT& sv, OP op )
+      : sv_( sv )  // Sparse vector of the map expression
+      , op_( op )  // The custom unary operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < sv_.size(), "Invalid vector access index" );
+      return op_( sv_[index] );
+   }
+   //**********************************************************************************************
+
+   //**Begin function******************************************************************************
+   /*!\brief Returns an iterator to the first non-zero element of the sparse vector.
+   //
+   // \return Iterator to the first non-zero element of the sparse vector.
+   */
+   inline ConstIterator begin() const {
+      return ConstIterator( sv_.begin(), op_ );
+   }
+   //**********************************************************************************************
+
+   //**End function********************************************************************************
+   /*!\brief Returns an iterator just past the last non-zero element of the sparse vector.
+   //
+   // \return Iterator just past the last non-zero element of the sparse vector.
+   */
+   inline ConstIterator end() const {
+      return ConstIterator( sv_.end(), op_ );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const {
+      return sv_.size();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse vector.
+   //
+   // \return The number of non-zero elements in the sparse vector.
+   */
+   inline size_t nonZeros() const {
+      return sv_.nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse vector operand.
+   //
+   // \return The sparse vector operand.
+   */
+   inline Operand operand() const {
+      return sv_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline OP operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const {
+      return sv_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const {
+      return sv_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const {
+      return sv_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand sv_;  //!< Sparse vector of the map expression.
+   OP      op_;  //!< The custom unary operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse vector map expression to a dense vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse vector
+   // map expression to a dense vector. Due to the explicit application of the SFINAE
+   // principle, this operator can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename VT2_ >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT2_> >::Type
+      assign( DenseVector<VT2_,TF>& lhs, const SVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      assign   ( ~lhs, rhs.sv_ );
+      smpAssign( ~lhs, map( ~lhs, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse vector map expression to a sparse vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side map expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse vector
+   // map expression to a sparse vector. Due to the explicit application of the SFINAE
+   // principle, this operator can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename VT2_ >  // Type of the target sparse vector
+   friend inline typename EnableIf< UseAssign<VT2_> >::Type
+      assign( SparseVector<VT2_,TF>& lhs, const SVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      typedef typename VT2_::Iterator  Iterator;
+
+      assign( ~lhs, rhs.sv_ );
+
+      const Iterator end( (~lhs).end() );
+      for( Iterator element=(~lhs).begin(); element!=end; ++element ) {
+         element->value() = rhs.op_( element->value() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse vector map expression to a dense vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side map expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sparse
+   // vector map expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename VT2_ >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT2_> >::Type
+      addAssign( DenseVector<VT2_,TF>& lhs, const SVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse vector map expression to a dense vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side map expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse
+   // vector map expression to a dense vector. Due to the explicit application of the
+   // SFINAE principle, this operator can only be selected by the compiler in case the
+   // operand requires an intermediate evaluation.
+   */
+   template< typename VT2_ >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT2_> >::Type
+      subAssign( DenseVector<VT2_,TF>& lhs, const SVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a sparse vector map expression to a dense vector.
+   // \ingroup sparse_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side map expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a sparse
+   // vector map expression to a dense vector. Due to the explicit application of the SFINAE
+   // principle, this operator can only be selected by the compiler in case the operand
+   // requires an intermediate evaluation.
+   */
+   template< typename VT2_ >  // Type of the target dense vector
+   friend inline typename EnableIf< UseAssign<VT2_> >::Type
+      multAssign( DenseVector<VT2_,TF>& lhs, const SVecMapExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( typename ResultType::CompositeType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Elementwise evaluation of the given custom operation on each single element of the
+//        sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \param op The custom unary operation.
+// \return The custom operation applied to each single element of \a sv.
+//
+// The \a map() function evaluates the given custom operation on each element of the input
+// vector \a sv. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a map() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = map( a, blaze::Sqrt() );
+   \endcode
+
+// The custom operation has to provide a function call operator for the scalar operation, a
+// \a load() function for the according intrinsic operation, and a nested \a SIMDEnabled class
+// template that evaluates whether the intrinsic operation is available for a given data type
+// (see for instance the Sqrt functor).
+//
+// Note that the custom operation is only applied to the non-zero elements of the sparse vector.
+// Therefore the operation must map zero to zero.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the custom operation
+inline const SVecMapExpr<VT,OP,TF> map( const SparseVector<VT,TF>& sv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SVecMapExpr<VT,OP,TF>( ~sv, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the square root of each single element of the sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \return The square root of each single element of \a sv.
+//
+// The \a sqrt() function computes the square root of each non-zero element of the input vector
+// \a sv. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sqrt() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = sqrt( a );
+   \endcode
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline const SVecMapExpr<VT,Sqrt,TF> sqrt( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SVecMapExpr<VT,Sqrt,TF>( ~sv, Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sine of each single element of the sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \return The sine of each single element of \a sv.
+//
+// The \a sin() function computes the sine of each non-zero element of the input vector \a sv. The
+// function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a sin() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = sin( a );
+   \endcode
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline const SVecMapExpr<VT,Sin,TF> sin( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SVecMapExpr<VT,Sin,TF>( ~sv, Sin() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the hyperbolic tangent of each single element of the sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \return The hyperbolic tangent of each single element of \a sv.
+//
+// The \a tanh() function computes the hyperbolic tangent of each non-zero element of the input
+// vector \a sv. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a tanh() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = tanh( a );
+   \endcode
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline const SVecMapExpr<VT,Tanh,TF> tanh( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SVecMapExpr<VT,Tanh,TF>( ~sv, Tanh() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rectified linear unit of each single element of the sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \return The rectified linear unit of each single element of \a sv.
+//
+// The \a relu() function computes the rectified linear unit \f$ max(0,x) \f$ of each non-zero
+// element of the input vector \a sv. The function returns an expression representing this
+// operation.\n
+// The following example demonstrates the use of the \a relu() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = relu( a );
+   \endcode
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline const SVecMapExpr<VT,Relu,TF> relu( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return SVecMapExpr<VT,Relu,TF>( ~sv, Relu() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the exponential value for each single element of the sparse vector \a sv.
+// \ingroup sparse_vector
+//
+// \param sv The input vector.
+// \param exp The exponent.
+// \return Each single element of \a sv raised to the power of \a exp.
+// \exception std::invalid_argument Invalid exponent for sparse vector.
+//
+// The \a pow() function computes the exponential value for each non-zero element of the input
+// vector \a sv. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a pow() function:
+
+   \code
+   blaze::CompressedVector<double> a, b;
+   // ... Resizing and initialization
+   b = pow( a, 4.2 );
+   \endcode
+
+// Since the operation is only applied to the non-zero elements of the sparse vector, the exponent
+// must be positive. In case \a exp is not positive, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag
+        , typename ST >  // Type of the exponent
+inline const typename EnableIf< IsNumeric<ST>, SVecMapExpr<VT,Pow<ST>,TF> >::Type
+   pow( const SparseVector<VT,TF>& sv, ST exp )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !( exp > ST(0) ) )
+      throw std::invalid_argument( "Invalid exponent for sparse vector" );
+
+   return SVecMapExpr<VT,Pow<ST>,TF>( ~sv, Pow<ST>( exp ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, typename OP, bool TF, bool AF >
+struct SubvectorExprTrait< SVecMapExpr<VT,OP,TF>, AF >
+{
+ public:
+   //**********************************************************************************************
+   typedef SVecMapExpr< typename SubvectorExprTrait<const VT,AF>::Type, OP, TF >  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -76,6 +76,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -237,6 +238,27 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix differs from the element type of the two
+       vectors, but can be converted in registers into the element type of the vectors
+       (mixed precision matrix/vector multiplication), the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      typedef typename T1::ElementType  ET1;
+      typedef typename T2::ElementType  MET1;
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<ET1,typename T3::ElementType>::value &&
+                     !IsSame<ET1,MET1>::value &&
+                     IntrinsicConversionTrait<MET1,ET1>::value &&
+                     IntrinsicTrait<ET1>::addition &&
+                     IntrinsicTrait<ET1>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDMatDVecMultExpr<MT,VT>                    This;           //!< Type of this TDMatDVecMultExpr instance.
@@ -504,7 +526,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       const size_t M( A.rows()    );
@@ -625,6 +648,99 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the transpose dense
+   // matrix-dense vector multiplication in case the matrix is stored with a lower precision than
+   // the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      reset( y );
+
+      for( size_t jj=0UL; jj<N; jj+=256UL ) {
+         const size_t jend( ( jj+256UL < N )?( jj+256UL ):( N ) );
+
+         size_t i( 0UL );
+
+         for( ; (i+IT::size*CT::ratio*4UL) <= iend; i+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+               xmm2[k] = y.load(i+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(i+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(i+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i+IT::size*CT::ratio,j), a2 );
+               convert( A.load(i+IT::size*CT::ratio*2UL,j), a3 );
+               convert( A.load(i+IT::size*CT::ratio*3UL,j), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + a1[k] * x1;
+                  xmm2[k] = xmm2[k] + a2[k] * x1;
+                  xmm3[k] = xmm3[k] + a3[k] * x1;
+                  xmm4[k] = xmm4[k] + a4[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+               y.store( i+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( i+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( i+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (i+IT::size*CT::ratio) <= iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + a1[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t k=iend; k<M; ++k ) {
+               y[k] += A(k,j) * x[j];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense matrix-dense vector multiplication
@@ -944,7 +1060,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultAddAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       const size_t M( A.rows()    );
@@ -1075,6 +1192,97 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default addition assignment to dense vectors*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default addition assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the transpose
+   // dense matrix-dense vector multiplication in case the matrix is stored with a lower precision
+   // than the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultAddAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      for( size_t jj=0UL; jj<N; jj+=256UL ) {
+         const size_t jend( ( jj+256UL < N )?( jj+256UL ):( N ) );
+
+         size_t i( 0UL );
+
+         for( ; (i+IT::size*CT::ratio*4UL) <= iend; i+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+               xmm2[k] = y.load(i+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(i+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(i+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i+IT::size*CT::ratio,j), a2 );
+               convert( A.load(i+IT::size*CT::ratio*2UL,j), a3 );
+               convert( A.load(i+IT::size*CT::ratio*3UL,j), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + a1[k] * x1;
+                  xmm2[k] = xmm2[k] + a2[k] * x1;
+                  xmm3[k] = xmm3[k] + a3[k] * x1;
+                  xmm4[k] = xmm4[k] + a4[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+               y.store( i+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( i+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( i+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (i+IT::size*CT::ratio) <= iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + a1[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t k=iend; k<M; ++k ) {
+               y[k] += A(k,j) * x[j];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense matrix-dense vector multiplication
@@ -1368,7 +1576,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2_ >  // Type of the right-hand side vector operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,MT1,VT2_> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,MT1,VT2_>
+                                       , UseMixedPrecisionKernel<VT1_,MT1,VT2_> > >::Type
       selectDefaultSubAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
    {
       const size_t M( A.rows()    );
@@ -1499,6 +1708,97 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default subtraction assignment to dense vectors******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default subtraction assignment of a transpose dense matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the
+   // transpose dense matrix-dense vector multiplication in case the matrix is stored with a lower
+   // precision than the two vectors (as for instance a single precision matrix in combination with
+   // double precision vectors). The elements of the matrix are converted in registers to the
+   // element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2_ >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,MT1,VT2_> >::Type
+      selectDefaultSubAssignKernel( VT1_& y, const MT1& A, const VT2_& x )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      for( size_t jj=0UL; jj<N; jj+=256UL ) {
+         const size_t jend( ( jj+256UL < N )?( jj+256UL ):( N ) );
+
+         size_t i( 0UL );
+
+         for( ; (i+IT::size*CT::ratio*4UL) <= iend; i+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+               xmm2[k] = y.load(i+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(i+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(i+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i+IT::size*CT::ratio,j), a2 );
+               convert( A.load(i+IT::size*CT::ratio*2UL,j), a3 );
+               convert( A.load(i+IT::size*CT::ratio*3UL,j), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] - a1[k] * x1;
+                  xmm2[k] = xmm2[k] - a2[k] * x1;
+                  xmm3[k] = xmm3[k] - a3[k] * x1;
+                  xmm4[k] = xmm4[k] - a4[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+               y.store( i+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( i+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( i+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (i+IT::size*CT::ratio) <= iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(i+k*IT::size);
+            }
+            for( size_t j=jj; j<jend; ++j ) {
+               const IntrinsicType x1( set( x[j] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] - a1[k] * x1;
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( i+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t k=iend; k<M; ++k ) {
+               y[k] -= A(k,j) * x[j];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense matrix-dense vector
@@ -76,6 +76,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -237,6 +238,27 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix differs from the element type of the two
+       vectors, but can be converted in registers into the element type of the vectors
+       (mixed precision vector/matrix multiplication), the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      typedef typename T1::ElementType  ET1;
+      typedef typename T3::ElementType  MET1;
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<ET1,typename T2::ElementType>::value &&
+                     !IsSame<ET1,MET1>::value &&
+                     IntrinsicConversionTrait<MET1,ET1>::value &&
+                     IntrinsicTrait<ET1>::addition &&
+                     IntrinsicTrait<ET1>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDVecDMatMultExpr<VT,MT>                    This;           //!< Type of this TDVecDMatMultExpr instance.
@@ -504,7 +526,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       const size_t M( A.rows()    );
@@ -625,6 +648,99 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default assignment of a transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the transpose dense
+   // vector-dense matrix multiplication in case the matrix is stored with a lower precision than
+   // the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      reset( y );
+
+      for( size_t ii=0UL; ii<M; ii+=256UL ) {
+         const size_t iend( ( ii+256UL < M )?( ii+256UL ):( M ) );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*CT::ratio*4UL) <= jend; j+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+               xmm2[k] = y.load(j+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(j+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(j+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i,j+IT::size*CT::ratio), a2 );
+               convert( A.load(i,j+IT::size*CT::ratio*2UL), a3 );
+               convert( A.load(i,j+IT::size*CT::ratio*3UL), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + x1 * a1[k];
+                  xmm2[k] = xmm2[k] + x1 * a2[k];
+                  xmm3[k] = xmm3[k] + x1 * a3[k];
+                  xmm4[k] = xmm4[k] + x1 * a4[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+               y.store( j+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( j+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( j+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (j+IT::size*CT::ratio) <= jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + x1 * a1[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=jend; k<N; ++k ) {
+               y[k] += x[i] * A(i,k);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense vector-dense matrix multiplication
@@ -944,7 +1060,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultAddAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       const size_t M( A.rows()    );
@@ -1075,6 +1192,97 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default addition assignment to dense vectors*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default addition assignment of a transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the transpose
+   // dense vector-dense matrix multiplication in case the matrix is stored with a lower precision
+   // than the two vectors (as for instance a single precision matrix in combination with double
+   // precision vectors). The elements of the matrix are converted in registers to the element type
+   // of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultAddAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      for( size_t ii=0UL; ii<M; ii+=256UL ) {
+         const size_t iend( ( ii+256UL < M )?( ii+256UL ):( M ) );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*CT::ratio*4UL) <= jend; j+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+               xmm2[k] = y.load(j+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(j+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(j+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i,j+IT::size*CT::ratio), a2 );
+               convert( A.load(i,j+IT::size*CT::ratio*2UL), a3 );
+               convert( A.load(i,j+IT::size*CT::ratio*3UL), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + x1 * a1[k];
+                  xmm2[k] = xmm2[k] + x1 * a2[k];
+                  xmm3[k] = xmm3[k] + x1 * a3[k];
+                  xmm4[k] = xmm4[k] + x1 * a4[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+               y.store( j+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( j+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( j+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (j+IT::size*CT::ratio) <= jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] + x1 * a1[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=jend; k<N; ++k ) {
+               y[k] += x[i] * A(i,k);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense vector-dense matrix multiplication
@@ -1368,7 +1576,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultSubAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       const size_t M( A.rows()    );
@@ -1499,6 +1708,97 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default subtraction assignment to dense vectors******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default subtraction assignment of a transpose dense vector-dense matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the
+   // transpose dense vector-dense matrix multiplication in case the matrix is stored with a lower
+   // precision than the two vectors (as for instance a single precision matrix in combination with
+   // double precision vectors). The elements of the matrix are converted in registers to the
+   // element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultSubAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t jend( N - N % ( IT::size*CT::ratio ) );
+
+      for( size_t ii=0UL; ii<M; ii+=256UL ) {
+         const size_t iend( ( ii+256UL < M )?( ii+256UL ):( M ) );
+
+         size_t j( 0UL );
+
+         for( ; (j+IT::size*CT::ratio*4UL) <= jend; j+=IT::size*CT::ratio*4UL ) {
+            IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio], xmm3[CT::ratio], xmm4[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+               xmm2[k] = y.load(j+IT::size*CT::ratio+k*IT::size);
+               xmm3[k] = y.load(j+IT::size*CT::ratio*2UL+k*IT::size);
+               xmm4[k] = y.load(j+IT::size*CT::ratio*3UL+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+               convert( A.load(i,j), a1 );
+               convert( A.load(i,j+IT::size*CT::ratio), a2 );
+               convert( A.load(i,j+IT::size*CT::ratio*2UL), a3 );
+               convert( A.load(i,j+IT::size*CT::ratio*3UL), a4 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] - x1 * a1[k];
+                  xmm2[k] = xmm2[k] - x1 * a2[k];
+                  xmm3[k] = xmm3[k] - x1 * a3[k];
+                  xmm4[k] = xmm4[k] - x1 * a4[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+               y.store( j+IT::size*CT::ratio+k*IT::size, xmm2[k] );
+               y.store( j+IT::size*CT::ratio*2UL+k*IT::size, xmm3[k] );
+               y.store( j+IT::size*CT::ratio*3UL+k*IT::size, xmm4[k] );
+            }
+         }
+         for( ; (j+IT::size*CT::ratio) <= jend; j+=IT::size*CT::ratio ) {
+            IntrinsicType xmm1[CT::ratio];
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1[k] = y.load(j+k*IT::size);
+            }
+            for( size_t i=ii; i<iend; ++i ) {
+               const IntrinsicType x1( set( x[i] ) );
+               IntrinsicType a1[CT::ratio];
+               convert( A.load(i,j), a1 );
+               for( size_t k=0UL; k<CT::ratio; ++k ) {
+                  xmm1[k] = xmm1[k] - x1 * a1[k];
+               }
+            }
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               y.store( j+k*IT::size, xmm1[k] );
+            }
+         }
+         for( size_t i=ii; i<iend; ++i ) {
+            for( size_t k=jend; k<N; ++k ) {
+               y[k] -= x[i] * A(i,k);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense vector-dense matrix multiplication
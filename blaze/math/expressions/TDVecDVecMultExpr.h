@@ -44,9 +44,11 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
@@ -89,6 +91,107 @@ struct TDVecDVecMultExprHelper
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the mixed precision dense vector/dense vector scalar
+//        multiplication.
+// \ingroup dense_vector
+//
+// In case the element type of the dense vector \a T1 can be converted in registers into the
+// element type of the dense vector \a T2 (as for instance from \a float to \a double), the
+// nested \a value is set to 1, otherwise it is 0.
+*/
+template< typename T1    // Type of the lower precision dense vector
+        , typename T2 >  // Type of the higher precision dense vector
+struct TDVecDVecMultExprMixedHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the lower precision dense vector expression.
+   typedef typename RemoveReference< typename T1::CompositeType >::Type  CT1;
+
+   //! Composite type of the higher precision dense vector expression.
+   typedef typename RemoveReference< typename T2::CompositeType >::Type  CT2;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { value = CT1::vectorizable &&
+                  CT2::vectorizable &&
+                  !IsSame< typename CT1::ElementType, typename CT2::ElementType >::value &&
+                  IntrinsicConversionTrait< typename CT1::ElementType
+                                          , typename CT2::ElementType >::value &&
+                  IntrinsicTrait< typename CT2::ElementType >::addition &&
+                  IntrinsicTrait< typename CT2::ElementType >::multiplication };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mixed precision scalar product of two dense vectors.
+// \ingroup dense_vector
+//
+// \param a The dense vector of lower precision.
+// \param b The dense vector of higher precision.
+// \return The scalar product.
+//
+// This function computes the scalar product of two dense vectors of different precision. The
+// elements of the lower precision vector \a a are converted in registers to the element type
+// of the higher precision vector \a b. The function requires both vectors to be vectorizable
+// and to have the same size.
+*/
+template< typename VT1    // Type of the lower precision dense vector
+        , typename VT2 >  // Type of the higher precision dense vector
+inline typename VT2::ElementType mixedPrecisionDot( const VT1& a, const VT2& b )
+{
+   typedef typename VT1::ElementType          ET1;
+   typedef typename VT2::ElementType          ET2;
+   typedef IntrinsicTrait<ET2>                IT;
+   typedef IntrinsicConversionTrait<ET1,ET2>  CT;
+   typedef typename IT::Type                  IntrinsicType;
+
+   BLAZE_INTERNAL_ASSERT( a.size() == b.size(), "Invalid vector sizes" );
+
+   const size_t N  ( a.size() );
+   const size_t end( N - N % (IT::size*CT::ratio*2UL) );
+
+   IntrinsicType xmm1[CT::ratio], xmm2[CT::ratio];
+
+   for( size_t i=0UL; i<end; i+=IT::size*CT::ratio*2UL ) {
+      IntrinsicType a1[CT::ratio], a2[CT::ratio];
+      convert( a.load(i                    ), a1 );
+      convert( a.load(i+IT::size*CT::ratio), a2 );
+      for( size_t k=0UL; k<CT::ratio; ++k ) {
+         xmm1[k] = xmm1[k] + a1[k] * b.load(i+IT::size*k             );
+         xmm2[k] = xmm2[k] + a2[k] * b.load(i+IT::size*(k+CT::ratio));
+      }
+   }
+
+   IntrinsicType xmm3;
+   for( size_t k=0UL; k<CT::ratio; ++k ) {
+      xmm3 = xmm3 + xmm1[k] + xmm2[k];
+   }
+
+   ET2 sp( sum( xmm3 ) );
+
+   for( size_t i=end; i<N; ++i )
+      sp += a[i] * b[i];
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -125,7 +228,9 @@ struct TDVecDVecMultExprHelper
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
-inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
+inline typename DisableIf< Or< TDVecDVecMultExprHelper<T1,T2>
+                             , TDVecDVecMultExprMixedHelper<T1,T2>
+                             , TDVecDVecMultExprMixedHelper<T2,T1> >,
                            const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
    operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
 {
@@ -227,6 +332,93 @@ inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Mixed precision multiplication operator for the scalar product (inner product) of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This operator represents the scalar product (inner product) of two dense vectors with
+// different element types, where the left-hand side vector is of lower precision:
+
+   \code
+   using blaze::columnVector;
+
+   blaze::DynamicVector<float,columnVector> a;
+   blaze::DynamicVector<double,columnVector> b;
+   double res;
+   // ... Resizing and initialization
+   res = trans(a) * b;
+   \endcode
+
+// The elements of the left-hand side vector are converted in registers to the element type of
+// the right-hand side vector. In case the current sizes of the two given vectors don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename T1    // Type of the left-hand side dense vector
+        , typename T2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< TDVecDVecMultExprMixedHelper<T1,T2>,
+                          const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
+   operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   typedef typename T1::CompositeType  Lhs;
+   typedef typename T2::CompositeType  Rhs;
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+
+   return mixedPrecisionDot( left, right );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mixed precision multiplication operator for the scalar product (inner product) of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This operator represents the scalar product (inner product) of two dense vectors with
+// different element types, where the right-hand side vector is of lower precision. The
+// elements of the right-hand side vector are converted in registers to the element type of
+// the left-hand side vector. In case the current sizes of the two given vectors don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename T1    // Type of the left-hand side dense vector
+        , typename T2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< TDVecDVecMultExprMixedHelper<T2,T1>,
+                          const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
+   operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   typedef typename T1::CompositeType  Lhs;
+   typedef typename T2::CompositeType  Rhs;
+
+   Lhs left ( ~lhs );
+   Rhs right( ~rhs );
+
+   return mixedPrecisionDot( right, left );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
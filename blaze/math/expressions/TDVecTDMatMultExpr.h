@@ -76,6 +76,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -237,6 +238,27 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the element type of the matrix differs from the element type of the two
+       vectors, but can be converted in registers into the element type of the vectors
+       (mixed precision vector/matrix multiplication), the nested \value will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseMixedPrecisionKernel {
+      typedef typename T1::ElementType  ET1;
+      typedef typename T3::ElementType  MET1;
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<ET1,typename T2::ElementType>::value &&
+                     !IsSame<ET1,MET1>::value &&
+                     IntrinsicConversionTrait<MET1,ET1>::value &&
+                     IntrinsicTrait<ET1>::addition &&
+                     IntrinsicTrait<ET1>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDVecTDMatMultExpr<VT,MT>                   This;           //!< Type of this TDVecTDMatMultExpr instance.
@@ -504,7 +526,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       y.assign( x * A );
@@ -608,6 +631,88 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default assignment of a transpose dense vector-transpose dense matrix
+   //        multiplication (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default assignment kernel for the transpose dense
+   // vector-transpose dense matrix multiplication in case the matrix is stored with a lower
+   // precision than the two vectors (as for instance a single precision matrix in combination with
+   // double precision vectors). The elements of the matrix are converted in registers to the
+   // element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i,j    ), a1 );
+            convert( A.load(i,j+1UL), a2 );
+            convert( A.load(i,j+2UL), a3 );
+            convert( A.load(i,j+3UL), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(i+k*IT::size) );
+               xmm1 = xmm1 + x1 * a1[k];
+               xmm2 = xmm2 + x1 * a2[k];
+               xmm3 = xmm3 + x1 * a3[k];
+               xmm4 = xmm4 + x1 * a4[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j    );
+            y2 += x[i] * A(i,j+1UL);
+            y3 += x[i] * A(i,j+2UL);
+            y4 += x[i] * A(i,j+3UL);
+         }
+         y[j    ] = y1;
+         y[j+1UL] = y2;
+         y[j+2UL] = y3;
+         y[j+3UL] = y4;
+      }
+      for( ; j<N; ++j ) {
+         IntrinsicType xmm1;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + x.load(i+k*IT::size) * a1[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j);
+         }
+         y[j] = y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based assignment to dense vectors (default)********************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense vector-transpose dense matrix multiplication
@@ -927,7 +1032,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultAddAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       y.addAssign( x * A );
@@ -1031,6 +1137,88 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default addition assignment to dense vectors*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default addition assignment of a transpose dense vector-transpose dense
+   //        matrix multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default addition assignment kernel for the transpose
+   // dense vector-transpose dense matrix multiplication in case the matrix is stored with a lower
+   // precision than the two vectors (as for instance a single precision matrix in combination with
+   // double precision vectors). The elements of the matrix are converted in registers to the
+   // element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultAddAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i,j    ), a1 );
+            convert( A.load(i,j+1UL), a2 );
+            convert( A.load(i,j+2UL), a3 );
+            convert( A.load(i,j+3UL), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(i+k*IT::size) );
+               xmm1 = xmm1 + x1 * a1[k];
+               xmm2 = xmm2 + x1 * a2[k];
+               xmm3 = xmm3 + x1 * a3[k];
+               xmm4 = xmm4 + x1 * a4[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j    );
+            y2 += x[i] * A(i,j+1UL);
+            y3 += x[i] * A(i,j+2UL);
+            y4 += x[i] * A(i,j+3UL);
+         }
+         y[j    ] += y1;
+         y[j+1UL] += y2;
+         y[j+2UL] += y3;
+         y[j+3UL] += y4;
+      }
+      for( ; j<N; ++j ) {
+         IntrinsicType xmm1;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + x.load(i+k*IT::size) * a1[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j);
+         }
+         y[j] += y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based addition assignment to dense vectors (default)***********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a transpose dense vector-transpose dense matrix
@@ -1324,7 +1512,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    template< typename VT1_    // Type of the left-hand side target vector
            , typename VT2_    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline typename DisableIf< UseVectorizedDefaultKernel<VT1_,VT2_,MT1> >::Type
+   static inline typename DisableIf< Or< UseVectorizedDefaultKernel<VT1_,VT2_,MT1>
+                                       , UseMixedPrecisionKernel<VT1_,VT2_,MT1> > >::Type
       selectDefaultSubAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
    {
       y.subAssign( x * A );
@@ -1428,6 +1617,88 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Mixed precision default subtraction assignment to dense vectors******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mixed precision default subtraction assignment of a transpose dense vector-transpose
+   //        dense matrix multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized default subtraction assignment kernel for the
+   // transpose dense vector-transpose dense matrix multiplication in case the matrix is stored with
+   // a lower precision than the two vectors (as for instance a single precision matrix in
+   // combination with double precision vectors). The elements of the matrix are converted in
+   // registers to the element type of the vectors.
+   */
+   template< typename VT1_    // Type of the left-hand side target vector
+           , typename VT2_    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseMixedPrecisionKernel<VT1_,VT2_,MT1> >::Type
+      selectDefaultSubAssignKernel( VT1_& y, const VT2_& x, const MT1& A )
+   {
+      typedef IntrinsicTrait<ElementType>                                     IT;
+      typedef IntrinsicConversionTrait<typename MT1::ElementType,ElementType>  CT;
+
+      const size_t M( A.rows()    );
+      const size_t N( A.columns() );
+      const size_t iend( M - M % ( IT::size*CT::ratio ) );
+
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL ) {
+         IntrinsicType xmm1, xmm2, xmm3, xmm4;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio], a2[CT::ratio], a3[CT::ratio], a4[CT::ratio];
+            convert( A.load(i,j    ), a1 );
+            convert( A.load(i,j+1UL), a2 );
+            convert( A.load(i,j+2UL), a3 );
+            convert( A.load(i,j+3UL), a4 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               const IntrinsicType x1( x.load(i+k*IT::size) );
+               xmm1 = xmm1 + x1 * a1[k];
+               xmm2 = xmm2 + x1 * a2[k];
+               xmm3 = xmm3 + x1 * a3[k];
+               xmm4 = xmm4 + x1 * a4[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         ElementType y2( sum( xmm2 ) );
+         ElementType y3( sum( xmm3 ) );
+         ElementType y4( sum( xmm4 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j    );
+            y2 += x[i] * A(i,j+1UL);
+            y3 += x[i] * A(i,j+2UL);
+            y4 += x[i] * A(i,j+3UL);
+         }
+         y[j    ] -= y1;
+         y[j+1UL] -= y2;
+         y[j+2UL] -= y3;
+         y[j+3UL] -= y4;
+      }
+      for( ; j<N; ++j ) {
+         IntrinsicType xmm1;
+         for( size_t i=0UL; i<iend; i+=IT::size*CT::ratio ) {
+            IntrinsicType a1[CT::ratio];
+            convert( A.load(i,j), a1 );
+            for( size_t k=0UL; k<CT::ratio; ++k ) {
+               xmm1 = xmm1 + x.load(i+k*IT::size) * a1[k];
+            }
+         }
+         ElementType y1( sum( xmm1 ) );
+         for( size_t i=iend; i<M; ++i ) {
+            y1 += x[i] * A(i,j);
+         }
+         y[j] -= y1;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**BLAS-based subtraction assignment to dense vectors (default)********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a transpose dense vector-transpose dense matrix
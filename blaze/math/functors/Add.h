@@ -0,0 +1,103 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Add.h
+//  \brief Header file for the Add functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_ADD_H_
+#define _BLAZE_MATH_FUNCTORS_ADD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the addition of two values.
+// \ingroup functors
+*/
+struct Add
+{
+   //**Type traits*********************************************************************************
+   /*!\brief Compile time check for the availability of an intrinsic addition.
+   //
+   // The \a value of the SIMDEnabled class template is 1 in case the addition can be applied
+   // to intrinsic vectors of the given data type \a T, otherwise it is 0.
+   */
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = IntrinsicTrait<T>::addition };
+   };
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Returns the result of the addition for the given two values.
+   //
+   // \param a The left-hand side value.
+   // \param b The right-hand side value.
+   // \return The sum of the two given values.
+   */
+   template< typename T >
+   inline T operator()( const T& a, const T& b ) const {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Returns the result of the addition for the given two intrinsic vectors.
+   //
+   // \param a The left-hand side intrinsic vector.
+   // \param b The right-hand side intrinsic vector.
+   // \return The element-wise sum of the two given intrinsic vectors.
+   */
+   template< typename T >
+   inline T load( const T& a, const T& b ) const {
+      return a + b;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
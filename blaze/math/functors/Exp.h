@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Exp.h
+//  \brief Header file for the Exp functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_EXP_H_
+#define _BLAZE_MATH_FUNCTORS_EXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the exp() function.
+// \ingroup functors
+*/
+struct Exp
+{
+   //**Type traits*********************************************************************************
+   /*!\brief Compile time check for the availability of an intrinsic exp() function.
+   //
+   // The \a value of the SIMDEnabled class template is 1 in case the exp() function can be
+   // applied to intrinsic vectors of the given data type \a T, otherwise it is 0.
+   */
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = IntrinsicTrait<T>::transcendental };
+   };
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Returns the result of the exp() function for the given object/value.
+   //
+   // \param a The given object/value.
+   // \return The exponential of the given object/value.
+   */
+   template< typename T >
+   inline T operator()( const T& a ) const {
+      using std::exp;
+      return exp( a );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Returns the result of the exp() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The exponential of the elements of the given intrinsic vector.
+   */
+   template< typename T >
+   inline T load( const T& a ) const {
+      return exp( a );
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,135 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Pow.h
+//  \brief Header file for the Pow functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_POW_H_
+#define _BLAZE_MATH_FUNCTORS_POW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/util/constraints/Numeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the pow() function with fixed exponent.
+// \ingroup functors
+*/
+template< typename ST >  // Type of the exponent
+struct Pow
+{
+   //**Type traits*********************************************************************************
+   /*!\brief Compile time check for the availability of an intrinsic pow() function.
+   //
+   // The \a value of the SIMDEnabled class template is 1 in case the pow() function can be
+   // applied to intrinsic vectors of the given data type \a T, otherwise it is 0.
+   */
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = IntrinsicTrait<T>::transcendental };
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the Pow functor.
+   //
+   // \param exp The exponent.
+   */
+   explicit inline Pow( ST exp )
+      : exp_( exp )  // The exponent
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Returns the result of the pow() function for the given object/value.
+   //
+   // \param a The given object/value.
+   // \return The given object/value raised to the power of the exponent.
+   */
+   template< typename T >
+   inline T operator()( const T& a ) const {
+      using std::pow;
+      return pow( a, exp_ );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Returns the result of the pow() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The elements of the given intrinsic vector raised to the power of the exponent.
+   */
+   template< typename T >
+   inline T load( const T& a ) const {
+      return pow( a, exp_ );
+   }
+   //**********************************************************************************************
+
+   //**Exponent function***************************************************************************
+   /*!\brief Returns the exponent of the pow() function.
+   //
+   // \return The exponent.
+   */
+   inline ST exponent() const {
+      return exp_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ST exp_;  //!< The exponent of the pow() function.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ST );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -117,6 +117,50 @@ inline sse_int32_t abs( const sse_int32_t& a )
 #endif
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\fn sse_float_t abs( sse_float_t )
+// \brief Absolute value of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The absolute values.
+*/
+#if BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t abs( const sse_float_t& a )
+{
+   return _mm256_andnot_ps( _mm256_set1_ps( -0.0F ), a.value );
+}
+#elif BLAZE_SSE_MODE && !BLAZE_MIC_MODE
+inline sse_float_t abs( const sse_float_t& a )
+{
+   return _mm_andnot_ps( _mm_set1_ps( -0.0F ), a.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t abs( sse_double_t )
+// \brief Absolute value of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The absolute values.
+*/
+#if BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t abs( const sse_double_t& a )
+{
+   return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+inline sse_double_t abs( const sse_double_t& a )
+{
+   return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.value );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,7 +41,9 @@
 //*************************************************************************************************
 
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/Types.h>
 
 
@@ -380,6 +382,74 @@ struct sse_cdouble_t {
 /*! \endcond */
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\class blaze::sse_float16_t
+// \brief Intrinsic type for half precision floating point data values.
+// \ingroup intrinsics
+*/
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX2_MODE
+struct sse_float16_t {
+   inline sse_float16_t() : value( _mm256_setzero_si256() ) {}
+   inline sse_float16_t( __m256i v ) : value( v ) {}
+   inline float16&       operator[]( size_t i )       { return reinterpret_cast<float16*      >( &value )[i]; }
+   inline const float16& operator[]( size_t i ) const { return reinterpret_cast<const float16*>( &value )[i]; }
+   __m256i value;  // Contains 16 half precision floating point data values
+};
+#elif BLAZE_SSE2_MODE
+struct sse_float16_t {
+   inline sse_float16_t() : value( _mm_setzero_si128() ) {}
+   inline sse_float16_t( __m128i v ) : value( v ) {}
+   inline float16&       operator[]( size_t i )       { return reinterpret_cast<float16*      >( &value )[i]; }
+   inline const float16& operator[]( size_t i ) const { return reinterpret_cast<const float16*>( &value )[i]; }
+   __m128i value;  // Contains 8 half precision floating point data values
+};
+#else
+struct sse_float16_t {
+   inline sse_float16_t() : value() {}
+   inline sse_float16_t( float16 v ) : value( v ) {}
+   inline float16&       operator[]( size_t /*i*/ )       { return value; }
+   inline const float16& operator[]( size_t /*i*/ ) const { return value; }
+   float16 value;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\class blaze::sse_bfloat16_t
+// \brief Intrinsic type for bfloat16 floating point data values.
+// \ingroup intrinsics
+*/
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX2_MODE
+struct sse_bfloat16_t {
+   inline sse_bfloat16_t() : value( _mm256_setzero_si256() ) {}
+   inline sse_bfloat16_t( __m256i v ) : value( v ) {}
+   inline bfloat16&       operator[]( size_t i )       { return reinterpret_cast<bfloat16*      >( &value )[i]; }
+   inline const bfloat16& operator[]( size_t i ) const { return reinterpret_cast<const bfloat16*>( &value )[i]; }
+   __m256i value;  // Contains 16 bfloat16 floating point data values
+};
+#elif BLAZE_SSE2_MODE
+struct sse_bfloat16_t {
+   inline sse_bfloat16_t() : value( _mm_setzero_si128() ) {}
+   inline sse_bfloat16_t( __m128i v ) : value( v ) {}
+   inline bfloat16&       operator[]( size_t i )       { return reinterpret_cast<bfloat16*      >( &value )[i]; }
+   inline const bfloat16& operator[]( size_t i ) const { return reinterpret_cast<const bfloat16*>( &value )[i]; }
+   __m128i value;  // Contains 8 bfloat16 floating point data values
+};
+#else
+struct sse_bfloat16_t {
+   inline sse_bfloat16_t() : value() {}
+   inline sse_bfloat16_t( bfloat16 v ) : value( v ) {}
+   inline bfloat16&       operator[]( size_t /*i*/ )       { return value; }
+   inline const bfloat16& operator[]( size_t /*i*/ ) const { return value; }
+   bfloat16 value;
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,237 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Conversion.h
+//  \brief Header file for the intrinsic conversion functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_CONVERSION_H_
+#define _BLAZE_MATH_INTRINSICS_CONVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identity conversion of an intrinsic vector.
+// \ingroup intrinsics
+//
+// \param a The vector to be converted.
+// \param b The resulting vector.
+// \return void
+//
+// This function copies the given vector to \a b[0]. It enables mixed precision kernels to treat
+// operands that are already stored in the target precision like operands that require a
+// conversion (see the IntrinsicConversionTrait class template, which specifies a ratio of 1 for
+// identical types).
+*/
+template< typename T >  // Type of the intrinsic vector
+inline void convert( const T& a, T* b )
+{
+   b[0] = a;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void convert( const sse_float_t&, sse_double_t* )
+// \brief Conversion of a vector of single precision values to double precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values to be converted.
+// \param b The two resulting vectors of double precision floating point values.
+// \return void
+//
+// This function widens the values of the given single precision vector into two double
+// precision vectors. \a b[0] contains the lower and \a b[1] the upper half of the values.
+*/
+#if BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_float_t& a, sse_double_t* b )
+{
+   b[0] = _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) );
+   b[1] = _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_float_t& a, sse_double_t* b )
+{
+   b[0] = _mm_cvtps_pd( a.value );
+   b[1] = _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void convert( const sse_int32_t&, sse_double_t* )
+// \brief Conversion of a vector of 32-bit integral values to double precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of 32-bit integral values to be converted.
+// \param b The resulting vectors of double precision floating point values.
+// \return void
+//
+// This function widens the values of the given 32-bit integral vector into double precision
+// vectors. In case the integral vector holds twice as many values as a double precision vector
+// (SSE2 and AVX2), \a b[0] contains the lower and \a b[1] the upper half of the values. In AVX
+// mode the integral vector holds as many values as a double precision vector and the result is
+// stored in \a b[0] only.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_int32_t& a, sse_double_t* b )
+{
+   b[0] = _mm256_cvtepi32_pd( _mm256_castsi256_si128( a.value ) );
+   b[1] = _mm256_cvtepi32_pd( _mm256_extracti128_si256( a.value, 1 ) );
+}
+#elif BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_int32_t& a, sse_double_t* b )
+{
+   b[0] = _mm256_cvtepi32_pd( a.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_int32_t& a, sse_double_t* b )
+{
+   b[0] = _mm_cvtepi32_pd( a.value );
+   b[1] = _mm_cvtepi32_pd( _mm_unpackhi_epi64( a.value, a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void convert( const sse_int32_t&, sse_float_t* )
+// \brief Conversion of a vector of 32-bit integral values to single precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of 32-bit integral values to be converted.
+// \param b The resulting vector of single precision floating point values.
+// \return void
+//
+// This function converts the values of the given 32-bit integral vector into the single
+// precision vector \a b[0]. Note that the conversion is not available in AVX mode, since
+// the 32-bit integral vectors only hold half as many values as a single precision vector.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_int32_t& a, sse_float_t* b )
+{
+   b[0] = _mm256_cvtepi32_ps( a.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_int32_t& a, sse_float_t* b )
+{
+   b[0] = _mm_cvtepi32_ps( a.value );
+}
+#endif
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\fn void convert( const sse_float16_t&, sse_float_t* )
+// \brief Conversion of a vector of half precision values to single precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of half precision floating point values to be converted.
+// \param b The resulting vectors of single precision floating point values.
+// \return void
+//
+// This function widens the values of the given half precision vector into single precision
+// vectors via the F16C instruction set. In AVX2 mode the half precision vector holds twice as
+// many values as a single precision vector and \a b[0] contains the lower and \a b[1] the upper
+// half of the values. In AVX mode the result is stored in \a b[0] only.
+*/
+#if BLAZE_F16C_MODE && BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_float16_t& a, sse_float_t* b )
+{
+   b[0] = _mm256_cvtph_ps( _mm256_castsi256_si128( a.value ) );
+   b[1] = _mm256_cvtph_ps( _mm256_extracti128_si256( a.value, 1 ) );
+}
+#elif BLAZE_F16C_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_float16_t& a, sse_float_t* b )
+{
+   b[0] = _mm256_cvtph_ps( a.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn void convert( const sse_bfloat16_t&, sse_float_t* )
+// \brief Conversion of a vector of bfloat16 values to single precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of bfloat16 floating point values to be converted.
+// \param b The resulting vectors of single precision floating point values.
+// \return void
+//
+// This function widens the values of the given bfloat16 vector into single precision vectors
+// by moving each value into the upper half of a 32-bit lane. In case the bfloat16 vector holds
+// twice as many values as a single precision vector (SSE2 and AVX2), \a b[0] contains the lower
+// and \a b[1] the upper half of the values. In AVX mode the result is stored in \a b[0] only.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_bfloat16_t& a, sse_float_t* b )
+{
+   b[0] = _mm256_castsi256_ps( _mm256_slli_epi32(
+             _mm256_cvtepu16_epi32( _mm256_castsi256_si128( a.value ) ), 16 ) );
+   b[1] = _mm256_castsi256_ps( _mm256_slli_epi32(
+             _mm256_cvtepu16_epi32( _mm256_extracti128_si256( a.value, 1 ) ), 16 ) );
+}
+#elif BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_bfloat16_t& a, sse_float_t* b )
+{
+   const __m128i zero( _mm_setzero_si128() );
+   const __m128 lo( _mm_castsi128_ps( _mm_unpacklo_epi16( zero, a.value ) ) );
+   const __m128 hi( _mm_castsi128_ps( _mm_unpackhi_epi16( zero, a.value ) ) );
+   b[0] = _mm256_insertf128_ps( _mm256_castps128_ps256( lo ), hi, 1 );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+inline void convert( const sse_bfloat16_t& a, sse_float_t* b )
+{
+   const __m128i zero( _mm_setzero_si128() );
+   b[0] = _mm_castsi128_ps( _mm_unpacklo_epi16( zero, a.value ) );
+   b[1] = _mm_castsi128_ps( _mm_unpackhi_epi16( zero, a.value ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
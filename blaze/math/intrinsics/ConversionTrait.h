@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/ConversionTrait.h
+//  \brief Header file for the intrinsic conversion trait
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_CONVERSIONTRAIT_H_
+#define _BLAZE_MATH_INTRINSICS_CONVERSIONTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS INTRINSICCONVERSIONTRAITBASE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base template for the IntrinsicConversionTrait class.
+// \ingroup intrinsics
+*/
+template< typename T1, typename T2 >
+struct IntrinsicConversionTraitBase
+{
+   enum { value = 0,
+          ratio = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversionTraitBase class template for the conversion
+//        from 'float' to 'double'.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversionTraitBase<float,double>
+{
+   enum { value = BLAZE_SSE2_MODE && !BLAZE_MIC_MODE,
+          ratio = ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+                  ?( IntrinsicTrait<float>::size / IntrinsicTrait<double>::size )
+                  :( 1 ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversionTraitBase class template for the conversion
+//        from 'int' to 'double'.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversionTraitBase<int,double>
+{
+   enum { value = BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && sizeof(int) == 4UL,
+          ratio = ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+                  ?( IntrinsicTrait<int>::size / IntrinsicTrait<double>::size )
+                  :( 1 ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversionTraitBase class template for the conversion
+//        from 'int' to 'float'.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversionTraitBase<int,float>
+{
+   enum { value = BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && sizeof(int) == 4UL &&
+                  ( !BLAZE_AVX_MODE || BLAZE_AVX2_MODE ),
+          ratio = 1 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversionTraitBase class template for the conversion
+//        from 'float16' to 'float'.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversionTraitBase<float16,float>
+{
+   enum { value = BLAZE_F16C_MODE && !BLAZE_MIC_MODE,
+          ratio = ( BLAZE_F16C_MODE && !BLAZE_MIC_MODE )
+                  ?( IntrinsicTrait<float16>::size / IntrinsicTrait<float>::size )
+                  :( 1 ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicConversionTraitBase class template for the conversion
+//        from 'bfloat16' to 'float'.
+// \ingroup intrinsics
+*/
+template<>
+struct IntrinsicConversionTraitBase<bfloat16,float>
+{
+   enum { value = BLAZE_SSE2_MODE && !BLAZE_MIC_MODE,
+          ratio = ( BLAZE_SSE2_MODE && !BLAZE_MIC_MODE )
+                  ?( IntrinsicTrait<bfloat16>::size / IntrinsicTrait<float>::size )
+                  :( 1 ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS INTRINSICCONVERSIONTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Intrinsic characteristics of the conversion between two data types.
+// \ingroup intrinsics
+//
+// The IntrinsicConversionTrait class template describes whether intrinsic vectors of the data
+// type \a T1 can be converted in registers into intrinsic vectors of the data type \a T2 (see
+// the convert() functions):
+//
+//  - If the conversion is supported, the \a value value is set to 1. Otherwise, \a value is
+//    set to 0.
+//  - The \a ratio value corresponds to the number of intrinsic vectors of type \a T2 that result
+//    from the conversion of a single intrinsic vector of type \a T1 (for instance 2 in case of
+//    a conversion from \a float to \a double, or in case of a conversion from \a float16 to
+//    \a float in AVX2 mode).
+//
+// The conversion trait enables the vectorized evaluation of mixed precision operations, as for
+// instance the multiplication of a single precision matrix with a double precision vector.
+*/
+template< typename T1, typename T2 >
+struct IntrinsicConversionTrait
+   : public IntrinsicConversionTraitBase< typename RemoveCV<T1>::Type, typename RemoveCV<T2>::Type >
+{};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Exp.h
+//  \brief Header file for the intrinsic exponential functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_EXP_H_
+#define _BLAZE_MATH_INTRINSICS_EXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC EXPONENTIAL FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE )
+
+//*************************************************************************************************
+/*!\brief Exponential function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The exponential values \f$ e^a \f$.
+//
+// The argument is reduced to \f$ r = a - n \cdot ln(2) \f$ with \f$ |r| \leq ln(2)/2 \f$. The
+// exponential of \a r is approximated by a polynomial of degree 7 and scaled by \f$ 2^n \f$.
+// The maximum relative error is about 2 ulp in the entire domain (including subnormal results).
+*/
+inline sse_float_t exp( const sse_float_t& a )
+{
+   const sse_float_t hi( set(   88.72283935546875F ) );
+   const sse_float_t lo( set( -103.972076416015625F ) );
+
+   const sse_float_t x( maximum( lo, minimum( hi, a ) ) );
+   const sse_float_t n( roundToInteger( x * set( 1.44269504088896341F ) ) );
+
+   sse_float_t r( x - n * set( 0.693359375F ) );
+   r = r + n * set( 2.12194440E-4F );
+
+   sse_float_t p( set( 1.9875691500E-4F ) );
+   p = p * r + set( 1.3981999507E-3F );
+   p = p * r + set( 8.3334519073E-3F );
+   p = p * r + set( 4.1665795894E-2F );
+   p = p * r + set( 1.6666665459E-1F );
+   p = p * r + set( 5.0000001201E-1F );
+   p = p * ( r * r ) + r + set( 1.0F );
+
+   const sse_float_t res( scale( p, n ) );
+
+   return blend( greaterThan( a, hi ), set( std::numeric_limits<float>::infinity() ),
+                 blend( lessThan( a, lo ), set( 0.0F ), res ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exponential function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The exponential values \f$ e^a \f$.
+//
+// The argument is reduced to \f$ r = a - n \cdot ln(2) \f$ with \f$ |r| \leq ln(2)/2 \f$. The
+// exponential of \a r is approximated by a rational function of degree (5,6) and scaled by
+// \f$ 2^n \f$. The maximum relative error is about 2 ulp in the entire domain (including
+// subnormal results).
+*/
+inline sse_double_t exp( const sse_double_t& a )
+{
+   const sse_double_t hi( set(  709.782712893383973096 ) );
+   const sse_double_t lo( set( -745.13321910194110842 ) );
+
+   const sse_double_t x( maximum( lo, minimum( hi, a ) ) );
+   const sse_double_t n( roundToInteger( x * set( 1.4426950408889634073599 ) ) );
+
+   sse_double_t r( x - n * set( 6.93145751953125E-1 ) );
+   r = r - n * set( 1.42860682030941723212E-6 );
+
+   const sse_double_t r2( r * r );
+
+   sse_double_t p( set( 1.26177193074810590878E-4 ) );
+   p = p * r2 + set( 3.02994407707441961300E-2 );
+   p = p * r2 + set( 9.99999999999999999910E-1 );
+   p = p * r;
+
+   sse_double_t q( set( 3.00198505138664455042E-6 ) );
+   q = q * r2 + set( 2.52448340349684104192E-3 );
+   q = q * r2 + set( 2.27265548208155028766E-1 );
+   q = q * r2 + set( 2.00000000000000000009E0 );
+
+   const sse_double_t e( set( 1.0 ) + set( 2.0 ) * ( p / ( q - p ) ) );
+   const sse_double_t res( scale( e, n ) );
+
+   return blend( greaterThan( a, hi ), set( std::numeric_limits<double>::infinity() ),
+                 blend( lessThan( a, lo ), set( 0.0 ), res ) );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
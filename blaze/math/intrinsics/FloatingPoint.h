@@ -0,0 +1,949 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FloatingPoint.h
+//  \brief Header file for the intrinsic floating point manipulation functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FLOATINGPOINT_H_
+#define _BLAZE_MATH_INTRINSICS_FLOATINGPOINT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC BITWISE OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t andBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_and_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t andBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_and_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t andBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_and_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t andBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_and_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise OR of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t orBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_or_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t orBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_or_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise OR of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t orBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_or_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t orBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_or_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise XOR of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t xorBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_xor_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t xorBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_xor_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise XOR of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t xorBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_xor_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t xorBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_xor_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND NOT of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be complemented.
+// \param b The second operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t andnotBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_andnot_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t andnotBits( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_andnot_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND NOT of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be complemented.
+// \param b The second operand.
+// \return The result of the bitwise operation.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t andnotBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_andnot_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t andnotBits( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_andnot_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Logical left shift of the bits of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be shifted by \a N bits.
+// \return The shifted bit patterns.
+*/
+#if BLAZE_AVX2_MODE
+template< int N >  // Number of bits to shift
+inline sse_float_t shiftLeft( const sse_float_t& a )
+{
+   return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( a.value ), N ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+template< int N >  // Number of bits to shift
+inline sse_float_t shiftLeft( const sse_float_t& a )
+{
+   return _mm_castsi128_ps( _mm_slli_epi32( _mm_castps_si128( a.value ), N ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Logical left shift of the bits of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be shifted by \a N bits.
+// \return The shifted bit patterns.
+*/
+#if BLAZE_AVX2_MODE
+template< int N >  // Number of bits to shift
+inline sse_double_t shiftLeft( const sse_double_t& a )
+{
+   return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( a.value ), N ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+template< int N >  // Number of bits to shift
+inline sse_double_t shiftLeft( const sse_double_t& a )
+{
+   return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( a.value ), N ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Logical right shift of the bits of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be shifted by \a N bits.
+// \return The shifted bit patterns.
+*/
+#if BLAZE_AVX2_MODE
+template< int N >  // Number of bits to shift
+inline sse_float_t shiftRight( const sse_float_t& a )
+{
+   return _mm256_castsi256_ps( _mm256_srli_epi32( _mm256_castps_si256( a.value ), N ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+template< int N >  // Number of bits to shift
+inline sse_float_t shiftRight( const sse_float_t& a )
+{
+   return _mm_castsi128_ps( _mm_srli_epi32( _mm_castps_si128( a.value ), N ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Logical right shift of the bits of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The operand to be shifted by \a N bits.
+// \return The shifted bit patterns.
+*/
+#if BLAZE_AVX2_MODE
+template< int N >  // Number of bits to shift
+inline sse_double_t shiftRight( const sse_double_t& a )
+{
+   return _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a.value ), N ) );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+template< int N >  // Number of bits to shift
+inline sse_double_t shiftRight( const sse_double_t& a )
+{
+   return _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a.value ), N ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC COMPARISON OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Less-than comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t lessThan( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t lessThan( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmplt_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Less-than comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t lessThan( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t lessThan( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmplt_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Greater-than comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t greaterThan( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_GT_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t greaterThan( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpgt_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Greater-than comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t greaterThan( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_GT_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t greaterThan( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpgt_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Equality comparison of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t equalTo( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t equalTo( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpeq_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Equality comparison of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t equalTo( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t equalTo( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpeq_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unordered comparison (NaN test) of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t unordered( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_UNORD_Q );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t unordered( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpunord_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unordered comparison (NaN test) of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting mask (all bits set in case the comparison is true).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t unordered( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_UNORD_Q );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t unordered( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpunord_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mask-based selection between two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param mask The selection mask (the result of a comparison).
+// \param a The values selected in case the mask is set.
+// \param b The values selected in case the mask is not set.
+// \return The selected values.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t blend( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_blendv_ps( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t blend( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_or_ps( _mm_and_ps( mask.value, a.value ), _mm_andnot_ps( mask.value, b.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Mask-based selection between two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param mask The selection mask (the result of a comparison).
+// \param a The values selected in case the mask is set.
+// \param b The values selected in case the mask is not set.
+// \return The selected values.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t blend( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_blendv_pd( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t blend( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_or_pd( _mm_and_pd( mask.value, a.value ), _mm_andnot_pd( mask.value, b.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The minimum values (the value of \a b in case any operand is NaN).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t minimum( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_min_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t minimum( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_min_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The minimum values (the value of \a b in case any operand is NaN).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t minimum( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_min_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t minimum( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_min_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum of two vectors of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The maximum values (the value of \a b in case any operand is NaN).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_float_t maximum( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_max_ps( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_float_t maximum( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_max_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Maximum of two vectors of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The maximum values (the value of \a b in case any operand is NaN).
+*/
+#if BLAZE_AVX2_MODE
+inline sse_double_t maximum( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_max_pd( a.value, b.value );
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline sse_double_t maximum( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_max_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any element of a comparison mask of single precision values is set.
+// \ingroup intrinsics
+//
+// \param mask The comparison mask.
+// \return \a true in case any element of the mask is set, \a false if not.
+*/
+#if BLAZE_AVX2_MODE
+inline bool anyOf( const sse_float_t& mask )
+{
+   return _mm256_movemask_ps( mask.value ) != 0;
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline bool anyOf( const sse_float_t& mask )
+{
+   return _mm_movemask_ps( mask.value ) != 0;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any element of a comparison mask of double precision values is set.
+// \ingroup intrinsics
+//
+// \param mask The comparison mask.
+// \return \a true in case any element of the mask is set, \a false if not.
+*/
+#if BLAZE_AVX2_MODE
+inline bool anyOf( const sse_double_t& mask )
+{
+   return _mm256_movemask_pd( mask.value ) != 0;
+}
+#elif BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE
+inline bool anyOf( const sse_double_t& mask )
+{
+   return _mm_movemask_pd( mask.value ) != 0;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC ROUNDING AND SCALING FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE )
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding a vector of single precision floating point values to the nearest integers.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values \f$ (|a| < 2^{22}) \f$.
+// \return The rounded values.
+//
+// The rounding is performed by adding and subtracting the magic number \f$ 1.5 \cdot 2^{23} \f$,
+// which shifts all fractional digits out of the mantissa (assuming the default rounding mode).
+*/
+inline sse_float_t roundToInteger( const sse_float_t& a )
+{
+   const sse_float_t magic( set( 12582912.0F ) );
+   return ( a + magic ) - magic;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding a vector of double precision floating point values to the nearest integers.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values \f$ (|a| < 2^{51}) \f$.
+// \return The rounded values.
+//
+// The rounding is performed by adding and subtracting the magic number \f$ 1.5 \cdot 2^{52} \f$,
+// which shifts all fractional digits out of the mantissa (assuming the default rounding mode).
+*/
+inline sse_double_t roundToInteger( const sse_double_t& a )
+{
+   const sse_double_t magic( set( 6755399441055744.0 ) );
+   return ( a + magic ) - magic;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding a vector of single precision floating point values down to the next integers.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values \f$ (|a| < 2^{22}) \f$.
+// \return The rounded values.
+*/
+inline sse_float_t floorToInteger( const sse_float_t& a )
+{
+   const sse_float_t r( roundToInteger( a ) );
+   return r - andBits( greaterThan( r, a ), set( 1.0F ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding a vector of double precision floating point values down to the next integers.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values \f$ (|a| < 2^{51}) \f$.
+// \return The rounded values.
+*/
+inline sse_double_t floorToInteger( const sse_double_t& a )
+{
+   const sse_double_t r( roundToInteger( a ) );
+   return r - andBits( greaterThan( r, a ), set( 1.0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of \f$ 2^n \f$ for a vector of integral single precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range \f$ [-126..127] \f$.
+// \return The resulting powers of two.
+//
+// The biased exponent is placed in the lower bits of the mantissa by adding the magic number
+// \f$ 2^{23}+127 \f$ and afterwards shifted into the exponent field.
+*/
+inline sse_float_t pow2( const sse_float_t& n )
+{
+   return shiftLeft<23>( n + set( 8388735.0F ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of \f$ 2^n \f$ for a vector of integral double precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range \f$ [-1022..1023] \f$.
+// \return The resulting powers of two.
+//
+// The biased exponent is placed in the lower bits of the mantissa by adding the magic number
+// \f$ 2^{52}+1023 \f$ and afterwards shifted into the exponent field.
+*/
+inline sse_double_t pow2( const sse_double_t& n )
+{
+   return shiftLeft<52>( n + set( 4503599627371519.0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling a vector of single precision values by integral powers of two.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \param n The vector of integral exponents in the range \f$ [-252..254] \f$.
+// \return The scaled values \f$ a \cdot 2^n \f$.
+//
+// The scaling is performed in two steps in order to cover the entire range of exponents from
+// the smallest subnormal to the largest finite value without overflowing the exponent field.
+*/
+inline sse_float_t scale( const sse_float_t& a, const sse_float_t& n )
+{
+   const sse_float_t m( roundToInteger( n * set( 0.5F ) ) );
+   return ( a * pow2( m ) ) * pow2( n - m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling a vector of double precision values by integral powers of two.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \param n The vector of integral exponents in the range \f$ [-2044..2046] \f$.
+// \return The scaled values \f$ a \cdot 2^n \f$.
+//
+// The scaling is performed in two steps in order to cover the entire range of exponents from
+// the smallest subnormal to the largest finite value without overflowing the exponent field.
+*/
+inline sse_double_t scale( const sse_double_t& a, const sse_double_t& n )
+{
+   const sse_double_t m( roundToInteger( n * set( 0.5 ) ) );
+   return ( a * pow2( m ) ) * pow2( n - m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splitting a vector of normalized single precision values into mantissa and exponent.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, finite and normalized single precision values.
+// \param e The resulting exponents.
+// \return The resulting mantissas in the range \f$ [0.5..1) \f$.
+*/
+inline sse_float_t decompose( const sse_float_t& a, sse_float_t& e )
+{
+   const sse_float_t magic( set( 8388608.0F ) );
+   e = orBits( shiftRight<23>( a ), magic ) - ( magic + set( 126.0F ) );
+   return orBits( andnotBits( set( std::numeric_limits<float>::infinity() ), a ), set( 0.5F ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splitting a vector of normalized double precision values into mantissa and exponent.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, finite and normalized double precision values.
+// \param e The resulting exponents.
+// \return The resulting mantissas in the range \f$ [0.5..1) \f$.
+*/
+inline sse_double_t decompose( const sse_double_t& a, sse_double_t& e )
+{
+   const sse_double_t magic( set( 4503599627370496.0 ) );
+   e = orBits( shiftRight<52>( a ), magic ) - ( magic + set( 1022.0 ) );
+   return orBits( andnotBits( set( std::numeric_limits<double>::infinity() ), a ), set( 0.5 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
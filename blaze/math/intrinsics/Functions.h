@@ -42,17 +42,29 @@
 
 #include <blaze/math/intrinsics/Abs.h>
 #include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/Conversion.h>
 #include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/Exp.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/Gather.h>
+#include <blaze/math/intrinsics/Hyperbolic.h>
 #include <blaze/math/intrinsics/Load.h>
 #include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/math/intrinsics/Log.h>
+#include <blaze/math/intrinsics/Madd.h>
+#include <blaze/math/intrinsics/Maximum.h>
+#include <blaze/math/intrinsics/Minimum.h>
 #include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Pow.h>
 #include <blaze/math/intrinsics/Reduction.h>
 #include <blaze/math/intrinsics/Set.h>
 #include <blaze/math/intrinsics/Setzero.h>
+#include <blaze/math/intrinsics/Sqrt.h>
 #include <blaze/math/intrinsics/Store.h>
 #include <blaze/math/intrinsics/Storeu.h>
 #include <blaze/math/intrinsics/Stream.h>
 #include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/math/intrinsics/Trigonometric.h>
 
 
 namespace blaze {
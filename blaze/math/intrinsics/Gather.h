@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+//*************************************************************************************************
+// Macro definitions
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compilation switch for the AVX2 gather instructions.
+// \ingroup intrinsics
+//
+// The AVX2 gather instructions are used with 64-bit indices that directly encode the addresses
+// of the gathered elements. Therefore they are only available on 64-bit x86 platforms.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE && ( defined(__x86_64__) || defined(_M_X64) )
+#  define BLAZE_AVX2_GATHER_MODE 1
+#else
+#  define BLAZE_AVX2_GATHER_MODE 0
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of values from arbitrary memory locations.
+// \ingroup intrinsics
+//
+// \param addresses The addresses of the elements to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values at the given \a IntrinsicTrait<T>::size addresses into a single
+// intrinsic vector. The addresses don't have to be contiguous or aligned. This default version
+// collects the elements in a local array, which is subsequently loaded via an unaligned load.
+*/
+template< typename T >  // Type of the elements
+inline typename IntrinsicTrait<T>::Type gather( const T* const* addresses )
+{
+   T array[IntrinsicTrait<T>::size];
+   for( size_t k=0UL; k<IntrinsicTrait<T>::size; ++k )
+      array[k] = *addresses[k];
+   return loadu( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values from arbitrary memory locations.
+// \ingroup intrinsics
+//
+// \param addresses The addresses of the 'float' values to be gathered.
+// \return The vector of gathered 'float' values.
+//
+// This function loads the 'float' values at the given addresses into a single intrinsic vector.
+// In case AVX2 is available, the values are collected by two gather instructions, each fetching
+// four values.
+*/
+inline sse_float_t gather( const float* const* addresses )
+{
+#if BLAZE_AVX2_GATHER_MODE
+   const __m256i lo( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( addresses     ) ) );
+   const __m256i hi( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( addresses+4UL ) ) );
+   const __m128 a( _mm256_i64gather_ps( static_cast<const float*>( 0 ), lo, 1 ) );
+   const __m128 b( _mm256_i64gather_ps( static_cast<const float*>( 0 ), hi, 1 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( a ), b, 1 );
+#else
+   return gather<float>( addresses );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values from arbitrary memory locations.
+// \ingroup intrinsics
+//
+// \param addresses The addresses of the 'double' values to be gathered.
+// \return The vector of gathered 'double' values.
+//
+// This function loads the 'double' values at the given addresses into a single intrinsic vector.
+// In case AVX2 is available, the values are collected by a single gather instruction.
+*/
+inline sse_double_t gather( const double* const* addresses )
+{
+#if BLAZE_AVX2_GATHER_MODE
+   const __m256i index( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( addresses ) ) );
+   return _mm256_i64gather_pd( static_cast<const double*>( 0 ), index, 1 );
+#else
+   return gather<double>( addresses );
+#endif
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of values via an array of 8-bit indices.
+// \ingroup intrinsics
+//
+// \param base The address of the first element of the indexed array.
+// \param indices The \a IntrinsicTrait<T>::size indices of the elements to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the values \c base[indices[0]], \c base[indices[1]], ... into a single
+// intrinsic vector. This default version collects the elements in a local array, which is
+// subsequently loaded via an unaligned load.
+*/
+template< typename T >  // Type of the elements
+inline typename IntrinsicTrait<T>::Type gather( const T* base, const uint8_t* indices )
+{
+   T array[IntrinsicTrait<T>::size];
+   for( size_t k=0UL; k<IntrinsicTrait<T>::size; ++k )
+      array[k] = base[indices[k]];
+   return loadu( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of 8-bit indices.
+// \ingroup intrinsics
+//
+// \param base The address of the first element of the indexed array.
+// \param indices The indices of the 'float' values to be gathered.
+// \return The vector of gathered 'float' values.
+//
+// In case AVX2 is available, the eight indices are zero extended to 32-bit and the values are
+// collected by a single gather instruction.
+*/
+inline sse_float_t gather( const float* base, const uint8_t* indices )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   const __m128i bytes( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( indices ) ) );
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), base, _mm256_cvtepu8_epi32( bytes ),
+                                    _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ), 4 );
+#else
+   return gather<float>( base, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of 8-bit indices.
+// \ingroup intrinsics
+//
+// \param base The address of the first element of the indexed array.
+// \param indices The indices of the 'double' values to be gathered.
+// \return The vector of gathered 'double' values.
+//
+// In case AVX2 is available, the four indices are zero extended to 32-bit and the values are
+// collected by a single gather instruction.
+*/
+inline sse_double_t gather( const double* base, const uint8_t* indices )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   int32_t bytes;
+   std::memcpy( &bytes, indices, sizeof( bytes ) );
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), base,
+                                    _mm_cvtepu8_epi32( _mm_cvtsi32_si128( bytes ) ),
+                                    _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ), 8 );
+#else
+   return gather<double>( base, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DELTA GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inclusive prefix sum of four packed 32-bit integral values.
+// \ingroup intrinsics
+//
+// \param a The four 32-bit integral values.
+// \return The four prefix sums \f$ (a_0, a_0+a_1, a_0+a_1+a_2, a_0+a_1+a_2+a_3) \f$.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline __m128i prefixsum( __m128i a )
+{
+   a = _mm_add_epi32( a, _mm_slli_si128( a, 4 ) );
+   return _mm_add_epi32( a, _mm_slli_si128( a, 8 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gathers eight 'float' values via four plus four zero extended 32-bit deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param lo The first four deltas.
+// \param hi The second four deltas.
+// \return The vector of gathered 'float' values.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline sse_float_t dgather( const float*& address, __m128i lo, __m128i hi )
+{
+   lo = prefixsum( lo );
+   hi = _mm_add_epi32( prefixsum( hi ), _mm_shuffle_epi32( lo, 0xFF ) );
+   const __m256i index( _mm256_inserti128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+   const __m256 mask( _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ) );
+   const __m256 zero( _mm256_setzero_ps() );
+   const sse_float_t res( _mm256_mask_i32gather_ps( zero, address, index, mask, 4 ) );
+   address += _mm_extract_epi32( hi, 3 );
+   return res;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gathers four 'double' values via four zero extended 32-bit deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The four deltas.
+// \return The vector of gathered 'double' values.
+*/
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+inline sse_double_t dgather( const double*& address, __m128i deltas )
+{
+   const __m256d mask( _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ) );
+   deltas = prefixsum( deltas );
+   const __m256d zero( _mm256_setzero_pd() );
+   const sse_double_t res( _mm256_mask_i32gather_pd( zero, address, deltas, mask, 8 ) );
+   address += _mm_extract_epi32( deltas, 3 );
+   return res;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of values via an array of address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The \a IntrinsicTrait<T>::size deltas between the gathered elements.
+// \return The vector of gathered values.
+//
+// This function gathers the values at the addresses \c address+deltas[0],
+// \c address+deltas[0]+deltas[1], ... into a single intrinsic vector and advances \a address to
+// the address of the last gathered element. Thus consecutive calls decode a delta encoded index
+// sequence, as for instance the column indices of a row of a DeltaCompressedMatrix. The sum of
+// the deltas must fit into a signed 32-bit integral value. This default version collects the
+// elements in a local array, which is subsequently loaded via an unaligned load.
+*/
+template< typename T    // Type of the elements
+        , typename D >  // Type of the deltas
+inline typename IntrinsicTrait<T>::Type dgather( const T*& address, const D* deltas )
+{
+   T array[IntrinsicTrait<T>::size];
+   for( size_t k=0UL; k<IntrinsicTrait<T>::size; ++k ) {
+      address += deltas[k];
+      array[k] = *address;
+   }
+   return loadu( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of 8-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'float' values.
+// \return The vector of gathered 'float' values.
+//
+// In case AVX2 is available, the deltas are zero extended and decoded via a vectorized prefix
+// sum, and the values are collected by a single gather instruction.
+*/
+inline sse_float_t dgather( const float*& address, const uint8_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   const __m128i bytes( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( deltas ) ) );
+   return dgather( address, _mm_cvtepu8_epi32( bytes ),
+                            _mm_cvtepu8_epi32( _mm_srli_si128( bytes, 4 ) ) );
+#else
+   return dgather<float,uint8_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of 16-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'float' values.
+// \return The vector of gathered 'float' values.
+//
+// In case AVX2 is available, the deltas are zero extended and decoded via a vectorized prefix
+// sum, and the values are collected by a single gather instruction.
+*/
+inline sse_float_t dgather( const float*& address, const uint16_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   const __m128i words( _mm_loadu_si128( reinterpret_cast<const __m128i*>( deltas ) ) );
+   return dgather( address, _mm_cvtepu16_epi32( words ),
+                            _mm_cvtepu16_epi32( _mm_srli_si128( words, 8 ) ) );
+#else
+   return dgather<float,uint16_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via an array of 32-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'float' values.
+// \return The vector of gathered 'float' values.
+//
+// In case AVX2 is available, the deltas are decoded via a vectorized prefix sum and the values
+// are collected by a single gather instruction.
+*/
+inline sse_float_t dgather( const float*& address, const uint32_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   return dgather( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( deltas     ) ),
+                            _mm_loadu_si128( reinterpret_cast<const __m128i*>( deltas+4UL ) ) );
+#else
+   return dgather<float,uint32_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of 8-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'double' values.
+// \return The vector of gathered 'double' values.
+//
+// In case AVX2 is available, the deltas are zero extended and decoded via a vectorized prefix
+// sum, and the values are collected by a single gather instruction.
+*/
+inline sse_double_t dgather( const double*& address, const uint8_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   int32_t bytes;
+   std::memcpy( &bytes, deltas, sizeof( bytes ) );
+   return dgather( address, _mm_cvtepu8_epi32( _mm_cvtsi32_si128( bytes ) ) );
+#else
+   return dgather<double,uint8_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of 16-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'double' values.
+// \return The vector of gathered 'double' values.
+//
+// In case AVX2 is available, the deltas are zero extended and decoded via a vectorized prefix
+// sum, and the values are collected by a single gather instruction.
+*/
+inline sse_double_t dgather( const double*& address, const uint16_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   const __m128i words( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( deltas ) ) );
+   return dgather( address, _mm_cvtepu16_epi32( words ) );
+#else
+   return dgather<double,uint16_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via an array of 32-bit address deltas.
+// \ingroup intrinsics
+//
+// \param address Reference to the address preceding the first element to be gathered.
+// \param deltas The deltas between the gathered 'double' values.
+// \return The vector of gathered 'double' values.
+//
+// In case AVX2 is available, the deltas are decoded via a vectorized prefix sum and the values
+// are collected by a single gather instruction.
+*/
+inline sse_double_t dgather( const double*& address, const uint32_t* deltas )
+{
+#if BLAZE_AVX2_MODE && !BLAZE_MIC_MODE
+   return dgather( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( deltas ) ) );
+#else
+   return dgather<double,uint32_t>( address, deltas );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -85,7 +85,11 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #else
 template<>
@@ -97,7 +101,11 @@ struct IntrinsicTraitHelper<1UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #endif
 /*! \endcond */
@@ -119,7 +127,11 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #else
 template<>
@@ -131,7 +143,11 @@ struct IntrinsicTraitHelper<2UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #endif
 /*! \endcond */
@@ -153,7 +169,11 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -165,7 +185,11 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 1 };
+          absoluteValue  = 1,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #else
 template<>
@@ -177,7 +201,11 @@ struct IntrinsicTraitHelper<4UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE4_MODE,
           division       = 0,
-          absoluteValue  = BLAZE_SSSE3_MODE };
+          absoluteValue  = BLAZE_SSSE3_MODE,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #endif
 /*! \endcond */
@@ -199,7 +227,11 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 0,
           multiplication = 0,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #elif BLAZE_AVX2_MODE
 template<>
@@ -211,7 +243,11 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #else
 template<>
@@ -223,7 +259,11 @@ struct IntrinsicTraitHelper<8UL>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #endif
 /*! \endcond */
@@ -253,7 +293,11 @@ struct IntrinsicTraitBase
           subtraction    = 0,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -278,7 +322,11 @@ struct IntrinsicTraitBase<char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -303,7 +351,11 @@ struct IntrinsicTraitBase<signed char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -328,7 +380,11 @@ struct IntrinsicTraitBase<unsigned char>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -353,7 +409,11 @@ struct IntrinsicTraitBase<wchar_t>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -378,7 +438,11 @@ struct IntrinsicTraitBase<short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -403,7 +467,11 @@ struct IntrinsicTraitBase<unsigned short>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -428,7 +496,11 @@ struct IntrinsicTraitBase<int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -453,7 +525,11 @@ struct IntrinsicTraitBase<unsigned int>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -478,7 +554,11 @@ struct IntrinsicTraitBase<long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -503,7 +583,11 @@ struct IntrinsicTraitBase<unsigned long>
           subtraction    = Helper::subtraction,
           multiplication = Helper::multiplication,
           division       = Helper::division,
-          absoluteValue  = Helper::absoluteValue };
+          absoluteValue  = Helper::absoluteValue,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -524,7 +608,11 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 1,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -537,7 +625,11 @@ struct IntrinsicTraitBase<float>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 1,
+          squareRoot     = 1,
+          transcendental = BLAZE_AVX2_MODE,
+          minimum        = 1,
+          maximum        = 1 };
 };
 #else
 template<>
@@ -550,7 +642,11 @@ struct IntrinsicTraitBase<float>
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE_MODE,
           division       = BLAZE_SSE_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = BLAZE_SSE_MODE,
+          squareRoot     = BLAZE_SSE_MODE,
+          transcendental = BLAZE_SSE2_MODE,
+          minimum        = BLAZE_SSE_MODE,
+          maximum        = BLAZE_SSE_MODE };
 };
 #endif
 /*! \endcond */
@@ -573,7 +669,11 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 1,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 };
 #elif BLAZE_AVX_MODE
 template<>
@@ -586,7 +686,11 @@ struct IntrinsicTraitBase<double>
           subtraction    = 1,
           multiplication = 1,
           division       = 1,
-          absoluteValue  = 0 };
+          absoluteValue  = 1,
+          squareRoot     = 1,
+          transcendental = BLAZE_AVX2_MODE,
+          minimum        = 1,
+          maximum        = 1 };
 };
 #else
 template<>
@@ -599,13 +703,81 @@ struct IntrinsicTraitBase<double>
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE2_MODE,
           division       = BLAZE_SSE2_MODE,
-          absoluteValue  = 0 };
+          absoluteValue  = BLAZE_SSE2_MODE,
+          squareRoot     = BLAZE_SSE2_MODE,
+          transcendental = BLAZE_SSE2_MODE,
+          minimum        = BLAZE_SSE2_MODE,
+          maximum        = BLAZE_SSE2_MODE };
 };
 #endif
 /*! \endcond */
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicTraitBase class template for 'float16'.
+// \ingroup intrinsics
+//
+// Half precision values are only stored and loaded via intrinsics. All arithmetic operations
+// are performed after the conversion to single precision (see the IntrinsicConversionTrait).
+*/
+template<>
+struct IntrinsicTraitBase<float16>
+{
+ private:
+   typedef IntrinsicTraitHelper<sizeof(float16)>  Helper;
+
+ public:
+   typedef sse_float16_t  Type;
+   enum { size           = Helper::size,
+          alignment      = AlignmentTrait<float16>::value,
+          addition       = 0,
+          subtraction    = 0,
+          multiplication = 0,
+          division       = 0,
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IntrinsicTraitBase class template for 'bfloat16'.
+// \ingroup intrinsics
+//
+// Bfloat16 values are only stored and loaded via intrinsics. All arithmetic operations
+// are performed after the conversion to single precision (see the IntrinsicConversionTrait).
+*/
+template<>
+struct IntrinsicTraitBase<bfloat16>
+{
+ private:
+   typedef IntrinsicTraitHelper<sizeof(bfloat16)>  Helper;
+
+ public:
+   typedef sse_bfloat16_t  Type;
+   enum { size           = Helper::size,
+          alignment      = AlignmentTrait<bfloat16>::value,
+          addition       = 0,
+          subtraction    = 0,
+          multiplication = 0,
+          division       = 0,
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the IntrinsicTraitBase class template for 'complex<float>'.
@@ -622,7 +794,11 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -637,7 +813,11 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -652,7 +832,11 @@ struct IntrinsicTraitBase< complex<float> >
           subtraction    = BLAZE_SSE_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 };
@@ -677,7 +861,11 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 0,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -692,7 +880,11 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = 1,
           multiplication = 1,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -707,7 +899,11 @@ struct IntrinsicTraitBase< complex<double> >
           subtraction    = BLAZE_SSE2_MODE,
           multiplication = BLAZE_SSE3_MODE,
           division       = 0,
-          absoluteValue  = 0 };
+          absoluteValue  = 0,
+          squareRoot     = 0,
+          transcendental = 0,
+          minimum        = 0,
+          maximum        = 0 };
 
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 };
@@ -743,6 +939,19 @@ struct IntrinsicTraitBase< complex<double> >
 //    Else it is set to 0.
 //  - If the data type supports vectorized multiplications, the \a multiplication value is set to
 //    1. If it cannot be used in multiplications, it is set to 0.
+//  - In case the data type supports vectorized divisions, the \a division value is set to 1.
+//    Else it is set to 0.
+//  - If the absolute value of the data type can be computed vectorized, the \a absoluteValue
+//    value is set to 1. Otherwise, \a absoluteValue is set to 0.
+//  - If the square root of the data type can be computed vectorized, the \a squareRoot value
+//    is set to 1. Otherwise, \a squareRoot is set to 0.
+//  - In case the data type supports the vectorized evaluation of the transcendental functions
+//    (exp(), log(), pow(), sin(), cos() and tanh()), the \a transcendental value is set to 1.
+//    Else it is set to 0.
+//  - If the element-wise minimum of two intrinsic vectors of the data type can be computed, the
+//    \a minimum value is set to 1. Otherwise, \a minimum is set to 0.
+//  - If the element-wise maximum of two intrinsic vectors of the data type can be computed, the
+//    \a maximum value is set to 1. Otherwise, \a maximum is set to 0.
 */
 template< typename T >
 class IntrinsicTrait : public IntrinsicTraitBase< typename RemoveCV<T>::Type >
@@ -83,6 +83,43 @@ struct Load;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Load class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Load<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline Type load( const T* address )
+   {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+      return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+      return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+      return *address;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Load class template for 2-byte integral data types.
@@ -282,6 +319,58 @@ inline sse_double_t load( const double* address )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float16' values.
+// \ingroup intrinsics
+//
+// \param address The first 'float16' value to be loaded.
+// \return The loaded vector of 'float16' values.
+//
+// This function loads a vector of 'float16' values. The given address must be aligned according
+// to the enabled instruction set (16-byte alignment in case of SSE and AVX, 32-byte alignment in
+// case of AVX2).
+*/
+inline sse_float16_t load( const float16* address )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'bfloat16' values.
+// \ingroup intrinsics
+//
+// \param address The first 'bfloat16' value to be loaded.
+// \return The loaded vector of 'bfloat16' values.
+//
+// This function loads a vector of 'bfloat16' values. The given address must be aligned according
+// to the enabled instruction set (16-byte alignment in case of SSE and AVX, 32-byte alignment in
+// case of AVX2).
+*/
+inline sse_bfloat16_t load( const bfloat16* address )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 'complex<float>' values.
 // \ingroup intrinsics
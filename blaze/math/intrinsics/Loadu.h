@@ -81,6 +81,41 @@ struct Loadu;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Loadu class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Loadu<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline Type loadu( const T* address )
+   {
+#if BLAZE_AVX2_MODE
+      return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+      return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+      return *address;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Loadu class template for 2-byte integral data types.
@@ -279,6 +314,52 @@ inline sse_double_t loadu( const double* address )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float16' values.
+// \ingroup intrinsics
+//
+// \param address The first 'float16' value to be loaded.
+// \return The loaded vector of 'float16' values.
+//
+// This function loads a vector of 'float16' values. In contrast to the according load function,
+// the given address is not required to be properly aligned.
+*/
+inline sse_float16_t loadu( const float16* address )
+{
+#if BLAZE_AVX2_MODE
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'bfloat16' values.
+// \ingroup intrinsics
+//
+// \param address The first 'bfloat16' value to be loaded.
+// \return The loaded vector of 'bfloat16' values.
+//
+// This function loads a vector of 'bfloat16' values. In contrast to the according load function,
+// the given address is not required to be properly aligned.
+*/
+inline sse_bfloat16_t loadu( const bfloat16* address )
+{
+#if BLAZE_AVX2_MODE
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
+#elif BLAZE_SSE2_MODE
+   return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
+#else
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Loads a vector of 'complex<float>' values.
 // \ingroup intrinsics
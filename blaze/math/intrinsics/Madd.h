@@ -0,0 +1,102 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Madd.h
+//  \brief Header file for the widening intrinsic multiply-add functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MADD_H_
+#define _BLAZE_MATH_INTRINSICS_MADD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MULTIPLY-ADD OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\fn sse_int32_t madd( sse_int8_t, sse_int8_t )
+// \brief Widening multiplication of two vectors of 8-bit integral values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The vector of 32-bit partial sums of the products.
+//
+// This function multiplies all 8-bit integral values of the two given vectors and accumulates
+// each group of four products into one 32-bit integral value. The operands are sign extended
+// to 16-bit prior to the multiplication, such that the result is exact for all possible input
+// values. Therefore the sum of all elements of the resulting vector is the exact dot product
+// of the two operands.
+*/
+#if BLAZE_AVX2_MODE
+inline sse_int32_t madd( const sse_int8_t& a, const sse_int8_t& b )
+{
+   const __m256i alo( _mm256_cvtepi8_epi16( _mm256_castsi256_si128( a.value ) ) );
+   const __m256i ahi( _mm256_cvtepi8_epi16( _mm256_extracti128_si256( a.value, 1 ) ) );
+   const __m256i blo( _mm256_cvtepi8_epi16( _mm256_castsi256_si128( b.value ) ) );
+   const __m256i bhi( _mm256_cvtepi8_epi16( _mm256_extracti128_si256( b.value, 1 ) ) );
+   return _mm256_add_epi32( _mm256_madd_epi16( alo, blo ), _mm256_madd_epi16( ahi, bhi ) );
+}
+#elif BLAZE_SSE4_MODE
+inline sse_int32_t madd( const sse_int8_t& a, const sse_int8_t& b )
+{
+   const __m128i alo( _mm_cvtepi8_epi16( a.value ) );
+   const __m128i ahi( _mm_cvtepi8_epi16( _mm_srli_si128( a.value, 8 ) ) );
+   const __m128i blo( _mm_cvtepi8_epi16( b.value ) );
+   const __m128i bhi( _mm_cvtepi8_epi16( _mm_srli_si128( b.value, 8 ) ) );
+   return _mm_add_epi32( _mm_madd_epi16( alo, blo ), _mm_madd_epi16( ahi, bhi ) );
+}
+#elif BLAZE_SSE2_MODE
+inline sse_int32_t madd( const sse_int8_t& a, const sse_int8_t& b )
+{
+   const __m128i alo( _mm_srai_epi16( _mm_unpacklo_epi8( a.value, a.value ), 8 ) );
+   const __m128i ahi( _mm_srai_epi16( _mm_unpackhi_epi8( a.value, a.value ), 8 ) );
+   const __m128i blo( _mm_srai_epi16( _mm_unpacklo_epi8( b.value, b.value ), 8 ) );
+   const __m128i bhi( _mm_srai_epi16( _mm_unpackhi_epi8( b.value, b.value ), 8 ) );
+   return _mm_add_epi32( _mm_madd_epi16( alo, blo ), _mm_madd_epi16( ahi, bhi ) );
+}
+#endif
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
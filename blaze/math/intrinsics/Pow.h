@@ -0,0 +1,182 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Pow.h
+//  \brief Header file for the intrinsic power functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_POW_H_
+#define _BLAZE_MATH_INTRINSICS_POW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/Exp.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Log.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC POWER FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE )
+
+//*************************************************************************************************
+/*!\brief Power function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point bases.
+// \param b The single precision floating point exponent.
+// \return The power values \f$ a^b \f$.
+//
+// Integral exponents with an absolute value of up to 64 are evaluated by repeated squaring. For all
+// other exponents the power is computed as \f$ e^{b \cdot ln|a|} \f$, where the sign of the result
+// is restored for odd integral exponents and negative finite bases with non-integral exponents
+// result in NaN. Note that the relative error grows with the magnitude of \f$ b \cdot ln|a| \f$ (up
+// to about 100 ulp for results close to the limits of the floating point range). In case of a
+// non-finite exponent the power values are computed via the standard library.
+*/
+inline sse_float_t pow( const sse_float_t& a, float b )
+{
+   typedef IntrinsicTrait<float>  IT;
+
+   if( b == 0.0F ) {
+      return set( 1.0F );
+   }
+
+   if( !( std::fabs( b ) <= std::numeric_limits<float>::max() ) ) {
+      sse_float_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::pow( a[i], b );
+      return res;
+   }
+
+   if( std::floor( b ) == b && std::fabs( b ) <= 64.0F ) {
+      sse_float_t res( set( 1.0F ) );
+      sse_float_t x( a );
+      for( size_t n=static_cast<size_t>( std::fabs( b ) ); n!=0UL; n/=2UL ) {
+         if( n & 1UL ) res = res * x;
+         x = x * x;
+      }
+      return ( b < 0.0F )?( set( 1.0F ) / res ):( res );
+   }
+
+   const sse_float_t sign( set( -0.0F ) );
+   const sse_float_t res( exp( set( b ) * log( andnotBits( sign, a ) ) ) );
+
+   if( std::floor( b ) != b ) {
+      const sse_float_t finite( greaterThan( a, set( -std::numeric_limits<float>::infinity() ) ) );
+      return blend( andBits( lessThan( a, set( 0.0F ) ), finite ),
+                    set( std::numeric_limits<float>::quiet_NaN() ), res );
+   }
+   else if( std::fmod( b, 2.0F ) != 0.0F ) {
+      return orBits( res, andBits( a, sign ) );
+   }
+   else return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Power function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point bases.
+// \param b The double precision floating point exponent.
+// \return The power values \f$ a^b \f$.
+//
+/// ntegral exponents with an absolute value of up to 64 are evaluated by repeated squaring. For all
+// other exponents the power is computed as \f$ e^{b \cdot ln|a|} \f$, where the sign of the result
+// is restored for odd integral exponents and negative finite bases with non-integral exponents
+// result in NaN. Note that the relative error grows with the magnitude of \f$ b \cdot ln|a| \f$ (up
+// to about 700 ulp for results close to the limits of the floating point range). In case of a
+// non-finite exponent the power values are computed via the standard library.
+*/
+inline sse_double_t pow( const sse_double_t& a, double b )
+{
+   typedef IntrinsicTrait<double>  IT;
+
+   if( b == 0.0 ) {
+      return set( 1.0 );
+   }
+
+   if( !( std::fabs( b ) <= std::numeric_limits<double>::max() ) ) {
+      sse_double_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::pow( a[i], b );
+      return res;
+   }
+
+   if( std::floor( b ) == b && std::fabs( b ) <= 64.0 ) {
+      sse_double_t res( set( 1.0 ) );
+      sse_double_t x( a );
+      for( size_t n=static_cast<size_t>( std::fabs( b ) ); n!=0UL; n/=2UL ) {
+         if( n & 1UL ) res = res * x;
+         x = x * x;
+      }
+      return ( b < 0.0 )?( set( 1.0 ) / res ):( res );
+   }
+
+   const sse_double_t sign( set( -0.0 ) );
+   const sse_double_t res( exp( set( b ) * log( andnotBits( sign, a ) ) ) );
+
+   if( std::floor( b ) != b ) {
+      const sse_double_t finite( greaterThan( a, set( -std::numeric_limits<double>::infinity() ) ) );
+      return blend( andBits( lessThan( a, set( 0.0 ) ), finite ),
+                    set( std::numeric_limits<double>::quiet_NaN() ), res );
+   }
+   else if( std::fmod( b, 2.0 ) != 0.0 ) {
+      return orBits( res, andBits( a, sign ) );
+   }
+   else return res;
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
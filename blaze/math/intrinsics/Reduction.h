@@ -62,11 +62,12 @@ namespace blaze {
 inline int16_t sum( const sse_int16_t& a )
 {
 #if BLAZE_AVX2_MODE
-   const sse_int16_t b( _mm256_hadd_epi16( a.value, a.value ) );
-   const sse_int16_t c( _mm256_hadd_epi16( b.value, b.value ) );
-   const sse_int16_t d( _mm256_hadd_epi16( c.value, c.value ) );
-   const sse_int16_t e( _mm256_hadd_epi16( d.value, d.value ) );
-   return e[0];
+   const __m128i b = _mm_add_epi16( _mm256_extracti128_si256( a.value, 1 )
+                                  , _mm256_castsi256_si128( a.value ) );
+   const __m128i c = _mm_hadd_epi16( b, b );
+   const __m128i d = _mm_hadd_epi16( c, c );
+   const __m128i e = _mm_hadd_epi16( d, d );
+   return static_cast<int16_t>( _mm_cvtsi128_si32( e ) );
 #elif BLAZE_SSSE3_MODE
    const sse_int16_t b( _mm_hadd_epi16( a.value, a.value ) );
    const sse_int16_t c( _mm_hadd_epi16( b.value, b.value ) );
@@ -93,10 +94,11 @@ inline int32_t sum( const sse_int32_t& a )
 #if BLAZE_MIC_MODE
    return _mm512_reduce_add_epi32( a.value );
 #elif BLAZE_AVX2_MODE
-   const sse_int32_t b( _mm256_hadd_epi32( a.value, a.value ) );
-   const sse_int32_t c( _mm256_hadd_epi32( b.value, b.value ) );
-   const sse_int32_t d( _mm256_hadd_epi32( c.value, c.value ) );
-   return d[0];
+   const __m128i b = _mm_add_epi32( _mm256_extracti128_si256( a.value, 1 )
+                                  , _mm256_castsi256_si128( a.value ) );
+   const __m128i c = _mm_hadd_epi32( b, b );
+   const __m128i d = _mm_hadd_epi32( c, c );
+   return _mm_cvtsi128_si32( d );
 #elif BLAZE_SSSE3_MODE
    const sse_int32_t b( _mm_hadd_epi32( a.value, a.value ) );
    const sse_int32_t c( _mm_hadd_epi32( b.value, b.value ) );
@@ -80,6 +80,41 @@ struct Set;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Set class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Set<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline Type set( T value )
+   {
+#if BLAZE_AVX2_MODE
+      return _mm256_set1_epi8( value );
+#elif BLAZE_SSE2_MODE
+      return _mm_set1_epi8( value );
+#else
+      return value;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Set class template for 2-byte integral data types.
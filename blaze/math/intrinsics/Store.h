@@ -83,6 +83,43 @@ struct Store;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Store class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Store<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline void store( T* address, const Type& value )
+   {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+      _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+      _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+      *address = value.value;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Store class template for 2-byte integral data types.
@@ -285,6 +322,60 @@ inline void store( double* address, const sse_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 'float16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'float16' vector to be stored.
+// \return void
+//
+// This function stores a vector of 'float16' values. The given address must be aligned according
+// to the enabled instruction set (16-byte alignment in case of SSE and AVX, 32-byte alignment in
+// case of AVX2).
+*/
+inline void store( float16* address, const sse_float16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 'bfloat16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'bfloat16' vector to be stored.
+// \return void
+//
+// This function stores a vector of 'bfloat16' values. The given address must be aligned according
+// to the enabled instruction set (16-byte alignment in case of SSE and AVX, 32-byte alignment in
+// case of AVX2).
+*/
+inline void store( bfloat16* address, const sse_bfloat16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned store of a vector of 'complex<float>' values.
 // \ingroup intrinsics
@@ -81,6 +81,41 @@ struct Storeu;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Storeu class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Storeu<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline void storeu( T* address, const Type& value )
+   {
+#if BLAZE_AVX2_MODE
+      _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+      _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+      *address = value.value;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Storeu class template for 2-byte integral data types.
@@ -274,6 +309,54 @@ inline void storeu( double* address, const sse_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'float16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'float16' vector to be stored.
+// \return void
+//
+// This function stores a vector of 'float16' values. In contrast to the according store function,
+// the given address is not required to be properly aligned.
+*/
+inline void storeu( float16* address, const sse_float16_t& value )
+{
+#if BLAZE_AVX2_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'bfloat16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'bfloat16' vector to be stored.
+// \return void
+//
+// This function stores a vector of 'bfloat16' values. In contrast to the according store function,
+// the given address is not required to be properly aligned.
+*/
+inline void storeu( bfloat16* address, const sse_bfloat16_t& value )
+{
+#if BLAZE_AVX2_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Unaligned store of a vector of 'complex<float>' values.
 // \ingroup intrinsics
@@ -82,6 +82,43 @@ struct Stream;
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Stream class template for 1-byte integral data types.
+// \ingroup intrinsics
+*/
+template< typename T >  // Type of the integral
+struct Stream<T,1UL>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef sse_int8_t  Type;
+   //**********************************************************************************************
+
+   //**Set function********************************************************************************
+   static inline void stream( T* address, const Type& value )
+   {
+      BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+      _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+      _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+      *address = value.value;
+#endif
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( T );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the Stream class template for 2-byte integral data types.
@@ -272,6 +309,52 @@ inline void stream( double* address, const sse_double_t& value )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 'float16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'float16' vector to be streamed.
+// \return void
+*/
+inline void stream( float16* address, const sse_float16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 'bfloat16' values.
+// \ingroup intrinsics
+//
+// \param address The target address.
+// \param value The 'bfloat16' vector to be streamed.
+// \return void
+*/
+inline void stream( bfloat16* address, const sse_bfloat16_t& value )
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+#if BLAZE_AVX2_MODE
+   _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
+#elif BLAZE_SSE2_MODE
+   _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
+#else
+   *address = value.value;
+#endif
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned, non-temporal store of a vector of 'complex<float>' values.
 // \ingroup intrinsics
@@ -0,0 +1,391 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Trigonometric.h
+//  \brief Header file for the intrinsic trigonometric functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+#define _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE )
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a vector of non-negative single precision angles to \f$ [-\pi/4..\pi/4] \f$.
+// \ingroup intrinsics
+//
+// \param x The vector of non-negative angles.
+// \param qodd The resulting parity of the quadrant (0 or 1).
+// \param qhodd The resulting parity of the half-plane (0 or 1).
+// \return The reduced angles.
+//
+// The angle \a x is reduced to \f$ r = x - q \cdot \pi/2 \f$ via a three-part representation
+// of \f$ \pi/4 \f$ (Cody-Waite reduction). The quadrant \a q is returned via its two lowest bits.
+*/
+inline sse_float_t reduceAngle( const sse_float_t& x, sse_float_t& qodd, sse_float_t& qhodd )
+{
+   const sse_float_t half( set( 0.5F ) );
+   const sse_float_t two ( set( 2.0F ) );
+
+   const sse_float_t j( floorToInteger( x * set( 1.27323954473516268615F ) ) );
+   const sse_float_t q( floorToInteger( ( j + set( 1.0F ) ) * half ) );
+   const sse_float_t qh( floorToInteger( q * half ) );
+
+   qodd  = q  - two * qh;
+   qhodd = qh - two * floorToInteger( qh * half );
+
+   const sse_float_t y( two * q );
+
+   return ( ( x - y * set( 0.78515625F ) )
+            - y * set( 2.4187564849853515625E-4F ) )
+            - y * set( 3.77489497744594108E-8F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Approximation of the sine of reduced single precision angles.
+// \ingroup intrinsics
+//
+// \param r The vector of reduced angles in the range \f$ [-\pi/4..\pi/4] \f$.
+// \param z The squares of the reduced angles.
+// \return The approximated sine values (a polynomial of degree 7).
+*/
+inline sse_float_t sinKernel( const sse_float_t& r, const sse_float_t& z )
+{
+   sse_float_t p( set( -1.9515295891E-4F ) );
+   p = p * z + set( 8.3321608736E-3F );
+   p = p * z + set( -1.6666654611E-1F );
+   return r + r * z * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Approximation of the cosine of reduced single precision angles.
+// \ingroup intrinsics
+//
+// \param z The squares of the reduced angles in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The approximated cosine values (a polynomial of degree 8).
+*/
+inline sse_float_t cosKernel( const sse_float_t& z )
+{
+   sse_float_t p( set( 2.443315711809948E-5F ) );
+   p = p * z + set( -1.388731625493765E-3F );
+   p = p * z + set( 4.166664568298827E-2F );
+   return set( 1.0F ) - z * set( 0.5F ) + z * z * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a vector of non-negative double precision angles to \f$ [-\pi/4..\pi/4] \f$.
+// \ingroup intrinsics
+//
+// \param x The vector of non-negative angles.
+// \param qodd The resulting parity of the quadrant (0 or 1).
+// \param qhodd The resulting parity of the half-plane (0 or 1).
+// \return The reduced angles.
+//
+// The angle \a x is reduced to \f$ r = x - q \cdot \pi/2 \f$ via a three-part representation
+// of \f$ \pi/4 \f$ (Cody-Waite reduction). The quadrant \a q is returned via its two lowest bits.
+*/
+inline sse_double_t reduceAngle( const sse_double_t& x, sse_double_t& qodd, sse_double_t& qhodd )
+{
+   const sse_double_t half( set( 0.5 ) );
+   const sse_double_t two ( set( 2.0 ) );
+
+   const sse_double_t j( floorToInteger( x * set( 1.27323954473516268615 ) ) );
+   const sse_double_t q( floorToInteger( ( j + set( 1.0 ) ) * half ) );
+   const sse_double_t qh( floorToInteger( q * half ) );
+
+   qodd  = q  - two * qh;
+   qhodd = qh - two * floorToInteger( qh * half );
+
+   const sse_double_t y( two * q );
+
+   return ( ( x - y * set( 7.85398125648498535156E-1 ) )
+            - y * set( 3.77489470793079817668E-8 ) )
+            - y * set( 2.69515142907905952645E-15 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Approximation of the sine of reduced double precision angles.
+// \ingroup intrinsics
+//
+// \param r The vector of reduced angles in the range \f$ [-\pi/4..\pi/4] \f$.
+// \param z The squares of the reduced angles.
+// \return The approximated sine values (a polynomial of degree 13).
+*/
+inline sse_double_t sinKernel( const sse_double_t& r, const sse_double_t& z )
+{
+   sse_double_t p( set( 1.58962301576546568060E-10 ) );
+   p = p * z + set( -2.50507477628578072866E-8 );
+   p = p * z + set( 2.75573136213857245213E-6 );
+   p = p * z + set( -1.98412698295895385996E-4 );
+   p = p * z + set( 8.33333333332211858878E-3 );
+   p = p * z + set( -1.66666666666666307295E-1 );
+   return r + r * z * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Approximation of the cosine of reduced double precision angles.
+// \ingroup intrinsics
+//
+// \param z The squares of the reduced angles in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The approximated cosine values (a polynomial of degree 14).
+*/
+inline sse_double_t cosKernel( const sse_double_t& z )
+{
+   sse_double_t p( set( -1.13585365213876817300E-11 ) );
+   p = p * z + set( 2.08757008419747316778E-9 );
+   p = p * z + set( -2.75573141792967388112E-7 );
+   p = p * z + set( 2.48015872888517045348E-5 );
+   p = p * z + set( -1.38888888888730564116E-3 );
+   p = p * z + set( 4.16666666666665929218E-2 );
+   return set( 1.0 ) - z * set( 0.5 ) + z * z * p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE && !BLAZE_MIC_MODE )
+
+//*************************************************************************************************
+/*!\brief Sine of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The sine values.
+//
+// The arguments are reduced to \f$ [-\pi/4..\pi/4] \f$, where the sine and cosine are approximated
+// by polynomials. The maximum absolute error is about 1 ulp for arguments with an absolute value
+// smaller than 8192. In case any element exceeds this range, the sine values are computed
+// via the standard library in order to avoid the loss of accuracy of the argument reduction.
+*/
+inline sse_float_t sin( const sse_float_t& a )
+{
+   typedef IntrinsicTrait<float>  IT;
+
+   const sse_float_t x( andnotBits( set( -0.0F ), a ) );
+
+   if( anyOf( greaterThan( x, set( 8192.0F ) ) ) ) {
+      sse_float_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::sin( a[i] );
+      return res;
+   }
+
+   const sse_float_t zero( set( 0.0F ) );
+   const sse_float_t one ( set( 1.0F ) );
+
+   sse_float_t qodd, qhodd;
+   const sse_float_t r( reduceAngle( x, qodd, qhodd ) );
+   const sse_float_t z( r * r );
+
+   const sse_float_t sign( andBits( a, set( -0.0F ) ) );
+   const sse_float_t res ( blend( equalTo( qodd, zero ), sinKernel( r, z ), cosKernel( z ) ) );
+
+   return xorBits( res, xorBits( sign, andBits( equalTo( qhodd, one ), set( -0.0F ) ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sine of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The sine values.
+//
+// The arguments are reduced to \f$ [-\pi/4..\pi/4] \f$, where the sine and cosine are approximated
+// by polynomials. The maximum absolute error is about 1 ulp for arguments with an absolute value
+// smaller than 1073741824. In case any element exceeds this range, the sine values are computed
+// via the standard library in order to avoid the loss of accuracy of the argument reduction.
+*/
+inline sse_double_t sin( const sse_double_t& a )
+{
+   typedef IntrinsicTrait<double>  IT;
+
+   const sse_double_t x( andnotBits( set( -0.0 ), a ) );
+
+   if( anyOf( greaterThan( x, set( 1073741824.0 ) ) ) ) {
+      sse_double_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::sin( a[i] );
+      return res;
+   }
+
+   const sse_double_t zero( set( 0.0 ) );
+   const sse_double_t one ( set( 1.0 ) );
+
+   sse_double_t qodd, qhodd;
+   const sse_double_t r( reduceAngle( x, qodd, qhodd ) );
+   const sse_double_t z( r * r );
+
+   const sse_double_t sign( andBits( a, set( -0.0 ) ) );
+   const sse_double_t res ( blend( equalTo( qodd, zero ), sinKernel( r, z ), cosKernel( z ) ) );
+
+   return xorBits( res, xorBits( sign, andBits( equalTo( qhodd, one ), set( -0.0 ) ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cosine of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The cosine values.
+//
+// The arguments are reduced to \f$ [-\pi/4..\pi/4] \f$, where the sine and cosine are approximated
+// by polynomials. The maximum absolute error is about 1 ulp for arguments with an absolute value
+// smaller than 8192. In case any element exceeds this range, the cosine values are computed
+// via the standard library in order to avoid the loss of accuracy of the argument reduction.
+*/
+inline sse_float_t cos( const sse_float_t& a )
+{
+   typedef IntrinsicTrait<float>  IT;
+
+   const sse_float_t x( andnotBits( set( -0.0F ), a ) );
+
+   if( anyOf( greaterThan( x, set( 8192.0F ) ) ) ) {
+      sse_float_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::cos( a[i] );
+      return res;
+   }
+
+   const sse_float_t zero( set( 0.0F ) );
+   const sse_float_t one ( set( 1.0F ) );
+
+   sse_float_t qodd, qhodd;
+   const sse_float_t r( reduceAngle( x, qodd, qhodd ) );
+   const sse_float_t z( r * r );
+
+   const sse_float_t res( blend( equalTo( qodd, zero ), cosKernel( z ), sinKernel( r, z ) ) );
+
+   return xorBits( res, andBits( equalTo( qodd + qhodd, one ), set( -0.0F ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cosine of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The cosine values.
+//
+// The arguments are reduced to \f$ [-\pi/4..\pi/4] \f$, where the sine and cosine are approximated
+// by polynomials. The maximum absolute error is about 1 ulp for arguments with an absolute value
+// smaller than 1073741824. In case any element exceeds this range, the cosine values are computed
+// via the standard library in order to avoid the loss of accuracy of the argument reduction.
+*/
+inline sse_double_t cos( const sse_double_t& a )
+{
+   typedef IntrinsicTrait<double>  IT;
+
+   const sse_double_t x( andnotBits( set( -0.0 ), a ) );
+
+   if( anyOf( greaterThan( x, set( 1073741824.0 ) ) ) ) {
+      sse_double_t res( a );
+      for( size_t i=0UL; i<IT::size; ++i )
+         res[i] = std::cos( a[i] );
+      return res;
+   }
+
+   const sse_double_t zero( set( 0.0 ) );
+   const sse_double_t one ( set( 1.0 ) );
+
+   sse_double_t qodd, qhodd;
+   const sse_double_t r( reduceAngle( x, qodd, qhodd ) );
+   const sse_double_t z( r * r );
+
+   const sse_double_t res( blend( equalTo( qodd, zero ), cosKernel( z ), sinKernel( r, z ) ) );
+
+   return xorBits( res, andBits( equalTo( qodd + qhodd, one ), set( -0.0 ) ) );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
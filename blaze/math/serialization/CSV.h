@@ -0,0 +1,817 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/CSV.h
+//  \brief Reading and writing of matrices in the CSV format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_CSV_H_
+#define _BLAZE_MATH_SERIALIZATION_CSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/TextParser.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reader and writer for matrices in the CSV format.
+// \ingroup math_serialization
+//
+// The CSV class reads and writes dense and sparse matrices as delimiter-separated text files.
+// Every non-empty line of the file represents a single row of the matrix and all rows must
+// contain the same number of values. The delimiter can be specified on construction (the
+// default is a comma); blanks around values are ignored:
+
+   \code
+   blaze::ThreadPool pool( 8UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   blaze::CompressedMatrix<float,blaze::columnMajor> B;
+
+   blaze::CSV( ',', &pool ).read( "A.csv", A );
+   blaze::CSV( ';', &pool ).read( "B.csv", B );
+   blaze::CSV( '\t' ).write( "C.tsv", A * B );
+   \endcode
+
+// The file is mapped into memory and split into line-aligned chunks, which are parsed in parallel
+// on the given thread pool. In case no thread pool is given, the file is processed by the calling
+// thread. When reading a sparse matrix, all values that are equal to the default value of the
+// element type are skipped. Complex element types are not supported.
+//
+// In case the file cannot be read or written or in case it contains an invalid value or a row
+// with an invalid number of values, a \a std::runtime_error exception is thrown.
+*/
+class CSV
+{
+ private:
+   //**Forward declarations************************************************************************
+   template< typename Type, bool SO >  struct DenseTask;
+   template< typename Type >           struct SparseTask;
+   template< typename MT >             struct FormatTask;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline CSV( char delimiter = ',', ThreadPool* pool = NULL );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename Type, bool SO >
+   void read( const std::string& filename, DynamicMatrix<Type,SO>& mat );
+
+   template< typename Type, bool SO >
+   void read( const std::string& filename, CompressedMatrix<Type,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename MT, bool SO >
+   void write( const std::string& filename, const Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename Type >
+   size_t readLayout( const MemoryMap& map, std::vector<const char*>& bounds,
+                      std::vector<size_t>& rows, size_t& columns );
+
+   template< typename Type >
+   static inline void transfer( CompressedMatrix<Type,rowMajor>& mat,
+                                CompressedMatrix<Type,rowMajor>& tmp );
+
+   template< typename Type >
+   static inline void transfer( CompressedMatrix<Type,columnMajor>& mat,
+                                CompressedMatrix<Type,rowMajor>& tmp );
+   //@}
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename MT, bool SO >
+   void writeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat );
+
+   template< typename MT >
+   void writeMatrix( std::ofstream& file, const SparseMatrix<MT,rowMajor>& mat );
+
+   template< typename MT >
+   void writeMatrix( std::ofstream& file, const SparseMatrix<MT,columnMajor>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   char        delimiter_;  //!< The character separating two values of a row.
+   ThreadPool* pool_;       //!< The thread pool for the parallel processing (may be NULL).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for parsing the rows of a chunk of a CSV file into a dense matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+struct CSV::DenseTask
+{
+   const char*             begin_;      //!< The beginning of the chunk.
+   const char*             end_;        //!< The end of the chunk.
+   size_t                  first_;      //!< The index of the first row of the chunk.
+   char                    delimiter_;  //!< The character separating two values of a row.
+   DynamicMatrix<Type,SO>* mat_;        //!< The target matrix.
+
+   void run()
+   {
+      const char* pos( begin_ );
+      size_t i( first_ );
+
+      while( pos != end_ )
+      {
+         if( !TextParser::skipBlanks( pos, end_ ) ) {
+            TextParser::skipLine( pos, end_ );
+            continue;
+         }
+
+         for( size_t j=0UL; j<mat_->columns(); ++j ) {
+            if( ( j > 0UL && !TextParser::parseDelimiter( pos, end_, delimiter_ ) ) ||
+                !TextParser::parseValue( pos, end_, (*mat_)(i,j), delimiter_ ) ) {
+               throw std::runtime_error( "Invalid matrix element detected" );
+            }
+         }
+
+         if( TextParser::skipBlanks( pos, end_ ) ) {
+            throw std::runtime_error( "Invalid number of columns detected" );
+         }
+
+         TextParser::skipLine( pos, end_ );
+         ++i;
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for parsing the rows of a chunk of a CSV file into a compressed representation.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct CSV::SparseTask
+{
+   const char*         begin_;      //!< The beginning of the chunk.
+   const char*         end_;        //!< The end of the chunk.
+   size_t              columns_;    //!< The number of columns of the matrix.
+   char                delimiter_;  //!< The character separating two values of a row.
+   std::vector<size_t> lengths_;    //!< The number of non-zeros of all rows of the chunk.
+   std::vector<size_t> indices_;    //!< The column indices of all non-zeros of the chunk.
+   std::vector<Type>   values_;     //!< The values of all non-zeros of the chunk.
+
+   void run()
+   {
+      const char* pos( begin_ );
+
+      while( pos != end_ )
+      {
+         if( !TextParser::skipBlanks( pos, end_ ) ) {
+            TextParser::skipLine( pos, end_ );
+            continue;
+         }
+
+         const size_t first( indices_.size() );
+         Type value;
+
+         for( size_t j=0UL; j<columns_; ++j ) {
+            if( ( j > 0UL && !TextParser::parseDelimiter( pos, end_, delimiter_ ) ) ||
+                !TextParser::parseValue( pos, end_, value, delimiter_ ) ) {
+               throw std::runtime_error( "Invalid matrix element detected" );
+            }
+            if( !isDefault( value ) ) {
+               indices_.push_back( j );
+               values_.push_back( value );
+            }
+         }
+
+         if( TextParser::skipBlanks( pos, end_ ) ) {
+            throw std::runtime_error( "Invalid number of columns detected" );
+         }
+
+         lengths_.push_back( indices_.size() - first );
+         TextParser::skipLine( pos, end_ );
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for formatting a range of rows of a matrix.
+//
+// Dense matrices are formatted element-wise, row-major sparse matrices are formatted by
+// traversing the non-zero elements of each row.
+*/
+template< typename MT >  // Type of the matrix
+struct CSV::FormatTask
+{
+   const MT*   mat_;        //!< The matrix to be formatted.
+   size_t      first_;      //!< The first row of the range.
+   size_t      last_;       //!< One past the last row of the range.
+   char        delimiter_;  //!< The character separating two values of a row.
+   std::string text_;       //!< The formatted rows.
+
+   void run()
+   {
+      format( *mat_ );
+   }
+
+   template< typename MT2, bool SO >
+   void format( const DenseMatrix<MT2,SO>& mat )
+   {
+      for( size_t i=first_; i<last_; ++i ) {
+         for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+            if( j > 0UL ) text_ += delimiter_;
+            TextParser::formatValue( text_, (~mat)(i,j) );
+         }
+         text_ += '\n';
+      }
+   }
+
+   template< typename MT2 >
+   void format( const SparseMatrix<MT2,rowMajor>& mat )
+   {
+      typedef typename MT2::ConstIterator  ConstIterator;
+      typedef typename MT2::ElementType    ET;
+
+      for( size_t i=first_; i<last_; ++i ) {
+         ConstIterator element( (~mat).begin(i) );
+         const ConstIterator end( (~mat).end(i) );
+         for( size_t j=0UL; j<(~mat).columns(); ++j ) {
+            if( j > 0UL ) text_ += delimiter_;
+            if( element != end && element->index() == j ) {
+               TextParser::formatValue( text_, element->value() );
+               ++element;
+            }
+            else TextParser::formatValue( text_, ET() );
+         }
+         text_ += '\n';
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the CSV class.
+//
+// \param delimiter The character separating two values of a row.
+// \param pool Pointer to the thread pool for the parallel processing (may be NULL).
+*/
+inline CSV::CSV( char delimiter, ThreadPool* pool )
+   : delimiter_( delimiter )  // The character separating two values of a row
+   , pool_     ( pool      )  // The thread pool for the parallel processing
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads a dense matrix from the given CSV file.
+//
+// \param filename The name of the CSV file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// The rows of the file are parsed in parallel directly into a newly created matrix, which is
+// swapped with the given matrix. In case an error is encountered, the given matrix is not
+// modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void CSV::read( const std::string& filename, DynamicMatrix<Type,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE    ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( Type );
+
+   const MemoryMap map( filename );
+
+   std::vector<const char*> bounds;
+   std::vector<size_t> rows;
+   size_t columns;
+
+   const size_t m( readLayout<Type>( map, bounds, rows, columns ) );
+   const size_t chunks( rows.size() );
+
+   DynamicMatrix<Type,SO> tmp( m, columns );
+
+   std::vector< DenseTask<Type,SO> > parsers( chunks );
+   for( size_t k=0UL, first=0UL; k<chunks; ++k ) {
+      parsers[k].begin_     = bounds[k];
+      parsers[k].end_       = bounds[k+1UL];
+      parsers[k].first_     = first;
+      parsers[k].delimiter_ = delimiter_;
+      parsers[k].mat_       = &tmp;
+      first += rows[k];
+   }
+   TextParser::run( pool_, parsers );
+
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a sparse matrix from the given CSV file.
+//
+// \param filename The name of the CSV file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// The rows of the file are parsed in parallel into chunk-local compressed representations,
+// which are appended to a newly created row-major matrix. In case an error is encountered, the
+// given matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void CSV::read( const std::string& filename, CompressedMatrix<Type,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE    ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( Type );
+
+   const MemoryMap map( filename );
+
+   std::vector<const char*> bounds;
+   std::vector<size_t> rows;
+   size_t columns;
+
+   const size_t m( readLayout<Type>( map, bounds, rows, columns ) );
+   const size_t chunks( rows.size() );
+
+   std::vector< SparseTask<Type> > parsers( chunks );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      parsers[k].begin_     = bounds[k];
+      parsers[k].end_       = bounds[k+1UL];
+      parsers[k].columns_   = columns;
+      parsers[k].delimiter_ = delimiter_;
+      parsers[k].lengths_.reserve( rows[k] );
+   }
+   TextParser::run( pool_, parsers );
+
+   size_t nonzeros( 0UL );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      nonzeros += parsers[k].indices_.size();
+   }
+
+   CompressedMatrix<Type,rowMajor> tmp( m, columns, nonzeros );
+
+   for( size_t k=0UL, i=0UL; k<chunks; ++k )
+   {
+      SparseTask<Type>& parser( parsers[k] );
+
+      for( size_t l=0UL, pos=0UL; l<parser.lengths_.size(); ++l, ++i ) {
+         for( const size_t end=pos+parser.lengths_[l]; pos<end; ++pos ) {
+            tmp.append( i, parser.indices_[pos], parser.values_[pos] );
+         }
+         tmp.finalize( i );
+      }
+
+      std::vector<size_t>().swap( parser.indices_ );
+      std::vector<Type>().swap( parser.values_ );
+   }
+
+   transfer( mat, tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the chunks of the given CSV file and the number of rows and columns.
+//
+// \param map The memory-mapped CSV file.
+// \param bounds The resulting chunk boundaries.
+// \param rows The resulting number of rows of each chunk.
+// \param columns The resulting number of columns of the matrix.
+// \return The total number of rows of the matrix.
+//
+// The number of columns is determined by the number of values of the first non-empty line.
+// The rows of all chunks are counted in parallel.
+*/
+template< typename Type >  // Data type of the matrix elements
+size_t CSV::readLayout( const MemoryMap& map, std::vector<const char*>& bounds,
+                        std::vector<size_t>& rows, size_t& columns )
+{
+   const char* pos( map.data() );
+   const char* end( map.data() + map.size() );
+
+   // Counting the number of values of the first row
+   while( pos != end && !TextParser::skipBlanks( pos, end ) ) {
+      TextParser::skipLine( pos, end );
+   }
+
+   columns = 0UL;
+
+   if( pos != end ) {
+      Type value;
+      while( true ) {
+         if( !TextParser::parseValue( pos, end, value, delimiter_ ) ) {
+            throw std::runtime_error( "Invalid matrix element detected" );
+         }
+         ++columns;
+         const char* next( pos );
+         if( !TextParser::skipBlanks( next, end ) ) break;
+         if( !TextParser::parseDelimiter( pos, end, delimiter_ ) ) {
+            throw std::runtime_error( "Invalid matrix element detected" );
+         }
+      }
+   }
+
+   // Counting the rows of all chunks
+   const size_t chunks( TextParser::chunks( pool_, map.size() ) );
+   TextParser::split( map.data(), end, chunks, bounds );
+
+   std::vector<TextParser::LineCounter> counters( chunks );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      counters[k].begin_ = bounds[k];
+      counters[k].end_   = bounds[k+1UL];
+   }
+   TextParser::run( pool_, counters );
+
+   size_t m( 0UL );
+   rows.resize( chunks );
+
+   for( size_t k=0UL; k<chunks; ++k ) {
+      rows[k] = counters[k].lines_;
+      m += rows[k];
+   }
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves the given row-major temporary into the given row-major matrix.
+//
+// \param mat The target matrix.
+// \param tmp The row-major temporary.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void CSV::transfer( CompressedMatrix<Type,rowMajor>& mat, CompressedMatrix<Type,rowMajor>& tmp )
+{
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigns the given row-major temporary to the given column-major matrix.
+//
+// \param mat The target matrix.
+// \param tmp The row-major temporary.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void CSV::transfer( CompressedMatrix<Type,columnMajor>& mat, CompressedMatrix<Type,rowMajor>& tmp )
+{
+   mat = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given CSV file.
+//
+// \param filename The name of the CSV file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+//
+// The rows of the matrix are formatted in parallel and written to the file in order. Every row
+// of the matrix results in a single line of the file, including all zero elements of sparse
+// matrices.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void CSV::write( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE    ( typename MT::ElementType );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( typename MT::ElementType );
+
+   std::ofstream file( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !file ) {
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   writeMatrix( file, ~mat );
+
+   file.close();
+
+   if( !file ) {
+      throw std::runtime_error( "Matrix could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix.
+//
+// \param file The file to be written.
+// \param mat The dense matrix to be written.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void CSV::writeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type  Operand;
+
+   CT A( ~mat );
+
+   std::vector< FormatTask<Operand> > tasks( TextParser::chunks( pool_, A.rows()*A.columns()*16UL ) );
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      tasks[k].mat_       = &A;
+      tasks[k].first_     = ( A.rows() * k ) / tasks.size();
+      tasks[k].last_      = ( A.rows() * ( k+1UL ) ) / tasks.size();
+      tasks[k].delimiter_ = delimiter_;
+   }
+
+   TextParser::run( pool_, tasks );
+
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      file.write( tasks[k].text_.data(), tasks[k].text_.size() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given row-major sparse matrix.
+//
+// \param file The file to be written.
+// \param mat The row-major sparse matrix to be written.
+// \return void
+*/
+template< typename MT >  // Type of the sparse matrix
+void CSV::writeMatrix( std::ofstream& file, const SparseMatrix<MT,rowMajor>& mat )
+{
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type  Operand;
+
+   CT A( ~mat );
+
+   std::vector< FormatTask<Operand> > tasks( TextParser::chunks( pool_, A.rows()*A.columns()*4UL ) );
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      tasks[k].mat_       = &A;
+      tasks[k].first_     = ( A.rows() * k ) / tasks.size();
+      tasks[k].last_      = ( A.rows() * ( k+1UL ) ) / tasks.size();
+      tasks[k].delimiter_ = delimiter_;
+   }
+
+   TextParser::run( pool_, tasks );
+
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      file.write( tasks[k].text_.data(), tasks[k].text_.size() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given column-major sparse matrix.
+//
+// \param file The file to be written.
+// \param mat The column-major sparse matrix to be written.
+// \return void
+//
+// The matrix is converted to a row-major matrix to enable a row-wise traversal of the non-zero
+// elements.
+*/
+template< typename MT >  // Type of the sparse matrix
+void CSV::writeMatrix( std::ofstream& file, const SparseMatrix<MT,columnMajor>& mat )
+{
+   const CompressedMatrix<typename MT::ElementType,rowMajor> A( ~mat );
+   writeMatrix( file, A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from the given CSV file.
+// \ingroup math_serialization
+//
+// \param filename The name of the CSV file.
+// \param mat The target DynamicMatrix or CompressedMatrix.
+// \param delimiter The character separating two values of a row.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// This function reads the given CSV file by means of the calling thread:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   blaze::readCSV( "A.csv", A );
+   \endcode
+*/
+template< typename MT >  // Type of the matrix
+void readCSV( const std::string& filename, MT& mat, char delimiter = ',' )
+{
+   CSV( delimiter ).read( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from the given CSV file by means of the given thread pool.
+// \ingroup math_serialization
+//
+// \param pool The thread pool for the parallel parsing.
+// \param filename The name of the CSV file.
+// \param mat The target DynamicMatrix or CompressedMatrix.
+// \param delimiter The character separating two values of a row.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// This function splits the given CSV file into line-aligned chunks and parses them in parallel
+// on the given thread pool:
+
+   \code
+   blaze::ThreadPool pool( 8UL );
+   blaze::CompressedMatrix<float,blaze::rowMajor> A;
+   blaze::readCSV( pool, "A.csv", A, ';' );
+   \endcode
+*/
+template< typename MT >  // Type of the matrix
+void readCSV( ThreadPool& pool, const std::string& filename, MT& mat, char delimiter = ',' )
+{
+   CSV( delimiter, &pool ).read( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given CSV file.
+// \ingroup math_serialization
+//
+// \param filename The name of the CSV file.
+// \param mat The matrix to be written.
+// \param delimiter The character separating two values of a row.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeCSV( const std::string& filename, const Matrix<MT,SO>& mat, char delimiter = ',' )
+{
+   CSV( delimiter ).write( filename, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given CSV file by means of the given thread pool.
+// \ingroup math_serialization
+//
+// \param pool The thread pool for the parallel formatting.
+// \param filename The name of the CSV file.
+// \param mat The matrix to be written.
+// \param delimiter The character separating two values of a row.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeCSV( ThreadPool& pool, const std::string& filename, const Matrix<MT,SO>& mat,
+               char delimiter = ',' )
+{
+   CSV( delimiter, &pool ).write( filename, ~mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,643 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedSerializer.h
+//  \brief Serialization of dense and sparse matrices into a memory-mappable layout
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDSERIALIZER_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDSERIALIZER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MAPPEDHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Header of a matrix file in memory-mappable layout.
+// \ingroup math_serialization
+//
+// The MappedHeader represents the first 64 bytes of a file written by the MappedSerializer. All
+// offsets are given in bytes relative to the beginning of the file and are multiples of 64. The
+// header is followed by the matrix data:
+//
+//  - <b>dense matrices</b>: the rows (row-major) or columns (column-major) of the matrix, starting
+//    at \a dataOffset. Every row/column consists of \a number elements, where the elements
+//    beyond the last column/row are zero padding elements. The spacing is chosen such that every
+//    row/column starts at a 64-byte boundary, which is a multiple of the size of any intrinsic
+//    element.
+//  - <b>sparse matrices</b>: an array of \a rows+1 (row-major) or \a columns+1 (column-major)
+//    64-bit offsets at \a indexOffset, followed by the \a number value-index pairs of the
+//    matrix at \a dataOffset. The non-zero elements of row/column \a i are the elements in the
+//    range \f$ [offsets[i]..offsets[i+1]) \f$. Every value-index pair has the memory layout of
+//    the elements of a CompressedMatrix.
+//
+// Since the data is stored in the native representation of the platform, a file can only be
+// mapped on platforms with the same byte order and the same size of \c size_t.
+*/
+struct MappedHeader
+{
+   char     magic[8];       //!< The file signature "BLAZEMAP".
+   uint32_t byteOrder;      //!< The byte order marker 0x01020304.
+   uint8_t  version;        //!< The version of the file layout.
+   uint8_t  type;           //!< The type of the matrix.
+   uint8_t  elementType;    //!< The type of an element.
+   uint8_t  elementSize;    //!< The size in bytes of a single element of the matrix.
+   uint64_t rows;           //!< The number of rows of the matrix.
+   uint64_t columns;        //!< The number of columns of the matrix.
+   uint64_t number;         //!< The spacing (dense) or number of non-zeros (sparse) of the matrix.
+   uint64_t elementStride;  //!< The size in bytes of a single stored element.
+   uint64_t indexOffset;    //!< The position of the offset array of a sparse matrix.
+   uint64_t dataOffset;     //!< The position of the first element.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializer for dense and sparse matrices into a memory-mappable layout.
+// \ingroup math_serialization
+//
+// The MappedSerializer writes dense and sparse matrices in the layout described by MappedHeader.
+// In contrast to the portable representation of the MatrixSerializer, this layout corresponds to
+// the in-memory representation of the elements. Therefore a matrix file can be mapped into the
+// address space of a process and used by a MappedDenseMatrix or MappedSparseMatrix without any
+// per-element decoding:
+
+   \code
+   // Serialization of a dense and a sparse matrix
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::CompressedMatrix<double,blaze::rowMajor> S;
+
+      // ... Resizing and initialization
+
+      blaze::serializeMapped( "A.blazemap", A );
+      blaze::serializeMapped( "S.blazemap", S );
+   }
+
+   // Mapping of both matrices
+   {
+      blaze::MappedDenseMatrix<double,blaze::rowMajor> A( "A.blazemap" );
+      blaze::MappedSparseMatrix<double,blaze::rowMajor> S( "S.blazemap" );
+      blaze::DynamicVector<double> x, y;
+
+      // ... Resizing and initialization
+
+      y = A * x + S * x;
+   }
+   \endcode
+
+// The matrix is written in the storage order of the given matrix. Only matrices with numeric
+// element types can be written. In case an error is encountered during serialization or in case
+// a mapped file does not match the expected layout, a \a std::runtime_error exception is thrown.
+*/
+class MappedSerializer
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedSerializer();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename MT, bool SO >
+   void serialize( const std::string& filename, const Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Mapping functions***************************************************************************
+   /*!\name Mapping functions */
+   //@{
+   template< typename Type, bool DF, bool SO >
+   static const MappedHeader& header( const MemoryMap& map );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename MT >
+   void serializeHeader( std::ofstream& file, const MT& mat, uint64_t number,
+                         uint64_t stride, uint64_t indexOffset, uint64_t dataOffset );
+
+   template< typename MT, bool SO >
+   void serializeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat );
+
+   template< typename MT, bool SO >
+   void serializeMatrix( std::ofstream& file, const SparseMatrix<MT,SO>& mat );
+
+   inline void serializePadding( std::ofstream& file, uint64_t offset );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool DF, bool SO >
+   static inline uint8_t matrixType();
+
+   template< typename Type >
+   static inline size_t spacing( size_t n );
+
+   static inline uint64_t align( uint64_t offset );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint64_t position_;  //!< The current write position within the file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of the MappedSerializer class.
+*/
+MappedSerializer::MappedSerializer()
+   : position_( 0UL )  // The current write position within the file
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given matrix into the given file.
+//
+// \param filename The name of the file to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MappedSerializer::serialize( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   std::ofstream file( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !file ) {
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   position_ = 0UL;
+   serializeMatrix( file, ~mat );
+
+   file.close();
+
+   if( !file ) {
+      throw std::runtime_error( "Matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the header of the matrix file.
+//
+// \param file The file to be written.
+// \param mat The matrix to be serialized.
+// \param number The spacing of a dense matrix or the number of non-zeros of a sparse matrix.
+// \param stride The size in bytes of a single stored element.
+// \param indexOffset The position of the offset array of a sparse matrix.
+// \param dataOffset The position of the first element.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+void MappedSerializer::serializeHeader( std::ofstream& file, const MT& mat, uint64_t number,
+                                        uint64_t stride, uint64_t indexOffset,
+                                        uint64_t dataOffset )
+{
+   typedef typename MT::ElementType  ET;
+
+   MappedHeader header;
+   std::memset( &header, 0, sizeof( MappedHeader ) );
+
+   std::memcpy( header.magic, "BLAZEMAP", 8UL );
+   header.byteOrder     = 0x01020304U;
+   header.version       = 1U;
+   header.type          = matrixType< IsDenseMatrix<MT>::value, IsColumnMajorMatrix<MT>::value >();
+   header.elementType   = TypeValueMapping<ET>::value;
+   header.elementSize   = sizeof( ET );
+   header.rows          = mat.rows();
+   header.columns       = mat.columns();
+   header.number        = number;
+   header.elementStride = stride;
+   header.indexOffset   = indexOffset;
+   header.dataOffset    = dataOffset;
+
+   file.write( reinterpret_cast<const char*>( &header ), sizeof( MappedHeader ) );
+   position_ += sizeof( MappedHeader );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix.
+//
+// \param file The file to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// Every row (row-major) or column (column-major) is written by a single write operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MappedSerializer::serializeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t m( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+   const size_t n( ( SO == rowMajor )?( (~mat).columns() ):( (~mat).rows() ) );
+   const size_t nn( spacing<ET>( n ) );
+
+   serializeHeader( file, ~mat, nn, sizeof( ET ), 0UL, sizeof( MappedHeader ) );
+
+   std::vector<ET> buffer( nn, ET() );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         buffer[j] = ( SO == rowMajor )?( (~mat)(i,j) ):( (~mat)(j,i) );
+      }
+      file.write( reinterpret_cast<const char*>( &buffer[0] ), nn*sizeof( ET ) );
+   }
+
+   position_ += m*nn*sizeof( ET );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix.
+//
+// \param file The file to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// The offset array is written by a single write operation, the value-index pairs of every row
+// (row-major) or column (column-major) are written by a single write operation.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MappedSerializer::serializeMatrix( std::ofstream& file, const SparseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::ConstIterator  ConstIterator;
+   typedef ValueIndexPair<ET>          Element;
+
+   const size_t m( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+
+   std::vector<uint64_t> offsets( m+1UL, 0UL );
+   for( size_t i=0UL; i<m; ++i ) {
+      offsets[i+1UL] = offsets[i] + (~mat).nonZeros( i );
+   }
+
+   const uint64_t nonzeros   ( offsets[m] );
+   const uint64_t indexOffset( sizeof( MappedHeader ) );
+   const uint64_t dataOffset ( align( indexOffset + ( m+1UL )*sizeof( uint64_t ) ) );
+
+   serializeHeader( file, ~mat, nonzeros, sizeof( Element ), indexOffset, dataOffset );
+
+   file.write( reinterpret_cast<const char*>( &offsets[0] ), ( m+1UL )*sizeof( uint64_t ) );
+   position_ += ( m+1UL )*sizeof( uint64_t );
+
+   serializePadding( file, dataOffset );
+
+   std::vector<char> buffer;
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t bytes( ( offsets[i+1UL] - offsets[i] ) * sizeof( Element ) );
+
+      if( bytes == 0UL ) continue;
+
+      buffer.assign( bytes, 0 );
+      char* pos( &buffer[0] );
+
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         ::new( pos ) Element( element->value(), element->index() );
+         pos += sizeof( Element );
+      }
+
+      file.write( &buffer[0], bytes );
+      position_ += bytes;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes zero bytes up to the given position.
+//
+// \param file The file to be written.
+// \param offset The target position within the file.
+// \return void
+*/
+inline void MappedSerializer::serializePadding( std::ofstream& file, uint64_t offset )
+{
+   BLAZE_INTERNAL_ASSERT( position_ <= offset, "Invalid padding offset detected" );
+
+   const char zeros[64] = { 0 };
+   file.write( zeros, offset - position_ );
+   position_ = offset;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Validates the header of a mapped matrix file.
+//
+// \param map The mapped matrix file.
+// \return Reference to the header of the mapped file.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This function checks that the given mapped file contains a matrix with element type \a Type,
+// the given density flag \a DF (\a true for dense and \a false for sparse matrices) and the given
+// storage order \a SO and that all data of the matrix is contained within the file. In case of
+// a sparse matrix additionally the consistency of the offset array is checked. Note however
+// that the value-index pairs themselves are not checked in order to avoid touching the complete
+// file.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool DF        // Density flag
+        , bool SO >      // Storage order
+const MappedHeader& MappedSerializer::header( const MemoryMap& map )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( sizeof( MappedHeader ) == 64UL );
+
+   if( map.size() < sizeof( MappedHeader ) ) {
+      throw std::runtime_error( "Corrupt matrix file detected" );
+   }
+
+   const MappedHeader& header( *reinterpret_cast<const MappedHeader*>( map.data() ) );
+
+   if( std::memcmp( header.magic, "BLAZEMAP", 8UL ) != 0 ) {
+      throw std::runtime_error( "Corrupt matrix file detected" );
+   }
+   else if( header.byteOrder != 0x01020304U ) {
+      throw std::runtime_error( "Invalid byte order detected" );
+   }
+   else if( header.version != 1U ) {
+      throw std::runtime_error( "Invalid version detected" );
+   }
+   else if( header.type != matrixType<DF,SO>() ) {
+      throw std::runtime_error( "Invalid matrix type detected" );
+   }
+   else if( header.elementType != TypeValueMapping<Type>::value ) {
+      throw std::runtime_error( "Invalid element type detected" );
+   }
+   else if( header.elementSize != sizeof( Type ) ) {
+      throw std::runtime_error( "Invalid element size detected" );
+   }
+   else if( header.elementStride != ( DF ? sizeof( Type ) : sizeof( ValueIndexPair<Type> ) ) ) {
+      throw std::runtime_error( "Invalid element layout detected" );
+   }
+   else if( header.dataOffset % 64UL != 0UL || header.indexOffset % 64UL != 0UL ) {
+      throw std::runtime_error( "Invalid alignment detected" );
+   }
+
+   const uint64_t m( ( SO == rowMajor )?( header.rows ):( header.columns ) );
+   const uint64_t n( ( SO == rowMajor )?( header.columns ):( header.rows ) );
+   const uint64_t size( map.size() );
+
+   if( DF ) {
+      if( header.number < n || ( header.number * sizeof( Type ) ) % 64UL != 0UL ||
+          header.dataOffset > size ||
+          ( m != 0UL && ( size - header.dataOffset ) / sizeof( Type ) / m < header.number ) ) {
+         throw std::runtime_error( "Invalid matrix size detected" );
+      }
+   }
+   else {
+      if( header.indexOffset > size || ( size - header.indexOffset ) / sizeof( uint64_t ) <= m ||
+          header.dataOffset > size ||
+          ( size - header.dataOffset ) / header.elementStride < header.number ) {
+         throw std::runtime_error( "Invalid matrix size detected" );
+      }
+
+      const uint64_t* offsets(
+         reinterpret_cast<const uint64_t*>( map.data() + header.indexOffset ) );
+
+      if( offsets[0] != 0UL || offsets[m] != header.number ) {
+         throw std::runtime_error( "Invalid number of elements detected" );
+      }
+
+      for( uint64_t i=0UL; i<m; ++i ) {
+         if( offsets[i] > offsets[i+1UL] )
+            throw std::runtime_error( "Invalid number of elements detected" );
+      }
+   }
+
+   return header;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the integral representation of the given matrix type.
+//
+// \return The integral representation of the matrix type.
+//
+// The matrix type is encoded with the same bits as in the MatrixSerializer:
+
+   \code
+   0x01 - Vector/Matrix flag
+   0x02 - Dense/Sparse flag
+   0x04 - Row-/Column-major flag
+   \endcode
+*/
+template< bool DF    // Density flag
+        , bool SO >  // Storage order
+inline uint8_t MappedSerializer::matrixType()
+{
+   return uint8_t( 0x01U | ( DF ? 0x00U : 0x02U ) | ( SO == rowMajor ? 0x00U : 0x04U ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing of a dense matrix row/column with \a n elements.
+//
+// \param n The number of elements per row/column.
+// \return The number of elements per row/column including the padding elements.
+//
+// The spacing is chosen such that the size of every row/column is a multiple of 64 bytes.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t MappedSerializer::spacing( size_t n )
+{
+   BLAZE_STATIC_ASSERT( 64UL % sizeof( Type ) == 0UL );
+
+   const size_t size( 64UL / sizeof( Type ) );
+   return ( n + size - 1UL ) / size * size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligns the given offset to the next multiple of 64 bytes.
+//
+// \param offset The offset to be aligned.
+// \return The aligned offset.
+*/
+inline uint64_t MappedSerializer::align( uint64_t offset )
+{
+   return ( offset + 63UL ) / 64UL * 64UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given matrix into a file in memory-mappable layout.
+// \ingroup math_serialization
+//
+// \param filename The name of the file to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Matrix could not be serialized.
+//
+// The serializeMapped() function writes the given dense or sparse matrix into the given file in
+// the layout described by MappedHeader. The file can be mapped by a MappedDenseMatrix or a
+// MappedSparseMatrix with the same element type and storage order:
+
+   \code
+   blaze::CompressedMatrix<float,blaze::columnMajor> S;
+   // ... Resizing and initialization
+
+   blaze::serializeMapped( "S.blazemap", S );
+
+   blaze::MappedSparseMatrix<float,blaze::columnMajor> T( "S.blazemap" );
+   \endcode
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void serializeMapped( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   MappedSerializer().serialize( filename, ~mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
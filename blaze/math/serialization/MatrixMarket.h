@@ -0,0 +1,1240 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMarket.h
+//  \brief Reading and writing of matrices in the Matrix Market exchange format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/TextParser.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reader and writer for matrices in the Matrix Market exchange format.
+// \ingroup math_serialization
+//
+// The MatrixMarket class reads and writes dense and sparse matrices in the text based Matrix
+// Market exchange format (see http://math.nist.gov/MatrixMarket/formats.html). The reader
+// supports both the \c coordinate and the \c array format, the \c real, \c integer, \c complex,
+// and \c pattern fields, and the \c general, \c symmetric, \c skew-symmetric, and \c hermitian
+// symmetry structures:
+
+   \code
+   blaze::ThreadPool pool( 8UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+
+   blaze::MatrixMarket( &pool ).read( "A.mtx", A );
+   blaze::MatrixMarket( &pool ).write( "B.mtx", trans( A ) );
+   \endcode
+
+// The file is mapped into memory and split into line-aligned chunks, which are parsed in parallel
+// on the given thread pool. In case no thread pool is given, the file is processed by the calling
+// thread. The entries of a coordinate file may appear in any order and duplicate entries are
+// summed up. For the \c symmetric, \c skew-symmetric and \c hermitian structures only the lower
+// triangular part of the matrix may be stored in the file; the upper part is reconstituted by
+// the reader. Matrices are always written with the \c general structure, sparse matrices in the
+// \c coordinate format, and dense matrices in the \c array format.
+//
+// In case the file cannot be read or written or in case it does not conform to the Matrix Market
+// format, a \a std::runtime_error exception is thrown. A \c complex file can only be read into a
+// matrix with complex element type and a \c real file cannot be read into a matrix with integral
+// element type.
+*/
+class MatrixMarket
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! The supported field types.
+   enum Field { realField, integerField, complexField, patternField };
+
+   //! The supported symmetry structures.
+   enum Symmetry { general, symmetric, skewSymmetric, hermitian };
+   //**********************************************************************************************
+
+   //**Header struct definition********************************************************************
+   /*!\brief The properties of a Matrix Market file.
+   */
+   struct Header
+   {
+      bool        coordinate;  //!< \a true for the coordinate format, \a false for the array format.
+      Field       field;       //!< The field type of the entries.
+      Symmetry    symmetry;    //!< The symmetry structure of the matrix.
+      size_t      rows;        //!< The number of rows of the matrix.
+      size_t      columns;     //!< The number of columns of the matrix.
+      size_t      entries;     //!< The number of entries stored in the file.
+      const char* begin;       //!< The beginning of the entries.
+      const char* end;         //!< The end of the file.
+   };
+   //**********************************************************************************************
+
+   //**Forward declarations************************************************************************
+   template< typename Type >           struct CoordinateTask;
+   template< typename Type >           struct SortTask;
+   template< typename Type, bool SO >  struct ArrayTask;
+   template< typename MT >             struct SparseFormatTask;
+   template< typename MT >             struct DenseFormatTask;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MatrixMarket( ThreadPool* pool = NULL );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename Type, bool SO >
+   void read( const std::string& filename, CompressedMatrix<Type,SO>& mat );
+
+   template< typename Type, bool SO >
+   void read( const std::string& filename, DynamicMatrix<Type,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename MT, bool SO >
+   void write( const std::string& filename, const Matrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   template< typename Type >
+   void readHeader( const MemoryMap& map, Header& header );
+
+   template< typename Type, bool SO >
+   void readCoordinate( const Header& header, CompressedMatrix<Type,SO>& mat );
+
+   template< typename Type, bool SO >
+   void readArray( const Header& header, DynamicMatrix<Type,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename MT, bool SO >
+   void writeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat );
+
+   template< typename MT, bool SO >
+   void writeMatrix( std::ofstream& file, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Task >
+   void writeChunks( std::ofstream& file, std::vector<Task>& tasks, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static inline const char* fieldName();
+
+   template< typename Type >
+   static inline typename EnableIf< IsComplex<Type>, bool >::Type
+      parseElement( const char*& pos, const char* end, Field field, Type& value );
+
+   template< typename Type >
+   static inline typename DisableIf< IsComplex<Type>, bool >::Type
+      parseElement( const char*& pos, const char* end, Field field, Type& value );
+
+   template< typename Type >
+   static inline typename EnableIf< IsComplex<Type>, Type >::Type
+      mirror( const Type& value, Symmetry symmetry );
+
+   template< typename Type >
+   static inline typename DisableIf< IsComplex<Type>, Type >::Type
+      mirror( const Type& value, Symmetry symmetry );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ThreadPool* pool_;  //!< The thread pool for the parallel processing (may be NULL).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for parsing the entries of a chunk of a coordinate file.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct MatrixMarket::CoordinateTask
+{
+   const Header*       header_;   //!< The properties of the file.
+   const char*         begin_;    //!< The beginning of the chunk.
+   const char*         end_;      //!< The end of the chunk.
+   std::vector<size_t> rows_;     //!< The zero-based row indices of the parsed entries.
+   std::vector<size_t> columns_;  //!< The zero-based column indices of the parsed entries.
+   std::vector<Type>   values_;   //!< The values of the parsed entries.
+
+   void run()
+   {
+      const char* pos( begin_ );
+      const Symmetry symmetry( header_->symmetry );
+
+      while( pos != end_ )
+      {
+         if( !TextParser::skipBlanks( pos, end_ ) ) {
+            TextParser::skipLine( pos, end_ );
+            continue;
+         }
+
+         size_t i, j;
+         Type value;
+
+         if( !TextParser::parseIndex( pos, end_, i ) || !TextParser::parseIndex( pos, end_, j ) ||
+             !parseElement( pos, end_, header_->field, value ) || TextParser::skipBlanks( pos, end_ ) ) {
+            throw std::runtime_error( "Invalid matrix element detected" );
+         }
+
+         if( i == 0UL || i > header_->rows || j == 0UL || j > header_->columns ) {
+            throw std::runtime_error( "Invalid index detected" );
+         }
+
+         if( symmetry != general && ( i < j || ( i == j && symmetry == skewSymmetric ) ) ) {
+            throw std::runtime_error( "Invalid upper element detected" );
+         }
+
+         rows_.push_back( i-1UL );
+         columns_.push_back( j-1UL );
+         values_.push_back( value );
+
+         TextParser::skipLine( pos, end_ );
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for sorting and merging the entries of a range of rows/columns.
+//
+// The entries of each row/column are sorted by index (preserving the order of equal indices)
+// and duplicate entries are summed up. Since most files are written in order, rows/columns
+// that are already strictly ascending are detected and left untouched.
+*/
+template< typename Type >  // Data type of the matrix elements
+struct MatrixMarket::SortTask
+{
+   //**Comparison functor**************************************************************************
+   struct Less {
+      inline bool operator()( const std::pair<size_t,Type>& a, const std::pair<size_t,Type>& b ) const {
+         return a.first < b.first;
+      }
+   };
+   //**********************************************************************************************
+
+   size_t        first_;    //!< The first row/column of the range.
+   size_t        last_;     //!< One past the last row/column of the range.
+   const size_t* offsets_;  //!< The offsets of all rows/columns.
+   size_t*       indices_;  //!< The indices of all entries.
+   Type*         values_;   //!< The values of all entries.
+   size_t*       lengths_;  //!< The resulting number of non-zeros of all rows/columns.
+
+   void run()
+   {
+      std::vector< std::pair<size_t,Type> > buffer;
+
+      for( size_t k=first_; k<last_; ++k )
+      {
+         const size_t begin( offsets_[k] );
+         const size_t end  ( offsets_[k+1UL] );
+
+         size_t pos( begin+1UL );
+         while( pos < end && indices_[pos-1UL] < indices_[pos] ) ++pos;
+
+         if( pos >= end ) {
+            lengths_[k] = end - begin;
+            continue;
+         }
+
+         buffer.clear();
+         for( size_t l=begin; l<end; ++l ) {
+            buffer.push_back( std::make_pair( indices_[l], values_[l] ) );
+         }
+         std::stable_sort( buffer.begin(), buffer.end(), Less() );
+
+         size_t length( 0UL );
+         for( size_t l=0UL; l<buffer.size(); ++l ) {
+            if( length > 0UL && indices_[begin+length-1UL] == buffer[l].first ) {
+               values_[begin+length-1UL] += buffer[l].second;
+            }
+            else {
+               indices_[begin+length] = buffer[l].first;
+               values_ [begin+length] = buffer[l].second;
+               ++length;
+            }
+         }
+         lengths_[k] = length;
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for parsing the entries of a chunk of an array file.
+//
+// The entries of an array file are stored in column-major order. For the symmetric structures
+// only the lower triangular part of each column is stored, which is mirrored into the upper
+// part of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+struct MatrixMarket::ArrayTask
+{
+   const Header*            header_;  //!< The properties of the file.
+   const char*              begin_;   //!< The beginning of the chunk.
+   const char*              end_;     //!< The end of the chunk.
+   size_t                   first_;   //!< The number of entries preceding the chunk.
+   DynamicMatrix<Type,SO>*  mat_;     //!< The target matrix.
+
+   void run()
+   {
+      const Symmetry symmetry( header_->symmetry );
+      const size_t m( header_->rows );
+      const size_t skew( symmetry == skewSymmetric ? 1UL : 0UL );
+
+      size_t i( 0UL ), j( 0UL );
+
+      if( symmetry == general ) {
+         if( m != 0UL ) {
+            j = first_ / m;
+            i = first_ % m;
+         }
+      }
+      else {
+         size_t remaining( first_ );
+         while( j < m && remaining >= m-j-skew ) {
+            remaining -= m-j-skew;
+            ++j;
+         }
+         i = j + skew + remaining;
+      }
+
+      const char* pos( begin_ );
+
+      while( pos != end_ )
+      {
+         if( !TextParser::skipBlanks( pos, end_ ) ) {
+            TextParser::skipLine( pos, end_ );
+            continue;
+         }
+
+         Type value;
+
+         if( !parseElement( pos, end_, header_->field, value ) || TextParser::skipBlanks( pos, end_ ) ) {
+            throw std::runtime_error( "Invalid matrix element detected" );
+         }
+
+         (*mat_)(i,j) = value;
+         if( symmetry != general && i != j )
+            (*mat_)(j,i) = mirror( value, symmetry );
+
+         if( ++i == m ) {
+            ++j;
+            i = ( symmetry == general )?( 0UL ):( j + skew );
+         }
+
+         TextParser::skipLine( pos, end_ );
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for formatting the entries of a range of rows/columns of a sparse matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+struct MatrixMarket::SparseFormatTask
+{
+   const MT*   mat_;    //!< The sparse matrix to be formatted.
+   size_t      first_;  //!< The first row/column of the range.
+   size_t      last_;   //!< One past the last row/column of the range.
+   std::string text_;   //!< The formatted entries.
+
+   void run()
+   {
+      typedef typename MT::ConstIterator  ConstIterator;
+
+      const bool isRowMajor( !IsColumnMajorMatrix<MT>::value );
+
+      text_.clear();
+
+      for( size_t k=first_; k<last_; ++k ) {
+         for( ConstIterator element=mat_->begin(k); element!=mat_->end(k); ++element ) {
+            TextParser::formatIndex( text_, ( isRowMajor ? k : element->index() ) + 1UL );
+            text_ += ' ';
+            TextParser::formatIndex( text_, ( isRowMajor ? element->index() : k ) + 1UL );
+            text_ += ' ';
+            TextParser::formatValue( text_, element->value() );
+            text_ += '\n';
+         }
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for formatting the entries of a range of columns of a dense matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+struct MatrixMarket::DenseFormatTask
+{
+   const MT*   mat_;    //!< The dense matrix to be formatted.
+   size_t      first_;  //!< The first column of the range.
+   size_t      last_;   //!< One past the last column of the range.
+   std::string text_;   //!< The formatted entries.
+
+   void run()
+   {
+      text_.clear();
+
+      for( size_t j=first_; j<last_; ++j ) {
+         for( size_t i=0UL; i<mat_->rows(); ++i ) {
+            TextParser::formatValue( text_, (*mat_)(i,j) );
+            text_ += '\n';
+         }
+      }
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the MatrixMarket class.
+//
+// \param pool Pointer to the thread pool for the parallel processing (may be NULL).
+*/
+inline MatrixMarket::MatrixMarket( ThreadPool* pool )
+   : pool_( pool )  // The thread pool for the parallel processing
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads a sparse matrix from the given Matrix Market file.
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// In case an error is encountered, the given matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void MatrixMarket::read( const std::string& filename, CompressedMatrix<Type,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const MemoryMap map( filename );
+
+   Header header;
+   readHeader<Type>( map, header );
+
+   if( header.coordinate ) {
+      readCoordinate( header, mat );
+   }
+   else {
+      DynamicMatrix<Type,SO> tmp;
+      readArray( header, tmp );
+      mat = tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a dense matrix from the given Matrix Market file.
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// In case an error is encountered, the given matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void MatrixMarket::read( const std::string& filename, DynamicMatrix<Type,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const MemoryMap map( filename );
+
+   Header header;
+   readHeader<Type>( map, header );
+
+   if( header.coordinate ) {
+      CompressedMatrix<Type,SO> tmp;
+      readCoordinate( header, tmp );
+      mat = tmp;
+   }
+   else {
+      DynamicMatrix<Type,SO> tmp;
+      readArray( header, tmp );
+      mat.swap( tmp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the banner, the comments, and the size line of a Matrix Market file.
+//
+// \param map The memory-mapped file.
+// \param header The resulting properties of the file.
+// \return void
+// \exception std::runtime_error Invalid Matrix Market header.
+*/
+template< typename Type >  // Data type of the matrix elements
+void MatrixMarket::readHeader( const MemoryMap& map, Header& header )
+{
+   const char* pos( map.data() );
+   const char* end( map.data() + map.size() );
+
+   std::string word;
+
+   // Parsing the banner line
+   if( !TextParser::parseWord( pos, end, word ) || word != "%%matrixmarket" ||
+       !TextParser::parseWord( pos, end, word ) || word != "matrix" ) {
+      throw std::runtime_error( "Invalid Matrix Market header detected" );
+   }
+
+   if( !TextParser::parseWord( pos, end, word ) )
+      throw std::runtime_error( "Invalid Matrix Market header detected" );
+   else if( word == "coordinate" ) header.coordinate = true;
+   else if( word == "array"      ) header.coordinate = false;
+   else throw std::runtime_error( "Invalid Matrix Market format detected" );
+
+   if( !TextParser::parseWord( pos, end, word ) )
+      throw std::runtime_error( "Invalid Matrix Market header detected" );
+   else if( word == "real"    ) header.field = realField;
+   else if( word == "integer" ) header.field = integerField;
+   else if( word == "complex" ) header.field = complexField;
+   else if( word == "pattern" ) header.field = patternField;
+   else throw std::runtime_error( "Invalid Matrix Market field detected" );
+
+   if( !TextParser::parseWord( pos, end, word ) )
+      throw std::runtime_error( "Invalid Matrix Market header detected" );
+   else if( word == "general"        ) header.symmetry = general;
+   else if( word == "symmetric"      ) header.symmetry = symmetric;
+   else if( word == "skew-symmetric" ) header.symmetry = skewSymmetric;
+   else if( word == "hermitian"      ) header.symmetry = hermitian;
+   else throw std::runtime_error( "Invalid Matrix Market symmetry detected" );
+
+   if( TextParser::skipBlanks( pos, end ) )
+      throw std::runtime_error( "Invalid Matrix Market header detected" );
+
+   // Skipping the comment lines and empty lines
+   TextParser::skipLine( pos, end );
+   while( pos != end && ( !TextParser::skipBlanks( pos, end ) || *pos == '%' ) ) {
+      TextParser::skipLine( pos, end );
+   }
+
+   // Parsing the size line
+   if( !TextParser::parseIndex( pos, end, header.rows ) ||
+       !TextParser::parseIndex( pos, end, header.columns ) ||
+       ( header.coordinate && !TextParser::parseIndex( pos, end, header.entries ) ) ||
+       TextParser::skipBlanks( pos, end ) ) {
+      throw std::runtime_error( "Invalid Matrix Market size detected" );
+   }
+
+   TextParser::skipLine( pos, end );
+   header.begin = pos;
+   header.end   = end;
+
+   // Validating the properties
+   if( ( header.field == complexField && !IsComplex<Type>::value ) ||
+       ( header.field == realField && IsIntegral<Type>::value ) ||
+       ( header.field == patternField && !header.coordinate ) ||
+       ( header.symmetry == hermitian && header.field != complexField ) ) {
+      throw std::runtime_error( "Invalid element type detected" );
+   }
+
+   if( header.symmetry != general && header.rows != header.columns ) {
+      throw std::runtime_error( "Invalid matrix size detected" );
+   }
+
+   if( !header.coordinate ) {
+      const size_t n( header.rows );
+      if( header.symmetry == general ) {
+         if( header.columns != 0UL && n > size_t(-1) / header.columns )
+            throw std::runtime_error( "Invalid matrix size detected" );
+         header.entries = n * header.columns;
+      }
+      else if( header.symmetry == skewSymmetric ) {
+         header.entries = ( n == 0UL )?( 0UL ):( n*(n-1UL)/2UL );
+      }
+      else {
+         header.entries = n*(n+1UL)/2UL;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the entries of a coordinate file into a sparse matrix.
+//
+// \param header The properties of the file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid matrix element.
+//
+// The entries are parsed in parallel and gathered into a compressed representation in three
+// steps: first the number of non-zeros of each row (row-major) or column (column-major) is
+// counted, then the entries are scattered into their rows/columns, and finally all rows/columns
+// are sorted and merged in parallel. The resulting elements are appended to a newly created
+// matrix, which is swapped with the given matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void MatrixMarket::readCoordinate( const Header& header, CompressedMatrix<Type,SO>& mat )
+{
+   const size_t m( header.rows );
+   const size_t n( header.columns );
+   const size_t majors( SO ? n : m );
+   const bool   mirrored( header.symmetry != general );
+
+   // Parsing the entries
+   const size_t chunks( TextParser::chunks( pool_, header.end - header.begin ) );
+
+   std::vector<const char*> bounds;
+   TextParser::split( header.begin, header.end, chunks, bounds );
+
+   std::vector< CoordinateTask<Type> > parsers( chunks );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      parsers[k].header_ = &header;
+      parsers[k].begin_  = bounds[k];
+      parsers[k].end_    = bounds[k+1UL];
+   }
+   TextParser::run( pool_, parsers );
+
+   // Counting the entries per row/column
+   std::vector<size_t> offsets( majors+1UL, 0UL );
+   size_t entries( 0UL );
+
+   for( size_t k=0UL; k<chunks; ++k ) {
+      const std::vector<size_t>& rows   ( parsers[k].rows_ );
+      const std::vector<size_t>& columns( parsers[k].columns_ );
+      for( size_t l=0UL; l<rows.size(); ++l ) {
+         ++offsets[ SO ? columns[l] : rows[l] ];
+         if( mirrored && rows[l] != columns[l] )
+            ++offsets[ SO ? rows[l] : columns[l] ];
+      }
+      entries += rows.size();
+   }
+
+   if( entries != header.entries ) {
+      throw std::runtime_error( "Invalid number of elements detected" );
+   }
+
+   size_t total( 0UL );
+   for( size_t k=0UL; k<=majors; ++k ) {
+      const size_t count( offsets[k] );
+      offsets[k] = total;
+      total += count;
+   }
+
+   // Scattering the entries into their rows/columns
+   std::vector<size_t> indices( total );
+   std::vector<Type>   values ( total );
+   std::vector<size_t> positions( offsets.begin(), offsets.end()-1 );
+
+   for( size_t k=0UL; k<chunks; ++k )
+   {
+      CoordinateTask<Type>& parser( parsers[k] );
+
+      for( size_t l=0UL; l<parser.rows_.size(); ++l )
+      {
+         const size_t i( parser.rows_[l] );
+         const size_t j( parser.columns_[l] );
+
+         size_t& pos( positions[ SO ? j : i ] );
+         indices[pos] = ( SO ? i : j );
+         values [pos] = parser.values_[l];
+         ++pos;
+
+         if( mirrored && i != j ) {
+            size_t& pos2( positions[ SO ? i : j ] );
+            indices[pos2] = ( SO ? j : i );
+            values [pos2] = mirror( parser.values_[l], header.symmetry );
+            ++pos2;
+         }
+      }
+
+      std::vector<size_t>().swap( parser.rows_ );
+      std::vector<size_t>().swap( parser.columns_ );
+      std::vector<Type>().swap( parser.values_ );
+   }
+
+   // Sorting and merging the entries of all rows/columns
+   std::vector<size_t> lengths( majors, 0UL );
+   const size_t tasks( ( total != 0UL )?( std::min( chunks, majors ) ):( 0UL ) );
+
+   std::vector< SortTask<Type> > sorters( tasks );
+   for( size_t k=0UL; k<tasks; ++k ) {
+      sorters[k].first_   = ( majors * k ) / tasks;
+      sorters[k].last_    = ( majors * ( k+1UL ) ) / tasks;
+      sorters[k].offsets_ = &offsets[0];
+      sorters[k].indices_ = &indices[0];
+      sorters[k].values_  = &values[0];
+      sorters[k].lengths_ = &lengths[0];
+   }
+   TextParser::run( pool_, sorters );
+
+   // Assembling the compressed matrix
+   size_t nonzeros( 0UL );
+   for( size_t k=0UL; k<majors; ++k ) {
+      nonzeros += lengths[k];
+   }
+
+   CompressedMatrix<Type,SO> tmp( m, n, nonzeros );
+
+   for( size_t k=0UL; k<majors; ++k ) {
+      for( size_t l=offsets[k]; l<offsets[k]+lengths[k]; ++l ) {
+         if( SO ) tmp.append( indices[l], k, values[l] );
+         else     tmp.append( k, indices[l], values[l] );
+      }
+      tmp.finalize( k );
+   }
+
+   mat.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the entries of an array file into a dense matrix.
+//
+// \param header The properties of the file.
+// \param mat The target matrix.
+// \return void
+// \exception std::runtime_error Invalid matrix element.
+//
+// The entries are parsed in two parallel passes: the first pass counts the entries of each
+// chunk to determine the position of the first entry of each chunk, the second pass parses the
+// entries directly into the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void MatrixMarket::readArray( const Header& header, DynamicMatrix<Type,SO>& mat )
+{
+   const size_t chunks( TextParser::chunks( pool_, header.end - header.begin ) );
+
+   std::vector<const char*> bounds;
+   TextParser::split( header.begin, header.end, chunks, bounds );
+
+   // Counting the entries of all chunks
+   std::vector<TextParser::LineCounter> counters( chunks );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      counters[k].begin_ = bounds[k];
+      counters[k].end_   = bounds[k+1UL];
+   }
+   TextParser::run( pool_, counters );
+
+   size_t entries( 0UL );
+   for( size_t k=0UL; k<chunks; ++k ) {
+      entries += counters[k].lines_;
+   }
+
+   if( entries != header.entries ) {
+      throw std::runtime_error( "Invalid number of elements detected" );
+   }
+
+   // Parsing the entries
+   mat.resize( header.rows, header.columns, false );
+   if( header.symmetry == skewSymmetric ) {
+      reset( mat );
+   }
+
+   std::vector< ArrayTask<Type,SO> > parsers( chunks );
+   for( size_t k=0UL, first=0UL; k<chunks; ++k ) {
+      parsers[k].header_ = &header;
+      parsers[k].begin_  = bounds[k];
+      parsers[k].end_    = bounds[k+1UL];
+      parsers[k].first_  = first;
+      parsers[k].mat_    = &mat;
+      first += counters[k].lines_;
+   }
+   TextParser::run( pool_, parsers );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given Matrix Market file.
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+//
+// Sparse matrices are written in the \c coordinate format, dense matrices in the \c array
+// format. The field is \c integer for integral element types, \c complex for complex element
+// types, and \c real otherwise.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixMarket::write( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   std::ofstream file( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !file ) {
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   writeMatrix( file, ~mat );
+
+   file.close();
+
+   if( !file ) {
+      throw std::runtime_error( "Matrix could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix in the array format.
+//
+// \param file The file to be written.
+// \param mat The dense matrix to be written.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void MatrixMarket::writeMatrix( std::ofstream& file, const DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type  Operand;
+
+   CT A( ~mat );
+
+   file << "%%MatrixMarket matrix array " << fieldName<ET>() << " general\n"
+        << A.rows() << ' ' << A.columns() << '\n';
+
+   std::vector< DenseFormatTask<Operand> > tasks( TextParser::chunks( pool_, A.rows()*A.columns()*16UL ) );
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      tasks[k].mat_ = &A;
+   }
+
+   writeChunks( file, tasks, A.columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix in the coordinate format.
+//
+// \param file The file to be written.
+// \param mat The sparse matrix to be written.
+// \return void
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void MatrixMarket::writeMatrix( std::ofstream& file, const SparseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+   typedef typename RemoveReference<CT>::Type  Operand;
+
+   CT A( ~mat );
+
+   file << "%%MatrixMarket matrix coordinate " << fieldName<ET>() << " general\n"
+        << A.rows() << ' ' << A.columns() << ' ' << A.nonZeros() << '\n';
+
+   std::vector< SparseFormatTask<Operand> > tasks( TextParser::chunks( pool_, A.nonZeros()*32UL ) );
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      tasks[k].mat_ = &A;
+   }
+
+   writeChunks( file, tasks, SO ? A.columns() : A.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Formats the given range of rows/columns in parallel and writes the result in order.
+//
+// \param file The file to be written.
+// \param tasks The formatting tasks.
+// \param n The total number of rows/columns to be formatted.
+// \return void
+*/
+template< typename Task >  // Type of the formatting tasks
+void MatrixMarket::writeChunks( std::ofstream& file, std::vector<Task>& tasks, size_t n )
+{
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      tasks[k].first_ = ( n * k ) / tasks.size();
+      tasks[k].last_  = ( n * ( k+1UL ) ) / tasks.size();
+   }
+
+   TextParser::run( pool_, tasks );
+
+   for( size_t k=0UL; k<tasks.size(); ++k ) {
+      file.write( tasks[k].text_.data(), tasks[k].text_.size() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the name of the Matrix Market field for the given element type.
+//
+// \return The name of the field.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const char* MatrixMarket::fieldName()
+{
+   if( IsComplex<Type>::value )
+      return "complex";
+   else if( IsIntegral<Type>::value )
+      return "integer";
+   else
+      return "real";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a single complex element.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param field The field type of the file.
+// \param value The parsed value.
+// \return \a true in case the element was parsed successfully, \a false otherwise.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename EnableIf< IsComplex<Type>, bool >::Type
+   MatrixMarket::parseElement( const char*& pos, const char* end, Field field, Type& value )
+{
+   typedef typename Type::value_type  ET;
+
+   if( field == patternField ) {
+      value = Type( 1 );
+      return true;
+   }
+
+   ET re( 0 ), im( 0 );
+
+   if( !TextParser::parseValue( pos, end, re ) ||
+       ( field == complexField && !TextParser::parseValue( pos, end, im ) ) )
+      return false;
+
+   value = Type( re, im );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a single non-complex element.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param field The field type of the file.
+// \param value The parsed value.
+// \return \a true in case the element was parsed successfully, \a false otherwise.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename DisableIf< IsComplex<Type>, bool >::Type
+   MatrixMarket::parseElement( const char*& pos, const char* end, Field field, Type& value )
+{
+   if( field == patternField ) {
+      value = Type( 1 );
+      return true;
+   }
+
+   return TextParser::parseValue( pos, end, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the mirrored value of a complex element of the lower triangular part.
+//
+// \param value The value of the element \f$ a_{ij} \f$.
+// \param symmetry The symmetry structure of the matrix.
+// \return The value of the element \f$ a_{ji} \f$.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename EnableIf< IsComplex<Type>, Type >::Type
+   MatrixMarket::mirror( const Type& value, Symmetry symmetry )
+{
+   if( symmetry == skewSymmetric )
+      return -value;
+   else if( symmetry == hermitian )
+      return Type( value.real(), -value.imag() );
+   else
+      return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the mirrored value of a non-complex element of the lower triangular part.
+//
+// \param value The value of the element \f$ a_{ij} \f$.
+// \param symmetry The symmetry structure of the matrix.
+// \return The value of the element \f$ a_{ji} \f$.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename DisableIf< IsComplex<Type>, Type >::Type
+   MatrixMarket::mirror( const Type& value, Symmetry symmetry )
+{
+   if( symmetry == skewSymmetric )
+      return -value;
+   else
+      return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from the given Matrix Market file.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The target CompressedMatrix or DynamicMatrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// This function reads the given Matrix Market file by means of the calling thread:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "A.mtx", A );
+   \endcode
+*/
+template< typename MT >  // Type of the matrix
+void readMatrixMarket( const std::string& filename, MT& mat )
+{
+   MatrixMarket().read( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a matrix from the given Matrix Market file by means of the given thread pool.
+// \ingroup math_serialization
+//
+// \param pool The thread pool for the parallel parsing.
+// \param filename The name of the Matrix Market file.
+// \param mat The target CompressedMatrix or DynamicMatrix.
+// \return void
+// \exception std::runtime_error Matrix could not be read.
+//
+// This function splits the given Matrix Market file into line-aligned chunks and parses them
+// in parallel on the given thread pool:
+
+   \code
+   blaze::ThreadPool pool( 8UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( pool, "A.mtx", A );
+   \endcode
+*/
+template< typename MT >  // Type of the matrix
+void readMatrixMarket( ThreadPool& pool, const std::string& filename, MT& mat )
+{
+   MatrixMarket( &pool ).read( filename, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given Matrix Market file.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+//
+// Sparse matrices are written in the \c coordinate format, dense matrices in the \c array
+// format.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeMatrixMarket( const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   MatrixMarket().write( filename, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given matrix into the given Matrix Market file by means of the given thread pool.
+// \ingroup math_serialization
+//
+// \param pool The thread pool for the parallel formatting.
+// \param filename The name of the Matrix Market file.
+// \param mat The matrix to be written.
+// \return void
+// \exception std::runtime_error Matrix could not be written.
+//
+// The rows (row-major sparse matrices) or columns (dense and column-major sparse matrices) are
+// formatted in parallel on the given thread pool and written to the file in order.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void writeMatrixMarket( ThreadPool& pool, const std::string& filename, const Matrix<MT,SO>& mat )
+{
+   MatrixMarket( &pool ).write( filename, ~mat );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,16 +41,19 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/serialization/SparseBlock.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Serialization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -197,7 +200,7 @@ class MatrixSerializer
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline MatrixSerializer();
+   explicit inline MatrixSerializer( bool compress = compressSparseIndices );
    // No explicitly declared copy constructor.
    //@}
    //**********************************************************************************************
@@ -306,6 +309,33 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive >
+   void deserializeNonZeros( Archive& archive, std::vector<uint64_t>& nonzeros, size_t bound );
+
+   template< typename Archive, typename MT, bool SO >
+   void deserializeBlockedRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   void deserializeBlockedRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
+
+   template< typename Archive, typename Type >
+   void deserializeBlockedRowMatrix( Archive& archive, CompressedMatrix<Type,rowMajor>& mat );
+
+   template< typename Archive, typename MT >
+   void deserializeBlockedRowMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void deserializeBlockedColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   void deserializeBlockedColumnMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat );
+
+   template< typename Archive, typename MT >
+   void deserializeBlockedColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename Type >
+   void deserializeBlockedColumnMatrix( Archive& archive, CompressedMatrix<Type,columnMajor>& mat );
    //@}
    //**********************************************************************************************
 
@@ -319,6 +349,7 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+   bool     compress_;     //!< Compression flag for the indices of sparse matrices.
    //@}
    //**********************************************************************************************
 };
@@ -334,9 +365,16 @@ class MatrixSerializer
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief The default constructor of the MatrixSerializer class.
+/*!\brief The constructor of the MatrixSerializer class.
+//
+// \param compress \a true to delta-encode the indices of sparse matrices, \a false otherwise.
+//
+// Via the \a compress parameter the index compression of sparse matrices can be selected
+// (see the SparseBlockWriter class template). By default, the setting of the configuration
+// file <em>./blaze/config/Serialization.h</em> is used. The setting has no influence on the
+// deserialization, which automatically detects the format of the archive.
 */
-MatrixSerializer::MatrixSerializer()
+MatrixSerializer::MatrixSerializer( bool compress )
    : version_    ( 0U  )  // The version of the archive
    , type_       ( 0U  )  // The type of the matrix
    , elementType_( 0U  )  // The type of an element
@@ -344,6 +382,7 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , compress_   ( compress )  // Compression flag for the indices of sparse matrices
 {}
 //*************************************************************************************************
 
@@ -393,7 +432,7 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 {
    typedef typename MT::ElementType  ET;
 
-   archive << uint8_t ( 1U );
+   archive << uint8_t ( IsDenseMatrix<MT>::value ? 1U : 2U );
    archive << uint8_t ( MatrixValueMapping<MT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
@@ -450,31 +489,40 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 // \param mat The matrix to be serialized.
 // \return void
 // \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function writes the number of non-zero elements of all rows (or columns in case of
+// a column-major matrix) as a single array, followed by the blocks of indices and values of
+// all non-zero elements (see the SparseBlockWriter class template).
 */
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
 void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
+   typedef typename MT::ElementType    ET;
    typedef typename MT::ConstIterator  ConstIterator;
 
-   if( IsRowMajorMatrix<MT>::value ) {
-      for( size_t i=0UL; i<(~mat).rows(); ++i ) {
-         archive << uint64_t( (~mat).nonZeros( i ) );
-         for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
-            archive << element->index() << element->value();
-         }
-      }
+   const size_t n( IsRowMajorMatrix<MT>::value ? (~mat).rows() : (~mat).columns() );
+
+   SparseBlockWriter<Archive,ET> writer( archive, compress_ );
+
+   std::vector<uint64_t> nonzeros( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros[i] = (~mat).nonZeros( i );
    }
-   else {
-      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
-         archive << uint64_t( (~mat).nonZeros( j ) );
-         for( ConstIterator element=(~mat).begin(j); element!=(~mat).end(j); ++element ) {
-            archive << element->index() << element->value();
-         }
+   if( n != 0UL ) {
+      archive.write( &nonzeros[0], n );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      writer.startSequence();
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         writer.write( element->index(), element->value() );
       }
    }
 
+   writer.flush();
+
    if( !archive ) {
       throw std::runtime_error( "Sparse matrix could not be serialized" );
    }
@@ -531,7 +579,7 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
       throw std::runtime_error( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( ( version_ != 1U && version_ != 2U ) || ( version_ == 2U && ( type_ & 2U ) == 0U ) ) {
       throw std::runtime_error( "Invalid version detected" );
    }
    else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
@@ -621,12 +669,18 @@ void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
    else if( type_ == 5UL ) {
       deserializeDenseColumnMatrix( archive, ~mat );
    }
-   else if( type_ == 3UL ) {
+   else if( type_ == 3UL && version_ == 1U ) {
       deserializeSparseRowMatrix( archive, ~mat );
    }
-   else if( type_ == 7UL ) {
+   else if( type_ == 7UL && version_ == 1U ) {
       deserializeSparseColumnMatrix( archive, ~mat );
    }
+   else if( type_ == 3UL ) {
+      deserializeBlockedRowMatrix( archive, ~mat );
+   }
+   else if( type_ == 7UL ) {
+      deserializeBlockedColumnMatrix( archive, ~mat );
+   }
    else {
       BLAZE_INTERNAL_ASSERT( false, "Undefined type flag" );
    }
@@ -1126,6 +1180,360 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes the number of non-zero elements of all rows/columns of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param nonzeros The vector to be filled with the number of non-zero elements.
+// \param bound The maximum number of non-zero elements per row/column.
+// \return void
+// \exception std::runtime_error Invalid number of elements detected.
+//
+// This function reads the number of non-zero elements of all rows/columns of a sparse matrix
+// that has been serialized in blocks. In case the number of elements of any row/column exceeds
+// the given bound or in case the total number of elements doesn't match the number of elements
+// given in the header, a \a std::runtime_error is thrown.
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::deserializeNonZeros( Archive& archive, std::vector<uint64_t>& nonzeros, size_t bound )
+{
+   if( !nonzeros.empty() ) {
+      archive.read( &nonzeros[0], nonzeros.size() );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Corrupt archive detected" );
+   }
+
+   uint64_t total( 0UL );
+
+   for( size_t i=0UL; i<nonzeros.size(); ++i ) {
+      if( nonzeros[i] > bound ) {
+         throw std::runtime_error( "Invalid number of elements detected" );
+      }
+      total += nonzeros[i];
+   }
+
+   if( total != number_ ) {
+      throw std::runtime_error( "Invalid number of elements detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked row-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix that has been serialized in blocks from
+// the archive and reconstitutes the given dense matrix. In case any error is detected during
+// the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserializeBlockedRowMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, columns_ );
+
+   std::vector<uint64_t> nonzeros( rows_ );
+   deserializeNonZeros( archive, nonzeros, columns_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   for( size_t i=0UL; i<rows_; ++i ) {
+      reader.startSequence();
+      for( size_t j=0UL; j<nonzeros[i]; ++j ) {
+         reader.read( index, value );
+         (~mat)(i,index) = value;
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked row-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix that has been serialized in blocks from
+// the archive and reconstitutes the given row-major sparse matrix. In case any error is detected
+// during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::deserializeBlockedRowMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, columns_ );
+
+   std::vector<uint64_t> nonzeros( rows_ );
+   deserializeNonZeros( archive, nonzeros, columns_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   for( size_t i=0UL; i<rows_; ++i )
+   {
+      (~mat).reserve( i, nonzeros[i] );
+
+      reader.startSequence();
+      for( size_t j=0UL; j<nonzeros[i]; ++j ) {
+         reader.read( index, value );
+         (~mat).append( i, index, value, false );
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked row-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix that has been serialized in blocks from
+// the archive and reconstitutes the given row-major compressed matrix. Since the matrix has
+// already been prepared for the total number of non-zero elements, the elements are appended
+// via the low-level append() and finalize() functions, which avoids the reallocation of the
+// following rows for every single row.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the matrix
+void MatrixSerializer::deserializeBlockedRowMatrix( Archive& archive, CompressedMatrix<Type,rowMajor>& mat )
+{
+   SparseBlockReader<Archive,Type> reader( archive, number_, columns_ );
+
+   std::vector<uint64_t> nonzeros( rows_ );
+   deserializeNonZeros( archive, nonzeros, columns_ );
+
+   size_t index( 0UL );
+   Type   value = Type();
+
+   for( size_t i=0UL; i<rows_; ++i )
+   {
+      reader.startSequence();
+      for( size_t j=0UL; j<nonzeros[i]; ++j ) {
+         reader.read( index, value );
+         mat.append( i, index, value, false );
+      }
+
+      mat.finalize( i );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked row-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a row-major sparse matrix that has been serialized in blocks from
+// the archive and reconstitutes the given column-major sparse matrix. In case any error is
+// detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::deserializeBlockedRowMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
+{
+   CompressedMatrix<typename MT::ElementType,rowMajor> tmp( rows_, columns_, number_ );
+   deserializeBlockedRowMatrix( archive, tmp );
+   (~mat) = tmp;
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked column-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix that has been serialized in blocks
+// from the archive and reconstitutes the given dense matrix. In case any error is detected
+// during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserializeBlockedColumnMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, rows_ );
+
+   std::vector<uint64_t> nonzeros( columns_ );
+   deserializeNonZeros( archive, nonzeros, rows_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   for( size_t j=0UL; j<columns_; ++j ) {
+      reader.startSequence();
+      for( size_t i=0UL; i<nonzeros[j]; ++i ) {
+         reader.read( index, value );
+         (~mat)(index,j) = value;
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked column-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix that has been serialized in blocks
+// from the archive and reconstitutes the given row-major sparse matrix. In case any error is
+// detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::deserializeBlockedColumnMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
+{
+   CompressedMatrix<typename MT::ElementType,columnMajor> tmp( rows_, columns_, number_ );
+   deserializeBlockedColumnMatrix( archive, tmp );
+   (~mat) = tmp;
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked column-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix that has been serialized in blocks
+// from the archive and reconstitutes the given column-major sparse matrix. In case any error
+// is detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+void MatrixSerializer::deserializeBlockedColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
+{
+   typedef typename MT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, rows_ );
+
+   std::vector<uint64_t> nonzeros( columns_ );
+   deserializeNonZeros( archive, nonzeros, rows_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   for( size_t j=0UL; j<columns_; ++j )
+   {
+      (~mat).reserve( j, nonzeros[j] );
+
+      reader.startSequence();
+      for( size_t i=0UL; i<nonzeros[j]; ++i ) {
+         reader.read( index, value );
+         (~mat).append( index, j, value, false );
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked column-major sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a column-major sparse matrix that has been serialized in blocks
+// from the archive and reconstitutes the given column-major compressed matrix. Since the matrix
+// has already been prepared for the total number of non-zero elements, the elements are appended
+// via the low-level append() and finalize() functions, which avoids the reallocation of the
+// following columns for every single column.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Data type of the matrix
+void MatrixSerializer::deserializeBlockedColumnMatrix( Archive& archive, CompressedMatrix<Type,columnMajor>& mat )
+{
+   SparseBlockReader<Archive,Type> reader( archive, number_, rows_ );
+
+   std::vector<uint64_t> nonzeros( columns_ );
+   deserializeNonZeros( archive, nonzeros, rows_ );
+
+   size_t index( 0UL );
+   Type   value = Type();
+
+   for( size_t j=0UL; j<columns_; ++j )
+   {
+      reader.startSequence();
+      for( size_t i=0UL; i<nonzeros[j]; ++i ) {
+         reader.read( index, value );
+         mat.append( index, j, value, false );
+      }
+
+      mat.finalize( j );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
@@ -0,0 +1,749 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/PanelMatrix.h
+//  \brief Out-of-core matrix/vector multiplication over serialized row panels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_PANELMATRIX_H_
+#define _BLAZE_MATH_SERIALIZATION_PANELMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/views/DenseSubmatrix.h>
+#include <blaze/math/views/DenseSubvector.h>
+#include <blaze/math/views/SparseSubmatrix.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/Archive.h>
+#include <blaze/util/TaskGroup.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS PANELHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header of a matrix file consisting of serialized row panels.
+// \ingroup math_serialization
+//
+// The PanelHeader represents the meta information at the beginning of a file written by the
+// serializePanels() function. The header is followed by \a panels row-major matrices in the
+// portable format of the MatrixSerializer. All panels consist of \a panelRows rows and
+// \a columns columns, except for the last panel, which contains the remaining rows.
+*/
+struct PanelHeader
+{
+   //**Compilation flags***************************************************************************
+   //! The current version of the panel file layout.
+   enum { currentVersion = 1 };
+   //**********************************************************************************************
+
+   uint8_t  version;      //!< The version of the panel file layout.
+   uint8_t  type;         //!< The type of the panels (1 for dense, 2 for sparse panels).
+   uint8_t  elementType;  //!< The type of an element.
+   uint8_t  elementSize;  //!< The size in bytes of a single element of the matrix.
+   uint64_t rows;         //!< The total number of rows of the matrix.
+   uint64_t columns;      //!< The number of columns of the matrix.
+   uint64_t panelRows;    //!< The number of rows per panel.
+   uint64_t panels;       //!< The number of panels.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core matrix stored as a sequence of serialized row panels.
+// \ingroup math_serialization
+//
+// The PanelMatrix class template represents a matrix that is too large to be kept in main memory.
+// The matrix is stored in a file as a sequence of row panels, i.e. blocks of consecutive rows,
+// which is written by the serializePanels() function. The PanelMatrix provides the matrix/vector
+// multiplications \f$ \vec{y}=A*\vec{x} \f$ and \f$ \vec{y}=A^T*\vec{x} \f$ by streaming the
+// panels from disk, such that at most two panels reside in memory at any time:
+
+   \code
+   // Writing a large sparse matrix in panels of 100000 rows
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      // ... Resizing and initialization
+
+      blaze::serializePanels( "A.panels", A, 100000UL );
+   }
+
+   // Power iteration on the out-of-core matrix
+   {
+      blaze::ThreadPool pool( 1UL );
+      blaze::PanelMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( "A.panels" );
+      blaze::DynamicVector<double> x( A.columns(), 1.0 ), y( A.rows() );
+
+      for( size_t iteration=0UL; iteration<100UL; ++iteration ) {
+         A.multiply( pool, x, y );
+         x = y / length( y );
+      }
+   }
+   \endcode
+
+// The template argument \a MT specifies the in-memory type of a single panel. It has to be a
+// row-major \c CompressedMatrix or \c DynamicMatrix and its element type has to match the element
+// type of the serialized matrix. Each panel is multiplied by means of the according
+// matrix/vector multiplication kernel of \b Blaze (e.g. the sparse matrix/dense vector kernel for
+// a \c CompressedMatrix). In case a thread pool is given, the next panel is read by a task of the
+// thread pool while the current panel is multiplied by the calling thread (double buffering).
+// Therefore the number of rows per panel should be chosen such that reading a panel takes
+// roughly as long as multiplying it and two panels comfortably fit into main memory.
+//
+// In case the file cannot be read or doesn't contain a matrix of the expected type, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of a single row panel
+class PanelMatrix : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef MT                        PanelType;    //!< Type of a single row panel.
+   typedef typename MT::ElementType  ElementType;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The size of the stream buffer for reading the panels.
+   enum { bufferSize = 1048576 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit PanelMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const std::string& filename () const;
+   inline size_t             rows     () const;
+   inline size_t             columns  () const;
+   inline size_t             panels   () const;
+   inline size_t             panelRows() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Multiplication functions********************************************************************
+   /*!\name Multiplication functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void multiply( const DenseVector<VT1,columnVector>& x, DenseVector<VT2,columnVector>& y ) const;
+
+   template< typename VT1, typename VT2 >
+   void multiply( ThreadPool& pool, const DenseVector<VT1,columnVector>& x,
+                  DenseVector<VT2,columnVector>& y ) const;
+
+   template< typename VT1, typename VT2 >
+   void transMultiply( const DenseVector<VT1,columnVector>& x, DenseVector<VT2,columnVector>& y ) const;
+
+   template< typename VT1, typename VT2 >
+   void transMultiply( ThreadPool& pool, const DenseVector<VT1,columnVector>& x,
+                       DenseVector<VT2,columnVector>& y ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Kernel definitions**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Kernel for the multiplication of a single panel (\f$ \vec{y}_p=P*\vec{x} \f$).
+   */
+   template< typename VT1, typename VT2 >
+   struct MultKernel
+   {
+      const VT1* x_;  //!< The right-hand side vector.
+      VT2*       y_;  //!< The target vector.
+
+      inline void operator()( const MT& panel, size_t row ) const {
+         subvector( *y_, row, panel.rows() ) = panel * (*x_);
+      }
+   };
+
+   /*!\brief Kernel for the transpose multiplication of a single panel (\f$ \vec{y}+=P^T*\vec{x}_p \f$).
+   */
+   template< typename VT1, typename VT2 >
+   struct TransMultKernel
+   {
+      const VT1* x_;  //!< The right-hand side vector.
+      VT2*       y_;  //!< The target vector.
+
+      inline void operator()( const MT& panel, size_t row ) const {
+         (*y_) += trans( panel ) * subvector( *x_, row, panel.rows() );
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Streaming functions*************************************************************************
+   /*!\name Streaming functions */
+   //@{
+   template< typename Kernel >
+   void stream( ThreadPool* pool, const Kernel& kernel ) const;
+
+   static void readHeader( Archive<std::ifstream>& archive, PanelHeader& header );
+
+   static void load( Archive<std::ifstream>* archive, MT* panel, size_t rows, size_t columns,
+                     boost::exception_ptr* error );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string filename_;  //!< The name of the panel file.
+   PanelHeader header_;    //!< The meta information of the panel file.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Opening the given panel file.
+//
+// \param filename The name of the panel file.
+// \exception std::runtime_error Invalid panel file.
+//
+// The constructor reads and validates the header of the given panel file. The panels are not
+// read until the first multiplication.
+*/
+template< typename MT >  // Type of a single row panel
+PanelMatrix<MT>::PanelMatrix( const std::string& filename )
+   : filename_( filename )  // The name of the panel file
+   , header_  ()            // The meta information of the panel file
+{
+   Archive<std::ifstream> archive( filename_.c_str(), std::ifstream::binary );
+
+   if( !archive ) {
+      throw std::runtime_error( "Unable to open file '" + filename_ + "'" );
+   }
+
+   readHeader( archive, header_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the name of the panel file.
+//
+// \return The name of the panel file.
+*/
+template< typename MT >  // Type of a single row panel
+inline const std::string& PanelMatrix<MT>::filename() const
+{
+   return filename_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename MT >  // Type of a single row panel
+inline size_t PanelMatrix<MT>::rows() const
+{
+   return header_.rows;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename MT >  // Type of a single row panel
+inline size_t PanelMatrix<MT>::columns() const
+{
+   return header_.columns;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of row panels of the matrix.
+//
+// \return The number of row panels.
+*/
+template< typename MT >  // Type of a single row panel
+inline size_t PanelMatrix<MT>::panels() const
+{
+   return header_.panels;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows per panel.
+//
+// \return The number of rows per panel.
+//
+// Note that the last panel may contain less rows.
+*/
+template< typename MT >  // Type of a single row panel
+inline size_t PanelMatrix<MT>::panelRows() const
+{
+   return header_.panelRows;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core matrix/vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+//
+// \param x The right-hand side dense vector.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Panel could not be read.
+//
+// This function streams all panels of the matrix from disk by means of the calling thread and
+// multiplies each panel with the given vector \a x. The vectors \a x and \a y must not alias.
+*/
+template< typename MT >  // Type of a single row panel
+template< typename VT1   // Type of the right-hand side dense vector
+        , typename VT2 > // Type of the target dense vector
+void PanelMatrix<MT>::multiply( const DenseVector<VT1,columnVector>& x,
+                                DenseVector<VT2,columnVector>& y ) const
+{
+   if( (~x).size() != columns() || (~y).size() != rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const MultKernel<VT1,VT2> kernel = { &(~x), &(~y) };
+   stream( NULL, kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core matrix/vector multiplication (\f$ \vec{y}=A*\vec{x} \f$) with asynchronous reads.
+//
+// \param pool The thread pool for the asynchronous reading of the panels.
+// \param x The right-hand side dense vector.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Panel could not be read.
+//
+// This function streams all panels of the matrix from disk and multiplies each panel with the
+// given vector \a x. While a panel is multiplied by the calling thread, the next panel is read
+// by a task of the given thread pool. The vectors \a x and \a y must not alias.
+*/
+template< typename MT >  // Type of a single row panel
+template< typename VT1   // Type of the right-hand side dense vector
+        , typename VT2 > // Type of the target dense vector
+void PanelMatrix<MT>::multiply( ThreadPool& pool, const DenseVector<VT1,columnVector>& x,
+                                DenseVector<VT2,columnVector>& y ) const
+{
+   if( (~x).size() != columns() || (~y).size() != rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const MultKernel<VT1,VT2> kernel = { &(~x), &(~y) };
+   stream( &pool, kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core transpose matrix/vector multiplication (\f$ \vec{y}=A^T*\vec{x} \f$).
+//
+// \param x The right-hand side dense vector.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Panel could not be read.
+//
+// This function streams all panels of the matrix from disk by means of the calling thread and
+// accumulates the products of the transposed panels with the according parts of \a x. The
+// vectors \a x and \a y must not alias.
+*/
+template< typename MT >  // Type of a single row panel
+template< typename VT1   // Type of the right-hand side dense vector
+        , typename VT2 > // Type of the target dense vector
+void PanelMatrix<MT>::transMultiply( const DenseVector<VT1,columnVector>& x,
+                                     DenseVector<VT2,columnVector>& y ) const
+{
+   if( (~x).size() != rows() || (~y).size() != columns() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   reset( ~y );
+
+   const TransMultKernel<VT1,VT2> kernel = { &(~x), &(~y) };
+   stream( NULL, kernel );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core transpose matrix/vector multiplication (\f$ \vec{y}=A^T*\vec{x} \f$) with
+//        asynchronous reads.
+//
+// \param pool The thread pool for the asynchronous reading of the panels.
+// \param x The right-hand side dense vector.
+// \param y The target dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Panel could not be read.
+//
+// This function streams all panels of the matrix from disk and accumulates the products of the
+// transposed panels with the according parts of \a x. While a panel is multiplied by the calling
+// thread, the next panel is read by a task of the given thread pool. The vectors \a x and \a y
+// must not alias.
+*/
+template< typename MT >  // Type of a single row panel
+template< typename VT1   // Type of the right-hand side dense vector
+        , typename VT2 > // Type of the target dense vector
+void PanelMatrix<MT>::transMultiply( ThreadPool& pool, const DenseVector<VT1,columnVector>& x,
+                                     DenseVector<VT2,columnVector>& y ) const
+{
+   if( (~x).size() != rows() || (~y).size() != columns() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   reset( ~y );
+
+   const TransMultKernel<VT1,VT2> kernel = { &(~x), &(~y) };
+   stream( &pool, kernel );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STREAMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Streams all panels from disk and applies the given kernel to each panel.
+//
+// \param pool Pointer to the thread pool for the asynchronous reads (may be NULL).
+// \param kernel The kernel to be applied to each panel.
+// \return void
+// \exception std::runtime_error Panel could not be read.
+//
+// The panels are read into two alternating buffers. In case a thread pool is given, the next
+// panel is read into the idle buffer by a task of the thread pool while the kernel is applied
+// to the current panel. Otherwise reading and computing alternate within the calling thread.
+*/
+template< typename MT >      // Type of a single row panel
+template< typename Kernel >  // Type of the panel kernel
+void PanelMatrix<MT>::stream( ThreadPool* pool, const Kernel& kernel ) const
+{
+   std::vector<char> buffer( bufferSize );
+   std::ifstream file;
+   file.rdbuf()->pubsetbuf( &buffer[0], buffer.size() );
+   file.open( filename_.c_str(), std::ifstream::binary );
+
+   Archive<std::ifstream> archive( file );
+
+   if( !archive ) {
+      throw std::runtime_error( "Unable to open file '" + filename_ + "'" );
+   }
+
+   PanelHeader header;
+   readHeader( archive, header );
+
+   if( header.rows != header_.rows || header.columns != header_.columns ||
+       header.panelRows != header_.panelRows ) {
+      throw std::runtime_error( "Panel file has been modified" );
+   }
+
+   const size_t n( header_.panels );
+   const size_t m( header_.panelRows );
+
+   MT panels[2];
+   boost::exception_ptr error;
+
+   if( n > 0UL ) {
+      load( &archive, &panels[0], std::min( m, rows() ), columns(), &error );
+      if( error ) boost::rethrow_exception( error );
+   }
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const MT& current( panels[k%2UL] );
+      MT* const next( &panels[(k+1UL)%2UL] );
+      const size_t row( k*m );
+      const size_t nextRows( ( k+1UL < n )?( std::min( m, rows() - row - m ) ):( 0UL ) );
+
+      if( nextRows > 0UL && pool != NULL ) {
+         TaskGroup group( *pool );
+         group.run( &PanelMatrix::load, &archive, next, nextRows, columns(), &error );
+         kernel( current, row );
+         group.wait();
+      }
+      else {
+         kernel( current, row );
+         if( nextRows > 0UL )
+            load( &archive, next, nextRows, columns(), &error );
+      }
+
+      if( error ) boost::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads and validates the header of a panel file.
+//
+// \param archive The archive to be read from.
+// \param header The resulting meta information.
+// \return void
+// \exception std::runtime_error Invalid panel file.
+*/
+template< typename MT >  // Type of a single row panel
+void PanelMatrix<MT>::readHeader( Archive<std::ifstream>& archive, PanelHeader& header )
+{
+   archive >> header.version >> header.type >> header.elementType >> header.elementSize
+           >> header.rows >> header.columns >> header.panelRows >> header.panels;
+
+   if( !archive ) {
+      throw std::runtime_error( "Corrupt panel file detected" );
+   }
+   else if( header.version != PanelHeader::currentVersion ) {
+      throw std::runtime_error( "Invalid version detected" );
+   }
+   else if( header.type != ( IsDenseMatrix<MT>::value ? 1U : 2U ) ) {
+      throw std::runtime_error( "Invalid panel type detected" );
+   }
+   else if( header.elementType != TypeValueMapping<ElementType>::value ) {
+      throw std::runtime_error( "Invalid element type detected" );
+   }
+   else if( header.elementSize != sizeof( ElementType ) ) {
+      throw std::runtime_error( "Invalid element size detected" );
+   }
+   else if( ( header.rows > 0UL && header.panelRows == 0UL ) ||
+            ( header.rows == 0UL && header.panels != 0UL ) ||
+            ( header.rows > 0UL && header.panels != ( header.rows - 1UL ) / header.panelRows + 1UL ) ) {
+      throw std::runtime_error( "Invalid number of panels detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the next panel from the given archive.
+//
+// \param archive The archive to be read from.
+// \param panel The target panel.
+// \param rows The expected number of rows of the panel.
+// \param columns The expected number of columns of the panel.
+// \param error The exception thrown during the reading (if any).
+// \return void
+//
+// This function captures any exception thrown during the reading such that it can be executed
+// by a task of a thread pool.
+*/
+template< typename MT >  // Type of a single row panel
+void PanelMatrix<MT>::load( Archive<std::ifstream>* archive, MT* panel, size_t rows,
+                            size_t columns, boost::exception_ptr* error )
+{
+   try {
+      (*archive) >> (*panel);
+
+      if( panel->rows() != rows || panel->columns() != columns ) {
+         throw std::runtime_error( "Invalid panel size detected" );
+      }
+   }
+   catch( ... ) {
+      *error = boost::current_exception();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serializes the given matrix as a sequence of row panels.
+// \ingroup math_serialization
+//
+// \param filename The name of the panel file to be written.
+// \param mat The matrix to be serialized.
+// \param panelRows The number of rows per panel.
+// \return void
+// \exception std::invalid_argument Invalid number of rows per panel.
+// \exception std::runtime_error Matrix could not be serialized.
+//
+// This function writes the given dense or sparse matrix as a sequence of row-major panels of
+// \a panelRows rows (the last panel contains the remaining rows). The resulting file can be
+// used by a PanelMatrix with a \c DynamicMatrix (dense matrices) or \c CompressedMatrix (sparse
+// matrices) panel type with the same element type:
+
+   \code
+   blaze::CompressedMatrix<float,blaze::columnMajor> A;
+   // ... Resizing and initialization
+
+   blaze::serializePanels( "A.panels", A, 50000UL );
+
+   blaze::PanelMatrix< blaze::CompressedMatrix<float,blaze::rowMajor> > B( "A.panels" );
+   \endcode
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void serializePanels( const std::string& filename, const Matrix<MT,SO>& mat, size_t panelRows )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   typedef typename If< IsDenseMatrix<MT>
+                      , DynamicMatrix<ET,rowMajor>
+                      , CompressedMatrix<ET,rowMajor> >::Type  PanelType;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   if( panelRows == 0UL ) {
+      throw std::invalid_argument( "Invalid number of rows per panel" );
+   }
+
+   CT A( ~mat );
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t panels( ( m == 0UL )?( 0UL ):( ( m - 1UL ) / panelRows + 1UL ) );
+
+   Archive<std::ofstream> archive( filename.c_str(), std::ofstream::binary | std::ofstream::trunc );
+
+   if( !archive ) {
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   archive << uint8_t ( PanelHeader::currentVersion )
+           << uint8_t ( IsDenseMatrix<MT>::value ? 1U : 2U )
+           << uint8_t ( TypeValueMapping<ET>::value )
+           << uint8_t ( sizeof( ET ) )
+           << uint64_t( m )
+           << uint64_t( n )
+           << uint64_t( panelRows )
+           << uint64_t( panels );
+
+   for( size_t row=0UL; row<m; row+=panelRows ) {
+      const PanelType panel( submatrix( A, row, 0UL, std::min( panelRows, m - row ), n ) );
+      archive << panel;
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
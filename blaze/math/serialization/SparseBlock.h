@@ -0,0 +1,638 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/SparseBlock.h
+//  \brief Block-wise serialization of the elements of sparse vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_SPARSEBLOCK_H_
+#define _BLAZE_MATH_SERIALIZATION_SPARSEBLOCK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPARSEBLOCKWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise writer for the non-zero elements of sparse vectors and matrices.
+// \ingroup math_serialization
+//
+// The SparseBlockWriter class template is an auxiliary class for the MatrixSerializer and the
+// VectorSerializer. It buffers the indices and values of the non-zero elements of a sparse
+// vector or matrix and writes them in blocks of \a blockSize elements via the array API of
+// the Archive class, which replaces the two stream operations per non-zero element by a few
+// large write operations per block. The resulting format has the following layout:
+
+   \code
+   uint8_t  encoding   // 0 for plain indices, 1 for delta-encoded indices
+   uint64_t blockSize  // The maximum number of elements per block
+   ...                 // Optional data written by the serializer (e.g. the number of non-zero
+                       // elements per row/column of a sparse matrix)
+   block 0             // The first block of indices and values
+   block 1             // The second block of indices and values
+   ...
+   \endcode
+
+// All blocks but the last contain exactly \a blockSize elements. In case of plain indices each
+// block consists of an array of 64-bit indices followed by an array of values. In case of
+// delta-encoded indices each index is stored as the difference to the previous index of the
+// same sequence (i.e. the same row/column of a matrix), encoded as variable length integer
+// with 7 bits per byte. The encoded indices are preceded by their total size in bytes and are
+// followed by the array of values. Values of non-numeric type are serialized one by one.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+class SparseBlockWriter : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The maximum number of non-zero elements per block.
+   enum { blockSize = 65536 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SparseBlockWriter( Archive& archive, bool compress );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   inline void startSequence();
+   inline void write( size_t index, const Type& value );
+   inline void flush();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Write functions*****************************************************************************
+   /*!\name Write functions */
+   //@{
+   template< typename T >
+   inline typename EnableIf< IsNumeric<T> >::Type writeValues( const T* values, size_t n );
+
+   template< typename T >
+   inline typename DisableIf< IsNumeric<T> >::Type writeValues( const T* values, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Archive& archive_;   //!< The archive to be written.
+   bool     compress_;  //!< Compression flag for the indices.
+   bool     first_;     //!< Flag for the first element of the current sequence.
+   size_t   previous_;  //!< The index of the previously written element.
+
+   std::vector<uint64_t> indices_;  //!< Buffer for the plain indices of the current block.
+   std::vector<uint8_t>  bytes_;    //!< Buffer for the encoded indices of the current block.
+   std::vector<Type>     values_;   //!< Buffer for the values of the current block.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the SparseBlockWriter class.
+//
+// \param archive The archive to be written.
+// \param compress \a true to delta-encode the indices, \a false to store plain indices.
+// \exception std::runtime_error Block header could not be serialized.
+//
+// The constructor immediately writes the encoding and the block size to the given archive.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline SparseBlockWriter<Archive,Type>::SparseBlockWriter( Archive& archive, bool compress )
+   : archive_ ( archive  )  // The archive to be written
+   , compress_( compress )  // Compression flag for the indices
+   , first_   ( true     )  // Flag for the first element of the current sequence
+   , previous_( 0UL      )  // The index of the previously written element
+   , indices_ ()            // Buffer for the plain indices of the current block
+   , bytes_   ()            // Buffer for the encoded indices of the current block
+   , values_  ()            // Buffer for the values of the current block
+{
+   archive_ << uint8_t ( compress_ ? 1U : 0U );
+   archive_ << uint64_t( blockSize );
+
+   if( !archive_ ) {
+      throw std::runtime_error( "Block header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WRITE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starts a new sequence of strictly increasing indices.
+//
+// \return void
+//
+// This function has to be called before the first element of each row/column of a sparse
+// matrix and before the first element of a sparse vector. The first index of a sequence is
+// not delta-encoded.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockWriter<Archive,Type>::startSequence()
+{
+   first_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adds a non-zero element to the current block.
+//
+// \param index The index of the element within the current sequence.
+// \param value The value of the element.
+// \return void
+// \exception std::runtime_error Sparse block could not be serialized.
+//
+// This function adds the given element to the current block. In case the block is full, it
+// is written to the archive. Within a sequence the indices must be strictly increasing.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockWriter<Archive,Type>::write( size_t index, const Type& value )
+{
+   BLAZE_INTERNAL_ASSERT( first_ || index > previous_, "Index is not strictly increasing" );
+
+   if( compress_ ) {
+      uint64_t delta( first_ ? index : index - previous_ );
+      while( delta >= 0x80U ) {
+         bytes_.push_back( static_cast<uint8_t>( delta | 0x80U ) );
+         delta >>= 7;
+      }
+      bytes_.push_back( static_cast<uint8_t>( delta ) );
+   }
+   else {
+      indices_.push_back( index );
+   }
+
+   values_.push_back( value );
+
+   first_    = false;
+   previous_ = index;
+
+   if( values_.size() == size_t( blockSize ) ) {
+      flush();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current (possibly incomplete) block to the archive.
+//
+// \return void
+// \exception std::runtime_error Sparse block could not be serialized.
+//
+// This function writes all buffered elements to the archive. It has to be called once after
+// the last element has been added in order to write the final, incomplete block.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockWriter<Archive,Type>::flush()
+{
+   const size_t n( values_.size() );
+
+   if( n == 0UL ) return;
+
+   if( compress_ ) {
+      archive_ << uint64_t( bytes_.size() );
+      archive_.write( &bytes_[0], bytes_.size() );
+   }
+   else {
+      archive_.write( &indices_[0], n );
+   }
+
+   writeValues( &values_[0], n );
+
+   if( !archive_ ) {
+      throw std::runtime_error( "Sparse block could not be serialized" );
+   }
+
+   indices_.clear();
+   bytes_.clear();
+   values_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes an array of numeric values to the archive.
+//
+// \param values Pointer to the first value.
+// \param n The number of values.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+template< typename T >      // Type of the values
+inline typename EnableIf< IsNumeric<T> >::Type
+   SparseBlockWriter<Archive,Type>::writeValues( const T* values, size_t n )
+{
+   archive_.write( values, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes an array of non-numeric values to the archive.
+//
+// \param values Pointer to the first value.
+// \param n The number of values.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+template< typename T >      // Type of the values
+inline typename DisableIf< IsNumeric<T> >::Type
+   SparseBlockWriter<Archive,Type>::writeValues( const T* values, size_t n )
+{
+   for( size_t i=0UL; i<n && archive_; ++i ) {
+      archive_ << values[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPARSEBLOCKREADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise reader for the non-zero elements of sparse vectors and matrices.
+// \ingroup math_serialization
+//
+// The SparseBlockReader class template is the counterpart of the SparseBlockWriter class
+// template. It reads the blocks of indices and values written by a SparseBlockWriter and
+// hands out the elements one by one. All indices are validated, i.e. in case an index is not
+// smaller than the given upper bound or in case the indices of a sequence are not strictly
+// increasing, a \a std::runtime_error exception is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+class SparseBlockReader : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The maximum accepted number of non-zero elements per block.
+   enum { maxBlockSize = 16777216 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SparseBlockReader( Archive& archive, size_t number, size_t bound );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   inline void startSequence();
+   inline void read( size_t& index, Type& value );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Read functions******************************************************************************
+   /*!\name Read functions */
+   //@{
+   inline void fetch();
+
+   template< typename T >
+   inline typename EnableIf< IsNumeric<T> >::Type readValues( T* values, size_t n );
+
+   template< typename T >
+   inline typename DisableIf< IsNumeric<T> >::Type readValues( T* values, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Archive& archive_;    //!< The archive to be read from.
+   bool     compress_;   //!< Compression flag for the indices.
+   size_t   blockSize_;  //!< The maximum number of elements per block.
+   size_t   remaining_;  //!< The number of elements not yet fetched from the archive.
+   size_t   bound_;      //!< The exclusive upper bound for all indices.
+   size_t   pos_;        //!< The position of the next element within the current block.
+   size_t   size_;       //!< The number of elements of the current block.
+   bool     first_;      //!< Flag for the first element of the current sequence.
+   size_t   previous_;   //!< The index of the previously read element.
+
+   std::vector<uint64_t> indices_;  //!< Buffer for the indices of the current block.
+   std::vector<uint8_t>  bytes_;    //!< Buffer for the encoded indices of the current block.
+   std::vector<Type>     values_;   //!< Buffer for the values of the current block.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the SparseBlockReader class.
+//
+// \param archive The archive to be read from.
+// \param number The total number of elements to be read.
+// \param bound The exclusive upper bound for all indices.
+// \exception std::runtime_error Corrupt archive detected.
+//
+// The constructor immediately reads the encoding and the block size from the given archive.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline SparseBlockReader<Archive,Type>::SparseBlockReader( Archive& archive, size_t number, size_t bound )
+   : archive_  ( archive )  // The archive to be read from
+   , compress_ ( false   )  // Compression flag for the indices
+   , blockSize_( 0UL     )  // The maximum number of elements per block
+   , remaining_( number  )  // The number of elements not yet fetched from the archive
+   , bound_    ( bound   )  // The exclusive upper bound for all indices
+   , pos_      ( 0UL     )  // The position of the next element within the current block
+   , size_     ( 0UL     )  // The number of elements of the current block
+   , first_    ( true    )  // Flag for the first element of the current sequence
+   , previous_ ( 0UL     )  // The index of the previously read element
+   , indices_  ()           // Buffer for the indices of the current block
+   , bytes_    ()           // Buffer for the encoded indices of the current block
+   , values_   ()           // Buffer for the values of the current block
+{
+   uint8_t  encoding ( 0U  );
+   uint64_t blockSize( 0UL );
+
+   if( !( archive_ >> encoding >> blockSize ) || encoding > 1U ||
+       blockSize == 0UL || blockSize > uint64_t( maxBlockSize ) ) {
+      throw std::runtime_error( "Corrupt archive detected" );
+   }
+
+   compress_  = ( encoding == 1U );
+   blockSize_ = blockSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  READ FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starts a new sequence of strictly increasing indices.
+//
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockReader<Archive,Type>::startSequence()
+{
+   first_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the next non-zero element.
+//
+// \param index Reference to the index of the element.
+// \param value Reference to the value of the element.
+// \return void
+// \exception std::runtime_error Invalid index detected.
+// \exception std::runtime_error Sparse block could not be deserialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockReader<Archive,Type>::read( size_t& index, Type& value )
+{
+   if( pos_ == size_ ) {
+      fetch();
+   }
+
+   const uint64_t stored( indices_[pos_] );
+
+   if( compress_ && !first_ ) {
+      if( stored == 0UL || stored >= bound_ - previous_ ) {
+         throw std::runtime_error( "Invalid index detected" );
+      }
+      index = previous_ + stored;
+   }
+   else {
+      if( stored >= bound_ || ( !first_ && stored <= previous_ ) ) {
+         throw std::runtime_error( "Invalid index detected" );
+      }
+      index = stored;
+   }
+
+   value = values_[pos_];
+
+   ++pos_;
+   first_    = false;
+   previous_ = index;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads the next block of indices and values from the archive.
+//
+// \return void
+// \exception std::runtime_error Sparse block could not be deserialized.
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+inline void SparseBlockReader<Archive,Type>::fetch()
+{
+   const size_t n( std::min( blockSize_, remaining_ ) );
+
+   if( n == 0UL ) {
+      throw std::runtime_error( "Sparse block could not be deserialized" );
+   }
+
+   indices_.resize( n );
+   values_.resize( n );
+
+   if( compress_ )
+   {
+      uint64_t bytes( 0UL );
+
+      if( !( archive_ >> bytes ) || bytes < n || bytes > 10UL*n ) {
+         throw std::runtime_error( "Sparse block could not be deserialized" );
+      }
+
+      bytes_.resize( bytes );
+      archive_.read( &bytes_[0], bytes );
+
+      size_t pos( 0UL );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         uint64_t delta( 0UL );
+         size_t   shift( 0UL );
+
+         while( true ) {
+            if( pos == bytes || shift > 63UL ) {
+               throw std::runtime_error( "Sparse block could not be deserialized" );
+            }
+            const uint8_t code( bytes_[pos++] );
+            delta |= uint64_t( code & 0x7FU ) << shift;
+            if( ( code & 0x80U ) == 0U ) break;
+            shift += 7UL;
+         }
+
+         indices_[i] = delta;
+      }
+
+      if( pos != bytes ) {
+         throw std::runtime_error( "Sparse block could not be deserialized" );
+      }
+   }
+   else
+   {
+      archive_.read( &indices_[0], n );
+   }
+
+   readValues( &values_[0], n );
+
+   if( !archive_ ) {
+      throw std::runtime_error( "Sparse block could not be deserialized" );
+   }
+
+   remaining_ -= n;
+   size_       = n;
+   pos_        = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads an array of numeric values from the archive.
+//
+// \param values Pointer to the first value.
+// \param n The number of values.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+template< typename T >      // Type of the values
+inline typename EnableIf< IsNumeric<T> >::Type
+   SparseBlockReader<Archive,Type>::readValues( T* values, size_t n )
+{
+   archive_.read( values, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads an array of non-numeric values from the archive.
+//
+// \param values Pointer to the first value.
+// \param n The number of values.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename Type >   // Type of the elements
+template< typename T >      // Type of the values
+inline typename DisableIf< IsNumeric<T> >::Type
+   SparseBlockReader<Archive,Type>::readValues( T* values, size_t n )
+{
+   for( size_t i=0UL; i<n && archive_; ++i ) {
+      archive_ >> values[i];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
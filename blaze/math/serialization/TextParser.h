@@ -0,0 +1,656 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/TextParser.h
+//  \brief Auxiliary functionality for the parallel parsing and formatting of text files
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_TEXTPARSER_H_
+#define _BLAZE_MATH_SERIALIZATION_TEXTPARSER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/exception_ptr.hpp>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/NonCreatable.h>
+#include <blaze/util/TaskGroup.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsLongDouble.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functionality for the parallel parsing and formatting of text files.
+// \ingroup math_serialization
+//
+// The TextParser class provides the building blocks of the Matrix Market and CSV readers and
+// writers: The splitting of a memory-mapped text file into line-aligned chunks, the parsing of
+// indices and values within a chunk without ever reading beyond the end of the chunk, the
+// formatting of values, and the execution of one task per chunk, either serially or on a
+// thread pool.
+*/
+class TextParser : private NonCreatable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The maximum number of characters of a single value.
+   enum { maxTokenSize = 127 };
+
+   //! The minimum number of bytes per chunk.
+   enum { minChunkSize = 65536 };
+   //**********************************************************************************************
+
+   //**LineCounter class definition****************************************************************
+   /*!\brief Task for counting the non-empty lines of a chunk.
+   */
+   struct LineCounter
+   {
+      const char* begin_;  //!< The beginning of the chunk.
+      const char* end_;    //!< The end of the chunk.
+      size_t      lines_;  //!< The number of non-empty lines within the chunk.
+
+      inline void run();
+   };
+   //**********************************************************************************************
+
+   //**Chunk functions*****************************************************************************
+   /*!\name Chunk functions */
+   //@{
+   static inline size_t chunks( const ThreadPool* pool, size_t bytes );
+   static inline void   split ( const char* begin, const char* end, size_t n,
+                                std::vector<const char*>& bounds );
+
+   template< typename Task >
+   static inline void run( ThreadPool* pool, std::vector<Task>& tasks );
+   //@}
+   //**********************************************************************************************
+
+   //**Parsing functions***************************************************************************
+   /*!\name Parsing functions */
+   //@{
+   static inline bool skipBlanks( const char*& pos, const char* end );
+   static inline void skipLine  ( const char*& pos, const char* end );
+   static inline bool parseIndex( const char*& pos, const char* end, size_t& index );
+   static inline bool parseWord ( const char*& pos, const char* end, std::string& word );
+   static inline bool parseDelimiter( const char*& pos, const char* end, char delimiter );
+
+   template< typename Type >
+   static inline bool parseValue( const char*& pos, const char* end, Type& value, char delimiter = ' ' );
+   //@}
+   //**********************************************************************************************
+
+   //**Formatting functions************************************************************************
+   /*!\name Formatting functions */
+   //@{
+   template< typename Type >
+   static inline typename EnableIf< IsIntegral<Type> >::Type
+      formatValue( std::string& text, const Type& value );
+
+   template< typename Type >
+   static inline typename EnableIf< IsComplex<Type> >::Type
+      formatValue( std::string& text, const Type& value );
+
+   template< typename Type >
+   static inline typename DisableIf< Or< IsIntegral<Type>, IsComplex<Type> > >::Type
+      formatValue( std::string& text, const Type& value );
+
+   static inline void formatIndex( std::string& text, size_t index );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Task >
+   static void execute( Task* task, boost::exception_ptr* error );
+
+   static inline bool readToken( const char*& pos, const char* end, char delimiter, char* token );
+
+   template< typename Type >
+   static inline typename EnableIf< IsIntegral<Type>, bool >::Type
+      convert( const char* token, Type& value );
+
+   template< typename Type >
+   static inline typename EnableIf< IsComplex<Type>, bool >::Type
+      convert( const char* token, Type& value );
+
+   template< typename Type >
+   static inline typename DisableIf< Or< IsIntegral<Type>, IsComplex<Type> >, bool >::Type
+      convert( const char* token, Type& value );
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHUNK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the number of chunks for a text of the given size.
+//
+// \param pool Pointer to the thread pool used for the parsing (may be NULL).
+// \param bytes The total size of the text in bytes.
+// \return The number of chunks.
+//
+// In case no thread pool is given, the text is processed in a single chunk. Otherwise the text
+// is split into four chunks per thread to balance the load, but no chunk is smaller than
+// \a minChunkSize bytes.
+*/
+inline size_t TextParser::chunks( const ThreadPool* pool, size_t bytes )
+{
+   if( pool == NULL || pool->size() < 2UL ) return 1UL;
+   return std::min( 4UL*pool->size(), bytes/size_t( minChunkSize ) + 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Splits the given text into line-aligned chunks of roughly equal size.
+//
+// \param begin The beginning of the text.
+// \param end The end of the text.
+// \param n The number of chunks.
+// \param bounds The resulting \a n+1 chunk boundaries.
+// \return void
+//
+// Each inner boundary is moved forward to the beginning of the next line. Therefore every line
+// belongs to exactly one chunk. Note that chunks may be empty.
+*/
+inline void TextParser::split( const char* begin, const char* end, size_t n,
+                               std::vector<const char*>& bounds )
+{
+   const size_t size( end - begin );
+
+   bounds.resize( n+1UL );
+   bounds[0UL] = begin;
+   bounds[n  ] = end;
+
+   for( size_t k=1UL; k<n; ++k ) {
+      const char* pos( std::max( begin + size/n*k, bounds[k-1UL] ) );
+      while( pos != end && pos != begin && pos[-1] != '\n' ) ++pos;
+      bounds[k] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all given tasks, either serially or on the given thread pool.
+//
+// \param pool Pointer to the thread pool (may be NULL).
+// \param tasks The tasks to be executed.
+// \return void
+//
+// This function calls the \a run() member function of all given tasks. In case a thread pool
+// is given, the tasks are executed as children of a TaskGroup and the function returns as soon
+// as all tasks have been completed. An exception thrown by any task is rethrown in the calling
+// thread.
+*/
+template< typename Task >  // Type of the tasks
+inline void TextParser::run( ThreadPool* pool, std::vector<Task>& tasks )
+{
+   if( pool == NULL || tasks.size() < 2UL ) {
+      for( size_t k=0UL; k<tasks.size(); ++k ) {
+         tasks[k].run();
+      }
+      return;
+   }
+
+   std::vector<boost::exception_ptr> errors( tasks.size() );
+
+   {
+      TaskGroup group( *pool );
+      for( size_t k=0UL; k<tasks.size(); ++k ) {
+         group.run( &TextParser::execute<Task>, &tasks[k], &errors[k] );
+      }
+      group.wait();
+   }
+
+   for( size_t k=0UL; k<errors.size(); ++k ) {
+      if( errors[k] ) boost::rethrow_exception( errors[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given task and captures any exception.
+//
+// \param task The task to be executed.
+// \param error The exception thrown by the task (if any).
+// \return void
+*/
+template< typename Task >  // Type of the task
+void TextParser::execute( Task* task, boost::exception_ptr* error )
+{
+   try {
+      task->run();
+   }
+   catch( ... ) {
+      *error = boost::current_exception();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LINECOUNTER MEMBER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Counts the lines of the chunk that contain at least one non-blank character.
+//
+// \return void
+*/
+inline void TextParser::LineCounter::run()
+{
+   const char* pos( begin_ );
+   lines_ = 0UL;
+
+   while( pos != end_ ) {
+      if( skipBlanks( pos, end_ ) ) ++lines_;
+      skipLine( pos, end_ );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Skips all blanks (spaces, tabs, and carriage returns) up to the end of the line.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \return \a true in case the current line contains further characters, \a false otherwise.
+*/
+inline bool TextParser::skipBlanks( const char*& pos, const char* end )
+{
+   while( pos != end && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) ) ++pos;
+   return ( pos != end && *pos != '\n' );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves the given position to the beginning of the next line.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \return void
+*/
+inline void TextParser::skipLine( const char*& pos, const char* end )
+{
+   const char* next( static_cast<const char*>( std::memchr( pos, '\n', end - pos ) ) );
+   pos = ( next != NULL )?( next+1 ):( end );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a non-negative integral index.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param index The parsed index.
+// \return \a true in case an index was parsed successfully, \a false otherwise.
+*/
+inline bool TextParser::parseIndex( const char*& pos, const char* end, size_t& index )
+{
+   if( !skipBlanks( pos, end ) || *pos < '0' || *pos > '9' )
+      return false;
+
+   index = 0UL;
+
+   do {
+      const size_t digit( *pos - '0' );
+      if( index > ( size_t(-1) - digit ) / 10UL )
+         return false;
+      index = index*10UL + digit;
+      ++pos;
+   } while( pos != end && *pos >= '0' && *pos <= '9' );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a single word and converts it to lower case.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param word The parsed word.
+// \return \a true in case a word was parsed successfully, \a false otherwise.
+*/
+inline bool TextParser::parseWord( const char*& pos, const char* end, std::string& word )
+{
+   word.clear();
+
+   if( !skipBlanks( pos, end ) )
+      return false;
+
+   while( pos != end && *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n' ) {
+      word += ( *pos >= 'A' && *pos <= 'Z' )?( char( *pos - 'A' + 'a' ) ):( *pos );
+      ++pos;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the delimiter between two values of the current line.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param delimiter The character separating two values.
+// \return \a true in case a delimiter was parsed successfully, \a false otherwise.
+//
+// In case the delimiter is a blank (space or tab), any non-empty sequence of blanks is accepted
+// as delimiter. Otherwise the delimiter may be surrounded by blanks.
+*/
+inline bool TextParser::parseDelimiter( const char*& pos, const char* end, char delimiter )
+{
+   if( delimiter == ' ' || delimiter == '\t' ) {
+      const char* const start( pos );
+      return skipBlanks( pos, end ) && pos != start;
+   }
+
+   if( !skipBlanks( pos, end ) || *pos != delimiter )
+      return false;
+
+   ++pos;
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a single value.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param value The parsed value.
+// \param delimiter The character separating two values (in addition to blanks).
+// \return \a true in case a value was parsed successfully, \a false otherwise.
+//
+// This function parses the next value of the current line. In case of a complex value type
+// only the real part is parsed. Note that the function never reads beyond the given end,
+// which is essential for memory-mapped files.
+*/
+template< typename Type >  // Type of the value
+inline bool TextParser::parseValue( const char*& pos, const char* end, Type& value, char delimiter )
+{
+   char token[maxTokenSize+1];
+   return readToken( pos, end, delimiter, token ) && convert( token, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copies the next token of the current line into the given buffer.
+//
+// \param pos The current position within the text.
+// \param end The end of the text.
+// \param delimiter The character separating two values (in addition to blanks).
+// \param token The buffer for the null-terminated token.
+// \return \a true in case a non-empty token was read, \a false otherwise.
+*/
+inline bool TextParser::readToken( const char*& pos, const char* end, char delimiter, char* token )
+{
+   if( !skipBlanks( pos, end ) )
+      return false;
+
+   size_t length( 0UL );
+
+   while( pos != end && *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n' &&
+          *pos != delimiter ) {
+      if( length == size_t( maxTokenSize ) ) return false;
+      token[length++] = *pos++;
+   }
+
+   token[length] = '\0';
+
+   return ( length != 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a token to an integral value.
+//
+// \param token The null-terminated token.
+// \param value The resulting value.
+// \return \a true in case the complete token was converted, \a false otherwise.
+*/
+template< typename Type >  // Type of the value
+inline typename EnableIf< IsIntegral<Type>, bool >::Type
+   TextParser::convert( const char* token, Type& value )
+{
+   char* last( NULL );
+
+   if( IsSigned<Type>::value ) {
+      value = static_cast<Type>( std::strtol( token, &last, 10 ) );
+   }
+   else {
+      value = static_cast<Type>( std::strtoul( token, &last, 10 ) );
+   }
+
+   return ( *last == '\0' );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a token to the real part of a complex value.
+//
+// \param token The null-terminated token.
+// \param value The resulting value.
+// \return \a true in case the complete token was converted, \a false otherwise.
+*/
+template< typename Type >  // Type of the value
+inline typename EnableIf< IsComplex<Type>, bool >::Type
+   TextParser::convert( const char* token, Type& value )
+{
+   typename Type::value_type re;
+   if( !convert( token, re ) ) return false;
+   value = Type( re );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a token to a floating point value.
+//
+// \param token The null-terminated token.
+// \param value The resulting value.
+// \return \a true in case the complete token was converted, \a false otherwise.
+*/
+template< typename Type >  // Type of the value
+inline typename DisableIf< Or< IsIntegral<Type>, IsComplex<Type> >, bool >::Type
+   TextParser::convert( const char* token, Type& value )
+{
+   char* last( NULL );
+   value = static_cast<Type>( std::strtod( token, &last ) );
+   return ( *last == '\0' );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FORMATTING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appends the given integral value to the given text.
+//
+// \param text The text to be extended.
+// \param value The value to be formatted.
+// \return void
+*/
+template< typename Type >  // Type of the value
+inline typename EnableIf< IsIntegral<Type> >::Type
+   TextParser::formatValue( std::string& text, const Type& value )
+{
+   char buffer[32];
+
+   if( IsSigned<Type>::value ) {
+      std::sprintf( buffer, "%ld", static_cast<long>( value ) );
+   }
+   else {
+      std::sprintf( buffer, "%lu", static_cast<unsigned long>( value ) );
+   }
+
+   text += buffer;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends the real and imaginary part of the given complex value to the given text.
+//
+// \param text The text to be extended.
+// \param value The value to be formatted.
+// \return void
+*/
+template< typename Type >  // Type of the value
+inline typename EnableIf< IsComplex<Type> >::Type
+   TextParser::formatValue( std::string& text, const Type& value )
+{
+   formatValue( text, value.real() );
+   text += ' ';
+   formatValue( text, value.imag() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends the given floating point value to the given text.
+//
+// \param text The text to be extended.
+// \param value The value to be formatted.
+// \return void
+//
+// The value is formatted with the number of significant digits required to reconstitute the
+// exact binary value (9 digits for single precision, 17 digits for double precision).
+*/
+template< typename Type >  // Type of the value
+inline typename DisableIf< Or< IsIntegral<Type>, IsComplex<Type> > >::Type
+   TextParser::formatValue( std::string& text, const Type& value )
+{
+   char buffer[64];
+
+   if( IsLongDouble<Type>::value ) {
+      std::sprintf( buffer, "%.21Lg", static_cast<long double>( value ) );
+   }
+   else if( sizeof( Type ) <= sizeof( float ) ) {
+      std::sprintf( buffer, "%.9g", static_cast<double>( value ) );
+   }
+   else {
+      std::sprintf( buffer, "%.17g", static_cast<double>( value ) );
+   }
+
+   text += buffer;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends the given index to the given text.
+//
+// \param text The text to be extended.
+// \param index The index to be formatted.
+// \return void
+*/
+inline void TextParser::formatIndex( std::string& text, size_t index )
+{
+   char buffer[32];
+   char* pos( buffer + sizeof( buffer ) );
+
+   do {
+      *--pos = char( '0' + index % 10UL );
+      index /= 10UL;
+   } while( index != 0UL );
+
+   text.append( pos, buffer + sizeof( buffer ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/typetraits/IsComplex.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsIntegral.h>
@@ -157,7 +159,8 @@ struct TypeValueMappingHelper<false,false,false,true>
 //
 // This class template converts the given data type into an integral representation suited for
 // serialization. Depending on the given data type, the \a value member enumeration is set to
-// the according serial representation.
+// the according serial representation. Since the float16 and the bfloat16 data types have the
+// same size but a different layout, both are mapped to separate serial representations.
 */
 template< typename T >
 struct TypeValueMapping
@@ -175,6 +178,40 @@ struct TypeValueMapping
 };
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TypeValueMapping class template for half precision values.
+// \ingroup math_serialization
+*/
+template<>
+struct TypeValueMapping<float16>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 5 };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the TypeValueMapping class template for bfloat16 values.
+// \ingroup math_serialization
+*/
+template<>
+struct TypeValueMapping<bfloat16>
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 6 };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
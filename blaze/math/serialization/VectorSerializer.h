@@ -45,9 +45,11 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
+#include <blaze/math/serialization/SparseBlock.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/Serialization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -193,7 +195,7 @@ class VectorSerializer
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline VectorSerializer();
+   explicit inline VectorSerializer( bool compress = compressSparseIndices );
    // No explicitly declared copy constructor.
    //@}
    //**********************************************************************************************
@@ -271,6 +273,12 @@ class VectorSerializer
 
    template< typename Archive, typename VT, bool TF >
    void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   void deserializeBlockedVector( Archive& archive, DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   void deserializeBlockedVector( Archive& archive, SparseVector<VT,TF>& vec );
    //@}
    //**********************************************************************************************
 
@@ -283,6 +291,7 @@ class VectorSerializer
    uint8_t  elementSize_;  //!< The size in bytes of a single element of the vector.
    uint64_t size_;         //!< The size of the vector.
    uint64_t number_;       //!< The total number of elements contained in the vector.
+   bool     compress_;     //!< Compression flag for the indices of sparse vectors.
    //@}
    //**********************************************************************************************
 };
@@ -298,15 +307,23 @@ class VectorSerializer
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief The default constructor of the VectorSerializer class.
+/*!\brief The constructor of the VectorSerializer class.
+//
+// \param compress \a true to delta-encode the indices of sparse vectors, \a false otherwise.
+//
+// Via the \a compress parameter the index compression of sparse vectors can be selected
+// (see the SparseBlockWriter class template). By default, the setting of the configuration
+// file <em>./blaze/config/Serialization.h</em> is used. The setting has no influence on the
+// deserialization, which automatically detects the format of the archive.
 */
-VectorSerializer::VectorSerializer()
+VectorSerializer::VectorSerializer( bool compress )
    : version_    ( 0U  )  // The version of the archive
    , type_       ( 0U  )  // The type of the vector
    , elementType_( 0U  )  // The type of an element
    , elementSize_( 0U  )  // The size in bytes of a single element of the vector
    , size_       ( 0UL )  // The size of the vector
    , number_     ( 0UL )  // The total number of elements contained in the vector
+   , compress_   ( compress )  // Compression flag for the indices of sparse vectors
 {}
 //*************************************************************************************************
 
@@ -359,7 +376,7 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 {
    typedef typename VT::ElementType  ET;
 
-   archive << uint8_t ( 1U );
+   archive << uint8_t ( IsDenseVector<VT>::value ? 1U : 2U );
    archive << uint8_t ( VectorValueMapping<VT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
@@ -405,20 +422,27 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 // \param vec The vector to be serialized.
 // \return void
 // \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function writes the indices and values of all non-zero elements of the given sparse
+// vector in blocks (see the SparseBlockWriter class template).
 */
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
 void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
 {
+   typedef typename VT::ElementType    ET;
    typedef typename VT::ConstIterator  ConstIterator;
 
-   ConstIterator element( (~vec).begin() );
-   while( ( element != (~vec).end() ) &&
-          ( archive << element->index() << element->value() ) ) {
-      ++element;
+   SparseBlockWriter<Archive,ET> writer( archive, compress_ );
+
+   writer.startSequence();
+   for( ConstIterator element=(~vec).begin(); element!=(~vec).end(); ++element ) {
+      writer.write( element->index(), element->value() );
    }
 
+   writer.flush();
+
    if( !archive ) {
       throw std::runtime_error( "Sparse vector could not be serialized" );
    }
@@ -480,7 +504,7 @@ void VectorSerializer::deserializeHeader( Archive& archive, const VT& vec )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> size_ >> number_ ) ) {
       throw std::runtime_error( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( ( version_ != 1U && version_ != 2U ) || ( version_ == 2U && type_ != 2U ) ) {
       throw std::runtime_error( "Invalid version detected" );
    }
    else if( ( type_ & 1U ) != 0U || ( type_ & (~3U) ) != 0U ) {
@@ -567,9 +591,12 @@ void VectorSerializer::deserializeVector( Archive& archive, VT& vec )
    if( type_ == 0U ) {
       deserializeDenseVector( archive, vec );
    }
-   else if( type_ == 2U ) {
+   else if( type_ == 2U && version_ == 1U ) {
       deserializeSparseVector( archive, vec );
    }
+   else if( type_ == 2U ) {
+      deserializeBlockedVector( archive, vec );
+   }
    else {
       BLAZE_INTERNAL_ASSERT( false, "Undefined type flag" );
    }
@@ -744,6 +771,79 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a blocked sparse vector from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The dense vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense vector could not be deserialized.
+//
+// This function deserializes a sparse vector that has been serialized in blocks from the
+// archive and reconstitutes the given dense vector. In case any error is detected during the
+// deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+void VectorSerializer::deserializeBlockedVector( Archive& archive, DenseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, size_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   reader.startSequence();
+   for( size_t i=0UL; i<number_; ++i ) {
+      reader.read( index, value );
+      (~vec)[index] = value;
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a blocked sparse vector from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The sparse vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse vector could not be deserialized.
+//
+// This function deserializes a sparse vector that has been serialized in blocks from the
+// archive and reconstitutes the given sparse vector. In case any error is detected during the
+// deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+void VectorSerializer::deserializeBlockedVector( Archive& archive, SparseVector<VT,TF>& vec )
+{
+   typedef typename VT::ElementType  ET;
+
+   SparseBlockReader<Archive,ET> reader( archive, number_, size_ );
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   reader.startSequence();
+   for( size_t i=0UL; i<number_; ++i ) {
+      reader.read( index, value );
+      (~vec).append( index, value, false );
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
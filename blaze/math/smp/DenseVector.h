@@ -40,12 +40,16 @@
 // Includes
 //*************************************************************************************************
 
-#include <blaze/system/OpenMP.h>
+#include <blaze/system/SMP.h>
 
 #if BLAZE_OPENMP_PARALLEL_MODE
 #include <blaze/math/smp/openmp/DenseVector.h>
+#elif BLAZE_THREAD_TEAM_PARALLEL_MODE
+#include <blaze/math/smp/threads/DenseVector.h>
 #else
 #include <blaze/math/smp/default/DenseVector.h>
 #endif
 
+#include <blaze/math/smp/TaskGraph.h>
+
 #endif
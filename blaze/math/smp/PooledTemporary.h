@@ -0,0 +1,237 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/PooledTemporary.h
+//  \brief Header file for the PooledTemporary class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_POOLEDTEMPORARY_H_
+#define _BLAZE_MATH_SMP_POOLEDTEMPORARY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/thread/mutex.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Temporary vector or matrix from a pool of reusable temporaries.
+// \ingroup smp
+//
+// The PooledTemporary class provides a temporary object of type \a T (typically the result type
+// of a vector or matrix expression) for the intermediate evaluation of subexpressions. Instead
+// of creating a new temporary for each evaluation, the temporaries are taken from a process-wide
+// pool of previously used temporaries and are returned to the pool on destruction. Since the
+// resize operations of the dynamic Blaze vectors and matrices preserve the allocated capacity,
+// repeated evaluations of equally sized subexpressions don't require any dynamic memory
+// allocation. Access to the pool is synchronized, i.e. the class can be used concurrently from
+// several threads.
+*/
+template< typename T >  // Type of the temporary
+class PooledTemporary : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef boost::mutex        Mutex;  //!< Type of the mutex.
+   typedef Mutex::scoped_lock  Lock;   //!< Type of a locking object.
+   typedef PtrVector<T>        Pool;   //!< Type of the pool of temporaries.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline PooledTemporary();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PooledTemporary();
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline T& operator*();
+   inline T* operator->();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   T* temporary_;  //!< The temporary taken from the pool.
+
+   static const size_t capacity = 16UL;  //!< Maximum number of temporaries kept in the pool.
+   static Pool pool_;                    //!< The pool of unused temporaries.
+   static Mutex mutex_;                  //!< Synchronization mutex for the pool.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+const size_t PooledTemporary<T>::capacity;
+
+template< typename T >
+typename PooledTemporary<T>::Pool PooledTemporary<T>::pool_;
+
+template< typename T >
+typename PooledTemporary<T>::Mutex PooledTemporary<T>::mutex_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PooledTemporary class.
+//
+// The constructor takes an unused temporary from the pool. In case the pool is empty, a new
+// temporary is created.
+*/
+template< typename T >  // Type of the temporary
+inline PooledTemporary<T>::PooledTemporary()
+   : temporary_( 0 )  // The temporary taken from the pool
+{
+   {
+      Lock lock( mutex_ );
+      if( !pool_.isEmpty() ) {
+         temporary_ = pool_.back();
+         pool_.releaseBack();
+      }
+   }
+
+   if( temporary_ == 0 )
+      temporary_ = new T();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the PooledTemporary class.
+//
+// The destructor returns the temporary to the pool. In case the pool is full, the temporary
+// is destroyed.
+*/
+template< typename T >  // Type of the temporary
+inline PooledTemporary<T>::~PooledTemporary()
+{
+   {
+      Lock lock( mutex_ );
+      if( pool_.size() < capacity ) {
+         pool_.pushBack( temporary_ );
+         return;
+      }
+   }
+
+   delete temporary_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the temporary.
+//
+// \return Reference to the temporary.
+*/
+template< typename T >  // Type of the temporary
+inline T& PooledTemporary<T>::operator*()
+{
+   return *temporary_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the members of the temporary.
+//
+// \return Pointer to the temporary.
+*/
+template< typename T >  // Type of the temporary
+inline T* PooledTemporary<T>::operator->()
+{
+   return temporary_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TaskGraph.h
+//  \brief Header file for the concurrent evaluation of independent subexpressions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/PooledTemporary.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/TaskGraphSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/TaskGroup.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the evaluation of a subexpression into a temporary.
+// \ingroup smp
+//
+// The TaskGraphEvaluation functor evaluates a subexpression into the given temporary. The task
+// graph section of the scheduling thread is propagated to the executing thread, i.e. nested
+// independent subexpressions are evaluated concurrently as well.
+*/
+template< typename T1    // Type of the temporary
+        , typename T2 >  // Type of the subexpression
+struct TaskGraphEvaluation
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the TaskGraphEvaluation functor.
+   //
+   // \param pool The thread pool of the task graph section.
+   // \param tmp The target temporary.
+   // \param expr The subexpression to be evaluated.
+   */
+   inline TaskGraphEvaluation( ThreadPool& pool, T1& tmp, const T2& expr )
+      : pool_( &pool )  // The thread pool of the task graph section
+      , tmp_ ( &tmp  )  // The target temporary
+      , expr_( &expr )  // The subexpression to be evaluated
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluation of the subexpression.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      TaskGraphSection<int> section( *pool_ );
+      *tmp_ = *expr_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   ThreadPool* pool_;  //!< The thread pool of the task graph section.
+   T1*         tmp_;   //!< The target temporary.
+   const T2*   expr_;  //!< The subexpression to be evaluated.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the two given subexpressions can be evaluated concurrently.
+// \ingroup smp
+//
+// \param lhs The left-hand side subexpression.
+// \param rhs The right-hand side subexpression.
+// \return \a true in case the subexpressions can be evaluated concurrently, \a false if not.
+//
+// This function returns whether a task graph section is active for the calling thread and
+// whether the two subexpressions are executed serially. In this case the assignment of the sum
+// or difference of the subexpressions can be performed via the smpAssignSum() and
+// smpAssignDifference() functions. Subexpressions that are executed in
+// parallel via OpenMP or the SMP thread team are not evaluated concurrently in order to avoid
+// an oversubscription of the available cores.
+*/
+template< typename T1    // Type of the left-hand side subexpression
+        , typename T2 >  // Type of the right-hand side subexpression
+inline bool canSMPAssignConcurrently( const T1& lhs, const T2& rhs )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_THREAD_TEAM_PARALLEL_MODE
+   if( lhs.canSMPAssign() || rhs.canSMPAssign() )
+      return false;
+#else
+   UNUSED_PARAMETER( lhs, rhs );
+#endif
+
+   return isTaskGraphSectionActive() && !isSerialSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Concurrent evaluation of the sum of two independent subexpressions (\f$ A=B+C \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector or matrix.
+// \param op1 The left-hand side subexpression of the addition.
+// \param op2 The right-hand side subexpression of the addition.
+// \return void
+//
+// This function evaluates the right-hand side subexpression into a pooled temporary by means
+// of the thread pool of the active task graph section while the calling thread concurrently
+// assigns the left-hand side subexpression to the target. Afterwards the temporary is added
+// to the target. In case the left-hand side subexpression itself contains independent
+// subexpressions, these are evaluated concurrently as well, which results in a concurrent
+// evaluation of all independent computations of the expression tree.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename T1    // Type of the target vector or matrix
+        , typename T2    // Type of the left-hand side subexpression
+        , typename T3 >  // Type of the right-hand side subexpression
+inline void smpAssignSum( T1& lhs, const T2& op1, const T3& op2 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename T3::ResultType  TmpType;
+
+   ThreadPool* pool( TaskGraphSection<int>::pool() );
+
+   BLAZE_INTERNAL_ASSERT( pool != NULL, "No active task graph section detected" );
+
+   PooledTemporary<TmpType> tmp;
+
+   {
+      TaskGroup group( *pool );
+      group.run( TaskGraphEvaluation<TmpType,T3>( *pool, *tmp, op2 ) );
+      smpAssign( lhs, op1 );
+      group.wait();
+   }
+
+   smpAddAssign( lhs, *tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Concurrent evaluation of the difference of two independent subexpressions (\f$ A=B-C \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector or matrix.
+// \param op1 The left-hand side subexpression of the subtraction.
+// \param op2 The right-hand side subexpression of the subtraction.
+// \return void
+//
+// This function evaluates the right-hand side subexpression into a pooled temporary by means
+// of the thread pool of the active task graph section while the calling thread concurrently
+// assigns the left-hand side subexpression to the target. Afterwards the temporary is
+// subtracted from the target.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename T1    // Type of the target vector or matrix
+        , typename T2    // Type of the left-hand side subexpression
+        , typename T3 >  // Type of the right-hand side subexpression
+inline void smpAssignDifference( T1& lhs, const T2& op1, const T3& op2 )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename T3::ResultType  TmpType;
+
+   ThreadPool* pool( TaskGraphSection<int>::pool() );
+
+   BLAZE_INTERNAL_ASSERT( pool != NULL, "No active task graph section detected" );
+
+   PooledTemporary<TmpType> tmp;
+
+   {
+      TaskGroup group( *pool );
+      group.run( TaskGraphEvaluation<TmpType,T3>( *pool, *tmp, op2 ) );
+      smpAssign( lhs, op1 );
+      group.wait();
+   }
+
+   smpSubAssign( lhs, *tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
-//  \file blaze/util/threadpool/TaskQueue.h
-//  \brief Task queue for the thread pool
+//  \file blaze/math/smp/TaskGraphSection.h
+//  \brief Header file for the TaskGraphSection class
 //
 //  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
 //
@@ -32,22 +32,21 @@
 */
 //=================================================================================================
 
-#ifndef _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
-#define _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
+#ifndef _BLAZE_MATH_SMP_TASKGRAPHSECTION_H_
+#define _BLAZE_MATH_SMP_TASKGRAPHSECTION_H_
 
 
 //*************************************************************************************************
 // Includes
 //*************************************************************************************************
 
-#include <deque>
-#include <blaze/util/threadpool/Task.h>
+#include <boost/thread/tss.hpp>
+#include <blaze/util/Null.h>
+#include <blaze/util/ThreadPool.h>
 
 
 namespace blaze {
 
-namespace threadpool {
-
 //=================================================================================================
 //
 //  CLASS DEFINITION
@@ -55,68 +54,62 @@ namespace threadpool {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Task queue for the thread pool.
-// \ingroup threads
+/*!\brief Section for the concurrent evaluation of independent subexpressions.
+// \ingroup smp
 //
-// The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// The TaskGraphSection class is an auxiliary helper class for the \a BLAZE_TASK_GRAPH_SECTION
+// macro. It provides the functionality to detect whether a task graph section is active for the
+// calling thread and which thread pool is used for the concurrent evaluation of independent
+// subexpressions. In contrast to serial sections, task graph sections are local to a thread
+// and can be nested.
 */
-class TaskQueue
+template< typename T >
+class TaskGraphSection
 {
- private:
-   //**Type definitions****************************************************************************
-   typedef std::deque<Task>  Tasks;  //!< FIFO container for tasks.
-   //**********************************************************************************************
-
  public:
-   //**Type definitions****************************************************************************
-   typedef Tasks::size_type  SizeType;  //!< Size type of the task queue.
-   //**********************************************************************************************
-
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline TaskQueue();
+   inline TaskGraphSection( ThreadPool& pool );
    //@}
    //**********************************************************************************************
 
    //**Destructor**********************************************************************************
    /*!\name Destructor */
    //@{
-   inline ~TaskQueue();
+   inline ~TaskGraphSection();
    //@}
    //**********************************************************************************************
 
-   //**Get functions*******************************************************************************
-   /*!\name Get functions */
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
    //@{
-   inline SizeType maxSize()  const;
-   inline SizeType size()     const;
-   inline bool     isEmpty()  const;
+   inline operator bool() const;
    //@}
    //**********************************************************************************************
 
-   //**Element functions***************************************************************************
-   /*!\name Element functions */
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
-   inline void clear();
+   static inline ThreadPool* pool();
    //@}
    //**********************************************************************************************
 
+ private:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   inline void swap( TaskQueue& tq ) /* throw() */;
+   static inline void cleanup( ThreadPool* pool );
    //@}
    //**********************************************************************************************
 
- private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Tasks tasks_;  //!< FIFO container for the contained tasks.
+   ThreadPool* previous_;  //!< The thread pool of the enclosing task graph section.
+
+   static boost::thread_specific_ptr<ThreadPool> pool_;
+   //!< The thread pool of the active task graph section of the calling thread.
    //@}
    //**********************************************************************************************
 };
@@ -127,16 +120,15 @@ class TaskQueue
 
 //=================================================================================================
 //
-//  CONSTRUCTOR
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Default constructor for TaskQueue.
-*/
-inline TaskQueue::TaskQueue()
-   : tasks_()  // FIFO container for the contained tasks
-{}
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+boost::thread_specific_ptr<ThreadPool> TaskGraphSection<T>::pool_( &TaskGraphSection<T>::cleanup );
+/*! \endcond */
 //*************************************************************************************************
 
 
@@ -144,18 +136,20 @@ inline TaskQueue::TaskQueue()
 
 //=================================================================================================
 //
-//  DESTRUCTOR
+//  CONSTRUCTOR
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Destructor for the TaskQueue class.
+/*!\brief Constructor for the TaskGraphSection class.
 //
-// The destructor destroys any remaining task in the task queue.
+// \param pool The thread pool for the concurrent evaluation of independent subexpressions.
 */
-TaskQueue::~TaskQueue()
+template< typename T >
+inline TaskGraphSection<T>::TaskGraphSection( ThreadPool& pool )
+   : previous_( pool_.get() )  // The thread pool of the enclosing task graph section
 {
-   clear();
+   pool_.reset( &pool );
 }
 //*************************************************************************************************
 
@@ -164,44 +158,40 @@ TaskQueue::~TaskQueue()
 
 //=================================================================================================
 //
-//  GET FUNCTIONS
+//  DESTRUCTOR
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Returns the maximum possible size of a task queue.
+/*!\brief Destructor of the TaskGraphSection class.
 //
-// \return The maximum possible size.
+// The destructor reactivates the enclosing task graph section (if any).
 */
-inline TaskQueue::SizeType TaskQueue::maxSize() const
+template< typename T >
+inline TaskGraphSection<T>::~TaskGraphSection()
 {
-   return tasks_.max_size();
+   pool_.reset( previous_ );
 }
 //*************************************************************************************************
 
 
-//*************************************************************************************************
-/*!\brief Returns the current size of the task queue.
+
+
+//=================================================================================================
 //
-// \return The current size.
+//  CONVERSION OPERATOR
 //
-// This function returns the number of the currently contained tasks.
-*/
-inline TaskQueue::SizeType TaskQueue::size() const
-{
-   return tasks_.size();
-}
-//*************************************************************************************************
-
+//=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Returns \a true if the task queue has no elements.
+/*!\brief Conversion to a boolean value.
 //
-// \return \a true if the task queue is empty, \a false if it is not.
+// \return \a true in case the task graph section is active, \a false if not.
 */
-inline bool TaskQueue::isEmpty() const
+template< typename T >
+inline TaskGraphSection<T>::operator bool() const
 {
-   return tasks_.empty();
+   return pool_.get() != NULL;
 }
 //*************************************************************************************************
 
@@ -210,47 +200,19 @@ inline bool TaskQueue::isEmpty() const
 
 //=================================================================================================
 //
-//  ELEMENT FUNCTIONS
+//  GET FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Adding a task to the end of the task queue.
-//
-// \param task The task to be added to the end of the task queue.
-// \return void
-//
-// This function adds the given task to the end of the task queue. It runs in constant time.
-*/
-inline void TaskQueue::push( Task task )
-{
-   tasks_.push_back( task );
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the task from the front of the task queue.
-//
-// \return The first task in the task queue.
-*/
-inline Task TaskQueue::pop()
-{
-   const Task task( tasks_.front() );
-   tasks_.pop_front();
-   return task;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Removing all tasks from the task queue.
+/*!\brief Returns the thread pool of the active task graph section of the calling thread.
 //
-// \return void
+// \return The thread pool of the active task graph section, \a NULL if no section is active.
 */
-inline void TaskQueue::clear()
+template< typename T >
+inline ThreadPool* TaskGraphSection<T>::pool()
 {
-   tasks_.clear();
+   return pool_.get();
 }
 //*************************************************************************************************
 
@@ -264,16 +226,17 @@ inline void TaskQueue::clear()
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Cleanup function for the thread specific pointer to the active thread pool.
 //
-// \param tq The task queue to be swapped.
+// \param pool The thread pool of the active task graph section (not used).
 // \return void
-// \exception no-throw guarantee.
+//
+// The thread pools of task graph sections are not owned by the sections. Therefore no cleanup
+// is necessary on exit of a thread.
 */
-inline void TaskQueue::swap( TaskQueue& tq ) /* throw() */
-{
-   tasks_.swap( tq.tasks_ );
-}
+template< typename T >
+inline void TaskGraphSection<T>::cleanup( ThreadPool* /*pool*/ )
+{}
 //*************************************************************************************************
 
 
@@ -281,35 +244,73 @@ inline void TaskQueue::swap( TaskQueue& tq ) /* throw() */
 
 //=================================================================================================
 //
-//  GLOBAL OPERATORS
+//  GLOBAL FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\name TaskQueue operators */
+/*!\name TaskGraphSection functions */
 //@{
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */;
+inline bool isTaskGraphSectionActive();
 //@}
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
+/*!\brief Returns whether a task graph section is active for the calling thread.
+// \ingroup smp
 //
-// \param a The first task queue to be swapped.
-// \param b The second task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
+// \return \a true if a task graph section is active, \a false if not.
 */
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */
+inline bool isTaskGraphSectionActive()
 {
-   a.swap( b );
+   return TaskGraphSection<int>::pool() != NULL;
 }
 //*************************************************************************************************
 
-} // namespace threadpool
 
-} // namespace blaze
 
 
+
+
+
+
+//=================================================================================================
+//
+//  TASK GRAPH SECTION MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section for the concurrent evaluation of independent subexpressions.
+// \ingroup smp
+//
+// This macro starts a task graph section for the given thread pool. Within a task graph section,
+// the independent subexpressions of additions and subtractions of dense vectors and matrices
+// (as for instance the two matrix multiplications in \f$ D = A \cdot B + C \cdot E \f$) are
+// evaluated concurrently by the threads of the given thread pool:
+
+   \code
+   blaze::ThreadPool pool( 4 );
+
+   blaze::DynamicMatrix<double> A, B, C, D, E, F, G;
+   // ... Resizing and initialization
+
+   BLAZE_TASK_GRAPH_SECTION( pool ) {
+      D = A * B + C * E;          // Concurrent evaluation of A*B and C*E
+      G = A * B + C * E - F * A;  // Concurrent evaluation of all three multiplications
+   }
+   \endcode
+
+// Note that task graph sections are local to the calling thread, i.e. they don't affect the
+// operations executed by other threads. In case the OpenMP parallelization is active, only
+// subexpressions that are too small for an OpenMP parallel execution are evaluated concurrently.
+// Within a serial section (see \a BLAZE_SERIAL_SECTION) all operations are executed serially.
+*/
+#define BLAZE_TASK_GRAPH_SECTION( POOL ) \
+   if( blaze::TaskGraphSection<int> taskGraphSection = POOL )
+//*************************************************************************************************
+
+} // namespace blaze
+
 #endif
@@ -66,6 +66,9 @@ inline void smpAddAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs
 
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline void smpSubAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename OP >
+inline typename MT::ElementType smpReduce( const Matrix<MT,SO>& dm, OP op );
 //@}
 //*************************************************************************************************
 
@@ -160,6 +163,31 @@ inline void smpSubAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename MT::ElementType smpReduce( const Matrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
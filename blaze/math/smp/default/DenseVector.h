@@ -69,6 +69,9 @@ inline void smpSubAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rh
 
 template< typename VT1_, bool TF1, typename VT2_, bool TF2 >
 inline void smpMultAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rhs );
+
+template< typename VT, bool TF, typename OP >
+inline typename VT::ElementType smpReduce( const Vector<VT,TF>& dv, OP op );
 //@}
 //*************************************************************************************************
 
@@ -185,6 +188,31 @@ inline void smpMultAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& r
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline typename VT::ElementType smpReduce( const Vector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+//*************************************************************************************************
+
 
 
 //=================================================================================================
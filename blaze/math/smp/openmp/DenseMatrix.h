@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <vector>
 #include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -1067,6 +1068,109 @@ inline void smpMultAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename MT::ElementType smpReduce( const Matrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the OpenMP-based SMP reduction of a dense matrix. Each thread reduces
+// a block of contiguous rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix), the partial results are combined afterwards by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+typename EnableIfTrue< MT::smpAssignable, typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || omp_get_num_threads() != 1 || !(~dm).canSMPAssign() ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   typedef typename MT::ElementType  ET;
+
+   const bool dmAligned( MT::vectorizable && (~dm).isAligned() );
+
+   std::vector<ET>   results( omp_get_max_threads() );
+   std::vector<char> valid  ( omp_get_max_threads(), 0 );
+
+#pragma omp parallel shared( dm, op, results, valid )
+   {
+      const int    threads      ( omp_get_num_threads() );
+      const size_t extent       ( ( SO == rowMajor )?( (~dm).rows() ):( (~dm).columns() ) );
+      const size_t addon        ( ( ( extent % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerThread( extent / threads + addon );
+
+#pragma omp for schedule(dynamic,1) nowait
+      for( int i=0UL; i<threads; ++i )
+      {
+         const size_t index( i*sizePerThread );
+
+         if( index >= extent )
+            continue;
+
+         const size_t size  ( min( sizePerThread, extent - index ) );
+         const size_t row   ( ( SO == rowMajor )?( index ):( 0UL ) );
+         const size_t column( ( SO == rowMajor )?( 0UL ):( index ) );
+         const size_t m     ( ( SO == rowMajor )?( size ):( (~dm).rows() ) );
+         const size_t n     ( ( SO == rowMajor )?( (~dm).columns() ):( size ) );
+
+         if( dmAligned )
+            results[i] = dmatreduce( submatrix<aligned>( ~dm, row, column, m, n ), op );
+         else
+            results[i] = dmatreduce( submatrix<unaligned>( ~dm, row, column, m, n ), op );
+
+         valid[i] = 1;
+      }
+   }
+
+   ET redux( results[0] );
+   for( size_t i=1UL; i<results.size(); ++i ) {
+      if( valid[i] ) redux = op( redux, results[i] );
+   }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 
 //=================================================================================================
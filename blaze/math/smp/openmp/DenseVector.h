@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <omp.h>
+#include <vector>
 #include <blaze/math/DenseSubvector.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -768,6 +769,108 @@ typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline typename VT::ElementType smpReduce( const Vector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the OpenMP-based SMP reduction of a dense vector. Each thread
+// reduces a contiguous block of the vector, the partial results are combined afterwards by
+// the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+typename EnableIfTrue< VT::smpAssignable, typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || omp_get_num_threads() != 1 || !(~dv).canSMPAssign() ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   typedef typename VT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   const bool vectorizable( VT::vectorizable );
+   const bool dvAligned   ( (~dv).isAligned() );
+
+   std::vector<ET>   results( omp_get_max_threads() );
+   std::vector<char> valid  ( omp_get_max_threads(), 0 );
+
+#pragma omp parallel shared( dv, op, results, valid )
+   {
+      const int    threads      ( omp_get_num_threads() );
+      const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( (~dv).size() / threads + addon );
+      const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+      const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+#pragma omp for schedule(dynamic,1) nowait
+      for( int i=0UL; i<threads; ++i )
+      {
+         const size_t index( i*sizePerThread );
+
+         if( index >= (~dv).size() )
+            continue;
+
+         const size_t size( min( sizePerThread, (~dv).size() - index ) );
+
+         if( vectorizable && dvAligned )
+            results[i] = dvecreduce( subvector<aligned>( ~dv, index, size ), op );
+         else
+            results[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+
+         valid[i] = 1;
+      }
+   }
+
+   ET redux( results[0] );
+   for( size_t i=1UL; i<results.size(); ++i ) {
+      if( valid[i] ) redux = op( redux, results[i] );
+   }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 
 
 //=================================================================================================
@@ -0,0 +1,841 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/DenseMatrix.h
+//  \brief Header file for the thread team based dense matrix SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_DENSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_DENSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/SubmatrixExprTrait.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadTeam.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP assignment of a dense matrix to a dense matrix.
+// \ingroup smp
+//
+// The DenseMatrixJob class splits the target dense matrix into one block of contiguous rows (in
+// case of a row-major right-hand side matrix) or columns (in case of a column-major right-hand
+// side matrix) per member of the executing thread team. Each member assigns its block by means
+// of the given assignment functor. The number of rows/columns per block is rounded up to a
+// multiple of the intrinsic vector size in order to preserve the alignment of all blocks.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO       // Storage order of the right-hand side dense matrix
+        , typename OP > // Type of the assignment functor
+class DenseMatrixJob : public ThreadTeam::Job
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseMatrixJob class.
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side dense matrix to be assigned.
+   // \param op The assignment functor.
+   */
+   explicit inline DenseMatrixJob( MT1& lhs, const MT2& rhs, OP op )
+      : lhs_( lhs )  // The target left-hand side dense matrix
+      , rhs_( rhs )  // The right-hand side dense matrix
+      , op_ ( op  )  // The assignment functor
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Assignment of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      typedef typename MT1::ElementType                         ET1;
+      typedef typename MT2::ElementType                         ET2;
+      typedef IntrinsicTrait<typename MT1::ElementType>         IT;
+      typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
+      typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
+
+      const bool vectorizable( MT1::vectorizable && MT2::vectorizable && IsSame<ET1,ET2>::value );
+      const bool lhsAligned  ( lhs_.isAligned() );
+      const bool rhsAligned  ( rhs_.isAligned() );
+
+      const size_t extent       ( ( SO == rowMajor )?( lhs_.rows() ):( lhs_.columns() ) );
+      const size_t addon        ( ( ( extent % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( extent / threads + addon );
+      const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+      const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= extent )
+         return;
+
+      const size_t size  ( min( sizePerThread, extent - index ) );
+      const size_t row   ( ( SO == rowMajor )?( index ):( 0UL ) );
+      const size_t column( ( SO == rowMajor )?( 0UL ):( index ) );
+      const size_t m     ( ( SO == rowMajor )?( size ):( lhs_.rows() ) );
+      const size_t n     ( ( SO == rowMajor )?( lhs_.columns() ):( size ) );
+
+      if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( lhs_, row, column, m, n ) );
+         op_( target, submatrix<aligned>( rhs_, row, column, m, n ) );
+      }
+      else if( vectorizable && lhsAligned ) {
+         AlignedTarget target( submatrix<aligned>( lhs_, row, column, m, n ) );
+         op_( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+      }
+      else if( vectorizable && rhsAligned ) {
+         UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+         op_( target, submatrix<aligned>( rhs_, row, column, m, n ) );
+      }
+      else {
+         UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+         op_( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT1&       lhs_;  //!< The target left-hand side dense matrix.
+   const MT2& rhs_;  //!< The right-hand side dense matrix.
+   OP         op_;   //!< The assignment functor.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP assignment of a sparse matrix to a dense matrix.
+// \ingroup smp
+//
+// The SparseMatrixJob class splits the target dense matrix into one block of contiguous rows (in
+// case of a row-major right-hand side matrix) or columns (in case of a column-major right-hand
+// side matrix) per member of the executing thread team. Each member assigns its block by means
+// of the given assignment functor.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO       // Storage order of the right-hand side sparse matrix
+        , typename OP > // Type of the assignment functor
+class SparseMatrixJob : public ThreadTeam::Job
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseMatrixJob class.
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side sparse matrix to be assigned.
+   // \param op The assignment functor.
+   */
+   explicit inline SparseMatrixJob( MT1& lhs, const MT2& rhs, OP op )
+      : lhs_( lhs )  // The target left-hand side dense matrix
+      , rhs_( rhs )  // The right-hand side sparse matrix
+      , op_ ( op  )  // The assignment functor
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Assignment of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
+
+      const size_t extent       ( ( SO == rowMajor )?( lhs_.rows() ):( lhs_.columns() ) );
+      const size_t addon        ( ( ( extent % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerThread( extent / threads + addon );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= extent )
+         return;
+
+      const size_t size  ( min( sizePerThread, extent - index ) );
+      const size_t row   ( ( SO == rowMajor )?( index ):( 0UL ) );
+      const size_t column( ( SO == rowMajor )?( 0UL ):( index ) );
+      const size_t m     ( ( SO == rowMajor )?( size ):( lhs_.rows() ) );
+      const size_t n     ( ( SO == rowMajor )?( lhs_.columns() ):( size ) );
+
+      UnalignedTarget target( submatrix<unaligned>( lhs_, row, column, m, n ) );
+      op_( target, submatrix<unaligned>( rhs_, row, column, m, n ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   MT1&       lhs_;  //!< The target left-hand side dense matrix.
+   const MT2& rhs_;  //!< The right-hand side sparse matrix.
+   OP         op_;   //!< The assignment functor.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// The DenseMatrixReduceJob class splits the given dense matrix into one block of contiguous rows
+// (in case of a row-major matrix) or columns (in case of a column-major matrix) per member of
+// the executing thread team. Each member reduces its block and stores the partial result in the
+// slot given by its rank.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+class DenseMatrixReduceJob : public ThreadTeam::Job
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType  ElementType;  //!< Element type of the dense matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseMatrixReduceJob class.
+   //
+   // \param dm The dense matrix to be reduced.
+   // \param op The reduction operation.
+   // \param results The partial results (one slot per team member).
+   // \param valid The flags for the valid partial results (one slot per team member).
+   */
+   explicit inline DenseMatrixReduceJob( const MT& dm, OP op, ElementType* results, char* valid )
+      : dm_     ( dm      )  // The dense matrix to be reduced
+      , op_     ( op      )  // The reduction operation
+      , results_( results )  // The partial results
+      , valid_  ( valid   )  // The flags for the valid partial results
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduction of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      const size_t extent       ( ( SO == rowMajor )?( dm_.rows() ):( dm_.columns() ) );
+      const size_t addon        ( ( ( extent % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerThread( extent / threads + addon );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= extent )
+         return;
+
+      const size_t size  ( min( sizePerThread, extent - index ) );
+      const size_t row   ( ( SO == rowMajor )?( index ):( 0UL ) );
+      const size_t column( ( SO == rowMajor )?( 0UL ):( index ) );
+      const size_t m     ( ( SO == rowMajor )?( size ):( dm_.rows() ) );
+      const size_t n     ( ( SO == rowMajor )?( dm_.columns() ):( size ) );
+
+      if( MT::vectorizable && dm_.isAligned() )
+         results_[rank] = dmatreduce( submatrix<aligned>( dm_, row, column, m, n ), op_ );
+      else
+         results_[rank] = dmatreduce( submatrix<unaligned>( dm_, row, column, m, n ), op_ );
+
+      valid_[rank] = 1;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT&    dm_;       //!< The dense matrix to be reduced.
+   OP           op_;       //!< The reduction operation.
+   ElementType* results_;  //!< The partial results.
+   char*        valid_;    //!< The flags for the valid partial results.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread team based SMP assignment of a dense matrix to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \param op The assignment functor.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2      // Storage order of the right-hand side dense matrix
+        , typename OP > // Type of the assignment functor
+inline void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
+{
+   ThreadBackend<int>::team().run( DenseMatrixJob<MT1,MT2,SO2,OP>( ~lhs, ~rhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread team based SMP assignment of a sparse matrix to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \param op The assignment functor.
+// \return void
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2      // Storage order of the right-hand side sparse matrix
+        , typename OP > // Type of the assignment functor
+inline void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP op )
+{
+   ThreadBackend<int>::team().run( SparseMatrixJob<MT1,MT2,SO2,OP>( ~lhs, ~rhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP assignment of a matrix to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default thread team based SMP assignment of a matrix to a dense
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void smpAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP assignment of a dense matrix to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function implements the thread team based SMP assignment of a dense matrix to a dense
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP assignment of a sparse matrix to a dense
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function implements the thread team based SMP assignment of a sparse matrix to a dense
+// matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP addition assignment of a matrix to a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default thread team based SMP addition assignment of a matrix to a
+// dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void smpAddAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP addition assignment of a dense matrix to a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function implements the thread team based SMP addition assignment of a dense matrix to a
+// dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      addAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP addition assignment of a sparse matrix to a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function implements the thread team based SMP addition assignment of a sparse matrix to a
+// dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpAddAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      addAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP subtraction assignment of a matrix to
+//        a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default thread team based SMP subtraction assignment of a matrix to
+// a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void smpSubAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP subtraction assignment of a dense matrix to a
+//        dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function implements the thread team based SMP subtraction assignment of a dense matrix to a
+// dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpSubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      subAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadSubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP subtraction assignment of a sparse matrix to
+//        a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function implements the thread team based SMP subtraction assignment of a sparse matrix to
+// a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO2 >    // Storage order of the right-hand side sparse matrix
+inline typename EnableIfTrue< MT1::smpAssignable && MT2::smpAssignable >::Type
+   smpSubAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      subAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadSubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP multiplication assignment of a matrix
+//        to a dense matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be multiplied.
+// \return void
+//
+// This function implements the default thread team based SMP multiplication assignment of a matrix
+// to a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void smpMultAssign( DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default thread team based SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename MT::ElementType smpReduce( const Matrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the thread team based SMP reduction of a dense matrix. Each member
+// of the thread team reduces a block of contiguous rows (in case of a row-major matrix) or
+// columns (in case of a column-major matrix), the partial results are combined afterwards by
+// the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIfTrue< MT::smpAssignable, typename MT::ElementType >::Type
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename MT::ElementType  ET;
+
+   if( isSerialSectionActive() || !(~dm).canSMPAssign() ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   const size_t threads( ThreadBackend<int>::team().size() );
+
+   std::vector<ET>   results( threads );
+   std::vector<char> valid  ( threads, 0 );
+
+   ThreadBackend<int>::team().run( DenseMatrixReduceJob<MT,SO,OP>( ~dm, op, &results[0], &valid[0] ) );
+
+   ET redux( results[0] );
+   for( size_t i=1UL; i<threads; ++i ) {
+      if( valid[i] ) redux = op( redux, results[i] );
+   }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_THREAD_TEAM_PARALLEL_MODE > 0 );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
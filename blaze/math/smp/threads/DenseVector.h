@@ -0,0 +1,892 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/DenseVector.h
+//  \brief Header file for the thread team based dense vector SMP implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_DENSEVECTOR_H_
+#define _BLAZE_MATH_SMP_THREADS_DENSEVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/SparseSubvector.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/ThreadTeam.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP assignment of a dense vector to a dense vector.
+// \ingroup smp
+//
+// The DenseVectorJob class splits the target dense vector into one contiguous block per member
+// of the executing thread team. Each member assigns its block by means of the given assignment
+// functor. The block size is rounded up to a multiple of the intrinsic vector size in order to
+// preserve the alignment of all blocks.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename OP >   // Type of the assignment functor
+class DenseVectorJob : public ThreadTeam::Job
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseVectorJob class.
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side dense vector to be assigned.
+   // \param op The assignment functor.
+   */
+   explicit inline DenseVectorJob( VT1& lhs, const VT2& rhs, OP op )
+      : lhs_( lhs )  // The target left-hand side dense vector
+      , rhs_( rhs )  // The right-hand side dense vector
+      , op_ ( op  )  // The assignment functor
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Assignment of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      typedef typename VT1::ElementType                         ET1;
+      typedef typename VT2::ElementType                         ET2;
+      typedef IntrinsicTrait<typename VT1::ElementType>         IT;
+      typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
+      typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+      const bool vectorizable( VT1::vectorizable && VT2::vectorizable && IsSame<ET1,ET2>::value );
+      const bool lhsAligned  ( lhs_.isAligned() );
+      const bool rhsAligned  ( rhs_.isAligned() );
+
+      const size_t addon        ( ( ( lhs_.size() % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( lhs_.size() / threads + addon );
+      const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+      const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= lhs_.size() )
+         return;
+
+      const size_t size( min( sizePerThread, lhs_.size() - index ) );
+
+      if( vectorizable && lhsAligned && rhsAligned ) {
+         AlignedTarget target( subvector<aligned>( lhs_, index, size ) );
+         op_( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else if( vectorizable && lhsAligned ) {
+         AlignedTarget target( subvector<aligned>( lhs_, index, size ) );
+         op_( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+      else if( vectorizable && rhsAligned ) {
+         UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+         op_( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else {
+         UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+         op_( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&       lhs_;  //!< The target left-hand side dense vector.
+   const VT2& rhs_;  //!< The right-hand side dense vector.
+   OP         op_;   //!< The assignment functor.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP assignment of a sparse vector to a dense vector.
+// \ingroup smp
+//
+// The SparseVectorJob class splits the target dense vector into one contiguous block per member
+// of the executing thread team. Each member assigns its block by means of the given assignment
+// functor.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side sparse vector
+        , typename OP >   // Type of the assignment functor
+class SparseVectorJob : public ThreadTeam::Job
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SparseVectorJob class.
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side sparse vector to be assigned.
+   // \param op The assignment functor.
+   */
+   explicit inline SparseVectorJob( VT1& lhs, const VT2& rhs, OP op )
+      : lhs_( lhs )  // The target left-hand side dense vector
+      , rhs_( rhs )  // The right-hand side sparse vector
+      , op_ ( op  )  // The assignment functor
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Assignment of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
+
+      const size_t addon        ( ( ( lhs_.size() % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerThread( lhs_.size() / threads + addon );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= lhs_.size() )
+         return;
+
+      const size_t size( min( sizePerThread, lhs_.size() - index ) );
+      UnalignedTarget target( subvector<unaligned>( lhs_, index, size ) );
+      op_( target, subvector<unaligned>( rhs_, index, size ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&       lhs_;  //!< The target left-hand side dense vector.
+   const VT2& rhs_;  //!< The right-hand side sparse vector.
+   OP         op_;   //!< The assignment functor.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Job for the thread team based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// The DenseVectorReduceJob class splits the given dense vector into one contiguous block per
+// member of the executing thread team. Each member reduces its block and stores the partial
+// result in the slot given by its rank. The block size is rounded up to a multiple of the
+// intrinsic vector size in order to preserve the alignment of all blocks.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+class DenseVectorReduceJob : public ThreadTeam::Job
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename VT::ElementType  ElementType;  //!< Element type of the dense vector.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DenseVectorReduceJob class.
+   //
+   // \param dv The dense vector to be reduced.
+   // \param op The reduction operation.
+   // \param results The partial results (one slot per team member).
+   // \param valid The flags for the valid partial results (one slot per team member).
+   */
+   explicit inline DenseVectorReduceJob( const VT& dv, OP op, ElementType* results, char* valid )
+      : dv_     ( dv      )  // The dense vector to be reduced
+      , op_     ( op      )  // The reduction operation
+      , results_( results )  // The partial results
+      , valid_  ( valid   )  // The flags for the valid partial results
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduction of the block of a single member of the thread team.
+   //
+   // \param rank The rank of the executing team member.
+   // \param threads The total number of team members executing the job.
+   // \return void
+   */
+   void operator()( size_t rank, size_t threads ) const
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const bool vectorizable( VT::vectorizable );
+
+      const size_t addon        ( ( ( dv_.size() % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare   ( dv_.size() / threads + addon );
+      const size_t rest         ( equalShare & ( IT::size - 1UL ) );
+      const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+      const size_t index        ( rank*sizePerThread );
+
+      if( index >= dv_.size() )
+         return;
+
+      const size_t size( min( sizePerThread, dv_.size() - index ) );
+
+      if( vectorizable && dv_.isAligned() )
+         results_[rank] = dvecreduce( subvector<aligned>( dv_, index, size ), op_ );
+      else
+         results_[rank] = dvecreduce( subvector<unaligned>( dv_, index, size ), op_ );
+
+      valid_[rank] = 1;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const VT&    dv_;       //!< The dense vector to be reduced.
+   OP           op_;       //!< The reduction operation.
+   ElementType* results_;  //!< The partial results.
+   char*        valid_;    //!< The flags for the valid partial results.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread team based SMP assignment of a dense vector to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \param op The assignment functor.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF2      // Transpose flag of the right-hand side dense vector
+        , typename OP > // Type of the assignment functor
+inline void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP op )
+{
+   ThreadBackend<int>::team().run( DenseVectorJob<VT1,VT2,OP>( ~lhs, ~rhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread team based SMP assignment of a sparse vector to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be assigned.
+// \param op The assignment functor.
+// \return void
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side sparse vector
+        , bool TF2      // Transpose flag of the right-hand side sparse vector
+        , typename OP > // Type of the assignment functor
+inline void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP op )
+{
+   ThreadBackend<int>::team().run( SparseVectorJob<VT1,VT2,OP>( ~lhs, ~rhs, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP assignment of a vector to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function implements the default thread team based SMP assignment of a vector to a dense
+// vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void smpAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP assignment of a dense vector to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function implements the thread team based SMP assignment of a dense vector to a dense
+// vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpAssign( DenseVector<VT1_,TF1>& lhs, const DenseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP assignment of a sparse vector to a dense
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function implements the thread team based SMP assignment of a sparse vector to a dense
+// vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpAssign( DenseVector<VT1_,TF1>& lhs, const SparseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP addition assignment of a vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function implements the default thread team based SMP addition assignment of a vector to a
+// dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void smpAddAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP addition assignment of a dense vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function implements the thread team based SMP addition assignment of a dense vector to a
+// dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpAddAssign( DenseVector<VT1_,TF1>& lhs, const DenseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      addAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP addition assignment of a sparse vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function implements the thread team based SMP addition assignment of a sparse vector to a
+// dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpAddAssign( DenseVector<VT1_,TF1>& lhs, const SparseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      addAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadAddAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP subtraction assignment of a vector to
+//        a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function implements the default thread team based SMP subtraction assignment of a vector to
+// a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void smpSubAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP subtraction assignment of a dense vector to a
+//        dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function implements the thread team based SMP subtraction assignment of a dense vector to a
+// dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpSubAssign( DenseVector<VT1_,TF1>& lhs, const DenseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      subAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadSubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP subtraction assignment of a sparse vector to
+//        a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function implements the thread team based SMP subtraction assignment of a sparse vector to
+// a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpSubAssign( DenseVector<VT1_,TF1>& lhs, const SparseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      subAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadSubAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP multiplication assignment of a vector
+//        to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function implements the default thread team based SMP multiplication assignment of a vector
+// to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void smpMultAssign( DenseVector<VT1_,TF1>& lhs, const Vector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+   multAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP multiplication assignment of a dense vector
+//        to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function implements the thread team based SMP multiplication assignment of a dense vector
+// to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side dense vector
+        , bool TF2 >    // Transpose flag of the right-hand side dense vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpMultAssign( DenseVector<VT1_,TF1>& lhs, const DenseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      multAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadMultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP multiplication assignment of a sparse vector
+//        to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function implements the thread team based SMP multiplication assignment of a sparse vector
+// to a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1_  // Type of the left-hand side dense vector
+        , bool TF1      // Transpose flag of the left-hand side dense vector
+        , typename VT2_  // Type of the right-hand side sparse vector
+        , bool TF2 >    // Transpose flag of the right-hand side sparse vector
+inline typename EnableIfTrue< VT1_::smpAssignable && VT2_::smpAssignable >::Type
+   smpMultAssign( DenseVector<VT1_,TF1>& lhs, const SparseVector<VT2_,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      multAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   threadAssign( ~lhs, ~rhs, ThreadMultAssign() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the thread team based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default thread team based SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline typename VT::ElementType smpReduce( const Vector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the thread team based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the thread team based SMP reduction of a dense vector. Each member
+// of the thread team reduces a contiguous block of the vector, the partial results are combined
+// afterwards by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline typename EnableIfTrue< VT::smpAssignable, typename VT::ElementType >::Type
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType  ET;
+
+   if( isSerialSectionActive() || !(~dv).canSMPAssign() ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   const size_t threads( ThreadBackend<int>::team().size() );
+
+   std::vector<ET>   results( threads );
+   std::vector<char> valid  ( threads, 0 );
+
+   ThreadBackend<int>::team().run( DenseVectorReduceJob<VT,OP>( ~dv, op, &results[0], &valid[0] ) );
+
+   ET redux( results[0] );
+   for( size_t i=1UL; i<threads; ++i ) {
+      if( valid[i] ) redux = op( redux, results[i] );
+   }
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_THREAD_TEAM_PARALLEL_MODE > 0 );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
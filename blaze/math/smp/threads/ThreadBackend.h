@@ -0,0 +1,450 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ThreadBackend.h
+//  \brief Header file for the thread team based SMP backend
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_THREADBACKEND_H_
+#define _BLAZE_MATH_SMP_THREADS_THREADBACKEND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/once.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/ThreadTeam.h>
+#include <blaze/util/Topology.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the thread team based SMP assignments.
+// \ingroup smp
+//
+// The ThreadBackend class manages the team of persistent worker threads used by all thread team
+// based SMP assignments. The team is created on first use. By default, the number of members of
+// the team is given by the \c BLAZE_NUM_THREADS environment variable or, in case the variable is
+// not set, by the number of available cores. The worker threads are placed according to the
+// \c BLAZE_THREAD_TEAM_PLACEMENT setting on the logical CPUs given by the \c BLAZE_CPUSET
+// environment variable or, in case the variable is not set, on all available logical CPUs.
+// Alternatively, the logical CPUs of the ranks can be specified explicitly via the affinity()
+// function.
+*/
+template< typename T >
+class ThreadBackend
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef boost::mutex        Mutex;  //!< Type of the mutex.
+   typedef Mutex::scoped_lock  Lock;   //!< Type of a locking object.
+   //**********************************************************************************************
+
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline ThreadTeam& team();
+   static inline void        resize( size_t n );
+   static inline void        affinity( const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void                initialize();
+   static inline ThreadTeam*         create( size_t n );
+   static inline size_t              defaultSize();
+   static inline std::vector<size_t> defaultPlacement( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static UniquePtr<ThreadTeam> team_;  //!< The team of the thread team based SMP assignments.
+   static boost::once_flag once_;       //!< Flag for the one-time initialization of the team.
+   static Mutex mutex_;                 //!< Synchronization mutex for resizing the team.
+   static std::vector<size_t> cpus_;    //!< The explicitly specified logical CPUs of the ranks.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+UniquePtr<ThreadTeam> ThreadBackend<T>::team_;
+
+template< typename T >
+boost::once_flag ThreadBackend<T>::once_ = BOOST_ONCE_INIT;
+
+template< typename T >
+boost::mutex ThreadBackend<T>::mutex_;
+
+template< typename T >
+std::vector<size_t> ThreadBackend<T>::cpus_;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the team of the thread team based SMP assignments.
+//
+// \return Reference to the thread team.
+*/
+template< typename T >
+inline ThreadTeam& ThreadBackend<T>::team()
+{
+   boost::call_once( &ThreadBackend<T>::initialize, once_ );
+   BLAZE_INTERNAL_ASSERT( team_.get() != NULL, "Uninitialized thread team detected" );
+   return *team_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replaces the team of the thread team based SMP assignments.
+//
+// \param n The new number of team members \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid team size.
+*/
+template< typename T >
+inline void ThreadBackend<T>::resize( size_t n )
+{
+   boost::call_once( &ThreadBackend<T>::initialize, once_ );
+
+   Lock lock( mutex_ );
+
+   if( n != team_->size() )
+      team_.reset( create( n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replaces the team by a team bound to the given logical CPUs.
+//
+// \param cpus The operating system IDs of the logical CPUs of the ranks.
+// \return void
+//
+// In case the given list of logical CPUs is empty, the default placement is restored.
+*/
+template< typename T >
+inline void ThreadBackend<T>::affinity( const std::vector<size_t>& cpus )
+{
+   boost::call_once( &ThreadBackend<T>::initialize, once_ );
+
+   Lock lock( mutex_ );
+
+   cpus_ = cpus;
+   team_.reset( create( team_->size() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the team of the thread team based SMP assignments.
+//
+// \return void
+*/
+template< typename T >
+inline void ThreadBackend<T>::initialize()
+{
+   team_.reset( create( defaultSize() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a new team of the given size.
+//
+// \param n The number of team members \f$[1..\infty)\f$.
+// \return Pointer to the newly created team.
+// \exception std::invalid_argument Invalid team size.
+*/
+template< typename T >
+inline ThreadTeam* ThreadBackend<T>::create( size_t n )
+{
+   return new ThreadTeam( n, BLAZE_THREAD_TEAM_SPIN_COUNT,
+                          ( cpus_.empty() )?( defaultPlacement( n ) ):( cpus_ ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the default number of members of the thread team.
+//
+// \return The value of the \c BLAZE_NUM_THREADS environment variable or the number of cores.
+*/
+template< typename T >
+inline size_t ThreadBackend<T>::defaultSize()
+{
+   const char* const env( std::getenv( "BLAZE_NUM_THREADS" ) );
+
+   if( env != NULL ) {
+      const unsigned long n( std::strtoul( env, NULL, 10 ) );
+      if( n > 0UL ) return n;
+   }
+
+   const size_t cores( boost::thread::hardware_concurrency() );
+   return ( cores > 0UL )?( cores ):( 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the default logical CPUs of the ranks of a team of the given size.
+//
+// \param n The number of team members.
+// \return The logical CPUs of the ranks (empty in case the team should not be pinned).
+//
+// The logical CPUs are selected according to the \c BLAZE_THREAD_TEAM_PLACEMENT setting from
+// the logical CPUs given by the \c BLAZE_CPUSET environment variable. In case the variable is
+// not set or cannot be parsed, all logical CPUs available to the process are used.
+*/
+template< typename T >
+inline std::vector<size_t> ThreadBackend<T>::defaultPlacement( size_t n )
+{
+   if( BLAZE_THREAD_TEAM_PLACEMENT == 0 )
+      return std::vector<size_t>();
+
+   const Topology::Placement placement( ( BLAZE_THREAD_TEAM_PLACEMENT == 2 )
+                                        ?( Topology::spread ):( Topology::compact ) );
+
+   Topology topology;
+
+   const char* const env( std::getenv( "BLAZE_CPUSET" ) );
+
+   if( env != NULL ) {
+      try {
+         const Topology subset( topology.subset( parseCpuList( env ) ) );
+         if( subset.size() > 0UL ) topology = subset;
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   return topology.place( n, placement );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads used for thread team based SMP assignments.
+// \ingroup smp
+//
+// \return The number of members of the SMP thread team (including the calling thread).
+*/
+inline size_t getNumThreads()
+{
+   return ThreadBackend<int>::team().size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of threads used for thread team based SMP assignments.
+// \ingroup smp
+//
+// \param n The new number of threads \f$[1..\infty)\f$ (including the calling thread).
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function replaces the team of persistent worker threads used by the thread team based SMP
+// assignments by a team of the given size. Note that this function must not be called while any
+// SMP assignment is in progress.
+*/
+inline void setNumThreads( size_t n )
+{
+   ThreadBackend<int>::resize( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the threads used for thread team based SMP assignments to the given logical CPUs.
+// \ingroup smp
+//
+// \param cpus The operating system IDs of the logical CPUs of the ranks.
+// \return void
+//
+// This function replaces the team of persistent worker threads used by the thread team based SMP
+// assignments by a team whose worker thread with rank \f$ r \f$ is bound to the logical CPU
+// \f$ cpus[r \bmod |cpus|] \f$. Since the rows (or columns) of an SMP assignment are split into
+// contiguous blocks in the order of the ranks, the blocks of all ranks bound to the same NUMA
+// node are adjacent. The list of logical CPUs is most conveniently created via the Topology
+// class:
+
+   \code
+   // Spreading the threads across all sockets of the system
+   blaze::setThreadAffinity( blaze::Topology().place( blaze::getNumThreads(), blaze::Topology::spread ) );
+   \endcode
+
+// In case the given list is empty, the default placement according to the
+// \c BLAZE_THREAD_TEAM_PLACEMENT setting is restored. Note that this function must not be
+// called while any SMP assignment is in progress.
+*/
+inline void setThreadAffinity( const std::vector<size_t>& cpus )
+{
+   ThreadBackend<int>::affinity( cpus );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the assignment of a single block of a thread team based SMP assignment.
+// \ingroup smp
+*/
+struct ThreadAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { assign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the addition assignment of a single block of a thread team based SMP
+//        assignment.
+// \ingroup smp
+*/
+struct ThreadAddAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { addAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the subtraction assignment of a single block of a thread team based SMP
+//        assignment.
+// \ingroup smp
+*/
+struct ThreadSubAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { subAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the multiplication assignment of a single block of a thread team based SMP
+//        assignment.
+// \ingroup smp
+*/
+struct ThreadMultAssign
+{
+   template< typename T1, typename T2 >
+   inline void operator()( T1& lhs, const T2& rhs ) const { multAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1284 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/DeltaCompressedMatrix.h
+//  \brief Header file for the implementation of a delta compressed sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_DELTACOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_DELTACOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/TaskGroup.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup delta_compressed_matrix DeltaCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only row-major sparse matrix with delta encoded column indices.
+// \ingroup delta_compressed_matrix
+//
+// The DeltaCompressedMatrix class template represents a read-only, row-major \f$ M \times N \f$
+// sparse matrix, whose storage is optimized for bandwidth bound sparse matrix/vector
+// multiplications. Instead of a full column index per non-zero element, each row stores the
+// column index of its first non-zero element (the base index) and the differences between
+// the column indices of consecutive non-zero elements. Depending on the largest difference
+// within the row, these deltas are stored as 8-bit, 16-bit or 32-bit unsigned integral values.
+// Additionally, in case the matrix contains at most 256 distinct values, the values can be
+// stored as 8-bit indices into a dictionary of distinct values. For instance, the non-zero
+// elements of a finite difference stencil with double precision values require one byte for
+// the delta and one byte for the dictionary index, whereas the non-zero elements of a
+// \c CompressedMatrix require 16 bytes.
+//
+// A DeltaCompressedMatrix is created from an arbitrary sparse matrix:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DeltaCompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnVector;
+
+   CompressedMatrix<double> A( 100000UL, 100000UL );
+   // ... Initialization of the sparse matrix
+
+   DeltaCompressedMatrix<double> B( A );         // Delta encoding with value dictionary
+   DeltaCompressedMatrix<double> C( A, false );  // Delta encoding without value dictionary
+
+   DynamicVector<double,columnVector> x( 100000UL ), y;
+   // ... Initialization of the vector
+
+   y = B * x;  // Sparse matrix/vector multiplication
+   \endcode
+
+// In case AVX2 is available, the multiplication of a single or double precision matrix with a
+// vector decodes the deltas by means of a vectorized prefix sum and collects the according
+// vector elements via gather instructions. Note that the number of columns of the matrix is
+// restricted to \f$ 2^{31}-1 \f$.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class DeltaCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef DeltaCompressedMatrix<Type>  This;         //!< Type of this matrix instance.
+   typedef Type                         ElementType;  //!< Type of the sparse matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The maximum number of distinct values of a value dictionary.
+   enum { maxDictionarySize = 256 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DeltaCompressedMatrix();
+
+   template< typename MT, bool SO >
+   explicit inline DeltaCompressedMatrix( const SparseMatrix<MT,SO>& sm, bool dictionary = true );
+
+            inline DeltaCompressedMatrix( const DeltaCompressedMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~DeltaCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Type           operator()( size_t i, size_t j ) const;
+   inline size_t         base      ( size_t i ) const;
+   inline size_t         width     ( size_t i ) const;
+   inline size_t         delta     ( size_t i, size_t k ) const;
+   inline Type           value     ( size_t i, size_t k ) const;
+   inline const uint8_t* deltas    ( size_t i ) const;
+   inline const Type*    values    ( size_t i ) const;
+   inline const uint8_t* codes     ( size_t i ) const;
+   inline const Type*    dictionary() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline DeltaCompressedMatrix& operator=( const DeltaCompressedMatrix& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows          () const;
+   inline size_t columns       () const;
+   inline size_t nonZeros      () const;
+   inline size_t nonZeros      ( size_t i ) const;
+   inline size_t dictionarySize() const;
+   inline size_t memory        () const;
+   inline void   clear         ();
+   inline void   swap          ( DeltaCompressedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   inline void encode( const SparseMatrix<MT,false>& sm, bool dictionary );
+
+   template< typename MT >
+   inline void encode( const SparseMatrix<MT,true>& sm, bool dictionary );
+
+   inline void release();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t    m_;         //!< The current number of rows of the matrix.
+   size_t    n_;         //!< The current number of columns of the matrix.
+   size_t    bytes_;     //!< The total number of bytes of the encoded deltas.
+   size_t    dictSize_;  //!< The number of distinct values of the value dictionary.
+   size_t*   begin_;     //!< The indices of the first non-zero element of each row.
+                         /*!< The array contains \a m_+1 elements, the last of which is the
+                              total number of non-zero elements. */
+   size_t*   offset_;    //!< The byte offsets of the deltas of each row.
+   uint32_t* base_;      //!< The column indices of the first non-zero element of each row.
+   uint8_t*  width_;     //!< The number of bytes per delta of each row (1, 2 or 4).
+   uint8_t*  deltas_;    //!< The delta encoded column indices.
+                         /*!< The first delta of each row is 0. The deltas of each row are
+                              aligned according to their width. */
+   Type*     values_;    //!< The non-zero values (in case no value dictionary is used).
+   uint8_t*  codes_;     //!< The dictionary indices of the non-zero values.
+   Type*     dict_;      //!< The value dictionary.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE    ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPLEX_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DeltaCompressedMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline DeltaCompressedMatrix<Type>::DeltaCompressedMatrix()
+   : m_       ( 0UL  )  // The current number of rows of the matrix
+   , n_       ( 0UL  )  // The current number of columns of the matrix
+   , bytes_   ( 0UL  )  // The total number of bytes of the encoded deltas
+   , dictSize_( 0UL  )  // The number of distinct values of the value dictionary
+   , begin_   ( NULL )  // The indices of the first non-zero element of each row
+   , offset_  ( NULL )  // The byte offsets of the deltas of each row
+   , base_    ( NULL )  // The column indices of the first non-zero element of each row
+   , width_   ( NULL )  // The number of bytes per delta of each row
+   , deltas_  ( NULL )  // The delta encoded column indices
+   , values_  ( NULL )  // The non-zero values
+   , codes_   ( NULL )  // The dictionary indices of the non-zero values
+   , dict_    ( NULL )  // The value dictionary
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Delta compression of the given sparse matrix.
+//
+// \param sm Sparse matrix to be compressed.
+// \param dictionary \a true in case a value dictionary should be used, \a false if not.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// This constructor encodes the given row-major or column-major sparse matrix. In case
+// \a dictionary is \a true and the matrix contains at most 256 distinct values (not counting
+// NaN values, which disable the dictionary), the values are stored as indices into a value
+// dictionary. In case the matrix has more than \f$ 2^{31}-1 \f$ columns, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline DeltaCompressedMatrix<Type>::DeltaCompressedMatrix( const SparseMatrix<MT,SO>& sm,
+                                                           bool dictionary )
+   : m_       ( 0UL  )  // The current number of rows of the matrix
+   , n_       ( 0UL  )  // The current number of columns of the matrix
+   , bytes_   ( 0UL  )  // The total number of bytes of the encoded deltas
+   , dictSize_( 0UL  )  // The number of distinct values of the value dictionary
+   , begin_   ( NULL )  // The indices of the first non-zero element of each row
+   , offset_  ( NULL )  // The byte offsets of the deltas of each row
+   , base_    ( NULL )  // The column indices of the first non-zero element of each row
+   , width_   ( NULL )  // The number of bytes per delta of each row
+   , deltas_  ( NULL )  // The delta encoded column indices
+   , values_  ( NULL )  // The non-zero values
+   , codes_   ( NULL )  // The dictionary indices of the non-zero values
+   , dict_    ( NULL )  // The value dictionary
+{
+   try {
+      encode( sm, dictionary );
+   }
+   catch( ... ) {
+      release();
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DeltaCompressedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline DeltaCompressedMatrix<Type>::DeltaCompressedMatrix( const DeltaCompressedMatrix& m )
+   : m_       ( m.m_        )  // The current number of rows of the matrix
+   , n_       ( m.n_        )  // The current number of columns of the matrix
+   , bytes_   ( m.bytes_    )  // The total number of bytes of the encoded deltas
+   , dictSize_( m.dictSize_ )  // The number of distinct values of the value dictionary
+   , begin_   ( NULL )         // The indices of the first non-zero element of each row
+   , offset_  ( NULL )         // The byte offsets of the deltas of each row
+   , base_    ( NULL )         // The column indices of the first non-zero element of each row
+   , width_   ( NULL )         // The number of bytes per delta of each row
+   , deltas_  ( NULL )         // The delta encoded column indices
+   , values_  ( NULL )         // The non-zero values
+   , codes_   ( NULL )         // The dictionary indices of the non-zero values
+   , dict_    ( NULL )         // The value dictionary
+{
+   if( m.begin_ == NULL ) return;
+
+   const size_t nonzeros( m.begin_[m_] );
+
+   try {
+      begin_  = allocate<size_t>( m_+1UL );
+      offset_ = allocate<size_t>( m_ );
+      base_   = allocate<uint32_t>( m_ );
+      width_  = allocate<uint8_t>( m_ );
+      deltas_ = allocate<uint8_t>( bytes_ );
+
+      std::copy( m.begin_ , m.begin_ +m_+1UL, begin_  );
+      std::copy( m.offset_, m.offset_+m_    , offset_ );
+      std::copy( m.base_  , m.base_  +m_    , base_   );
+      std::copy( m.width_ , m.width_ +m_    , width_  );
+      std::copy( m.deltas_, m.deltas_+bytes_, deltas_ );
+
+      if( m.dict_ != NULL ) {
+         codes_ = allocate<uint8_t>( nonzeros );
+         dict_  = allocate<Type>( dictSize_ );
+         std::copy( m.codes_, m.codes_+nonzeros , codes_ );
+         std::copy( m.dict_ , m.dict_ +dictSize_, dict_  );
+      }
+      else {
+         values_ = allocate<Type>( nonzeros );
+         std::copy( m.values_, m.values_+nonzeros, values_ );
+      }
+   }
+   catch( ... ) {
+      release();
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for DeltaCompressedMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline DeltaCompressedMatrix<Type>::~DeltaCompressedMatrix()
+{
+   release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// Since the column indices of a row have to be decoded one by one, this function is linear in
+// the number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline Type DeltaCompressedMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t nonzeros( nonZeros( i ) );
+   size_t index( base_[i] );
+
+   for( size_t k=0UL; k<nonzeros && index<=j; ++k ) {
+      index += delta( i, k );
+      if( index == j ) return value( i, k );
+   }
+
+   return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the column index of the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return The base index of row \a i (0 in case the row contains no non-zero elements).
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::base( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return base_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes per delta of row \a i.
+//
+// \param i The row index.
+// \return The number of bytes per delta of row \a i (1, 2 or 4).
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::width( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return width_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the delta of the \a k-th non-zero element of row \a i.
+//
+// \param i The row index.
+// \param k The index of the non-zero element within row \a i.
+// \return The difference between the column indices of the \a k-th and the previous element.
+//
+// The delta of the first non-zero element of each row is 0. The column index of the \a k-th
+// non-zero element is given by the sum of base(i) and the deltas of the first \a k+1 elements.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::delta( size_t i, size_t k ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_USER_ASSERT( k < nonZeros( i ), "Invalid element access index" );
+
+   const uint8_t* const deltas( deltas_ + offset_[i] );
+
+   switch( width_[i] ) {
+      case 1U: return deltas[k];
+      case 2U: return reinterpret_cast<const uint16_t*>( deltas )[k];
+      default: return reinterpret_cast<const uint32_t*>( deltas )[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the value of the \a k-th non-zero element of row \a i.
+//
+// \param i The row index.
+// \param k The index of the non-zero element within row \a i.
+// \return The value of the \a k-th non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline Type DeltaCompressedMatrix<Type>::value( size_t i, size_t k ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_USER_ASSERT( k < nonZeros( i ), "Invalid element access index" );
+
+   if( dict_ != NULL )
+      return dict_[codes_[begin_[i]+k]];
+   else return values_[begin_[i]+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the encoded deltas of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the first delta of row \a i.
+//
+// The deltas of row \a i consist of width(i) bytes each and are aligned accordingly.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const uint8_t* DeltaCompressedMatrix<Type>::deltas( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return deltas_ + offset_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the non-zero values of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the first value of row \a i, \a NULL in case a value dictionary is used.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const Type* DeltaCompressedMatrix<Type>::values( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return ( values_ != NULL )?( values_ + begin_[i] ):( NULL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the dictionary indices of the non-zero values of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the first dictionary index of row \a i, \a NULL without value dictionary.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const uint8_t* DeltaCompressedMatrix<Type>::codes( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return ( codes_ != NULL )?( codes_ + begin_[i] ):( NULL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the value dictionary.
+//
+// \return Pointer to the first value of the dictionary, \a NULL in case no dictionary is used.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const Type* DeltaCompressedMatrix<Type>::dictionary() const
+{
+   return dict_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DeltaCompressedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline DeltaCompressedMatrix<Type>&
+   DeltaCompressedMatrix<Type>::operator=( const DeltaCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   DeltaCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::nonZeros() const
+{
+   return ( begin_ != NULL )?( begin_[m_] ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in row \a i.
+//
+// \param i The row index.
+// \return The number of non-zero elements in row \a i.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of distinct values of the value dictionary.
+//
+// \return The size of the value dictionary, 0 in case no value dictionary is used.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::dictionarySize() const
+{
+   return ( dict_ != NULL )?( dictSize_ ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes of the compressed representation.
+//
+// \return The number of bytes of all row information, deltas, values and dictionary entries.
+//
+// This function can for instance be used to determine the compression ratio in comparison
+// to a \c CompressedMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t DeltaCompressedMatrix<Type>::memory() const
+{
+   if( begin_ == NULL ) return 0UL;
+
+   const size_t rowBytes( 2UL*sizeof(size_t) + sizeof(uint32_t) + sizeof(uint8_t) );
+
+   return sizeof(size_t) + m_*rowBytes + bytes_ +
+          ( ( dict_ != NULL )?( nonZeros() + dictSize_*sizeof(Type) ):( nonZeros()*sizeof(Type) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void DeltaCompressedMatrix<Type>::clear()
+{
+   DeltaCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two delta compressed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void DeltaCompressedMatrix<Type>::swap( DeltaCompressedMatrix& m ) /* throw() */
+{
+   std::swap( m_       , m.m_        );
+   std::swap( n_       , m.n_        );
+   std::swap( bytes_   , m.bytes_    );
+   std::swap( dictSize_, m.dictSize_ );
+   std::swap( begin_   , m.begin_    );
+   std::swap( offset_  , m.offset_   );
+   std::swap( base_    , m.base_     );
+   std::swap( width_   , m.width_    );
+   std::swap( deltas_  , m.deltas_   );
+   std::swap( values_  , m.values_   );
+   std::swap( codes_   , m.codes_    );
+   std::swap( dict_    , m.dict_     );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Encoding of a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be encoded.
+// \param dictionary \a true in case a value dictionary should be used, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The encoding requires two passes over the given matrix: The first pass determines the number
+// of non-zero elements and the delta width of each row as well as the distinct values of the
+// matrix, the second pass stores the deltas and values.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the sparse matrix
+inline void DeltaCompressedMatrix<Type>::encode( const SparseMatrix<MT,false>& sm, bool dictionary )
+{
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   if( (~sm).columns() > 2147483647UL )
+      throw std::invalid_argument( "Invalid number of columns for a delta compressed matrix" );
+
+   m_ = (~sm).rows();
+   n_ = (~sm).columns();
+
+   begin_  = allocate<size_t>( m_+1UL );
+   offset_ = allocate<size_t>( m_ );
+   base_   = allocate<uint32_t>( m_ );
+   width_  = allocate<uint8_t>( m_ );
+
+   std::vector<Type> distinct;
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const ConstIterator end( (~sm).end(i) );
+      ConstIterator element( (~sm).begin(i) );
+
+      begin_[i] = nonzeros;
+      base_[i]  = static_cast<uint32_t>( ( element != end )?( element->index() ):( 0UL ) );
+
+      size_t previous( base_[i] ), maxDelta( 0UL );
+
+      for( ; element!=end; ++element, ++nonzeros )
+      {
+         maxDelta = std::max( maxDelta, element->index() - previous );
+         previous = element->index();
+
+         if( dictionary ) {
+            const Type value( element->value() );
+            const typename std::vector<Type>::iterator pos(
+               std::lower_bound( distinct.begin(), distinct.end(), value ) );
+
+            if( value != value ) {
+               dictionary = false;
+            }
+            else if( pos == distinct.end() || *pos != value ) {
+               if( distinct.size() == maxDictionarySize )
+                  dictionary = false;
+               else distinct.insert( pos, value );
+            }
+         }
+      }
+
+      width_[i] = ( maxDelta < 256UL )?( 1U ):( ( maxDelta < 65536UL )?( 2U ):( 4U ) );
+
+      bytes_ += ( width_[i] - bytes_ % width_[i] ) % width_[i];
+      offset_[i] = bytes_;
+      bytes_ += width_[i] * ( nonzeros - begin_[i] );
+   }
+
+   begin_[m_] = nonzeros;
+
+   deltas_ = allocate<uint8_t>( bytes_ );
+   std::fill( deltas_, deltas_+bytes_, uint8_t( 0U ) );
+
+   if( dictionary && !distinct.empty() ) {
+      dictSize_ = distinct.size();
+      dict_     = allocate<Type>( dictSize_ );
+      codes_    = allocate<uint8_t>( nonzeros );
+      std::copy( distinct.begin(), distinct.end(), dict_ );
+   }
+   else {
+      values_ = allocate<Type>( nonzeros );
+   }
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      uint8_t * const deltas8 ( deltas_ + offset_[i] );
+      uint16_t* const deltas16( reinterpret_cast<uint16_t*>( deltas8 ) );
+      uint32_t* const deltas32( reinterpret_cast<uint32_t*>( deltas8 ) );
+      size_t previous( base_[i] ), k( 0UL );
+
+      for( ConstIterator element=(~sm).begin(i); element!=(~sm).end(i); ++element, ++k )
+      {
+         const size_t delta( element->index() - previous );
+         previous = element->index();
+
+         switch( width_[i] ) {
+            case 1U : deltas8 [k] = static_cast<uint8_t >( delta ); break;
+            case 2U : deltas16[k] = static_cast<uint16_t>( delta ); break;
+            default : deltas32[k] = static_cast<uint32_t>( delta ); break;
+         }
+
+         const Type value( element->value() );
+
+         if( dict_ != NULL ) {
+            codes_[begin_[i]+k] = static_cast<uint8_t>(
+               std::lower_bound( dict_, dict_+dictSize_, value ) - dict_ );
+         }
+         else {
+            values_[begin_[i]+k] = value;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Encoding of a column-major sparse matrix.
+//
+// \param sm The column-major sparse matrix to be encoded.
+// \param dictionary \a true in case a value dictionary should be used, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The column-major matrix is converted into a temporary row-major matrix before the encoding.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the sparse matrix
+inline void DeltaCompressedMatrix<Type>::encode( const SparseMatrix<MT,true>& sm, bool dictionary )
+{
+   const CompressedMatrix<typename MT::ElementType,rowMajor> tmp( ~sm );
+   encode( tmp, dictionary );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing all dynamically allocated memory of the matrix.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void DeltaCompressedMatrix<Type>::release()
+{
+   deallocate( begin_  );
+   deallocate( offset_ );
+   deallocate( base_   );
+   deallocate( width_  );
+   deallocate( deltas_ );
+   deallocate( values_ );
+   deallocate( codes_  );
+   deallocate( dict_   );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DELTA COMPRESSED DOT PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized delta compressed kernels.
+// \ingroup delta_compressed_matrix
+*/
+template< typename Type >  // Data type of the sparse matrix
+struct UseDeltaGatherKernel
+{
+   enum { value = BLAZE_AVX2_MODE && ( IsFloat<Type>::value || IsDouble<Type>::value ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a delta encoded sparse row and a dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param x Pointer to the dense vector element at the base index of the row.
+// \param deltas The deltas of the row.
+// \param values The non-zero values of the row.
+// \param n The number of non-zero elements of the row.
+// \return The dot product.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename D >   // Type of the deltas
+inline typename DisableIf< UseDeltaGatherKernel<Type>, Type >::Type
+   ddot( const Type* x, const D* deltas, const Type* values, size_t n )
+{
+   Type res = Type();
+   for( size_t k=0UL; k<n; ++k ) {
+      x += deltas[k];
+      res += values[k] * (*x);
+   }
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a delta encoded sparse row and a dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param x Pointer to the dense vector element at the base index of the row.
+// \param deltas The deltas of the row.
+// \param values The non-zero values of the row.
+// \param n The number of non-zero elements of the row.
+// \return The dot product.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename D >   // Type of the deltas
+inline typename EnableIf< UseDeltaGatherKernel<Type>, Type >::Type
+   ddot( const Type* x, const D* deltas, const Type* values, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+
+   typename IT::Type xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size*2UL) <= n; k+=IT::size*2UL ) {
+      xmm1 = xmm1 + loadu( values+k          ) * dgather( x, deltas+k          );
+      xmm2 = xmm2 + loadu( values+k+IT::size ) * dgather( x, deltas+k+IT::size );
+   }
+   if( (k+IT::size) <= n ) {
+      xmm1 = xmm1 + loadu( values+k ) * dgather( x, deltas+k );
+      k += IT::size;
+   }
+
+   Type res( sum( xmm1 + xmm2 ) );
+
+   for( ; k<n; ++k ) {
+      x += deltas[k];
+      res += values[k] * (*x);
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a delta encoded sparse row with value dictionary and a dense
+//        vector.
+// \ingroup delta_compressed_matrix
+//
+// \param x Pointer to the dense vector element at the base index of the row.
+// \param deltas The deltas of the row.
+// \param codes The dictionary indices of the non-zero values of the row.
+// \param dict The value dictionary.
+// \param n The number of non-zero elements of the row.
+// \return The dot product.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename D >   // Type of the deltas
+inline typename DisableIf< UseDeltaGatherKernel<Type>, Type >::Type
+   ddot( const Type* x, const D* deltas, const uint8_t* codes, const Type* dict, size_t n )
+{
+   Type res = Type();
+   for( size_t k=0UL; k<n; ++k ) {
+      x += deltas[k];
+      res += dict[codes[k]] * (*x);
+   }
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a delta encoded sparse row with value dictionary and a dense
+//        vector.
+// \ingroup delta_compressed_matrix
+//
+// \param x Pointer to the dense vector element at the base index of the row.
+// \param deltas The deltas of the row.
+// \param codes The dictionary indices of the non-zero values of the row.
+// \param dict The value dictionary.
+// \param n The number of non-zero elements of the row.
+// \return The dot product.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename D >   // Type of the deltas
+inline typename EnableIf< UseDeltaGatherKernel<Type>, Type >::Type
+   ddot( const Type* x, const D* deltas, const uint8_t* codes, const Type* dict, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+
+   typename IT::Type xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+IT::size*2UL) <= n; k+=IT::size*2UL ) {
+      xmm1 = xmm1 + gather( dict, codes+k          ) * dgather( x, deltas+k          );
+      xmm2 = xmm2 + gather( dict, codes+k+IT::size ) * dgather( x, deltas+k+IT::size );
+   }
+   if( (k+IT::size) <= n ) {
+      xmm1 = xmm1 + gather( dict, codes+k ) * dgather( x, deltas+k );
+      k += IT::size;
+   }
+
+   Type res( sum( xmm1 + xmm2 ) );
+
+   for( ; k<n; ++k ) {
+      x += deltas[k];
+      res += dict[codes[k]] * (*x);
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a range of rows of a delta compressed matrix with a dense vector.
+// \ingroup delta_compressed_matrix
+//
+// \param y Pointer to the first element of the result vector.
+// \param A Pointer to the left-hand side delta compressed matrix.
+// \param x Pointer to the first element of the right-hand side dense vector.
+// \param first The index of the first row to be computed.
+// \param last The index one past the last row to be computed.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+void multiplyRows( Type* y, const DeltaCompressedMatrix<Type>* A, const Type* x,
+                   size_t first, size_t last )
+{
+   const Type* const dict( A->dictionary() );
+
+   for( size_t i=first; i<last; ++i )
+   {
+      const size_t n( A->nonZeros( i ) );
+      const Type* const xi( x + A->base( i ) );
+      const uint8_t * const deltas8 ( A->deltas( i ) );
+      const uint16_t* const deltas16( reinterpret_cast<const uint16_t*>( deltas8 ) );
+      const uint32_t* const deltas32( reinterpret_cast<const uint32_t*>( deltas8 ) );
+
+      if( dict != NULL ) {
+         const uint8_t* const codes( A->codes( i ) );
+         switch( A->width( i ) ) {
+            case 1UL: y[i] = ddot( xi, deltas8 , codes, dict, n ); break;
+            case 2UL: y[i] = ddot( xi, deltas16, codes, dict, n ); break;
+            default : y[i] = ddot( xi, deltas32, codes, dict, n ); break;
+         }
+      }
+      else {
+         const Type* const values( A->values( i ) );
+         switch( A->width( i ) ) {
+            case 1UL: y[i] = ddot( xi, deltas8 , values, n ); break;
+            case 2UL: y[i] = ddot( xi, deltas16, values, n ); break;
+            default : y[i] = ddot( xi, deltas32, values, n ); break;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DeltaCompressedMatrix functions */
+//@{
+template< typename Type >
+inline const CompressedMatrix<Type,rowMajor> decompress( const DeltaCompressedMatrix<Type>& A );
+
+template< typename Type >
+inline void multiply( DynamicVector<Type,columnVector>& y, const DeltaCompressedMatrix<Type>& A,
+                      const DynamicVector<Type,columnVector>& x );
+
+template< typename Type >
+inline void multiply( ThreadPool& pool, DynamicVector<Type,columnVector>& y,
+                      const DeltaCompressedMatrix<Type>& A,
+                      const DynamicVector<Type,columnVector>& x );
+
+template< typename Type >
+inline void swap( DeltaCompressedMatrix<Type>& a, DeltaCompressedMatrix<Type>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompression of a delta compressed matrix.
+// \ingroup delta_compressed_matrix
+//
+// \param A The delta compressed matrix.
+// \return The row-major compressed matrix represented by \a A.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const CompressedMatrix<Type,rowMajor> decompress( const DeltaCompressedMatrix<Type>& A )
+{
+   CompressedMatrix<Type,rowMajor> res( A.rows(), A.columns(), A.nonZeros() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      size_t index( A.base( i ) );
+      for( size_t k=0UL; k<A.nonZeros( i ); ++k ) {
+         index += A.delta( i, k );
+         res.append( i, index, A.value( i, k ) );
+      }
+      res.finalize( i );
+   }
+
+   return res;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a delta compressed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param y The resulting dense vector.
+// \param A The left-hand side delta compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// In contrast to the multiplication operator, the given result vector is reused.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void multiply( DynamicVector<Type,columnVector>& y, const DeltaCompressedMatrix<Type>& A,
+                      const DynamicVector<Type,columnVector>& x )
+{
+   if( A.columns() != x.size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   if( &x == &y ) {
+      DynamicVector<Type,columnVector> tmp;
+      multiply( tmp, A, x );
+      y.swap( tmp );
+      return;
+   }
+
+   y.resize( A.rows(), false );
+   multiplyRows( y.data(), &A, x.data(), 0UL, A.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parallel multiplication of a delta compressed matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param pool The thread pool for the parallel execution.
+// \param y The resulting dense vector.
+// \param A The left-hand side delta compressed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function splits the rows of the matrix into ranges of approximately equal numbers of
+// non-zero elements and computes the ranges by means of the given thread pool.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void multiply( ThreadPool& pool, DynamicVector<Type,columnVector>& y,
+                      const DeltaCompressedMatrix<Type>& A,
+                      const DynamicVector<Type,columnVector>& x )
+{
+   if( A.columns() != x.size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   if( &x == &y ) {
+      DynamicVector<Type,columnVector> tmp;
+      multiply( pool, tmp, A, x );
+      y.swap( tmp );
+      return;
+   }
+
+   y.resize( A.rows(), false );
+
+   const size_t tasks( 4UL * ( pool.size() + 1UL ) );
+   const size_t chunk( ( A.nonZeros() + A.rows() ) / tasks + 1UL );
+
+   TaskGroup group( pool );
+   size_t first( 0UL ), work( 0UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      work += A.nonZeros( i ) + 1UL;
+      if( work >= chunk ) {
+         group.run( &multiplyRows<Type>, y.data(), &A, x.data(), first, i+1UL );
+         first = i+1UL;
+         work  = 0UL;
+      }
+   }
+
+   if( first < A.rows() ) {
+      multiplyRows( y.data(), &A, x.data(), first, A.rows() );
+   }
+
+   group.wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two delta compressed matrices.
+// \ingroup delta_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void swap( DeltaCompressedMatrix<Type>& a, DeltaCompressedMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a delta compressed matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup delta_compressed_matrix
+//
+// \param mat The left-hand side delta compressed matrix.
+// \param vec The right-hand side dense vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const DynamicVector<Type,columnVector>
+   operator*( const DeltaCompressedMatrix<Type>& mat, const DynamicVector<Type,columnVector>& vec )
+{
+   DynamicVector<Type,columnVector> res;
+   multiply( res, mat, vec );
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
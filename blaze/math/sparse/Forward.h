@@ -46,6 +46,8 @@ namespace blaze {
 
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
+template< typename > class DeltaCompressedMatrix;
+template< typename, bool > class MappedSparseMatrix;
 
 } // namespace blaze
 
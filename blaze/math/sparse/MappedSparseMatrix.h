@@ -0,0 +1,1247 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/MappedSparseMatrix.h
+//  \brief Header file for the implementation of a memory-mapped sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_MAPPEDSPARSEMATRIX_H_
+#define _BLAZE_MATH_SPARSE_MAPPEDSPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <string>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/serialization/MappedSerializer.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_sparse_matrix MappedSparseMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only sparse matrix mapped from a file.
+// \ingroup mapped_sparse_matrix
+//
+// The MappedSparseMatrix class template represents a sparse matrix that has been written by the
+// serializeMapped() function. Instead of reading the non-zero elements and inserting them into a
+// CompressedMatrix, the complete file is mapped into the address space of the process and the
+// offset array and the value-index pairs are used directly from the mapped memory. Therefore the
+// construction of a MappedSparseMatrix does not copy any element and its cost is independent of
+// the number of non-zero elements. The type of the elements and the storage order of the matrix
+// can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedSparseMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedSparseMatrix can be used with any
+//          numeric element type. The element type has to match the element type of the file.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The storage order has to match the storage order of the file. The default value
+//          is blaze::rowMajor.
+//
+// The non-zero elements are stored in the same layout as the elements of a CompressedMatrix.
+// Therefore the MappedSparseMatrix uses the iterators of the CompressedMatrix class template
+// and can be used in all sparse matrix operations:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::serializeMapped( "A.blazemap", A );
+
+   blaze::MappedSparseMatrix<double,blaze::rowMajor> B( "A.blazemap" );
+   blaze::DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = B * x;
+   y = trans( B ) * x;
+   \endcode
+
+// In contrast to a CompressedMatrix, a MappedSparseMatrix is a read-only matrix, i.e. neither
+// its elements nor its sparsity pattern can be modified. In case the file cannot be mapped or
+// doesn't contain a matrix of the expected type and storage order, a \a std::runtime_error
+// exception is thrown. Note that the file must not be truncated or modified by another process
+// while it is mapped.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class MappedSparseMatrix : private MemoryMap
+                         , public SparseMatrix< MappedSparseMatrix<Type,SO>, SO >
+{
+ private:
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex
+   {
+      template< typename Element >
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      template< typename Element >
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedSparseMatrix<Type,SO>                        This;            //!< Type of this MappedSparseMatrix instance.
+   typedef CompressedMatrix<Type,SO>                          ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>                         OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO>                         TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                               ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                                        ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                                        CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                                        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                                        ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef typename CompressedMatrix<Type,SO>::ConstIterator  Iterator;        //!< Iterator over non-constant elements.
+   typedef typename CompressedMatrix<Type,SO>::ConstIterator  ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedSparseMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t i ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+
+   using MemoryMap::filename;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                  //!< The number of rows of the sparse matrix.
+   size_t n_;                  //!< The number of columns of the sparse matrix.
+   const uint64_t* offsets_;   //!< The offsets of the first non-zero element of each row.
+   ConstIterator elements_;    //!< Pointer to the first non-zero element of the sparse matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( sizeof( ValueIndexPair<Type> ) == sizeof( *ConstIterator() ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+const Type MappedSparseMatrix<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a MappedSparseMatrix.
+//
+// \param filename The name of the matrix file.
+// \exception std::runtime_error Unable to map file.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This constructor maps the given file into memory and validates its header and its offset
+// array. In case the file cannot be mapped or in case it doesn't contain a sparse matrix with
+// element type \a Type and storage order \a SO, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline MappedSparseMatrix<Type,SO>::MappedSparseMatrix( const std::string& filename )
+   : MemoryMap( filename )  // The mapped matrix file
+   , m_       ( 0UL )       // The number of rows of the sparse matrix
+   , n_       ( 0UL )       // The number of columns of the sparse matrix
+   , offsets_ ( NULL )      // The offsets of the first non-zero element of each row
+   , elements_( NULL )      // Pointer to the first non-zero element of the sparse matrix
+{
+   const MappedHeader& header( MappedSerializer::header<Type,false,SO>( *this ) );
+
+   m_        = header.rows;
+   n_        = header.columns;
+   offsets_  = reinterpret_cast<const uint64_t*>( MemoryMap::data() + header.indexOffset );
+   elements_ = reinterpret_cast<ConstIterator>( MemoryMap::data() + header.dataOffset );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstReference
+   MappedSparseMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( i ) || pos->index() != j )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return elements_ + offsets_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// Since the sparsity pattern of a mapped sparse matrix cannot be changed, the capacity of the
+// matrix is equal to the number of non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::capacity() const
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::capacity( size_t i ) const
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::nonZeros() const
+{
+   return offsets_[m_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline size_t MappedSparseMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::lower_bound( begin( i ), end( i ), j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+inline typename MappedSparseMatrix<Type,SO>::ConstIterator
+   MappedSparseMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return std::upper_bound( begin( i ), end( i ), j, FindIndex() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedSparseMatrix<Type,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the conAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedSparseMatrix<Type,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR COLUMN-MAJOR MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of MappedSparseMatrix for column-major matrices.
+// \ingroup mapped_sparse_matrix
+//
+// This specialization of MappedSparseMatrix adapts the class template to the requirements of
+// column-major matrices.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class MappedSparseMatrix<Type,true> : private MemoryMap
+                                    , public SparseMatrix< MappedSparseMatrix<Type,true>, true >
+{
+ private:
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() function.
+   */
+   struct FindIndex
+   {
+      template< typename Element >
+      inline bool operator()( const Element& element, size_t index ) const {
+         return element.index() < index;
+      }
+      template< typename Element >
+      inline bool operator()( size_t index, const Element& element ) const {
+         return index < element.index();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MappedSparseMatrix<Type,true>                        This;            //!< Type of this MappedSparseMatrix instance.
+   typedef CompressedMatrix<Type,true>                          ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,false>                         OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false>                         TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                               ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                                        ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                                        CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                                        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                                        ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef typename CompressedMatrix<Type,true>::ConstIterator  Iterator;        //!< Iterator over non-constant elements.
+   typedef typename CompressedMatrix<Type,true>::ConstIterator  ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedSparseMatrix( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t j ) const;
+   inline ConstIterator  cbegin( size_t j ) const;
+   inline ConstIterator  end   ( size_t j ) const;
+   inline ConstIterator  cend  ( size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t capacity() const;
+   inline size_t capacity( size_t j ) const;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t j ) const;
+
+   using MemoryMap::filename;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                  //!< The number of rows of the sparse matrix.
+   size_t n_;                  //!< The number of columns of the sparse matrix.
+   const uint64_t* offsets_;   //!< The offsets of the first non-zero element of each column.
+   ConstIterator elements_;    //!< Pointer to the first non-zero element of the sparse matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( sizeof( ValueIndexPair<Type> ) == sizeof( *ConstIterator() ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+/*! \cond BLAZE_INTERNAL */
+template< typename Type >  // Data type of the sparse matrix
+const Type MappedSparseMatrix<Type,true>::zero_ = Type();
+/*! \endcond */
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a MappedSparseMatrix.
+//
+// \param filename The name of the matrix file.
+// \exception std::runtime_error Unable to map file.
+// \exception std::runtime_error Invalid matrix file detected.
+//
+// This constructor maps the given file into memory and validates its header and its offset
+// array. In case the file cannot be mapped or in case it doesn't contain a sparse matrix with
+// element type \a Type and column-major storage order, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline MappedSparseMatrix<Type,true>::MappedSparseMatrix( const std::string& filename )
+   : MemoryMap( filename )  // The mapped matrix file
+   , m_       ( 0UL )       // The number of rows of the sparse matrix
+   , n_       ( 0UL )       // The number of columns of the sparse matrix
+   , offsets_ ( NULL )      // The offsets of the first non-zero element of each column
+   , elements_( NULL )      // Pointer to the first non-zero element of the sparse matrix
+{
+   const MappedHeader& header( MappedSerializer::header<Type,false,true>( *this ) );
+
+   m_        = header.rows;
+   n_        = header.columns;
+   offsets_  = reinterpret_cast<const uint64_t*>( MemoryMap::data() + header.indexOffset );
+   elements_ = reinterpret_cast<ConstIterator>( MemoryMap::data() + header.dataOffset );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstReference
+   MappedSparseMatrix<Type,true>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( j ) || pos->index() != i )
+      return zero_;
+   else
+      return pos->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first non-zero element of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::begin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offsets_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first non-zero element of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::cbegin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offsets_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last non-zero element of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::end( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offsets_[j+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last non-zero element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last non-zero element of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::cend( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
+   return elements_ + offsets_[j+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::rows() const
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::columns() const
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// Since the sparsity pattern of a mapped sparse matrix cannot be changed, the capacity of the
+// matrix is equal to the number of non-zero elements.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::capacity() const
+{
+   return nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified column.
+//
+// \param j The index of the column.
+// \return The current capacity of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::capacity( size_t j ) const
+{
+   return nonZeros( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::nonZeros() const
+{
+   return offsets_[n_];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t MappedSparseMatrix<Type,true>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return offsets_[j+1UL] - offsets_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( j ) && pos->index() == i )
+      return pos;
+   else return end( j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return std::lower_bound( begin( j ), end( j ), i, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline typename MappedSparseMatrix<Type,true>::ConstIterator
+   MappedSparseMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return std::upper_bound( begin( j ), end( j ), i, FindIndex() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedSparseMatrix<Type,true>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the conAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the sparse matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool MappedSparseMatrix<Type,true>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< MappedSparseMatrix<T1,SO> >
+{
+   typedef CompressedMatrix<T1,SO>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< MappedSparseMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< MappedSparseMatrix<T1,SO> >
+{
+   typedef CompressedVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,7 +41,9 @@
 //*************************************************************************************************
 
 #include <cstddef>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/typetraits/IsConst.h>
@@ -685,6 +687,106 @@ BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( long double   , long double   , l
 
 
 
+//=================================================================================================
+//
+//  FLOAT16 SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , unsigned char , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , char          , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , signed char   , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , wchar_t       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , unsigned short, float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , short         , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , unsigned int  , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , int           , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , unsigned long , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , long          , float          );
+#if defined(_WIN64)
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , std::size_t   , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , std::ptrdiff_t, float          );
+#endif
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , float         , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , double        , double         );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , long double   , long double    );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float16       , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned char , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( char          , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( signed char   , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( wchar_t       , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned short, float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( short         , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned int  , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( int           , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned long , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( long          , float16       , float          );
+#if defined(_WIN64)
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( std::size_t   , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( std::ptrdiff_t, float16       , float          );
+#endif
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float         , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( double        , float16       , double         );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( long double   , float16       , long double    );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BFLOAT16 SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , unsigned char , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , char          , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , signed char   , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , wchar_t       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , unsigned short, float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , short         , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , unsigned int  , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , int           , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , unsigned long , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , long          , float          );
+#if defined(_WIN64)
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , std::size_t   , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , std::ptrdiff_t, float          );
+#endif
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , float         , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , double        , double         );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , long double   , long double    );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , float16       , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( bfloat16      , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned char , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( char          , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( signed char   , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( wchar_t       , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned short, bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( short         , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned int  , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( int           , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( unsigned long , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( long          , bfloat16      , float          );
+#if defined(_WIN64)
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( std::size_t   , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( std::ptrdiff_t, bfloat16      , float          );
+#endif
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( float         , bfloat16      , float          );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( double        , bfloat16      , double         );
+BLAZE_CREATE_BUILTIN_MULTTRAIT_SPECIALIZATION( long double   , bfloat16      , long double    );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPLEX SPECIALIZATIONS
@@ -0,0 +1,3906 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/DenseColumns.h
+//  \brief Header file for the DenseColumns class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_DENSECOLUMNS_H_
+#define _BLAZE_MATH_VIEWS_DENSECOLUMNS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/constraints/TransExpr.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/IsTransExpr.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Streaming.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dense_columns DenseColumns
+// \ingroup views
+*/
+/*!\brief View on a selection of columns of a dense matrix.
+// \ingroup dense_columns
+//
+// The DenseColumns template represents a view on an arbitrary selection of columns of a dense
+// matrix primitive. The type of the dense matrix is specified via the first template parameter:
+
+   \code
+   template< typename MT, bool SO >
+   class DenseColumns;
+   \endcode
+
+//  - MT: specifies the type of the dense matrix primitive. DenseColumns can be used with every
+//        dense matrix primitive, but does not work with any matrix expression type.
+//  - SO: specifies whether the given matrix is a column-major matrix (\a true) or a row-major
+//        matrix (\a false). This template parameter doesn't have to be explicitly defined, but
+//        is automatically derived from the first template parameter.
+//
+//
+// \n \section dense_columns_setup Setup of Column Selections
+//
+// A column selection is created via the \c columns() function, which takes a dense matrix and a
+// list of column indices. The indices may be given in arbitrary order and may contain duplicates.
+// The selection doesn't copy any elements but refers to the columns of the given matrix.
+// Therefore it can be used on both sides of an assignment:
+
+   \code
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  MatrixType;
+
+   MatrixType X( 1000UL, 64UL ), W( 64UL, 10UL ), Y;
+   // ... Initialization
+
+   std::vector<size_t> batch;
+   batch.push_back( 512UL );
+   batch.push_back(   3UL );
+   batch.push_back( 731UL );
+
+   // Multiplying the columns 512, 3, and 731 of X with W
+   Y = columns( X, batch ) * W;
+
+   // Scaling the selected columns of X
+   columns( X, batch ) *= 0.5;
+   \endcode
+
+// In case any of the given indices is not smaller than the number of columns of the matrix, a
+// \a std::invalid_argument exception is thrown.
+//
+//
+// \n \section dense_columns_performance Performance
+//
+// The storage order of a column selection is the same as the storage order of the underlying
+// matrix. In case of a column-major matrix every selected column is stored contiguously and all
+// operations are vectorized exactly as on the matrix itself. In case of a row-major matrix
+// the elements of a row of the selection are scattered across the according row of the
+// matrix and are therefore loaded via gather operations, which on AVX2 platforms map to the
+// according gather instructions. Since AVX2 doesn't offer scatter instructions, stores to such
+// a selection are performed element by element. In case the index list contains duplicates, a
+// write operation is performed for every occurrence of an index and the last write wins. Note
+// that for row-major matrices the iterators of a column selection refer to the selection itself
+// and are therefore only valid as long as the selection exists.
+*/
+template< typename MT                              // Type of the dense matrix
+        , bool SO = IsColumnMajorMatrix<MT>::value >  // Storage order
+class DenseColumns : public DenseMatrix< DenseColumns<MT,SO>, columnMajor >
+                   , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense matrix expression.
+   typedef typename SelectType< IsExpression<MT>::value, MT, MT& >::Type  Operand;
+
+   //! Intrinsic trait for the matrix element type.
+   typedef IntrinsicTrait<typename MT::ElementType>  IT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the non-const reference and iterator types.
+   /*! The \a useConst compile time constant expression represents a compilation switch for
+       the non-const reference and iterator types. In case the given dense matrix of type
+       \a MT is const qualified, \a useConst will be set to 1 and the column selection will
+       return references and iterators to const. Otherwise \a useConst will be set to 0 and
+       the column selection will offer write access to the dense matrix elements both via the
+       function call operator and iterators. */
+   enum { useConst = IsConst<MT>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DenseColumns<MT,SO>                 This;           //!< Type of this DenseColumns instance.
+   typedef typename SubmatrixTrait<MT>::Type   ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::OppositeType   OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename MT::ElementType            ElementType;    //!< Type of the column selection elements.
+   typedef typename IT::Type                   IntrinsicType;  //!< Intrinsic type of the column selection elements.
+   typedef typename MT::ReturnType             ReturnType;     //!< Return type for expression template evaluations
+   typedef const DenseColumns&                 CompositeType;  //!< Data type for composite expression templates.
+
+   //! Reference to a constant column selection value.
+   typedef typename MT::ConstReference  ConstReference;
+
+   //! Reference to a non-constant column selection value.
+   typedef typename SelectType< useConst, ConstReference, typename MT::Reference >::Type  Reference;
+
+   //! Iterator over constant elements.
+   typedef typename MT::ConstIterator  ConstIterator;
+
+   //! Iterator over non-constant elements.
+   typedef typename SelectType< useConst, ConstIterator, typename MT::Iterator >::Type  Iterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = MT::vectorizable };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DenseColumns( Operand matrix, const size_t* indices, size_t n );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t j );
+   inline ConstIterator  begin ( size_t j ) const;
+   inline ConstIterator  cbegin( size_t j ) const;
+   inline Iterator       end   ( size_t j );
+   inline ConstIterator  end   ( size_t j ) const;
+   inline ConstIterator  cend  ( size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                      inline DenseColumns& operator= ( const ElementType& rhs );
+                                      inline DenseColumns& operator= ( const DenseColumns& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator-=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator*=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseColumns >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseColumns >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t j ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t j ) const;
+                              inline void          reset();
+                              inline void          reset( size_t j );
+   template< typename Other > inline DenseColumns& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load  ( size_t i, size_t j ) const;
+   inline IntrinsicType loadu ( size_t i, size_t j ) const;
+   inline void          store ( size_t i, size_t j, const IntrinsicType& value );
+   inline void          storeu( size_t i, size_t j, const IntrinsicType& value );
+   inline void          stream( size_t i, size_t j, const IntrinsicType& value );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 > inline void assign( const DenseMatrix<MT2,rowMajor>&     rhs );
+   template< typename MT2 > inline void assign( const SparseMatrix<MT2,columnMajor>& rhs );
+   template< typename MT2 > inline void assign( const SparseMatrix<MT2,rowMajor>&    rhs );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedAddAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,rowMajor>&     rhs );
+   template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,columnMajor>& rhs );
+   template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,rowMajor>&    rhs );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedSubAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,rowMajor>&     rhs );
+   template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,columnMajor>& rhs );
+   template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,rowMajor>&    rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand             matrix_;   //!< The dense matrix containing the selected columns.
+   std::vector<size_t> indices_;  //!< The indices of the selected columns.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for DenseColumns.
+//
+// \param matrix The matrix containing the selected columns.
+// \param indices Pointer to the first index of the selected columns.
+// \param n The number of selected columns.
+// \exception std::invalid_argument Invalid column access index.
+//
+// In case any of the given indices is not smaller than the number of columns of the given matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline DenseColumns<MT,SO>::DenseColumns( Operand matrix, const size_t* indices, size_t n )
+   : matrix_ ( matrix             )  // The dense matrix containing the selected columns
+   , indices_( indices, indices+n )  // The indices of the selected columns
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      if( indices[j] >= matrix.columns() )
+         throw std::invalid_argument( "Invalid column access index" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the column selection elements.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return Reference to the accessed value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::Reference
+   DenseColumns<MT,SO>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return matrix_(i,indices_[j]);
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief 2D-access to the column selection elements.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return Reference to the accessed value.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::ConstReference
+   DenseColumns<MT,SO>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return matrix_(i,indices_[j]);
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::Iterator DenseColumns<MT,SO>::begin( size_t j )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.begin( indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::ConstIterator DenseColumns<MT,SO>::begin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.cbegin( indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of column \a j.
+//
+// \param j The column index.
+// \return Iterator to the first element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::ConstIterator DenseColumns<MT,SO>::cbegin( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.cbegin( indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::Iterator DenseColumns<MT,SO>::end( size_t j )
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.end( indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::ConstIterator DenseColumns<MT,SO>::end( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.cend( indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of column \a j.
+//
+// \param j The column index.
+// \return Iterator just past the last element of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::ConstIterator DenseColumns<MT,SO>::cend( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column selection column access index" );
+   return matrix_.cend( indices_[j] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all column selection elements.
+//
+// \param rhs Scalar value to be assigned to all column selection elements.
+// \return Reference to the assigned column selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator=( const ElementType& rhs )
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         matrix_(i,indices_[j]) = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DenseColumns.
+//
+// \param rhs Column selection to be copied.
+// \return Reference to the assigned column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The column selection is initialized as a copy of the given column selection. In case the
+// current sizes of the two column selections don't match, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator=( const DenseColumns& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE  ( ResultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+   if( this == &rhs || ( &matrix_ == &rhs.matrix_ && indices_ == rhs.indices_ ) )
+      return *this;
+
+   if( columns() != rhs.columns() || rows() != rhs.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( rhs.canAlias( &matrix_ ) ) {
+      const ResultType tmp( rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The column selection is initialized as a copy of the given matrix. In case the current sizes
+// of the two matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO >     // Storage order
+template< typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsSparseMatrix<MT2>::value )
+      reset();
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the column selection.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO >     // Storage order
+template< typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the column selection.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO >     // Storage order
+template< typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename MT   // Type of the dense matrix
+        , bool SO >     // Storage order
+template< typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::operator*=( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   typedef typename MultTrait<ResultType,typename MT2::ResultType>::Type  MultType;
+
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MultType );
+
+   const MultType tmp( *this * (~rhs) );
+   if( IsSparseMatrix<MultType>::value )
+      reset();
+   smpAssign( *this, tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a column selection
+//        and a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the column selection.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Other > // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseColumns<MT,SO> >::Type&
+   DenseColumns<MT,SO>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a column selection by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the column selection.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Other > // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseColumns<MT,SO> >::Type&
+   DenseColumns<MT,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the column selection.
+//
+// \return The number of rows of the column selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::rows() const
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the column selection.
+//
+// \return The number of columns of the column selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::columns() const
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the column selection.
+//
+// \return The capacity of the column selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::capacity() const
+{
+   return columns() * rows();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the column selection.
+//
+// \return The number of non-zero elements in the column selection.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::nonZeros() const
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         if( !isDefault( matrix_(i,indices_[j]) ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void DenseColumns<MT,SO>::reset()
+{
+   using blaze::reset;
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         reset( matrix_(i,indices_[j]) );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Scaling of the column selection by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the scaling.
+// \return Reference to the column selection.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Other > // Data type of the scalar value
+inline DenseColumns<MT,SO>& DenseColumns<MT,SO>::scale( const Other& scalar )
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         matrix_(i,indices_[j]) *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified column.
+//
+// \param j The index of the column.
+// \return The current capacity of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::capacity( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified column.
+//
+// \param j The index of the column.
+// \return The number of non-zero elements of column \a j.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t DenseColumns<MT,SO>::nonZeros( size_t j ) const
+{
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t m( rows() );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i )
+      if( !isDefault( matrix_(i,indices_[j]) ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified column to the default initial values.
+//
+// \param j The index of the column.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void DenseColumns<MT,SO>::reset( size_t j )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t m( rows() );
+   for( size_t i=0UL; i<m; ++i )
+      reset( matrix_(i,indices_[j]) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the column selection can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column selection, \a false if not.
+//
+// This function returns whether the given address can alias with the column selection. In
+// contrast to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Other > // Data type of the foreign expression
+inline bool DenseColumns<MT,SO>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( &matrix_ ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns whether the column selection is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column selection, \a false if not.
+//
+// This function returns whether the given address is aliased with the column selection. In
+// contrast to the canAlias() function this function is not allowed to use compile time
+// expressions to optimize the evaluation.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename Other > // Data type of the foreign expression
+inline bool DenseColumns<MT,SO>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( &matrix_ ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the column selection is properly aligned in memory.
+//
+// \return \a true in case the column selection is aligned, \a false if not.
+//
+// This function returns whether the column selection is guaranteed to be properly aligned in
+// memory. Since every selected column is a complete column of the underlying matrix, the column
+// selection is aligned in case the matrix is aligned.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool DenseColumns<MT,SO>::isAligned() const
+{
+   return matrix_.isAligned();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the column selection can be used in SMP assignments.
+//
+// \return \a true in case the column selection can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the column selection can be used in SMP assignments. In contrast
+// to the \a smpAssignable member enumeration, which is based solely on compile time information,
+// this function additionally provides runtime information (as for instance the current number
+// of columns and/or rows of the column selection).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool DenseColumns<MT,SO>::canSMPAssign() const
+{
+   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an aligned load of a specific intrinsic element of the column
+// selection. The column index must be smaller than the number of columns and the row index
+// must be smaller than the number of rows. Additionally, the row index must be a
+// multiple of the number of values inside the intrinsic element. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::IntrinsicType
+   DenseColumns<MT,SO>::load( size_t i, size_t j ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   return matrix_.load( i,indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function performs an unaligned load of a specific intrinsic element of the column
+// selection. The column index must be smaller than the number of columns and the row index
+// must be smaller than the number of rows. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DenseColumns<MT,SO>::IntrinsicType
+   DenseColumns<MT,SO>::loadu( size_t i, size_t j ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   return matrix_.loadu( i,indices_[j] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific intrinsic element of the column
+// selection. The column index must be smaller than the number of columns and the row index
+// must be smaller than the number of rows. Additionally, the row index must be a
+// multiple of the number of values inside the intrinsic element. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void DenseColumns<MT,SO>::store( size_t i, size_t j, const IntrinsicType& value )
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   matrix_.store( i,indices_[j], value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific intrinsic element of the column
+// selection. The column index must be smaller than the number of columns and the row index
+// must be smaller than the number of rows. This function must \b NOT be called explicitly!
+// It is used internally for the performance optimized evaluation of expression templates.
+// Calling this function explicitly might result in erroneous results and/or in compilation
+// errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void DenseColumns<MT,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   matrix_.storeu( i,indices_[j], value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific intrinsic element of
+// the column selection. The column index must be smaller than the number of columns and the row
+// index must be smaller than the number of rows. Additionally, the row index must be
+// a multiple of the number of values inside the intrinsic element. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void DenseColumns<MT,SO>::stream( size_t i, size_t j, const IntrinsicType& value )
+{
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   matrix_.stream( i,indices_[j], value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT2> >::Type
+   DenseColumns<MT,SO>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t iend( m & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         matrix_(i,indices_[j]) = (~rhs)(i,j);
+         matrix_(i+1UL,indices_[j]) = (~rhs)(i+1UL,j);
+      }
+      if( iend < m ) {
+         matrix_(iend,indices_[j]) = (~rhs)(iend,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedAssign<MT2> >::Type
+   DenseColumns<MT,SO>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   if( useStreaming && n*m > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       !(~rhs).isAliased( &matrix_ ) )
+   {
+      for( size_t j=0UL; j<n; ++j )
+         for( size_t i=0UL; i<m; i+=IT::size )
+            matrix_.stream( i, indices_[j], (~rhs).load(i,j) );
+   }
+   else
+   {
+      const size_t iend( m & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( m - ( m % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         const size_t column( indices_[j] );
+         typename MT2::ConstIterator it( (~rhs).begin(j) );
+         for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+            for( size_t k=0UL; k<IT::size*4UL; k+=IT::size, it+=IT::size ) {
+               matrix_.store( i+k, column, it.load() );
+            }
+         }
+         for( size_t i=iend; i<m; i+=IT::size, it+=IT::size ) {
+            matrix_.store( i, column, it.load() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,SO>::assign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::assign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) = element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::assign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) = element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT2> >::Type
+   DenseColumns<MT,SO>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t iend( m & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         matrix_(i,indices_[j]) += (~rhs)(i,j);
+         matrix_(i+1UL,indices_[j]) += (~rhs)(i+1UL,j);
+      }
+      if( iend < m ) {
+         matrix_(iend,indices_[j]) += (~rhs)(iend,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedAddAssign<MT2> >::Type
+   DenseColumns<MT,SO>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   const size_t iend( m & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const size_t column( indices_[j] );
+      typename MT2::ConstIterator it( (~rhs).begin(j) );
+      for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+         for( size_t k=0UL; k<IT::size*4UL; k+=IT::size, it+=IT::size ) {
+            matrix_.store( i+k, column, matrix_.load( i+k, column ) + it.load() );
+         }
+      }
+      for( size_t i=iend; i<m; i+=IT::size, it+=IT::size ) {
+         matrix_.store( i, column, matrix_.load( i, column ) + it.load() );
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,SO>::addAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::addAssign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) += element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::addAssign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) += element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT2> >::Type
+   DenseColumns<MT,SO>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t iend( m & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % 2UL ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=0UL; i<iend; i+=2UL ) {
+         matrix_(i,indices_[j]) -= (~rhs)(i,j);
+         matrix_(i+1UL,indices_[j]) -= (~rhs)(i+1UL,j);
+      }
+      if( iend < m ) {
+         matrix_(iend,indices_[j]) -= (~rhs)(iend,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,SO>::BLAZE_TEMPLATE VectorizedSubAssign<MT2> >::Type
+   DenseColumns<MT,SO>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   const size_t iend( m & size_t(-IT::size*4) );
+   BLAZE_INTERNAL_ASSERT( ( m - ( m % (IT::size*4UL) ) ) == iend, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const size_t column( indices_[j] );
+      typename MT2::ConstIterator it( (~rhs).begin(j) );
+      for( size_t i=0UL; i<iend; i+=IT::size*4UL ) {
+         for( size_t k=0UL; k<IT::size*4UL; k+=IT::size, it+=IT::size ) {
+            matrix_.store( i+k, column, matrix_.load( i+k, column ) - it.load() );
+         }
+      }
+      for( size_t i=iend; i<m; i+=IT::size, it+=IT::size ) {
+         matrix_.store( i, column, matrix_.load( i, column ) - it.load() );
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,SO>::subAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::subAssign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) -= element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT     // Type of the dense matrix
+        , bool SO >       // Storage order
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,SO>::subAssign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) -= element->value();
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR ROW-MAJOR MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of DenseColumns for row-major matrices.
+// \ingroup dense_columns
+//
+// This specialization of DenseColumns adapts the class template to the requirements of
+// row-major matrices. Every row of the column selection is gathered from the according
+// row of the underlying matrix.
+*/
+template< typename MT >  // Type of the dense matrix
+class DenseColumns<MT,false> : public DenseMatrix< DenseColumns<MT,false>, rowMajor >
+                             , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense matrix expression.
+   typedef typename SelectType< IsExpression<MT>::value, MT, MT& >::Type  Operand;
+
+   //! Intrinsic trait for the matrix element type.
+   typedef IntrinsicTrait<typename MT::ElementType>  IT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the non-const reference and iterator types.
+   /*! The \a useConst compile time constant expression represents a compilation switch for
+       the non-const reference and iterator types. In case the given dense matrix of type
+       \a MT is const qualified, \a useConst will be set to 1 and the column selection will
+       return references and iterators to const. Otherwise \a useConst will be set to 0 and
+       the column selection will offer write access to the dense matrix elements both via the
+       function call operator and iterators. */
+   enum { useConst = IsConst<MT>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DenseColumns<MT,false>              This;           //!< Type of this DenseColumns instance.
+   typedef typename SubmatrixTrait<MT>::Type   ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::OppositeType   OppositeType;   //!< Result type with opposite storage order for expression template evaluations.
+   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename MT::ElementType            ElementType;    //!< Type of the column selection elements.
+   typedef typename IT::Type                   IntrinsicType;  //!< Intrinsic type of the column selection elements.
+   typedef typename MT::ReturnType             ReturnType;     //!< Return type for expression template evaluations
+   typedef const DenseColumns&                 CompositeType;  //!< Data type for composite expression templates.
+
+   //! Reference to a constant column selection value.
+   typedef typename MT::ConstReference  ConstReference;
+
+   //! Reference to a non-constant column selection value.
+   typedef typename SelectType< useConst, ConstReference, typename MT::Reference >::Type  Reference;
+   //**********************************************************************************************
+
+   //**ColumnsIterator class definition************************************************************
+   /*!\brief Iterator over the elements of a row of the column selection.
+   //
+   // The iterator refers to the column selection itself. Therefore it is only valid as long as
+   // the column selection it has been created from.
+   */
+   template< typename ViewType >  // Type of the column selection
+   class ColumnsIterator
+   {
+    private:
+      //*******************************************************************************************
+      //! Compilation switch for the return type of the value member function.
+      /*! The \a returnConst compile time constant expression represents a compilation switch for
+          the return type of the member access operators. In case the given view type \a ViewType
+          is const qualified, \a returnConst will be set to 1 and the member access operators will
+          return a reference to const. Otherwise \a returnConst will be set to 0 and the member
+          access operators will offer write access to the dense matrix elements. */
+      enum { returnConst = IsConst<ViewType>::value };
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      //! Return type for the access to the value of a dense element.
+      typedef typename SelectType< returnConst, typename MT::ConstReference, typename MT::Reference >::Type  Reference;
+
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef RemoveReference<Reference>       ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                       PointerType;       //!< Pointer return type.
+      typedef Reference                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ColumnsIterator class.
+      //
+      // \param view The column selection to be traversed.
+      // \param column The initial column index.
+      // \param row The row index of the traversed row.
+      */
+      inline ColumnsIterator( ViewType& view, size_t row, size_t column )
+         : view_  ( &view  )  // The traversed column selection.
+         , column_   ( column    )  // The current column index.
+         , row_( row )  // The row index of the traversed row.
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different ColumnsIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ViewType2 >
+      inline ColumnsIterator( const ColumnsIterator<ViewType2>& it )
+         : view_  ( it.view_   )  // The traversed column selection.
+         , column_   ( it.column_    )  // The current column index.
+         , row_( it.row_ )  // The row index of the traversed row.
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ColumnsIterator& operator+=( size_t inc ) {
+         column_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ColumnsIterator& operator-=( size_t dec ) {
+         column_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ColumnsIterator& operator++() {
+         ++column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ColumnsIterator operator++( int ) {
+         const ColumnsIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ColumnsIterator& operator--() {
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ColumnsIterator operator--( int ) {
+         const ColumnsIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the elements of the traversed row.
+      //
+      // \param index Access index.
+      // \return Reference to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*view_)(row_,column_+index);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference to the current value.
+      */
+      inline ReferenceType operator*() const {
+         return (*view_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the element at the current iterator position.
+      */
+      inline PointerType operator->() const {
+         return &(*view_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Aligned load of an intrinsic element of the column selection.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function performs a load of the current intrinsic element of the column selection.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      inline IntrinsicType load() const {
+         return view_->load( row_,column_ );
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of an intrinsic element of the column selection.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function performs an unaligned load of the current intrinsic element of the column
+      // selection. This function must \b NOT be called explicitly! It is used internally for
+      // the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline IntrinsicType loadu() const {
+         return view_->loadu( row_,column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator==( const ColumnsIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( column_ == rhs.column_ ) && ( row_ == rhs.row_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ViewType2 >
+      inline bool operator!=( const ColumnsIterator<ViewType2>& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator<( const ColumnsIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( column_ < rhs.column_ ) && ( row_ == rhs.row_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator>( const ColumnsIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( column_ > rhs.column_ ) && ( row_ == rhs.row_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator<=( const ColumnsIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( column_ <= rhs.column_ ) && ( row_ == rhs.row_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ColumnsIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator>=( const ColumnsIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( column_ >= rhs.column_ ) && ( row_ == rhs.row_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ColumnsIterator& rhs ) const {
+         return column_ - rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ColumnsIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ColumnsIterator operator+( const ColumnsIterator& it, size_t inc ) {
+         return ColumnsIterator( *it.view_, it.row_,it.column_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ColumnsIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ColumnsIterator operator+( size_t inc, const ColumnsIterator& it ) {
+         return ColumnsIterator( *it.view_, it.row_,it.column_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ColumnsIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ColumnsIterator operator-( const ColumnsIterator& it, size_t dec ) {
+         return ColumnsIterator( *it.view_, it.row_,it.column_-dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ViewType* view_;    //!< The traversed column selection.
+      size_t    column_;     //!< The current column index.
+      size_t    row_;  //!< The row index of the traversed row.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ViewType2 > friend class ColumnsIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over constant elements.
+   typedef ColumnsIterator<const This>  ConstIterator;
+
+   //! Iterator over non-constant elements.
+   typedef typename SelectType< useConst, ConstIterator, ColumnsIterator<This> >::Type  Iterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = MT::vectorizable };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DenseColumns( Operand matrix, const size_t* indices, size_t n );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                      inline DenseColumns& operator= ( const ElementType& rhs );
+                                      inline DenseColumns& operator= ( const DenseColumns& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator-=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline DenseColumns& operator*=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseColumns >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseColumns >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t        rows() const;
+                              inline size_t        columns() const;
+                              inline size_t        capacity() const;
+                              inline size_t        capacity( size_t i ) const;
+                              inline size_t        nonZeros() const;
+                              inline size_t        nonZeros( size_t i ) const;
+                              inline void          reset();
+                              inline void          reset( size_t i );
+   template< typename Other > inline DenseColumns& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && MT2::vectorizable &&
+                     IsSame<ElementType,typename MT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load  ( size_t i, size_t j ) const;
+   inline IntrinsicType loadu ( size_t i, size_t j ) const;
+   inline void          store ( size_t i, size_t j, const IntrinsicType& value );
+   inline void          storeu( size_t i, size_t j, const IntrinsicType& value );
+   inline void          stream( size_t i, size_t j, const IntrinsicType& value );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedAssign<MT2> >::Type
+      assign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 > inline void assign( const DenseMatrix<MT2,columnMajor>&  rhs );
+   template< typename MT2 > inline void assign( const SparseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void assign( const SparseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedAddAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedAddAssign<MT2> >::Type
+      addAssign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,columnMajor>&  rhs );
+   template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,columnMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename DisableIf< VectorizedSubAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 >
+   inline typename EnableIf< VectorizedSubAssign<MT2> >::Type
+      subAssign( const DenseMatrix<MT2,rowMajor>& rhs );
+
+   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,columnMajor>&  rhs );
+   template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,rowMajor>&    rhs );
+   template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,columnMajor>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand             matrix_;   //!< The dense matrix containing the selected columns.
+   std::vector<size_t> indices_;  //!< The indices of the selected columns.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE    ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE      ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor for DenseColumns.
+//
+// \param matrix The matrix containing the selected columns.
+// \param indices Pointer to the first index of the selected columns.
+// \param n The number of selected columns.
+// \exception std::invalid_argument Invalid column access index.
+//
+// In case any of the given indices is not smaller than the number of columns of the given matrix,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+inline DenseColumns<MT,false>::DenseColumns( Operand matrix, const size_t* indices, size_t n )
+   : matrix_ ( matrix             )  // The dense matrix containing the selected columns
+   , indices_( indices, indices+n )  // The indices of the selected columns
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      if( indices[j] >= matrix.columns() )
+         throw std::invalid_argument( "Invalid column access index" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the column selection elements.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return Reference to the accessed value.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::Reference
+   DenseColumns<MT,false>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return matrix_(i,indices_[j]);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the column selection elements.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return Reference to the accessed value.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::ConstReference
+   DenseColumns<MT,false>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+   return matrix_(i,indices_[j]);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::Iterator DenseColumns<MT,false>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return Iterator( *this, i,0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::ConstIterator DenseColumns<MT,false>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return ConstIterator( *this, i,0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::ConstIterator DenseColumns<MT,false>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return ConstIterator( *this, i,0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::Iterator DenseColumns<MT,false>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return Iterator( *this, i,columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::ConstIterator DenseColumns<MT,false>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return ConstIterator( *this, i,columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::ConstIterator DenseColumns<MT,false>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid column selection row access index" );
+   return ConstIterator( *this, i,columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogenous assignment to all column selection elements.
+//
+// \param rhs Scalar value to be assigned to all column selection elements.
+// \return Reference to the assigned column selection.
+*/
+template< typename MT >  // Type of the dense matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator=( const ElementType& rhs )
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         matrix_(i,indices_[j]) = rhs;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for DenseColumns.
+//
+// \param rhs Column selection to be copied.
+// \return Reference to the assigned column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The column selection is initialized as a copy of the given column selection. In case the
+// current sizes of the two column selections don't match, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator=( const DenseColumns& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE  ( ResultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+   if( this == &rhs || ( &matrix_ == &rhs.matrix_ && indices_ == rhs.indices_ ) )
+      return *this;
+
+   if( columns() != rhs.columns() || rows() != rhs.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( rhs.canAlias( &matrix_ ) ) {
+      const ResultType tmp( rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be assigned.
+// \return Reference to the assigned column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The column selection is initialized as a copy of the given matrix. In case the current sizes
+// of the two matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( IsSparseMatrix<MT2>::value )
+      reset();
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the column selection.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the column selection.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename MT2::ResultType );
+
+   if( columns() != (~rhs).columns() || rows() != (~rhs).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const typename MT2::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the column selection.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::operator*=( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   typedef typename MultTrait<ResultType,typename MT2::ResultType>::Type  MultType;
+
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MultType );
+
+   const MultType tmp( *this * (~rhs) );
+   if( IsSparseMatrix<MultType>::value )
+      reset();
+   smpAssign( *this, tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a column selection
+//        and a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the column selection.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename Other > // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseColumns<MT,false> >::Type&
+   DenseColumns<MT,false>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a column selection by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the column selection.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename Other > // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseColumns<MT,false> >::Type&
+   DenseColumns<MT,false>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the column selection.
+//
+// \return The number of rows of the column selection.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::rows() const
+{
+   return matrix_.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of the column selection.
+//
+// \return The number of columns of the column selection.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::columns() const
+{
+   return indices_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the column selection.
+//
+// \return The capacity of the column selection.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::capacity() const
+{
+   return columns() * rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the column selection.
+//
+// \return The number of non-zero elements in the column selection.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::nonZeros() const
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         if( !isDefault( matrix_(i,indices_[j]) ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseColumns<MT,false>::reset()
+{
+   using blaze::reset;
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         reset( matrix_(i,indices_[j]) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the column selection by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the scaling.
+// \return Reference to the column selection.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename Other > // Data type of the scalar value
+inline DenseColumns<MT,false>& DenseColumns<MT,false>::scale( const Other& scalar )
+{
+   const size_t n( columns() );
+   const size_t m( rows() );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         matrix_(i,indices_[j]) *= scalar;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseColumns<MT,false>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t n( columns() );
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n; ++j )
+      if( !isDefault( matrix_(i,indices_[j]) ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseColumns<MT,false>::reset( size_t i )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t n( columns() );
+   for( size_t j=0UL; j<n; ++j )
+      reset( matrix_(i,indices_[j]) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column selection can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column selection, \a false if not.
+//
+// This function returns whether the given address can alias with the column selection. In
+// contrast to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename Other > // Data type of the foreign expression
+inline bool DenseColumns<MT,false>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( &matrix_ ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column selection is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column selection, \a false if not.
+//
+// This function returns whether the given address is aliased with the column selection. In
+// contrast to the canAlias() function this function is not allowed to use compile time
+// expressions to optimize the evaluation.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename Other > // Data type of the foreign expression
+inline bool DenseColumns<MT,false>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( &matrix_ ) == static_cast<const void*>( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column selection is properly aligned in memory.
+//
+// \return \a false since the rows of the column selection are not stored contiguously.
+//
+// Since the elements of a row of the column selection are in general scattered across the
+// according row of the underlying matrix, the column selection is never considered to be
+// properly aligned in memory.
+*/
+template< typename MT >  // Type of the dense matrix
+inline bool DenseColumns<MT,false>::isAligned() const
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column selection can be used in SMP assignments.
+//
+// \return \a true in case the column selection can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the column selection can be used in SMP assignments. In contrast
+// to the \a smpAssignable member enumeration, which is based solely on compile time information,
+// this function additionally provides runtime information (as for instance the current number
+// of columns and/or rows of the column selection).
+*/
+template< typename MT >  // Type of the dense matrix
+inline bool DenseColumns<MT,false>::canSMPAssign() const
+{
+   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function gathers a specific intrinsic element of the column selection from the according
+// row of the underlying dense matrix. In case the intrinsic element extends beyond the last
+// selected column, the remaining positions are filled with default values. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::IntrinsicType
+   DenseColumns<MT,false>::load( size_t i, size_t j ) const
+{
+   using blaze::loadu;
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t rest( columns() - j );
+
+   if( rest >= IT::size ) {
+      const ElementType* addresses[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         addresses[k] = &matrix_(i,indices_[j+k]);
+      return gather( addresses );
+   }
+   else {
+      ElementType array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( k < rest )?( matrix_(i,indices_[j+k]) ):( ElementType() );
+      return loadu( array );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function gathers a specific intrinsic element of the column selection. Since the column
+// selection is never aligned, it is identical to the load() function. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseColumns<MT,false>::IntrinsicType
+   DenseColumns<MT,false>::loadu( size_t i, size_t j ) const
+{
+   return load( i,j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the according row of the
+// underlying dense matrix. Since none of the supported instruction sets provides a scatter
+// instruction, the elements are written one by one. Elements beyond the last selected column
+// are discarded. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseColumns<MT,false>::store( size_t i, size_t j, const IntrinsicType& value )
+{
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t rest( ( columns() - j < IT::size )?( columns() - j ):( size_t( IT::size ) ) );
+
+   ElementType array[IT::size];
+   storeu( array, value );
+   for( size_t k=0UL; k<rest; ++k )
+      matrix_(i,indices_[j+k]) = array[k];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the underlying dense matrix. It is
+// identical to the store() function. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseColumns<MT,false>::storeu( size_t i, size_t j, const IntrinsicType& value )
+{
+   store( i,j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Non-temporal store of an intrinsic element of the column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the underlying dense matrix. Since
+// the elements are written one by one, it is identical to the store() function. This function
+// must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseColumns<MT,false>::stream( size_t i, size_t j, const IntrinsicType& value )
+{
+   store( i,j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedAssign<MT2> >::Type
+   DenseColumns<MT,false>::assign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jend( n & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         matrix_(i,indices_[j]) = (~rhs)(i,j);
+         matrix_(i,indices_[j+1UL]) = (~rhs)(i,j+1UL);
+      }
+      if( jend < n ) {
+         matrix_(i,indices_[jend]) = (~rhs)(i,jend);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedAssign<MT2> >::Type
+   DenseColumns<MT,false>::assign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jpos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      typename MT2::ConstIterator it( (~rhs).begin(i) );
+      for( size_t j=0UL; j<jpos; j+=IT::size, it+=IT::size ) {
+         store( i,j, it.load() );
+      }
+      for( size_t j=jpos; j<n; ++j ) {
+         matrix_(i,indices_[j]) = (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,false>::assign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) = (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::assign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::assign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedAddAssign<MT2> >::Type
+   DenseColumns<MT,false>::addAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jend( n & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         matrix_(i,indices_[j]) += (~rhs)(i,j);
+         matrix_(i,indices_[j+1UL]) += (~rhs)(i,j+1UL);
+      }
+      if( jend < n ) {
+         matrix_(i,indices_[jend]) += (~rhs)(i,jend);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the addition assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedAddAssign<MT2> >::Type
+   DenseColumns<MT,false>::addAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jpos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      typename MT2::ConstIterator it( (~rhs).begin(i) );
+      for( size_t j=0UL; j<jpos; j+=IT::size, it+=IT::size ) {
+         store( i,j, load( i,j ) + it.load() );
+      }
+      for( size_t j=jpos; j<n; ++j ) {
+         matrix_(i,indices_[j]) += (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,false>::addAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) += (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::addAssign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::addAssign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename DisableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedSubAssign<MT2> >::Type
+   DenseColumns<MT,false>::subAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jend( n & size_t(-2) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % 2UL ) ) == jend, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<jend; j+=2UL ) {
+         matrix_(i,indices_[j]) -= (~rhs)(i,j);
+         matrix_(i,indices_[j+1UL]) -= (~rhs)(i,j+1UL);
+      }
+      if( jend < n ) {
+         matrix_(i,indices_[jend]) -= (~rhs)(i,jend);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline typename EnableIf< typename DenseColumns<MT,false>::BLAZE_TEMPLATE VectorizedSubAssign<MT2> >::Type
+   DenseColumns<MT,false>::subAssign( const DenseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t jpos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      typename MT2::ConstIterator it( (~rhs).begin(i) );
+      for( size_t j=0UL; j<jpos; j+=IT::size, it+=IT::size ) {
+         store( i,j, load( i,j ) - it.load() );
+      }
+      for( size_t j=jpos; j<n; ++j ) {
+         matrix_(i,indices_[j]) -= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side dense matrix
+inline void DenseColumns<MT,false>::subAssign( const DenseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   const size_t n( columns() );
+   const size_t m( rows() );
+   const size_t block( 16UL );
+
+   for( size_t jj=0UL; jj<n; jj+=block ) {
+      const size_t jend( ( n<(jj+block) )?( n ):( jj+block ) );
+      for( size_t ii=0UL; ii<m; ii+=block ) {
+         const size_t iend( ( m<(ii+block) )?( m ):( ii+block ) );
+         for( size_t j=jj; j<jend; ++j ) {
+            for( size_t i=ii; i<iend; ++i ) {
+               matrix_(i,indices_[j]) -= (~rhs)(i,j);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a row-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::subAssign( const SparseMatrix<MT2,rowMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t i=0UL; i<rows(); ++i )
+      for( typename MT2::ConstIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+         matrix_(i,indices_[element->index()]) -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a column-major sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Type of the right-hand side sparse matrix
+inline void DenseColumns<MT,false>::subAssign( const SparseMatrix<MT2,columnMajor>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( columns()    == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( rows() == (~rhs).rows()         , "Invalid number of rows"    );
+
+   for( size_t j=0UL; j<columns(); ++j )
+      for( typename MT2::ConstIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+         matrix_(element->index(),indices_[j]) -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DENSECOLUMNS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DenseColumns operators */
+//@{
+template< typename MT, bool SO >
+inline void reset( DenseColumns<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline void clear( DenseColumns<MT,SO>& dm );
+
+template< typename MT, bool SO >
+inline bool isDefault( const DenseColumns<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given column selection.
+// \ingroup dense_columns
+//
+// \param dm The column selection to be resetted.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void reset( DenseColumns<MT,SO>& dm )
+{
+   dm.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given column selection.
+// \ingroup dense_columns
+//
+// \param dm The column selection to be cleared.
+// \return void
+//
+// Clearing a column selection is equivalent to resetting it via the reset() function.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline void clear( DenseColumns<MT,SO>& dm )
+{
+   dm.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given column selection is in default state.
+// \ingroup dense_columns
+//
+// \param dm The column selection to be tested for its default state.
+// \return \a true in case the given column selection is component-wise zero, \a false otherwise.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline bool isDefault( const DenseColumns<MT,SO>& dm )
+{
+   using blaze::isDefault;
+
+   for( size_t j=0UL; j<dm.columns(); ++j )
+      for( size_t i=0UL; i<dm.rows(); ++i )
+         if( !isDefault( dm(i,j) ) )
+            return false;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of columns of the given dense matrix.
+// \ingroup views
+//
+// \param dm The dense matrix containing the columns.
+// \param indices The indices of the selected columns.
+// \return View on the selected columns of the matrix.
+// \exception std::invalid_argument Invalid column access index.
+//
+// This function returns an expression representing the selected columns of the given dense
+// matrix. The indices may be given in arbitrary order and may contain duplicates:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 100UL, 20UL );
+   // ... Initialization
+
+   std::vector<size_t> indices( 3UL );
+   indices[0] = 99UL;
+   indices[1] =  0UL;
+   indices[2] = 42UL;
+
+   // Creating a view on the columns 99, 0, and 42 of A
+   blaze::DenseColumns< blaze::DynamicMatrix<double,blaze::columnMajor> > r = columns( A, indices );
+   \endcode
+
+// In case any of the given indices is not smaller than the number of columns of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DisableIf< Or< IsComputation<MT>, IsTransExpr<MT> >, DenseColumns<MT> >::Type
+   columns( DenseMatrix<MT,SO>& dm, const std::vector<size_t>& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseColumns<MT>( ~dm, ( indices.empty() )?( NULL ):( &indices[0] ), indices.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of columns of the given constant dense matrix.
+// \ingroup views
+//
+// \param dm The constant dense matrix containing the columns.
+// \param indices The indices of the selected columns.
+// \return View on the selected columns of the matrix.
+// \exception std::invalid_argument Invalid column access index.
+//
+// This function returns an expression representing the selected columns of the given constant
+// dense matrix. In case any of the given indices is not smaller than the number of columns of
+// the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DisableIf< Or< IsComputation<MT>, IsTransExpr<MT> >, DenseColumns<const MT> >::Type
+   columns( const DenseMatrix<MT,SO>& dm, const std::vector<size_t>& indices )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseColumns<const MT>( ~dm, ( indices.empty() )?( NULL ):( &indices[0] ), indices.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of columns of the given dense matrix.
+// \ingroup views
+//
+// \param dm The dense matrix containing the columns.
+// \param indices Pointer to the first index of the selected columns.
+// \param n The number of selected columns.
+// \return View on the selected columns of the matrix.
+// \exception std::invalid_argument Invalid column access index.
+//
+// This function returns an expression representing the \a n columns of the given dense matrix
+// specified by the array \a indices. In case any of the given indices is not smaller than the
+// number of columns of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DisableIf< Or< IsComputation<MT>, IsTransExpr<MT> >, DenseColumns<MT> >::Type
+   columns( DenseMatrix<MT,SO>& dm, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseColumns<MT>( ~dm, indices, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a selection of columns of the given constant dense matrix.
+// \ingroup views
+//
+// \param dm The constant dense matrix containing the columns.
+// \param indices Pointer to the first index of the selected columns.
+// \param n The number of selected columns.
+// \return View on the selected columns of the matrix.
+// \exception std::invalid_argument Invalid column access index.
+//
+// This function returns an expression representing the \a n columns of the given constant dense
+// matrix specified by the array \a indices. In case any of the given indices is not smaller
+// than the number of columns of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename DisableIf< Or< IsComputation<MT>, IsTransExpr<MT> >, DenseColumns<const MT> >::Type
+   columns( const DenseMatrix<MT,SO>& dm, const size_t* indices, size_t n )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseColumns<const MT>( ~dm, indices, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct SubmatrixTrait< DenseColumns<MT,SO> >
+{
+   typedef typename SubmatrixTrait< typename DenseColumns<MT,SO>::ResultType >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct ColumnTrait< DenseColumns<MT,SO> >
+{
+   typedef typename ColumnTrait< typename DenseColumns<MT,SO>::ResultType >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct RowTrait< DenseColumns<MT,SO> >
+{
+   typedef typename RowTrait< typename DenseColumns<MT,SO>::ResultType >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
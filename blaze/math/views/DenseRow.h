@@ -1150,7 +1150,7 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline bool DenseRow<MT,SO>::canSMPAssign() const
 {
-   return ( size() > OPENMP_DVECASSIGN_THRESHOLD );
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -2737,7 +2737,7 @@ inline bool DenseRow<MT,false>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseRow<MT,false>::canSMPAssign() const
 {
-   return ( size() > OPENMP_DVECASSIGN_THRESHOLD );
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
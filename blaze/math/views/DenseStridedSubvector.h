@@ -0,0 +1,2050 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/DenseStridedSubvector.h
+//  \brief Header file for the DenseStridedSubvector class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_DENSESTRIDEDSUBVECTOR_H_
+#define _BLAZE_MATH_VIEWS_DENSESTRIDEDSUBVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransExpr.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsRowVector.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsTransExpr.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dense_strided_subvector DenseStridedSubvector
+// \ingroup views
+*/
+//*************************************************************************************************
+/*!\brief View on a strided subvector of a dense vector.
+// \ingroup dense_strided_subvector
+//
+// The DenseStridedSubvector template represents a view on every \a stride-th element of a dense
+// vector primitive, starting at a given index. The type of the dense vector is specified via the
+// first template parameter:
+
+   \code
+   template< typename VT, bool TF >
+   class DenseStridedSubvector;
+   \endcode
+
+//  - VT: specifies the type of the dense vector primitive. DenseStridedSubvector can be used
+//        with every dense vector primitive, but does not work with any vector expression type.
+//  - TF: specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//        vector (\a blaze::columnVector). This template parameter doesn't have to be explicitly
+//        defined, but is automatically derived from the first template parameter.
+//
+//
+// \n \section dense_strided_subvector_setup Setup of Strided Subvectors
+//
+// A strided subvector is created via the \c subvector() function, which in addition to the
+// index of the first element and the number of elements takes the distance between two
+// consecutive elements. A negative stride traverses the vector backwards. The \c reverse()
+// function creates a strided subvector that traverses the complete vector in reverse order:
+
+   \code
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VectorType;
+
+   VectorType x( 100UL ), y;
+   // ... Initialization
+
+   // Creating a vector from the 50 elements with even index
+   y = subvector( x, 0UL, 50UL, 2L );
+
+   // Setting the 50 elements with odd index, starting with the last one
+   subvector( x, 99UL, 50UL, -2L ) = y;
+
+   // Reversing the order of the elements of x
+   x = reverse( x );
+   \endcode
+
+// In case the given stride is zero or the specified elements are not within the bounds of the
+// vector, a \a std::invalid_argument exception is thrown.
+//
+//
+// \n \section dense_strided_subvector_performance Performance
+//
+// A strided subvector is never considered to be aligned. Within vectorized expressions the
+// elements are loaded via gather operations, which on AVX2 platforms map to the according gather
+// instructions. Since AVX2 doesn't offer scatter instructions, stores are performed element by
+// element. Note that the iterators of a strided subvector refer to the subvector itself and are
+// therefore only valid as long as the subvector exists.
+*/
+template< typename VT                         // Type of the dense vector
+        , bool TF = IsRowVector<VT>::value >  // Transpose flag
+class DenseStridedSubvector : public DenseVector< DenseStridedSubvector<VT,TF>, TF >
+                            , private View
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense vector expression.
+   typedef typename SelectType< IsExpression<VT>::value, VT, VT& >::Type  Operand;
+
+   //! Intrinsic trait for the strided subvector element type.
+   typedef IntrinsicTrait<typename VT::ElementType>  IT;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the non-const reference and iterator types.
+   /*! The \a useConst compile time constant expression represents a compilation switch for
+       the non-const reference and iterator types. In case the given dense vector of type
+       \a VT is const qualified, \a useConst will be set to 1 and the strided subvector will return
+       references and iterators to const. Otherwise \a useConst will be set to 0 and the
+       strided subvector will offer write access to the dense vector elements both via the subscript
+       operator and iterators. */
+   enum { useConst = IsConst<VT>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef DenseStridedSubvector<VT,TF>        This;           //!< Type of this DenseStridedSubvector instance.
+   typedef typename SubvectorTrait<VT>::Type   ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename VT::ElementType            ElementType;    //!< Type of the strided subvector elements.
+   typedef typename IT::Type                   IntrinsicType;  //!< Intrinsic type of the strided subvector elements.
+   typedef typename VT::ReturnType             ReturnType;     //!< Return type for expression template evaluations
+   typedef const DenseStridedSubvector&        CompositeType;  //!< Data type for composite expression templates.
+
+   //! Reference to a constant strided subvector value.
+   typedef typename VT::ConstReference  ConstReference;
+
+   //! Reference to a non-constant strided subvector value.
+   typedef typename SelectType< useConst, ConstReference, typename VT::Reference >::Type  Reference;
+   //**********************************************************************************************
+
+   //**StridedIterator class definition************************************************************
+   /*!\brief Iterator over the elements of the strided subvector.
+   //
+   // The iterator refers to the strided subvector itself. Therefore it is only valid as long as the
+   // strided subvector it has been created from.
+   */
+   template< typename ViewType >  // Type of the strided subvector
+   class StridedIterator
+   {
+    private:
+      //*******************************************************************************************
+      //! Compilation switch for the return type of the value member function.
+      /*! The \a returnConst compile time constant expression represents a compilation switch for
+          the return type of the member access operators. In case the given view type \a ViewType
+          is const qualified, \a returnConst will be set to 1 and the member access operators will
+          return a reference to const. Otherwise \a returnConst will be set to 0 and the member
+          access operators will offer write access to the dense vector elements. */
+      enum { returnConst = IsConst<ViewType>::value };
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      //! Return type for the access to the value of a dense element.
+      typedef typename SelectType< returnConst, typename VT::ConstReference, typename VT::Reference >::Type  Reference;
+
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef RemoveReference<Reference>       ValueType;         //!< Type of the underlying elements.
+      typedef ValueType*                       PointerType;       //!< Pointer return type.
+      typedef Reference                        ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the StridedIterator class.
+      //
+      // \param view The strided subvector to be traversed.
+      // \param index The index of the current element.
+      */
+      inline StridedIterator( ViewType& view, size_t index )
+         : view_ ( &view )  // The traversed strided subvector.
+         , index_( index )  // The index of the current element.
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different StridedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ViewType2 >
+      inline StridedIterator( const StridedIterator<ViewType2>& it )
+         : view_ ( it.view_  )  // The traversed strided subvector.
+         , index_( it.index_ )  // The index of the current element.
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline StridedIterator& operator+=( size_t inc ) {
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline StridedIterator& operator-=( size_t dec ) {
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline StridedIterator& operator++() {
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const StridedIterator operator++( int ) {
+         const StridedIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline StridedIterator& operator--() {
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const StridedIterator operator--( int ) {
+         const StridedIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the elements of the strided subvector.
+      //
+      // \param index Access index.
+      // \return Reference to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*view_)[index_+index];
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference to the current value.
+      */
+      inline ReferenceType operator*() const {
+         return (*view_)[index_];
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the element at the current iterator position.
+      */
+      inline PointerType operator->() const {
+         return &(*view_)[index_];
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Aligned load of an intrinsic element of the strided subvector.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function performs a load of the current intrinsic element of the strided subvector. This
+      // function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      inline IntrinsicType load() const {
+         return view_->load( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of an intrinsic element of the strided subvector.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function performs an unaligned load of the current intrinsic element of the
+      // strided subvector. This function must \b NOT be called explicitly! It is used internally for
+      // the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      inline IntrinsicType loadu() const {
+         return view_->loadu( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator==( const StridedIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( index_ == rhs.index_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ViewType2 >
+      inline bool operator!=( const StridedIterator<ViewType2>& rhs ) const {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator<( const StridedIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( index_ < rhs.index_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator>( const StridedIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( index_ > rhs.index_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator<=( const StridedIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( index_ <= rhs.index_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename ViewType2 >
+      inline bool operator>=( const StridedIterator<ViewType2>& rhs ) const {
+         return ( view_ == rhs.view_ ) && ( index_ >= rhs.index_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const StridedIterator& rhs ) const {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a StridedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const StridedIterator operator+( const StridedIterator& it, size_t inc ) {
+         return StridedIterator( *it.view_, it.index_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a StridedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const StridedIterator operator+( size_t inc, const StridedIterator& it ) {
+         return StridedIterator( *it.view_, it.index_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a StridedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const StridedIterator operator-( const StridedIterator& it, size_t dec ) {
+         return StridedIterator( *it.view_, it.index_-dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ViewType* view_;   //!< The traversed strided subvector.
+      size_t    index_;  //!< The index of the current element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename ViewType2 > friend class StridedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over constant elements.
+   typedef StridedIterator<const This>  ConstIterator;
+
+   //! Iterator over non-constant elements.
+   typedef typename SelectType< useConst, ConstIterator, StridedIterator<This> >::Type  Iterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum { vectorizable = VT::vectorizable };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum { smpAssignable = VT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DenseStridedSubvector( VT& vector, size_t index, size_t n, ptrdiff_t stride );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                            inline DenseStridedSubvector& operator= ( const ElementType& rhs );
+                            inline DenseStridedSubvector& operator= ( const DenseStridedSubvector& rhs );
+   template< typename VT2 > inline DenseStridedSubvector& operator= ( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline DenseStridedSubvector& operator+=( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline DenseStridedSubvector& operator-=( const Vector<VT2,TF>& rhs );
+   template< typename VT2 > inline DenseStridedSubvector& operator*=( const Vector<VT2,TF>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseStridedSubvector >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, DenseStridedSubvector >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 size() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 nonZeros() const;
+                              inline void                   reset();
+   template< typename Other > inline DenseStridedSubvector& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedAssign {
+      enum { value = vectorizable && VT2::vectorizable &&
+                     IsSame<ElementType,typename VT2::ElementType>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedAddAssign {
+      enum { value = vectorizable && VT2::vectorizable &&
+                     IsSame<ElementType,typename VT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::addition };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedSubAssign {
+      enum { value = vectorizable && VT2::vectorizable &&
+                     IsSame<ElementType,typename VT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::subtraction };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT2 >
+   struct VectorizedMultAssign {
+      enum { value = vectorizable && VT2::vectorizable &&
+                     IsSame<ElementType,typename VT2::ElementType>::value &&
+                     IntrinsicTrait<ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+
+   inline IntrinsicType load  ( size_t index ) const;
+   inline IntrinsicType loadu ( size_t index ) const;
+   inline void          store ( size_t index, const IntrinsicType& value );
+   inline void          storeu( size_t index, const IntrinsicType& value );
+   inline void          stream( size_t index, const IntrinsicType& value );
+
+   template< typename VT2 >
+   inline typename DisableIf< VectorizedAssign<VT2> >::Type
+      assign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename EnableIf< VectorizedAssign<VT2> >::Type
+      assign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void assign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename DisableIf< VectorizedAddAssign<VT2> >::Type
+      addAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename EnableIf< VectorizedAddAssign<VT2> >::Type
+      addAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void addAssign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename DisableIf< VectorizedSubAssign<VT2> >::Type
+      subAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename EnableIf< VectorizedSubAssign<VT2> >::Type
+      subAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void subAssign( const SparseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename DisableIf< VectorizedMultAssign<VT2> >::Type
+      multAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 >
+   inline typename EnableIf< VectorizedMultAssign<VT2> >::Type
+      multAssign( const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT2 > inline void multAssign( const SparseVector<VT2,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand         vector_;  //!< The dense vector containing the strided subvector.
+   const size_t    offset_;  //!< The index of the first element of the subvector.
+   const size_t    size_;    //!< The number of elements of the subvector.
+   const ptrdiff_t stride_;  //!< The distance between two consecutive elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE   ( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_TRANSEXPR_TYPE  ( VT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for DenseStridedSubvector.
+//
+// \param vector The dense vector containing the strided subvector.
+// \param index The index of the first element of the subvector.
+// \param n The number of elements of the subvector.
+// \param stride The distance between two consecutive elements of the subvector.
+// \exception std::invalid_argument Invalid subvector stride.
+// \exception std::invalid_argument Invalid subvector specification.
+//
+// In case the given stride is zero or the specified elements are not within the bounds of the
+// given vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline DenseStridedSubvector<VT,TF>::DenseStridedSubvector( VT& vector, size_t index, size_t n, ptrdiff_t stride )
+   : vector_( vector )  // The dense vector containing the strided subvector
+   , offset_( index  )  // The index of the first element of the subvector
+   , size_  ( n      )  // The number of elements of the subvector
+   , stride_( stride )  // The distance between two consecutive elements
+{
+   if( stride == 0L )
+      throw std::invalid_argument( "Invalid subvector stride" );
+
+   if( n > 0UL ) {
+      const ptrdiff_t last( ptrdiff_t( index ) + ptrdiff_t( n-1UL )*stride );
+      if( vector_.size() <= index || last < 0L || vector_.size() <= size_t( last ) )
+         throw std::invalid_argument( "Invalid subvector specification" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the strided subvector elements.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \return Reference to the accessed value.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::Reference DenseStridedSubvector<VT,TF>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid strided subvector access index" );
+   return vector_[offset_+index*stride_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the strided subvector elements.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \return Reference to the accessed value.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::ConstReference DenseStridedSubvector<VT,TF>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid strided subvector access index" );
+   return vector_[offset_+index*stride_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided subvector.
+//
+// \return Iterator to the first element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::Iterator DenseStridedSubvector<VT,TF>::begin()
+{
+   return Iterator( *this, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided subvector.
+//
+// \return Iterator to the first element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::ConstIterator DenseStridedSubvector<VT,TF>::begin() const
+{
+   return ConstIterator( *this, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of the strided subvector.
+//
+// \return Iterator to the first element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::ConstIterator DenseStridedSubvector<VT,TF>::cbegin() const
+{
+   return ConstIterator( *this, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided subvector.
+//
+// \return Iterator just past the last element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::Iterator DenseStridedSubvector<VT,TF>::end()
+{
+   return Iterator( *this, size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided subvector.
+//
+// \return Iterator just past the last element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::ConstIterator DenseStridedSubvector<VT,TF>::end() const
+{
+   return ConstIterator( *this, size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of the strided subvector.
+//
+// \return Iterator just past the last element of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::ConstIterator DenseStridedSubvector<VT,TF>::cend() const
+{
+   return ConstIterator( *this, size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all strided subvector elements.
+//
+// \param rhs Scalar value to be assigned to all strided subvector elements.
+// \return Reference to the assigned strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator=( const ElementType& rhs )
+{
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] = rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DenseStridedSubvector.
+//
+// \param rhs The strided subvector to be copied.
+// \return Reference to the assigned strided subvector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two views don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator=( const DenseStridedSubvector& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE  ( ResultType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+   if( &rhs == this || ( &vector_ == &rhs.vector_ && offset_ == rhs.offset_ && stride_ == rhs.stride_ ) )
+      return *this;
+
+   if( size() != rhs.size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( rhs.canAlias( &vector_ ) ) {
+      const ResultType tmp( rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be assigned.
+// \return Reference to the assigned strided subvector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( typename VT2::ResultType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename VT2::ResultType );
+
+   if( size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const typename VT2::ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      if( IsSparseVector<VT2>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the strided subvector.
+// \return Reference to the assigned strided subvector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator+=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( typename VT2::ResultType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename VT2::ResultType );
+
+   if( size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const typename VT2::ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the strided subvector.
+// \return Reference to the assigned strided subvector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator-=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( typename VT2::ResultType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename VT2::ResultType );
+
+   if( size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( &vector_ ) ) {
+      const typename VT2::ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the strided subvector.
+// \return Reference to the assigned strided subvector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side vector
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::operator*=( const Vector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( typename VT2::ResultType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( typename VT2::ResultType );
+
+   if( size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).canAlias( &vector_ ) || IsSparseVector<VT2>::value ) {
+      const typename VT2::ResultType tmp( ~rhs );
+      smpMultAssign( *this, tmp );
+   }
+   else {
+      smpMultAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a vector and
+//        a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the assigned strided subvector.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseStridedSubvector<VT,TF> >::Type&
+   DenseStridedSubvector<VT,TF>::operator*=( Other rhs )
+{
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a vector by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the assigned strided subvector.
+//
+// \b Note: A division by zero is only checked by an user assert.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, DenseStridedSubvector<VT,TF> >::Type&
+   DenseStridedSubvector<VT,TF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<ElementType,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   const size_t n( size() );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<n; ++i )
+         vector_[offset_+i*stride_] *= tmp;
+   }
+   else {
+      for( size_t i=0UL; i<n; ++i )
+         vector_[offset_+i*stride_] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the strided subvector.
+//
+// \return The size of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t DenseStridedSubvector<VT,TF>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the strided subvector.
+//
+// \return The capacity of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t DenseStridedSubvector<VT,TF>::capacity() const
+{
+   return size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the strided subvector.
+//
+// \return The number of non-zero elements in the strided subvector.
+//
+// Note that the number of non-zero elements is always less than or equal to the current size
+// of the strided subvector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t DenseStridedSubvector<VT,TF>::nonZeros() const
+{
+   const size_t n( size() );
+   size_t nonzeros( 0 );
+
+   for( size_t i=0UL; i<n; ++i )
+      if( !isDefault( vector_[offset_+i*stride_] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void DenseStridedSubvector<VT,TF>::reset()
+{
+   using blaze::reset;
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      reset( vector_[offset_+i*stride_] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the strided subvector by the scalar value \a scalar (\f$ \vec{a}*=s \f$).
+//
+// \param scalar The scalar value for the scaling.
+// \return Reference to the strided subvector.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the scalar value
+inline DenseStridedSubvector<VT,TF>& DenseStridedSubvector<VT,TF>::scale( const Other& scalar )
+{
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the strided subvector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this strided subvector, \a false if not.
+//
+// This function returns whether the given address can alias with the strided subvector. In
+// contrast to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool DenseStridedSubvector<VT,TF>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( &vector_ ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the strided subvector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this strided subvector, \a false if not.
+//
+// This function returns whether the given address is aliased with the strided subvector. In
+// contrast to the canAlias() function this function is not allowed to use compile time
+// expressions to optimize the evaluation.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF >         // Transpose flag
+template< typename Other >  // Data type of the foreign expression
+inline bool DenseStridedSubvector<VT,TF>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( &vector_ ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the strided subvector is properly aligned in memory.
+//
+// \return \a false since the elements of the strided subvector are not stored contiguously.
+//
+// Since the elements of a strided subvector are in general scattered across the underlying dense
+// vector, the strided subvector is never considered to be properly aligned in memory.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool DenseStridedSubvector<VT,TF>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the strided subvector can be used in SMP assignments.
+//
+// \return \a true in case the strided subvector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the strided subvector can be used in SMP assignments. In contrast
+// to the \a smpAssignable member enumeration, which is based solely on compile time information,
+// this function additionally provides runtime information (as for instance the current size
+// of the strided subvector).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool DenseStridedSubvector<VT,TF>::canSMPAssign() const
+{
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of an intrinsic element of the strided subvector.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \return The loaded intrinsic element.
+//
+// This function gathers a specific intrinsic element of the strided subvector from the underlying
+// dense vector. In case the intrinsic element extends beyond the end of the strided subvector,
+// the remaining positions are filled with default values. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::IntrinsicType DenseStridedSubvector<VT,TF>::load( size_t index ) const
+{
+   using blaze::loadu;
+
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid strided subvector access index" );
+
+   const size_t rest( size() - index );
+
+   if( rest >= IT::size ) {
+      const ElementType* addresses[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         addresses[k] = &vector_[offset_+(index+k)*stride_];
+      return gather( addresses );
+   }
+   else {
+      ElementType array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( k < rest )?( vector_[offset_+(index+k)*stride_] ):( ElementType() );
+      return loadu( array );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of an intrinsic element of the strided subvector.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \return The loaded intrinsic element.
+//
+// This function gathers a specific intrinsic element of the strided subvector from the underlying
+// dense vector. Since the strided subvector is never aligned, it is identical to the load()
+// function. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DenseStridedSubvector<VT,TF>::IntrinsicType DenseStridedSubvector<VT,TF>::loadu( size_t index ) const
+{
+   return load( index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Store of an intrinsic element of the strided subvector.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the underlying dense vector. Since
+// none of the supported instruction sets provides a scatter instruction, the elements are
+// written one by one. Elements beyond the end of the strided subvector are discarded. This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void DenseStridedSubvector<VT,TF>::store( size_t index, const IntrinsicType& value )
+{
+   using blaze::storeu;
+
+   BLAZE_INTERNAL_ASSERT( index < size(), "Invalid strided subvector access index" );
+
+   const size_t rest( ( size() - index < IT::size )?( size() - index ):( size_t( IT::size ) ) );
+
+   ElementType array[IT::size];
+   storeu( array, value );
+   for( size_t k=0UL; k<rest; ++k )
+      vector_[offset_+(index+k)*stride_] = array[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of an intrinsic element of the strided subvector.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the underlying dense vector. It is
+// identical to the store() function. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void DenseStridedSubvector<VT,TF>::storeu( size_t index, const IntrinsicType& value )
+{
+   store( index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Non-temporal store of an intrinsic element of the strided subvector.
+//
+// \param index Access index. The index must be smaller than the number of strided subvector
+//              elements.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function scatters a specific intrinsic element into the underlying dense vector. Since
+// the elements are written one by one, it is identical to the store() function. This function
+// must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void DenseStridedSubvector<VT,TF>::stream( size_t index, const IntrinsicType& value )
+{
+   store( index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::assign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] = (~rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::assign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   typename VT2::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size, it+=IT::size ) {
+      store( i, it.load() );
+   }
+   for( size_t i=ipos; i<n; ++i ) {
+      vector_[offset_+i*stride_] = (~rhs)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void DenseStridedSubvector<VT,TF>::assign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT2::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[offset_+element->index()*stride_] = element->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::addAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] += (~rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedAddAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::addAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   typename VT2::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) + it.load() );
+   }
+   for( size_t i=ipos; i<n; ++i ) {
+      vector_[offset_+i*stride_] += (~rhs)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void DenseStridedSubvector<VT,TF>::addAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT2::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[offset_+element->index()*stride_] += element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::subAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] -= (~rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedSubAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::subAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   typename VT2::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) - it.load() );
+   }
+   for( size_t i=ipos; i<n; ++i ) {
+      vector_[offset_+i*stride_] -= (~rhs)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void DenseStridedSubvector<VT,TF>::subAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( typename VT2::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[offset_+element->index()*stride_] -= element->value();
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename DisableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::multAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      vector_[offset_+i*stride_] *= (~rhs)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Intrinsic optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side dense vector
+inline typename EnableIf< typename DenseStridedSubvector<VT,TF>::BLAZE_TEMPLATE VectorizedMultAssign<VT2> >::Type
+   DenseStridedSubvector<VT,TF>::multAssign( const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   const size_t n( size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   typename VT2::ConstIterator it( (~rhs).begin() );
+   for( size_t i=0UL; i<ipos; i+=IT::size, it+=IT::size ) {
+      store( i, load(i) * it.load() );
+   }
+   for( size_t i=ipos; i<n; ++i ) {
+      vector_[offset_+i*stride_] *= (~rhs)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT     // Type of the dense vector
+        , bool TF >       // Transpose flag
+template< typename VT2 >  // Type of the right-hand side sparse vector
+inline void DenseStridedSubvector<VT,TF>::multAssign( const SparseVector<VT2,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const ResultType tmp( *this );
+
+   reset();
+
+   for( typename VT2::ConstIterator element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      vector_[offset_+element->index()*stride_] = tmp[element->index()] * element->value();
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  DENSESTRIDEDSUBVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DenseStridedSubvector operators */
+//@{
+template< typename VT, bool TF >
+inline void reset( DenseStridedSubvector<VT,TF>& view );
+
+template< typename VT, bool TF >
+inline void clear( DenseStridedSubvector<VT,TF>& view );
+
+template< typename VT, bool TF >
+inline bool isDefault( const DenseStridedSubvector<VT,TF>& view );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given strided subvector.
+// \ingroup dense_strided_subvector
+//
+// \param view The strided subvector to be resetted.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void reset( DenseStridedSubvector<VT,TF>& view )
+{
+   view.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given strided subvector.
+// \ingroup dense_strided_subvector
+//
+// \param view The strided subvector to be cleared.
+// \return void
+//
+// Clearing a strided subvector is equivalent to resetting it via the reset() function.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline void clear( DenseStridedSubvector<VT,TF>& view )
+{
+   view.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given strided subvector is in default state.
+// \ingroup dense_strided_subvector
+//
+// \param view The strided subvector to be tested for its default state.
+// \return \a true in case the given strided subvector is component-wise zero, \a false otherwise.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline bool isDefault( const DenseStridedSubvector<VT,TF>& view )
+{
+   for( size_t i=0UL; i<view.size(); ++i )
+      if( !isDefault( view[i] ) ) return false;
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a strided subvector of the given dense vector.
+// \ingroup views
+//
+// \param vector The dense vector containing the subvector.
+// \param index The index of the first element of the subvector.
+// \param size The number of elements of the subvector.
+// \param stride The distance between two consecutive elements of the subvector.
+// \return View on the strided subvector of the vector.
+// \exception std::invalid_argument Invalid subvector stride.
+// \exception std::invalid_argument Invalid subvector specification.
+//
+// This function returns an expression representing the \a size elements of the given dense
+// vector starting at \a index and advancing by \a stride elements. A negative stride traverses
+// the vector backwards:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> x( 100UL );
+   // ... Initialization
+
+   // Creating a view on the elements 10, 13, 16, ..., 37 of x
+   blaze::DenseStridedSubvector< blaze::DynamicVector<double,blaze::columnVector> > s1 = subvector( x, 10UL, 10UL, 3L );
+
+   // Creating a view on the elements 99, 98, ..., 90 of x
+   blaze::DenseStridedSubvector< blaze::DynamicVector<double,blaze::columnVector> > s2 = subvector( x, 99UL, 10UL, -1L );
+   \endcode
+
+// In case the given stride is zero or the specified elements are not within the bounds of the
+// vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DisableIf< Or< IsComputation<VT>, IsTransExpr<VT> >, DenseStridedSubvector<VT> >::Type
+   subvector( DenseVector<VT,TF>& vector, size_t index, size_t size, ptrdiff_t stride )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseStridedSubvector<VT>( ~vector, index, size, stride );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a strided subvector of the given constant dense vector.
+// \ingroup views
+//
+// \param vector The constant dense vector containing the subvector.
+// \param index The index of the first element of the subvector.
+// \param size The number of elements of the subvector.
+// \param stride The distance between two consecutive elements of the subvector.
+// \return View on the strided subvector of the vector.
+// \exception std::invalid_argument Invalid subvector stride.
+// \exception std::invalid_argument Invalid subvector specification.
+//
+// This function returns an expression representing the \a size elements of the given constant
+// dense vector starting at \a index and advancing by \a stride elements. In case the given
+// stride is zero or the specified elements are not within the bounds of the vector, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DisableIf< Or< IsComputation<VT>, IsTransExpr<VT> >, DenseStridedSubvector<const VT> >::Type
+   subvector( const DenseVector<VT,TF>& vector, size_t index, size_t size, ptrdiff_t stride )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseStridedSubvector<const VT>( ~vector, index, size, stride );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on the elements of the given dense vector in reverse order.
+// \ingroup views
+//
+// \param vector The dense vector to be reversed.
+// \return View on the elements of the vector in reverse order.
+//
+// This function returns an expression representing the elements of the given dense vector in
+// reverse order. It is equivalent to a strided subvector with stride -1, which starts at the
+// last element of the vector:
+
+   \code
+   blaze::DynamicVector<double,blaze::columnVector> x( 100UL ), y;
+   // ... Initialization
+
+   y = reverse( x );  // Equivalent to y = subvector( x, 99UL, 100UL, -1L );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DisableIf< Or< IsComputation<VT>, IsTransExpr<VT> >, DenseStridedSubvector<VT> >::Type
+   reverse( DenseVector<VT,TF>& vector )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseStridedSubvector<VT>( ~vector, (~vector).size()-1UL, (~vector).size(), -1L );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on the elements of the given constant dense vector in reverse order.
+// \ingroup views
+//
+// \param vector The constant dense vector to be reversed.
+// \return View on the elements of the vector in reverse order.
+//
+// This function returns an expression representing the elements of the given constant dense
+// vector in reverse order. It is equivalent to a strided subvector with stride -1, which starts
+// at the last element of the vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename DisableIf< Or< IsComputation<VT>, IsTransExpr<VT> >, DenseStridedSubvector<const VT> >::Type
+   reverse( const DenseVector<VT,TF>& vector )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return DenseStridedSubvector<const VT>( ~vector, (~vector).size()-1UL, (~vector).size(), -1L );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF >
+struct SubvectorTrait< DenseStridedSubvector<VT,TF> >
+{
+   typedef typename SubvectorTrait< typename DenseStridedSubvector<VT,TF>::ResultType >::Type  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
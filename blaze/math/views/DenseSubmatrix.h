@@ -583,10 +583,10 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
             return iterator_.loadu();
          }
          else {
-            IntrinsicType value;
-            for( size_t j=0UL; j<rest_; ++j )
-               value[j] = *(iterator_+j);
-            return value;
+            ElementType array[IT::size];
+            for( size_t j=0UL; j<IT::size; ++j )
+               array[j] = ( j < rest_ )?( *(iterator_+j) ):( ElementType() );
+            return blaze::loadu( array );
          }
       }
       //*******************************************************************************************
@@ -1766,7 +1766,7 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline bool DenseSubmatrix<MT,AF,SO>::canSMPAssign() const
 {
-   return ( rows() > OPENMP_DMATASSIGN_THRESHOLD );
+   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -1830,10 +1830,10 @@ inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      IntrinsicType value;
-      for( size_t k=0UL; k<rest_; ++k )
-         value[k] = matrix_(row_+i,column_+j+k);
-      return value;
+      ElementType array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( k < rest_ )?( matrix_(row_+i,column_+j+k) ):( ElementType() );
+      return blaze::loadu( array );
    }
 }
 //*************************************************************************************************
@@ -1896,8 +1896,10 @@ inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const Intrinsi
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
+      ElementType array[IT::size];
+      blaze::storeu( array, value );
       for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i,column_+j+k) = value[k];
+         matrix_(row_+i,column_+j+k) = array[k];
    }
 }
 //*************************************************************************************************
@@ -2675,10 +2677,10 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
             return iterator_.loadu();
          }
          else {
-            IntrinsicType value;
-            for( size_t j=0UL; j<rest_; ++j )
-               value[j] = *(iterator_+j);
-            return value;
+            ElementType array[IT::size];
+            for( size_t j=0UL; j<IT::size; ++j )
+               array[j] = ( j < rest_ )?( *(iterator_+j) ):( ElementType() );
+            return blaze::loadu( array );
          }
       }
       //*******************************************************************************************
@@ -3810,7 +3812,7 @@ inline bool DenseSubmatrix<MT,unaligned,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,unaligned,true>::canSMPAssign() const
 {
-   return ( columns() > OPENMP_DMATASSIGN_THRESHOLD );
+   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3872,10 +3874,10 @@ inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      IntrinsicType value;
-      for( size_t k=0UL; k<rest_; ++k )
-         value[k] = matrix_(row_+i+k,column_+j);
-      return value;
+      ElementType array[IT::size];
+      for( size_t k=0UL; k<IT::size; ++k )
+         array[k] = ( k < rest_ )?( matrix_(row_+i+k,column_+j) ):( ElementType() );
+      return blaze::loadu( array );
    }
 }
 /*! \endcond */
@@ -3937,8 +3939,10 @@ inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
+      ElementType array[IT::size];
+      blaze::storeu( array, value );
       for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i+k,column_+j) = value[k];
+         matrix_(row_+i+k,column_+j) = array[k];
    }
 }
 /*! \endcond */
@@ -5586,7 +5590,7 @@ inline bool DenseSubmatrix<MT,aligned,false>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,aligned,false>::canSMPAssign() const
 {
-   return ( rows() > OPENMP_DMATASSIGN_THRESHOLD );
+   return ( rows() > SMP_DMATASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -7323,7 +7327,7 @@ inline bool DenseSubmatrix<MT,aligned,true>::isAligned() const
 template< typename MT >  // Type of the dense matrix
 inline bool DenseSubmatrix<MT,aligned,true>::canSMPAssign() const
 {
-   return ( columns() > OPENMP_DMATASSIGN_THRESHOLD );
+   return ( columns() > SMP_DMATASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
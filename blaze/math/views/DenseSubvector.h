@@ -576,10 +576,10 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
             return iterator_.loadu();
          }
          else {
-            IntrinsicType value;
-            for( size_t j=0UL; j<rest_; ++j )
-               value[j] = *(iterator_+j);
-            return value;
+            ElementType array[IT::size];
+            for( size_t j=0UL; j<IT::size; ++j )
+               array[j] = ( j < rest_ )?( *(iterator_+j) ):( ElementType() );
+            return blaze::loadu( array );
          }
       }
       //*******************************************************************************************
@@ -1599,7 +1599,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline bool DenseSubvector<VT,AF,TF>::canSMPAssign() const
 {
-   return ( size() > OPENMP_DVECASSIGN_THRESHOLD );
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -1656,10 +1656,10 @@ inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
       return vector_.loadu( offset_+index );
    }
    else {
-      IntrinsicType value;
-      for( size_t j=0UL; j<rest_; ++j )
-         value[j] = vector_[offset_+index+j];
-      return value;
+      ElementType array[IT::size];
+      for( size_t j=0UL; j<IT::size; ++j )
+         array[j] = ( j < rest_ )?( vector_[offset_+index+j] ):( ElementType() );
+      return blaze::loadu( array );
    }
 }
 //*************************************************************************************************
@@ -1717,8 +1717,10 @@ inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType&
       vector_.storeu( offset_+index, value );
    }
    else {
+      ElementType array[IT::size];
+      blaze::storeu( array, value );
       for( size_t j=0UL; j<rest_; ++j )
-         vector_[offset_+index+j] = value[j];
+         vector_[offset_+index+j] = array[j];
    }
 }
 //*************************************************************************************************
@@ -3108,7 +3110,7 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline bool DenseSubvector<VT,aligned,TF>::canSMPAssign() const
 {
-   return ( size() > OPENMP_DVECASSIGN_THRESHOLD );
+   return ( size() > SMP_DVECASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -45,7 +45,11 @@ namespace blaze {
 //=================================================================================================
 
 template< typename, bool > class DenseColumn;
+template< typename, bool > class DenseColumns;
+template< typename, bool > class DenseElements;
 template< typename, bool > class DenseRow;
+template< typename, bool > class DenseRows;
+template< typename, bool > class DenseStridedSubvector;
 template< typename, bool, bool > class DenseSubmatrix;
 template< typename, bool, bool > class DenseSubvector;
 template< typename, bool > class SparseColumn;
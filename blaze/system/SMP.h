@@ -0,0 +1,72 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/SMP.h
+//  \brief System settings for the shared-memory parallelization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_SMP_H_
+#define _BLAZE_SYSTEM_SMP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/config/SMP.h>
+#include <blaze/system/OpenMP.h>
+
+
+
+
+//=================================================================================================
+//
+//  THREAD TEAM MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the thread team based parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the thread team based parallelization. In case the
+// shared-memory parallelization and the thread team backend are enabled and OpenMP is not
+// enabled during compilation, the Blaze library executes all SMP assignments of dense vectors
+// and dense matrices by a team of persistent worker threads. Otherwise the thread team backend
+// is not used.
+*/
+#if BLAZE_USE_SHARED_MEMORY_PARALLELIZATION && BLAZE_USE_THREAD_TEAM && !BLAZE_OPENMP_PARALLEL_MODE
+#define BLAZE_THREAD_TEAM_PARALLEL_MODE 1
+#else
+#define BLAZE_THREAD_TEAM_PARALLEL_MODE 0
+#endif
+//*************************************************************************************************
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -71,7 +72,9 @@ namespace blaze {
 // threshold, the operation is executed in parallel. If the number of elements is below this
 // threshold the operation is executed single-threaded.
 */
-const size_t SMP_DVECASSIGN_THRESHOLD = OPENMP_DVECASSIGN_THRESHOLD;
+const size_t SMP_DVECASSIGN_THRESHOLD = ( BLAZE_THREAD_TEAM_PARALLEL_MODE )
+                                        ?( THREAD_TEAM_DVECASSIGN_THRESHOLD )
+                                        :( OPENMP_DVECASSIGN_THRESHOLD );
 //*************************************************************************************************
 
 
@@ -84,7 +87,9 @@ const size_t SMP_DVECASSIGN_THRESHOLD = OPENMP_DVECASSIGN_THRESHOLD;
 // this threshold, the operation is executed in parallel. If the number of elements is below
 // this threshold the operation is executed single-threaded.
 */
-const size_t SMP_DVECDVECADD_THRESHOLD = OPENMP_DVECDVECADD_THRESHOLD;
+const size_t SMP_DVECDVECADD_THRESHOLD = ( BLAZE_THREAD_TEAM_PARALLEL_MODE )
+                                         ?( THREAD_TEAM_DVECDVECADD_THRESHOLD )
+                                         :( OPENMP_DVECDVECADD_THRESHOLD );
 //*************************************************************************************************
 
 
@@ -97,7 +102,9 @@ const size_t SMP_DVECDVECADD_THRESHOLD = OPENMP_DVECDVECADD_THRESHOLD;
 // to this threshold, the operation is executed in parallel. If the number of elements is below
 // this threshold the operation is executed single-threaded.
 */
-const size_t SMP_DVECDVECSUB_THRESHOLD = OPENMP_DVECDVECSUB_THRESHOLD;
+const size_t SMP_DVECDVECSUB_THRESHOLD = ( BLAZE_THREAD_TEAM_PARALLEL_MODE )
+                                         ?( THREAD_TEAM_DVECDVECSUB_THRESHOLD )
+                                         :( OPENMP_DVECDVECSUB_THRESHOLD );
 //*************************************************************************************************
 
 
@@ -110,7 +117,9 @@ const size_t SMP_DVECDVECSUB_THRESHOLD = OPENMP_DVECDVECSUB_THRESHOLD;
 // to this threshold, the operation is executed in parallel. If the number of elements is below
 // this threshold the operation is executed single-threaded.
 */
-const size_t SMP_DVECDVECMULT_THRESHOLD = OPENMP_DVECDVECMULT_THRESHOLD;
+const size_t SMP_DVECDVECMULT_THRESHOLD = ( BLAZE_THREAD_TEAM_PARALLEL_MODE )
+                                          ?( THREAD_TEAM_DVECDVECMULT_THRESHOLD )
+                                          :( OPENMP_DVECDVECMULT_THRESHOLD );
 //*************************************************************************************************
 
 
@@ -123,7 +132,9 @@ const size_t SMP_DVECDVECMULT_THRESHOLD = OPENMP_DVECDVECMULT_THRESHOLD;
 // equal to this threshold, the operation is executed in parallel. If the number of elements
 // is below this threshold the operation is executed single-threaded.
 */
-const size_t SMP_DVECSCALARMULT_THRESHOLD = OPENMP_DVECSCALARMULT_THRESHOLD;
+const size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_THREAD_TEAM_PARALLEL_MODE )
+                                            ?( THREAD_TEAM_DVECSCALARMULT_THRESHOLD )
+                                            :( OPENMP_DVECSCALARMULT_THRESHOLD );
 //*************************************************************************************************
 
 
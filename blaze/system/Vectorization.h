@@ -171,6 +171,24 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the F16C mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the F16C mode. In case the F16C mode is enabled
+// (i.e. in case the F16C half precision conversion instructions are available) the Blaze
+// library converts half precision values via F16C intrinsics. In case the F16C mode is
+// disabled, the Blaze library chooses default, non-vectorized functionality for the
+// conversions.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_AVX_MODE && defined(__F16C__)
+#  define BLAZE_F16C_MODE 1
+#else
+#  define BLAZE_F16C_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -206,6 +224,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_F16C_MODE  || BLAZE_AVX_MODE   );
 
 }
 /*! \endcond */
@@ -0,0 +1,392 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/BFloat16.h
+//  \brief Header file for the bfloat16 brain floating point data type
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_BFLOAT16_H_
+#define _BLAZE_UTIL_BFLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Brain floating point (bfloat16) data type.
+// \ingroup util
+//
+// The bfloat16 class is a storage type for brain floating point values. It occupies 16 bits
+// (1 sign bit, 8 exponent bits and 7 mantissa bits), i.e. it corresponds to the upper half of
+// a single precision value. In comparison to the float16 data type it provides the same range
+// as single precision values at the cost of a reduced precision. All computations are performed
+// in single precision: a bfloat16 value is implicitly converted to \c float when used in an
+// arithmetic operation and the result is rounded to the nearest bfloat16 value (ties to even)
+// when it is assigned to a bfloat16:
+
+   \code
+   blaze::DynamicMatrix<blaze::bfloat16> A( 1000UL, 500UL );
+   blaze::DynamicVector<float> x( 500UL ), y;
+
+   // ... Initialization
+
+   y = A * x;  // The elements of A are widened to single precision on-the-fly
+   \endcode
+
+// Since the widening of a bfloat16 value only requires a shift of its bit pattern, the dense
+// matrix/vector kernels widen bfloat16 matrix elements in registers for all SSE2, AVX and AVX2
+// capable architectures.
+*/
+class bfloat16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline bfloat16();
+   inline bfloat16( float value );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline bfloat16& operator+=( float rhs );
+   inline bfloat16& operator-=( float rhs );
+   inline bfloat16& operator*=( float rhs );
+   inline bfloat16& operator/=( float rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline uint16_t bits() const;
+
+   static inline bfloat16 fromBits( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toBFloat16( float value );
+   static inline float    toFloat   ( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t value_;  //!< The bit pattern of the bfloat16 value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for bfloat16.
+//
+// The bfloat16 value is initialized to 0.
+*/
+inline bfloat16::bfloat16()
+   : value_( 0U )  // The bit pattern of the bfloat16 value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be rounded to bfloat16.
+*/
+inline bfloat16::bfloat16( float value )
+   : value_( toBFloat16( value ) )  // The bit pattern of the bfloat16 value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator+=( float rhs )
+{
+   value_ = toBFloat16( toFloat( value_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator-=( float rhs )
+{
+   value_ = toBFloat16( toFloat( value_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator*=( float rhs )
+{
+   value_ = toBFloat16( toFloat( value_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the bfloat16 value.
+*/
+inline bfloat16& bfloat16::operator/=( float rhs )
+{
+   value_ = toBFloat16( toFloat( value_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The bfloat16 value widened to single precision.
+*/
+inline bfloat16::operator float() const
+{
+   return toFloat( value_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the bit pattern of the bfloat16 value.
+//
+// \return The 16-bit representation of the value.
+*/
+inline uint16_t bfloat16::bits() const
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a bfloat16 value from the given bit pattern.
+//
+// \param bits The 16-bit representation of the value.
+// \return The according bfloat16 value.
+*/
+inline bfloat16 bfloat16::fromBits( uint16_t bits )
+{
+   bfloat16 tmp;
+   tmp.value_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rounds the given single precision value to bfloat16 precision.
+//
+// \param value The single precision value to be converted.
+// \return The bit pattern of the according bfloat16 value.
+//
+// This function rounds the given value to the nearest bfloat16 value (ties to even). NaNs
+// remain (quiet) NaNs.
+*/
+inline uint16_t bfloat16::toBFloat16( float value )
+{
+   uint32_t x;
+   std::memcpy( &x, &value, sizeof( x ) );
+
+   if( ( x & 0x7FFFFFFFU ) > 0x7F800000U ) {
+      return static_cast<uint16_t>( ( x >> 16 ) | 0x0040U );
+   }
+
+   x += 0x7FFFU + ( ( x >> 16 ) & 1U );
+   return static_cast<uint16_t>( x >> 16 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Widens the given bfloat16 value to single precision.
+//
+// \param bits The bit pattern of the bfloat16 value.
+// \return The according single precision value.
+//
+// The conversion from bfloat16 to single precision is exact.
+*/
+inline float bfloat16::toFloat( uint16_t bits )
+{
+   const uint32_t x( static_cast<uint32_t>( bits ) << 16 );
+   float value;
+   std::memcpy( &value, &x, sizeof( value ) );
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name bfloat16 operators */
+//@{
+inline std::ostream& operator<<( std::ostream& os, const bfloat16& value );
+inline std::istream& operator>>( std::istream& is, bfloat16& value );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for bfloat16 values.
+//
+// \param os Reference to the output stream.
+// \param value Reference to a bfloat16 value.
+// \return The output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, const bfloat16& value )
+{
+   return os << static_cast<float>( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global input operator for bfloat16 values.
+//
+// \param is Reference to the input stream.
+// \param value Reference to a bfloat16 value.
+// \return The input stream.
+*/
+inline std::istream& operator>>( std::istream& is, bfloat16& value )
+{
+   float tmp;
+   if( is >> tmp )
+      value = tmp;
+   return is;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,454 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Float16.h
+//  \brief Header file for the float16 half precision data type
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_FLOAT16_H_
+#define _BLAZE_UTIL_FLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Half precision (IEEE 754 binary16) floating point data type.
+// \ingroup util
+//
+// The float16 class is a storage type for half precision floating point values. It occupies
+// 16 bits (1 sign bit, 5 exponent bits and 10 mantissa bits) and therefore halves the memory
+// consumption and memory traffic in comparison to single precision values. All computations
+// are performed in single precision: a float16 value is implicitly converted to \c float when
+// used in an arithmetic operation and the result is rounded to the nearest half precision value
+// (ties to even) when it is assigned to a float16:
+
+   \code
+   blaze::DynamicMatrix<blaze::float16> A( 1000UL, 500UL );
+   blaze::DynamicVector<float> x( 500UL ), y;
+
+   // ... Initialization
+
+   y = A * x;  // The elements of A are widened to single precision on-the-fly
+   \endcode
+
+// In case the F16C instructions are available (see the BLAZE_F16C_MODE compilation switch), the
+// conversions are performed via F16C intrinsics. Additionally, the dense matrix/vector kernels
+// load half precision matrix elements and widen them in registers.
+*/
+class float16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline float16();
+   inline float16( float value );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   inline float16& operator+=( float rhs );
+   inline float16& operator-=( float rhs );
+   inline float16& operator*=( float rhs );
+   inline float16& operator/=( float rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator float() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   inline uint16_t bits() const;
+
+   static inline float16 fromBits( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toHalf ( float value );
+   static inline float    toFloat( uint16_t bits );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t value_;  //!< The bit pattern of the half precision value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for float16.
+//
+// The half precision value is initialized to 0.
+*/
+inline float16::float16()
+   : value_( 0U )  // The bit pattern of the half precision value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be rounded to half precision.
+*/
+inline float16::float16( float value )
+   : value_( toHalf( value ) )  // The bit pattern of the half precision value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the half precision value.
+*/
+inline float16& float16::operator+=( float rhs )
+{
+   value_ = toHalf( toFloat( value_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the half precision value.
+*/
+inline float16& float16::operator-=( float rhs )
+{
+   value_ = toHalf( toFloat( value_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication with a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the half precision value.
+*/
+inline float16& float16::operator*=( float rhs )
+{
+   value_ = toHalf( toFloat( value_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division by a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the half precision value.
+*/
+inline float16& float16::operator/=( float rhs )
+{
+   value_ = toHalf( toFloat( value_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The half precision value widened to single precision.
+*/
+inline float16::operator float() const
+{
+   return toFloat( value_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the bit pattern of the half precision value.
+//
+// \return The 16-bit representation of the value.
+*/
+inline uint16_t float16::bits() const
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a half precision value from the given bit pattern.
+//
+// \param bits The 16-bit representation of the value.
+// \return The according half precision value.
+*/
+inline float16 float16::fromBits( uint16_t bits )
+{
+   float16 tmp;
+   tmp.value_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rounds the given single precision value to half precision.
+//
+// \param value The single precision value to be converted.
+// \return The bit pattern of the according half precision value.
+//
+// This function rounds the given value to the nearest half precision value (ties to even).
+// Values exceeding the range of half precision values are converted to infinity, NaNs remain
+// NaNs.
+*/
+inline uint16_t float16::toHalf( float value )
+{
+#if BLAZE_F16C_MODE
+   return static_cast<uint16_t>( _cvtss_sh( value, 0 ) );
+#else
+   uint32_t x;
+   std::memcpy( &x, &value, sizeof( x ) );
+
+   const uint32_t sign( ( x >> 16 ) & 0x8000U );
+   const uint32_t absx( x & 0x7FFFFFFFU );
+
+   // Infinity and NaN
+   if( absx >= 0x7F800000U ) {
+      return static_cast<uint16_t>( sign | 0x7C00U |
+                                    ( ( absx > 0x7F800000U )?( 0x0200U | ( ( absx >> 13 ) & 0x03FFU ) ):( 0U ) ) );
+   }
+
+   // Overflow to infinity
+   if( absx >= 0x477FF000U ) {
+      return static_cast<uint16_t>( sign | 0x7C00U );
+   }
+
+   // Subnormal half precision values
+   if( absx < 0x38800000U ) {
+      if( absx <= 0x33000000U )
+         return static_cast<uint16_t>( sign );
+
+      const uint32_t shift( 126U - ( absx >> 23 ) );
+      const uint32_t mant ( ( absx & 0x007FFFFFU ) | 0x00800000U );
+      const uint32_t rem  ( mant & ( ( 1U << shift ) - 1U ) );
+      const uint32_t half ( 1U << ( shift - 1U ) );
+      uint32_t res( mant >> shift );
+      if( rem > half || ( rem == half && ( res & 1U ) ) )
+         ++res;
+      return static_cast<uint16_t>( sign | res );
+   }
+
+   // Normal half precision values
+   uint32_t res( ( absx - 0x38000000U ) >> 13 );
+   const uint32_t rem( absx & 0x1FFFU );
+   if( rem > 0x1000U || ( rem == 0x1000U && ( res & 1U ) ) )
+      ++res;
+   return static_cast<uint16_t>( sign | res );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Widens the given half precision value to single precision.
+//
+// \param bits The bit pattern of the half precision value.
+// \return The according single precision value.
+//
+// The conversion from half to single precision is exact.
+*/
+inline float float16::toFloat( uint16_t bits )
+{
+#if BLAZE_F16C_MODE
+   return _cvtsh_ss( bits );
+#else
+   const uint32_t sign( static_cast<uint32_t>( bits & 0x8000U ) << 16 );
+   uint32_t exp ( ( bits >> 10 ) & 0x1FU );
+   uint32_t mant( bits & 0x03FFU );
+   uint32_t x;
+
+   if( exp == 0U ) {
+      if( mant == 0U ) {
+         x = sign;
+      }
+      else {
+         exp = 113U;
+         while( !( mant & 0x0400U ) ) {
+            mant <<= 1;
+            --exp;
+         }
+         x = sign | ( exp << 23 ) | ( ( mant & 0x03FFU ) << 13 );
+      }
+   }
+   else if( exp == 0x1FU ) {
+      x = sign | 0x7F800000U | ( mant << 13 );
+   }
+   else {
+      x = sign | ( ( exp + 112U ) << 23 ) | ( mant << 13 );
+   }
+
+   float value;
+   std::memcpy( &value, &x, sizeof( value ) );
+   return value;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name float16 operators */
+//@{
+inline std::ostream& operator<<( std::ostream& os, const float16& value );
+inline std::istream& operator>>( std::istream& is, float16& value );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for half precision values.
+//
+// \param os Reference to the output stream.
+// \param value Reference to a half precision value.
+// \return The output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, const float16& value )
+{
+   return os << static_cast<float>( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global input operator for half precision values.
+//
+// \param is Reference to the input stream.
+// \param value Reference to a half precision value.
+// \return The input stream.
+*/
+inline std::istream& operator>>( std::istream& is, float16& value )
+{
+   float tmp;
+   if( is >> tmp )
+      value = tmp;
+   return is;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
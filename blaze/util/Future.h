@@ -0,0 +1,481 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Future.h
+//  \brief Header file of the Future class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_FUTURE_H_
+#define _BLAZE_UTIL_FUTURE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <blaze/util/Null.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/FutureState.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze::threadpool NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+namespace threadpool { struct Launcher; }
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle to an asynchronously executed task.
+// \ingroup threads
+//
+// \section future_general General
+//
+// The Future class represents a handle to a task that is executed asynchronously by a thread
+// pool. Futures are returned by the launch() functions (and by the asynchronous evaluation of
+// vector and matrix expressions via the async() functions). They can be used to query the
+// state of the task, to wait for its completion and to retrieve an exception thrown during
+// the execution of the task:
+
+   \code
+   void task( const std::string& filename, std::vector<double>* values );
+
+   blaze::ThreadPool pool( 4 );
+   std::vector<double> values;
+
+   // Asynchronous execution of the given task
+   blaze::Future future( blaze::launch( pool, boost::bind( task, "data.txt", &values ) ) );
+
+   // ... Performing other work in the meantime
+
+   // Waiting for the completion of the task. In case the task has thrown an exception, the
+   // exception is rethrown by the get() function.
+   future.get();
+   \endcode
+
+// Futures are lightweight handles, which can be copied freely. All copies refer to the same
+// task. Note that the wait() and get() functions of a future don't necessarily block the calling
+// thread: while waiting for the completion of the task, the calling thread participates in the
+// execution of the tasks of the thread pool. Therefore it is possible to wait for a future from
+// within a running task.
+//
+//
+// \section future_dependencies Dependencies between tasks
+//
+// The launch() functions optionally accept the futures of up to two other tasks, which have to
+// be completed before the new task is started. This enables the construction of chains of
+// dependent tasks without blocking any thread:
+
+   \code
+   blaze::Future f1( blaze::launch( pool, task1 ) );
+   blaze::Future f2( blaze::launch( pool, task2 ) );
+   blaze::Future f3( blaze::launch( pool, task3, f1, f2 ) );  // Started after task1 and task2
+
+   f3.get();
+   \endcode
+
+// In case one of the dependencies throws an exception, the dependent task is not executed, but
+// the exception is passed on to the dependent task (i.e. calling get() on \a f3 rethrows the
+// exception of \a task1 or \a task2). Please note that all tasks that have been discarded via
+// the ThreadPool::clear() function or during the destruction of the thread pool are never
+// completed. Therefore it is not possible to wait for a discarded task.
+*/
+class Future
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline Future();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Copy assignment operator********************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isValid() const;
+   inline bool isReady() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void wait() const;
+   inline void get () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef threadpool::FutureState  State;  //!< Type of the shared state.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Future( const boost::shared_ptr<State>& state );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::shared_ptr<State> state_;  //!< The shared state of the task.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend struct threadpool::Launcher;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Future.
+//
+// The default constructor creates an invalid future, which doesn't refer to any task.
+*/
+inline Future::Future()
+   : state_()  // The shared state of the task
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Future class.
+//
+// \param state The shared state of the task.
+*/
+inline Future::Future( const boost::shared_ptr<State>& state )
+   : state_( state )  // The shared state of the task
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the future refers to a task.
+//
+// \return \a true in case the future refers to a task, \a false if not.
+*/
+inline bool Future::isValid() const
+{
+   return state_.get() != NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task has been completed.
+//
+// \return \a true in case the task has been completed or the future is invalid, \a false if not.
+*/
+inline bool Future::isReady() const
+{
+   return !state_ || state_->isReady();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the task.
+//
+// \return void
+//
+// This function waits until the task has been completed. While waiting, the calling thread
+// executes scheduled tasks of the thread pool. In contrast to the get() function, the wait()
+// function doesn't rethrow the exception of the task. In case the future is invalid, the
+// function returns immediately.
+*/
+inline void Future::wait() const
+{
+   if( !state_ ) return;
+
+   while( !state_->isReady() ) {
+      if( !state_->pool().executePending() )
+         state_->sleep();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the task and rethrowing its exception.
+//
+// \return void
+//
+// This function waits until the task has been completed (see the wait() function). In case
+// the task or one of its dependencies has thrown an exception, the exception is rethrown.
+*/
+inline void Future::get() const
+{
+   wait();
+
+   if( state_ && state_->error() )
+      boost::rethrow_exception( state_->error() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LAUNCHER
+//
+//=================================================================================================
+
+namespace threadpool {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the launch of asynchronous tasks.
+// \ingroup threads
+*/
+struct Launcher
+{
+   //**Execution***********************************************************************************
+   /*!\brief Functor for the execution of an asynchronous task by a thread pool.
+   */
+   struct Execution
+   {
+      explicit inline Execution( const boost::shared_ptr<FutureState>& state )
+         : state_( state )  // The shared state of the task
+      {}
+
+      inline void operator()() const {
+         state_->execute();
+      }
+
+      boost::shared_ptr<FutureState> state_;  //!< The shared state of the task.
+   };
+   //**********************************************************************************************
+
+   //**Continuation********************************************************************************
+   /*!\brief Functor for the notification about the completion of a dependency.
+   //
+   // The Continuation functor is executed as soon as the given dependency (if any) has been
+   // completed. The last notification schedules the dependent task for execution.
+   */
+   struct Continuation
+   {
+      inline Continuation( const boost::shared_ptr<FutureState>& state, const FutureState* dependency )
+         : state_     ( state )       // The shared state of the dependent task
+         , dependency_( dependency )  // The shared state of the completed dependency
+      {}
+
+      inline void operator()() const {
+         const boost::exception_ptr error( ( dependency_ )?( dependency_->error() )
+                                                         :( boost::exception_ptr() ) );
+         if( state_->release( error ) )
+            state_->pool().schedule( Execution( state_ ) );
+      }
+
+      boost::shared_ptr<FutureState> state_;  //!< The shared state of the dependent task.
+      const FutureState* dependency_;         //!< The shared state of the completed dependency.
+   };
+   //**********************************************************************************************
+
+   //**Launch function*****************************************************************************
+   /*!\brief Launching the given task after the completion of the given dependencies.
+   //
+   // \param pool The executing thread pool.
+   // \param task The task to be executed asynchronously.
+   // \param d1 The first dependency of the task.
+   // \param d2 The second dependency of the task.
+   // \return The future of the task.
+   */
+   static inline Future launch( ThreadPool& pool, const Task& task, const Future& d1, const Future& d2 )
+   {
+      const size_t dependencies( ( d1.state_ ? 1UL : 0UL ) + ( d2.state_ ? 1UL : 0UL ) );
+
+      // The additional dependency prevents a premature start of the task in case one of
+      // the given dependencies has already been completed.
+      boost::shared_ptr<FutureState> state( new FutureState( pool, task, dependencies+1UL ) );
+
+      if( d1.state_ ) d1.state_->attach( Task( Continuation( state, d1.state_.get() ) ) );
+      if( d2.state_ ) d2.state_->attach( Task( Continuation( state, d2.state_.get() ) ) );
+
+      Continuation( state, NULL )();
+
+      return Future( state );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Future functions */
+//@{
+template< typename Callable >
+inline Future launch( ThreadPool& pool, Callable func );
+
+template< typename Callable >
+inline Future launch( ThreadPool& pool, Callable func, const Future& dependency );
+
+template< typename Callable >
+inline Future launch( ThreadPool& pool, Callable func, const Future& d1, const Future& d2 );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous execution of the given function/functor.
+// \ingroup threads
+//
+// \param pool The executing thread pool.
+// \param func The given function/functor.
+// \return The future of the asynchronously executed function/functor.
+//
+// This function schedules the given function/functor for execution by the given thread pool
+// and returns a future referring to the scheduled task. The given function/functor must be
+// copyable, must be callable without arguments and must return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline Future launch( ThreadPool& pool, Callable func )
+{
+   return threadpool::Launcher::launch( pool, threadpool::Task( func ), Future(), Future() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous execution of the given function/functor after the completion of the
+//        given dependency.
+// \ingroup threads
+//
+// \param pool The executing thread pool.
+// \param func The given function/functor.
+// \param dependency The future of the task that has to be completed first.
+// \return The future of the asynchronously executed function/functor.
+//
+// This function schedules the given function/functor for execution by the given thread pool
+// as soon as the task referred to by \a dependency has been completed. In case \a dependency
+// is invalid, the function/functor is scheduled immediately. The given function/functor must
+// be copyable, must be callable without arguments and must return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline Future launch( ThreadPool& pool, Callable func, const Future& dependency )
+{
+   return threadpool::Launcher::launch( pool, threadpool::Task( func ), dependency, Future() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous execution of the given function/functor after the completion of the
+//        two given dependencies.
+// \ingroup threads
+//
+// \param pool The executing thread pool.
+// \param func The given function/functor.
+// \param d1 The future of the first task that has to be completed first.
+// \param d2 The future of the second task that has to be completed first.
+// \return The future of the asynchronously executed function/functor.
+//
+// This function schedules the given function/functor for execution by the given thread pool
+// as soon as the tasks referred to by \a d1 and \a d2 have been completed. Invalid futures are
+// ignored. The given function/functor must be copyable, must be callable without arguments and
+// must return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline Future launch( ThreadPool& pool, Callable func, const Future& d1, const Future& d2 )
+{
+   return threadpool::Launcher::launch( pool, threadpool::Task( func ), d1, d2 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
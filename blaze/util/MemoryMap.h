@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <stdexcept>
+#include <string>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope-limited memory mapping of a file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the process.
+// The mapping is established during construction and released at the end of the lifetime of the
+// MemoryMap instance according to the RAII principle:
+
+   \code
+   {
+      blaze::MemoryMap map( "matrix.blazemap" );
+
+      // ... Working with the map.size() bytes starting at map.data()
+
+   } // The mapping is automatically released at the end of scope
+   \endcode
+
+// The file is mapped in copy-on-write mode: The pages of the file are only loaded on first
+// access and can be shared with the operating system's file cache and with other processes
+// mapping the same file. Write access to the mapped memory is possible, but every modified page
+// is privately copied and the modifications are never written back to the file. The start of
+// the mapping is guaranteed to be aligned to a page boundary. In case the file cannot be opened
+// or mapped, a \a std::runtime_error exception is thrown.
+*/
+class MemoryMap : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryMap( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline char*              data();
+   inline const char*        data() const;
+   inline size_t             size() const;
+   inline const std::string& filename() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string filename_;  //!< The name of the mapped file.
+   char*       data_;      //!< The first byte of the mapped file.
+   size_t      size_;      //!< The size of the mapped file in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a copy-on-write mapping of the given file.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+//
+// In case the given file is empty, no mapping is established and data() returns a NULL pointer.
+*/
+inline MemoryMap::MemoryMap( const std::string& filename )
+   : filename_( filename )  // The name of the mapped file
+   , data_    ( NULL     )  // The first byte of the mapped file
+   , size_    ( 0UL      )  // The size of the mapped file in bytes
+{
+#if defined(_MSC_VER)
+   HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+   LARGE_INTEGER size;
+
+   if( file == INVALID_HANDLE_VALUE || !GetFileSizeEx( file, &size ) ) {
+      if( file != INVALID_HANDLE_VALUE ) CloseHandle( file );
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   size_ = static_cast<size_t>( size.QuadPart );
+
+   if( size_ > 0UL ) {
+      HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+      if( mapping != NULL ) {
+         data_ = static_cast<char*>( MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) );
+         CloseHandle( mapping );
+      }
+   }
+
+   CloseHandle( file );
+#else
+   const int file( ::open( filename.c_str(), O_RDONLY ) );
+   struct stat status;
+
+   if( file < 0 || ::fstat( file, &status ) != 0 ) {
+      if( file >= 0 ) ::close( file );
+      throw std::runtime_error( "Unable to open file '" + filename + "'" );
+   }
+
+   size_ = static_cast<size_t>( status.st_size );
+
+   if( size_ > 0UL ) {
+      void* address( ::mmap( NULL, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0 ) );
+      if( address != MAP_FAILED )
+         data_ = static_cast<char*>( address );
+   }
+
+   ::close( file );
+#endif
+
+   if( size_ > 0UL && data_ == NULL ) {
+      throw std::runtime_error( "Unable to map file '" + filename + "'" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MemoryMap class.
+//
+// The destructor releases the mapping. All private modifications of the mapped memory are
+// discarded.
+*/
+inline MemoryMap::~MemoryMap()
+{
+   if( data_ == NULL ) return;
+
+#if defined(_MSC_VER)
+   UnmapViewOfFile( data_ );
+#else
+   ::munmap( data_, size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline char* MemoryMap::data()
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapped file.
+//
+// \return Pointer to the first byte of the mapped file.
+*/
+inline const char* MemoryMap::data() const
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MemoryMap::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the mapped file.
+//
+// \return The name of the mapped file.
+*/
+inline const std::string& MemoryMap::filename() const
+{
+   return filename_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,447 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/TaskGroup.h
+//  \brief Header file of the TaskGroup class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TASKGROUP_H_
+#define _BLAZE_UTIL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of child tasks of a thread pool.
+// \ingroup threads
+//
+// \section taskgroup_general General
+//
+// The TaskGroup class represents a group of tasks that are scheduled for a particular thread
+// pool and that can be waited for collectively. In contrast to the ThreadPool::wait() function,
+// which waits for all scheduled tasks of a thread pool, the wait() function of a task group only
+// waits for the tasks that have been scheduled via the task group (i.e. the children of the
+// task group). Additionally, the calling thread does not block while waiting for the children,
+// but participates in the execution of scheduled tasks. Therefore task groups can also be used
+// within a running task in order to recursively split work into smaller child tasks (parent/
+// child joins):
+
+   \code
+   // Recursive parallel computation of the sum of a range of values
+   void sum( blaze::ThreadPool& pool, const double* first, size_t n, double* result )
+   {
+      if( n < 1000 ) {
+         *result = std::accumulate( first, first+n, 0.0 );
+         return;
+      }
+
+      double left( 0.0 ), right( 0.0 );
+
+      // Scheduling two child tasks and waiting for their completion. While waiting, the
+      // calling thread executes scheduled tasks (for instance the child tasks themselves).
+      blaze::TaskGroup group( pool );
+      group.run( sum, boost::ref( pool ), first    , n/2  , &left  );
+      group.run( sum, boost::ref( pool ), first+n/2, n-n/2, &right );
+      group.wait();
+
+      *result = left + right;
+   }
+
+   int main()
+   {
+      blaze::ThreadPool pool( 4 );
+      std::vector<double> values( 1000000, 1.0 );
+
+      double result( 0.0 );
+      blaze::TaskGroup group( pool );
+      group.run( sum, boost::ref( pool ), &values[0], values.size(), &result );
+      group.wait();
+   }
+   \endcode
+
+// Note that the destructor of a task group waits for all children of the group. Also note that
+// the run() function allows for up to five arguments for the given functions/functors.
+*/
+class TaskGroup : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup( ThreadPool& pool );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t pending() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   inline void run( Callable func );
+
+   template< typename Callable, typename A1 >
+   inline void run( Callable func, A1 a1 );
+
+   template< typename Callable, typename A1, typename A2 >
+   inline void run( Callable func, A1 a1, A2 a2 );
+
+   template< typename Callable, typename A1, typename A2, typename A3 >
+   inline void run( Callable func, A1 a1, A2 a2, A3 a3 );
+
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4 >
+   inline void run( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 );
+
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4, typename A5 >
+   inline void run( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Callable >
+   inline void spawn( const Callable& func );
+
+   inline void notify();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ThreadPool& pool_;                //!< The managing thread pool.
+   boost::atomic<size_t> pending_;   //!< The number of children that have not been completed.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ThreadPool;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskGroup class.
+//
+// \param pool The thread pool executing the children of the task group.
+*/
+inline TaskGroup::TaskGroup( ThreadPool& pool )
+   : pool_   ( pool )  // The managing thread pool
+   , pending_( 0UL  )  // The number of children that have not been completed
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the TaskGroup class.
+//
+// The destructor waits for all children of the task group to be completed.
+*/
+inline TaskGroup::~TaskGroup()
+{
+   wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of children that have not been completed yet.
+//
+// \return The number of pending children.
+*/
+inline size_t TaskGroup::pending() const
+{
+   return pending_.load( boost::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable without arguments and must return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline void TaskGroup::run( Callable func )
+{
+   spawn( func );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given unary function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with one argument and must return void.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename A1 >      // Type of the first argument
+inline void TaskGroup::run( Callable func, A1 a1 )
+{
+   spawn( boost::bind<void>( func, a1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given binary function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with two arguments and must return void.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2 >      // Type of the second argument
+inline void TaskGroup::run( Callable func, A1 a1, A2 a2 )
+{
+   spawn( boost::bind<void>( func, a1, a2 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given ternary function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with three arguments and must return void.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3 >      // Type of the third argument
+inline void TaskGroup::run( Callable func, A1 a1, A2 a2, A3 a3 )
+{
+   spawn( boost::bind<void>( func, a1, a2, a3 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given four argument function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \param a4 The fourth argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with four arguments and must return void.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4 >      // Type of the fourth argument
+inline void TaskGroup::run( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
+{
+   spawn( boost::bind<void>( func, a1, a2, a3, a4 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given five argument function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \param a1 The first argument.
+// \param a2 The second argument.
+// \param a3 The third argument.
+// \param a4 The fourth argument.
+// \param a5 The fifth argument.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with five arguments and must return void.
+*/
+template< typename Callable  // Type of the function/functor
+        , typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4        // Type of the fourth argument
+        , typename A5 >      // Type of the fifth argument
+inline void TaskGroup::run( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
+{
+   spawn( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Waiting for all children of the task group to be completed.
+//
+// \return void
+//
+// This function returns as soon as all children of the task group have been completed. While
+// waiting, the calling thread executes scheduled tasks of the managing thread pool. Therefore
+// this function can also be called from within a task executed by the thread pool.
+*/
+inline void TaskGroup::wait()
+{
+   while( pending_.load( boost::memory_order_acquire ) != 0UL ) {
+      if( !pool_.executePending() )
+         boost::this_thread::yield();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor as child of the task group.
+//
+// \param func The given function/functor.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void TaskGroup::spawn( const Callable& func )
+{
+   pending_.fetch_add( 1UL, boost::memory_order_relaxed );
+   pool_.spawn( this, func );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Notification about the completion of a child of the task group.
+//
+// \return void
+*/
+inline void TaskGroup::notify()
+{
+   pending_.fetch_sub( 1UL, boost::memory_order_release );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,20 +40,36 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
 #include <blaze/util/PtrVector.h>
-#include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/threadpool/Task.h>
-#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/threadpool/TaskNode.h>
+#include <blaze/util/threadpool/Worker.h>
 #include <blaze/util/Types.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+class Future;
+class TaskGroup;
+
+
+
+
 //=================================================================================================
 //
 //  CLASS DEFINITION
@@ -150,6 +166,27 @@ namespace blaze {
 // given functions/functors.
 //
 //
+// \section threadpool_scheduling Work-stealing scheduling
+//
+// The ThreadPool class uses a work-stealing scheduler to distribute the scheduled tasks among
+// the threads of the pool. Every thread that schedules tasks for a thread pool (i.e. both the
+// threads of the pool and any external thread) owns a lock-free work-stealing deque. Scheduled
+// tasks are pushed to the deque of the scheduling thread without acquiring any lock. Each thread
+// of the pool first executes the tasks of its own deque in LIFO order and in case its deque is
+// empty steals tasks in FIFO order from the deques of randomly selected other threads. Only in
+// case no task can be found a thread blocks until new tasks are scheduled. Additionally, tasks
+// (including the function/functor and up to five bound arguments of built-in type) are stored
+// in preallocated task nodes, i.e. in contrast to previous versions the scheduling of a task
+// does not involve any dynamic memory allocation. This results in a very small per-task overhead
+// and enables the efficient execution of a large number of fine-grained tasks.
+//
+// In order to wait for a specific set of tasks instead of all scheduled tasks, tasks can be
+// scheduled as children of a TaskGroup (see the TaskGroup class description). In contrast to the
+// wait() function of the thread pool, the wait() function of a task group can also be called
+// from within a running task: while waiting for the children of the group, the calling thread
+// participates in the execution of scheduled tasks.
+//
+//
 // \section thread_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -233,13 +270,20 @@ class ThreadPool : private NonCopyable
 {
  private:
    //**Type definitions****************************************************************************
-   typedef PtrVector<Thread>          Threads;    //!< Type of the thread container.
-   typedef threadpool::TaskQueue      TaskQueue;  //!< Type of the task queue.
+   typedef threadpool::Worker         Worker;     //!< Type of the scheduling context of a thread.
+   typedef threadpool::TaskNode       TaskNode;   //!< Type of a scheduled task.
+   typedef PtrVector<Worker>          Workers;    //!< Type of the worker container.
+   typedef std::vector<Worker*>       Victims;    //!< Type of the list of all deque owners.
+   typedef PtrVector<Victims>         Snapshots;  //!< Type of the container for victim lists.
    typedef boost::mutex               Mutex;      //!< Type of the mutex.
    typedef Mutex::scoped_lock         Lock;       //!< Type of a locking object.
    typedef boost::condition_variable  Condition;  //!< Condition variable type.
    //**********************************************************************************************
 
+   //**Forward declarations************************************************************************
+   struct ThreadContext;
+   //**********************************************************************************************
+
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
@@ -294,37 +338,70 @@ class ThreadPool : private NonCopyable
    void resize( size_t n );
    void wait();
    void clear();
+   bool setAffinity( const std::vector<size_t>& cpus );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   template< typename Callable >
+   void spawn( TaskGroup* group, const Callable& func );
+
+   void submit( Worker& context, TaskNode* node );
+   //@}
+   //**********************************************************************************************
+
    //**Thread functions****************************************************************************
    /*!\name Thread functions */
    //@{
-   void createThread();
-   bool executeTask();
+   Worker&   getContext();
+   Worker&   attachThread();
+   void      detachThread( Worker& worker );
+   void      createThread();
+   bool      executeTask();
+   bool      executePending();
+   TaskNode* findTask( Worker& context ) const;
+   bool      hasTasks() const;
+   void      execute( Worker& context, TaskNode* node );
+   void      publish();
+
+   static boost::thread_specific_ptr<ThreadContext>& threadContext();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   const size_t id_;                    //!< Unique ID of the thread pool.
+   size_t total_;                       //!< Total number of threads in the thread pool.
+   size_t expected_;                    //!< Expected number of threads in the thread pool.
+                                        /*!< This number may differ from the total number of
+                                             threads during a resize of the thread pool. */
+   boost::atomic<size_t> active_;       //!< Number of currently active/busy threads.
+   boost::atomic<size_t> sleeping_;     //!< Number of threads waiting for a task.
+   boost::atomic<size_t> queued_;       //!< Number of scheduled tasks that have not been started.
+   boost::atomic<size_t> pending_;      //!< Number of scheduled tasks that have not been completed.
+   boost::atomic<size_t> generation_;   //!< Generation of the scheduled tasks.
+                                        /*!< Tasks of a previous generation have been removed
+                                             from the thread pool and are not executed. */
+   Workers threads_;                    //!< The scheduling contexts of the pool threads.
+   Workers externals_;                  //!< The scheduling contexts of external threads.
+   Snapshots snapshots_;                //!< All published lists of deque owners.
+   boost::atomic<const Victims*> victims_;  //!< The current list of all deque owners.
+   std::vector<size_t> cpus_;           //!< The logical CPUs of the pool threads (empty if unbound).
+   mutable Mutex mutex_;                //!< Synchronization mutex.
+   Condition waitForTask_;              //!< Wait condition for idle threads.
+   Condition waitForThread_;            //!< Wait condition for the thread management.
    //@}
    //**********************************************************************************************
 
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    friend class Thread;
+   friend class Future;
+   friend class TaskGroup;
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -346,8 +423,7 @@ class ThreadPool : private NonCopyable
 */
 inline bool ThreadPool::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_.load( boost::memory_order_relaxed ) == 0UL;
 }
 //*************************************************************************************************
 
@@ -372,8 +448,7 @@ inline size_t ThreadPool::size() const
 */
 inline size_t ThreadPool::active() const
 {
-   Lock lock( mutex_ );
-   return active_;
+   return active_.load( boost::memory_order_relaxed );
 }
 //*************************************************************************************************
 
@@ -386,7 +461,8 @@ inline size_t ThreadPool::active() const
 inline size_t ThreadPool::ready() const
 {
    Lock lock( mutex_ );
-   return expected_ - active_;
+   const size_t active( active_.load( boost::memory_order_relaxed ) );
+   return ( expected_ > active )?( expected_ - active ):( 0UL );
 }
 //*************************************************************************************************
 
@@ -411,9 +487,7 @@ inline size_t ThreadPool::ready() const
 template< typename Callable >  // Task type
 void ThreadPool::schedule( Callable func )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( func );
-   waitForTask_.notify_one();
+   spawn( NULL, func );
 }
 //*************************************************************************************************
 
@@ -432,9 +506,7 @@ template< typename Callable  // Type of the function/functor
         , typename A1 >      // Type of the first argument
 void ThreadPool::schedule( Callable func, A1 a1 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1 ) );
-   waitForTask_.notify_one();
+   spawn( NULL, boost::bind<void>( func, a1 ) );
 }
 //*************************************************************************************************
 
@@ -455,9 +527,7 @@ template< typename Callable  // Type of the function/functor
         , typename A2 >      // Type of the second argument
 void ThreadPool::schedule( Callable func, A1 a1, A2 a2 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2 ) );
-   waitForTask_.notify_one();
+   spawn( NULL, boost::bind<void>( func, a1, a2 ) );
 }
 //*************************************************************************************************
 
@@ -480,9 +550,7 @@ template< typename Callable  // Type of the function/functor
         , typename A3 >      // Type of the third argument
 void ThreadPool::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3 ) );
-   waitForTask_.notify_one();
+   spawn( NULL, boost::bind<void>( func, a1, a2, a3 ) );
 }
 //*************************************************************************************************
 
@@ -507,15 +575,13 @@ template< typename Callable  // Type of the function/functor
         , typename A4 >      // Type of the fourth argument
 void ThreadPool::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4 ) );
-   waitForTask_.notify_one();
+   spawn( NULL, boost::bind<void>( func, a1, a2, a3, a4 ) );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Scheduling the given four argument function/functor for execution.
+/*!\brief Scheduling the given five argument function/functor for execution.
 //
 // \param func The given function/functor.
 // \param a1 The first argument.
@@ -536,9 +602,30 @@ template< typename Callable  // Type of the function/functor
         , typename A5 >      // Type of the fifth argument
 void ThreadPool::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
-   waitForTask_.notify_one();
+   spawn( NULL, boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor as child of the given task group.
+//
+// \param group The parent task group of the task (optional).
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. In case a task group is
+// given, the task is registered as child of the given task group.
+*/
+template< typename Callable >  // Type of the function/functor
+void ThreadPool::spawn( TaskGroup* group, const Callable& func )
+{
+   Worker& context( getContext() );
+   TaskNode* node( context.nodes_.allocate() );
+   node->task_.assign( func );
+   node->group_ = group;
+   submit( context, node );
 }
 //*************************************************************************************************
 
@@ -0,0 +1,308 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadTeam.h
+//  \brief Header file of the ThreadTeam class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADTEAM_H_
+#define _BLAZE_UTIL_THREADTEAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a team of persistent worker threads for low-latency fork/join work.
+// \ingroup threads
+//
+// \section threadteam_general General
+//
+// The ThreadTeam class represents a fixed team of persistent worker threads that cooperatively
+// execute a single job at a time. In contrast to the ThreadPool class, which is optimized for
+// the execution of a large number of independent tasks, the ThreadTeam class is optimized for
+// the latency of a single fork/join parallel region: the threads of the team are created once
+// and kept alive for the lifetime of the team, and the start of a job only requires a single
+// atomic operation on a shared broadcast slot. Therefore even small parallel kernels start
+// within a few microseconds, which for instance enables the parallel execution of vector
+// operations that are too small for a classic fork/join parallel region.
+//
+// A team of size \f$ N \f$ consists of the calling thread and \f$ N-1 \f$ worker threads. In
+// order to execute a job, the job is published via the broadcast slot and all members of the
+// team (including the calling thread) execute the job with their rank (\f$ 0 \f$ for the
+// calling thread, \f$ 1 \ldots N-1 \f$ for the worker threads) and the size of the team:
+
+   \code
+   // Definition of a job that doubles all elements of an array in parallel
+   class Doubling : public blaze::ThreadTeam::Job
+   {
+    public:
+      Doubling( double* array, size_t size ) : array_( array ), size_( size ) {}
+
+      void operator()( size_t rank, size_t size ) const {
+         const size_t share( ( size_ + size - 1UL ) / size );
+         for( size_t i=rank*share; i<size_ && i<(rank+1UL)*share; ++i )
+            array_[i] *= 2.0;
+      }
+
+    private:
+      double* array_;
+      size_t  size_;
+   };
+
+   blaze::ThreadTeam team( 4 );          // Team of the calling thread and three worker threads
+   team.run( Doubling( array, 1000UL ) );  // Parallel execution of the job
+   \endcode
+
+// The run() function returns as soon as all members of the team have completed the job. In
+// case any member of the team throws an exception, the first exception is transported to the
+// calling thread and rethrown by the run() function.
+//
+// In between two jobs, the worker threads spin on the broadcast slot for a configurable number
+// of iterations (see the \a spin parameter of the constructor) before they park on a condition
+// variable. Therefore consecutive jobs don't suffer from the wake-up latency of the operating
+// system, whereas idle teams don't consume any CPU time. Additionally, the worker threads can
+// be pinned to individual cores (see the \a pin parameter of the constructor) in order to avoid
+// the migration of threads between cores and to preserve the cache contents between jobs. For
+// a finer control of the placement of the threads (for instance in order to restrict the team
+// to a subset of the CPUs or to spread the team across sockets), the logical CPUs of the worker
+// threads can be specified explicitly (see the Topology class description):
+
+   \code
+   const blaze::Topology topology;
+   blaze::ThreadTeam team( 8UL, 20000UL, topology.place( 8UL, blaze::Topology::spread ) );
+   \endcode
+//
+// Only a single job can be executed by a team at any point in time. In case the run() function
+// is called while the team is busy (for instance from within a running job or concurrently by
+// several threads), the job is executed serially by the calling thread with rank 0 and a team
+// size of 1. Therefore any job must be able to handle an arbitrary team size.
+*/
+class ThreadTeam : private NonCopyable
+{
+ public:
+   //**Job class definition************************************************************************
+   /*!\brief Base class for all jobs executed by a thread team.
+   //
+   // The function call operator of a job is called once by each member of the executing team.
+   // It receives the rank of the calling member (in the range \f$ [0..size) \f$) and the total
+   // number of members executing the job.
+   */
+   class Job
+   {
+    public:
+      //**Destructor*******************************************************************************
+      virtual ~Job() {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Execution of the job by a single member of the team.
+      //
+      // \param rank The rank of the executing team member \f$ [0..size) \f$.
+      // \param size The total number of team members executing the job.
+      // \return void
+      */
+      virtual void operator()( size_t rank, size_t size ) const = 0;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef boost::mutex               Mutex;      //!< Type of the mutex.
+   typedef Mutex::scoped_lock         Lock;       //!< Type of a locking object.
+   typedef boost::condition_variable  Condition;  //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit ThreadTeam( size_t n, size_t spin=20000UL, bool pin=false );
+   explicit ThreadTeam( size_t n, size_t spin, const std::vector<size_t>& cpus );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ThreadTeam();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t                     size()   const;
+   inline size_t                     spin()   const;
+   inline bool                       pinned() const;
+   inline size_t                     parked() const;
+   inline const std::vector<size_t>& cpus()   const;
+   //@}
+   //**********************************************************************************************
+
+   //**Execution functions*************************************************************************
+   /*!\name Execution functions */
+   //@{
+   void run( const Job& job );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void   work( size_t rank );
+   size_t await( size_t epoch );
+   void   execute( const Job& job, size_t rank, size_t size );
+   void   launch();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const size_t size_;                //!< Total number of members of the team.
+   const size_t spin_;                //!< Number of spin iterations before a worker parks.
+   bool pinned_;                      //!< \a true in case the worker threads are pinned to cores.
+   std::vector<size_t> cpus_;         //!< The logical CPUs of all ranks (empty if not pinned).
+   boost::atomic<size_t> epoch_;      //!< The broadcast slot of the team.
+                                      /*!< Each published job increments the epoch by one. */
+   boost::atomic<const Job*> job_;    //!< The job of the current epoch.
+   boost::atomic<size_t> running_;    //!< Number of worker threads still executing the job.
+   boost::atomic<size_t> parked_;     //!< Number of parked worker threads.
+   boost::atomic<bool> shutdown_;     //!< Termination flag for the worker threads.
+   boost::exception_ptr error_;       //!< The first exception thrown during the current job.
+   boost::thread_group threads_;      //!< The worker threads of the team.
+   Mutex dispatch_;                   //!< Mutex for the exclusive use of the team.
+   Mutex mutex_;                      //!< Synchronization mutex for parking worker threads.
+   Condition wakeup_;                 //!< Wait condition for parked worker threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of members of the team.
+//
+// \return The total number of team members (including the calling thread).
+*/
+inline size_t ThreadTeam::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of spin iterations before an idle worker thread parks.
+//
+// \return The number of spin iterations.
+*/
+inline size_t ThreadTeam::spin() const
+{
+   return spin_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the worker threads of the team are pinned to individual cores.
+//
+// \return \a true in case the worker threads are pinned, \a false if not.
+//
+// Note that the pinning of threads is not supported on all platforms. In case the pinning was
+// requested but is not supported, this function returns \a false.
+*/
+inline bool ThreadTeam::pinned() const
+{
+   return pinned_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently parked worker threads.
+//
+// \return The number of worker threads waiting on the condition variable.
+*/
+inline size_t ThreadTeam::parked() const
+{
+   return parked_.load();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the logical CPUs of the members of the team.
+//
+// \return The operating system IDs of the logical CPUs of all ranks.
+//
+// This function returns the logical CPU of each rank of the team. In case the worker threads are
+// not pinned, the returned list is empty. Note that the calling thread (i.e. rank 0) is never
+// bound by the team, i.e. the first entry only states the intended logical CPU of rank 0.
+*/
+inline const std::vector<size_t>& ThreadTeam::cpus() const
+{
+   return cpus_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,234 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Topology.h
+//  \brief Header file of the Topology class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TOPOLOGY_H_
+#define _BLAZE_UTIL_TOPOLOGY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of the processor topology of a shared-memory system.
+// \ingroup threads
+//
+// \section topology_general General
+//
+// The Topology class describes the logical CPUs available to the calling process, i.e. for each
+// logical CPU its operating system ID, its physical core, its socket and its NUMA node. The
+// default constructor detects the topology of the system (on Linux via the \c sysfs file system)
+// and only lists the logical CPUs contained in the affinity mask of the process. Therefore the
+// topology of a process that has been restricted to a subset of the CPUs (for instance via
+// \c taskset or a container runtime) only contains the CPUs available to the process. On
+// platforms on which the topology cannot be detected, every logical CPU is considered to be a
+// separate core of a single socket and NUMA node.
+//
+//
+// \section topology_placement Thread placement
+//
+// The place() function computes the logical CPUs for a given number of threads according to one
+// of two placement policies:
+//
+//  - \b compact: The threads are placed as close as possible, i.e. the SMT siblings of a core
+//    are filled first, then the cores of a socket and then the next socket.
+//  - \b spread: The threads are distributed as evenly as possible, i.e. the threads are placed
+//    round-robin on the available sockets and on a separate physical core each. SMT siblings
+//    are only used in case all physical cores are occupied.
+//
+// The resulting list of CPUs can be used to bind the threads of a ThreadPool (see the
+// ThreadPool::setAffinity() function), of a ThreadTeam (see the according ThreadTeam
+// constructor) or individual threads (see the bindThread() and bindCurrentThread() functions).
+// In case of a compact placement, the threads of each NUMA node are assigned consecutive ranks.
+// Since the thread team based SMP backend assigns consecutive rows/columns to consecutive ranks,
+// each NUMA node therefore operates on a contiguous and node-local block of rows/columns:
+
+   \code
+   const blaze::Topology topology;                      // Topology of the available CPUs
+   std::vector<size_t> cpus( topology.place( 8UL, blaze::Topology::compact ) );
+
+   blaze::ThreadPool pool( 8UL );
+   pool.setAffinity( cpus );                            // Binding the threads of the pool
+
+   blaze::ThreadTeam team( 8UL, 20000UL, cpus );        // Binding the threads of the team
+   \endcode
+
+// In order to restrict the placement to a subset of the CPUs (for instance to the CPUs that are
+// not used by other tenants), a topology can be restricted to a given CPU list:
+
+   \code
+   const blaze::Topology topology( blaze::Topology().subset( blaze::parseCpuList( "0-7,16-23" ) ) );
+   \endcode
+*/
+class Topology
+{
+ public:
+   //**Placement policies**************************************************************************
+   /*!\brief Placement policies for threads.
+   */
+   enum Placement {
+      compact = 0,  //!< Placement of threads on neighboring logical CPUs.
+      spread  = 1   //!< Placement of threads on separate sockets and cores.
+   };
+   //**********************************************************************************************
+
+   //**Cpu struct definition***********************************************************************
+   /*!\brief Description of a single logical CPU.
+   */
+   struct Cpu
+   {
+      size_t id;      //!< The operating system ID of the logical CPU.
+      size_t core;    //!< The ID of the physical core (unique within the socket).
+      size_t socket;  //!< The ID of the socket.
+      size_t node;    //!< The ID of the NUMA node.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit Topology();
+   explicit Topology( const std::vector<Cpu>& cpus );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t     size()    const;
+   inline const Cpu& operator[]( size_t index ) const;
+          size_t     cores()   const;
+          size_t     sockets() const;
+          size_t     nodes()   const;
+          size_t     node( size_t id ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Topology            subset( const std::vector<size_t>& ids ) const;
+   std::vector<size_t> place( size_t n, Placement placement ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Cpu> cpus_;  //!< The logical CPUs ordered by NUMA node, socket, core and ID.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of logical CPUs.
+//
+// \return The number of logical CPUs of the topology.
+*/
+inline size_t Topology::size() const
+{
+   return cpus_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the logical CPUs of the topology.
+//
+// \param index Access index for the logical CPU. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the description of the accessed logical CPU.
+//
+// The logical CPUs are ordered by NUMA node, by socket, by core and by their ID.
+*/
+inline const Topology::Cpu& Topology::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < cpus_.size(), "Invalid CPU access index" );
+   return cpus_[index];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Topology functions */
+//@{
+std::vector<size_t> parseCpuList( const std::string& list );
+
+bool bindThread( boost::thread& thread, const std::vector<size_t>& cpus );
+
+bool bindCurrentThread( const std::vector<size_t>& cpus );
+//@}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,325 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/FutureState.h
+//  \brief Header file of the FutureState class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_FUTURESTATE_H_
+#define _BLAZE_UTIL_THREADPOOL_FUTURESTATE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+class ThreadPool;
+
+
+
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Shared state of an asynchronously executed task.
+// \ingroup threads
+//
+// The FutureState class represents the state that is shared between an asynchronously executed
+// task and all Future handles referring to this task. It stores the task itself, its completion
+// flag and its exception and manages the continuations that have to be executed as soon as the
+// task has been completed (i.e. the notifications of the tasks depending on the task).
+*/
+class FutureState : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef std::vector<Task>          Continuations;  //!< Type of the continuation container.
+   typedef boost::mutex               Mutex;          //!< Type of the mutex.
+   typedef Mutex::scoped_lock         Lock;           //!< Type of a locking object.
+   typedef boost::condition_variable  Condition;      //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline FutureState( ThreadPool& pool, const Task& task, size_t dependencies );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline ThreadPool&                 pool()    const;
+   inline bool                        isReady() const;
+   inline const boost::exception_ptr& error()   const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void sleep() const;
+   inline bool release( const boost::exception_ptr& error );
+   inline void attach( const Task& continuation );
+   inline void execute();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ThreadPool& pool_;                     //!< The executing thread pool.
+   Task task_;                            //!< The asynchronously executed task.
+   boost::atomic<bool> ready_;            //!< Completion flag of the task.
+   boost::atomic<size_t> dependencies_;   //!< Number of uncompleted dependencies of the task.
+   boost::exception_ptr error_;           //!< The exception of the task or of a dependency.
+   Continuations continuations_;          //!< The tasks depending on the completion of the task.
+   mutable Mutex mutex_;                  //!< Synchronization mutex.
+   mutable Condition waitForTask_;        //!< Wait condition for the completion of the task.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FutureState class.
+//
+// \param pool The thread pool executing the task.
+// \param task The task to be executed asynchronously.
+// \param dependencies The number of tasks that have to be completed before the task is started.
+*/
+inline FutureState::FutureState( ThreadPool& pool, const Task& task, size_t dependencies )
+   : pool_         ( pool )          // The executing thread pool
+   , task_         ( task )          // The asynchronously executed task
+   , ready_        ( false )         // Completion flag of the task
+   , dependencies_ ( dependencies )  // Number of uncompleted dependencies of the task
+   , error_        ()                // The exception of the task or of a dependency
+   , continuations_()                // The tasks depending on the completion of the task
+   , mutex_        ()                // Synchronization mutex
+   , waitForTask_  ()                // Wait condition for the completion of the task
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the thread pool executing the task.
+//
+// \return Reference to the executing thread pool.
+*/
+inline ThreadPool& FutureState::pool() const
+{
+   return pool_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task has been completed.
+//
+// \return \a true in case the task has been completed, \a false if not.
+*/
+inline bool FutureState::isReady() const
+{
+   return ready_.load( boost::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the exception thrown by the task or by one of its dependencies.
+//
+// \return The exception of the task (empty in case no exception has been thrown).
+//
+// This function must only be called after the task has been completed.
+*/
+inline const boost::exception_ptr& FutureState::error() const
+{
+   return error_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocks the calling thread until the task has been completed, but at most one millisecond.
+//
+// \return void
+*/
+inline void FutureState::sleep() const
+{
+   Lock lock( mutex_ );
+   if( !ready_.load( boost::memory_order_relaxed ) )
+      waitForTask_.timed_wait( lock, boost::posix_time::milliseconds( 1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Notification about the completion of a dependency of the task.
+//
+// \param error The exception of the completed dependency.
+// \return \a true in case all dependencies have been completed, \a false if not.
+//
+// This function is called by the continuations of all dependencies of the task. In case one
+// of the dependencies failed, the exception of the first failing dependency is stored as the
+// exception of the task.
+*/
+inline bool FutureState::release( const boost::exception_ptr& error )
+{
+   if( error ) {
+      Lock lock( mutex_ );
+      if( !error_ ) error_ = error;
+   }
+
+   return dependencies_.fetch_sub( 1UL, boost::memory_order_acq_rel ) == 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaching a continuation to the task.
+//
+// \param continuation The task to be executed as soon as the task has been completed.
+// \return void
+//
+// In case the task has already been completed, the given continuation is executed immediately
+// by the calling thread. Otherwise it is executed by the thread completing the task.
+*/
+inline void FutureState::attach( const Task& continuation )
+{
+   {
+      Lock lock( mutex_ );
+      if( !ready_.load( boost::memory_order_relaxed ) ) {
+         continuations_.push_back( continuation );
+         return;
+      }
+   }
+
+   continuation();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing and completing the task.
+//
+// \return void
+//
+// This function executes the task (unless one of its dependencies failed), marks the task as
+// completed, wakes up all threads waiting for the task and executes all attached continuations.
+// Any exception thrown by the task is stored and can be retrieved via the error() function.
+*/
+inline void FutureState::execute()
+{
+   boost::exception_ptr error;
+
+   if( !error_ ) {
+      try {
+         task_();
+      }
+      catch( ... ) {
+         error = boost::current_exception();
+      }
+   }
+
+   task_.reset();
+
+   Continuations continuations;
+
+   {
+      Lock lock( mutex_ );
+      if( error ) error_ = error;
+      ready_.store( true, boost::memory_order_release );
+      continuations.swap( continuations_ );
+      waitForTask_.notify_all();
+   }
+
+   for( Continuations::const_iterator it=continuations.begin(); it!=continuations.end(); ++it ) {
+      (*it)();
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
 //  \file blaze/util/threadpool/Task.h
-//  \brief Header file for the Task base class
+//  \brief Header file for the Task class
 //
 //  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
 //
@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
-#include <boost/function.hpp>
+#include <new>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -49,15 +52,333 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*!\brief Handle for a single, executable task.
 // \ingroup threads
+//
+// The Task class represents a single, copyable task that can be scheduled for execution by a
+// thread pool. It can hold any copyable function/functor that is callable without arguments.
+// In contrast to \c boost::function, the Task class stores functions/functors of up to
+// \a bufferSize bytes (which includes function pointers and the result of \c boost::bind with
+// up to five arguments of built-in type) in an internal buffer and therefore does not require
+// any dynamic memory allocation. Only larger functors are allocated on the heap.
 */
-typedef boost::function<void(void)>  Task;
+class Task
+{
+ public:
+   //**Constants***********************************************************************************
+   /*!\brief Size of the internal buffer for small functions/functors (in bytes). */
+   static const size_t bufferSize = 64UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Task();
+
+   template< typename Callable >
+   explicit inline Task( Callable func );
+
+   inline Task( const Task& task );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   inline Task& operator=( const Task& task );
+   inline void  operator()() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Callable >
+   inline void assign( Callable func );
+
+   inline bool isEmpty() const;
+   inline void reset();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef void (*Invoke) ( void* );              //!< Type of the invocation function.
+   typedef void (*Clone)  ( const void*, void* ); //!< Type of the copy function.
+   typedef void (*Destroy)( void* );              //!< Type of the destruction function.
+   //**********************************************************************************************
+
+   //**Struct Manager******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Type-specific management of a stored function/functor.
+   //
+   // The Manager class template provides the type-specific functions to invoke, copy and destroy
+   // a stored function/functor. In case the function/functor fits into the internal buffer of
+   // the task (i.e. \a Local is \a true) it is constructed in place, otherwise it is allocated
+   // dynamically and only a pointer to it is stored in the buffer.
+   */
+   template< typename Callable, bool Local = ( sizeof(Callable) <= bufferSize ) >
+   struct Manager
+   {
+      static void create( void* buffer, const Callable& func ) {
+         ::new( buffer ) Callable( func );
+      }
+      static void invoke( void* buffer ) {
+         ( *static_cast<Callable*>( buffer ) )();
+      }
+      static void clone( const void* src, void* dst ) {
+         ::new( dst ) Callable( *static_cast<const Callable*>( src ) );
+      }
+      static void destroy( void* buffer ) {
+         static_cast<Callable*>( buffer )->~Callable();
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Struct Manager******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Specialization of the Manager class template for large functions/functors.
+   */
+   template< typename Callable >
+   struct Manager<Callable,false>
+   {
+      static void create( void* buffer, const Callable& func ) {
+         *static_cast<Callable**>( buffer ) = new Callable( func );
+      }
+      static void invoke( void* buffer ) {
+         ( **static_cast<Callable**>( buffer ) )();
+      }
+      static void clone( const void* src, void* dst ) {
+         *static_cast<Callable**>( dst ) = new Callable( **static_cast<Callable* const*>( src ) );
+      }
+      static void destroy( void* buffer ) {
+         delete *static_cast<Callable**>( buffer );
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Union Storage*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Suitably aligned internal buffer for the stored function/functor.
+   */
+   union Storage
+   {
+      byte        buffer_[bufferSize];  //!< The raw memory of the internal buffer.
+      void*       pointer_;             //!< Dummy member for the alignment of pointers.
+      long double float_;               //!< Dummy member for the alignment of floating point values.
+      Invoke      function_;            //!< Dummy member for the alignment of function pointers.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Invoke  invoke_;   //!< Invocation function of the stored function/functor.
+   Clone   clone_;    //!< Copy function of the stored function/functor.
+   Destroy destroy_;  //!< Destruction function of the stored function/functor.
+   Storage storage_;  //!< Internal buffer for the stored function/functor.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Task.
+//
+// The default constructor creates an empty task that must not be executed.
+*/
+inline Task::Task()
+   : invoke_ ( 0 )  // Invocation function of the stored function/functor
+   , clone_  ( 0 )  // Copy function of the stored function/functor
+   , destroy_( 0 )  // Destruction function of the stored function/functor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a task executing the given function/functor.
+//
+// \param func The given function/functor.
+//
+// The given function/functor must be copyable, must be callable without arguments and must
+// return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline Task::Task( Callable func )
+   : invoke_ ( 0 )  // Invocation function of the stored function/functor
+   , clone_  ( 0 )  // Copy function of the stored function/functor
+   , destroy_( 0 )  // Destruction function of the stored function/functor
+{
+   assign( func );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for Task.
+//
+// \param task The task to be copied.
+*/
+inline Task::Task( const Task& task )
+   : invoke_ ( task.invoke_  )  // Invocation function of the stored function/functor
+   , clone_  ( task.clone_   )  // Copy function of the stored function/functor
+   , destroy_( task.destroy_ )  // Destruction function of the stored function/functor
+{
+   if( clone_ != 0 )
+      clone_( task.storage_.buffer_, storage_.buffer_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Task.
+*/
+inline Task::~Task()
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for Task.
+//
+// \param task The task to be copied.
+// \return Reference to the assigned task.
+*/
+inline Task& Task::operator=( const Task& task )
+{
+   if( &task == this ) return *this;
+
+   reset();
+
+   if( task.clone_ != 0 )
+      task.clone_( task.storage_.buffer_, storage_.buffer_ );
+
+   invoke_  = task.invoke_;
+   clone_   = task.clone_;
+   destroy_ = task.destroy_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution of the stored function/functor.
+//
+// \return void
+*/
+inline void Task::operator()() const
+{
+   BLAZE_USER_ASSERT( invoke_ != 0, "Execution of empty task detected" );
+   invoke_( const_cast<byte*>( storage_.buffer_ ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assigning a new function/functor to the task.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function replaces the currently stored function/functor by the given function/functor.
+// The given function/functor must be copyable, must be callable without arguments and must
+// return void.
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::assign( Callable func )
+{
+   typedef Manager<Callable>  M;
+
+   reset();
+
+   M::create( storage_.buffer_, func );
+
+   invoke_  = &M::invoke;
+   clone_   = &M::clone;
+   destroy_ = &M::destroy;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the task is empty.
+//
+// \return \a true in case the task does not contain a function/functor, \a false if it does.
+*/
+inline bool Task::isEmpty() const
+{
+   return invoke_ == 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroying the stored function/functor.
+//
+// \return void
+//
+// After this function the task is empty.
+*/
+inline void Task::reset()
+{
+   if( destroy_ != 0 )
+      destroy_( storage_.buffer_ );
+
+   invoke_  = 0;
+   clone_   = 0;
+   destroy_ = 0;
+}
 //*************************************************************************************************
 
 } // namespace threadpool
@@ -0,0 +1,326 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskNode.h
+//  \brief Header file for the TaskNode class and the TaskNodePool class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKNODE_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKNODE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+class TaskGroup;
+
+
+
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  ::blaze::threadpool NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+class TaskNodePool;
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TASKNODE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling unit of the thread pool.
+// \ingroup threads
+//
+// The TaskNode class represents a single scheduled task within a thread pool. Next to the
+// executable task itself it contains the bookkeeping information of the scheduler: the (optional)
+// task group the task belongs to, the generation of the thread pool at the time of scheduling,
+// the pool the node has been allocated from and an intrusive link for the task and free lists.
+*/
+struct TaskNode
+{
+   Task          task_;        //!< The executable task.
+   TaskGroup*    group_;       //!< The parent task group of the task (optional).
+   size_t        generation_;  //!< The generation of the thread pool at scheduling time.
+   TaskNodePool* home_;        //!< The pool the node has been allocated from.
+   TaskNode*     next_;        //!< Intrusive link for the task queue and the free lists.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TASKNODEPOOL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory pool for task nodes.
+// \ingroup threads
+//
+// The TaskNodePool class manages the memory of task nodes. Each worker thread of a thread pool
+// owns a single task node pool, which is exclusively used by this thread to allocate new nodes.
+// Task nodes are allocated in blocks of \a blockSize nodes and are never returned to the
+// system before the destruction of the pool. Since task nodes are typically released by a
+// different thread than the allocating thread (as for instance in case the according task is
+// stolen), the pool manages two free lists: the local free list is exclusively accessed by the
+// owning thread, the remote free list is a lock-free stack that can be accessed by any thread.
+// The owning thread reclaims the complete remote free list at once in case its local free list
+// is exhausted, which makes the pool immune to the ABA problem.
+*/
+class TaskNodePool : private NonCopyable
+{
+ public:
+   //**Constants***********************************************************************************
+   /*!\brief Number of task nodes per allocated memory block. */
+   static const size_t blockSize = 256UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskNodePool();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskNodePool();
+   //@}
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   inline TaskNode* allocate();
+   inline void      release( TaskNode* node );
+   inline void      releaseRemote( TaskNode* node );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   void allocateBlock();
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<TaskNode*>  Blocks;  //!< Container for the allocated memory blocks.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TaskNode* local_;                   //!< Head of the local free list.
+   boost::atomic<TaskNode*> remote_;   //!< Head of the remote free list.
+   Blocks blocks_;                     //!< The allocated memory blocks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for TaskNodePool.
+*/
+inline TaskNodePool::TaskNodePool()
+   : local_ ( NULL )  // Head of the local free list
+   , remote_( NULL )  // Head of the remote free list
+   , blocks_()        // The allocated memory blocks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for TaskNodePool.
+//
+// The destructor releases all allocated memory blocks. Note that at the time of destruction
+// all task nodes must have been released to the pool.
+*/
+inline TaskNodePool::~TaskNodePool()
+{
+   for( Blocks::iterator block=blocks_.begin(); block!=blocks_.end(); ++block ) {
+      delete [] *block;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of a single task node.
+//
+// \return Pointer to the newly allocated task node.
+//
+// This function must only be called by the owning thread of the pool.
+*/
+inline TaskNode* TaskNodePool::allocate()
+{
+   if( local_ == NULL ) {
+      local_ = remote_.exchange( NULL, boost::memory_order_acquire );
+      if( local_ == NULL )
+         allocateBlock();
+   }
+
+   BLAZE_INTERNAL_ASSERT( local_ != NULL, "Exhausted task node pool detected" );
+
+   TaskNode* node( local_ );
+   local_ = node->next_;
+
+   node->group_ = NULL;
+   node->home_  = this;
+   node->next_  = NULL;
+
+   return node;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Release of a task node by the owning thread of the pool.
+//
+// \param node The task node to be released.
+// \return void
+//
+// This function must only be called by the owning thread of the pool. Any other thread has to
+// use the releaseRemote() function.
+*/
+inline void TaskNodePool::release( TaskNode* node )
+{
+   BLAZE_INTERNAL_ASSERT( node->home_ == this, "Invalid task node detected" );
+
+   node->task_.reset();
+   node->next_ = local_;
+   local_ = node;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Release of a task node by an arbitrary thread.
+//
+// \param node The task node to be released.
+// \return void
+//
+// This function can be called by any thread in order to return a task node to the pool.
+*/
+inline void TaskNodePool::releaseRemote( TaskNode* node )
+{
+   BLAZE_INTERNAL_ASSERT( node->home_ == this, "Invalid task node detected" );
+
+   node->task_.reset();
+
+   TaskNode* head( remote_.load( boost::memory_order_relaxed ) );
+   do {
+      node->next_ = head;
+   } while( !remote_.compare_exchange_weak( head, node, boost::memory_order_release,
+                                                        boost::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a new block of task nodes.
+//
+// \return void
+*/
+inline void TaskNodePool::allocateBlock()
+{
+   TaskNode* block( new TaskNode[blockSize] );
+   blocks_.push_back( block );
+
+   for( size_t i=0UL; i<blockSize-1UL; ++i ) {
+      block[i].next_ = block+i+1UL;
+   }
+   block[blockSize-1UL].next_ = local_;
+
+   local_ = block;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,392 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Header file for the WorkStealingDeque class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <boost/atomic.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/threadpool/TaskNode.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for task nodes.
+// \ingroup threads
+//
+// The WorkStealingDeque class implements the lock-free, dynamically growing work-stealing deque
+// by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005) in the formulation for
+// the C++11 memory model by Le et al. ("Correct and Efficient Work-Stealing for Weak Memory
+// Models", PPoPP 2013). Each worker thread of a thread pool owns a single deque: only the
+// owning thread is allowed to push() and pop() task nodes at the bottom end of the deque (LIFO),
+// whereas any other thread can steal() task nodes from the top end of the deque (FIFO). Since
+// the owner and the thieves operate on different ends of the deque, synchronization is only
+// required in case the deque contains a single task node.\n
+// In case the deque is full, the owning thread replaces the internal ring buffer by a buffer
+// of twice the capacity. Since thieves may still access the old buffer, all buffers are kept
+// alive until the destruction of the deque.
+*/
+class WorkStealingDeque : private NonCopyable
+{
+ private:
+   //**Struct Buffer*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Ring buffer of the work-stealing deque.
+   */
+   struct Buffer : private NonCopyable
+   {
+      explicit inline Buffer( size_t capacity )
+         : mask_ ( capacity-1UL )                              // Index mask of the ring buffer
+         , nodes_( new boost::atomic<TaskNode*>[capacity] )    // The contained task nodes
+      {}
+
+      inline ~Buffer() { delete [] nodes_; }
+
+      inline TaskNode* get( ptrdiff_t index ) const {
+         return nodes_[index & mask_].load( boost::memory_order_relaxed );
+      }
+
+      inline void put( ptrdiff_t index, TaskNode* node ) {
+         nodes_[index & mask_].store( node, boost::memory_order_relaxed );
+      }
+
+      inline ptrdiff_t capacity() const { return static_cast<ptrdiff_t>( mask_+1UL ); }
+
+      const size_t mask_;                //!< Index mask of the ring buffer.
+      boost::atomic<TaskNode*>* nodes_;  //!< The contained task nodes.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef std::vector<Buffer*>  Buffers;  //!< Container for all allocated buffers.
+   //**********************************************************************************************
+
+ public:
+   //**Constants***********************************************************************************
+   /*!\brief Initial capacity of the deque (must be a power of two). */
+   static const size_t initialCapacity = 256UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkStealingDeque();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size()    const;
+   inline bool   isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void      push ( TaskNode* node );
+   inline TaskNode* pop  ();
+   inline TaskNode* steal();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Buffer* grow( Buffer* buffer, ptrdiff_t bottom, ptrdiff_t top );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::atomic<ptrdiff_t> top_;      //!< Index of the top end of the deque.
+   char padding1_[64];                 //!< Padding to avoid false sharing between top and bottom.
+   boost::atomic<ptrdiff_t> bottom_;   //!< Index of the bottom end of the deque.
+   boost::atomic<Buffer*>   buffer_;   //!< The current ring buffer.
+   Buffers                  buffers_;  //!< All allocated ring buffers.
+   char padding2_[64];                 //!< Padding to avoid false sharing with adjacent deques.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for WorkStealingDeque.
+*/
+inline WorkStealingDeque::WorkStealingDeque()
+   : top_     ( 0 )     // Index of the top end of the deque
+   , bottom_  ( 0 )     // Index of the bottom end of the deque
+   , buffer_  ( NULL )  // The current ring buffer
+   , buffers_ ()        // All allocated ring buffers
+{
+   Buffer* buffer( new Buffer( initialCapacity ) );
+   buffers_.push_back( buffer );
+   buffer_.store( buffer, boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for WorkStealingDeque.
+//
+// The destructor releases all ring buffers. Note that the contained task nodes are not released.
+*/
+inline WorkStealingDeque::~WorkStealingDeque()
+{
+   for( Buffers::iterator buffer=buffers_.begin(); buffer!=buffers_.end(); ++buffer ) {
+      delete *buffer;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of task nodes in the deque.
+//
+// \return The current number of task nodes.
+//
+// Note that the returned value is only a snapshot in case other threads concurrently access
+// the deque.
+*/
+inline size_t WorkStealingDeque::size() const
+{
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( boost::memory_order_relaxed ) );
+   return ( bottom > top )?( static_cast<size_t>( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the deque has no elements.
+//
+// \return \a true if the deque is empty, \a false if it is not.
+//
+// Note that the returned value is only a snapshot in case other threads concurrently access
+// the deque.
+*/
+inline bool WorkStealingDeque::isEmpty() const
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task node to the bottom end of the deque.
+//
+// \param node The task node to be added.
+// \return void
+//
+// This function must only be called by the owning thread of the deque.
+*/
+inline void WorkStealingDeque::push( TaskNode* node )
+{
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( boost::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( boost::memory_order_relaxed ) );
+
+   if( bottom - top > buffer->capacity() - 1 ) {
+      buffer = grow( buffer, bottom, top );
+   }
+
+   buffer->put( bottom, node );
+   boost::atomic_thread_fence( boost::memory_order_release );
+   bottom_.store( bottom+1, boost::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task node from the bottom end of the deque.
+//
+// \return The removed task node or NULL in case the deque is empty.
+//
+// This function must only be called by the owning thread of the deque.
+*/
+inline TaskNode* WorkStealingDeque::pop()
+{
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( boost::memory_order_relaxed ) );
+   bottom_.store( bottom, boost::memory_order_relaxed );
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+   ptrdiff_t top( top_.load( boost::memory_order_relaxed ) );
+
+   if( top > bottom ) {
+      bottom_.store( bottom+1, boost::memory_order_relaxed );
+      return NULL;
+   }
+
+   TaskNode* node( buffer->get( bottom ) );
+
+   if( top == bottom ) {
+      if( !top_.compare_exchange_strong( top, top+1, boost::memory_order_seq_cst,
+                                                     boost::memory_order_relaxed ) ) {
+         node = NULL;
+      }
+      bottom_.store( bottom+1, boost::memory_order_relaxed );
+   }
+
+   return node;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing a task node from the top end of the deque.
+//
+// \return The stolen task node or NULL in case the deque is empty or the steal failed.
+//
+// This function can be called by any thread. In case another thread concurrently removes the
+// top task node the function returns NULL.
+*/
+inline TaskNode* WorkStealingDeque::steal()
+{
+   ptrdiff_t top( top_.load( boost::memory_order_acquire ) );
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+   const ptrdiff_t bottom( bottom_.load( boost::memory_order_acquire ) );
+
+   if( top >= bottom )
+      return NULL;
+
+   Buffer* buffer( buffer_.load( boost::memory_order_acquire ) );
+   TaskNode* node( buffer->get( top ) );
+
+   if( !top_.compare_exchange_strong( top, top+1, boost::memory_order_seq_cst,
+                                                  boost::memory_order_relaxed ) ) {
+      return NULL;
+   }
+
+   return node;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Replacing the current ring buffer by a buffer of twice the capacity.
+//
+// \param buffer The current ring buffer.
+// \param bottom The current index of the bottom end of the deque.
+// \param top The current index of the top end of the deque.
+// \return The new ring buffer.
+*/
+inline WorkStealingDeque::Buffer*
+   WorkStealingDeque::grow( Buffer* buffer, ptrdiff_t bottom, ptrdiff_t top )
+{
+   Buffer* tmp( new Buffer( 2UL*static_cast<size_t>( buffer->capacity() ) ) );
+   buffers_.push_back( tmp );
+
+   for( ptrdiff_t i=top; i<bottom; ++i ) {
+      tmp->put( i, buffer->get( i ) );
+   }
+
+   buffer_.store( tmp, boost::memory_order_release );
+   return tmp;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,123 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Worker.h
+//  \brief Header file for the Worker class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKER_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <boost/thread/thread.hpp>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/TaskNode.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling context of a single thread within a thread pool.
+// \ingroup threads
+//
+// The Worker class represents the scheduling context of a single thread that schedules or
+// executes tasks of a thread pool. Each worker thread of a thread pool as well as each external
+// thread that schedules tasks for a thread pool owns exactly one worker. The worker contains
+// the thread's work-stealing deque and task node pool. Whereas the deques of worker threads
+// receive the tasks scheduled from within a running task, the deques of external threads serve
+// as lock-free submission queues, from which the worker threads steal their work.
+*/
+struct Worker : private NonCopyable
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the Worker class.
+   //
+   // \param index The index of the worker within the thread pool.
+   // \param external \a true for the worker of an external thread, \a false otherwise.
+   */
+   explicit inline Worker( size_t index, bool external )
+      : deque_   ()                                 // The work-stealing deque of the worker
+      , nodes_   ()                                 // The task node pool of the worker
+      , thread_  ()                                 // The thread of execution of the worker
+      , id_      ()                                 // The ID of the thread of execution
+      , index_   ( index )                          // The index of the worker
+      , seed_    ( 2654435761UL*( index+1UL ) )     // Random seed for the selection of victims
+      , external_( external )                       // Flag for external threads
+      , running_ ( false )                          // Running flag of worker threads
+   {}
+   //**********************************************************************************************
+
+   //**Victim selection****************************************************************************
+   /*!\brief Returns a pseudo-random number for the selection of a victim.
+   //
+   // \return The next pseudo-random number.
+   */
+   inline size_t random() {
+      seed_ ^= seed_ << 13;
+      seed_ ^= seed_ >> 7;
+      seed_ ^= seed_ << 17;
+      return seed_;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   WorkStealingDeque  deque_;     //!< The work-stealing deque of the worker.
+   TaskNodePool       nodes_;     //!< The task node pool of the worker.
+   UniquePtr<Thread>  thread_;    //!< The thread of execution of the worker (not for external threads).
+   boost::thread::id  id_;        //!< The ID of the thread of execution.
+   const size_t       index_;     //!< The index of the worker.
+   size_t             seed_;      //!< Random seed for the selection of victims.
+   const bool         external_;  //!< \a true for the worker of an external thread.
+   bool               running_;   //!< Running flag of worker threads (protected by the pool mutex).
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,447 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/timing/PerfPolicy.h
+//  \brief Hardware performance counter timing policy for the Timer class.
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TIMING_PERFPOLICY_H_
+#define _BLAZE_UTIL_TIMING_PERFPOLICY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <cstring>
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+namespace timing {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Timing policy for wall clock time measurements with hardware performance counters.
+// \ingroup timing
+//
+// The PerfPolicy class represents the timing policy for wall clock time measurements that
+// additionally samples the hardware performance counters of the CPU (via the Linux perf_event
+// interface). It can be used in combination with the Timer class template. This combination
+// is realized with the PerfTimer type definition. The counters have to be explicitly enabled
+// via the enable() function. Afterwards, the counts of the most recent time measurement can be
+// queried via the last() function:
+
+   \code
+   PerfPolicy::enable();
+
+   PerfTimer timer;
+   ...  // Programm or code fragment to be measured
+   timer.end();
+
+   const double ipc( PerfPolicy::last( PerfPolicy::instructions ) /
+                     PerfPolicy::last( PerfPolicy::cycles ) );
+   \endcode
+
+// The counters are sampled at the beginning and at the end of each time measurement and count
+// the events in user space of the calling thread and of all threads that are created after
+// the counters have been enabled (as for instance the threads of the SMP backend). Therefore
+// the counters should be enabled at the very beginning of the program. Since all timers share
+// the same counters, the counts returned by last() always refer to the two most recent time
+// stamps, i.e. nested or concurrent time measurements are not supported. In case the counters
+// are not enabled or not available on the current platform (as for instance on non-Linux
+// systems, in virtual machines or due to the \c perf_event_paranoid setting), the PerfPolicy
+// behaves exactly like the WcPolicy and all counts are 0.
+*/
+struct PerfPolicy
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Hardware events counted by the PerfPolicy.
+   enum Event {
+      cycles       = 0,  //!< The number of CPU cycles.
+      instructions = 1,  //!< The number of retired instructions.
+      l1Misses     = 2,  //!< The number of L1 data cache read misses.
+      llcMisses    = 3,  //!< The number of last level cache misses.
+      branchMisses = 4,  //!< The number of mispredicted branches.
+      events       = 5   //!< The total number of events.
+   };
+   //**********************************************************************************************
+
+   //**Timing functions****************************************************************************
+   /*!\name Timing functions */
+   //@{
+   static inline double getTimestamp();
+   //@}
+   //**********************************************************************************************
+
+   //**Counter functions***************************************************************************
+   /*!\name Counter functions */
+   //@{
+   static inline bool   enable     ();
+   static inline void   disable    ();
+   static inline bool   isEnabled  ();
+   static inline bool   isAvailable( Event event );
+   static inline double last       ( Event event );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief The file descriptors and the two most recent samples of all hardware counters.
+   */
+   struct Counters : private NonCopyable
+   {
+      inline Counters();
+      inline ~Counters();
+
+      int    fd_      [events];  //!< The file descriptors of the counters (-1 if not available).
+      double previous_[events];  //!< The counts of the second most recent sample.
+      double current_ [events];  //!< The counts of the most recent sample.
+      bool   enabled_;           //!< Flag for enabled counters.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Counters& counters();
+   static inline void      sample  ( Counters& c );
+   static inline int       open    ( Event event );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR AND DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor of the Counters class.
+*/
+inline PerfPolicy::Counters::Counters()
+   : enabled_( false )  // Flag for enabled counters
+{
+   for( int i=0; i<events; ++i ) {
+      fd_[i]       = -1;
+      previous_[i] = 0.0;
+      current_[i]  = 0.0;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Destructor of the Counters class.
+//
+// The destructor closes all open hardware counters.
+*/
+inline PerfPolicy::Counters::~Counters()
+{
+#if defined(__linux__)
+   for( int i=0; i<events; ++i ) {
+      if( fd_[i] >= 0 ) ::close( fd_[i] );
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a timestamp of the current wall clock time in seconds.
+//
+// \return Wall clock timestamp in seconds.
+//
+// In case the hardware counters are enabled, this function additionally samples all counters.
+*/
+inline double PerfPolicy::getTimestamp()
+{
+   Counters& c( counters() );
+
+   if( c.enabled_ )
+      sample( c );
+
+   return getWcTime();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COUNTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Enables the hardware performance counters.
+//
+// \return \a true if at least one hardware counter is available, \a false if not.
+//
+// This function opens all hardware counters that are available on the current platform. In
+// case no counter is available, the counters remain disabled.
+*/
+inline bool PerfPolicy::enable()
+{
+   Counters& c( counters() );
+
+   if( c.enabled_ )
+      return true;
+
+   for( int i=0; i<events; ++i ) {
+      if( c.fd_[i] < 0 )
+         c.fd_[i] = open( static_cast<Event>( i ) );
+      c.enabled_ = c.enabled_ || c.fd_[i] >= 0;
+   }
+
+   if( c.enabled_ )
+      sample( c );
+
+   return c.enabled_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Disables the hardware performance counters.
+//
+// \return void
+//
+// After this call, the counters are not sampled anymore and all counts are reset to 0. Note
+// that the counters are not closed in order to be able to reenable them via enable().
+*/
+inline void PerfPolicy::disable()
+{
+   Counters& c( counters() );
+
+   c.enabled_ = false;
+
+   for( int i=0; i<events; ++i ) {
+      c.previous_[i] = 0.0;
+      c.current_[i]  = 0.0;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the hardware performance counters are enabled.
+//
+// \return \a true if the counters are enabled, \a false if not.
+*/
+inline bool PerfPolicy::isEnabled()
+{
+   return counters().enabled_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given hardware event is counted.
+//
+// \param event The hardware event.
+// \return \a true if the counters are enabled and the event is available, \a false if not.
+*/
+inline bool PerfPolicy::isAvailable( Event event )
+{
+   const Counters& c( counters() );
+   return c.enabled_ && c.fd_[event] >= 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of events counted during the most recent time measurement.
+//
+// \param event The hardware event.
+// \return The number of events between the two most recent timestamps.
+//
+// In case the counter of the given event is multiplexed with other counters by the operating
+// system, the returned count is extrapolated to the total time of the measurement. In case the
+// event is not available, the function returns 0.
+*/
+inline double PerfPolicy::last( Event event )
+{
+   const Counters& c( counters() );
+   return ( isAvailable( event ) )?( c.current_[event] - c.previous_[event] ):( 0.0 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the hardware counters shared by all timers.
+//
+// \return Reference to the hardware counters.
+*/
+inline PerfPolicy::Counters& PerfPolicy::counters()
+{
+   static Counters c;
+   return c;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Samples all available hardware counters.
+//
+// \param c The hardware counters.
+// \return void
+//
+// The most recent sample becomes the second most recent sample and all available counters
+// are read into the most recent sample.
+*/
+inline void PerfPolicy::sample( Counters& c )
+{
+#if defined(__linux__)
+   for( int i=0; i<events; ++i )
+   {
+      if( c.fd_[i] < 0 ) continue;
+
+      // Reading the count, the time the counter was enabled and the time it was running
+      uint64_t values[3] = { 0, 0, 0 };
+
+      c.previous_[i] = c.current_[i];
+
+      if( ::read( c.fd_[i], values, sizeof( values ) ) == sizeof( values ) && values[2] != 0 ) {
+         c.current_[i] = static_cast<double>( values[0] ) *
+                         static_cast<double>( values[1] ) / static_cast<double>( values[2] );
+      }
+   }
+#else
+   UNUSED_PARAMETER( c );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opens the hardware counter for the given event.
+//
+// \param event The hardware event.
+// \return The file descriptor of the counter or -1 in case the event is not available.
+//
+// The counter counts the user space events of the calling thread and of all threads created
+// after this call.
+*/
+inline int PerfPolicy::open( Event event )
+{
+#if defined(__linux__)
+   perf_event_attr attr;
+   std::memset( &attr, 0, sizeof( attr ) );
+
+   attr.size           = sizeof( attr );
+   attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+   attr.inherit        = 1;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv     = 1;
+
+   switch( event ) {
+      case cycles:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CPU_CYCLES;
+         break;
+      case instructions:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+         break;
+      case l1Misses:
+         attr.type   = PERF_TYPE_HW_CACHE;
+         attr.config = PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                       ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+         break;
+      case llcMisses:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CACHE_MISSES;
+         break;
+      case branchMisses:
+         attr.type   = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+         break;
+      default:
+         return -1;
+   }
+
+   const long fd( ::syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 ) );
+   return ( fd >= 0 )?( static_cast<int>( fd ) ):( -1 );
+#else
+   UNUSED_PARAMETER( event );
+   return -1;
+#endif
+}
+//*************************************************************************************************
+
+} // timing
+
+} // blaze
+
+#endif
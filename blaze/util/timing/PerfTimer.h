@@ -0,0 +1,73 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/timing/PerfTimer.h
+//  \brief Progress timer for wall clock time measurements with hardware performance counters
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TIMING_PERFTIMER_H_
+#define _BLAZE_UTIL_TIMING_PERFTIMER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blaze/util/timing/Timer.h>
+
+
+namespace blaze {
+
+namespace timing {
+
+//=================================================================================================
+//
+//  TYPE DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Progress timer for wall clock time measurements with hardware performance counters.
+// \ingroup timing
+//
+// The PerfTimer combines the Timer class template with the PerfPolicy timing policy. It measures
+// the wall clock time and, in case the hardware counters have been enabled via
+// PerfPolicy::enable(), samples the hardware performance counters of the CPU at the beginning
+// and the end of each time measurement.
+*/
+typedef Timer<PerfPolicy>  PerfTimer;
+//*************************************************************************************************
+
+} // timing
+
+} // blaze
+
+#endif
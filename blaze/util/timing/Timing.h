@@ -100,6 +100,23 @@ namespace timing {}
    // average wall clock time
    double average = timer.average();
    \endcode
+
+// In order to find out whether a code fragment is limited by the computational power, by the
+// memory latency or by the memory bandwidth, the PerfTimer additionally samples the hardware
+// performance counters of the CPU (cycles, instructions, cache misses, and branch misses). The
+// counters have to be enabled once at the beginning of the program:
+
+   \code
+   PerfPolicy::enable();
+
+   PerfTimer timer;
+   ...  // Programm or code fragment to be measured
+   timer.end();
+
+   // Evaluation of the instructions per cycle of the measured code fragment
+   double ipc = PerfPolicy::last( PerfPolicy::instructions ) /
+                PerfPolicy::last( PerfPolicy::cycles );
+   \endcode
 */
 //*************************************************************************************************
 
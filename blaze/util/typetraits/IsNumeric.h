@@ -40,13 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/FalseType.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/typetraits/IsBoolean.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVoid.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 
 
 namespace blaze {
@@ -66,7 +70,9 @@ template< typename T >
 struct IsNumericHelper
 {
    //**********************************************************************************************
-   enum { value = ( IsBuiltin<T>::value && !IsBoolean<T>::value && !IsVoid<T>::value ) };
+   enum { value = ( IsBuiltin<T>::value && !IsBoolean<T>::value && !IsVoid<T>::value ) ||
+                  IsSame<typename RemoveCV<T>::Type,float16>::value ||
+                  IsSame<typename RemoveCV<T>::Type,bfloat16>::value };
    typedef typename SelectType<value,TrueType,FalseType>::Type  Type;
    //**********************************************************************************************
 };
@@ -79,11 +85,11 @@ struct IsNumericHelper
 // \ingroup type_traits
 //
 // This type trait tests whether or not the given template parameter is a numeric data type.
-// Blaze considers all integral (except \a bool), floating point, and complex data types as
-// numeric data types. In case the type is a numeric type, the \a value member enumeration is
-// set to 1, the nested type definition \a Type is \a TrueType, and the class derives from
-// \a TrueType. Otherwise \a value is set to 0, \a Type is \a FalseType, and the class derives
-// from \a FalseType.
+// Blaze considers all integral (except \a bool), floating point (including the 16-bit float16
+// and bfloat16 storage types), and complex data types as numeric data types. In case the type
+// is a numeric type, the \a value member enumeration is set to 1, the nested type definition
+// \a Type is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set
+// to 0, \a Type is \a FalseType, and the class derives from \a FalseType.
 
    \code
    blaze::IsNumeric<int>::value                // Evaluates to 1 (int is a numeric data type)
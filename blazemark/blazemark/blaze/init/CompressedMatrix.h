@@ -46,6 +46,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -83,6 +84,9 @@ void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO> >& v, size_t nonzer
 // This function initializes the given row-major compressed matrix with random values.
 // Each row will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros )
@@ -92,7 +96,7 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros
 
    m.reserve( M * nonzeros );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t rrange( nonzeros / 2UL );
       const size_t lrange( ( nonzeros % 2UL )?( rrange ):( rrange-1UL ) );
@@ -108,7 +112,7 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros
          m.finalize( i );
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t i=0UL; i<M; ++i ) {
          ::blazemark::Indices indices( N, nonzeros );
@@ -118,6 +122,19 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros
          m.finalize( i );
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( M, N, nonzeros ) );
+
+      m.reserve( pattern.nonZeros() );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            m.append( i, *it, ::blaze::rand<Type>( 0, 10 ) );
+         }
+         m.finalize( i );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -132,6 +149,9 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros
 // This function initializes the given column-major compressed matrix with random values.
 // Each column will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonzeros )
@@ -141,7 +161,7 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonze
 
    m.reserve( M * nonzeros );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t drange( nonzeros / 2UL );
       const size_t urange( ( nonzeros % 2UL )?( drange ):( drange-1UL ) );
@@ -157,7 +177,7 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonze
          m.finalize( j );
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t j=0UL; j<N; ++j ) {
          ::blazemark::Indices indices( M, nonzeros );
@@ -167,6 +187,19 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonze
          m.finalize( j );
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, M, nonzeros ) );
+
+      m.reserve( pattern.nonZeros() );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            m.append( *it, j, ::blaze::rand<Type>( 0, 10 ) );
+         }
+         m.finalize( j );
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -181,6 +214,9 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonze
 // This function initializes the all compressed matrices in the given vector with random
 // values. Each row will be filled with \a nonzeros non-zero elements, whose indices are
 // randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -81,6 +82,9 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
 // This function initializes the given row-major compressed matrix with random values.
 // Each row will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ublas::row_major>& m
@@ -89,7 +93,7 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
    const size_t M( m.size1() );
    const size_t N( m.size2() );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t rrange( nonzeros / 2UL );
       const size_t lrange( ( nonzeros % 2UL )?( rrange ):( rrange-1UL ) );
@@ -104,7 +108,7 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t i=0UL; i<M; ++i ) {
          ::blazemark::Indices indices( N, nonzeros );
@@ -113,6 +117,16 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( M, N, nonzeros ) );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            m(i,*it) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -127,6 +141,9 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
 // This function initializes the given column-major compressed matrix with random values.
 // Each column will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ublas::column_major>& m
@@ -135,7 +152,7 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
    const size_t M( m.size1() );
    const size_t N( m.size2() );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t drange( nonzeros / 2UL );
       const size_t urange( ( nonzeros % 2UL )?( drange ):( drange-1UL ) );
@@ -150,7 +167,7 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t j=0UL; j<N; ++j ) {
          ::blazemark::Indices indices( M, nonzeros );
@@ -159,6 +176,16 @@ void init( ::boost::numeric::ublas::compressed_matrix<Type,::boost::numeric::ubl
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, M, nonzeros ) );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            m(*it,j) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -82,12 +82,16 @@ typedef double  element_t;
 //*************************************************************************************************
 /*!\brief Structure of sparse matrices
 //
-// This flag value specifies the structure of sparse matrices in all benchmarks. The structure
-// can be either specified as blazemark::band, which results in the setup of banded matrices,
-// or blazemark::random, which results in the setup of sparse matrices with randomly placed
-// non-zero entries.
+// This flag value specifies the default structure of sparse matrices in all benchmarks. The
+// structure can be either specified as blazemark::band, which results in the setup of banded
+// matrices, or blazemark::random, which results in the setup of sparse matrices with randomly
+// placed non-zero entries. Alternatively, one of the structured patterns blazemark::block,
+// blazemark::rmat, blazemark::stencil2d, blazemark::stencil3d or blazemark::irregular can be
+// selected (see the blazemark::MatrixStructure enumeration for more details). Individual
+// benchmark runs can override the default structure in the parameter files.
 //
-// Valid settings for the structure are blazemark::band and blaze::random.
+// Valid settings for the structure are blazemark::band, blazemark::random, blazemark::block,
+// blazemark::rmat, blazemark::stencil2d, blazemark::stencil3d and blazemark::irregular.
 */
 const MatrixStructure structure( random );
 //*************************************************************************************************
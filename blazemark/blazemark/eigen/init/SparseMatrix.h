@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -78,6 +79,9 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::ColMajor,EigenSparseIndexType>& m
 //
 // This function initializes the given row-major sparse matrix with random values. Each row
 // will be filled with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::Eigen::SparseMatrix<Type,::Eigen::RowMajor,EigenSparseIndexType>& m, size_t nonzeros )
@@ -87,7 +91,7 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::RowMajor,EigenSparseIndexType>& m
 
    m.reserve( M*nonzeros );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const int rrange( nonzeros / 2 );
       const int lrange( ( nonzeros % 2 )?( rrange ):( rrange-1 ) );
@@ -104,7 +108,7 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::RowMajor,EigenSparseIndexType>& m
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( int i=0UL; i<M; ++i ) {
          m.startVec( i );
@@ -114,6 +118,17 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::RowMajor,EigenSparseIndexType>& m
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( M, N, nonzeros ) );
+
+      for( int i=0UL; i<M; ++i ) {
+         m.startVec( i );
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            m.insertBack(i,*it) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    m.finalize();
 }
@@ -129,6 +144,9 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::RowMajor,EigenSparseIndexType>& m
 //
 // This function initializes the given column-major sparse matrix with random values. Each column
 // will be filled with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::Eigen::SparseMatrix<Type,::Eigen::ColMajor,EigenSparseIndexType>& m, size_t nonzeros )
@@ -138,7 +156,7 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::ColMajor,EigenSparseIndexType>& m
 
    m.reserve( N*nonzeros );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const int drange( nonzeros / 2 );
       const int urange( ( nonzeros % 2 )?( drange ):( drange-1 ) );
@@ -155,7 +173,7 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::ColMajor,EigenSparseIndexType>& m
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( int j=0UL; j<N; ++j ) {
          m.startVec( j );
@@ -165,6 +183,17 @@ void init( ::Eigen::SparseMatrix<Type,::Eigen::ColMajor,EigenSparseIndexType>& m
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, M, nonzeros ) );
+
+      for( int j=0UL; j<N; ++j ) {
+         m.startVec( j );
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            m.insertBack(*it,j) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    m.finalize();
 }
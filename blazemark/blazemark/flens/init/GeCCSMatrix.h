@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -78,6 +79,9 @@ void init( ::flens::GeCCSMatrix< ::flens::CCS<Type,::flens::IndexBaseZero<IndexT
 //
 // This function initializes the given CCS matrix with random values. Each row will be filled
 // with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type         // Data type of the matrix
         , typename IndexType >  // Index type of the matrix
@@ -92,7 +96,7 @@ void init( ::flens::GeCCSMatrix< ::flens::CCS<Type,::flens::IndexBaseZero<IndexT
 
    ::flens::GeCoordMatrix<Coord> tmp( M, N );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const IndexType drange( nonzeros / 2 );
       const IndexType urange( ( nonzeros % 2 )?( drange ):( drange-1 ) );
@@ -107,7 +111,7 @@ void init( ::flens::GeCCSMatrix< ::flens::CCS<Type,::flens::IndexBaseZero<IndexT
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( IndexType j=tmp.firstCol(); j<=tmp.lastCol(); ++j ) {
          ::blazemark::Indices indices( columns, nonzeros );
@@ -116,6 +120,16 @@ void init( ::flens::GeCCSMatrix< ::flens::CCS<Type,::flens::IndexBaseZero<IndexT
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( columns, rows, nonzeros ) );
+
+      for( IndexType j=tmp.firstCol(); j<=tmp.lastCol(); ++j ) {
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            tmp(*it,j) += ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    m = tmp;
 }
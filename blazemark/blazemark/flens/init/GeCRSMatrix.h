@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -78,6 +79,9 @@ void init( ::flens::GeCRSMatrix< ::flens::CRS<Type,::flens::IndexBaseZero<IndexT
 //
 // This function initializes the given CRS matrix with random values. Each row will be filled
 // with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type         // Data type of the matrix
         , typename IndexType >  // Index type of the matrix
@@ -92,7 +96,7 @@ void init( ::flens::GeCRSMatrix< ::flens::CRS<Type,::flens::IndexBaseZero<IndexT
 
    ::flens::GeCoordMatrix<Coord> tmp( M, N );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const IndexType rrange( nonzeros / 2 );
       const IndexType lrange( ( nonzeros % 2 )?( rrange ):( rrange-1 ) );
@@ -107,7 +111,7 @@ void init( ::flens::GeCRSMatrix< ::flens::CRS<Type,::flens::IndexBaseZero<IndexT
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( IndexType i=tmp.firstRow(); i<=tmp.lastRow(); ++i ) {
          ::blazemark::Indices indices( columns, nonzeros );
@@ -116,6 +120,16 @@ void init( ::flens::GeCRSMatrix< ::flens::CRS<Type,::flens::IndexBaseZero<IndexT
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( rows, columns, nonzeros ) );
+
+      for( IndexType i=tmp.firstRow(); i<=tmp.lastRow(); ++i ) {
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            tmp(i,*it) += ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    m = tmp;
 }
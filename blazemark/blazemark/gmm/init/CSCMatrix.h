@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -76,6 +77,9 @@ void init( ::gmm::csc_matrix<Type>& m, size_t nonzeros );
 // This function initializes the given column-major sparse matrix with random values.
 // Each column will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::gmm::csc_matrix<Type>& m, size_t nonzeros )
@@ -85,7 +89,7 @@ void init( ::gmm::csc_matrix<Type>& m, size_t nonzeros )
 
    ::gmm::col_matrix< ::gmm::wsvector<Type> > tmp( M, N );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t drange( nonzeros / 2UL );
       const size_t urange( ( nonzeros % 2UL )?( drange ):( drange-1UL ) );
@@ -100,7 +104,7 @@ void init( ::gmm::csc_matrix<Type>& m, size_t nonzeros )
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t j=0UL; j<N; ++j ) {
          ::blazemark::Indices indices( M, nonzeros );
@@ -109,6 +113,16 @@ void init( ::gmm::csc_matrix<Type>& m, size_t nonzeros )
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, M, nonzeros ) );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            tmp(*it,j) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    copy( tmp, m );
 }
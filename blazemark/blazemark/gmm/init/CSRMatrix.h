@@ -45,6 +45,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -75,6 +76,9 @@ void init( ::gmm::csr_matrix<Type>& m, size_t nonzeros );
 //
 // This function initializes the given row-major sparse matrix with random values. Each row
 // will be filled with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::gmm::csr_matrix<Type>& m, size_t nonzeros )
@@ -84,7 +88,7 @@ void init( ::gmm::csr_matrix<Type>& m, size_t nonzeros )
 
    ::gmm::row_matrix< ::gmm::wsvector<Type> > tmp( M, N );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t rrange( nonzeros / 2UL );
       const size_t lrange( ( nonzeros % 2UL )?( rrange ):( rrange-1UL ) );
@@ -99,7 +103,7 @@ void init( ::gmm::csr_matrix<Type>& m, size_t nonzeros )
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t i=0UL; i<M; ++i ) {
          ::blazemark::Indices indices( N, nonzeros );
@@ -108,6 +112,16 @@ void init( ::gmm::csr_matrix<Type>& m, size_t nonzeros )
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( M, N, nonzeros ) );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            tmp(i,*it) = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 
    copy( tmp, m );
 }
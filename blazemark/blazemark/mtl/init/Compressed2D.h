@@ -46,6 +46,7 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -81,6 +82,9 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::col
 //
 // This function initializes the given row-major sparse matrix with random values. Each row
 // will be filled with \a nonzeros non-zero elements, whose indices are randomly determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::row_major > >& m
@@ -96,7 +100,7 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::row
 
    row_inserter ins( m );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t rrange( nonzeros / 2UL );
       const size_t lrange( ( nonzeros % 2UL )?( rrange ):( rrange-1UL ) );
@@ -111,7 +115,7 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::row
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t i=0UL; i<M; ++i ) {
          ::blazemark::Indices indices( N, nonzeros );
@@ -120,6 +124,16 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::row
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( M, N, nonzeros ) );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            ins[i][*it] = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -134,6 +148,9 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::row
 // This function initializes the given column-major sparse matrix with random values.
 // Each column will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
+//
+// The positions of the non-zero elements depend on the currently selected matrix structure (see
+// blazemark::selectOperand()).
 */
 template< typename Type >  // Data type of the matrix
 void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::col_major > >& m
@@ -149,7 +166,7 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::col
 
    col_inserter ins( m );
 
-   if( structure == band )
+   if( operandStructure() == band )
    {
       const size_t drange( nonzeros / 2UL );
       const size_t urange( ( nonzeros % 2UL )?( drange ):( drange-1UL ) );
@@ -164,7 +181,7 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::col
          }
       }
    }
-   else
+   else if( operandStructure() == random )
    {
       for( size_t j=0UL; j<N; ++j ) {
          ::blazemark::Indices indices( M, nonzeros );
@@ -173,6 +190,16 @@ void init( ::mtl::compressed2D< Type, ::mtl::matrix::parameters< ::mtl::tag::col
          }
       }
    }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, M, nonzeros ) );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         for( SparsityPattern::Iterator it=pattern.begin(j); it!=pattern.end(j); ++it ) {
+            ins[*it][j] = ::blaze::rand<Type>( 0, 10 );
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
@@ -40,10 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cstring>
+#include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blaze/util/UnsignedValue.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Roofline.h>
 
 
 namespace blazemark {
@@ -137,6 +145,33 @@ struct Benchmarks
                             is available for a particular benchmark, the kernel is included in the
                             benchmark tests. In case the runEigen flag is set to \a false, the
                             Eigen kernel will be skipped.*/
+   std::vector<size_t> threads;  //!< The thread counts of the thread scaling mode.
+                                 /*!< In case the vector is not empty, the Blaze kernels are
+                                      additionally run for each of the given numbers of threads
+                                      and the resulting speedup, parallel efficiency and memory
+                                      bandwidth are reported. The thread counts are sorted in
+                                      ascending order; the first count serves as baseline for
+                                      the speedup and efficiency. */
+   std::string json;             //!< The name of the JSON output file.
+                                 /*!< In case the file name is not empty, the time measurements
+                                      of all repetitions of all kernels are written in JSON
+                                      format to the given file (see blazemark::Report). */
+   std::string csv;              //!< The name of the CSV output file.
+                                 /*!< In case the file name is not empty, the time measurements
+                                      of all repetitions of all kernels are written in CSV
+                                      format to the given file (see blazemark::Report). */
+   bool counters;                //!< Flag value for the hardware performance counters.
+                                 /*!< In case the counters flag is set to \a true, the hardware
+                                      performance counters are sampled during all kernels and
+                                      the instructions per cycle, the cache and branch miss
+                                      rates and the estimated memory bandwidth are reported
+                                      (see blazemark::counters()). */
+   bool roofline;                //!< Flag value for the roofline analysis.
+                                 /*!< In case the roofline flag is set to \a true, the peak
+                                      performance and the attainable memory bandwidth of the
+                                      machine are measured before the benchmarks and the
+                                      fraction of the roofline bound achieved by each kernel
+                                      is reported (see blazemark::roofline()). */
    //@}
    //**********************************************************************************************
 };
@@ -166,6 +201,11 @@ inline Benchmarks::Benchmarks()
    , runFLENS    ( blazemark::runFLENS     )  // Flag value for the FLENS benchmark kernels
    , runMTL      ( blazemark::runMTL       )  // Flag value for the MTL benchmark kernels
    , runEigen    ( blazemark::runEigen     )  // Flag value for the Eigen benchmark kernels
+   , threads     ()                           // The thread counts of the thread scaling mode
+   , json        ()                           // The name of the JSON output file
+   , csv         ()                           // The name of the CSV output file
+   , counters    ( false )                    // Flag value for the hardware performance counters
+   , roofline    ( false )                    // Flag value for the roofline analysis
 {}
 //*************************************************************************************************
 
@@ -178,6 +218,44 @@ inline Benchmarks::Benchmarks()
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Parsing a comma-separated list of thread counts.
+//
+// \param list The comma-separated list of thread counts (as for instance "1,2,4,8").
+// \return The sorted list of unique thread counts.
+// \exception std::invalid_argument Invalid list of thread counts.
+*/
+inline std::vector<size_t> parseThreadCounts( const char* list )
+{
+   std::vector<size_t> threads;
+   std::istringstream iss( list );
+   ::blaze::UnsignedValue<size_t> count;
+   char comma;
+
+   while( iss >> count ) {
+      if( count == size_t(0) ) break;
+      threads.push_back( count );
+      if( !( iss >> comma ) ) break;
+      if( comma != ',' ) {
+         threads.clear();
+         break;
+      }
+   }
+
+   if( threads.empty() || !iss.eof() ) {
+      std::ostringstream oss;
+      oss << " Invalid list of thread counts: '" << list << "'";
+      throw std::invalid_argument( oss.str() );
+   }
+
+   std::sort( threads.begin(), threads.end() );
+   threads.erase( std::unique( threads.begin(), threads.end() ), threads.end() );
+
+   return threads;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Parsing the command line arguments to configure the given benchmarks data structure.
 //
@@ -186,6 +264,7 @@ inline Benchmarks::Benchmarks()
 // \param benchmarks The benchmark data structure to be configured.
 // \return void
 // \exception std::invalid_argument Unknown command line argument.
+// \exception std::runtime_error Hardware performance counters are not available.
 //
 // This function parses the command line arguments to configure the given benchmarks data
 // structure. The following command line options will be recognized:
@@ -223,9 +302,19 @@ inline Benchmarks::Benchmarks()
 //   - \a -eigen: Activates the Eigen kernels.
 //   - \a -no-eigen: Deactivates the Eigen kernels.
 //   - \a -only-eigen: Activates the Eigen kernels and deactivates all other.
+//   - \a -threads \a list: Activates the thread scaling mode for the given comma-separated list
+//     of thread counts (as for instance \a -threads \a 1,2,4,8).
+//   - \a -json \a file: Writes the time measurements of all kernels in JSON format to \a file.
+//   - \a -csv \a file: Writes the time measurements of all kernels in CSV format to \a file.
+//   - \a -counters: Samples the hardware performance counters during all kernels.
+//   - \a -roofline: Measures the roofline ceilings of the machine and reports the fraction of the
+//     roofline bound achieved by all kernels.
 //
-// In case an unknown command line option is encountered, a \a std::invalid_argument exception
-// is thrown.
+// In case an unknown command line option or an invalid list of thread counts is encountered, a
+// \a std::invalid_argument exception is thrown. In case the hardware performance counters are
+// requested but not available on the current platform, a \a std::runtime_error exception is
+// thrown. In case the roofline analysis is requested, the roofline ceilings of the machine are
+// measured and printed before the function returns.
 */
 inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchmarks )
 {
@@ -440,12 +529,41 @@ inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchm
          benchmarks.runMTL       = false;
          benchmarks.runEigen     = true;
       }
+      else if( std::strcmp( argv[i], "-threads" ) == 0 ) {
+         if( ++i == argc )
+            throw std::invalid_argument( " Missing list of thread counts for '-threads'" );
+         benchmarks.threads = parseThreadCounts( argv[i] );
+      }
+      else if( std::strcmp( argv[i], "-json" ) == 0 ) {
+         if( ++i == argc )
+            throw std::invalid_argument( " Missing file name for '-json'" );
+         benchmarks.json = argv[i];
+      }
+      else if( std::strcmp( argv[i], "-csv" ) == 0 ) {
+         if( ++i == argc )
+            throw std::invalid_argument( " Missing file name for '-csv'" );
+         benchmarks.csv = argv[i];
+      }
+      else if( std::strcmp( argv[i], "-counters" ) == 0 ) {
+         benchmarks.counters = true;
+      }
+      else if( std::strcmp( argv[i], "-roofline" ) == 0 ) {
+         benchmarks.roofline = true;
+      }
       else {
          std::ostringstream oss;
          oss << " Unknown command line argument: '" << argv[i] << "'";
          throw std::invalid_argument( oss.str() );
       }
    }
+
+   if( benchmarks.counters && !::blaze::timing::PerfPolicy::enable() )
+      throw std::runtime_error( " Hardware performance counters are not available" );
+
+   if( benchmarks.roofline ) {
+      measureRoofline();
+      std::cout << machineRoofline();
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Counters.h
+//  \brief Header file for the evaluation of hardware performance counters
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_COUNTERS_H_
+#define _BLAZEMARK_UTIL_COUNTERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iomanip>
+#include <ostream>
+#include <vector>
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Timer.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rates derived from the hardware performance counters of a benchmark kernel.
+//
+// The CounterRates data structure summarizes the hardware events of all repetitions of a single
+// benchmark kernel. The instructions per cycle (IPC) indicate how well a kernel uses the
+// computational resources of the CPU, the cache and branch misses are given as misses per
+// thousand instructions (MPKI). The memory bandwidth is estimated from the number of last level
+// cache misses, assuming that each miss transfers a single cache line from main memory. Rates
+// that cannot be evaluated since the according events are not available are set to 0.
+*/
+struct CounterRates
+{
+   bool   available;   //!< Flag for available hardware counters.
+   double ipc;         //!< The number of instructions per cycle.
+   double l1Mpki;      //!< The number of L1 data cache read misses per thousand instructions.
+   double llcMpki;     //!< The number of last level cache misses per thousand instructions.
+   double branchMpki;  //!< The number of branch misses per thousand instructions.
+   double bandwidth;   //!< The estimated memory bandwidth in GByte/s.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COUNTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of the given hardware event over all repetitions.
+//
+// \param event The hardware event.
+// \return The total number of events of the most recently run kernel.
+*/
+inline double totalCount( ::blaze::timing::PerfPolicy::Event event )
+{
+   const std::vector<double>& counts( Timer::counts( event ) );
+
+   double total( 0.0 );
+   for( size_t i=0UL; i<counts.size(); ++i )
+      total += counts[i];
+   return total;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the hardware performance counters of the most recently run kernel.
+//
+// \return The rates of the hardware events of all repetitions of the kernel.
+//
+// This function evaluates the hardware events recorded by the blazemark::Timer class during all
+// repetitions of the most recently run benchmark kernel. In case the hardware counters are not
+// enabled, the \a available flag of the returned rates is set to \a false.
+*/
+inline CounterRates counterRates()
+{
+   using ::blaze::timing::PerfPolicy;
+
+   // Assumed number of bytes transferred from main memory per last level cache miss
+   const double cacheLineSize( 64.0 );
+
+   CounterRates rates = { false, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+   if( !PerfPolicy::isEnabled() || Timer::counts( PerfPolicy::cycles ).empty() )
+      return rates;
+
+   const double cycles      ( totalCount( PerfPolicy::cycles       ) );
+   const double instructions( totalCount( PerfPolicy::instructions ) );
+
+   double time( 0.0 );
+   for( size_t i=0UL; i<Timer::measurements().size(); ++i )
+      time += Timer::measurements()[i];
+
+   rates.available = true;
+
+   if( cycles > 0.0 )
+      rates.ipc = instructions / cycles;
+
+   if( instructions > 0.0 ) {
+      rates.l1Mpki     = 1000.0 * totalCount( PerfPolicy::l1Misses     ) / instructions;
+      rates.llcMpki    = 1000.0 * totalCount( PerfPolicy::llcMisses    ) / instructions;
+      rates.branchMpki = 1000.0 * totalCount( PerfPolicy::branchMisses ) / instructions;
+   }
+
+   if( time > 0.0 )
+      rates.bandwidth = cacheLineSize * totalCount( PerfPolicy::llcMisses ) / time / 1E9;
+
+   return rates;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Output manipulator for the hardware performance counters of the most recent kernel.
+//
+// \param os Reference to the output stream.
+// \return Reference to the output stream.
+//
+// In case the hardware counters are enabled, this manipulator prints the instructions per
+// cycle, the L1, last level cache and branch misses per thousand instructions and the estimated
+// memory bandwidth of the most recently run kernel. Otherwise it prints nothing. It is meant to
+// be appended to the result line of a kernel:
+
+   \code
+   run->setBlazeResult( blazemark::blaze::dmatdvecmult( N, steps ) );
+   std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
+   \endcode
+*/
+inline std::ostream& counters( std::ostream& os )
+{
+   const CounterRates rates( counterRates() );
+
+   if( !rates.available )
+      return os;
+
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision( 3 ) );
+
+   os << "  (IPC " << rates.ipc << ", L1 " << rates.l1Mpki << " MPKI, LLC " << rates.llcMpki
+      << " MPKI, branch " << rates.branchMpki << " MPKI, ~" << rates.bandwidth << " GB/s)";
+
+   os.precision( precision );
+   os.flags( flags );
+
+   return os;
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -98,6 +98,7 @@ class DynamicDenseRun
    inline size_t getSize () const;
    inline size_t getSteps() const;
    inline size_t getFlops() const;
+   inline size_t getBytes() const;
    inline double getClikeResult    () const;
    inline double getClassicResult  () const;
    inline double getBLASResult     () const;
@@ -113,6 +114,7 @@ class DynamicDenseRun
    inline void   setSize ( size_t newSize  );
    inline void   setSteps( size_t newSteps );
    inline void   setFlops( size_t newFlops );
+   inline void   setBytes( size_t newBytes );
    inline void   setClikeResult    ( double result );
    inline void   setClassicResult  ( double result );
    inline void   setBLASResult     ( double result );
@@ -143,6 +145,10 @@ class DynamicDenseRun
                        /*!< This value corresponds to the total number of floating point operations
                             (Flops) required for a single computation of the (composite) arithmetic
                             operation. */
+   size_t bytes_;      //!< The estimated memory traffic of the benchmark run.
+                       /*!< This value corresponds to the estimated number of bytes that have to be
+                            transferred from and to main memory for a single computation of the
+                            (composite) arithmetic operation. */
    double clike_;      //!< Benchmark result of the C-like implementation.
    double classic_;    //!< Benchmark result of classic C++ operator overloading.
    double blas_;       //!< Benchmark result of the BLAS implementation.
@@ -183,6 +189,7 @@ inline DynamicDenseRun::DynamicDenseRun()
    : size_     ( 0UL )  // The target size of the dense vectors/matrices
    , steps_    ( 0UL )  // The number of steps for the benchmark run
    , flops_    ( 0UL )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0 )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0 )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0 )  // Benchmark result of the BLAS implementation
@@ -213,6 +220,7 @@ inline DynamicDenseRun::DynamicDenseRun( size_t size )
    : size_     ( size )  // The target size of the dense vectors/matrices
    , steps_    ( 0UL  )  // The number of steps for the benchmark run
    , flops_    ( 0UL  )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL  )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0  )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0  )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0  )  // Benchmark result of the BLAS implementation
@@ -249,6 +257,7 @@ inline DynamicDenseRun::DynamicDenseRun( size_t size, size_t steps )
    : size_     ( size  )  // The target size of the dense vectors/matrices
    , steps_    ( steps )  // The number of steps for the benchmark run
    , flops_    ( 0UL   )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL   )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0   )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0   )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0   )  // Benchmark result of the BLAS implementation
@@ -312,6 +321,18 @@ inline size_t DynamicDenseRun::getFlops() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the estimated memory traffic.
+//
+// \return The estimated number of bytes transferred from and to main memory.
+*/
+inline size_t DynamicDenseRun::getBytes() const
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the benchmark result of the C-like implementation.
 //
@@ -486,6 +507,19 @@ inline void DynamicDenseRun::setFlops( size_t newFlops )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the estimated memory traffic.
+//
+// \param newBytes The new estimated number of bytes transferred from and to main memory.
+// \return void
+*/
+inline void DynamicDenseRun::setBytes( size_t newBytes )
+{
+   bytes_ = newBytes;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Setting the benchmark result of the C-like implementation.
 //
@@ -40,15 +40,20 @@
 // Includes
 //*************************************************************************************************
 
+#include <cctype>
 #include <iomanip>
 #include <istream>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/UnsignedValue.h>
+#include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
+#include <blazemark/util/MatrixStructure.h>
+#include <blazemark/util/SparsityPattern.h>
 
 
 namespace blazemark {
@@ -101,6 +106,9 @@ class DynamicSparseRun
    inline float  getFillingDegree  () const;
    inline size_t getSteps          () const;
    inline size_t getFlops          () const;
+   inline size_t getBytes          () const;
+   inline MatrixStructure    getStructure() const;
+   inline const std::string& getFile     () const;
    inline double getClikeResult    () const;
    inline double getClassicResult  () const;
    inline double getBlazeResult    () const;
@@ -116,6 +124,9 @@ class DynamicSparseRun
    inline void   setNonZeros( size_t newNonZeros );
    inline void   setSteps   ( size_t newSteps    );
    inline void   setFlops   ( size_t newFlops    );
+   inline void   setBytes   ( size_t newBytes    );
+   inline void   setStructure( MatrixStructure newStructure );
+   inline void   setFile     ( const std::string& newFile  );
    inline void   setClikeResult    ( double result );
    inline void   setClassicResult  ( double result );
    inline void   setBlazeResult    ( double result );
@@ -149,6 +160,15 @@ class DynamicSparseRun
                        /*!< This value corresponds to the total number of floating point operations
                             (Flops) required for a single computation of the (composite) arithmetic
                             operation. */
+   size_t bytes_;      //!< The estimated memory traffic of the benchmark run.
+                       /*!< This value corresponds to the estimated number of bytes that have to be
+                            transferred from and to main memory for a single computation of the
+                            (composite) arithmetic operation. */
+   MatrixStructure structure_;  //!< The structure of the sparse matrices.
+                                /*!< The structure defaults to blazemark::structure and can be
+                                     overridden per benchmark run (see the parameter files). */
+   std::string file_;           //!< The name of the Matrix Market file of the sparse matrices.
+                                /*!< This value is only set in case of the \a external structure. */
    double clike_;      //!< Benchmark result of the C-like implementation.
    double classic_;    //!< Benchmark result of classic C++ operator overloading.
    double blaze_;      //!< Benchmark result of the Blaze library.
@@ -189,6 +209,9 @@ inline DynamicSparseRun::DynamicSparseRun()
    , nonzeros_ ( 0UL )  // The number of non-zero elements in the sparse vectors/matrices.
    , steps_    ( 0UL )  // The number of steps for the benchmark run
    , flops_    ( 0UL )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL )  // The estimated memory traffic of the benchmark run
+   , structure_( structure )  // The structure of the sparse matrices
+   , file_     ()             // The name of the Matrix Market file of the sparse matrices
    , clike_    ( 0.0 )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0 )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0 )  // Benchmark result of the Blaze library
@@ -221,6 +244,9 @@ inline DynamicSparseRun::DynamicSparseRun( size_t size, size_t nonzeros )
    , nonzeros_ ( nonzeros )  // The number of non-zero elements in the sparse vectors/matrices.
    , steps_    ( 0UL      )  // The number of steps for the benchmark run
    , flops_    ( 0UL      )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL      )  // The estimated memory traffic of the benchmark run
+   , structure_( structure )  // The structure of the sparse matrices
+   , file_     ()             // The name of the Matrix Market file of the sparse matrices
    , clike_    ( 0.0      )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0      )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0      )  // Benchmark result of the Blaze library
@@ -263,6 +289,9 @@ inline DynamicSparseRun::DynamicSparseRun( size_t size, size_t nonzeros, size_t
    , nonzeros_ ( nonzeros )  // The number of non-zero elements in the sparse vectors/matrices
    , steps_    ( steps    )  // The number of steps for the benchmark run
    , flops_    ( 0UL      )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL      )  // The estimated memory traffic of the benchmark run
+   , structure_( structure )  // The structure of the sparse matrices
+   , file_     ()             // The name of the Matrix Market file of the sparse matrices
    , clike_    ( 0.0      )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0      )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0      )  // Benchmark result of the Blaze library
@@ -353,6 +382,42 @@ inline size_t DynamicSparseRun::getFlops() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the estimated memory traffic.
+//
+// \return The estimated number of bytes transferred from and to main memory.
+*/
+inline size_t DynamicSparseRun::getBytes() const
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the structure of the sparse matrices of the benchmark run.
+//
+// \return The structure of the sparse matrices.
+*/
+inline MatrixStructure DynamicSparseRun::getStructure() const
+{
+   return structure_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the Matrix Market file of the sparse matrices of the benchmark run.
+//
+// \return The name of the Matrix Market file (empty in case the structure is not \a external).
+*/
+inline const std::string& DynamicSparseRun::getFile() const
+{
+   return file_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the benchmark result of the C-like implementation.
 //
@@ -531,6 +596,45 @@ inline void DynamicSparseRun::setFlops( size_t newFlops )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the estimated memory traffic.
+//
+// \param newBytes The new estimated number of bytes transferred from and to main memory.
+// \return void
+*/
+inline void DynamicSparseRun::setBytes( size_t newBytes )
+{
+   bytes_ = newBytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the structure of the sparse matrices of the benchmark run.
+//
+// \param newStructure The new structure of the sparse matrices.
+// \return void
+*/
+inline void DynamicSparseRun::setStructure( MatrixStructure newStructure )
+{
+   structure_ = newStructure;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the name of the Matrix Market file of the sparse matrices of the benchmark run.
+//
+// \param newFile The new name of the Matrix Market file.
+// \return void
+*/
+inline void DynamicSparseRun::setFile( const std::string& newFile )
+{
+   file_ = newFile;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Setting the benchmark result of the C-like implementation.
 //
@@ -731,7 +835,15 @@ inline std::ostream& operator<<( std::ostream& os, const DynamicSparseRun& run )
 {
    const std::ios::fmtflags flags( os.flags() );
 
-   os << std::left << "   N=" << run.getSize() << ", fill level=" << run.getFillingDegree() << "%, steps=" << run.getSteps() << "\n";
+   os << std::left << "   N=" << run.getSize()
+      << ", fill level=" << run.getFillingDegree() << "%, ";
+
+   if( run.getStructure() == external )
+      os << "file=" << run.getFile();
+   else
+      os << "structure=" << run.getStructure();
+
+   os << ", steps=" << run.getSteps() << "\n";
 
    const double clike    ( run.getClikeResult()     );
    const double classic  ( run.getClassicResult()   );
@@ -783,6 +895,19 @@ inline std::ostream& operator<<( std::ostream& os, const DynamicSparseRun& run )
 // \param run Reference to a DynamicSparseRun object.
 // \return The input stream.
 //
+// This operator reads a benchmark run of the form
+
+   \code
+   ( <size>, <nonzeros> [, <steps>] [, <structure>] )
+   ( "<file>" [, <steps>] )
+   \endcode
+
+// where the optional \a structure is the name of a matrix structure (as for instance "band"
+// or "stencil2d", see blazemark::MatrixStructure) and \a file is the name of a Matrix Market
+// file containing a square sparse matrix. In the second form, the size of the run is given by
+// the number of rows of the matrix and the number of non-zero elements per row is the rounded
+// average number of non-zero elements per row of the matrix.
+//
 // The input operator guarantees that this object is not changed in the case of an input error.
 // Only values suitable for the according built-in unsigned integral data type \a T are allowed.
 // Otherwise, the input stream's position is returned to its previous position and the
@@ -792,26 +917,89 @@ inline std::istream& operator>>( std::istream& is, DynamicSparseRun& run )
 {
    char c1, c2, c3;
    ::blaze::UnsignedValue<size_t> size, nonzeros, steps;
+   MatrixStructure shape( structure );
+   std::string file;
    const std::istream::pos_type pos( is.tellg() );
 
-   if( !(is >> c1 >> size >> c2 >> nonzeros >> c3) ||
-       c1 != '(' || size == 0 || c2 != ',' || nonzeros == 0 ||
-       ( c3 != ')' && ( c3 != ',' || ( !(is >> steps >> c1) || c1 != ')' || steps == 0 ) ) ) )
-   {
+   if( !(is >> c1) || c1 != '(' ) {
       is.clear();
       is.seekg( pos );
       is.setstate( std::istream::failbit );
       return is;
    }
 
+   if( ( is >> std::ws ).peek() == '"' )
+   {
+      is.get();
+
+      if( !std::getline( is, file, '"' ) || file.empty() || !(is >> c3) ||
+          ( c3 != ')' && ( c3 != ',' || !(is >> steps >> c3) || c3 != ')' || steps == 0 ) ) )
+      {
+         is.clear();
+         is.seekg( pos );
+         is.setstate( std::istream::failbit );
+         return is;
+      }
+
+      const SparsityPattern& pattern( loadPattern( file ) );
+
+      if( pattern.rows() == 0UL || pattern.rows() != pattern.columns() ||
+          pattern.nonZeros() == 0UL )
+         throw std::invalid_argument( "Invalid Matrix Market operand '" + file + "'" );
+
+      size     = pattern.rows();
+      nonzeros = ::blaze::max( ( pattern.nonZeros() + size/2UL ) / size, 1UL );
+      shape    = external;
+   }
+   else
+   {
+      if( !(is >> size >> c2 >> nonzeros >> c3) || size == 0 || c2 != ',' || nonzeros == 0 ||
+          ( c3 == ',' && !std::isalpha( ( is >> std::ws ).peek() ) &&
+            ( !(is >> steps >> c3) || steps == 0 ) ) ||
+          ( c3 == ',' && !(is >> shape >> c3) ) || c3 != ')' )
+      {
+         is.clear();
+         is.seekg( pos );
+         is.setstate( std::istream::failbit );
+         return is;
+      }
+   }
+
    run.setSize( size );
    run.setNonZeros( nonzeros );
    run.setSteps( steps );
+   run.setStructure( shape );
+   run.setFile( file );
 
    return is;
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Selects the sparse matrix structure of the given benchmark run.
+//
+// \param run The benchmark run.
+// \return void
+//
+// This function selects the structure (or Matrix Market file) of the given benchmark run for
+// the initialization of all sparse matrices of the following benchmark kernels (see the
+// blazemark::selectOperand() function).
+*/
+inline void selectOperand( const DynamicSparseRun& run )
+{
+   selectOperand( run.getStructure(), run.getFile() );
+}
+//*************************************************************************************************
+
 } // namespace blazemark
 
 #endif
@@ -36,6 +36,16 @@
 #define _BLAZEMARK_UTIL_MATRIXSTRUCTURE_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cctype>
+#include <istream>
+#include <ostream>
+#include <string>
+
+
 namespace blazemark {
 
 //=================================================================================================
@@ -47,7 +57,12 @@ namespace blazemark {
 //*************************************************************************************************
 /*!\brief Matrix structure flags.
 //
-// The MatrixStructure enumeration represents all possible structures of (sparse) matrices.
+// The MatrixStructure enumeration represents all possible structures of (sparse) matrices. For
+// all structures except \a band and \a random the sparsity pattern is set up by the
+// blazemark::SparsityPattern class (see 'blazemark/util/SparsityPattern.h'). The number of
+// non-zero elements per row given for a benchmark run is interpreted as the width of the band,
+// the size of the diagonal blocks, the average number of non-zero elements per row or the
+// number of points of the stencil, respectively.
 */
 enum MatrixStructure {
    band   = 1,  //!< Flag for banded matrices.
@@ -61,7 +76,7 @@ enum MatrixStructure {
                      0  & 0  & -1 & 2  & -1 \\
                      0  & 0  & 0  & -1 & 2  \\
                      \end{array}\right)\f]. */
-   random = 2   //!< Flag for random matrices.
+   random = 2,  //!< Flag for random matrices.
                 /*!< The \a random flag indicates a matrix with randomly determined non-zero
                      entries. The following example demonstrates a random matrix with 2
                      non-zero entries per row:
@@ -72,9 +87,105 @@ enum MatrixStructure {
                      0 & 0 & 1 & 0 & 4 \\
                      0 & 8 & 0 & 1 & 0 \\
                      \end{array}\right)\f]. */
+   block     = 3,  //!< Flag for block-diagonal matrices.
+                   /*!< The \a block flag indicates a matrix consisting of dense square blocks
+                        on the diagonal, whose size corresponds to the number of non-zero
+                        elements per row. */
+   rmat      = 4,  //!< Flag for R-MAT matrices.
+                   /*!< The \a rmat flag indicates the adjacency matrix of a recursive matrix
+                        (R-MAT) graph with the Graph500 partition probabilities (0.57, 0.19,
+                        0.19, 0.05), i.e. a matrix with power-law distributed numbers of
+                        non-zero elements per row and per column. */
+   stencil2d = 5,  //!< Flag for two-dimensional stencil matrices.
+                   /*!< The \a stencil2d flag indicates the matrix of a 5-point or 9-point
+                        stencil on a two-dimensional regular grid. The 9-point stencil is used
+                        in case at least 9 non-zero elements per row are requested. */
+   stencil3d = 6,  //!< Flag for three-dimensional stencil matrices.
+                   /*!< The \a stencil3d flag indicates the matrix of a 7-point or 27-point
+                        stencil on a three-dimensional regular grid. The 27-point stencil is
+                        used in case at least 27 non-zero elements per row are requested. */
+   irregular = 7,  //!< Flag for random matrices with power-law distributed row lengths.
+                   /*!< The \a irregular flag indicates a matrix with randomly placed non-zero
+                        elements, whose numbers of non-zero elements per row follow a Pareto
+                        distribution with the requested average. */
+   external  = 8   //!< Flag for matrices read from a Matrix Market file.
+                   /*!< The \a external flag indicates a matrix whose sparsity pattern is read
+                        from a Matrix Market file. It cannot be selected as default structure,
+                        but results from a file name given in a parameter file. */
 };
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global output operator for the MatrixStructure enumeration.
+//
+// \param os Reference to the output stream.
+// \param structure The matrix structure to be written.
+// \return The output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, MatrixStructure structure )
+{
+   switch( structure ) {
+      case band     : return os << "band";
+      case random   : return os << "random";
+      case block    : return os << "block";
+      case rmat     : return os << "rmat";
+      case stencil2d: return os << "stencil2d";
+      case stencil3d: return os << "stencil3d";
+      case irregular: return os << "irregular";
+      default       : return os << "external";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global input operator for the MatrixStructure enumeration.
+//
+// \param is Reference to the input stream.
+// \param structure The matrix structure to be read.
+// \return The input stream.
+//
+// This operator reads the name of a matrix structure (as for instance "stencil2d"). The
+// \a external structure cannot be read. In case the next word is not the name of a valid
+// structure, the input stream's position is returned to its previous position and the
+// \a std::istream::failbit is set.
+*/
+inline std::istream& operator>>( std::istream& is, MatrixStructure& structure )
+{
+   const std::istream::pos_type pos( is.tellg() );
+   std::string name;
+
+   is >> std::ws;
+   while( std::isalnum( is.peek() ) ) {
+      name += static_cast<char>( is.get() );
+   }
+
+   if     ( name == "band"      ) structure = band;
+   else if( name == "random"    ) structure = random;
+   else if( name == "block"     ) structure = block;
+   else if( name == "rmat"      ) structure = rmat;
+   else if( name == "stencil2d" ) structure = stencil2d;
+   else if( name == "stencil3d" ) structure = stencil3d;
+   else if( name == "irregular" ) structure = irregular;
+   else {
+      is.clear();
+      is.seekg( pos );
+      is.setstate( std::istream::failbit );
+   }
+
+   return is;
+}
+//*************************************************************************************************
+
 } // namespace blazemark
 
 #endif
@@ -0,0 +1,108 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/MemoryTraffic.h
+//  \brief Header file for the memory traffic estimation functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_MEMORYTRAFFIC_H_
+#define _BLAZEMARK_UTIL_MEMORYTRAFFIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  MEMORY TRAFFIC ESTIMATION FUNCTIONS
+//
+//  The following functions estimate the number of bytes that have to be transferred from or to
+//  main memory to read or write a single operand of a benchmark exactly once. The memory traffic
+//  of a benchmark run is estimated as the sum of the traffic of all operands and of the result.
+//  Temporaries, write-allocate transfers and cache reuse are not taken into account, i.e. the
+//  estimate is a lower bound for the actual traffic of large operands.
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Estimates the memory traffic of dense vector or matrix elements.
+//
+// \param elements The number of accessed dense elements.
+// \return The estimated number of bytes.
+*/
+inline size_t denseBytes( size_t elements )
+{
+   return elements * sizeof( element_t );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimates the memory traffic of a sparse vector.
+//
+// \param nonzeros The number of non-zero elements of the sparse vector.
+// \return The estimated number of bytes.
+//
+// Each non-zero element of a sparse vector is stored as a value/index pair.
+*/
+inline size_t sparseVectorBytes( size_t nonzeros )
+{
+   return nonzeros * ( sizeof( element_t ) + sizeof( size_t ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimates the memory traffic of a sparse matrix.
+//
+// \param rows The number of rows (or columns in case of a column-major matrix) of the matrix.
+// \param nonzeros The total number of non-zero elements of the sparse matrix.
+// \return The estimated number of bytes.
+//
+// Each non-zero element of a sparse matrix is stored as a value/index pair. Additionally, the
+// beginning and the end of each row (or column) is given by a pair of pointers.
+*/
+inline size_t sparseMatrixBytes( size_t rows, size_t nonzeros )
+{
+   return sparseVectorBytes( nonzeros ) + 2UL * rows * sizeof( void* );
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
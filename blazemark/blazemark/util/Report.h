@@ -0,0 +1,508 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Report.h
+//  \brief Header file for the Report class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_REPORT_H_
+#define _BLAZEMARK_UTIL_REPORT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
+#include <blazemark/util/DynamicSparseRun.h>
+#include <blazemark/util/MatrixStructure.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/SolverRun.h>
+#include <blazemark/util/StaticDenseRun.h>
+#include <blazemark/util/StaticSparseRun.h>
+#include <blazemark/util/Statistics.h>
+#include <blazemark/util/Threads.h>
+#include <blazemark/util/Timer.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Machine-readable report of all benchmark results.
+//
+// The Report class collects the time measurements of all repetitions of all kernels of a single
+// benchmark and writes them in JSON or CSV format. Each result is added directly after the
+// according kernel has been run:
+
+   \code
+   blazemark::Report report( "dmatdvecmult" );
+
+   run->setBlazeResult( blazemark::blaze::dmatdvecmult( N, steps ) );
+   report.add( "Blaze", *run );
+   \endcode
+
+// Each result contains the library, the parameters of the benchmark run (size, number of
+// non-zero elements, structure of the sparse matrices, number of vectors/matrices, number of
+// solver iterations and the number of threads of the SMP backend), the number of steps, the
+// number of floating point operations per step, the runtimes of all repetitions and their
+// minimum, median, 90th percentile, mean and the half-width of the 95% confidence interval of
+// the mean. All times are given in seconds for all steps of a single repetition. Parameters
+// that do not apply to a particular benchmark (as for instance the number of non-zero elements
+// of dense benchmarks) are set to 0 or are left empty, respectively. In case the hardware
+// performance counters are enabled (see the \a -counters command line option), each result
+// additionally contains the instructions per cycle, the L1, last level cache and branch misses
+// per thousand instructions and the estimated memory bandwidth of the kernel (see
+// blazemark::CounterRates). In case the roofline analysis is active (see the \a -roofline
+// command line option), each result additionally contains the achieved fraction of the roofline
+// bound and the limiting ceiling of the benchmark run (see blazemark::RooflineResult).
+*/
+class Report
+{
+ public:
+   //**Type definitions****************************************************************************
+   /*!\brief Result of a single kernel for a single benchmark run.
+   */
+   struct Result
+   {
+      std::string library;          //!< The name of the benchmarked library.
+      size_t size;                  //!< The size of the vectors/matrices.
+      size_t nonzeros;              //!< The number of non-zero elements.
+      std::string structure;        //!< The structure or file of the sparse matrix operands.
+      size_t number;                //!< The number of vectors/matrices.
+      size_t iterations;            //!< The number of solver iterations.
+      size_t threads;               //!< The number of threads of the SMP backend.
+      size_t steps;                 //!< The number of steps per repetition.
+      size_t flops;                 //!< The number of floating point operations per step.
+      std::vector<double> samples;  //!< The runtimes of all repetitions.
+      CounterRates counters;        //!< The hardware performance counter rates.
+      RooflineResult roofline;      //!< The roofline result of the kernel.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Report( const std::string& benchmark );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename RunType >
+   inline void add( const std::string& library, const RunType& run );
+
+   inline const std::string&         benchmark() const;
+   inline const std::vector<Result>& results  () const;
+
+   inline void writeJSON( std::ostream& os ) const;
+   inline void writeCSV ( std::ostream& os ) const;
+   inline void write    ( const Benchmarks& benchmarks ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string benchmark_;        //!< The name of the benchmark.
+   std::vector<Result> results_;  //!< The results of all kernels.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK RUN PARAMETERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements of a dense benchmark run.
+*/
+template< typename RunType >
+inline size_t reportNonZeros( const RunType& )
+{
+   return 0UL;
+}
+
+/*!\brief Returns the number of non-zero elements of a sparse benchmark run.
+*/
+inline size_t reportNonZeros( const DynamicSparseRun& run )
+{
+   return run.getNonZeros();
+}
+
+/*!\brief Returns the number of non-zero elements of a fixed size sparse benchmark run.
+*/
+template< size_t N >
+inline size_t reportNonZeros( const StaticSparseRun<N>& run )
+{
+   return run.getNonZeros();
+}
+
+/*!\brief Returns the sparse matrix structure of a benchmark run without sparse matrix operands.
+*/
+template< typename RunType >
+inline std::string reportStructure( const RunType& )
+{
+   return std::string();
+}
+
+/*!\brief Returns the sparse matrix structure of a sparse benchmark run.
+//
+// The function returns the name of the structure of the sparse matrix operands or, in case
+// the operands are read from a Matrix Market file, the name of the file.
+*/
+inline std::string reportStructure( const DynamicSparseRun& run )
+{
+   if( run.getStructure() == external )
+      return run.getFile();
+
+   std::ostringstream oss;
+   oss << run.getStructure();
+   return oss.str();
+}
+
+/*!\brief Returns the number of vectors/matrices of a dynamic size benchmark run.
+*/
+template< typename RunType >
+inline size_t reportNumber( const RunType& )
+{
+   return 1UL;
+}
+
+/*!\brief Returns the number of vectors/matrices of a fixed size dense benchmark run.
+*/
+template< size_t N >
+inline size_t reportNumber( const StaticDenseRun<N>& run )
+{
+   return run.getNumber();
+}
+
+/*!\brief Returns the number of vectors/matrices of a fixed size sparse benchmark run.
+*/
+template< size_t N >
+inline size_t reportNumber( const StaticSparseRun<N>& run )
+{
+   return run.getNumber();
+}
+
+/*!\brief Returns the number of solver iterations of a non-solver benchmark run.
+*/
+template< typename RunType >
+inline size_t reportIterations( const RunType& )
+{
+   return 0UL;
+}
+
+/*!\brief Returns the number of solver iterations of a solver benchmark run.
+*/
+inline size_t reportIterations( const SolverRun& run )
+{
+   return run.getIterations();
+}
+
+/*!\brief Returns the number of floating point operations per step of a benchmark run.
+*/
+template< typename RunType >
+inline size_t reportFlops( const RunType& run )
+{
+   return run.getFlops();
+}
+
+/*!\brief Returns the number of floating point operations per step of a solver benchmark run.
+*/
+inline size_t reportFlops( const SolverRun& )
+{
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor of the Report class.
+//
+// \param benchmark The name of the benchmark (as for instance "dmatdvecmult").
+*/
+inline Report::Report( const std::string& benchmark )
+   : benchmark_( benchmark )  // The name of the benchmark
+   , results_  ()             // The results of all kernels
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds the result of the most recently run kernel.
+//
+// \param library The name of the benchmarked library.
+// \param run The parameters of the benchmark run.
+// \return void
+//
+// This function adds the time measurements of the most recently run kernel (see the
+// blazemark::Timer class) for the given benchmark run to the report.
+*/
+template< typename RunType >  // Type of the benchmark run
+inline void Report::add( const std::string& library, const RunType& run )
+{
+   Result result;
+
+   result.library    = library;
+   result.size       = run.getSize();
+   result.nonzeros   = reportNonZeros( run );
+   result.structure  = reportStructure( run );
+   result.number     = reportNumber( run );
+   result.iterations = reportIterations( run );
+   result.threads    = getNumThreads();
+   result.steps      = run.getSteps();
+   result.flops      = reportFlops( run );
+   result.samples    = Timer::measurements();
+   result.counters   = counterRates();
+   result.roofline   = roofline( run );
+
+   results_.push_back( result );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the benchmark.
+//
+// \return The name of the benchmark.
+*/
+inline const std::string& Report::benchmark() const
+{
+   return benchmark_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the results of all kernels.
+//
+// \return The results of all kernels.
+*/
+inline const std::vector<Report::Result>& Report::results() const
+{
+   return results_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the report in JSON format.
+//
+// \param os Reference to the output stream.
+// \return void
+*/
+inline void Report::writeJSON( std::ostream& os ) const
+{
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision( 10 ) );
+
+   os << "{\n  \"benchmark\": \"" << benchmark_ << "\",\n  \"results\": [";
+
+   for( size_t i=0UL; i<results_.size(); ++i )
+   {
+      const Result& result( results_[i] );
+
+      os << ( i == 0UL ? "\n" : ",\n" )
+         << "    { \"library\": \"" << result.library << "\""
+         << ", \"size\": " << result.size
+         << ", \"nonzeros\": " << result.nonzeros
+         << ", \"structure\": \"" << result.structure << "\""
+         << ", \"number\": " << result.number
+         << ", \"iterations\": " << result.iterations
+         << ", \"threads\": " << result.threads
+         << ", \"steps\": " << result.steps
+         << ", \"flops\": " << result.flops
+         << ",\n      \"samples\": [";
+
+      for( size_t j=0UL; j<result.samples.size(); ++j ) {
+         os << ( j == 0UL ? "" : ", " ) << result.samples[j];
+      }
+
+      os << "]"
+         << ",\n      \"min\": " << percentile( result.samples, 0.0 )
+         << ", \"median\": " << percentile( result.samples, 50.0 )
+         << ", \"p90\": " << percentile( result.samples, 90.0 )
+         << ", \"mean\": " << mean( result.samples )
+         << ", \"ci95\": " << confidence( result.samples );
+
+      if( result.counters.available ) {
+         os << ",\n      \"ipc\": " << result.counters.ipc
+            << ", \"l1_mpki\": " << result.counters.l1Mpki
+            << ", \"llc_mpki\": " << result.counters.llcMpki
+            << ", \"branch_mpki\": " << result.counters.branchMpki
+            << ", \"bandwidth\": " << result.counters.bandwidth;
+      }
+
+      if( result.roofline.available ) {
+         os << ",\n      \"roofline\": " << result.roofline.fraction
+            << ", \"bound\": \"" << ( result.roofline.memoryBound ? "memory" : "compute" ) << "\"";
+      }
+
+      os << " }";
+   }
+
+   os << "\n  ]\n}\n";
+
+   os.precision( precision );
+   os.flags( flags );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the report in CSV format.
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes a header line and one line per result. The runtimes of all repetitions
+// are given as space-separated list in the last column. The columns of the hardware performance
+// counters and of the roofline analysis are left empty in case the counters or the roofline
+// analysis are not enabled, respectively.
+*/
+inline void Report::writeCSV( std::ostream& os ) const
+{
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision( 10 ) );
+
+   os << "benchmark,library,size,nonzeros,structure,number,iterations,threads,steps,flops,"
+      << "min,median,p90,mean,ci95,ipc,l1_mpki,llc_mpki,branch_mpki,bandwidth,roofline,bound,"
+      << "samples\n";
+
+   for( size_t i=0UL; i<results_.size(); ++i )
+   {
+      const Result& result( results_[i] );
+
+      os << benchmark_ << "," << result.library << "," << result.size << ","
+         << result.nonzeros << "," << result.structure << "," << result.number << ","
+         << result.iterations << "," << result.threads << "," << result.steps << ","
+         << result.flops << ","
+         << percentile( result.samples, 0.0 ) << "," << percentile( result.samples, 50.0 ) << ","
+         << percentile( result.samples, 90.0 ) << "," << mean( result.samples ) << ","
+         << confidence( result.samples ) << ",";
+
+      if( result.counters.available ) {
+         os << result.counters.ipc << "," << result.counters.l1Mpki << ","
+            << result.counters.llcMpki << "," << result.counters.branchMpki << ","
+            << result.counters.bandwidth << ",";
+      }
+      else os << ",,,,,";
+
+      if( result.roofline.available ) {
+         os << result.roofline.fraction << ","
+            << ( result.roofline.memoryBound ? "memory" : "compute" ) << ",";
+      }
+      else os << ",,";
+
+      for( size_t j=0UL; j<result.samples.size(); ++j ) {
+         os << ( j == 0UL ? "" : " " ) << result.samples[j];
+      }
+
+      os << "\n";
+   }
+
+   os.precision( precision );
+   os.flags( flags );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the report to the output files selected via the command line.
+//
+// \param benchmarks The selection of benchmarks and output files.
+// \return void
+// \exception std::runtime_error Could not open output file.
+//
+// This function writes the report in JSON format to the file given by \a benchmarks.json and
+// in CSV format to the file given by \a benchmarks.csv. Empty file names are skipped.
+*/
+inline void Report::write( const Benchmarks& benchmarks ) const
+{
+   if( !benchmarks.json.empty() ) {
+      std::ofstream out( benchmarks.json.c_str() );
+      if( !out.is_open() )
+         throw std::runtime_error( "Could not open output file '" + benchmarks.json + "'" );
+      writeJSON( out );
+   }
+
+   if( !benchmarks.csv.empty() ) {
+      std::ofstream out( benchmarks.csv.c_str() );
+      if( !out.is_open() )
+         throw std::runtime_error( "Could not open output file '" + benchmarks.csv + "'" );
+      writeCSV( out );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -0,0 +1,560 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Roofline.h
+//  \brief Header file for the roofline analysis
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZEMARK_UTIL_ROOFLINE_H_
+#define _BLAZEMARK_UTIL_ROOFLINE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/SolverRun.h>
+#include <blazemark/util/StaticDenseRun.h>
+#include <blazemark/util/StaticSparseRun.h>
+#include <blazemark/util/Threads.h>
+#include <blazemark/util/Timer.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Machine model of the roofline analysis.
+//
+// The Roofline data structure represents the performance ceilings of the current machine. The
+// compute ceiling is given by the peak floating point performance, the memory ceiling by the
+// attainable memory bandwidth. Since the attainable bandwidth strongly depends on the cache
+// level that holds the operands of a kernel, the bandwidth is measured for a sweep of working
+// set sizes (see the measureRoofline() function). The \a workingSets vector contains the probed
+// working set sizes in ascending order, the \a bandwidths vector the according bandwidths.
+*/
+struct Roofline
+{
+   double peak;                      //!< The peak floating point performance in GFlop/s.
+   std::vector<size_t> workingSets;  //!< The probed working set sizes in bytes.
+   std::vector<double> bandwidths;   //!< The attainable bandwidths in GByte/s.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Roofline result of a benchmark kernel.
+//
+// The RooflineResult data structure represents the performance of a single benchmark kernel
+// relative to the roofline bound for the given benchmark run. The \a fraction is the ratio of
+// the runtime predicted by the roofline model and the minimum measured runtime, i.e. a value of
+// 1 means that the kernel runs at the speed of the limiting ceiling. The \a memoryBound flag
+// indicates whether the limiting ceiling is the memory bandwidth or the peak performance.
+*/
+struct RooflineResult
+{
+   bool   available;    //!< Flag for an available roofline result.
+   double fraction;     //!< The fraction of the roofline bound achieved by the kernel.
+   bool   memoryBound;  //!< Flag for a memory bound benchmark run.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PROBE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the attainable memory bandwidth for the given working set size.
+//
+// \param workingSet The size of the working set in bytes.
+// \return The attainable memory bandwidth in GByte/s.
+//
+// This function measures the attainable memory bandwidth by means of a STREAM-like triad
+// \f$ \vec{a} = \vec{b} + s \cdot \vec{c} \f$ on three dense vectors of the given total size.
+// Following the STREAM convention, each step is assumed to transfer all three vectors exactly
+// once; write-allocate transfers are not taken into account. Since the triad is evaluated by
+// the Blaze library, it uses the vectorization and the number of threads of the current Blaze
+// configuration. The function returns the bandwidth of the fastest of several repetitions.
+*/
+inline double measureBandwidth( size_t workingSet )
+{
+   // Minimum number of bytes transferred in a single time measurement
+   const size_t minBytes( 64UL*1024UL*1024UL );
+
+   const size_t N    ( std::max<size_t>( workingSet / ( 3UL*sizeof(element_t) ), 1UL ) );
+   const size_t bytes( 3UL * N * sizeof(element_t) );
+   const size_t steps( std::max<size_t>( minBytes / bytes, 1UL ) );
+
+   ::blaze::DynamicVector<element_t> a( N, element_t(0) );
+   ::blaze::DynamicVector<element_t> b( N, element_t(1) );
+   ::blaze::DynamicVector<element_t> c( N, element_t(2) );
+   const element_t s( 3 );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<3UL || timer.total() < 0.1; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         a = b + s * c;
+      }
+      timer.end();
+
+      if( a[0] != element_t(7) )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+   }
+
+   return 1E-9 * bytes * steps / timer.min();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for the vectorization of the peak performance probe.
+//
+// The \a value of the PeakVectorization class template is set to 1 in case the peak performance
+// probe can be vectorized for the element type \a T. The \a size corresponds to the number of
+// elements per dependency chain of the probe.
+*/
+template< typename T >
+struct PeakVectorization
+{
+   typedef ::blaze::IntrinsicTrait<T>  IT;
+
+   enum { value = IT::multiplication && IT::addition,
+          size  = ( value )?( IT::size ):( 1 ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel of the peak performance probe.
+//
+// \param steps The number of updates of all dependency chains.
+// \param init The initial value of the dependency chains.
+// \return The sum of all dependency chains.
+//
+// This kernel updates twelve independent dependency chains of intrinsic vectors by means of a
+// multiplication and an addition per step, i.e. it performs \f$ 24 \cdot steps \f$ intrinsic
+// floating point operations.
+*/
+template< typename T >  // Type of the elements
+inline typename ::blaze::EnableIfTrue< PeakVectorization<T>::value, T >::Type
+   peakKernel( size_t steps, T init )
+{
+   typedef typename ::blaze::IntrinsicTrait<T>::Type  IntrinsicType;
+
+   const IntrinsicType alpha( ::blaze::set( T( 0.999999 ) ) );
+   const IntrinsicType beta ( ::blaze::set( T( 1E-6 ) ) );
+
+   IntrinsicType x0( ::blaze::set( init        ) ), x1 ( ::blaze::set( init+T( 1) ) );
+   IntrinsicType x2( ::blaze::set( init+T( 2) ) ), x3 ( ::blaze::set( init+T( 3) ) );
+   IntrinsicType x4( ::blaze::set( init+T( 4) ) ), x5 ( ::blaze::set( init+T( 5) ) );
+   IntrinsicType x6( ::blaze::set( init+T( 6) ) ), x7 ( ::blaze::set( init+T( 7) ) );
+   IntrinsicType x8( ::blaze::set( init+T( 8) ) ), x9 ( ::blaze::set( init+T( 9) ) );
+   IntrinsicType x10( ::blaze::set( init+T(10) ) ), x11( ::blaze::set( init+T(11) ) );
+
+   for( size_t step=0UL; step<steps; ++step ) {
+      x0 = x0 * alpha + beta; x1 = x1 * alpha + beta; x2  = x2  * alpha + beta;
+      x3 = x3 * alpha + beta; x4 = x4 * alpha + beta; x5  = x5  * alpha + beta;
+      x6 = x6 * alpha + beta; x7 = x7 * alpha + beta; x8  = x8  * alpha + beta;
+      x9 = x9 * alpha + beta; x10 = x10 * alpha + beta; x11 = x11 * alpha + beta;
+   }
+
+   return ::blaze::sum( ( x0 + x1 ) + ( x2 + x3 ) + ( x4 + x5 ) +
+                        ( x6 + x7 ) + ( x8 + x9 ) + ( x10 + x11 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar kernel of the peak performance probe.
+//
+// \param steps The number of updates of all dependency chains.
+// \param init The initial value of the dependency chains.
+// \return The sum of all dependency chains.
+//
+// This kernel updates twelve independent dependency chains of scalar values by means of a
+// multiplication and an addition per step, i.e. it performs \f$ 24 \cdot steps \f$ floating
+// point operations.
+*/
+template< typename T >  // Type of the elements
+inline typename ::blaze::DisableIfTrue< PeakVectorization<T>::value, T >::Type
+   peakKernel( size_t steps, T init )
+{
+   const T alpha( 0.999999 );
+   const T beta ( 1E-6 );
+
+   T x0( init        ), x1 ( init+T( 1) ), x2 ( init+T( 2) ), x3 ( init+T( 3) );
+   T x4( init+T( 4) ), x5 ( init+T( 5) ), x6 ( init+T( 6) ), x7 ( init+T( 7) );
+   T x8( init+T( 8) ), x9 ( init+T( 9) ), x10( init+T(10) ), x11( init+T(11) );
+
+   for( size_t step=0UL; step<steps; ++step ) {
+      x0 = x0 * alpha + beta; x1 = x1 * alpha + beta; x2  = x2  * alpha + beta;
+      x3 = x3 * alpha + beta; x4 = x4 * alpha + beta; x5  = x5  * alpha + beta;
+      x6 = x6 * alpha + beta; x7 = x7 * alpha + beta; x8  = x8  * alpha + beta;
+      x9 = x9 * alpha + beta; x10 = x10 * alpha + beta; x11 = x11 * alpha + beta;
+   }
+
+   return ( x0 + x1 ) + ( x2 + x3 ) + ( x4 + x5 ) + ( x6 + x7 ) + ( x8 + x9 ) + ( x10 + x11 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the peak floating point performance.
+//
+// \return The peak floating point performance in GFlop/s.
+//
+// This function measures the peak floating point performance by means of twelve independent
+// dependency chains that are updated by a multiplication and an addition per step. The chains
+// are kept in registers and use the same intrinsics as the vectorized kernels of the Blaze
+// library, i.e. the measured performance is only limited by the floating point units and
+// corresponds to the peak performance attainable with the vectorization of the current build.
+// Since the probe runs on a single core, the result is scaled by the number of threads of the
+// current Blaze configuration.
+*/
+inline double measurePeak()
+{
+   // Number of updates of all dependency chains in a single time measurement
+   const size_t steps( 1000000UL );
+
+   // Number of floating point operations per update of all dependency chains
+   const size_t flops( 24UL * PeakVectorization<element_t>::size );
+
+   // The initial value and the result are volatile to keep the kernel within the time measurement
+   volatile element_t init( 1 ), result( 0 );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<3UL || timer.total() < 0.1; ++rep )
+   {
+      timer.start();
+      result = peakKernel<element_t>( steps, init );
+      timer.end();
+
+      if( result < element_t(0) )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+   }
+
+   return 1E-9 * flops * steps * getNumThreads() / timer.min();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROOFLINE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the machine model of the roofline analysis.
+//
+// \return Reference to the machine model.
+//
+// In case the roofline analysis is not active (i.e. the measureRoofline() function has not been
+// called), the returned machine model does not contain any bandwidths.
+*/
+inline Roofline& machineRoofline()
+{
+   static Roofline roofline;
+   return roofline;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the machine model of the roofline analysis.
+//
+// \return void
+//
+// This function activates the roofline analysis by measuring the peak floating point performance
+// (see measurePeak()) and the attainable memory bandwidth for working sets from 16 KiB to
+// 256 MiB (see measureBandwidth()). The working sets grow by a factor of four to cover all
+// levels of the cache hierarchy as well as main memory.
+*/
+inline void measureRoofline()
+{
+   Roofline& roofline( machineRoofline() );
+
+   roofline.workingSets.clear();
+   roofline.bandwidths.clear();
+
+   roofline.peak = measurePeak();
+
+   for( size_t workingSet=16UL*1024UL; workingSet<=256UL*1024UL*1024UL; workingSet*=4UL ) {
+      roofline.workingSets.push_back( workingSet );
+      roofline.bandwidths.push_back( measureBandwidth( workingSet ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the roofline analysis is active.
+//
+// \return \a true in case the machine model has been measured, \a false if not.
+*/
+inline bool isRooflineActive()
+{
+   return !machineRoofline().bandwidths.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the attainable memory bandwidth for the given working set size.
+//
+// \param workingSet The size of the working set in bytes.
+// \return The attainable memory bandwidth in GByte/s.
+//
+// This function returns the bandwidth measured for the smallest probed working set that is
+// at least as large as the given working set. Working sets larger than the largest probed
+// working set are assumed to run at the bandwidth of the largest probed working set.
+*/
+inline double attainableBandwidth( size_t workingSet )
+{
+   const Roofline& roofline( machineRoofline() );
+
+   BLAZE_INTERNAL_ASSERT( !roofline.bandwidths.empty(), "Inactive roofline analysis" );
+
+   for( size_t i=0UL; i<roofline.workingSets.size(); ++i ) {
+      if( workingSet <= roofline.workingSets[i] )
+         return roofline.bandwidths[i];
+   }
+
+   return roofline.bandwidths.back();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the working set of a dynamic size benchmark run.
+*/
+template< typename RunType >
+inline size_t rooflineWorkingSet( const RunType& run )
+{
+   return run.getBytes();
+}
+
+/*!\brief Returns the working set of a fixed size dense benchmark run.
+//
+// The working set of a fixed size benchmark run comprises all vectors/matrices of the run.
+*/
+template< size_t N >
+inline size_t rooflineWorkingSet( const StaticDenseRun<N>& run )
+{
+   return run.getBytes() * run.getNumber();
+}
+
+/*!\brief Returns the working set of a fixed size sparse benchmark run.
+//
+// The working set of a fixed size benchmark run comprises all vectors/matrices of the run.
+*/
+template< size_t N >
+inline size_t rooflineWorkingSet( const StaticSparseRun<N>& run )
+{
+   return run.getBytes() * run.getNumber();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the roofline result of the most recently run kernel.
+//
+// \param run The parameters of the benchmark run.
+// \return The roofline result of the kernel.
+//
+// This function compares the minimum runtime of the most recently run benchmark kernel (see the
+// blazemark::Timer class) with the runtime predicted by the roofline model for the estimated
+// floating point operations and memory traffic of the given benchmark run:
+
+   \f[ T_{roofline} = steps \cdot \max\left( \frac{flops}{P_{peak}},
+                                             \frac{bytes}{B(working\ set)} \right) \f]
+
+// The result can be directly printed to an output stream. In case the roofline analysis is not
+// active or in case no estimate of the floating point operations and memory traffic is available
+// for the benchmark run, the \a available flag of the returned result is set to \a false and
+// nothing is printed:
+
+   \code
+   run->setBlazeResult( blazemark::blaze::smatdvecmult( N, F, steps ) );
+   std::cout << "     " << std::setw(12) << N << mflops
+             << blazemark::counters << blazemark::roofline( *run ) << std::endl;
+   \endcode
+*/
+template< typename RunType >  // Type of the benchmark run
+inline RooflineResult roofline( const RunType& run )
+{
+   RooflineResult result = { false, 0.0, false };
+
+   const std::vector<double>& times( Timer::measurements() );
+
+   if( !isRooflineActive() || times.empty() || ( run.getFlops() == 0UL && run.getBytes() == 0UL ) )
+      return result;
+
+   const double bandwidth  ( attainableBandwidth( rooflineWorkingSet( run ) ) );
+   const double computeTime( 1E-9 * run.getFlops() / machineRoofline().peak );
+   const double memoryTime ( 1E-9 * run.getBytes() / bandwidth );
+   const double minTime    ( *std::min_element( times.begin(), times.end() ) );
+
+   if( minTime <= 0.0 )
+      return result;
+
+   result.available   = true;
+   result.fraction    = run.getSteps() * std::max( computeTime, memoryTime ) / minTime;
+   result.memoryBound = ( memoryTime > computeTime );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the roofline result of a solver benchmark run.
+//
+// \return An unavailable roofline result.
+//
+// Since no estimate of the floating point operations and memory traffic of a solver is
+// available, no roofline result can be evaluated for solver benchmark runs.
+*/
+inline RooflineResult roofline( const SolverRun& )
+{
+   const RooflineResult result = { false, 0.0, false };
+   return result;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global output operator for the machine model of the roofline analysis.
+//
+// \param os Reference to the output stream.
+// \param roofline Reference to the machine model.
+// \return Reference to the output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, const Roofline& roofline )
+{
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision( 4 ) );
+
+   os << std::left << "   Roofline ceilings:\n"
+      << "     Peak performance: " << roofline.peak << " GFlop/s\n"
+      << "     " << std::setw(16) << "Working set" << "Bandwidth [GB/s]\n";
+
+   for( size_t i=0UL; i<roofline.workingSets.size(); ++i ) {
+      const size_t kib( roofline.workingSets[i] / 1024UL );
+      os << "     " << std::setw(4) << std::right
+         << ( ( kib < 1024UL )?( kib ):( kib / 1024UL ) ) << std::left
+         << std::setw(12) << ( ( kib < 1024UL )?( " KiB" ):( " MiB" ) )
+         << roofline.bandwidths[i] << "\n";
+   }
+
+   os.precision( precision );
+   os.flags( flags );
+
+   return os;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for the roofline result of a benchmark kernel.
+//
+// \param os Reference to the output stream.
+// \param result Reference to the roofline result.
+// \return Reference to the output stream.
+//
+// In case the roofline result is available, this operator prints the achieved fraction of the
+// roofline bound and the limiting ceiling. Otherwise it prints nothing.
+*/
+inline std::ostream& operator<<( std::ostream& os, const RooflineResult& result )
+{
+   if( !result.available )
+      return os;
+
+   const std::ios::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision( 3 ) );
+
+   os << "  [" << 100.0*result.fraction << "% of roofline, "
+      << ( result.memoryBound ? "memory" : "compute" ) << " bound]";
+
+   os.precision( precision );
+   os.flags( flags );
+
+   return os;
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
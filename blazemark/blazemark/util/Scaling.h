@@ -0,0 +1,180 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Scaling.h
+//  \brief Header file for the thread scaling mode
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_SCALING_H_
+#define _BLAZEMARK_UTIL_SCALING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Counters.h>
+#include <blazemark/util/DynamicDenseRun.h>
+#include <blazemark/util/DynamicSparseRun.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Threads.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the label of a dense benchmark run in the thread scaling table.
+//
+// \param run The dense benchmark run.
+// \return The label of the benchmark run.
+*/
+inline std::string scalingLabel( const DynamicDenseRun& run )
+{
+   std::ostringstream oss;
+   oss << run.getSize();
+   return oss.str();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the label of a sparse benchmark run in the thread scaling table.
+//
+// \param run The sparse benchmark run.
+// \return The label of the benchmark run.
+*/
+inline std::string scalingLabel( const DynamicSparseRun& run )
+{
+   std::ostringstream oss;
+   oss << run.getSize() << " (" << run.getFillingDegree() << "%)";
+   return oss.str();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD SCALING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runs the given kernel for all benchmark runs and all given numbers of threads.
+//
+// \param runs The benchmark runs.
+// \param threads The ascendingly sorted list of thread counts.
+// \param kernel The kernel function returning the minimum runtime of a benchmark run.
+// \param report The report collecting the timing samples of all runs.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function runs the given kernel for each benchmark run once for each of the given numbers
+// of threads of the SMP backend of the Blaze library and prints the resulting performance in
+// MFlop/s and effective memory bandwidth in GB/s (based on the estimated memory traffic of the
+// run). Additionally, the speedup and the parallel efficiency with respect to the first (i.e.
+// smallest) number of threads are reported:
+
+   \f[ S_p = \frac{T_{p_0}}{T_p}, \qquad E_p = S_p \frac{p_0}{p} \f]
+
+// The timing samples of each run are recorded in the given report under the "Blaze" label
+// together with the active number of threads. After the last run, the number of threads
+// active before the call is restored.
+*/
+template< typename RunType >  // Type of the benchmark run
+void scaling( const std::vector<RunType>& runs, const std::vector<size_t>& threads,
+              double (*kernel)( const RunType& run ), Report& report )
+{
+   const std::ios::fmtflags flags( std::cout.flags() );
+   const size_t previous( getNumThreads() );
+
+   std::vector<double> times( threads.size() );
+
+   std::cout << std::left
+             << "     " << std::setw(20) << "Size" << std::setw(10) << "Threads"
+             << std::setw(14) << "MFlop/s" << std::setw(12) << "GB/s"
+             << std::setw(12) << "Speedup" << "Efficiency\n";
+
+   try {
+      for( typename std::vector<RunType>::const_iterator run=runs.begin(); run!=runs.end(); ++run )
+      {
+         const size_t steps( run->getSteps() );
+         const std::string label( scalingLabel( *run ) );
+
+         for( size_t t=0UL; t<threads.size(); ++t )
+         {
+            setNumThreads( threads[t] );
+            times[t] = kernel( *run );
+            report.add( "Blaze", *run );
+
+            const double mflops ( run->getFlops() * steps / times[t] / 1E6 );
+            const double gbytes ( run->getBytes() * steps / times[t] / 1E9 );
+            const double speedup( times[0] / times[t] );
+            const double efficiency( speedup * threads[0] / threads[t] );
+
+            std::cout << "     " << std::setw(20) << ( t == 0UL ? label : std::string() )
+                      << std::setw(10) << threads[t] << std::setw(14) << mflops
+                      << std::setw(12) << gbytes << std::setw(12) << speedup
+                      << efficiency << counters << std::endl;
+         }
+      }
+   }
+   catch( ... ) {
+      setNumThreads( previous );
+      std::cout.flags( flags );
+      throw;
+   }
+
+   setNumThreads( previous );
+   std::cout.flags( flags );
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -0,0 +1,792 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/SparsityPattern.h
+//  \brief Header file for the SparsityPattern class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZEMARK_UTIL_SPARSITYPATTERN_H_
+#define _BLAZEMARK_UTIL_SPARSITYPATTERN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/serialization/MatrixMarket.h>
+#include <blaze/util/Random.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/Indices.h>
+#include <blazemark/util/MatrixStructure.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Row-wise sparsity pattern of a sparse benchmark matrix.
+//
+// The SparsityPattern class stores the ascendingly sorted column indices of all non-zero
+// elements of a sparse matrix row by row. The pattern is either generated according to one of
+// the matrix structures of the blazemark::MatrixStructure enumeration or read from a Matrix
+// Market file. The initialization functions of all libraries use the pattern to set up their
+// sparse matrices such that all libraries are benchmarked with the same operand. In case of a
+// column-major matrix the pattern specifies the row indices of the non-zero elements of each
+// column:
+
+   \code
+   const blazemark::SparsityPattern pattern( blazemark::rmat, N, N, F );
+
+   for( size_t i=0UL; i<pattern.rows(); ++i ) {
+      for( blazemark::SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+         A.append( i, *it, blaze::rand<double>( 0, 10 ) );
+      }
+      A.finalize( i );
+   }
+   \endcode
+
+// All random patterns are generated by means of the random number generator of the Blaze
+// library, i.e. the result depends on the current seed (see blaze::setSeed()).
+*/
+class SparsityPattern
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef std::vector<size_t>::const_iterator  Iterator;  //!< Iterator over the indices of a row.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SparsityPattern();
+   explicit inline SparsityPattern( MatrixStructure pattern,
+                                    size_t m, size_t n, size_t nonzeros );
+   explicit inline SparsityPattern( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   rows    () const;
+   inline size_t   columns () const;
+   inline size_t   nonZeros() const;
+   inline size_t   nonZeros( size_t i ) const;
+   inline Iterator begin   ( size_t i ) const;
+   inline Iterator end     ( size_t i ) const;
+   inline void     swap    ( SparsityPattern& sp ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Setup functions*****************************************************************************
+   /*!\name Setup functions */
+   //@{
+   inline void setupBand     ( size_t nonzeros );
+   inline void setupRandom   ( size_t nonzeros );
+   inline void setupBlock    ( size_t nonzeros );
+   inline void setupRMat     ( size_t nonzeros );
+   inline void setupStencil2D( size_t nonzeros );
+   inline void setupStencil3D( size_t nonzeros );
+   inline void setupIrregular( size_t nonzeros );
+   inline void finalize      ();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                     //!< The number of rows of the pattern.
+   size_t n_;                     //!< The number of columns of the pattern.
+   std::vector<size_t> begin_;    //!< The offsets of the first index of each row.
+   std::vector<size_t> indices_;  //!< The column indices of all non-zero elements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the SparsityPattern class.
+//
+// The default constructor creates an empty \f$ 0 \times 0 \f$ pattern.
+*/
+inline SparsityPattern::SparsityPattern()
+   : m_      ( 0UL )   // The number of rows of the pattern
+   , n_      ( 0UL )   // The number of columns of the pattern
+   , begin_  ( 1UL )   // The offsets of the first index of each row
+   , indices_()        // The column indices of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a sparsity pattern of the given structure.
+//
+// \param pattern The structure of the pattern.
+// \param m The number of rows of the pattern.
+// \param n The number of columns of the pattern.
+// \param nonzeros The (average) number of non-zero elements per row.
+// \exception std::invalid_argument Invalid matrix structure.
+//
+// This constructor generates a \f$ m \times n \f$ sparsity pattern of the given structure.
+// Depending on the structure, \a nonzeros specifies the width of the band, the size of the
+// diagonal blocks, the (average) number of non-zero elements per row or the number of points
+// of the stencil. In case of the \a external structure a \a std::invalid_argument exception is
+// thrown.
+*/
+inline SparsityPattern::SparsityPattern( MatrixStructure pattern, size_t m, size_t n,
+                                         size_t nonzeros )
+   : m_      ( m )     // The number of rows of the pattern
+   , n_      ( n )     // The number of columns of the pattern
+   , begin_  ( 1UL )   // The offsets of the first index of each row
+   , indices_()        // The column indices of all non-zero elements
+{
+   begin_.reserve( m+1UL );
+
+   switch( pattern ) {
+      case band     : setupBand     ( nonzeros ); break;
+      case random   : setupRandom   ( nonzeros ); break;
+      case block    : setupBlock    ( nonzeros ); break;
+      case rmat     : setupRMat     ( nonzeros ); break;
+      case stencil2d: setupStencil2D( nonzeros ); break;
+      case stencil3d: setupStencil3D( nonzeros ); break;
+      case irregular: setupIrregular( nonzeros ); break;
+      default: throw std::invalid_argument( "Invalid matrix structure" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a sparsity pattern from the given Matrix Market file.
+//
+// \param file The name of the Matrix Market file.
+// \exception std::runtime_error Matrix could not be read.
+//
+// This constructor reads the positions of all non-zero elements stored in the given Matrix
+// Market file. The values of the elements are discarded.
+*/
+inline SparsityPattern::SparsityPattern( const std::string& file )
+   : m_      ( 0UL )   // The number of rows of the pattern
+   , n_      ( 0UL )   // The number of columns of the pattern
+   , begin_  ( 1UL )   // The offsets of the first index of each row
+   , indices_()        // The column indices of all non-zero elements
+{
+   typedef ::blaze::CompressedMatrix<element_t,::blaze::rowMajor>  MatrixType;
+
+   MatrixType A;
+   ::blaze::readMatrixMarket( file, A );
+
+   m_ = A.rows();
+   n_ = A.columns();
+
+   begin_.reserve( m_+1UL );
+   indices_.reserve( A.nonZeros() );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( MatrixType::ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         indices_.push_back( element->index() );
+      }
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the sparsity pattern.
+//
+// \return The number of rows of the sparsity pattern.
+*/
+inline size_t SparsityPattern::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the sparsity pattern.
+//
+// \return The number of columns of the sparsity pattern.
+*/
+inline size_t SparsityPattern::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements of the sparsity pattern.
+//
+// \return The total number of non-zero elements.
+*/
+inline size_t SparsityPattern::nonZeros() const
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the given row of the sparsity pattern.
+//
+// \param i The index of the row \f$ [0..M-1] \f$.
+// \return The number of non-zero elements in row \a i.
+*/
+inline size_t SparsityPattern::nonZeros( size_t i ) const
+{
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first column index of the given row.
+//
+// \param i The index of the row \f$ [0..M-1] \f$.
+// \return Iterator to the first column index of row \a i.
+*/
+inline SparsityPattern::Iterator SparsityPattern::begin( size_t i ) const
+{
+   return indices_.begin() + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last column index of the given row.
+//
+// \param i The index of the row \f$ [0..M-1] \f$.
+// \return Iterator just past the last column index of row \a i.
+*/
+inline SparsityPattern::Iterator SparsityPattern::end( size_t i ) const
+{
+   return indices_.begin() + begin_[i+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparsity patterns.
+//
+// \param sp The sparsity pattern to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+inline void SparsityPattern::swap( SparsityPattern& sp ) /* throw() */
+{
+   std::swap( m_, sp.m_ );
+   std::swap( n_, sp.n_ );
+   begin_.swap( sp.begin_ );
+   indices_.swap( sp.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SETUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets up a banded sparsity pattern.
+//
+// \param nonzeros The width of the band.
+// \return void
+//
+// The band is placed around the diagonal exactly as by the initialization functions of all
+// libraries: In case of an even width the band contains one more upper than lower diagonal.
+*/
+inline void SparsityPattern::setupBand( size_t nonzeros )
+{
+   const size_t rrange( nonzeros / 2UL );
+   const size_t lrange( ( nonzeros % 2UL )?( rrange ):( rrange-1UL ) );
+
+   indices_.reserve( m_ * nonzeros );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( i >= lrange )?( i-lrange ):( 0UL ) );
+      const size_t jend  ( ( i+rrange+1UL < n_ )?( i+rrange+1UL ):( n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         indices_.push_back( j );
+      }
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up a random sparsity pattern.
+//
+// \param nonzeros The number of non-zero elements per row.
+// \return void
+*/
+inline void SparsityPattern::setupRandom( size_t nonzeros )
+{
+   indices_.reserve( m_ * nonzeros );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      ::blazemark::Indices indices( n_, nonzeros );
+      indices_.insert( indices_.end(), indices.begin(), indices.end() );
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up a block-diagonal sparsity pattern.
+//
+// \param nonzeros The size of the dense diagonal blocks.
+// \return void
+//
+// The pattern consists of dense square blocks of size \a nonzeros on the diagonal. In case
+// the number of rows is not a multiple of the block size, the last block is truncated.
+*/
+inline void SparsityPattern::setupBlock( size_t nonzeros )
+{
+   const size_t size( ::blaze::max( nonzeros, 1UL ) );
+
+   indices_.reserve( m_ * size );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( i / size ) * size );
+      const size_t jend  ( ::blaze::min( jbegin+size, n_ ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         indices_.push_back( j );
+      }
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up the sparsity pattern of an R-MAT graph.
+//
+// \param nonzeros The average number of non-zero elements per row.
+// \return void
+//
+// This function generates \f$ m \cdot nonzeros \f$ edges by recursively choosing one of the
+// four quadrants of the adjacency matrix with the Graph500 probabilities (0.57, 0.19, 0.19,
+// 0.05). Afterwards the rows and columns are randomly permuted in order to avoid that all
+// high degree vertices are clustered at the beginning of the matrix. Duplicate edges are
+// merged, i.e. the resulting average number of non-zero elements per row is slightly smaller
+// than \a nonzeros.
+*/
+inline void SparsityPattern::setupRMat( size_t nonzeros )
+{
+   const double a( 0.57 ), b( 0.19 ), c( 0.19 );
+
+   if( m_ == 0UL || n_ == 0UL ) {
+      begin_.resize( m_+1UL, 0UL );
+      return;
+   }
+
+   size_t scale( 1UL );
+   while( scale < m_ || scale < n_ ) {
+      scale *= 2UL;
+   }
+
+   std::vector<size_t> rperm( m_ ), cperm( n_ );
+   for( size_t i=0UL; i<m_; ++i ) rperm[i] = i;
+   for( size_t j=0UL; j<n_; ++j ) cperm[j] = j;
+   for( size_t i=m_-1UL; i>0UL; --i ) {
+      std::swap( rperm[i], rperm[ ::blaze::rand<size_t>( 0UL, i ) ] );
+   }
+   for( size_t j=n_-1UL; j>0UL; --j ) {
+      std::swap( cperm[j], cperm[ ::blaze::rand<size_t>( 0UL, j ) ] );
+   }
+
+   std::vector< std::vector<size_t> > edges( m_ );
+   size_t count( 0UL );
+
+   while( count < m_ * nonzeros )
+   {
+      size_t row( 0UL ), column( 0UL );
+
+      for( size_t size=scale/2UL; size>0UL; size/=2UL ) {
+         const double p( ::blaze::rand<double>( 0.0, 1.0 ) );
+         if( p >= a ) {
+            if( p < a+b ) column += size;
+            else if( p < a+b+c ) row += size;
+            else { row += size; column += size; }
+         }
+      }
+
+      if( row < m_ && column < n_ ) {
+         edges[rperm[row]].push_back( cperm[column] );
+         ++count;
+      }
+   }
+
+   indices_.reserve( count );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      std::sort( edges[i].begin(), edges[i].end() );
+      indices_.insert( indices_.end(), edges[i].begin(),
+                       std::unique( edges[i].begin(), edges[i].end() ) );
+      std::vector<size_t>().swap( edges[i] );
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up the sparsity pattern of a two-dimensional stencil.
+//
+// \param nonzeros The number of points of the stencil (5 or 9).
+// \return void
+//
+// The rows of the pattern are mapped to the points of a two-dimensional grid of size
+// \f$ \lfloor \sqrt{m} \rfloor \f$ in x-direction. Each row contains the non-zero elements
+// of the 5-point stencil or, in case \a nonzeros is at least 9, of the 9-point stencil.
+*/
+inline void SparsityPattern::setupStencil2D( size_t nonzeros )
+{
+   const bool full( nonzeros >= 9UL );
+
+   size_t nx( static_cast<size_t>( std::sqrt( static_cast<double>( m_ ) ) ) );
+   while( nx*nx > m_ ) --nx;
+   while( ( nx+1UL )*( nx+1UL ) <= m_ ) ++nx;
+   nx = ::blaze::max( nx, 1UL );
+
+   indices_.reserve( m_ * ( full ? 9UL : 5UL ) );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t x( i % nx );
+
+      for( int dy=-1; dy<=1; ++dy ) {
+         for( int dx=-1; dx<=1; ++dx )
+         {
+            if( ( !full && dx != 0 && dy != 0 ) ||
+                ( dx < 0 && x == 0UL ) || ( dx > 0 && x+1UL == nx ) ||
+                ( dy < 0 && i < nx ) )
+               continue;
+
+            const size_t j( i + dy*nx + dx );
+
+            if( j < n_ )
+               indices_.push_back( j );
+         }
+      }
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up the sparsity pattern of a three-dimensional stencil.
+//
+// \param nonzeros The number of points of the stencil (7 or 27).
+// \return void
+//
+// The rows of the pattern are mapped to the points of a three-dimensional grid of size
+// \f$ \lfloor \sqrt[3]{m} \rfloor \f$ in x- and y-direction. Each row contains the non-zero
+// elements of the 7-point stencil or, in case \a nonzeros is at least 27, of the 27-point
+// stencil.
+*/
+inline void SparsityPattern::setupStencil3D( size_t nonzeros )
+{
+   const bool full( nonzeros >= 27UL );
+
+   size_t nx( static_cast<size_t>( std::pow( static_cast<double>( m_ ), 1.0/3.0 ) ) );
+   while( nx*nx*nx > m_ ) --nx;
+   while( ( nx+1UL )*( nx+1UL )*( nx+1UL ) <= m_ ) ++nx;
+   nx = ::blaze::max( nx, 1UL );
+
+   const size_t nxy( nx*nx );
+
+   indices_.reserve( m_ * ( full ? 27UL : 7UL ) );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t x( i % nx );
+      const size_t y( ( i / nx ) % nx );
+
+      for( int dz=-1; dz<=1; ++dz ) {
+         for( int dy=-1; dy<=1; ++dy ) {
+            for( int dx=-1; dx<=1; ++dx )
+            {
+               if( ( !full && ( dx != 0 ) + ( dy != 0 ) + ( dz != 0 ) > 1 ) ||
+                   ( dx < 0 && x == 0UL ) || ( dx > 0 && x+1UL == nx ) ||
+                   ( dy < 0 && y == 0UL ) || ( dy > 0 && y+1UL == nx ) ||
+                   ( dz < 0 && i < nxy ) )
+                  continue;
+
+               const size_t j( i + dz*nxy + dy*nx + dx );
+
+               if( j < n_ )
+                  indices_.push_back( j );
+            }
+         }
+      }
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up a random sparsity pattern with power-law distributed row lengths.
+//
+// \param nonzeros The average number of non-zero elements per row.
+// \return void
+//
+// The number of non-zero elements of each row is drawn from a Pareto distribution with shape
+// parameter 2 and scaled such that the total number of non-zero elements is approximately
+// \f$ m \cdot nonzeros \f$. Each row contains at least one and at most \a n non-zero elements,
+// whose indices are randomly determined.
+*/
+inline void SparsityPattern::setupIrregular( size_t nonzeros )
+{
+   std::vector<double> lengths( m_ );
+   double sum( 0.0 );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const double u( ::blaze::max( ::blaze::rand<double>( 0.0, 1.0 ), 1E-12 ) );
+      lengths[i] = 1.0 / std::sqrt( u );
+      sum += lengths[i];
+   }
+
+   const double factor( ( sum > 0.0 )?( m_ * nonzeros / sum ):( 0.0 ) );
+
+   indices_.reserve( m_ * nonzeros );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t length( static_cast<size_t>( lengths[i] * factor + 0.5 ) );
+      ::blazemark::Indices indices( n_, ::blaze::min( ::blaze::max( length, 1UL ), n_ ) );
+      indices_.insert( indices_.end(), indices.begin(), indices.end() );
+      finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizes the current row of the sparsity pattern.
+//
+// \return void
+*/
+inline void SparsityPattern::finalize()
+{
+   begin_.push_back( indices_.size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND SELECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The currently selected sparse operand.
+*/
+struct Operand
+{
+   MatrixStructure structure;  //!< The structure of the sparse matrices.
+   std::string file;           //!< The name of the Matrix Market file (for external operands).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the currently selected sparse operand.
+//
+// \return Reference to the currently selected operand.
+*/
+inline Operand& currentOperand()
+{
+   static Operand operand = { structure, std::string() };
+   return operand;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sparsity pattern stored in the given Matrix Market file.
+//
+// \param file The name of the Matrix Market file.
+// \return Reference to the sparsity pattern.
+// \exception std::runtime_error Matrix could not be read.
+//
+// Each file is read only once, all subsequent calls return the cached pattern.
+*/
+inline const SparsityPattern& loadPattern( const std::string& file )
+{
+   static std::map<std::string,SparsityPattern> patterns;
+
+   std::map<std::string,SparsityPattern>::iterator pos( patterns.find( file ) );
+
+   if( pos == patterns.end() ) {
+      const SparsityPattern pattern( file );
+      pos = patterns.insert( std::make_pair( file, pattern ) ).first;
+   }
+
+   return pos->second;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the structure of the sparse matrices of the following benchmark kernels.
+//
+// \param pattern The structure of the sparse matrices.
+// \param file The name of the Matrix Market file in case of the \a external structure.
+// \return void
+//
+// This function selects the structure of all sparse matrices that are set up by the
+// initialization functions of the libraries. By default, the structure given by
+// blazemark::structure (see the 'blazemark/config/Config.h' file) is used.
+*/
+inline void selectOperand( MatrixStructure pattern, const std::string& file )
+{
+   Operand& operand( currentOperand() );
+   operand.structure = pattern;
+   operand.file      = file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the structure of the currently selected sparse operand.
+//
+// \return The structure of the sparse matrices.
+*/
+inline MatrixStructure operandStructure()
+{
+   return currentOperand().structure;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sparsity pattern of the currently selected sparse operand.
+//
+// \param m The number of rows of the sparse matrix (columns in case of column-major matrices).
+// \param n The number of columns of the sparse matrix (rows in case of column-major matrices).
+// \param nonzeros The (average) number of non-zero elements per row.
+// \return Reference to the sparsity pattern.
+// \exception std::invalid_argument Invalid size of Matrix Market operand.
+//
+// This function returns the sparsity pattern of the currently selected structure for the
+// given matrix size. Generated patterns are cached, i.e. consecutive kernels of different
+// libraries are using the identical pattern. In order to be independent of the order of the
+// kernels, all patterns are generated directly after resetting the random seed to
+// blazemark::seed. In case of an \a external operand, the size of the stored matrix has to
+// match the given size. Otherwise a \a std::invalid_argument exception is thrown.
+*/
+inline const SparsityPattern& operandPattern( size_t m, size_t n, size_t nonzeros )
+{
+   const Operand& operand( currentOperand() );
+
+   if( operand.structure == external ) {
+      const SparsityPattern& pattern( loadPattern( operand.file ) );
+      if( pattern.rows() != m || pattern.columns() != n )
+         throw std::invalid_argument( "Invalid size of Matrix Market operand" );
+      return pattern;
+   }
+
+   static SparsityPattern pattern;
+   static MatrixStructure cached( random );
+   static size_t F( 0UL );
+
+   if( pattern.rows() != m || pattern.columns() != n || cached != operand.structure ||
+       F != nonzeros || pattern.rows() == 0UL )
+   {
+      ::blaze::setSeed( seed );
+      SparsityPattern( operand.structure, m, n, nonzeros ).swap( pattern );
+      cached = operand.structure;
+      F = nonzeros;
+   }
+
+   return pattern;
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
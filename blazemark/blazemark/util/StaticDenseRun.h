@@ -100,6 +100,7 @@ class StaticDenseRun
    inline size_t getNumber() const;
    inline size_t getSteps () const;
    inline size_t getFlops () const;
+   inline size_t getBytes () const;
    inline double getClikeResult    () const;
    inline double getClassicResult  () const;
    inline double getBLASResult     () const;
@@ -115,6 +116,7 @@ class StaticDenseRun
    inline void   setNumber( size_t newNumber );
    inline void   setSteps ( size_t newSteps  );
    inline void   setFlops ( size_t newFlops  );
+   inline void   setBytes ( size_t newBytes  );
    inline void   setClikeResult    ( double result );
    inline void   setClassicResult  ( double result );
    inline void   setBLASResult     ( double result );
@@ -144,6 +146,10 @@ class StaticDenseRun
                        /*!< This value corresponds to the total number of floating point operations
                             (Flops) required for a single computation of the (composite) arithmetic
                             operation. */
+   size_t bytes_;      //!< The estimated memory traffic of the benchmark run.
+                       /*!< This value corresponds to the estimated number of bytes that have to be
+                            transferred from and to main memory for a single computation of the
+                            (composite) arithmetic operation. */
    double clike_;      //!< Benchmark result of the C-like implementation.
    double classic_;    //!< Benchmark result of classic C++ operator overloading.
    double blas_;       //!< Benchmark result of the BLAS implementation.
@@ -185,6 +191,7 @@ inline StaticDenseRun<N>::StaticDenseRun()
    : number_   ( 0UL )  // The target number of fixed size vectors/matrices
    , steps_    ( 0UL )  // The number of steps for the benchmark run
    , flops_    ( 0UL )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0 )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0 )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0 )  // Benchmark result of the BLAS implementation
@@ -216,6 +223,7 @@ inline StaticDenseRun<N>::StaticDenseRun( size_t number )
    : number_   ( number )  // The target number of fixed size vectors/matrices
    , steps_    ( 0UL    )  // The number of steps for the benchmark run
    , flops_    ( 0UL    )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL    )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0    )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0    )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0    )  // Benchmark result of the BLAS implementation
@@ -252,6 +260,7 @@ inline StaticDenseRun<N>::StaticDenseRun( size_t number, size_t steps )
    : number_   ( number )  // The target number of fixed size vectors/matrices
    , steps_    ( steps  )  // The number of steps for the benchmark run
    , flops_    ( 0UL    )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL    )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0    )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0    )  // Benchmark result of the classic C++ implementation
    , blas_     ( 0.0    )  // Benchmark result of the BLAS implementation
@@ -331,6 +340,19 @@ inline size_t StaticDenseRun<N>::getFlops() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the estimated memory traffic.
+//
+// \return The estimated number of bytes transferred from and to main memory.
+*/
+template< size_t N >  // Fixed size of the vectors/matrices
+inline size_t StaticDenseRun<N>::getBytes() const
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the benchmark result of the C-like implementation.
 //
@@ -519,6 +541,20 @@ inline void StaticDenseRun<N>::setFlops( size_t newFlops )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the estimated memory traffic.
+//
+// \param newBytes The new estimated number of bytes transferred from and to main memory.
+// \return void
+*/
+template< size_t N >  // Fixed size of the vectors/matrices
+inline void StaticDenseRun<N>::setBytes( size_t newBytes )
+{
+   bytes_ = newBytes;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Setting the benchmark result of the C-like implementation.
 //
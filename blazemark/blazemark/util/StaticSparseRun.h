@@ -103,6 +103,7 @@ class StaticSparseRun
    inline float  getFillingDegree  () const;
    inline size_t getSteps          () const;
    inline size_t getFlops          () const;
+   inline size_t getBytes          () const;
    inline double getClikeResult    () const;
    inline double getClassicResult  () const;
    inline double getBlazeResult    () const;
@@ -118,6 +119,7 @@ class StaticSparseRun
    inline void   setNonZeros( size_t newNonZeros );
    inline void   setSteps   ( size_t newSteps    );
    inline void   setFlops   ( size_t newFlops    );
+   inline void   setBytes   ( size_t newBytes    );
    inline void   setClikeResult    ( double result );
    inline void   setClassicResult  ( double result );
    inline void   setBlazeResult    ( double result );
@@ -150,6 +152,10 @@ class StaticSparseRun
                        /*!< This value corresponds to the total number of floating point operations
                             (Flops) required for a single computation of the (composite) arithmetic
                             operation. */
+   size_t bytes_;      //!< The estimated memory traffic of the benchmark run.
+                       /*!< This value corresponds to the estimated number of bytes that have to be
+                            transferred from and to main memory for a single computation of the
+                            (composite) arithmetic operation. */
    double clike_;      //!< Benchmark result of the C-like implementation.
    double classic_;    //!< Benchmark result of classic C++ operator overloading.
    double blaze_;      //!< Benchmark result of the Blaze library.
@@ -191,6 +197,7 @@ inline StaticSparseRun<N>::StaticSparseRun()
    , nonzeros_ ( 0UL )  // The number of non-zero elements in the sparse vectors/matrices.
    , steps_    ( 0UL )  // The number of steps for the benchmark run
    , flops_    ( 0UL )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0 )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0 )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0 )  // Benchmark result of the Blaze library
@@ -224,6 +231,7 @@ inline StaticSparseRun<N>::StaticSparseRun( size_t number, size_t nonzeros )
    , nonzeros_ ( nonzeros )  // The number of non-zero elements in the sparse vectors/matrices.
    , steps_    ( 0UL      )  // The number of steps for the benchmark run
    , flops_    ( 0UL      )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL      )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0      )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0      )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0      )  // Benchmark result of the Blaze library
@@ -267,6 +275,7 @@ inline StaticSparseRun<N>::StaticSparseRun( size_t number, size_t nonzeros, size
    , nonzeros_ ( nonzeros )  // The number of non-zero elements in the sparse vectors/matrices
    , steps_    ( steps    )  // The number of steps for the benchmark run
    , flops_    ( 0UL      )  // The number of flops required for the benchmark run
+   , bytes_    ( 0UL      )  // The estimated memory traffic of the benchmark run
    , clike_    ( 0.0      )  // Benchmark result of the C-like implementation
    , classic_  ( 0.0      )  // Benchmark result of the classic C++ implementation
    , blaze_    ( 0.0      )  // Benchmark result of the Blaze library
@@ -375,6 +384,19 @@ inline size_t StaticSparseRun<N>::getFlops() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the estimated memory traffic.
+//
+// \return The estimated number of bytes transferred from and to main memory.
+*/
+template< size_t N >  // Fixed size of the vectors/matrices
+inline size_t StaticSparseRun<N>::getBytes() const
+{
+   return bytes_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the benchmark result of the C-like implementation.
 //
@@ -567,6 +589,20 @@ inline void StaticSparseRun<N>::setFlops( size_t newFlops )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Setting the estimated memory traffic.
+//
+// \param newBytes The new estimated number of bytes transferred from and to main memory.
+// \return void
+*/
+template< size_t N >  // Fixed size of the vectors/matrices
+inline void StaticSparseRun<N>::setBytes( size_t newBytes )
+{
+   bytes_ = newBytes;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Setting the benchmark result of the C-like implementation.
 //
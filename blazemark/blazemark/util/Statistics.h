@@ -0,0 +1,174 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Statistics.h
+//  \brief Header file for the statistical evaluation of benchmark timings
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_STATISTICS_H_
+#define _BLAZEMARK_UTIL_STATISTICS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <blazemark/system/Types.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  STATISTICS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the given percentile of a series of time measurements.
+//
+// \param samples The time measurements.
+// \param p The percentile \f$[0..100]\f$.
+// \return The percentile of the measurements (0 in case the series is empty).
+//
+// The percentile is linearly interpolated between the two closest ranks of the sorted series,
+// i.e. the 50th percentile corresponds to the median of the series.
+*/
+inline double percentile( std::vector<double> samples, double p )
+{
+   if( samples.empty() ) return 0.0;
+
+   std::sort( samples.begin(), samples.end() );
+
+   const double rank( p * 0.01 * ( samples.size() - 1UL ) );
+   const size_t lower( static_cast<size_t>( std::floor( rank ) ) );
+   const size_t upper( std::min( lower + 1UL, samples.size() - 1UL ) );
+
+   return samples[lower] + ( rank - lower ) * ( samples[upper] - samples[lower] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the arithmetic mean of a series of time measurements.
+//
+// \param samples The time measurements.
+// \return The mean of the measurements (0 in case the series is empty).
+*/
+inline double mean( const std::vector<double>& samples )
+{
+   if( samples.empty() ) return 0.0;
+
+   double sum( 0.0 );
+   for( size_t i=0UL; i<samples.size(); ++i )
+      sum += samples[i];
+
+   return sum / samples.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sample variance of a series of time measurements.
+//
+// \param samples The time measurements.
+// \return The (unbiased) sample variance of the measurements (0 for less than two measurements).
+*/
+inline double variance( const std::vector<double>& samples )
+{
+   if( samples.size() < 2UL ) return 0.0;
+
+   const double avg( mean( samples ) );
+
+   double sum( 0.0 );
+   for( size_t i=0UL; i<samples.size(); ++i )
+      sum += ( samples[i] - avg ) * ( samples[i] - avg );
+
+   return sum / ( samples.size() - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a quantile of Student's t-distribution.
+//
+// \param df The degrees of freedom of the distribution.
+// \param twoSided \a true for the 97.5% quantile, \a false for the 95% quantile.
+// \return The quantile of the t-distribution.
+//
+// This function returns the 97.5% quantile (used for two-sided 95% confidence intervals) or the
+// 95% quantile (used for one-sided tests on the 5% significance level) of Student's
+// t-distribution with the given degrees of freedom. Fractional degrees of freedom are rounded
+// down, which results in a conservative quantile.
+*/
+inline double studentQuantile( double df, bool twoSided )
+{
+   static const double q975[30] = {
+      12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+       2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+       2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+
+   static const double q950[30] = {
+       6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+       1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+       1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697 };
+
+   const size_t n( df < 1.0 ? 1UL : static_cast<size_t>( std::floor( df ) ) );
+
+   if( n > 30UL )
+      return ( twoSided )?( 1.960 ):( 1.645 );
+   else
+      return ( twoSided )?( q975[n-1UL] ):( q950[n-1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the half-width of the 95% confidence interval of the mean of a series.
+//
+// \param samples The time measurements.
+// \return The half-width of the confidence interval (0 for less than two measurements).
+*/
+inline double confidence( const std::vector<double>& samples )
+{
+   if( samples.size() < 2UL ) return 0.0;
+
+   return studentQuantile( samples.size() - 1UL, true ) *
+          std::sqrt( variance( samples ) / samples.size() );
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Threads.h
+//  \brief Header file for the thread configuration of the SMP backends
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_THREADS_H_
+#define _BLAZEMARK_UTIL_THREADS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/system/SMP.h>
+#include <blazemark/system/Types.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_THREAD_TEAM_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  THREAD CONFIGURATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads used by the active SMP backend of the Blaze library.
+//
+// \return The number of threads used for SMP assignments.
+//
+// In case the OpenMP backend is active, this function returns the maximum number of threads of
+// an OpenMP parallel region. In case the thread team backend is active, it returns the size of
+// the thread team. In case the shared-memory parallelization is disabled, the function returns 1.
+*/
+inline size_t getNumThreads()
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return static_cast<size_t>( omp_get_max_threads() );
+#elif BLAZE_THREAD_TEAM_PARALLEL_MODE
+   return ::blaze::getNumThreads();
+#else
+   return 1UL;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of threads used by the active SMP backend of the Blaze library.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function sets the number of threads used for all subsequent SMP assignments. In case the
+// shared-memory parallelization is disabled, only a single thread can be selected and any other
+// number of threads results in a \a std::invalid_argument exception.
+*/
+inline void setNumThreads( size_t n )
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   omp_set_num_threads( static_cast<int>( n ) );
+#elif BLAZE_THREAD_TEAM_PARALLEL_MODE
+   ::blaze::setNumThreads( n );
+#else
+   if( n != 1UL )
+      throw std::invalid_argument( "Multiple threads require an active SMP backend" );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
@@ -0,0 +1,242 @@
+//=================================================================================================
+/*!
+//  \file blazemark/util/Timer.h
+//  \brief Header file for the Timer class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZEMARK_UTIL_TIMER_H_
+#define _BLAZEMARK_UTIL_TIMER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/util/timing/PerfPolicy.h>
+#include <blaze/util/timing/Timer.h>
+
+
+namespace blazemark {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Wall clock timer for the benchmark kernels.
+//
+// The Timer class extends the wall clock timer of the Blaze library by recording each single
+// time measurement. The creation of a new timer discards the measurements of all previously
+// created timers, i.e. after a benchmark kernel has been run, the measurements() function
+// returns the runtimes of all repetitions of this kernel:
+
+   \code
+   run->setBlazeResult( blazemark::blaze::dmatdvecmult( N, steps ) );
+   const std::vector<double>& samples( blazemark::Timer::measurements() );
+   \endcode
+
+// In case the hardware performance counters are enabled (see blaze::timing::PerfPolicy), the
+// timer additionally records the hardware events of each repetition, which are accessible via
+// the counts() function.
+*/
+class Timer : public ::blaze::timing::Timer< ::blaze::timing::PerfPolicy >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef ::blaze::timing::Timer< ::blaze::timing::PerfPolicy >  BaseType;  //!< Base type.
+   typedef ::blaze::timing::PerfPolicy::Event                      Event;     //!< Hardware event.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Timer();
+   //@}
+   //**********************************************************************************************
+
+   //**Timing functions****************************************************************************
+   /*!\name Timing functions */
+   //@{
+   inline void end();
+   //@}
+   //**********************************************************************************************
+
+   //**Time evaluation functions*******************************************************************
+   /*!\name Time evaluation functions */
+   //@{
+   static inline const std::vector<double>& measurements();
+   static inline const std::vector<double>& counts( Event event );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline std::vector<double>& records();
+   static inline std::vector<double>* counterRecords();
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor of the Timer class.
+//
+// The creation of a new timer discards all previously recorded measurements and immediately
+// starts a new time measurement.
+*/
+inline Timer::Timer()
+   : BaseType()  // Initialization of the base class
+{
+   using ::blaze::timing::PerfPolicy;
+
+   records().clear();
+
+   for( int i=0; i<PerfPolicy::events; ++i )
+      counterRecords()[i].clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIMING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Ends a single time measurement and records the measured time.
+//
+// \return void
+//
+// In case the hardware performance counters are enabled, the function additionally records
+// the hardware events of the time measurement.
+*/
+inline void Timer::end()
+{
+   using ::blaze::timing::PerfPolicy;
+
+   BaseType::end();
+   records().push_back( last() );
+
+   if( PerfPolicy::isEnabled() ) {
+      for( int i=0; i<PerfPolicy::events; ++i )
+         counterRecords()[i].push_back( PerfPolicy::last( static_cast<Event>( i ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TIME EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns all time measurements of the most recently created timer.
+//
+// \return The recorded time measurements.
+*/
+inline const std::vector<double>& Timer::measurements()
+{
+   return records();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the hardware event counts of all time measurements of the most recent timer.
+//
+// \param event The hardware event.
+// \return The recorded event counts (empty in case the hardware counters are not enabled).
+*/
+inline const std::vector<double>& Timer::counts( Event event )
+{
+   return counterRecords()[event];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the record of time measurements.
+//
+// \return Reference to the record of time measurements.
+*/
+inline std::vector<double>& Timer::records()
+{
+   static std::vector<double> measurements;
+   return measurements;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the records of hardware event counts.
+//
+// \return Pointer to the first of the records of all hardware events.
+*/
+inline std::vector<double>* Timer::counterRecords()
+{
+   static std::vector<double> counts[::blaze::timing::PerfPolicy::events];
+   return counts;
+}
+//*************************************************************************************************
+
+} // namespace blazemark
+
+#endif
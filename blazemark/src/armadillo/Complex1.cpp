@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/Complex1.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double complex1( size_t N, size_t steps )
 
    ::arma::Mat<element_t> A( N, N );
    ::arma::Col<element_t> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/Complex5.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double complex5( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::arma::Mat<element_t> A( N, N ), B( N, N ), C( N, N ), D( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
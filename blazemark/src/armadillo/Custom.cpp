@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/Custom.h>
 #include <blazemark/armadillo/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/DVecDVecCross.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double dvecdveccross( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::arma::Col<element_t> > a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0; i<N; ++i ) {
       a[i].resize( 3UL );
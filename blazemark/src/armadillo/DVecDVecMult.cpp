@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/DVecDVecMult.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double dvecdvecmult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::arma::Col<element_t> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/DVecNorm.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double dvecnorm( size_t N, size_t steps )
 
    ::arma::Col<element_t> a( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
 
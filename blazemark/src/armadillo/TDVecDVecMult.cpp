@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/armadillo/TDVecDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double tdvecdvecmult( size_t N, size_t steps )
 
    ::arma::Col<element_t> a( N ), b( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/armadillo/init/Row.h>
 #include <blazemark/armadillo/TDVecTDMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double tdvectdmatmult( size_t N, size_t steps )
 
    ::arma::Mat<element_t> A( N, N );
    ::arma::Row<element_t> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
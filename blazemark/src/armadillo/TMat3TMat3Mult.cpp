@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/armadillo/TMat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double tmat3tmat3mult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::arma::Mat<element_t> > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3UL, 3UL );
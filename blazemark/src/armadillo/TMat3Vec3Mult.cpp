@@ -40,11 +40,11 @@
 #include <iostream>
 #include <vector>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/init/Col.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/armadillo/TMat3Vec3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double tmat3vec3mult( size_t N, size_t steps )
 
    ::std::vector< ::arma::Mat<element_t> > A( N );
    ::std::vector< ::arma::Col<element_t> > a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3UL, 3UL );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <vector>
 #include <armadillo>
-#include <blaze/util/Timing.h>
 #include <blazemark/armadillo/init/Mat.h>
 #include <blazemark/armadillo/init/Row.h>
 #include <blazemark/armadillo/TVec6TMat6Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double tvec6tmat6mult( size_t N, size_t steps )
 
    ::std::vector< ::arma::Row<element_t> > a( N ), b( N );
    ::std::vector< ::arma::Mat<element_t> > A( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       a[i].resize( 6UL );
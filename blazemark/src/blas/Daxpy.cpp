@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blas/init/DynamicVector.h>
 #include <blazemark/blas/Daxpy.h>
 #include <blazemark/system/BLAS.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -119,7 +119,7 @@ double daxpy( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N, 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
 
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blas/init/DynamicMatrix.h>
 #include <blazemark/blas/TDMatDMatMult.h>
 #include <blazemark/system/BLAS.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -142,7 +142,7 @@ double tdmatdmatmult( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N ), C( N, N );
    ::blaze::DynamicMatrix<element_t,rowMajor> B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
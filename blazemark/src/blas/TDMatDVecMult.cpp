@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blas/Init.h>
 #include <blazemark/blas/TDMatDVecMult.h>
 #include <blazemark/system/BLAS.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -139,7 +139,7 @@ double tdmatdvecmult( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N );
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
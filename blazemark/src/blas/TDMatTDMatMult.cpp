@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blas/init/DynamicMatrix.h>
 #include <blazemark/blas/TDMatTDMatMult.h>
 #include <blazemark/system/BLAS.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -140,7 +140,7 @@ double tdmattdmatmult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N ), B( N, N ), C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blas/Init.h>
 #include <blazemark/blas/TDVecDMatMult.h>
 #include <blazemark/system/BLAS.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -139,7 +139,7 @@ double tdvecdmatmult( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N );
    ::blaze::DynamicVector<element_t,rowVector> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( A );
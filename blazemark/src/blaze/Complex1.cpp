@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/Complex1.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double complex1( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N );
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
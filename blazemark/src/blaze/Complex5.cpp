@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/Complex5.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double complex5( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N ), B( N, N ), C( N, N ), D( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/Math.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/Custom.h>
 #include <blazemark/blaze/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
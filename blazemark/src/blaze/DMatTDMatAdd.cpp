@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DMatTDMatAdd.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double dmattdmatadd( size_t N, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N ), C( N, N );
    ::blaze::DynamicMatrix<element_t,columnMajor> B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DMatTSMatAdd.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double dmattsmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N ), C( N, N );
    ::blaze::CompressedMatrix<element_t,columnMajor> B( N, N, N*F );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B, F );
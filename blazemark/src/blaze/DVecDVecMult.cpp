@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DVecDVecMult.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double dvecdvecmult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DVecSVecAdd.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double dvecsvecadd( size_t N, size_t F, size_t steps )
 
    ::blaze::DynamicVector<element_t,columnVector> a( N ), c( N );
    ::blaze::CompressedVector<element_t,columnVector> b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b, F );
@@ -42,11 +42,11 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DVecSVecCross.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -82,7 +82,7 @@ double dvecsveccross( size_t N, size_t F, size_t steps )
 
    ::std::vector< VectorType, AllocatorType > a( N ), c( N );
    ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       b[i].resize( 3UL );
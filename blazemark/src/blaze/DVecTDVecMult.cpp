@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/DVecTDVecMult.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double dvectdvecmult( size_t N, size_t steps )
    ::blaze::DynamicVector<element_t,columnVector> a( N );
    ::blaze::DynamicVector<element_t,rowVector> b( N );
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b );
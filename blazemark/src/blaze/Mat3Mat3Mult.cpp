@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticMatrix.h>
 #include <blazemark/blaze/Mat3Mat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double mat3mat3mult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< MatrixType, AllocatorType > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
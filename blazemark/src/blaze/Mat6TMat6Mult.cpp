@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticMatrix.h>
 #include <blazemark/blaze/Mat6TMat6Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -82,7 +82,7 @@ double mat6tmat6mult( size_t N, size_t steps )
 
    ::std::vector< RowMajorMatrixType, RowMajorAllocatorType > A( N ), C( N );
    ::std::vector< ColumnMajorMatrixType, ColumnMajorAllocatorType > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/SMatSMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double smatsmatmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), B( N, N, N*F ), C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B, F );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/blaze/SMatTDMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double smattdmatadd( size_t N, size_t F, size_t steps )
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
    ::blaze::DynamicMatrix<element_t,columnMajor> B( N, N );
    ::blaze::DynamicMatrix<element_t,rowMajor> C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B );
@@ -41,11 +41,11 @@
 #include <vector>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/blaze/SMatTDMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double smattdmatmult( size_t N, size_t F, size_t steps )
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
    ::blaze::DynamicMatrix<element_t,columnMajor> B( N, N );
    ::blaze::DynamicMatrix<element_t,rowMajor> C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B );
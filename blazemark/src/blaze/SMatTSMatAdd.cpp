@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/SMatTSMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double smattsmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), C( N, N );;
    ::blaze::CompressedMatrix<element_t,columnMajor> B( N, N, N*F );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B, F );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/CompressedVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/SVecSVecAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double svecsvecadd( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::CompressedVector<element_t,columnVector> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a, F );
    init( b, F );
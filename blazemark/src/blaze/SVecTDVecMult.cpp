@@ -41,11 +41,11 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/blaze/SVecTDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -81,7 +81,7 @@ double svectdvecmult( size_t N, size_t F, size_t steps )
    ::blaze::CompressedVector<element_t,columnVector> a( N );
    ::blaze::DynamicVector<element_t,rowVector> b( N );
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a, F );
    init( b );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/SVecTSVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double svectsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::CompressedVector<element_t,columnVector> a( N );
    ::blaze::CompressedVector<element_t,rowVector> b( N );
    ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a, F );
    init( b, F );
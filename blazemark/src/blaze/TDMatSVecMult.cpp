@@ -41,11 +41,11 @@
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/DynamicMatrix.h>
 #include <blazemark/blaze/TDMatSVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double tdmatsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::DynamicMatrix<element_t,columnMajor> A( N, N );
    ::blaze::CompressedVector<element_t,columnVector> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a, F );
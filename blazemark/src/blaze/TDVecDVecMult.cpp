@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/blaze/TDVecDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double tdvecdvecmult( size_t N, size_t steps )
    ::blaze::DynamicVector<element_t,rowVector> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/DynamicVector.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedVector.h>
 #include <blazemark/blaze/init/DynamicVector.h>
 #include <blazemark/blaze/TDVecSVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double tdvecsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::DynamicVector<element_t,rowVector> a( N );
    ::blaze::CompressedVector<element_t,columnVector> b( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b, F );
@@ -42,11 +42,11 @@
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticMatrix.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/blaze/TMat3Vec3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -84,7 +84,7 @@ double tmat3vec3mult( size_t N, size_t steps )
 
    ::std::vector< MatrixType, MatrixAllocatorType > A( N );
    ::std::vector< VectorType, VectorAllocatorType > a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
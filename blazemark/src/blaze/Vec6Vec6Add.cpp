@@ -41,10 +41,10 @@
 #include <vector>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/AlignedAllocator.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticVector.h>
 #include <blazemark/blaze/Vec6Vec6Add.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double vec6vec6add( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< VectorType, AllocatorType > a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( a[i] );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blitz/array.h>
 #include <boost/cast.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/Complex2.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double complex2( size_t N, size_t steps )
    ::blitz::Array<element_t,1> a( N ), b( N ), c( N ), d( N );
    ::blitz::firstIndex i;
    ::blitz::secondIndex j;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    initColumnMajorMatrix( A );
    init( a );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blitz/array.h>
 #include <boost/cast.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/Complex5.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double complex5( size_t N, size_t steps )
    ::blitz::firstIndex i;
    ::blitz::secondIndex j;
    ::blitz::thirdIndex k;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    initColumnMajorMatrix( A );
    initColumnMajorMatrix( B );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blitz/array.h>
 #include <blitz/tinyvec2.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/Custom.h>
 #include <blazemark/blitz/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blitz/array.h>
 #include <boost/cast.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/DMatTDMatAdd.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double dmattdmatadd( size_t N, size_t steps )
 
    ::blitz::Array<element_t,2> A( N, N ), C( N, N );
    ::blitz::Array<element_t,2> B( N, N, ::blitz::fortranArray );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    initRowMajorMatrix   ( A );
    initColumnMajorMatrix( B );
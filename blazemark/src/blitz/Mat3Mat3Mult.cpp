@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <blitz/array.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/blitz/Mat3Mat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double mat3mat3mult( size_t N, size_t steps )
    ::blitz::firstIndex i;
    ::blitz::secondIndex j;
    ::blitz::thirdIndex k;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t l=0UL; l<N; ++l ) {
       A[l].resize( 3, 3 );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <blitz/array.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/blitz/Mat3Vec3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double mat3vec3mult( size_t N, size_t steps )
    ::std::vector< ::blitz::Array<element_t,1> > a( N ), b( N );
    ::blitz::firstIndex i;
    ::blitz::secondIndex j;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t l=0UL; l<N; ++l ) {
       A[l].resize( 3, 3 );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <blitz/array.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/blitz/Mat6Mat6Add.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double mat6mat6add( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::blitz::Array<element_t,2> > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t l=0; l<N; ++l ) {
       A[l].resize( 6, 6 );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <blitz/array.h>
 #include <boost/cast.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/blitz/TDMatTDMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double tdmattdmatadd( size_t N, size_t steps )
    ::blitz::Array<element_t,2> A( N, N, ::blitz::fortranArray );
    ::blitz::Array<element_t,2> B( N, N, ::blitz::fortranArray );
    ::blitz::Array<element_t,2> C( N, N, ::blitz::fortranArray );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    initColumnMajorMatrix( A );
    initColumnMajorMatrix( B );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <blitz/array.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/blitz/init/Array.h>
 #include <blazemark/blitz/TMat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double tmat3tmat3mult( size_t N, size_t steps )
    ::std::vector< ::blitz::Array<element_t,2> > A( N, ::blitz::Array<element_t,2>( ::blitz::fortranArray ) );
    ::std::vector< ::blitz::Array<element_t,2> > B( N, ::blitz::Array<element_t,2>( ::blitz::fortranArray ) );
    ::std::vector< ::blitz::Array<element_t,2> > C( N, ::blitz::Array<element_t,2>( ::blitz::fortranArray ) );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t l=0; l<N; ++l ) {
       A[l].resize( 3, 3 );
@@ -41,10 +41,10 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/vector.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/CG.h>
 #include <blazemark/boost/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    ::boost::numeric::ublas::compressed_matrix<element_t,row_major> A( NN, NN );
    ::boost::numeric::ublas::vector<element_t> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       for( size_t j=0UL; j<N; ++j ) {
@@ -41,11 +41,11 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/Complex2.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/boost/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double complex2( size_t N, size_t steps )
 
    ::boost::numeric::ublas::matrix<element_t,column_major> A( N, N );
    ::boost::numeric::ublas::vector<element_t> a( N ), b( N ), c( N ), d( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
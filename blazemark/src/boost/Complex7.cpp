@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/Complex7.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double complex7( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::boost::numeric::ublas::matrix<element_t,column_major> A( N, N ), B( N, N ), C( N, N ), D( N, N ), E( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -43,10 +43,10 @@
 #include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/Custom.h>
 #include <blazemark/boost/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
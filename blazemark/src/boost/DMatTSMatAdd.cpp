@@ -41,11 +41,11 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/DMatTSMatAdd.h>
 #include <blazemark/boost/init/CompressedMatrix.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double dmattsmatadd( size_t N, size_t F, size_t steps )
 
    ::boost::numeric::ublas::matrix<element_t,row_major> A( N, N ), C( N, N );
    ::boost::numeric::ublas::compressed_matrix<element_t,column_major> B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B, F );
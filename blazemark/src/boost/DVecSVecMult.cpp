@@ -41,11 +41,11 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/DVecSVecMult.h>
 #include <blazemark/boost/init/CompressedVector.h>
 #include <blazemark/boost/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double dvecsvecmult( size_t N, size_t F, size_t steps )
 
    ::boost::numeric::ublas::vector<element_t> a( N );
    ::boost::numeric::ublas::compressed_vector<element_t> b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b, F );
@@ -41,10 +41,10 @@
 #include <vector>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/boost/Mat3Mat3Add.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double mat3mat3add( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::boost::numeric::ublas::matrix<element_t,row_major> > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3UL, 3UL );
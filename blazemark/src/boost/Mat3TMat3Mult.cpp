@@ -41,10 +41,10 @@
 #include <vector>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/boost/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector< ::boost::numeric::ublas::matrix<element_t,row_major> > A( N ), C( N );
    ::std::vector< ::boost::numeric::ublas::matrix<element_t,column_major> > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3UL, 3UL );
@@ -41,11 +41,11 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/vector_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/init/CompressedMatrix.h>
 #include <blazemark/boost/init/CompressedVector.h>
 #include <blazemark/boost/SMatSVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double smatsvecmult( size_t N, size_t F, size_t steps )
 
    ::boost::numeric::ublas::compressed_matrix<element_t,row_major> A( N, N );
    ::boost::numeric::ublas::compressed_vector<element_t> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( a, F );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/init/CompressedMatrix.h>
 #include <blazemark/boost/SMatScalarMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double smatscalarmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::boost::numeric::ublas::compressed_matrix<element_t,row_major> A( N, N ), B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
 
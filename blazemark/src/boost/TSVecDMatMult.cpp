@@ -42,11 +42,11 @@
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_sparse.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/boost/init/CompressedVector.h>
 #include <blazemark/boost/init/Matrix.h>
 #include <blazemark/boost/TSVecDMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double tsvecdmatmult( size_t N, size_t F, size_t steps )
    ::boost::numeric::ublas::matrix<element_t,row_major> A( N, N );
    ::boost::numeric::ublas::compressed_vector<element_t> a( N );
    ::boost::numeric::ublas::vector<element_t> b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a, F );
    init( A );
@@ -38,13 +38,13 @@
 //*************************************************************************************************
 
 #include <iostream>
-#include <blaze/util/Timing.h>
 #include <blazemark/classic/Complex3.h>
 #include <blazemark/classic/init/Matrix.h>
 #include <blazemark/classic/init/Vector.h>
 #include <blazemark/classic/Matrix.h>
 #include <blazemark/classic/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double complex3( size_t N, size_t steps )
 
    ::blazemark::classic::Matrix<element_t,true> A( N, N ), B( N, N );
    ::blazemark::classic::Vector<element_t> a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -38,11 +38,11 @@
 //*************************************************************************************************
 
 #include <iostream>
-#include <blaze/util/Timing.h>
 #include <blazemark/classic/Complex6.h>
 #include <blazemark/classic/init/Matrix.h>
 #include <blazemark/classic/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double complex6( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blazemark::classic::Matrix<element_t,true> A( N, N ), B( N, N ), C( N, N ), D( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
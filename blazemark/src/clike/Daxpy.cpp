@@ -39,9 +39,9 @@
 
 #include <iostream>
 #include <blaze/util/Random.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/clike/Daxpy.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -71,7 +71,7 @@ double daxpy( size_t N, size_t steps )
 
    element_t* a = new element_t[N];
    element_t* b = new element_t[N];
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       a[i] = ::blaze::rand<element_t>();
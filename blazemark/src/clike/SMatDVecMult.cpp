@@ -39,10 +39,11 @@
 
 #include <iostream>
 #include <blaze/util/Random.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/clike/SMatDVecMult.h>
 #include <blazemark/system/Config.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/SparsityPattern.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,24 +73,44 @@ double smatdvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   element_t* value = new element_t[F*N];
-   size_t* index = new size_t[F*N];
+   const bool uniform( operandStructure() == random );
+   const size_t capacity( uniform ? F*N : operandPattern( N, N, F ).nonZeros() );
+
+   element_t* value = new element_t[capacity];
+   size_t* index = new size_t[capacity];
    size_t* row = new size_t[N+1UL];
    element_t* a = new element_t[N];
    element_t* b = new element_t[N];
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
    size_t counter( 0 );
 
-   for( size_t i=0UL; i<N; ++i ) {
-      ::blazemark::Indices indices( N, F );
-      for( ::blazemark::Indices::Iterator it=indices.begin(); it!=indices.end(); ++it ) {
-         value[counter] = ::blaze::rand<element_t>();
-         index[counter] = *it;
-         ++counter;
+   if( uniform )
+   {
+      for( size_t i=0UL; i<N; ++i ) {
+         ::blazemark::Indices indices( N, F );
+         for( ::blazemark::Indices::Iterator it=indices.begin(); it!=indices.end(); ++it ) {
+            value[counter] = ::blaze::rand<element_t>();
+            index[counter] = *it;
+            ++counter;
+         }
+         row[i] = i*F;
+      }
+      row[N] = N*F;
+   }
+   else
+   {
+      const SparsityPattern& pattern( operandPattern( N, N, F ) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         row[i] = counter;
+         for( SparsityPattern::Iterator it=pattern.begin(i); it!=pattern.end(i); ++it ) {
+            value[counter] = ::blaze::rand<element_t>();
+            index[counter] = *it;
+            ++counter;
+         }
       }
-      row[i] = i*F;
+      row[N] = counter;
    }
-   row[N] = N*F;
 
    for( size_t i=0UL; i<N; ++i ) {
       a[i] = ::blaze::rand<element_t>();
@@ -41,10 +41,10 @@
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/CG.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -82,7 +82,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    ::Eigen::SparseMatrix<element_t,RowMajor,EigenSparseIndexType> A( NN, NN );
    ::Eigen::Matrix<element_t,Dynamic,1> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    A.reserve( NN*5UL );
 
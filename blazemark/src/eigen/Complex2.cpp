@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/Complex2.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double complex2( size_t N, size_t steps )
 
    ::Eigen::Matrix<element_t,Dynamic,Dynamic,ColMajor> A( N, N );
    ::Eigen::Matrix<element_t,Dynamic,1> a( N ), b( N ), c( N ), d( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/Complex5.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double complex5( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::Eigen::Matrix<element_t,Dynamic,Dynamic,ColMajor> A( N, N ), B( N, N ), C( N, N ), D( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -41,10 +41,10 @@
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/Custom.h>
 #include <blazemark/eigen/Init.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double custom( size_t /*N*/, size_t /*F*/, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    //** INITIALIZATIONS **
 
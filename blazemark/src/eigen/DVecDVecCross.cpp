@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/DVecDVecCross.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double dvecdveccross( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::Eigen::Matrix<element_t,3,1> > a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( a[i] );
@@ -41,10 +41,10 @@
 #include <vector>
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/eigen/Mat3Mat3Add.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double mat3mat3add( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< ::Eigen::Matrix<element_t,3,3,RowMajor> > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
@@ -41,10 +41,10 @@
 #include <vector>
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/eigen/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector< ::Eigen::Matrix<element_t,3,3,RowMajor> > A( N ), C( N );
    ::std::vector< ::Eigen::Matrix<element_t,3,3,ColMajor> > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
@@ -41,10 +41,10 @@
 #include <vector>
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/eigen/Mat3Vec3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double mat3vec3mult( size_t N, size_t steps )
 
    ::std::vector< ::Eigen::Matrix<element_t,3,3,RowMajor> > A( N );
    ::std::vector< ::Eigen::Matrix<element_t,3,1> > a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       init( A[i] );
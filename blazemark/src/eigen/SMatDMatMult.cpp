@@ -41,11 +41,11 @@
 #include <boost/cast.hpp>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/init/Matrix.h>
 #include <blazemark/eigen/init/SparseMatrix.h>
 #include <blazemark/eigen/SMatDMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -80,7 +80,7 @@ double smatdmatmult( size_t N, size_t F, size_t steps )
 
    ::Eigen::SparseMatrix<element_t,RowMajor,EigenSparseIndexType> A( N, N );
    ::Eigen::Matrix<element_t,Dynamic,Dynamic,RowMajor> B( N, N ), C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B );
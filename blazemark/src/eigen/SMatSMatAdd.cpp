@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <Eigen/Sparse>
-#include <blaze/util/Timing.h>
 #include <blazemark/eigen/init/SparseMatrix.h>
 #include <blazemark/eigen/SMatSMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double smatsmatadd( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::Eigen::SparseMatrix<element_t,RowMajor,EigenSparseIndexType> A( N, N ), B( N, N ), C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B, F );
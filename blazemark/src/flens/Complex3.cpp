@@ -40,11 +40,11 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <flens/flens.cxx>
-#include <blaze/util/Timing.h>
 #include <blazemark/flens/Complex3.h>
 #include <blazemark/flens/init/DenseVector.h>
 #include <blazemark/flens/init/GeMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double complex3( size_t N, size_t steps )
 
    ColGeMatrix A( N, N ), B( N, N );
    DenseVector a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <flens/flens.cxx>
-#include <blaze/util/Timing.h>
 #include <blazemark/flens/Complex5.h>
 #include <blazemark/flens/init/GeMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double complex5( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ColGeMatrix A( N, N ), B( N, N ), C( N, N ), D( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <flens/flens.cxx>
-#include <blaze/util/Timing.h>
 #include <blazemark/flens/init/GeMatrix.h>
 #include <blazemark/flens/Mat3Mat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double mat3mat3mult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< RowGeMatrix > A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3, 3 );
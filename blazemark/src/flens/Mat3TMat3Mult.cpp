@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <flens/flens.cxx>
-#include <blaze/util/Timing.h>
 #include <blazemark/flens/init/GeMatrix.h>
 #include <blazemark/flens/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector< RowGeMatrix > A( N ), C( N );
    ::std::vector< ColGeMatrix > B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].resize( 3, 3 );
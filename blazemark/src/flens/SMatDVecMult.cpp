@@ -40,11 +40,11 @@
 #include <iostream>
 #include <boost/cast.hpp>
 #include <flens/flens.cxx>
-#include <blaze/util/Timing.h>
 #include <blazemark/flens/init/DenseVector.h>
 #include <blazemark/flens/init/GeCRSMatrix.h>
 #include <blazemark/flens/SMatDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -81,7 +81,7 @@ double smatdvecmult( size_t N, size_t F, size_t steps )
 
    RowGeCRSMatrix A;
    DenseVector a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, N, N, F );
    init( a );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/CG.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -78,7 +78,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    ::gmm::csr_matrix<element_t> A( NN, NN );
    ::std::vector<element_t> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       for( size_t j=0UL; j<N; ++j ) {
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/Complex1.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double complex1( size_t N, size_t steps )
 
    ::gmm::dense_matrix<element_t> A( N, N );
    ::std::vector<element_t> a( N ), b( N ), c( N ), tmp( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( a );
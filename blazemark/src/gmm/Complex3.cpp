@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/Complex3.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double complex3( size_t N, size_t steps )
 
    ::gmm::dense_matrix<element_t> A( N, N ), B( N, N );
    ::std::vector<element_t> a( N ), b( N ), c( N ), tmp1( N ), tmp2( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/Complex7.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -73,7 +73,7 @@ double complex7( size_t N, size_t steps )
 
    ::gmm::dense_matrix<element_t> A( N, N ), B( N, N ), C( N, N ), D( N, N ), E( N, N );
    ::gmm::dense_matrix<element_t> T1( N, N ), T2( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
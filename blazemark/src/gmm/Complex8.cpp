@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/Complex8.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -72,7 +72,7 @@ double complex8( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::gmm::dense_matrix<element_t> A( N, N ), B( N, N ), C( N, N ), T( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
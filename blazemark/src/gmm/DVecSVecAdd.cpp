@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/DVecSVecAdd.h>
 #include <blazemark/gmm/init/RSVector.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double dvecsvecadd( size_t N, size_t F, size_t steps )
 
    ::std::vector<element_t> a( N ), c( N );
    ::gmm::rsvector<element_t> b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b, F );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/CSRMatrix.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/gmm/SMatDVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double smatdvecmult( size_t N, size_t F, size_t steps )
 
    ::gmm::csr_matrix<element_t> A( N, N );
    ::std::vector<element_t> a( N ), b( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( a );
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/CSRMatrix.h>
 #include <blazemark/gmm/SMatSMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -74,7 +74,7 @@ double smatsmatadd( size_t N, size_t F, size_t steps )
 
    ::gmm::csr_matrix<element_t> A( N, N ), B( N, N );
    ::gmm::row_matrix< ::gmm::wsvector<element_t> > C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B, F );
@@ -40,11 +40,11 @@
 #include <iostream>
 #include <vector>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/CSRMatrix.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/gmm/SMatTDMatMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double smattdmatmult( size_t N, size_t F, size_t steps )
 
    ::gmm::csr_matrix<element_t> A( N, N );
    ::gmm::dense_matrix<element_t> B( N, N ), C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/RSVector.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/gmm/SVecDVecAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double svecdvecadd( size_t N, size_t F, size_t steps )
 
    ::gmm::rsvector<element_t> a( N );
    ::std::vector<element_t> b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a, F );
    init( b );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/CSCMatrix.h>
 #include <blazemark/gmm/init/DenseMatrix.h>
 #include <blazemark/gmm/TDMatTSMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -75,7 +75,7 @@ double tdmattsmatadd( size_t N, size_t F, size_t steps )
 
    ::gmm::dense_matrix<element_t> A( N, N ), C( N, N );
    ::gmm::csc_matrix<element_t> B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B, F );
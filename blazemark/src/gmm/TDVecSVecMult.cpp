@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/RSVector.h>
 #include <blazemark/gmm/init/Vector.h>
 #include <blazemark/gmm/TDVecSVecMult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double tdvecsvecmult( size_t N, size_t F, size_t steps )
    ::std::vector<element_t> a( N );
    ::gmm::rsvector<element_t> b( N );
    element_t scalar( 0 );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( a );
    init( b, F );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <gmm/gmm.h>
-#include <blaze/util/Timing.h>
 #include <blazemark/gmm/init/CSCMatrix.h>
 #include <blazemark/gmm/init/CSRMatrix.h>
 #include <blazemark/gmm/TSMatSMatAdd.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -76,7 +76,7 @@ double tsmatsmatadd( size_t N, size_t F, size_t steps )
    ::gmm::csc_matrix<element_t> A( N, N );
    ::gmm::csr_matrix<element_t> B( N, N );
    ::gmm::row_matrix< ::gmm::wsvector<element_t> > C( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A, F );
    init( B, F );
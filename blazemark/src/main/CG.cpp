@@ -59,7 +59,9 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
 #include <blazemark/util/SolverRun.h>
 
 
@@ -209,6 +211,8 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "cg" );
+
    std::sort( runs.begin(), runs.end() );
 
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
@@ -222,9 +226,10 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setBlazeResult( blazemark::blaze::cg( N, steps, iterations ) );
+         report.add( "Blaze", *run );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getBlazeResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
       }
    }
 
@@ -235,9 +240,10 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setBoostResult( blazemark::boost::cg( N, steps, iterations ) );
+         report.add( "Boost uBLAS", *run );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getBoostResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
       }
    }
 
@@ -249,9 +255,10 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setGMMResult( blazemark::gmm::cg( N, steps, iterations ) );
+         report.add( "GMM++", *run );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getGMMResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -264,9 +271,10 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setMTLResult( blazemark::mtl::cg( N, steps, iterations ) );
+         report.add( "MTL", *run );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getMTLResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -279,9 +287,10 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t steps     ( run->getSteps() );
          const size_t iterations( run->getIterations() );
          run->setEigenResult( blazemark::eigen::cg( N, steps, iterations ) );
+         report.add( "Eigen", *run );
          const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getEigenResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -289,6 +298,8 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -0,0 +1,606 @@
+//=================================================================================================
+/*!
+//  \file src/main/Compare.cpp
+//  \brief Source file for the comparison of two benchmark reports
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blazemark/util/Statistics.h>
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Key of a single result of a benchmark report.
+//
+// Two results are compared if they agree in the benchmark, the library and all parameters of
+// the benchmark run.
+*/
+struct Key
+{
+   std::string benchmark;  //!< The name of the benchmark.
+   std::string library;    //!< The name of the benchmarked library.
+   size_t size;            //!< The size of the vectors/matrices.
+   size_t nonzeros;        //!< The number of non-zero elements.
+   std::string structure;  //!< The structure or file of the sparse matrix operands.
+   size_t number;          //!< The number of vectors/matrices.
+   size_t iterations;      //!< The number of solver iterations.
+   size_t threads;         //!< The number of threads of the SMP backend.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two result keys.
+//
+// \param lhs The left-hand side key.
+// \param rhs The right-hand side key.
+// \return \a true if the left key is less than the right key, \a false if not.
+*/
+inline bool operator<( const Key& lhs, const Key& rhs )
+{
+   if( lhs.benchmark  != rhs.benchmark  ) return lhs.benchmark  < rhs.benchmark;
+   if( lhs.library    != rhs.library    ) return lhs.library    < rhs.library;
+   if( lhs.size       != rhs.size       ) return lhs.size       < rhs.size;
+   if( lhs.nonzeros   != rhs.nonzeros   ) return lhs.nonzeros   < rhs.nonzeros;
+   if( lhs.structure  != rhs.structure  ) return lhs.structure  < rhs.structure;
+   if( lhs.number     != rhs.number     ) return lhs.number     < rhs.number;
+   if( lhs.iterations != rhs.iterations ) return lhs.iterations < rhs.iterations;
+   return lhs.threads < rhs.threads;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runtimes of all repetitions of a single result, normalized to a single step.
+*/
+typedef std::vector<double>  Samples;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief All results of a benchmark report.
+*/
+typedef std::map<Key,Samples>  Results;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CSV PARSER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Splits the given line at the given separator.
+//
+// \param line The line to be split.
+// \param separator The separating character.
+// \return The fields of the line.
+*/
+std::vector<std::string> split( const std::string& line, char separator )
+{
+   std::vector<std::string> fields;
+   std::istringstream iss( line );
+   std::string field;
+
+   while( std::getline( iss, field, separator ) )
+      fields.push_back( field );
+   if( !line.empty() && line[line.size()-1UL] == separator )
+      fields.push_back( std::string() );
+
+   return fields;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given field of a benchmark report into a number.
+//
+// \param field The field to be converted.
+// \return The converted number.
+// \exception std::runtime_error Invalid number.
+*/
+double toNumber( const std::string& field )
+{
+   std::istringstream iss( field );
+   double value( 0.0 );
+
+   if( !( iss >> value ) || !( iss >> std::ws ).eof() )
+      throw std::runtime_error( "Invalid number '" + field + "'" );
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a benchmark report in CSV format.
+//
+// \param in The input stream.
+// \param results The results of the report.
+// \return void
+// \exception std::runtime_error Invalid CSV report.
+*/
+void readCSV( std::istream& in, Results& results )
+{
+   std::string line;
+
+   if( !std::getline( in, line ) )
+      throw std::runtime_error( "Missing CSV header" );
+
+   const std::vector<std::string> header( split( line, ',' ) );
+   std::map<std::string,size_t> columns;
+
+   for( size_t i=0UL; i<header.size(); ++i )
+      columns[header[i]] = i;
+
+   const char* const required[] = { "benchmark", "library", "size", "nonzeros", "number",
+                                    "iterations", "threads", "steps", "samples" };
+
+   for( size_t i=0UL; i<sizeof(required)/sizeof(required[0]); ++i ) {
+      if( columns.find( required[i] ) == columns.end() )
+         throw std::runtime_error( std::string( "Missing CSV column '" ) + required[i] + "'" );
+   }
+
+   while( std::getline( in, line ) )
+   {
+      if( line.empty() ) continue;
+
+      const std::vector<std::string> fields( split( line, ',' ) );
+
+      if( fields.size() != header.size() )
+         throw std::runtime_error( "Invalid CSV line '" + line + "'" );
+
+      Key key;
+      key.benchmark  = fields[columns["benchmark"]];
+      key.library    = fields[columns["library"]];
+      key.size       = static_cast<size_t>( toNumber( fields[columns["size"]] ) );
+      key.nonzeros   = static_cast<size_t>( toNumber( fields[columns["nonzeros"]] ) );
+      key.structure  = ( columns.count( "structure" ) )?( fields[columns["structure"]] ):( "" );
+      key.number     = static_cast<size_t>( toNumber( fields[columns["number"]] ) );
+      key.iterations = static_cast<size_t>( toNumber( fields[columns["iterations"]] ) );
+      key.threads    = static_cast<size_t>( toNumber( fields[columns["threads"]] ) );
+
+      const double steps( toNumber( fields[columns["steps"]] ) );
+      const std::vector<std::string> samples( split( fields[columns["samples"]], ' ' ) );
+
+      Samples& times( results[key] );
+      for( size_t i=0UL; i<samples.size(); ++i ) {
+         if( !samples[i].empty() )
+            times.push_back( toNumber( samples[i] ) / steps );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  JSON PARSER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Minimal parser for benchmark reports in JSON format.
+//
+// The JSONParser class parses the subset of JSON written by the blazemark::Report class, i.e.
+// objects, arrays, strings without escape sequences and numbers. Unknown members are skipped.
+*/
+class JSONParser
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the JSONParser class.
+   //
+   // \param in The input stream.
+   */
+   explicit JSONParser( std::istream& in )
+      : in_( in )  // The input stream
+   {}
+   //**********************************************************************************************
+
+   //**Parse function******************************************************************************
+   /*!\brief Parses a complete benchmark report.
+   //
+   // \param results The results of the report.
+   // \return void
+   // \exception std::runtime_error Invalid JSON report.
+   */
+   void parse( Results& results )
+   {
+      std::string benchmark;
+
+      expect( '{' );
+      do {
+         const std::string name( parseString() );
+         expect( ':' );
+         if( name == "benchmark" ) {
+            benchmark = parseString();
+         }
+         else if( name == "results" ) {
+            expect( '[' );
+            if( !accept( ']' ) ) {
+               do { parseResult( benchmark, results ); } while( accept( ',' ) );
+               expect( ']' );
+            }
+         }
+         else skipValue();
+      } while( accept( ',' ) );
+      expect( '}' );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Parse functions*****************************************************************************
+   /*!\brief Parses a single result object.
+   //
+   // \param benchmark The name of the benchmark (which has to precede the results).
+   // \param results The results of the report.
+   // \return void
+   */
+   void parseResult( const std::string& benchmark, Results& results )
+   {
+      Key key;
+      key.benchmark  = benchmark;
+      key.size       = 0UL;
+      key.nonzeros   = 0UL;
+      key.number     = 0UL;
+      key.iterations = 0UL;
+      key.threads    = 0UL;
+
+      double steps( 1.0 );
+      Samples samples;
+
+      expect( '{' );
+      do {
+         const std::string name( parseString() );
+         expect( ':' );
+         if     ( name == "library"    ) key.library    = parseString();
+         else if( name == "size"       ) key.size       = static_cast<size_t>( parseNumber() );
+         else if( name == "nonzeros"   ) key.nonzeros   = static_cast<size_t>( parseNumber() );
+         else if( name == "structure"  ) key.structure  = parseString();
+         else if( name == "number"     ) key.number     = static_cast<size_t>( parseNumber() );
+         else if( name == "iterations" ) key.iterations = static_cast<size_t>( parseNumber() );
+         else if( name == "threads"    ) key.threads    = static_cast<size_t>( parseNumber() );
+         else if( name == "steps"      ) steps          = parseNumber();
+         else if( name == "samples" ) {
+            expect( '[' );
+            if( !accept( ']' ) ) {
+               do { samples.push_back( parseNumber() ); } while( accept( ',' ) );
+               expect( ']' );
+            }
+         }
+         else skipValue();
+      } while( accept( ',' ) );
+      expect( '}' );
+
+      Samples& times( results[key] );
+      for( size_t i=0UL; i<samples.size(); ++i )
+         times.push_back( samples[i] / steps );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Parses a string.
+   //
+   // \return The parsed string.
+   // \exception std::runtime_error Invalid JSON string.
+   */
+   std::string parseString()
+   {
+      expect( '"' );
+      std::string str;
+      if( !std::getline( in_, str, '"' ) )
+         throw std::runtime_error( "Unterminated JSON string" );
+      return str;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Parses a number.
+   //
+   // \return The parsed number.
+   // \exception std::runtime_error Invalid JSON number.
+   */
+   double parseNumber()
+   {
+      double value( 0.0 );
+      if( !( in_ >> std::ws >> value ) )
+         throw std::runtime_error( "Invalid JSON number" );
+      return value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Skips a single value of arbitrary type.
+   //
+   // \return void
+   */
+   void skipValue()
+   {
+      in_ >> std::ws;
+      const int c( in_.peek() );
+
+      if( c == '"' ) {
+         parseString();
+      }
+      else if( c == '[' || c == '{' ) {
+         const char close( c == '[' ? ']' : '}' );
+         in_.get();
+         if( accept( close ) ) return;
+         do {
+            if( close == '}' ) { parseString(); expect( ':' ); }
+            skipValue();
+         } while( accept( ',' ) );
+         expect( close );
+      }
+      else parseNumber();
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Consumes the given character if it is the next non-whitespace character.
+   //
+   // \param c The expected character.
+   // \return \a true if the character was consumed, \a false if not.
+   */
+   bool accept( char c )
+   {
+      in_ >> std::ws;
+      if( in_.peek() != c ) return false;
+      in_.get();
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Consumes the given character.
+   //
+   // \param c The expected character.
+   // \return void
+   // \exception std::runtime_error Unexpected character.
+   */
+   void expect( char c )
+   {
+      if( !accept( c ) )
+         throw std::runtime_error( std::string( "Invalid JSON report: expected '" ) + c + "'" );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::istream& in_;  //!< The input stream.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a benchmark report in CSV or JSON format.
+//
+// \param file The name of the report file.
+// \return The results of the report.
+// \exception std::runtime_error Invalid report.
+//
+// The format of the report is determined by its first non-whitespace character.
+*/
+Results readReport( const std::string& file )
+{
+   std::ifstream in( file.c_str() );
+
+   if( !in.is_open() )
+      throw std::runtime_error( "Could not open report file '" + file + "'" );
+
+   Results results;
+
+   if( ( in >> std::ws ).peek() == '{' ) {
+      JSONParser parser( in );
+      parser.parse( results );
+   }
+   else {
+      readCSV( in, results );
+   }
+
+   return results;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPARISON FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a one-sided Welch's t-test for a slowdown of the candidate.
+//
+// \param baseline The per-step runtimes of the baseline.
+// \param candidate The per-step runtimes of the candidate.
+// \return \a true if the candidate is significantly slower, \a false if not.
+//
+// This function tests on the 5% significance level whether the mean runtime of the candidate
+// is larger than the mean runtime of the baseline. Since Welch's t-test does not assume equal
+// variances, it remains valid for measurements on differently loaded machines.
+*/
+bool isSignificantlySlower( const Samples& baseline, const Samples& candidate )
+{
+   using namespace blazemark;
+
+   const double n1( baseline.size()  );
+   const double n2( candidate.size() );
+
+   if( n1 < 2.0 || n2 < 2.0 )
+      return false;
+
+   const double s1( variance( baseline  ) / n1 );
+   const double s2( variance( candidate ) / n2 );
+   const double diff( mean( candidate ) - mean( baseline ) );
+
+   if( s1 + s2 == 0.0 )
+      return diff > 0.0;
+
+   const double t ( diff / std::sqrt( s1 + s2 ) );
+   const double df( ( s1 + s2 ) * ( s1 + s2 ) / ( s1*s1/( n1-1.0 ) + s2*s2/( n2-1.0 ) ) );
+
+   return t > studentQuantile( df, false );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the comparison of two benchmark reports.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The compare tool reads two benchmark reports (as written by the \c -json or \c -csv options
+// of the benchmarks) and compares all results that agree in the benchmark, the library and the
+// parameters of the benchmark run. A result is reported as regression if the median per-step
+// runtime of the candidate exceeds the median of the baseline by more than the given threshold
+// (default: 5%) and the slowdown is statistically significant according to Welch's t-test. In
+// case of at least one regression the tool returns with a non-zero exit code.
+*/
+int main( int argc, char** argv )
+{
+   using namespace blazemark;
+
+   double threshold( 5.0 );
+   std::vector<std::string> files;
+
+   for( int i=1; i<argc; ++i ) {
+      if( std::strcmp( argv[i], "-threshold" ) == 0 && i+1 < argc ) {
+         threshold = std::atof( argv[++i] );
+      }
+      else files.push_back( argv[i] );
+   }
+
+   if( files.size() != 2UL || threshold < 0.0 ) {
+      std::cerr << " Invalid use of program 'Compare'!\n"
+                << "   Use: ./compare [-threshold <percent>] <baseline> <candidate>\n"
+                << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   Results baseline, candidate;
+
+   try {
+      baseline  = readReport( files[0] );
+      candidate = readReport( files[1] );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   size_t regressions( 0UL );
+   size_t matches( 0UL );
+
+   std::cout << std::left << "\n"
+             << "   " << std::setw(16) << "Benchmark" << std::setw(14) << "Library"
+             << std::setw(24) << "Size/NNZ/Number" << std::setw(9) << "Threads"
+             << std::setw(15) << "Baseline [s]" << std::setw(15) << "Candidate [s]"
+             << std::setw(10) << "Change" << "Verdict\n";
+
+   for( Results::const_iterator it=candidate.begin(); it!=candidate.end(); ++it )
+   {
+      const Results::const_iterator base( baseline.find( it->first ) );
+      if( base == baseline.end() || base->second.empty() || it->second.empty() )
+         continue;
+
+      ++matches;
+
+      const Key& key( it->first );
+      const double before( percentile( base->second, 50.0 ) );
+      const double after ( percentile( it->second, 50.0 ) );
+      const double change( 100.0 * ( after - before ) / before );
+
+      const bool slower( change > threshold && isSignificantlySlower( base->second, it->second ) );
+      const bool faster( -change > threshold && isSignificantlySlower( it->second, base->second ) );
+
+      if( slower ) ++regressions;
+
+      std::ostringstream params;
+      params << key.size << "/" << key.nonzeros << "/"
+             << ( key.iterations ? key.iterations : key.number );
+      if( !key.structure.empty() )
+         params << "/" << key.structure;
+
+      std::ostringstream percent;
+      percent << std::showpos << std::fixed << std::setprecision(1) << change << "%";
+
+      std::cout << "   " << std::setw(16) << key.benchmark << std::setw(14) << key.library
+                << std::setw(23) << params.str() << " " << std::setw(9) << key.threads
+                << std::setw(15) << before << std::setw(15) << after
+                << std::setw(10) << percent.str()
+                << ( slower ? "SLOWER" : faster ? "faster" : "-" ) << "\n";
+   }
+
+   std::cout << "\n   " << matches << " matching results, " << regressions
+             << " significant regressions (threshold " << threshold << "%)\n" << std::endl;
+
+   return ( regressions > 0UL )?( EXIT_FAILURE ):( EXIT_SUCCESS );
+}
+//*************************************************************************************************
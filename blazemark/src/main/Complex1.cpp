@@ -70,8 +70,13 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicDenseRun.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -175,6 +180,26 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+
+   const size_t N( run.getSize() );
+
+   run.setBytes( denseBytes( N*N + 3UL*N ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -183,6 +208,19 @@ void estimateFlops( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   return blazemark::blaze::complex1( run.getSize(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Complex expression c = A * ( a + b ) benchmark function.
 //
@@ -194,12 +232,15 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "complex1" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -217,8 +258,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setClassicResult( blazemark::classic::complex1( N, steps ) );
+         report.add( "Classic", *run );
          const double mflops( run->getFlops() * steps / run->getClassicResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -228,19 +271,28 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBlazeResult( blazemark::blaze::complex1( N, steps ) );
+         report.add( "Blaze", *run );
          const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::cout << "   Boost uBLAS [MFlop/s]:\n";
       for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBoostResult( blazemark::boost::complex1( N, steps ) );
+         report.add( "Boost uBLAS", *run );
          const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -251,8 +303,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBlitzResult( blazemark::blitz::complex1( N, steps ) );
+         report.add( "Blitz++", *run );
          const double mflops( run->getFlops() * steps / run->getBlitzResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -264,8 +318,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setGMMResult( blazemark::gmm::complex1( N, steps ) );
+         report.add( "GMM++", *run );
          const double mflops( run->getFlops() * steps / run->getGMMResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -277,8 +333,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setArmadilloResult( blazemark::armadillo::complex1( N, steps ) );
+         report.add( "Armadillo", *run );
          const double mflops( run->getFlops() * steps / run->getArmadilloResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -290,8 +348,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setFLENSResult( blazemark::flens::complex1( N, steps ) );
+         report.add( "FLENS", *run );
          const double mflops( run->getFlops() * steps / run->getFLENSResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -303,8 +363,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setMTLResult( blazemark::mtl::complex1( N, steps ) );
+         report.add( "MTL", *run );
          const double mflops( run->getFlops() * steps / run->getMTLResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -316,8 +378,10 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setEigenResult( blazemark::eigen::complex1( N, steps ) );
+         report.add( "Eigen", *run );
          const double mflops( run->getFlops() * steps / run->getEigenResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << run->getSize() << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << run->getSize() << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -325,6 +389,8 @@ void complex1( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
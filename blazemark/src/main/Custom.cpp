@@ -62,8 +62,10 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
 
 
 //*************************************************************************************************
@@ -152,6 +154,8 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "custom" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
@@ -173,7 +177,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setBlazeResult( blazemark::blaze::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getBlazeResult() << std::endl;
+         report.add( "Blaze", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getBlazeResult()
+                   << blazemark::counters << std::endl;
       }
    }
 
@@ -184,7 +190,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setBoostResult( blazemark::boost::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getBoostResult() << std::endl;
+         report.add( "Boost uBLAS", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getBoostResult()
+                   << blazemark::counters << std::endl;
       }
    }
 
@@ -196,7 +204,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setBlitzResult( blazemark::blitz::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getBlitzResult() << std::endl;
+         report.add( "Blitz++", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getBlitzResult()
+                   << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -209,7 +219,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setGMMResult( blazemark::gmm::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getGMMResult() << std::endl;
+         report.add( "GMM++", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getGMMResult()
+                   << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -222,7 +234,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setArmadilloResult( blazemark::armadillo::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getArmadilloResult() << std::endl;
+         report.add( "Armadillo", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getArmadilloResult()
+                   << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -235,7 +249,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setMTLResult( blazemark::mtl::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getMTLResult() << std::endl;
+         report.add( "MTL", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getMTLResult()
+                   << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -248,7 +264,9 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t F    ( run->getNonZeros() );
          const size_t steps( run->getSteps()    );
          run->setEigenResult( blazemark::eigen::custom( N, F, steps ) );
-         std::cout << "     " << std::setw(12) << run->getSize() << run->getEigenResult() << std::endl;
+         report.add( "Eigen", *run );
+         std::cout << "     " << std::setw(12) << run->getSize() << run->getEigenResult()
+                   << blazemark::counters << std::endl;
       }
    }
 #endif
@@ -256,6 +274,8 @@ void custom( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -58,9 +58,14 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -113,6 +118,7 @@ void estimateSteps( Run& run )
    using blaze::rowMajor;
 
    ::blaze::setSeed( ::blazemark::seed );
+   blazemark::selectOperand( run );
 
    const size_t N( run.getSize() );
    const size_t F( run.getNonZeros() );
@@ -164,6 +170,28 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+   using blazemark::sparseMatrixBytes;
+
+   const size_t N( run.getSize()     );
+   const size_t F( run.getNonZeros() );
+
+   run.setBytes( denseBytes( 2UL*N*N ) + sparseMatrixBytes( N, N*F ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -172,6 +200,20 @@ void estimateFlops( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   blazemark::selectOperand( run );
+   return blazemark::blaze::dmatsmatadd( run.getSize(), run.getNonZeros(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Dense matrix/sparse matrix addition benchmark function.
 //
@@ -183,12 +225,15 @@ void dmatsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dmatsmatadd" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -210,13 +255,21 @@ void dmatsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBlazeResult( blazemark::blaze::dmatsmatadd( N, F, steps ) );
+            report.add( "Blaze", *run );
             const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::vector<Run>::iterator run=runs.begin();
       while( run != runs.end() ) {
@@ -227,9 +280,12 @@ void dmatsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBoostResult( blazemark::boost::dmatsmatadd( N, F, steps ) );
+            report.add( "Boost uBLAS", *run );
             const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -245,9 +301,12 @@ void dmatsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setMTLResult( blazemark::mtl::dmatsmatadd( N, F, steps ) );
+            report.add( "MTL", *run );
             const double mflops( run->getFlops() * steps / run->getMTLResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -256,6 +315,8 @@ void dmatsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -60,9 +60,14 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -115,6 +120,7 @@ void estimateSteps( Run& run )
    using blaze::rowMajor;
 
    ::blaze::setSeed( ::blazemark::seed );
+   blazemark::selectOperand( run );
 
    const size_t N( run.getSize() );
    const size_t F( run.getNonZeros() );
@@ -166,6 +172,28 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+   using blazemark::sparseMatrixBytes;
+
+   const size_t N( run.getSize()     );
+   const size_t F( run.getNonZeros() );
+
+   run.setBytes( denseBytes( 2UL*N*N ) + sparseMatrixBytes( N, N*F ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -174,6 +202,20 @@ void estimateFlops( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   blazemark::selectOperand( run );
+   return blazemark::blaze::dmatsmatmult( run.getSize(), run.getNonZeros(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Dense matrix/sparse matrix multiplication benchmark function.
 //
@@ -185,12 +227,15 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dmatsmatmult" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -212,13 +257,21 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBlazeResult( blazemark::blaze::dmatsmatmult( N, F, steps ) );
+            report.add( "Blaze", *run );
             const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::vector<Run>::iterator run=runs.begin();
       while( run != runs.end() ) {
@@ -229,9 +282,12 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBoostResult( blazemark::boost::dmatsmatmult( N, F, steps ) );
+            report.add( "Boost uBLAS", *run );
             const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -247,9 +303,12 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setMTLResult( blazemark::mtl::dmatsmatmult( N, F, steps ) );
+            report.add( "MTL", *run );
             const double mflops( run->getFlops() * steps / run->getMTLResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -266,9 +325,12 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setEigenResult( blazemark::eigen::dmatsmatmult( N, F, steps ) );
+            report.add( "Eigen", *run );
             const double mflops( run->getFlops() * steps / run->getEigenResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -277,6 +339,8 @@ void dmatsmatmult( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -57,9 +57,14 @@
 #include <blazemark/system/Config.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -165,6 +170,28 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+   using blazemark::sparseVectorBytes;
+
+   const size_t N( run.getSize()     );
+   const size_t F( run.getNonZeros() );
+
+   run.setBytes( denseBytes( N*F + N ) + sparseVectorBytes( F ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -173,6 +200,19 @@ void estimateFlops( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   return blazemark::blaze::dmatsvecmult( run.getSize(), run.getNonZeros(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Dense matrix/sparse vector multiplication benchmark function.
 //
@@ -184,12 +224,15 @@ void dmatsvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dmatsvecmult" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -212,12 +255,19 @@ void dmatsvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
             run->setBlazeResult( blazemark::blaze::dmatsvecmult( N, F, steps ) );
+            report.add( "Blaze", *run );
             const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::vector<Run>::iterator run=runs.begin();
       while( run != runs.end() ) {
@@ -229,8 +279,10 @@ void dmatsvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
             run->setBoostResult( blazemark::boost::dmatsvecmult( N, F, steps ) );
+            report.add( "Boost uBLAS", *run );
             const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -238,6 +290,8 @@ void dmatsvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
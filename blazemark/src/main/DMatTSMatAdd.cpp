@@ -58,9 +58,14 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicSparseRun.h>
 #include <blazemark/util/Indices.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -114,6 +119,7 @@ void estimateSteps( Run& run )
    using blaze::columnMajor;
 
    ::blaze::setSeed( ::blazemark::seed );
+   blazemark::selectOperand( run );
 
    const size_t N( run.getSize() );
    const size_t F( run.getNonZeros() );
@@ -165,6 +171,28 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+   using blazemark::sparseMatrixBytes;
+
+   const size_t N( run.getSize()     );
+   const size_t F( run.getNonZeros() );
+
+   run.setBytes( denseBytes( 2UL*N*N ) + sparseMatrixBytes( N, N*F ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -173,6 +201,20 @@ void estimateFlops( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   blazemark::selectOperand( run );
+   return blazemark::blaze::dmattsmatadd( run.getSize(), run.getNonZeros(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Dense matrix/transpose sparse matrix addition benchmark function.
 //
@@ -184,12 +226,15 @@ void dmattsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dmattsmatadd" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -211,13 +256,21 @@ void dmattsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBlazeResult( blazemark::blaze::dmattsmatadd( N, F, steps ) );
+            report.add( "Blaze", *run );
             const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::vector<Run>::iterator run=runs.begin();
       while( run != runs.end() ) {
@@ -228,9 +281,12 @@ void dmattsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setBoostResult( blazemark::boost::dmattsmatadd( N, F, steps ) );
+            report.add( "Boost uBLAS", *run );
             const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -246,9 +302,12 @@ void dmattsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
             const size_t N    ( run->getSize()     );
             const size_t F    ( run->getNonZeros() );
             const size_t steps( run->getSteps()    );
+            blazemark::selectOperand( *run );
             run->setMTLResult( blazemark::mtl::dmattsmatadd( N, F, steps ) );
+            report.add( "MTL", *run );
             const double mflops( run->getFlops() * steps / run->getMTLResult() / 1E6 );
-            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+            std::cout << "     " << std::setw(12) << N << mflops
+                      << blazemark::counters << blazemark::roofline( *run ) << std::endl;
          }
       }
    }
@@ -257,6 +316,8 @@ void dmattsmatadd( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -62,8 +62,13 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
 #include <blazemark/util/DynamicDenseRun.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
+#include <blazemark/util/Scaling.h>
 
 
 //*************************************************************************************************
@@ -145,6 +150,26 @@ void estimateSteps( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+
+   const size_t N( run.getSize() );
+
+   run.setBytes( denseBytes( 2UL*N*N ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -153,6 +178,19 @@ void estimateSteps( Run& run )
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Blaze kernel of the thread scaling mode.
+//
+// \param run The parameters for the benchmark run.
+// \return Minimum runtime of the kernel function.
+*/
+double blazeKernel( const Run& run )
+{
+   return blazemark::blaze::dmattrans( run.getSize(), run.getSteps() );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Dense matrix transpose benchmark function.
 //
@@ -164,11 +202,15 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dmattrans" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
+      estimateBytes( *run );
+
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
             estimateSteps( *run );
@@ -185,19 +227,28 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBlazeResult( blazemark::blaze::dmattrans( N, steps ) );
+         report.add( "Blaze", *run );
          const double runtime( run->getBlazeResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
+   if( benchmarks.runBlaze && !benchmarks.threads.empty() ) {
+      std::cout << "   Blaze thread scaling:\n";
+      blazemark::scaling( runs, benchmarks.threads, blazeKernel, report );
+   }
+
    if( benchmarks.runBoost ) {
       std::cout << "   Boost uBLAS (Seconds):\n";
       for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setBoostResult( blazemark::boost::dmattrans( N, steps ) );
+         report.add( "Boost uBLAS", *run );
          const double runtime( run->getBoostResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -208,8 +259,10 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setGMMResult( blazemark::gmm::dmattrans( N, steps ) );
+         report.add( "GMM++", *run );
          const double runtime( run->getGMMResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -221,8 +274,10 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setFLENSResult( blazemark::flens::dmattrans( N, steps ) );
+         report.add( "FLENS", *run );
          const double runtime( run->getFLENSResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -234,8 +289,10 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setMTLResult( blazemark::mtl::dmattrans( N, steps ) );
+         report.add( "MTL", *run );
          const double runtime( run->getMTLResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -247,8 +304,10 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
          run->setEigenResult( blazemark::eigen::dmattrans( N, steps ) );
+         report.add( "Eigen", *run );
          const double runtime( run->getEigenResult() / steps );
-         std::cout << "     " << std::setw(12) << N << runtime << std::endl;
+         std::cout << "     " << std::setw(12) << N << runtime
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -256,6 +315,8 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -58,7 +58,11 @@
 #include <blazemark/system/Eigen.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
 #include <blazemark/util/StaticDenseRun.h>
 
 
@@ -163,6 +167,24 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+
+   run.setBytes( denseBytes( 3UL*3UL ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -182,12 +204,15 @@ void dvecdveccross( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "dvecdveccross" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -205,8 +230,10 @@ void dvecdveccross( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setBlazeResult( blazemark::blaze::dvecdveccross( N, steps ) );
+         report.add( "Blaze", *run );
          const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -217,8 +244,10 @@ void dvecdveccross( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setArmadilloResult( blazemark::armadillo::dvecdveccross( N, steps ) );
+         report.add( "Armadillo", *run );
          const double mflops( run->getFlops() * steps / run->getArmadilloResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -230,8 +259,10 @@ void dvecdveccross( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setEigenResult( blazemark::eigen::dvecdveccross( N, steps ) );
+         report.add( "Eigen", *run );
          const double mflops( run->getFlops() * steps / run->getEigenResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -239,6 +270,8 @@ void dvecdveccross( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
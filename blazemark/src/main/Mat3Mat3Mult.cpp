@@ -63,7 +63,11 @@
 #include <blazemark/system/MTL.h>
 #include <blazemark/system/Types.h>
 #include <blazemark/util/Benchmarks.h>
+#include <blazemark/util/Counters.h>
+#include <blazemark/util/MemoryTraffic.h>
 #include <blazemark/util/Parser.h>
+#include <blazemark/util/Report.h>
+#include <blazemark/util/Roofline.h>
 #include <blazemark/util/StaticDenseRun.h>
 
 
@@ -168,6 +172,24 @@ void estimateFlops( Run& run )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Estimating the memory traffic.
+//
+// \param run The parameters for the benchmark run.
+// \return void
+//
+// This function estimates the number of bytes that have to be transferred from and to main
+// memory for a single computation of the (composite) arithmetic operation.
+*/
+void estimateBytes( Run& run )
+{
+   using blazemark::denseBytes;
+
+   run.setBytes( denseBytes( 3UL*9UL ) );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -187,12 +209,15 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
 {
    std::cout << std::left;
 
+   blazemark::Report report( "mat3mat3mult" );
+
    std::sort( runs.begin(), runs.end() );
 
    size_t slowSize( blaze::inf );
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run )
    {
       estimateFlops( *run );
+      estimateBytes( *run );
 
       if( run->getSteps() == 0UL ) {
          if( run->getSize() < slowSize ) {
@@ -210,8 +235,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setBlazeResult( blazemark::blaze::mat3mat3mult( N, steps ) );
+         report.add( "Blaze", *run );
          const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -221,8 +248,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setBoostResult( blazemark::boost::mat3mat3mult( N, steps ) );
+         report.add( "Boost uBLAS", *run );
          const double mflops( run->getFlops() * steps / run->getBoostResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 
@@ -233,8 +262,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setBlitzResult( blazemark::blitz::mat3mat3mult( N, steps ) );
+         report.add( "Blitz++", *run );
          const double mflops( run->getFlops() * steps / run->getBlitzResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -246,8 +277,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setFLENSResult( blazemark::flens::mat3mat3mult( N, steps ) );
+         report.add( "FLENS", *run );
          const double mflops( run->getFlops() * steps / run->getFLENSResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -259,8 +292,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setMTLResult( blazemark::mtl::mat3mat3mult( N, steps ) );
+         report.add( "MTL", *run );
          const double mflops( run->getFlops() * steps / run->getMTLResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -272,8 +307,10 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const size_t N    ( run->getNumber() );
          const size_t steps( run->getSteps()  );
          run->setEigenResult( blazemark::eigen::mat3mat3mult( N, steps ) );
+         report.add( "Eigen", *run );
          const double mflops( run->getFlops() * steps / run->getEigenResult() / 1E6 );
-         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         std::cout << "     " << std::setw(12) << N << mflops
+                   << blazemark::counters << blazemark::roofline( *run ) << std::endl;
       }
    }
 #endif
@@ -281,6 +318,8 @@ void mat3mat3mult( std::vector<Run>& runs, Benchmarks benchmarks )
    for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
       std::cout << *run;
    }
+
+   report.write( benchmarks );
 }
 //*************************************************************************************************
 
@@ -39,7 +39,9 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <blazemark/util/Roofline.h>
 
 
 //=================================================================================================
@@ -54,15 +56,29 @@
 // \param argc Number of command line arguments.
 // \param argv Array of command line arguments.
 // \return Success code for the execution.
+//
+// The memory sweep frees the given number of megabytes of main memory by initializing a large
+// array. In case the \a -roofline option is given instead, the memory sweep measures and prints
+// the roofline ceilings of the machine, i.e. the peak floating point performance and the
+// attainable memory bandwidth for working sets from the L1 cache up to main memory (see the
+// blazemark::measureRoofline() function).
 */
 int main( int argc, char** argv )
 {
    if( argc != 2 ) {
       std::cerr << " Invalid use of program 'MemorySweep'!\n"
-                << "   Use: ./memorysweep <number_of_megabytes>\n" << std::endl;
+                << "   Use: ./memorysweep <number_of_megabytes>\n"
+                << "        ./memorysweep -roofline\n" << std::endl;
       return EXIT_FAILURE;
    }
 
+   if( std::strcmp( argv[1], "-roofline" ) == 0 ) {
+      std::cout << "\n Measuring the roofline ceilings..." << std::endl;
+      blazemark::measureRoofline();
+      std::cout << blazemark::machineRoofline() << std::endl;
+      return EXIT_SUCCESS;
+   }
+
    const std::size_t M( static_cast<std::size_t>( atoi( argv[1] ) ) );
    const std::size_t N( M * 1000000UL / sizeof(double) );
 
@@ -39,10 +39,10 @@
 
 #include <iostream>
 #include <boost/numeric/mtl/mtl.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/blaze/CG.h>
 #include <blazemark/mtl/init/DenseVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -83,7 +83,7 @@ double cg( size_t N, size_t steps, size_t iterations )
    compressed2D A( NN, NN );
    dense_vector x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    {
       inserter ins( A );
@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <boost/numeric/mtl/mtl.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/mtl/Complex3.h>
 #include <blazemark/mtl/init/Dense2D.h>
 #include <blazemark/mtl/init/DenseVector.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -79,7 +79,7 @@ double complex3( size_t N, size_t steps )
 
    dense2D A( N, N ), B( N, N );
    dense_vector a( N ), b( N ), c( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B );
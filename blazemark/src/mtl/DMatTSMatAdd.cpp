@@ -39,11 +39,11 @@
 
 #include <iostream>
 #include <boost/numeric/mtl/mtl.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/mtl/DMatTSMatAdd.h>
 #include <blazemark/mtl/init/Compressed2D.h>
 #include <blazemark/mtl/init/Dense2D.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -83,7 +83,7 @@ double dmattsmatadd( size_t N, size_t F, size_t steps )
 
    dense2D A( N, N ), C( N, N );
    compressed2D B( N, N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    init( A );
    init( B, F );
@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <boost/numeric/mtl/mtl.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/mtl/init/Dense2D.h>
 #include <blazemark/mtl/Mat3Mat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -77,7 +77,7 @@ double mat3mat3mult( size_t N, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector<dense2D> A( N ), B( N ), C( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].change_dim( 3UL, 3UL );
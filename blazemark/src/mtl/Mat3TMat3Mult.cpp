@@ -40,10 +40,10 @@
 #include <iostream>
 #include <vector>
 #include <boost/numeric/mtl/mtl.hpp>
-#include <blaze/util/Timing.h>
 #include <blazemark/mtl/init/Dense2D.h>
 #include <blazemark/mtl/Mat3TMat3Mult.h>
 #include <blazemark/system/Config.h>
+#include <blazemark/util/Timer.h>
 
 
 namespace blazemark {
@@ -81,7 +81,7 @@ double mat3tmat3mult( size_t N, size_t steps )
 
    ::std::vector<row_dense2D> A( N ), C( N );
    ::std::vector<col_dense2D> B( N );
-   ::blaze::timing::WcTimer timer;
+   ::blazemark::Timer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
       A[i].change_dim( 3UL, 3UL );
@@ -0,0 +1,177 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/custom/OperationTest.h
+//  \brief Header file for the custom vector and matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CUSTOM_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_CUSTOM_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custom {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CustomVector and CustomMatrix class templates.
+//
+// This class represents a test suite for the custom vectors and matrices. All custom vectors
+// and matrices represent arrays that are surrounded by guard elements. All results are compared
+// to the results of the according operations with equivalent dynamic vectors and matrices and
+// it is verified that neither the guard elements nor the padding elements of the arrays are
+// modified by any operation. Since all operands are initialized with small integral values,
+// all results have to match exactly.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T, bool AF, bool PF >          void testVector( size_t n );
+   template< typename T, bool AF, bool PF, bool SO > void testMatrix( size_t m, size_t n );
+                                                     void testSetup();
+   //@}
+   //**********************************************************************************************
+
+   //**Error detection functions*******************************************************************
+   /*!\name Error detection functions */
+   //@{
+   template< typename T >
+   void checkValue( const std::string& op, T result, T expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const std::string& op, const VT1& result, const VT2& expected ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const std::string& op, const MT1& result, const MT2& expected ) const;
+
+   template< typename T >
+   void checkMemory( const std::string& op, const T* array, size_t size, size_t valid,
+                     size_t spacing, size_t guard, bool padded ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT > static void randomize( blaze::DenseVector<VT,false>& v );
+   template< typename MT, bool SO > static void randomize( blaze::DenseMatrix<MT,SO>& A );
+   template< typename T > static T* allocate( size_t size, size_t guard );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the custom vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the custom vector and matrix operation test.
+*/
+#define RUN_CUSTOM_OPERATION_TEST \
+   blazetest::mathtest::custom::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace custom
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,176 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/deltacompressedmatrix/OperationTest.h
+//  \brief Header file for the quantized matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DELTACOMPRESSEDMATRIX_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_DELTACOMPRESSEDMATRIX_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DeltaCompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/ThreadPool.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace deltacompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the DeltaCompressedMatrix class template.
+//
+// This class represents a test suite for the DeltaCompressedMatrix class template and the
+// according sparse matrix/dense vector multiplication. All matrices are initialized with small
+// integral values such that the results of the multiplications can be compared exactly to the
+// results of the according multiplications with a CompressedMatrix.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testEncoding  ();
+   void testDictionary();
+   void testFailures  ();
+
+   template< typename T >
+   void testMatVecMult( size_t m, size_t n, size_t nonzeros, size_t maxDelta, size_t values );
+   //@}
+   //**********************************************************************************************
+
+   //**Error detection functions*******************************************************************
+   /*!\name Error detection functions */
+   //@{
+   template< typename T >
+   void checkValue( const std::string& op, T result, T expected ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const std::string& op, const VT1& result, const VT2& expected ) const;
+
+   template< typename T >
+   void checkMatrix( const blaze::DeltaCompressedMatrix<T>& A,
+                     const blaze::CompressedMatrix<T,blaze::rowMajor>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   static void randomize( blaze::CompressedMatrix<T,blaze::rowMajor>& A, size_t nonzeros,
+                          size_t maxDelta, size_t values );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string       test_;  //!< Label of the currently performed test.
+   blaze::ThreadPool pool_;  //!< The thread pool for the parallel multiplications.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the DeltaCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DeltaCompressedMatrix operation test.
+*/
+#define RUN_DELTACOMPRESSEDMATRIX_OPERATION_TEST \
+   blazetest::mathtest::deltacompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace deltacompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
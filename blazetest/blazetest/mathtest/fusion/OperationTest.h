@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/fusion/OperationTest.h
+//  \brief Header file for the element-wise epilogue operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_FUSION_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_FUSION_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fusion {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of dense expressions with element-wise epilogues.
+//
+// This class represents a test suite for the assignment of dense vector and dense matrix
+// expressions that combine a multiplication with subsequent element-wise operations (as for
+// instance \f$ \vec{y}=\alpha A \vec{x}+\vec{c} \f$ or \f$ C=relu(A B+D) \f$). All results
+// are compared to element-wise computed reference results. Since all elements are initialized
+// with small integral values, the results are exact.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >           void testVectorFusion( size_t n, size_t k );
+   template< bool SO1, bool SO2 > void testMatrixFusion( size_t m, size_t n, size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Error detection functions*******************************************************************
+   /*!\name Error detection functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void checkVector( const std::string& op, const VT1& result, const VT2& expected ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const std::string& op, const MT1& result, const MT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT > static void randomize( blaze::DenseVector<VT,false>& v );
+   template< typename MT, bool SO > static void randomize( blaze::DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the dense expressions with element-wise epilogues.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the element-wise epilogue operation test.
+*/
+#define RUN_FUSION_OPERATION_TEST \
+   blazetest::mathtest::fusion::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace fusion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,357 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mappedserializer/ClassTest.h
+//  \brief Header file for the MappedSerializer class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MAPPEDSERIALIZER_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPEDSERIALIZER_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedDenseMatrix.h>
+#include <blaze/math/MappedSparseMatrix.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedserializer {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedSerializer class.
+//
+// This class represents a test suite for the blaze::MappedSerializer class and the memory-mapped
+// MappedDenseMatrix and MappedSparseMatrix class templates. It performs a series of runtime
+// tests with different matrix types to test the serialization and the memory-mapped loading of
+// both dense and sparse matrices.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testEmptyMatrices ();
+   void testRandomMatrices();
+   void testFailures      ();
+
+   template< typename MT >
+   void runDenseTest( const MT& src );
+
+   template< typename MT >
+   void runSparseTest( const MT& src );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+
+   template< typename MT >
+   void testSerialization( const MT& src );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;      //!< Label of the currently performed test.
+   std::string filename_;  //!< The name of the temporary matrix file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory-mapped loading test of a dense matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given dense matrix into a file, maps the file via a MappedDenseMatrix
+// with the same element type and storage order and compares both the mapped matrix and the
+// result of a matrix/vector multiplication with the source matrix. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runDenseTest( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   testSerialization( src );
+
+   blaze::MappedDenseMatrix<ET,blaze::IsColumnMajorMatrix<MT>::value> dst( filename_ );
+   compareMatrices( src, dst );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( src.columns() );
+   randomize( x );
+
+   const blaze::DynamicVector<ET,blaze::columnVector> y1( src * x );
+   const blaze::DynamicVector<ET,blaze::columnVector> y2( dst * x );
+
+   if( y1 != y2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/vector multiplication failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Result with source matrix:\n" << y1 << "\n"
+          << "   Result with mapped matrix:\n" << y2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory-mapped loading test of a sparse matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given sparse matrix into a file, maps the file via a
+// MappedSparseMatrix with the same element type and storage order and compares both the
+// mapped matrix and the result of a matrix/vector multiplication with the source matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runSparseTest( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   testSerialization( src );
+
+   blaze::MappedSparseMatrix<ET,blaze::IsColumnMajorMatrix<MT>::value> dst( filename_ );
+   compareMatrices( src, dst );
+
+   if( src.nonZeros() != dst.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Number of non-zeros of the source matrix: " << src.nonZeros() << "\n"
+          << "   Number of non-zeros of the mapped matrix: " << dst.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( src.columns() );
+   randomize( x );
+
+   const blaze::DynamicVector<ET,blaze::columnVector> y1( src * x );
+   const blaze::DynamicVector<ET,blaze::columnVector> y2( dst * x );
+
+   if( y1 != y2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/vector multiplication failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Result with source matrix:\n" << y1 << "\n"
+          << "   Result with mapped matrix:\n" << y2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the serialization process.
+//
+// \param src The source matrix to be serialized.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the serialization of the given matrix into the temporary matrix file.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::testSerialization( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   using blaze::IsDenseMatrix;
+
+   try {
+      blaze::serializeMapped( filename_, src );
+   }
+   catch( std::runtime_error& ex ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialization failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT>::value ? ( "Dense" ) : ( "Sparse" ) ) << " matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Matrix:\n" << src << "\n"
+          << "   Error message: " << ex.what() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a source and destination matrix.
+//
+// \param src The source matrix.
+// \param dst The destination matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a comparison between the given source and destination matrix. In
+// case the matrix are not equal, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   using blaze::IsDenseMatrix;
+
+   if( src.rows() != dst.rows() || src.columns() != dst.columns() || src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT1>::value ? ( "Dense" ) : ( "Sparse" ) ) << " source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   " << ( IsDenseMatrix<MT2>::value ? ( "Dense" ) : ( "Sparse" ) ) << " destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedSerializer class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedSerializer class test.
+*/
+#define RUN_MAPPEDSERIALIZER_CLASS_TEST \
+   blazetest::mathtest::mappedserializer::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,359 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixmarket/ClassTest.h
+//  \brief Header file for the MatrixMarket class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXMARKET_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXMARKET_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/util/ThreadPool.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixmarket {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MatrixMarket class.
+//
+// This class represents a test suite for the blaze::MatrixMarket class. It performs a series of
+// runtime tests with written and hand-crafted Matrix Market files, which are read both serially
+// and in parallel by means of a thread pool.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testEmptyMatrices  ();
+   void testRandomMatrices ();
+   void testFormats        ();
+   void testUnsortedEntries();
+   void testFailures       ();
+
+   template< typename MT >
+   void runTest( const MT& src );
+
+   template< typename MT1, typename MT2 >
+   void runReadTest( const std::string& text, const MT2& ref );
+
+   template< typename MT >
+   void runFailureTest( const std::string& text, const std::string& error );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void writeFile( const std::string& text );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string       test_;      //!< Label of the currently performed test.
+   std::string       filename_;  //!< The name of the temporary Matrix Market file.
+   blaze::ThreadPool pool_;      //!< The thread pool for the parallel tests.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Round trip test of a dense or sparse matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given matrix into a Matrix Market file both serially and in
+// parallel and reads the file into dense and sparse matrices of both storage orders. In case
+// a matrix cannot be reconstituted, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runTest( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   for( size_t parallel=0UL; parallel<2UL; ++parallel )
+   {
+      try {
+         if( parallel ) blaze::writeMatrixMarket( pool_, filename_, src );
+         else           blaze::writeMatrixMarket( filename_, src );
+      }
+      catch( std::runtime_error& ex ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Writing failed\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Error message: " << ex.what() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::ifstream file( filename_.c_str() );
+      std::stringstream text;
+      text << file.rdbuf();
+
+      runReadTest< blaze::CompressedMatrix<ET,blaze::rowMajor>    >( text.str(), src );
+      runReadTest< blaze::CompressedMatrix<ET,blaze::columnMajor> >( text.str(), src );
+      runReadTest< blaze::DynamicMatrix<ET,blaze::rowMajor>       >( text.str(), src );
+      runReadTest< blaze::DynamicMatrix<ET,blaze::columnMajor>    >( text.str(), src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading test of the given Matrix Market text.
+//
+// \param text The content of the Matrix Market file.
+// \param ref The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads the given Matrix Market text into a matrix of type \a MT1 both serially
+// and in parallel and compares the result with the given reference matrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2 >  // Type of the reference matrix
+void ClassTest::runReadTest( const std::string& text, const MT2& ref )
+{
+   writeFile( text );
+
+   for( size_t parallel=0UL; parallel<2UL; ++parallel )
+   {
+      MT1 dst;
+
+      try {
+         if( parallel ) blaze::readMatrixMarket( pool_, filename_, dst );
+         else           blaze::readMatrixMarket( filename_, dst );
+      }
+      catch( std::runtime_error& ex ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading failed\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT1 ).name() << "\n"
+             << "   Parallel: " << ( parallel ? "yes" : "no" ) << "\n"
+             << "   Error message: " << ex.what() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      compareMatrices( ref, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a failing reading attempt.
+//
+// \param text The content of the invalid Matrix Market file.
+// \param error The description of the error.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tries to read the given invalid Matrix Market text into a matrix of type \a MT
+// both serially and in parallel. In case the reading succeeds, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename MT >  // Type of the target matrix
+void ClassTest::runFailureTest( const std::string& text, const std::string& error )
+{
+   writeFile( text );
+
+   for( size_t parallel=0UL; parallel<2UL; ++parallel )
+   {
+      MT dst;
+
+      try {
+         if( parallel ) blaze::readMatrixMarket( pool_, filename_, dst );
+         else           blaze::readMatrixMarket( filename_, dst );
+      }
+      catch( std::runtime_error& ) {
+         continue;
+      }
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << " succeeded\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Parallel: " << ( parallel ? "yes" : "no" ) << "\n"
+          << "   Result:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a source and destination matrix.
+//
+// \param src The source matrix.
+// \param dst The destination matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a comparison between the given source and destination matrix. In
+// case the matrix are not equal, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   using blaze::IsDenseMatrix;
+
+   if( src.rows() != dst.rows() || src.columns() != dst.columns() || src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   " << ( IsDenseMatrix<MT1>::value ? ( "Dense" ) : ( "Sparse" ) ) << " source matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   " << ( IsDenseMatrix<MT2>::value ? ( "Dense" ) : ( "Sparse" ) ) << " destination matrix type:\n"
+          << "     " << typeid( MT2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MatrixMarket class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MatrixMarket class test.
+*/
+#define RUN_MATRIXMARKET_CLASS_TEST \
+   blazetest::mathtest::matrixmarket::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixmarket
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
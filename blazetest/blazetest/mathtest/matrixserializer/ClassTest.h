@@ -92,9 +92,11 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyMatrices ();
-   void testRandomMatrices();
-   void testFailures      ();
+   void testEmptyMatrices    ();
+   void testRandomMatrices   ();
+   void testCompressedIndices();
+   void testLegacyFormat     ();
+   void testFailures         ();
 
    template< size_t M, size_t N, typename MT >
    void runAllTests( const MT& src );
@@ -114,6 +116,9 @@ class ClassTest
    template< size_t M, size_t N, typename MT >
    void runSparseSubmatrixTests( const MT& src );
 
+   template< typename MT >
+   void runCompressionTests( const MT& src );
+
    template< typename MT1, typename MT2 >
    void runTest( const MT1& src, MT2& dst );
 
@@ -373,6 +378,68 @@ void ClassTest::runSparseSubmatrixTests( const MT& src )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Execution of several (de-)serialization tests with plain and compressed indices.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix (de-)serialization with the given matrix both with plain and
+// with delta-encoded indices. The matrix is serialized by explicitly configured instances of
+// the MatrixSerializer class and deserialized using instances of DynamicMatrix and
+// CompressedMatrix as destination matrix type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runCompressionTests( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   for( size_t compress=0UL; compress<2UL; ++compress )
+   {
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::MatrixSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::DynamicMatrix<ET,blaze::rowMajor> dst;
+         testDeserialization( archive, dst );
+         compareMatrices( src, dst );
+      }
+
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::MatrixSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::DynamicMatrix<ET,blaze::columnMajor> dst;
+         testDeserialization( archive, dst );
+         compareMatrices( src, dst );
+      }
+
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::MatrixSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::CompressedMatrix<ET,blaze::rowMajor> dst;
+         testDeserialization( archive, dst );
+         compareMatrices( src, dst );
+      }
+
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::MatrixSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::CompressedMatrix<ET,blaze::columnMajor> dst;
+         testDeserialization( archive, dst );
+         compareMatrices( src, dst );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Running a single (de-)serialization test with the given pair of matrices.
 //
@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/panelmatrix/ClassTest.h
+//  \brief Header file for the PanelMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_PANELMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PANELMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/ThreadPool.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace panelmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PanelMatrix class template.
+//
+// This class represents a test suite for the blaze::PanelMatrix class template and the
+// serializePanels() function. It performs a series of runtime tests with different matrix
+// types and panel sizes to test the out-of-core matrix/vector multiplications both with and
+// without asynchronous reading of the panels.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testEmptyMatrices ();
+   void testRandomMatrices();
+   void testFailures      ();
+
+   template< typename MT >
+   void runTest( const MT& src, size_t panelRows );
+
+   template< typename VT1, typename VT2 >
+   void compareVectors( const VT1& result, const VT2& expected, const std::string& operation,
+                        size_t panelRows, bool parallel );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string       test_;      //!< Label of the currently performed test.
+   std::string       filename_;  //!< The name of the temporary panel file.
+   blaze::ThreadPool pool_;      //!< The thread pool for the asynchronous reading of the panels.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication test of a dense or sparse matrix.
+//
+// \param src The source matrix to be tested.
+// \param panelRows The number of rows per panel.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given matrix as a sequence of row panels, opens the file via a
+// PanelMatrix and compares the results of the out-of-core multiplications \f$ A*\vec{x} \f$
+// and \f$ A^T*\vec{x} \f$ with the results of the according in-memory multiplications. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runTest( const MT& src, size_t panelRows )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   typedef typename blaze::If< blaze::IsDenseMatrix<MT>
+                             , blaze::DynamicMatrix<ET,blaze::rowMajor>
+                             , blaze::CompressedMatrix<ET,blaze::rowMajor> >::Type  PanelType;
+
+   try {
+      blaze::serializePanels( filename_, src, panelRows );
+   }
+   catch( std::runtime_error& ex ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialization failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Rows per panel: " << panelRows << "\n"
+          << "   Error message: " << ex.what() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::PanelMatrix<PanelType> A( filename_ );
+
+   if( A.rows() != src.rows() || A.columns() != src.columns() || A.panelRows() != panelRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid panel matrix size\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   Expected size: " << src.rows() << "x" << src.columns() << "\n"
+          << "   Size of the panel matrix: " << A.rows() << "x" << A.columns() << "\n"
+          << "   Rows per panel: " << A.panelRows() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::DynamicMatrix<ET,blaze::rowMajor> ref( src );
+
+   blaze::DynamicVector<ET,blaze::columnVector> x( src.columns() ), y( src.rows() );
+   blaze::DynamicVector<ET,blaze::columnVector> w( src.rows() ), z( src.columns() );
+   randomize( x, ET(-10), ET(10) );
+   randomize( w, ET(-10), ET(10) );
+
+   const blaze::DynamicVector<ET,blaze::columnVector> y1( ref * x );
+   const blaze::DynamicVector<ET,blaze::columnVector> z1( trans( ref ) * w );
+
+   A.multiply( x, y );
+   compareVectors( y, y1, "A*x", panelRows, false );
+
+   A.multiply( pool_, x, y );
+   compareVectors( y, y1, "A*x", panelRows, true );
+
+   A.transMultiply( w, z );
+   compareVectors( z, z1, "trans(A)*x", panelRows, false );
+
+   A.transMultiply( pool_, w, z );
+   compareVectors( z, z1, "trans(A)*x", panelRows, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an out-of-core multiplication with the expected result.
+//
+// \param result The result of the out-of-core multiplication.
+// \param expected The result of the in-memory multiplication.
+// \param operation The performed operation.
+// \param panelRows The number of rows per panel.
+// \param parallel \a true in case the panels were read asynchronously.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void ClassTest::compareVectors( const VT1& result, const VT2& expected, const std::string& operation,
+                                size_t panelRows, bool parallel )
+{
+   if( result.size() != expected.size() || result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-core multiplication " << operation << " failed\n"
+          << " Details:\n"
+          << "   Rows per panel: " << panelRows << "\n"
+          << "   Asynchronous reading: " << ( parallel ? "yes" : "no" ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PanelMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PanelMatrix class test.
+*/
+#define RUN_PANELMATRIX_CLASS_TEST \
+   blazetest::mathtest::panelmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace panelmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -92,9 +92,11 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyVectors ();
-   void testRandomVectors();
-   void testFailures     ();
+   void testEmptyVectors     ();
+   void testRandomVectors    ();
+   void testCompressedIndices();
+   void testLegacyFormat     ();
+   void testFailures         ();
 
    template< size_t N, typename VT >
    void runAllTests( const VT& src );
@@ -114,6 +116,9 @@ class ClassTest
    template< size_t N, typename VT >
    void runSparseSubvectorTests( const VT& src );
 
+   template< typename VT >
+   void runCompressionTests( const VT& src );
+
    template< typename VT1_, typename VT2_ >
    void runTest( const VT1_& src, VT2_& dst );
 
@@ -342,6 +347,50 @@ void ClassTest::runSparseSubvectorTests( const VT& src )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Execution of several (de-)serialization tests with plain and compressed indices.
+//
+// \param src The source vector to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the vector (de-)serialization with the given vector both with plain and
+// with delta-encoded indices. The vector is serialized by explicitly configured instances of
+// the VectorSerializer class and deserialized using instances of DynamicVector and
+// CompressedVector as destination vector type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename VT >  // Type of the vector
+void ClassTest::runCompressionTests( const VT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_TYPE( VT );
+
+   typedef typename VT::ElementType  ET;
+
+   for( size_t compress=0UL; compress<2UL; ++compress )
+   {
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::VectorSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::DynamicVector<ET> dst;
+         testDeserialization( archive, dst );
+         compareVectors( src, dst );
+      }
+
+      {
+         blaze::Archive<std::stringstream> archive;
+         blaze::VectorSerializer( compress == 1UL ).serialize( archive, src );
+
+         blaze::CompressedVector<ET> dst;
+         testDeserialization( archive, dst );
+         compareVectors( src, dst );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Running a single (de-)serialization test with the given pair of vectors.
 //
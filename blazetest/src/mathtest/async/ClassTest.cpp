@@ -0,0 +1,409 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/async/ClassTest.cpp
+//  \brief Source file for the asynchronous evaluation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Async.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/ThreadPool.h>
+#include <blazetest/mathtest/async/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace async {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the asynchronous evaluation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testVector();
+   testMatrix();
+   testDependencies();
+   testAliasing();
+   testViews();
+   testFailure();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous evaluation of vector expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous evaluation of a matrix/vector multiplication. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVector()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<double> A( 64UL, 48UL );
+   blaze::DynamicVector<double> x( 48UL ), y, z( 64UL );
+   randomize( A );
+   randomize( x );
+
+   const blaze::Future future( blaze::async( pool, y, A * x + A * x ) );
+   z = A * x + A * x;
+   future.get();
+
+   if( y != z ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of y = A*x + A*x\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n" << z << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous evaluation of matrix expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent asynchronous evaluation of two independent matrix/matrix
+// multiplications. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrix()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 40UL, 30UL ), C;
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( 30UL, 50UL ), D;
+   randomize( A );
+   randomize( B );
+
+   const blaze::Future f1( blaze::async( pool, C, A * B ) );
+   const blaze::Future f2( blaze::async( pool, D, trans( B ) * trans( A ) ) );
+
+   f1.get();
+   f2.get();
+
+   const blaze::DynamicMatrix<double> refC( A * B );
+   const blaze::DynamicMatrix<double> refD( trans( B ) * trans( A ) );
+
+   if( C != refC || D != refD ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of C = A*B and D = trans(B)*trans(A)\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result C:\n" << C << "\n"
+          << "   Expected result C:\n" << refC << "\n"
+          << "   Result D:\n" << D << "\n"
+          << "   Expected result D:\n" << refD << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dependencies between asynchronous evaluations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a chain of asynchronous evaluations, where each evaluation depends on
+// the result of previous evaluations. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDependencies()
+{
+   blaze::ThreadPool pool( 3UL );
+
+   blaze::DynamicMatrix<double> A( 20UL, 20UL ), B( 20UL, 20UL );
+   blaze::DynamicMatrix<double> C( 20UL, 20UL ), D( 20UL, 20UL ), E( 20UL, 20UL );
+   randomize( A );
+   randomize( B );
+
+   const blaze::Future f1( blaze::async( pool, C, A * B ) );
+   const blaze::Future f2( blaze::async( pool, D, B * A ) );
+   const blaze::Future f3( blaze::async( pool, E, C - D, f1, f2 ) );
+   const blaze::Future f4( blaze::async( pool, C, E * A, f3 ) );
+
+   f4.get();
+
+   const blaze::DynamicMatrix<double> refE( A * B - B * A );
+   const blaze::DynamicMatrix<double> refC( refE * A );
+
+   if( E != refE || C != refC ) {
+      std::ostringstream oss;
+      oss << " Test: Chain of asynchronous evaluations\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n"
+          << "   Expected result:\n" << refC << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous evaluation of aliased expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous evaluation of expressions that contain the target of
+// the assignment. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAliasing()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<double> A( 16UL, 16UL ), B( 16UL, 16UL );
+   blaze::DynamicVector<double> x( 16UL );
+   randomize( A );
+   randomize( B );
+   randomize( x );
+
+   const blaze::DynamicMatrix<double> refA( A * B );
+   const blaze::DynamicVector<double> refx( B * x );
+
+   const blaze::Future f1( blaze::async( pool, A, A * B ) );
+   const blaze::Future f2( blaze::async( pool, x, B * x ) );
+
+   f1.get();
+   f2.get();
+
+   if( A != refA || x != refx ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of A = A*B and x = B*x\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << A << "\n"
+          << "   Expected result:\n" << refA << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous evaluation of views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asynchronous assignment of temporary views and of expressions
+// containing temporary views. All views are destroyed before the dependencies of the
+// assignments have been completed. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testViews()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<double> A( 32UL, 32UL ), B( 32UL, 32UL ), C( 32UL, 32UL ), D;
+   blaze::DynamicVector<double,blaze::rowVector> y;
+   blaze::DynamicVector<double,blaze::columnVector> x( 32UL ), z;
+   randomize( A );
+   randomize( B );
+   randomize( x );
+
+   using blaze::row;
+   using blaze::subvector;
+   using blaze::submatrix;
+
+   const blaze::Future f1( blaze::async( pool, C, A * B ) );
+   const blaze::Future f2( blaze::async( pool, y, row( C, 5UL ), f1 ) );
+   const blaze::Future f3( blaze::async( pool, z, subvector( x, 8UL, 16UL ) +
+                                         trans( subvector( row( C, 3UL ), 4UL, 16UL ) ), f1 ) );
+   const blaze::Future f4( blaze::async( pool, D, submatrix( C, 4UL, 8UL, 12UL, 16UL ), f1 ) );
+
+   f2.get();
+   f3.get();
+   f4.get();
+
+   const blaze::DynamicMatrix<double> refC( A * B );
+   const blaze::DynamicVector<double,blaze::rowVector> refy( row( refC, 5UL ) );
+   const blaze::DynamicVector<double,blaze::columnVector> refz(
+      subvector( x, 8UL, 16UL ) + trans( subvector( row( refC, 3UL ), 4UL, 16UL ) ) );
+   const blaze::DynamicMatrix<double> refD( submatrix( refC, 4UL, 8UL, 12UL, 16UL ) );
+
+   if( y != refy ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of y = row( C, 5 )\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n" << refy << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( z != refz ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of z = x[8..23] + trans( row( C, 3 )[4..19] )\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << z << "\n"
+          << "   Expected result:\n" << refz << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( D != refD ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous evaluation of D = submatrix( C, 4, 8, 12, 16 )\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << D << "\n"
+          << "   Expected result:\n" << refD << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of errors of asynchronous evaluations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown during an asynchronous evaluation is rethrown
+// by the according future and by the futures of all dependent evaluations. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailure()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<double> A( 4UL, 3UL ), C( 3UL, 3UL );
+   blaze::StaticMatrix<double,3UL,3UL> B;
+   randomize( A );
+
+   const blaze::Future f1( blaze::async( pool, B, A ) );
+   const blaze::Future f2( blaze::async( pool, C, B * B, f1 ) );
+
+   size_t caught( 0UL );
+
+   try {
+      f1.get();
+   }
+   catch( std::invalid_argument& ) {
+      ++caught;
+   }
+
+   try {
+      f2.get();
+   }
+   catch( std::invalid_argument& ) {
+      ++caught;
+   }
+
+   if( caught != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: Asynchronous assignment of a 4x3 matrix to a 3x3 static matrix\n"
+          << " Error: Exception has not been propagated\n"
+          << " Details:\n"
+          << "   Number of caught exceptions = " << caught << "\n"
+          << "   Expected number             = 2\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace async
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_ASYNC_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
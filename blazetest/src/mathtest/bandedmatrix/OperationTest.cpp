@@ -0,0 +1,552 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bandedmatrix/OperationTest.cpp
+//  \brief Source file for the banded matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/bandedmatrix/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testSetup();
+
+   for( size_t n=0UL; n<=33UL; ++n ) {
+      for( size_t k=0UL; k<=9UL; k+=3UL ) {
+         testBanded<double,0UL,0UL>( n, k );
+         testBanded<double,1UL,1UL>( n, k );
+         testBanded<double,3UL,3UL>( n, k );
+         testBanded<double,2UL,0UL>( n, k );
+         testBanded<double,0UL,2UL>( n, k );
+         testBanded<double,1UL,3UL>( n, k );
+         testBanded<float ,1UL,1UL>( n, k );
+         testBanded<float ,3UL,3UL>( n, k );
+         testBanded<int   ,1UL,1UL>( n, k );
+         testBanded<int   ,3UL,2UL>( n, k );
+      }
+      testDiagonal<double>( n );
+      testDiagonal<float> ( n );
+      testDiagonal<int>   ( n );
+   }
+
+   testBanded<double,1UL,1UL>( 257UL, 37UL );
+   testBanded<double,3UL,3UL>( 257UL, 37UL );
+   testDiagonal<double>( 257UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BandedMatrix class template.
+//
+// \param n The number of rows and columns of the banded matrix.
+// \param k The number of columns of the right-hand side dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access of a banded matrix, its conversion to a dense matrix,
+// the banded matrix/vector and matrix/matrix multiplications, the scaling, the solution of
+// banded systems and the use of a banded matrix within a dense matrix expression.
+*/
+template< typename T  // Element type
+        , size_t KL   // Number of subdiagonals
+        , size_t KU > // Number of superdiagonals
+void OperationTest::testBanded( size_t n, size_t k )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>       RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>    CMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>   VT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  DRMT;
+   typedef blaze::BandedMatrix<T,KL,KU>                  BMT;
+
+   std::ostringstream oss;
+   oss << "BandedMatrix<" << KL << "," << KU << ">";
+   const std::string name( oss.str() );
+
+   RMT D( n, n );
+   RMT B( n, k );
+   CMT TB( n, k );
+   VT x( n );
+
+   randomize( D );
+   band( D, KL, KU );
+   randomize( x );
+   randomize( B );
+   randomize( TB );
+
+   BMT A( D );
+
+   test_ = name + " element access";
+
+   checkValue<size_t>( "Number of rows", A.rows(), n );
+   checkValue<size_t>( "Number of columns", A.columns(), n );
+   checkValue<size_t>( "Capacity", A.capacity(), (KL+KU+1UL)*n );
+   checkMatrix( "Element access", A, D );
+   checkMatrix( "Conversion", RMT( A ), D );
+
+   if( n > KU ) {
+      A(0UL,KU) = T( 7 );
+      checkValue<T>( "Write access to the band", A(0UL,KU), T( 7 ) );
+      A(0UL,KU) = D(0UL,KU);
+   }
+
+   test_ = name + "/dense vector multiplication";
+
+   const VT y( D * x );
+
+   checkVector( "Multiplication", VT( A * x ), y );
+   checkVector( "Multiplication with a vector expression", VT( A * ( x + x ) ), VT( D * ( x + x ) ) );
+
+   VT z( 3UL );
+   multiply( z, A, x );
+   checkValue<size_t>( "Reused vector size", z.size(), n );
+   checkVector( "Reused multiplication", z, y );
+
+   z = x;
+   multiply( z, A, z );
+   checkVector( "Aliased multiplication", z, y );
+
+   test_ = name + "/dense matrix multiplication";
+
+   checkMatrix( "Multiplication with a row-major matrix", RMT( A * B ), RMT( D * B ) );
+   checkMatrix( "Multiplication with a column-major matrix", RMT( A * TB ), RMT( D * TB ) );
+   checkMatrix( "Multiplication with itself", RMT( A * A ), RMT( D * D ) );
+
+   test_ = name + " scaling";
+
+   checkMatrix( "Multiplication with a scalar", RMT( A * T( 3 ) ), RMT( D * T( 3 ) ) );
+   checkMatrix( "Multiplication of a scalar", RMT( T( 3 ) * A ), RMT( T( 3 ) * D ) );
+   checkMatrix( "Multiplication with a scalar of different type", DRMT( A * 0.5 ), DRMT( D * 0.5 ) );
+
+   BMT S( A );
+   S *= T( 3 );
+   checkMatrix( "Multiplication assignment", S, RMT( D * T( 3 ) ) );
+   S /= T( 3 );
+   checkMatrix( "Division assignment", S, D );
+
+   test_ = name + " solution";
+
+   RMT L( n, n ), U( n, n );
+   randomize( L );
+   band( L, KL, 0UL );
+   unitDiagonal( L );
+   randomize( U );
+   band( U, 0UL, KU );
+   unitDiagonal( U );
+
+   const RMT M( L * U );
+   const BMT LU( M );
+   const VT b( M * x );
+
+   VT s;
+   solve( s, LU, b );
+   checkValue<size_t>( "Solution size", s.size(), n );
+   checkVector( "Solution", s, x );
+
+   s = b;
+   solve( s, LU, s );
+   checkVector( "Aliased solution", s, x );
+
+   test_ = name + " within dense matrix expressions";
+
+   checkMatrix( "Addition", RMT( A + D ), RMT( D + D ) );
+   checkMatrix( "Transpose", RMT( trans( A ) ), RMT( trans( D ) ) );
+   checkVector( "Multiplication with a dense matrix", VT( D * A * x ), VT( D * D * x ) );
+
+   z = x;
+   z = A * z;
+   checkVector( "Aliased assignment", z, y );
+
+   z += A * x;
+   checkVector( "Addition assignment", z, VT( y + y ) );
+
+   RMT C( B );
+   C -= A * B;
+   checkMatrix( "Subtraction assignment", C, RMT( B - D * B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DiagonalMatrix class template.
+//
+// \param n The number of rows and columns of the diagonal matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup of a diagonal matrix from a vector of diagonal elements, its
+// multiplication with dense vectors and matrices, its scaling and the solution of diagonal
+// systems.
+*/
+template< typename T >  // Element type
+void OperationTest::testDiagonal( size_t n )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>      RMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   VT d( n ), x( n );
+   RMT B( n, 3UL );
+
+   randomize( d );
+   randomize( x );
+   randomize( B );
+
+   RMT D( n, n, T() );
+   for( size_t i=0UL; i<n; ++i ) {
+      if( d[i] == T() ) d[i] = T( 1 );
+      D(i,i) = d[i];
+   }
+
+   blaze::DiagonalMatrix<T> A( d );
+
+   test_ = "DiagonalMatrix setup";
+
+   checkValue<size_t>( "Number of rows", A.rows(), n );
+   checkValue<size_t>( "Capacity", A.capacity(), n );
+   checkMatrix( "Setup from a vector", A, D );
+   checkMatrix( "Setup from a matrix", blaze::DiagonalMatrix<T>( D ), D );
+
+   blaze::DiagonalMatrix<T> A2;
+   A2 = D;
+   checkMatrix( "Assignment of a matrix", A2, D );
+
+   test_ = "DiagonalMatrix operations";
+
+   const VT b( D * x );
+
+   checkVector( "Multiplication with a vector", VT( A * x ), b );
+   checkMatrix( "Multiplication with a matrix", RMT( A * B ), RMT( D * B ) );
+   checkMatrix( "Multiplication with a scalar", RMT( A * T( 2 ) ), RMT( D * T( 2 ) ) );
+   checkMatrix( "Transpose", RMT( trans( A ) ), D );
+
+   VT s;
+   solve( s, A, b );
+   checkVector( "Solution", s, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setup of banded matrices from invalid dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the setup of banded and diagonal matrices from non-square matrices
+// and from matrices with non-zero elements outside the band is rejected.
+*/
+void OperationTest::testSetup()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  RMT;
+
+   const RMT rectangular( 3UL, 4UL, 0.0 );
+
+   RMT D( 3UL, 3UL, 0.0 );
+   D(2,0) = 1.0;
+
+   test_ = "Setup of a BandedMatrix";
+
+   try {
+      blaze::BandedMatrix<double,1UL,1UL> A( D );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a matrix with elements outside the band succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::BandedMatrix<double,1UL,1UL> A( rectangular );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-square matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::BandedMatrix<double,1UL,1UL> A( 3UL );
+      A = D;
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Assignment of a matrix with elements outside the band succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::BandedMatrix<double,2UL,0UL> A( D );
+      blaze::BandedMatrix<double,0UL,2UL> B( trans( D ) );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a matrix within the band failed\n" );
+   }
+
+   test_ = "Setup of a DiagonalMatrix";
+
+   try {
+      blaze::DiagonalMatrix<double> A( D );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-diagonal matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   checkValue<size_t>( op + " size", result.size(), expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<ET>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   typedef typename MT1::ElementType  ET;
+
+   checkValue<size_t>( op + " rows", result.rows(), expected.rows() );
+   checkValue<size_t>( op + " columns", result.columns(), expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at index (" << i << "," << j << ")";
+         checkValue<ET>( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small random integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small random integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting all elements of a square dense matrix outside the given band.
+//
+// \param A The dense matrix to be modified.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::band( blaze::DenseMatrix<MT,false>& A, size_t kl, size_t ku )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         if( j+kl < i || i+ku < j ) (~A)(i,j) = ET();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the diagonal elements of a square dense matrix to 1 or -1.
+//
+// \param A The dense matrix to be modified.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::unitDiagonal( blaze::DenseMatrix<MT,false>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      (~A)(i,i) = ET( ( i % 3UL == 1UL )?( -1 ):( 1 ) );
+}
+//*************************************************************************************************
+
+} // namespace bandedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running banded matrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_BANDEDMATRIX_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during banded matrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/csv/ClassTest.cpp
+//  \brief Source file for the CSV class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/math/serialization/CSV.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/csv/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace csv {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CSV class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                 // Label of the currently performed test
+   , filename_( "csv.csv" )  // The name of the temporary CSV file
+   , pool_( 4UL )            // The thread pool for the parallel tests
+{
+   testEmptyMatrices();
+   testRandomMatrices();
+   testFormats();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the CSV class test.
+//
+// The destructor removes the temporary CSV file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Round trip test with empty matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with empty matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEmptyMatrices()
+{
+   test_ = "Empty matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src;
+      runTest( src, ',' );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src;
+      runTest( src, ';' );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Round trip test with randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with randomly initialized matrices. The larger
+// matrices result in files that are split into several chunks for the parallel reading. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRandomMatrices()
+{
+   test_ = "Randomly initialized matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runTest( src, ',' );
+   }
+
+   {
+      blaze::DynamicMatrix<float,blaze::columnMajor> src( 33UL, 17UL );
+      randomize( src );
+      runTest( src, '\t' );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 250UL, 120UL );
+      randomize( src );
+      runTest( src, ';' );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runTest( src, ',' );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 600UL, 300UL );
+      randomize( src, 9000UL );
+      runTest( src, ',' );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::columnMajor> src( 300UL, 600UL );
+      randomize( src, 9000UL );
+      runTest( src, ' ' );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading test of hand-crafted CSV files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads hand-crafted CSV files with blank lines, blanks around the values,
+// Windows line endings, and a missing final line break. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFormats()
+{
+   test_ = "Hand-crafted CSV files";
+
+   {
+      const std::string text( "\n"
+                              " 1, 0 ,2.5\r\n"
+                              "0,0,0\r\n"
+                              "\n"
+                              "-3,\t4e2, 0" );
+
+      const double values[3][3] = { { 1, 0, 2.5 }, { 0, 0, 0 }, { -3, 400, 0 } };
+      const blaze::DynamicMatrix<double> ref( values );
+
+      runReadTest< blaze::CompressedMatrix<double,blaze::rowMajor>    >( text, ref, ',' );
+      runReadTest< blaze::CompressedMatrix<double,blaze::columnMajor> >( text, ref, ',' );
+      runReadTest< blaze::DynamicMatrix<double,blaze::rowMajor>       >( text, ref, ',' );
+      runReadTest< blaze::DynamicMatrix<double,blaze::columnMajor>    >( text, ref, ',' );
+   }
+
+   {
+      const std::string text( "1;-2\n"
+                              "3;4\n"
+                              "0;6\n" );
+
+      const int values[3][2] = { { 1, -2 }, { 3, 4 }, { 0, 6 } };
+      const blaze::DynamicMatrix<int> ref( values );
+
+      runReadTest< blaze::CompressedMatrix<int,blaze::rowMajor> >( text, ref, ';' );
+      runReadTest< blaze::DynamicMatrix<int,blaze::columnMajor> >( text, ref, ';' );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing reading attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with invalid CSV files. In case no error is detected, i.e. in
+// case the test is failing, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Reading failures";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  RSMat;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  CDMat;
+
+   runFailureTest<RSMat>( "1,2\n3\n", "Reading of short row" );
+   runFailureTest<CDMat>( "1,2\n3\n", "Reading of short row" );
+   runFailureTest<RSMat>( "1,2\n3,4,5\n", "Reading of long row" );
+   runFailureTest<CDMat>( "1,2 x\n3,4\n", "Reading of invalid delimiter" );
+   runFailureTest<CDMat>( "1,,2\n", "Reading of empty value" );
+   runFailureTest<RSMat>( "1,2\n3,abc\n", "Reading of invalid value" );
+   runFailureTest< blaze::DynamicMatrix<int> >( "1,2.5\n", "Reading of real value into integral matrix" );
+
+   try {
+      RSMat dst;
+      blaze::readCSV( "csv.nonexisting", dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading of nonexisting file succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given text into the temporary CSV file.
+//
+// \param text The content of the file.
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+void ClassTest::writeFile( const std::string& text )
+{
+   std::ofstream file( filename_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+   file.write( text.data(), text.size() );
+   file.close();
+
+   if( !file ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Temporary file could not be written\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace csv
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CSV class test..." << std::endl;
+
+   try
+   {
+      RUN_CSV_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CSV class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
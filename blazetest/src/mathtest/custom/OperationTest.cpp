@@ -0,0 +1,688 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/custom/OperationTest.cpp
+//  \brief Source file for the custom vector and matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/custom/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custom {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testSetup();
+
+   for( size_t n=0UL; n<=33UL; ++n ) {
+      testVector<double,unaligned,unpadded>( n );
+      testVector<double,unaligned,padded  >( n );
+      testVector<double,aligned  ,unpadded>( n );
+      testVector<double,aligned  ,padded  >( n );
+      testVector<float ,unaligned,unpadded>( n );
+      testVector<float ,aligned  ,padded  >( n );
+      testVector<int   ,unaligned,unpadded>( n );
+      testVector<int   ,aligned  ,padded  >( n );
+   }
+
+   for( size_t m=0UL; m<=19UL; m+=3UL ) {
+      for( size_t n=0UL; n<=19UL; n+=2UL ) {
+         testMatrix<double,unaligned,unpadded,rowMajor   >( m, n );
+         testMatrix<double,unaligned,unpadded,columnMajor>( m, n );
+         testMatrix<double,aligned  ,unpadded,rowMajor   >( m, n );
+         testMatrix<double,aligned  ,padded  ,columnMajor>( m, n );
+         testMatrix<double,unaligned,padded  ,rowMajor   >( m, n );
+         testMatrix<float ,aligned  ,padded  ,rowMajor   >( m, n );
+         testMatrix<int   ,unaligned,unpadded,columnMajor>( m, n );
+      }
+   }
+
+   testVector<double,aligned,padded>( 1025UL );
+   testMatrix<double,aligned,padded,rowMajor>( 67UL, 131UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CustomVector class template.
+//
+// \param n The size of the custom vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations, the arithmetic operations
+// and the views of a custom vector that represents an array with the given alignment and
+// padding. The array is surrounded by guard elements and it is checked after every operation
+// that neither the guard elements nor the padding elements are modified.
+*/
+template< typename T  // Element type
+        , bool AF     // Alignment flag
+        , bool PF >   // Padding flag
+void OperationTest::testVector( size_t n )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>         RMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>     VT;
+   typedef blaze::CompressedVector<T,blaze::columnVector>  SVT;
+   typedef blaze::CustomVector<T,AF,PF>                    CVT;
+
+   const size_t size ( blaze::IntrinsicTrait<T>::size );
+   const size_t nn   ( PF ? ( n + size - 1UL ) / size * size : n );
+   const size_t guard( AF ? size : size + 1UL );
+
+   std::ostringstream oss;
+   oss << "CustomVector<" << ( AF ? "aligned" : "unaligned" ) << "," << ( PF ? "padded" : "unpadded" )
+       << "> (n=" << n << ")";
+   const std::string name( oss.str() );
+
+   T* array( allocate<T>( nn, guard ) );
+   for( size_t i=n; i<nn; ++i )
+      array[guard+i] = T();
+
+   VT x( n ), y( n );
+   RMT A( n, n );
+
+   randomize( x );
+   randomize( y );
+   randomize( A );
+
+   CVT a( array+guard, n, nn );
+
+   test_ = name + " assignment";
+
+   checkValue<size_t>( "Size", a.size(), n );
+   checkValue<size_t>( "Capacity", a.capacity(), nn );
+
+   a = x;
+   checkVector( "Assignment", a, x );
+   checkMemory( "Assignment", array, 1UL, n, nn, guard, PF );
+
+   checkValue<size_t>( "Number of non-zeros", a.nonZeros(), x.nonZeros() );
+   checkVector( "Conversion", VT( a ), x );
+
+   CVT b( a );
+   if( n > 0UL ) {
+      b[0] = T( 7 );
+      checkValue<T>( "Write access to a copy", a[0], T( 7 ) );
+      b[0] = x[0];
+   }
+
+   a = T( 3 );
+   checkVector( "Homogeneous assignment", a, VT( n, T( 3 ) ) );
+
+   SVT s( n );
+   if( n > 2UL ) s[2] = T( 5 );
+   a = s;
+   checkVector( "Assignment of a sparse vector", a, VT( s ) );
+   checkMemory( "Assignment of a sparse vector", array, 1UL, n, nn, guard, PF );
+
+   test_ = name + " arithmetic operations";
+
+   a = x;
+   checkVector( "Addition", VT( a + y ), VT( x + y ) );
+   checkVector( "Multiplication with a matrix", VT( A * a ), VT( A * x ) );
+   checkValue<T>( "Inner product", trans( a ) * y, trans( x ) * y );
+
+   a = a + y;
+   checkVector( "Aliased addition", a, VT( x + y ) );
+   a -= y;
+   checkVector( "Subtraction assignment", a, x );
+   a += y;
+   checkVector( "Addition assignment", a, VT( x + y ) );
+   a *= y;
+   checkVector( "Multiplication assignment", a, VT( ( x + y ) * y ) );
+   checkMemory( "Assignment operations", array, 1UL, n, nn, guard, PF );
+
+   a = x;
+   a = A * a;
+   checkVector( "Aliased multiplication", a, VT( A * x ) );
+   a *= T( 2 );
+   checkVector( "Multiplication with a scalar", a, VT( A * x * T( 2 ) ) );
+   a /= T( 2 );
+   checkVector( "Division by a scalar", a, VT( A * x ) );
+   checkMemory( "Scaling", array, 1UL, n, nn, guard, PF );
+
+   test_ = name + " views";
+
+   a = x;
+   if( n > 2UL ) {
+      checkVector( "Subvector", VT( subvector( a, 1UL, n-2UL ) ), VT( subvector( x, 1UL, n-2UL ) ) );
+      subvector( a, 1UL, n-2UL ) = subvector( y, 1UL, n-2UL );
+      checkValue<T>( "Subvector assignment", a[1], y[1] );
+      checkValue<T>( "Subvector assignment", a[n-1UL], x[n-1UL] );
+   }
+   checkMemory( "Subvector assignment", array, 1UL, n, nn, guard, PF );
+
+   a.reset();
+   checkValue<size_t>( "Reset", a.nonZeros(), 0UL );
+   a.clear();
+   checkValue<size_t>( "Clear", a.size(), 0UL );
+   checkMemory( "Clear", array, 1UL, n, nn, guard, PF );
+
+   blaze::deallocate( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomMatrix class template.
+//
+// \param m The number of rows of the custom matrix.
+// \param n The number of columns of the custom matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations, the arithmetic operations
+// and the views of a custom matrix that represents an array with the given alignment, padding
+// and storage order. The rows (or columns) of the matrix are separated by a spacing larger than
+// the number of columns (or rows). The array is surrounded by guard elements and it is checked
+// after every operation that neither the guard elements nor the elements between the rows (or
+// columns) are modified.
+*/
+template< typename T  // Element type
+        , bool AF     // Alignment flag
+        , bool PF     // Padding flag
+        , bool SO >   // Storage order
+void OperationTest::testMatrix( size_t m, size_t n )
+{
+   typedef blaze::DynamicMatrix<T,SO>                   MT;
+   typedef blaze::DynamicMatrix<T,!SO>                  OMT;
+   typedef blaze::CompressedMatrix<T,SO>                SMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>     TVT;
+   typedef blaze::CustomMatrix<T,AF,PF,SO>              CMT;
+
+   const size_t size ( blaze::IntrinsicTrait<T>::size );
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+   const size_t nn   ( ( AF || PF )?( ( minor + size - 1UL ) / size * size + size ):( minor + 3UL ) );
+   const size_t guard( AF ? size : size + 1UL );
+
+   std::ostringstream oss;
+   oss << "CustomMatrix<" << ( AF ? "aligned" : "unaligned" ) << "," << ( PF ? "padded" : "unpadded" )
+       << "," << ( SO ? "columnMajor" : "rowMajor" ) << "> (m=" << m << ",n=" << n << ")";
+   const std::string name( oss.str() );
+
+   T* array( allocate<T>( major*nn, guard ) );
+   if( PF ) {
+      for( size_t i=0UL; i<major; ++i )
+         for( size_t j=minor; j<nn; ++j )
+            array[guard+i*nn+j] = T();
+   }
+
+   MT D( m, n ), E( m, n ), S( n, n );
+   OMT F( m, n );
+   VT x( n );
+   TVT y( m );
+
+   randomize( D );
+   randomize( E );
+   randomize( F );
+   randomize( S );
+   randomize( x );
+   for( size_t i=0UL; i<m; ++i )
+      y[i] = T( blaze::rand<int>( -5, 5 ) );
+
+   CMT A( array+guard, m, n, nn );
+
+   test_ = name + " assignment";
+
+   checkValue<size_t>( "Number of rows", A.rows(), m );
+   checkValue<size_t>( "Number of columns", A.columns(), n );
+   checkValue<size_t>( "Spacing", A.spacing(), nn );
+
+   A = D;
+   checkMatrix( "Assignment", A, D );
+   checkMemory( "Assignment", array, major, minor, nn, guard, PF );
+
+   checkValue<size_t>( "Number of non-zeros", A.nonZeros(), D.nonZeros() );
+   checkMatrix( "Conversion", MT( A ), D );
+
+   A = F;
+   checkMatrix( "Assignment of a matrix with opposite storage order", A, F );
+
+   A = T( 3 );
+   checkMatrix( "Homogeneous assignment", A, MT( m, n, T( 3 ) ) );
+
+   SMT C( m, n );
+   if( m > 1UL && n > 2UL ) C(1,2) = T( 5 );
+   A = C;
+   checkMatrix( "Assignment of a sparse matrix", A, MT( C ) );
+   A = trans( blaze::CompressedMatrix<T,!SO>( trans( C ) ) );
+   checkMatrix( "Assignment of a sparse matrix with opposite storage order", A, MT( C ) );
+   checkMemory( "Assignment of a sparse matrix", array, major, minor, nn, guard, PF );
+
+   test_ = name + " arithmetic operations";
+
+   A = D;
+   checkMatrix( "Addition", MT( A + E ), MT( D + E ) );
+   checkVector( "Multiplication with a vector", VT( A * x ), VT( D * x ) );
+   checkVector( "Multiplication of a vector", TVT( y * A ), TVT( y * D ) );
+   checkMatrix( "Multiplication with a matrix", MT( A * S ), MT( D * S ) );
+   checkMatrix( "Transpose", OMT( trans( A ) ), OMT( trans( D ) ) );
+
+   A = A + E;
+   checkMatrix( "Aliased addition", A, MT( D + E ) );
+   A -= E;
+   checkMatrix( "Subtraction assignment", A, D );
+   A += F;
+   checkMatrix( "Addition assignment", A, MT( D + F ) );
+   A -= F;
+   A *= S;
+   checkMatrix( "Multiplication assignment", A, MT( D * S ) );
+   checkMemory( "Assignment operations", array, major, minor, nn, guard, PF );
+
+   A = D;
+   A *= T( 2 );
+   checkMatrix( "Multiplication with a scalar", A, MT( D * T( 2 ) ) );
+   A /= T( 2 );
+   checkMatrix( "Division by a scalar", A, D );
+   checkMemory( "Scaling", array, major, minor, nn, guard, PF );
+
+   test_ = name + " views";
+
+   if( m > 1UL && n > 1UL ) {
+      checkVector( "Row", TVT( row( A, 1UL ) ), TVT( row( D, 1UL ) ) );
+      checkVector( "Column", VT( column( A, 1UL ) ), VT( column( D, 1UL ) ) );
+      checkMatrix( "Submatrix", MT( submatrix( A, 1UL, 1UL, m-1UL, n-1UL ) ),
+                                MT( submatrix( D, 1UL, 1UL, m-1UL, n-1UL ) ) );
+
+      row( A, 1UL ) = row( E, 1UL );
+      submatrix( A, 0UL, 0UL, 1UL, n ) = submatrix( E, 0UL, 0UL, 1UL, n );
+      checkValue<T>( "Row assignment", A(1UL,n-1UL), E(1UL,n-1UL) );
+      checkValue<T>( "Submatrix assignment", A(0UL,n-1UL), E(0UL,n-1UL) );
+   }
+   checkMemory( "View assignments", array, major, minor, nn, guard, PF );
+
+   A.reset();
+   checkValue<size_t>( "Reset", A.nonZeros(), 0UL );
+   A.clear();
+   checkValue<size_t>( "Clear", A.rows(), 0UL );
+   checkMemory( "Clear", array, major, minor, nn, guard, PF );
+
+   blaze::deallocate( array );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setup of custom vectors and matrices from invalid arrays.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the setup of custom vectors and matrices from NULL pointers, from
+// misaligned arrays, and with insufficient padding or spacing is rejected.
+*/
+void OperationTest::testSetup()
+{
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   const size_t size( blaze::IntrinsicTrait<double>::size );
+
+   double* array( blaze::allocate<double>( 8UL*size ) );
+
+   test_ = "Setup of a CustomVector";
+
+   try {
+      blaze::CustomVector<double,unaligned,unpadded> a( NULL, 4UL );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a NULL pointer succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::CustomVector<double,unaligned,padded> a( array, 4UL*size, 4UL*size-1UL );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup with insufficient padding succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( size > 1UL ) {
+      try {
+         blaze::CustomVector<double,aligned,unpadded> a( array+1UL, 4UL );
+         throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a misaligned array succeeded\n" );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   try {
+      blaze::CustomVector<double,aligned,padded> a( array, 3UL, 4UL*size );
+      blaze::CustomVector<double,unaligned,unpadded> b( array+1UL, 3UL );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a valid array failed\n" );
+   }
+
+   test_ = "Setup of a CustomMatrix";
+
+   try {
+      blaze::CustomMatrix<double,unaligned,unpadded> A( NULL, 2UL, 2UL );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a NULL pointer succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::CustomMatrix<double,unaligned,unpadded> A( array, 2UL, 3UL, 2UL );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup with insufficient spacing succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( size > 1UL ) {
+      try {
+         blaze::CustomMatrix<double,aligned,unpadded> A( array, 2UL, 2UL, size+1UL );
+         throw std::runtime_error( " Test: " + test_ + "\n Error: Setup with a misaligned spacing succeeded\n" );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CustomMatrix<double,unaligned,padded> A( array, 2UL, 2UL, size+1UL );
+         throw std::runtime_error( " Test: " + test_ + "\n Error: Setup with insufficient padding succeeded\n" );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   try {
+      blaze::CustomMatrix<double,aligned,padded> A( array, 2UL, 3UL, 4UL*size );
+      blaze::CustomMatrix<double,unaligned,unpadded> B( array+1UL, 2UL, 3UL, 5UL );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a valid array failed\n" );
+   }
+
+   blaze::deallocate( array );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   checkValue<size_t>( op + " size", result.size(), expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<ET>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   typedef typename MT1::ElementType  ET;
+
+   checkValue<size_t>( op + " rows", result.rows(), expected.rows() );
+   checkValue<size_t>( op + " columns", result.columns(), expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at index (" << i << "," << j << ")";
+         checkValue<ET>( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the guard and padding elements of an array.
+//
+// \param op The label of the performed operation.
+// \param array The array including the leading and trailing guard elements.
+// \param size The number of rows/columns (or 1 for a vector) stored in the array.
+// \param valid The number of valid elements per row/column.
+// \param spacing The total number of elements per row/column.
+// \param guard The number of leading and trailing guard elements.
+// \param padded \a true in case the elements between two rows/columns are zero padding elements.
+// \return void
+// \exception std::runtime_error Modification of a guard or padding element detected.
+*/
+template< typename T >  // Element type
+void OperationTest::checkMemory( const std::string& op, const T* array, size_t size, size_t valid,
+                                 size_t spacing, size_t guard, bool padded ) const
+{
+   for( size_t i=0UL; i<guard; ++i ) {
+      checkValue<T>( op + " leading guard element", array[i], T( 99 ) );
+      checkValue<T>( op + " trailing guard element", array[guard+size*spacing+i], T( 99 ) );
+   }
+
+   for( size_t i=0UL; i<size; ++i )
+      for( size_t j=valid; j<spacing; ++j )
+         checkValue<T>( op + " padding element", array[guard+i*spacing+j], ( padded )?( T() ):( T( 99 ) ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small random integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small random integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of an array surrounded by guard elements.
+//
+// \param size The number of elements of the array.
+// \param guard The number of leading and trailing guard elements.
+// \return Pointer to the first guard element.
+//
+// This function allocates an aligned array of \a size elements, which is surrounded by \a guard
+// leading and trailing guard elements. All elements of the array are initialized to 99.
+*/
+template< typename T >  // Element type
+T* OperationTest::allocate( size_t size, size_t guard )
+{
+   T* array( blaze::allocate<T>( size+2UL*guard ) );
+   std::fill( array, array+size+2UL*guard, T( 99 ) );
+   return array;
+}
+//*************************************************************************************************
+
+} // namespace custom
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running custom vector and matrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOM_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during custom vector and matrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
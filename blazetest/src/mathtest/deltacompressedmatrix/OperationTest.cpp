@@ -0,0 +1,493 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/deltacompressedmatrix/OperationTest.cpp
+//  \brief Source file for the quantized matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/deltacompressedmatrix/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace deltacompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+   : test_()      // Label of the currently performed test
+   , pool_( 3UL )  // The thread pool for the parallel multiplications
+{
+   testEncoding();
+   testDictionary();
+   testFailures();
+
+   for( size_t nonzeros=0UL; nonzeros<=37UL; nonzeros+=3UL ) {
+      testMatVecMult<float >( 40UL, 2000UL, nonzeros, 1UL, 5UL );
+      testMatVecMult<double>( 40UL, 2000UL, nonzeros, 1UL, 5UL );
+      testMatVecMult<int   >( 40UL, 2000UL, nonzeros, 1UL, 5UL );
+   }
+
+   const size_t maxDeltas[] = { 3UL, 255UL, 256UL, 4000UL, 65535UL, 65536UL, 100000UL };
+
+   for( size_t i=0UL; i<sizeof( maxDeltas )/sizeof( size_t ); ++i ) {
+      testMatVecMult<float >( 101UL, 1000000UL, 21UL, maxDeltas[i], 5UL   );
+      testMatVecMult<float >( 101UL, 1000000UL, 21UL, maxDeltas[i], 257UL );
+      testMatVecMult<double>( 101UL, 1000000UL, 21UL, maxDeltas[i], 5UL   );
+      testMatVecMult<double>( 101UL, 1000000UL, 21UL, maxDeltas[i], 257UL );
+      testMatVecMult<int   >( 101UL, 1000000UL, 21UL, maxDeltas[i], 5UL   );
+   }
+
+   testMatVecMult<double>( 0UL, 0UL, 0UL, 1UL, 5UL );
+   testMatVecMult<double>( 5UL, 0UL, 0UL, 1UL, 5UL );
+   testMatVecMult<double>( 0UL, 5UL, 0UL, 1UL, 5UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the delta encoding of the column indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the choice of the delta width of each row, the base indices and the
+// element access of a delta compressed matrix created from both row-major and column-major
+// sparse matrices.
+*/
+void OperationTest::testEncoding()
+{
+   test_ = "Delta encoding of the column indices";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 5UL, 200000UL );
+   S(1UL,     3UL) = 1.0;
+   S(1UL,     4UL) = 2.0;
+   S(1UL,   258UL) = 3.0;
+   S(2UL,    10UL) = 4.0;
+   S(2UL,   310UL) = 5.0;
+   S(3UL,     7UL) = 6.0;
+   S(3UL, 70007UL) = 7.0;
+   S(3UL, 70008UL) = 8.0;
+   S(4UL,199999UL) = 9.0;
+
+   {
+      const blaze::DeltaCompressedMatrix<double> A( S );
+
+      checkValue<size_t>( "Number of rows", A.rows(), 5UL );
+      checkValue<size_t>( "Number of columns", A.columns(), 200000UL );
+      checkValue<size_t>( "Number of non-zeros", A.nonZeros(), 9UL );
+      checkValue<size_t>( "Number of non-zeros of the empty row", A.nonZeros( 0UL ), 0UL );
+      checkValue<size_t>( "Delta width of the empty row", A.width( 0UL ), 1UL );
+      checkValue<size_t>( "Delta width of the 8-bit row", A.width( 1UL ), 1UL );
+      checkValue<size_t>( "Delta width of the 16-bit row", A.width( 2UL ), 2UL );
+      checkValue<size_t>( "Delta width of the 32-bit row", A.width( 3UL ), 4UL );
+      checkValue<size_t>( "Delta width of the single element row", A.width( 4UL ), 1UL );
+      checkValue<size_t>( "Base index", A.base( 3UL ), 7UL );
+      checkValue<size_t>( "Base index", A.base( 4UL ), 199999UL );
+      checkValue<size_t>( "First delta", A.delta( 3UL, 0UL ), 0UL );
+      checkValue<size_t>( "Second delta", A.delta( 3UL, 1UL ), 70000UL );
+      checkValue<size_t>( "Dictionary size", A.dictionarySize(), 9UL );
+      checkValue<double>( "Element access", A(1UL,258UL), 3.0 );
+      checkValue<double>( "Element access", A(3UL,70008UL), 8.0 );
+      checkValue<double>( "Element access", A(3UL,70000UL), 0.0 );
+      checkValue<double>( "Element access", A(0UL,3UL), 0.0 );
+      checkMatrix( A, S );
+   }
+
+   {
+      const blaze::CompressedMatrix<double,blaze::columnMajor> T( S );
+      const blaze::DeltaCompressedMatrix<double> A( T, false );
+
+      checkValue<size_t>( "Dictionary size", A.dictionarySize(), 0UL );
+      checkValue<size_t>( "Delta width of the 32-bit row", A.width( 3UL ), 4UL );
+      checkMatrix( A, S );
+
+      blaze::DeltaCompressedMatrix<double> B( A );
+      checkMatrix( B, S );
+
+      B.clear();
+      checkValue<size_t>( "Number of rows", B.rows(), 0UL );
+      checkValue<size_t>( "Number of non-zeros", B.nonZeros(), 0UL );
+
+      B = A;
+      checkMatrix( B, S );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the value dictionary.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a value dictionary is used for matrices with at most 256 distinct
+// values and that it is not used for matrices with more than 256 distinct values or NaN values.
+*/
+void OperationTest::testDictionary()
+{
+   test_ = "Value dictionary";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 3UL, 300UL );
+
+   for( size_t j=0UL; j<256UL; ++j ) {
+      S(0UL,j) = double( j ) - 127.5;
+      S(1UL,j) = double( 255UL - j ) - 127.5;
+   }
+
+   {
+      const blaze::DeltaCompressedMatrix<double> A( S );
+      checkValue<size_t>( "Dictionary size", A.dictionarySize(), 256UL );
+      checkMatrix( A, S );
+   }
+
+   S(2UL,299UL) = 1000.0;
+
+   {
+      const blaze::DeltaCompressedMatrix<double> A( S );
+      checkValue<size_t>( "Dictionary size", A.dictionarySize(), 0UL );
+      checkMatrix( A, S );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::rowMajor> T( 2UL, 2UL );
+      T(0UL,0UL) = 1.0F;
+      T(1UL,1UL) = std::numeric_limits<float>::quiet_NaN();
+
+      const blaze::DeltaCompressedMatrix<float> A( T );
+      checkValue<size_t>( "Dictionary size", A.dictionarySize(), 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing delta compressed operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the compression of a matrix with too many columns and the multiplication
+// with a vector of invalid size. In case no error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testFailures()
+{
+   test_ = "Delta compressed failures";
+
+   try {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> S( 2UL, 2147483648UL );
+      const blaze::DeltaCompressedMatrix<double> A( S );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Compression of a matrix with too many columns succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> S( 4UL, 5UL );
+      const blaze::DeltaCompressedMatrix<double> A( S );
+      const blaze::DynamicVector<double,blaze::columnVector> x( 4UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> y( A * x );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with a vector of invalid size succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the delta compressed matrix/vector multiplication.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The maximum number of non-zero elements per row.
+// \param maxDelta The maximum difference between the column indices of consecutive elements.
+// \param values The number of distinct values of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of the serial and the parallel multiplication of a delta
+// compressed matrix, both with and without value dictionary, with the result of the according
+// multiplication of a CompressedMatrix. Additionally, the multiplication is tested with aliasing
+// right-hand side and result vectors.
+*/
+template< typename T >  // Data type of the matrix
+void OperationTest::testMatVecMult( size_t m, size_t n, size_t nonzeros, size_t maxDelta,
+                                    size_t values )
+{
+   std::ostringstream oss;
+   oss << "Delta compressed multiplication of a " << m << "x" << n << " matrix with up to "
+       << nonzeros << " non-zeros per row, deltas up to " << maxDelta << ", and " << values
+       << " distinct values";
+   test_ = oss.str();
+
+   blaze::CompressedMatrix<T,blaze::rowMajor> S( m, n );
+   randomize( S, nonzeros, maxDelta, values );
+
+   blaze::DynamicVector<T,blaze::columnVector> x( n );
+   for( size_t j=0UL; j<n; ++j )
+      x[j] = T( blaze::rand<int>( -8, 8 ) );
+
+   const blaze::DynamicVector<T,blaze::columnVector> expected( S * x );
+
+   const blaze::DeltaCompressedMatrix<T> A( S );
+   const blaze::DeltaCompressedMatrix<T> B( S, false );
+
+   if( values <= 256UL && S.nonZeros() > 0UL ) {
+      checkValue<bool>( "Use of the dictionary", A.dictionarySize() > 0UL, true );
+   }
+   checkMatrix( A, S );
+   checkMatrix( B, S );
+
+   blaze::DynamicVector<T,blaze::columnVector> y;
+
+   checkVector( "Multiplication with dictionary", A * x, expected );
+   checkVector( "Multiplication without dictionary", B * x, expected );
+
+   multiply( pool_, y, A, x );
+   checkVector( "Parallel multiplication with dictionary", y, expected );
+
+   multiply( pool_, y, B, x );
+   checkVector( "Parallel multiplication without dictionary", y, expected );
+
+   if( m == n ) {
+      y = x;
+      multiply( y, A, y );
+      checkVector( "Aliased multiplication", y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single result value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   typedef typename VT2::ElementType  ET;
+
+   checkValue<size_t>( op + " (vector size)", result.size(), expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<ET>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of a delta compressed matrix.
+//
+// \param A The delta compressed matrix.
+// \param expected The expected compressed matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Data type of the matrix
+void OperationTest::checkMatrix( const blaze::DeltaCompressedMatrix<T>& A,
+                                 const blaze::CompressedMatrix<T,blaze::rowMajor>& expected ) const
+{
+   if( decompress( A ) != expected || A.nonZeros() != expected.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect delta compressed matrix\n"
+          << " Details:\n"
+          << "   Number of non-zeros = " << A.nonZeros() << "\n"
+          << "   Expected matrix:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a row-major sparse matrix with random small integral values.
+//
+// \param A The sparse matrix to be initialized.
+// \param nonzeros The maximum number of non-zero elements per row.
+// \param maxDelta The maximum difference between the column indices of consecutive elements.
+// \param values The number of distinct values.
+// \return void
+//
+// Each row receives a random number of up to \a nonzeros elements, whose column indices
+// differ by a random value in the range \f$ [1..maxDelta] \f$.
+*/
+template< typename T >  // Data type of the matrix
+void OperationTest::randomize( blaze::CompressedMatrix<T,blaze::rowMajor>& A, size_t nonzeros,
+                               size_t maxDelta, size_t values )
+{
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+
+   A.reset();
+   A.reserve( m*nonzeros );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t count( blaze::rand<size_t>( 0UL, nonzeros ) );
+      size_t j( blaze::rand<size_t>( 0UL, n/2UL ) );
+
+      for( size_t k=0UL; k<count && j<n; ++k ) {
+         A.append( i, j, T( int( blaze::rand<size_t>( 0UL, values-1UL ) ) - int( values/2UL ) ) );
+         j += ( k == 0UL )?( maxDelta ):( blaze::rand<size_t>( 1UL, maxDelta ) );
+      }
+
+      A.finalize( i );
+   }
+}
+//*************************************************************************************************
+
+} // namespace deltacompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DeltaCompressedMatrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_DELTACOMPRESSEDMATRIX_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DeltaCompressedMatrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,418 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/fusion/OperationTest.cpp
+//  \brief Source file for the element-wise epilogue operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/fusion/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fusion {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 2047UL, 2048UL, 2049UL, 4097UL, 9001UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(sizes[0]); ++i ) {
+      for( size_t k=1UL; k<=33UL; k+=16UL ) {
+         testVectorFusion<blaze::rowMajor>   ( sizes[i], k );
+         testVectorFusion<blaze::columnMajor>( sizes[i], k );
+      }
+   }
+
+   testMatrixFusion<blaze::rowMajor,blaze::rowMajor>      (   0UL,   0UL, 3UL );
+   testMatrixFusion<blaze::rowMajor,blaze::rowMajor>      ( 128UL, 128UL, 5UL );
+   testMatrixFusion<blaze::rowMajor,blaze::rowMajor>      ( 129UL, 130UL, 7UL );
+   testMatrixFusion<blaze::rowMajor,blaze::columnMajor>   ( 300UL,  70UL, 9UL );
+   testMatrixFusion<blaze::columnMajor,blaze::rowMajor>   (  70UL, 300UL, 9UL );
+   testMatrixFusion<blaze::columnMajor,blaze::columnMajor>( 257UL, 263UL, 3UL );
+   testMatrixFusion<blaze::rowMajor,blaze::rowMajor>      ( 257UL, 263UL, 3UL );
+   testMatrixFusion<blaze::columnMajor,blaze::columnMajor>( 129UL, 130UL, 7UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of dense matrix/dense vector multiplication expressions.
+//
+// \param n The number of rows of the matrix.
+// \param k The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment and subtraction assignment of
+// expressions that combine a dense matrix/dense vector multiplication with element-wise
+// operations (additions, subtractions, scalings and the rectified linear unit), including
+// expressions that alias the target vector and the assignment to a subvector.
+*/
+template< bool SO >  // Storage order of the matrix
+void OperationTest::testVectorFusion( size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Epilogue assignment with a " << n << "x" << k
+       << ( SO ? " column-major" : " row-major" ) << " matrix";
+   test_ = oss.str();
+
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   blaze::DynamicMatrix<double,SO> A( n, k );
+   VT x( k ), c( n ), y0( n );
+   randomize( A );
+   randomize( x );
+   randomize( c );
+   randomize( y0 );
+
+   VT t( n, 0.0 );
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         t[i] += A(i,j) * x[j];
+
+   VT y( n ), expected( n );
+
+   y = A * x + c;
+   for( size_t i=0UL; i<n; ++i ) expected[i] = t[i] + c[i];
+   checkVector( "Assignment of A*x+c", y, expected );
+
+   y = 2.0 * ( A * x ) - c;
+   for( size_t i=0UL; i<n; ++i ) expected[i] = 2.0*t[i] - c[i];
+   checkVector( "Assignment of 2*A*x-c", y, expected );
+
+   y = relu( A * x + c );
+   for( size_t i=0UL; i<n; ++i ) expected[i] = blaze::max( t[i] + c[i], 0.0 );
+   checkVector( "Assignment of relu(A*x+c)", y, expected );
+
+   y = 2.0 * ( A * x + c );
+   for( size_t i=0UL; i<n; ++i ) expected[i] = 2.0*( t[i] + c[i] );
+   checkVector( "Assignment of 2*(A*x+c)", y, expected );
+
+   y = y0;
+   y = 2.0 * ( A * x ) + 3.0 * y + c;
+   for( size_t i=0UL; i<n; ++i ) expected[i] = 2.0*t[i] + 3.0*y0[i] + c[i];
+   checkVector( "Aliased assignment of 2*A*x+3*y+c", y, expected );
+
+   y = y0;
+   y += A * x + c;
+   for( size_t i=0UL; i<n; ++i ) expected[i] = y0[i] + t[i] + c[i];
+   checkVector( "Addition assignment of A*x+c", y, expected );
+
+   y = y0;
+   y -= A * x - c;
+   for( size_t i=0UL; i<n; ++i ) expected[i] = y0[i] - t[i] + c[i];
+   checkVector( "Subtraction assignment of A*x-c", y, expected );
+
+   y = y0;
+   y += relu( A * x - c );
+   for( size_t i=0UL; i<n; ++i ) expected[i] = y0[i] + blaze::max( t[i] - c[i], 0.0 );
+   checkVector( "Addition assignment of relu(A*x-c)", y, expected );
+
+   y = y0;
+   y -= 2.0 * ( A * x + c );
+   for( size_t i=0UL; i<n; ++i ) expected[i] = y0[i] - 2.0*( t[i] + c[i] );
+   checkVector( "Subtraction assignment of 2*(A*x+c)", y, expected );
+
+   if( n > 1UL ) {
+      y = y0;
+      blaze::subvector( y, 1UL, n-1UL ) = blaze::submatrix( A, 1UL, 0UL, n-1UL, k ) * x
+                                        + blaze::subvector( c, 1UL, n-1UL );
+      expected[0] = y0[0];
+      for( size_t i=1UL; i<n; ++i ) expected[i] = t[i] + c[i];
+      checkVector( "Subvector assignment of A*x+c", y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assignment of dense matrix/dense matrix multiplication expressions.
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment and subtraction assignment of
+// expressions that combine a dense matrix/dense matrix multiplication with element-wise
+// operations (additions, subtractions, scalings and the rectified linear unit), including
+// expressions that alias the target matrix.
+*/
+template< bool SO1    // Storage order of the left-hand side matrix
+        , bool SO2 >  // Storage order of the right-hand side matrix
+void OperationTest::testMatrixFusion( size_t m, size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Epilogue assignment with a " << m << "x" << k
+       << ( SO1 ? " column-major" : " row-major" ) << " and a " << k << "x" << n
+       << ( SO2 ? " column-major" : " row-major" ) << " matrix";
+   test_ = oss.str();
+
+   typedef blaze::DynamicMatrix<double,SO1>  MT;
+
+   blaze::DynamicMatrix<double,SO1> A( m, k );
+   blaze::DynamicMatrix<double,SO2> B( k, n );
+   MT D( m, n ), C0( m, n );
+   randomize( A );
+   randomize( B );
+   randomize( D );
+   randomize( C0 );
+
+   MT P( m, n, 0.0 );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         for( size_t l=0UL; l<k; ++l )
+            P(i,j) += A(i,l) * B(l,j);
+
+   MT C( m, n ), expected( m, n );
+
+   C = A * B + D;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = P(i,j) + D(i,j);
+   checkMatrix( "Assignment of A*B+D", C, expected );
+
+   C = relu( A * B - D );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = blaze::max( P(i,j) - D(i,j), 0.0 );
+   checkMatrix( "Assignment of relu(A*B-D)", C, expected );
+
+   C = 2.0 * ( A * B + D );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = 2.0*( P(i,j) + D(i,j) );
+   checkMatrix( "Assignment of 2*(A*B+D)", C, expected );
+
+   C = C0;
+   C = 2.0 * ( A * B ) + 3.0 * C + D;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = 2.0*P(i,j) + 3.0*C0(i,j) + D(i,j);
+   checkMatrix( "Aliased assignment of 2*A*B+3*C+D", C, expected );
+
+   C = C0;
+   C += A * B - D;
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = C0(i,j) + P(i,j) - D(i,j);
+   checkMatrix( "Addition assignment of A*B-D", C, expected );
+
+   C = C0;
+   C -= relu( A * B + D );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = C0(i,j) - blaze::max( P(i,j) + D(i,j), 0.0 );
+   checkMatrix( "Subtraction assignment of relu(A*B+D)", C, expected );
+
+   C = C0;
+   C += 2.0 * ( A * B - D );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(i,j) = C0(i,j) + 2.0*( P(i,j) - D(i,j) );
+   checkMatrix( "Addition assignment of 2*(A*B-D)", C, expected );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( result[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect " << op << " result at index " << i << "\n"
+             << " Details:\n"
+             << "   Result   = " << result[i] << "\n"
+             << "   Expected = " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( result(i,j) != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect " << op << " result at (" << i << "," << j << ")\n"
+                << " Details:\n"
+                << "   Result   = " << result(i,j) << "\n"
+                << "   Expected = " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = blaze::rand<int>( -10, 10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = blaze::rand<int>( -10, 10 );
+}
+//*************************************************************************************************
+
+} // namespace fusion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running element-wise epilogue operation test..." << std::endl;
+
+   try
+   {
+      RUN_FUSION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during element-wise epilogue operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
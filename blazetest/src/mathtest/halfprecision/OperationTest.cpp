@@ -0,0 +1,530 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/halfprecision/OperationTest.cpp
+//  \brief Source file for the half precision operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blaze/math/Serialization.h>
+#include <blazetest/mathtest/halfprecision/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace halfprecision {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testFloat16Conversion();
+   testBFloat16Conversion();
+
+   for( size_t m=0UL; m<=19UL; ++m ) {
+      for( size_t n=0UL; n<=19UL; ++n ) {
+         testStorage<blaze::float16,blaze::rowMajor>    ( m, n );
+         testStorage<blaze::float16,blaze::columnMajor> ( m, n );
+         testStorage<blaze::bfloat16,blaze::rowMajor>   ( m, n );
+         testStorage<blaze::bfloat16,blaze::columnMajor>( m, n );
+      }
+   }
+
+   for( size_t m=0UL; m<=13UL; ++m ) {
+      for( size_t n=0UL; n<=37UL; n+=3UL ) {
+         for( size_t k=0UL; k<=7UL; ++k ) {
+            testMultiplication<blaze::float16>( m, n, k );
+            testMultiplication<blaze::bfloat16>( m, n, k );
+         }
+      }
+   }
+
+   testSerialization<blaze::float16>();
+   testSerialization<blaze::bfloat16>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between single and half precision values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rounding of single precision values to half precision values,
+// including the rounding of ties, the overflow to infinity and subnormal values.
+*/
+void OperationTest::testFloat16Conversion()
+{
+   test_ = "float16 conversion";
+
+   const float inf( std::numeric_limits<float>::infinity() );
+
+   checkConversion<blaze::float16>(  0.0F          ,  0.0F           );
+   checkConversion<blaze::float16>(  1.0F          ,  1.0F           );
+   checkConversion<blaze::float16>( -2.5F          , -2.5F           );
+   checkConversion<blaze::float16>(  65504.0F      ,  65504.0F       );
+   checkConversion<blaze::float16>(  65519.0F      ,  65504.0F       );
+   checkConversion<blaze::float16>(  65520.0F      ,  inf            );
+   checkConversion<blaze::float16>( -1.0E10F       , -inf            );
+   checkConversion<blaze::float16>(  1.00048828F   ,  1.0F           );  // 1+2^-11 (tie to even)
+   checkConversion<blaze::float16>(  1.00146484F   ,  1.00195312F    );  // 1+3*2^-11 (tie to even)
+   checkConversion<blaze::float16>(  5.96046448E-8F,  5.96046448E-8F );  // 2^-24
+   checkConversion<blaze::float16>(  2.98023224E-8F,  0.0F           );  // 2^-25 (tie to even)
+   checkConversion<blaze::float16>(  6.10351562E-5F,  6.10351562E-5F );  // 2^-14
+
+   const blaze::float16 nan( std::numeric_limits<float>::quiet_NaN() );
+   if( static_cast<float>( nan ) == static_cast<float>( nan ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Conversion of NaN failed\n"
+          << " Details:\n"
+          << "   Result = " << nan << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between single precision and bfloat16 values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rounding of single precision values to bfloat16 values, including
+// the rounding of ties.
+*/
+void OperationTest::testBFloat16Conversion()
+{
+   test_ = "bfloat16 conversion";
+
+   checkConversion<blaze::bfloat16>(  0.0F       ,  0.0F      );
+   checkConversion<blaze::bfloat16>(  1.0F       ,  1.0F      );
+   checkConversion<blaze::bfloat16>( -2.5F       , -2.5F      );
+   checkConversion<blaze::bfloat16>(  1.0E5F     ,  99840.0F  );
+   checkConversion<blaze::bfloat16>(  1.00390625F,  1.0F      );  // 1+2^-8 (tie to even)
+   checkConversion<blaze::bfloat16>(  1.01171875F,  1.015625F );  // 1+3*2^-8 (tie to even)
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the storage of 16-bit floating point values in vectors and matrices.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of single precision values to dense and sparse vectors
+// and matrices with element type \a T, the copy of these vectors and matrices, and the sparse
+// matrix/dense vector multiplication with 16-bit matrix elements.
+*/
+template< typename T  // Element type of the vectors and matrices
+        , bool SO >   // Storage order of the matrices
+void OperationTest::testStorage( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Storage of a " << m << "x" << n
+       << ( SO ? " column-major" : " row-major" ) << " matrix";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<float,SO> ref( m, n, 0.0F );
+   blaze::DynamicVector<float,blaze::columnVector> x( n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         if( blaze::rand<int>( 0, 2 ) == 0 )
+            ref(i,j) = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+   for( size_t j=0UL; j<n; ++j )
+      x[j] = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+
+   // Dense vector storage
+   {
+      const blaze::DynamicVector<T,blaze::columnVector> a( x );
+      const blaze::DynamicVector<T,blaze::columnVector> b( a );
+      checkVector( "Dense vector assignment", a, x );
+      checkVector( "Dense vector copy", b, x );
+   }
+
+   // Dense matrix storage
+   {
+      const blaze::DynamicMatrix<T,SO> A( ref );
+      const blaze::DynamicMatrix<T,SO> B( A );
+      checkMatrix( "Dense matrix assignment", A, ref );
+      checkMatrix( "Dense matrix copy", B, ref );
+   }
+
+   // Sparse matrix storage
+   {
+      const blaze::CompressedMatrix<T,SO> A( ref );
+      checkMatrix( "Sparse matrix assignment", A, ref );
+
+      const blaze::DynamicVector<float,blaze::columnVector> y( A * x );
+      const blaze::DynamicVector<float,blaze::columnVector> expected( ref * x );
+      checkVector( "Sparse matrix/dense vector multiplication", y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of 16-bit floating point matrices.
+//
+// \param m The number of rows of the left-hand side matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, the addition assignment and the subtraction assignment
+// of the product of two dense matrices with element type \a T to a single precision matrix,
+// the assignment of the product to a column-major and to a double precision matrix, as well as
+// the product of a matrix with element type \a T and a single precision matrix.
+*/
+template< typename T >  // Element type of the matrices
+void OperationTest::testMultiplication( size_t m, size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Multiplication of a " << m << "x" << k << " and a " << k << "x" << n << " matrix";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> lhs( m, k ), rhs( k, n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<k; ++j )
+         lhs(i,j) = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+   for( size_t i=0UL; i<k; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         rhs(i,j) = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+
+   const blaze::DynamicMatrix<T,blaze::rowMajor> A( lhs );
+   const blaze::DynamicMatrix<T,blaze::rowMajor> B( rhs );
+   const blaze::DynamicMatrix<float,blaze::rowMajor> ref( lhs * rhs );
+
+   // Row-major dense matrix/dense matrix multiplication
+   {
+      blaze::DynamicMatrix<float,blaze::rowMajor> C( A * B );
+      checkMatrix( "Dense matrix/dense matrix multiplication", C, ref );
+
+      C += A * B;
+      checkMatrix( "Dense matrix/dense matrix multiplication with addition assignment",
+                   C, 2.0F*ref );
+
+      C -= A * B;
+      checkMatrix( "Dense matrix/dense matrix multiplication with subtraction assignment", C, ref );
+   }
+
+   // Column-major target matrix
+   {
+      const blaze::DynamicMatrix<float,blaze::columnMajor> C( A * B );
+      checkMatrix( "Dense matrix/dense matrix multiplication", C, ref );
+   }
+
+   // Double precision target matrix
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> C( A * B );
+      checkMatrix( "Dense matrix/dense matrix multiplication", C, ref );
+   }
+
+   // Mixed single and half precision operands
+   {
+      const blaze::DynamicMatrix<float,blaze::rowMajor> C( lhs * B );
+      checkMatrix( "Single precision/16-bit dense matrix multiplication", C, ref );
+
+      const blaze::DynamicMatrix<float,blaze::rowMajor> D( A * rhs );
+      checkMatrix( "16-bit/single precision dense matrix multiplication", D, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of 16-bit floating point vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the serialization and deserialization of dense and sparse vectors and
+// matrices with element type \a T. Additionally it tests that a serialized matrix cannot be
+// reconstituted as a matrix with a different 16-bit element type.
+*/
+template< typename T >  // Element type of the vectors and matrices
+void OperationTest::testSerialization()
+{
+   test_ = "Serialization";
+
+   blaze::DynamicMatrix<float,blaze::rowMajor> ref( 7UL, 13UL, 0.0F );
+   for( size_t i=0UL; i<ref.rows(); ++i )
+      for( size_t j=0UL; j<ref.columns(); ++j )
+         if( blaze::rand<int>( 0, 2 ) == 0 )
+            ref(i,j) = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+
+   blaze::DynamicVector<float,blaze::rowVector> vref( 17UL );
+   for( size_t i=0UL; i<vref.size(); ++i )
+      vref[i] = static_cast<float>( blaze::rand<int>( -10, 10 ) );
+
+   {
+      const blaze::DynamicVector<T,blaze::rowVector> src( vref );
+      blaze::DynamicVector<T,blaze::rowVector> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      archive >> dst;
+
+      checkVector( "Dense vector serialization", dst, vref );
+   }
+
+   {
+      const blaze::DynamicMatrix<T,blaze::rowMajor> src( ref );
+      blaze::DynamicMatrix<T,blaze::rowMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      archive >> dst;
+
+      checkMatrix( "Dense matrix serialization", dst, ref );
+   }
+
+   {
+      const blaze::CompressedMatrix<T,blaze::columnMajor> src( ref );
+      blaze::CompressedMatrix<T,blaze::columnMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      archive >> dst;
+
+      checkMatrix( "Sparse matrix serialization", dst, ref );
+   }
+
+   try {
+      const blaze::DynamicMatrix<blaze::float16,blaze::rowMajor> src( ref );
+      blaze::DynamicMatrix<blaze::bfloat16,blaze::rowMajor> dst;
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Type difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Type difference succeeded" ) != std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the rounding of a single precision value.
+//
+// \param value The single precision value to be converted.
+// \param expected The expected value after the conversion to the 16-bit data type \a T.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // The 16-bit floating point data type
+void OperationTest::checkConversion( float value, float expected ) const
+{
+   const T result( value );
+
+   if( static_cast<float>( result ) != expected ) {
+      std::ostringstream oss;
+      oss.precision( 10 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect conversion result\n"
+          << " Details:\n"
+          << "   Value    = " << value << "\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   if( result.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid " << op << " result size\n"
+          << " Details:\n"
+          << "   Result size   = " << result.size() << "\n"
+          << "   Expected size = " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( static_cast<float>( result[i] ) != static_cast<float>( expected[i] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect " << op << " result at index " << i << "\n"
+             << " Details:\n"
+             << "   Result   = " << result[i] << "\n"
+             << "   Expected = " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   if( result.rows() != expected.rows() || result.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid " << op << " result size\n"
+          << " Details:\n"
+          << "   Result   = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected = " << expected.rows() << "x" << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( static_cast<float>( result(i,j) ) != static_cast<float>( expected(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect " << op << " result at (" << i << "," << j << ")\n"
+                << " Details:\n"
+                << "   Result   = " << result(i,j) << "\n"
+                << "   Expected = " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace halfprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running half precision operation test..." << std::endl;
+
+   try
+   {
+      RUN_HALFPRECISION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during half precision operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
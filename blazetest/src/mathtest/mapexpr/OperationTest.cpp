@@ -0,0 +1,817 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mapexpr/OperationTest.cpp
+//  \brief Source file for the element-wise map expression operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/StaticAssert.h>
+#include <blazetest/mathtest/mapexpr/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mapexpr {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Custom, vectorizable square operation for the test of the map() function.
+*/
+struct Square
+{
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = blaze::IntrinsicTrait<T>::multiplication };
+   };
+
+   template< typename T >
+   inline T operator()( const T& a ) const { return a * a; }
+
+   template< typename T >
+   inline T load( const T& a ) const { return a * a; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Custom, non-vectorizable shift operation for the test of the map() function.
+*/
+struct Shift
+{
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = 0 };
+   };
+
+   template< typename T >
+   inline T operator()( const T& a ) const { return a + T(1); }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   for( size_t n=0UL; n<=35UL; ++n ) {
+      testDenseVector<float> ( n );
+      testDenseVector<double>( n );
+   }
+
+   testDenseMatrix<float> (  5UL,  7UL );
+   testDenseMatrix<float> ( 16UL,  3UL );
+   testDenseMatrix<double>(  5UL,  7UL );
+   testDenseMatrix<double>( 16UL,  3UL );
+
+   testSparseVector<float> ( 27UL );
+   testSparseVector<double>( 27UL );
+
+   testSparseMatrix<float> ( 9UL, 13UL );
+   testSparseMatrix<double>( 9UL, 13UL );
+
+   testSpecialValues<float> ();
+   testSpecialValues<double>();
+
+   testViews();
+   testCustomOperation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations on dense vectors.
+//
+// \param n The size of the dense vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all element-wise operations on dense vectors of size \a n. Since the size
+// is varied, both the vectorized kernels and the scalar remainder loops are tested. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense vectors
+void OperationTest::testDenseVector( size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   test_ = "Dense vector map operations";
+
+   VT a( n ), b( n ), c( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = rand<T>( T(0.1), T(4) );
+      b[i] = rand<T>( T(-6), T(6) );
+   }
+
+   c = sqrt( a );
+   checkVector( "sqrt()", c, apply( a, blaze::Sqrt() ) );
+
+   c = exp( b );
+   checkVector( "exp()", c, apply( b, blaze::Exp() ) );
+
+   c = log( a );
+   checkVector( "log()", c, apply( a, blaze::Log() ) );
+
+   c = sin( b );
+   checkVector( "sin()", c, apply( b, blaze::Sin() ) );
+
+   c = cos( b );
+   checkVector( "cos()", c, apply( b, blaze::Cos() ) );
+
+   c = tanh( b );
+   checkVector( "tanh()", c, apply( b, blaze::Tanh() ) );
+
+   c = pow( a, T(2.5) );
+   checkVector( "pow( a, 2.5 )", c, apply( a, blaze::Pow<T>( T(2.5) ) ) );
+
+   c = pow( b, 3 );
+   checkVector( "pow( b, 3 )", c, apply( b, blaze::Pow<T>( T(3) ) ) );
+
+   c = pow( a, -2 );
+   checkVector( "pow( a, -2 )", c, apply( a, blaze::Pow<T>( T(-2) ) ) );
+
+   c = map( b, blaze::Tanh() );
+   checkVector( "map( b, Tanh() )", c, apply( b, blaze::Tanh() ) );
+
+   c = a;
+   c += sqrt( a );
+   checkVector( "sqrt() addition assignment", c, VT( a + apply( a, blaze::Sqrt() ) ) );
+
+   c = a;
+   c -= exp( b );
+   checkVector( "exp() subtraction assignment", c, VT( a - apply( b, blaze::Exp() ) ) );
+
+   c = a;
+   c *= cos( b );
+   checkVector( "cos() multiplication assignment", c, VT( a * apply( b, blaze::Cos() ) ) );
+
+   c = sqrt( a + b * b );
+   checkVector( "sqrt() of a compound expression", c, apply( VT( a + b * b ), blaze::Sqrt() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations on dense matrices.
+//
+// \param m The number of rows of the dense matrices.
+// \param n The number of columns of the dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element-wise operations on row-major and column-major dense matrices
+// of size \f$ m \times n \f$. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename T >  // Element type of the dense matrices
+void OperationTest::testDenseMatrix( size_t m, size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     MT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  TMT;
+
+   test_ = "Dense matrix map operations";
+
+   MT  a( m, n );
+   TMT b( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         a(i,j) = rand<T>( T(0.1), T(4) );
+         b(i,j) = rand<T>( T(-6), T(6) );
+      }
+   }
+
+   // Row-major results
+   {
+      MT c;
+
+      c = sqrt( a );
+      checkMatrix( "sqrt()", c, apply( a, blaze::Sqrt() ) );
+
+      c = log( a );
+      checkMatrix( "log()", c, apply( a, blaze::Log() ) );
+
+      c = exp( b );
+      checkMatrix( "exp() (column-major operand)", c, apply( MT( b ), blaze::Exp() ) );
+
+      c = pow( a, T(0.75) );
+      checkMatrix( "pow( a, 0.75 )", c, apply( a, blaze::Pow<T>( T(0.75) ) ) );
+
+      c = a;
+      c += sin( a );
+      checkMatrix( "sin() addition assignment", c, MT( a + apply( a, blaze::Sin() ) ) );
+   }
+
+   // Column-major results
+   {
+      TMT c;
+
+      c = sin( b );
+      checkMatrix( "sin()", c, apply( b, blaze::Sin() ) );
+
+      c = cos( b );
+      checkMatrix( "cos()", c, apply( b, blaze::Cos() ) );
+
+      c = tanh( a );
+      checkMatrix( "tanh() (row-major operand)", c, apply( TMT( a ), blaze::Tanh() ) );
+
+      c = map( b, blaze::Tanh() );
+      checkMatrix( "map( b, Tanh() )", c, apply( b, blaze::Tanh() ) );
+
+      c = b;
+      c -= exp( b );
+      checkMatrix( "exp() subtraction assignment", c, TMT( b - apply( b, blaze::Exp() ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations on sparse vectors.
+//
+// \param n The size of the sparse vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the zero-preserving element-wise operations on sparse vectors of size
+// \a n. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the sparse vectors
+void OperationTest::testSparseVector( size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::CompressedVector<T,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>     DVT;
+
+   test_ = "Sparse vector map operations";
+
+   VT a( n ), c;
+
+   for( size_t i=0UL; i<n; i+=3UL ) {
+      a[i] = rand<T>( T(0.1), T(4) );
+   }
+
+   c = sqrt( a );
+   checkVector( "sqrt()", c, apply( DVT( a ), blaze::Sqrt() ) );
+
+   c = sin( a );
+   checkVector( "sin()", c, apply( DVT( a ), blaze::Sin() ) );
+
+   c = tanh( a );
+   checkVector( "tanh()", c, apply( DVT( a ), blaze::Tanh() ) );
+
+   c = pow( a, T(1.5) );
+   checkVector( "pow( a, 1.5 )", c, apply( DVT( a ), blaze::Pow<T>( T(1.5) ) ) );
+
+   if( c.nonZeros() != a.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros = " << c.nonZeros() << "\n"
+          << "   Expected number     = " << a.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      c = pow( a, T(0) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: pow() with non-positive exponent succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << c << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations on sparse matrices.
+//
+// \param m The number of rows of the sparse matrices.
+// \param n The number of columns of the sparse matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the zero-preserving element-wise operations on row-major and column-major
+// sparse matrices of size \f$ m \times n \f$. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the sparse matrices
+void OperationTest::testSparseMatrix( size_t m, size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::CompressedMatrix<T,blaze::rowMajor>     MT;
+   typedef blaze::CompressedMatrix<T,blaze::columnMajor>  TMT;
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>        DMT;
+
+   test_ = "Sparse matrix map operations";
+
+   MT a( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=i%2UL; j<n; j+=2UL ) {
+         a(i,j) = rand<T>( T(0.1), T(4) );
+      }
+   }
+
+   const TMT b( a );
+
+   MT  c;
+   TMT d;
+
+   c = sqrt( a );
+   checkMatrix( "sqrt()", c, apply( DMT( a ), blaze::Sqrt() ) );
+
+   c = sin( b );
+   checkMatrix( "sin() (column-major operand)", c, apply( DMT( a ), blaze::Sin() ) );
+
+   d = tanh( b );
+   checkMatrix( "tanh()", d, apply( DMT( a ), blaze::Tanh() ) );
+
+   d = pow( a, T(2.5) );
+   checkMatrix( "pow( a, 2.5 )", d, apply( DMT( a ), blaze::Pow<T>( T(2.5) ) ) );
+
+   try {
+      c = pow( a, T(-1) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: pow() with non-positive exponent succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << c << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations for special floating point values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element-wise operations for zeros, infinities, NaN, denormal values
+// and arguments that cause an overflow or underflow. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense vectors
+void OperationTest::testSpecialValues()
+{
+   typedef std::numeric_limits<T>  Limits;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   test_ = "Map operations for special values";
+
+   VT a( 12UL ), c;
+
+   a[ 0] =  T(0);
+   a[ 1] = -T(0);
+   a[ 2] =  Limits::infinity();
+   a[ 3] = -Limits::infinity();
+   a[ 4] =  Limits::quiet_NaN();
+   a[ 5] =  Limits::denorm_min();
+   a[ 6] =  Limits::min();
+   a[ 7] =  Limits::max();
+   a[ 8] =  T(1000);
+   a[ 9] = -T(1000);
+   a[10] = -T(1);
+   a[11] =  T(1);
+
+   c = sqrt( a );
+   checkVector( "sqrt()", c, apply( a, blaze::Sqrt() ) );
+
+   c = exp( a );
+   checkVector( "exp()", c, apply( a, blaze::Exp() ) );
+
+   c = log( a );
+   checkVector( "log()", c, apply( a, blaze::Log() ) );
+
+   c = tanh( a );
+   checkVector( "tanh()", c, apply( a, blaze::Tanh() ) );
+
+   c = pow( a, T(2.5) );
+   checkVector( "pow( a, 2.5 )", c, apply( a, blaze::Pow<T>( T(2.5) ) ) );
+
+   c = pow( a, 3 );
+   checkVector( "pow( a, 3 )", c, apply( a, blaze::Pow<T>( T(3) ) ) );
+
+   c = pow( a, -1 );
+   checkVector( "pow( a, -1 )", c, apply( a, blaze::Pow<T>( T(-1) ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise operations in combination with views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the restructuring of views on element-wise operations (as for instance
+// subvector( sqrt( a ) ) to sqrt( subvector( a ) )). In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testViews()
+{
+   using blaze::columnVector;
+   using blaze::rand;
+   using blaze::rowVector;
+
+   typedef blaze::DynamicVector<double,columnVector>  VT;
+   typedef blaze::DynamicVector<double,rowVector>     TVT;
+   typedef blaze::DynamicMatrix<double>               MT;
+   typedef blaze::CompressedMatrix<double>            SMT;
+   typedef blaze::CompressedVector<double,rowVector>  STVT;
+
+   test_ = "Map operations on views";
+
+   VT a( 21UL );
+   MT A( 8UL, 10UL );
+   SMT S( 8UL, 10UL );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      a[i] = rand<double>( 0.1, 4.0 );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = rand<double>( 0.1, 4.0 );
+      }
+      S(i,(i*3UL)%S.columns()) = rand<double>( 0.1, 4.0 );
+   }
+
+   {
+      VT c( subvector( sqrt( a ), 3UL, 9UL ) );
+      checkVector( "subvector( sqrt() )", c,
+                   apply( VT( subvector( a, 3UL, 9UL ) ), blaze::Sqrt() ) );
+   }
+
+   {
+      TVT c( row( exp( A ), 2UL ) );
+      checkVector( "row( exp() )", c, apply( TVT( row( A, 2UL ) ), blaze::Exp() ) );
+   }
+
+   {
+      VT c( column( log( A ), 5UL ) );
+      checkVector( "column( log() )", c, apply( VT( column( A, 5UL ) ), blaze::Log() ) );
+   }
+
+   {
+      MT c( submatrix( pow( A, 1.5 ), 1UL, 2UL, 4UL, 5UL ) );
+      checkMatrix( "submatrix( pow() )", c,
+                   apply( MT( submatrix( A, 1UL, 2UL, 4UL, 5UL ) ), blaze::Pow<double>( 1.5 ) ) );
+   }
+
+   {
+      STVT c( row( sqrt( S ), 3UL ) );
+      checkVector( "row( sqrt() ) (sparse)", c, apply( TVT( row( S, 3UL ) ), blaze::Sqrt() ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the map() function with custom operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the map() function with a custom vectorizable and a custom scalar
+// operation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testCustomOperation()
+{
+   using blaze::rand;
+
+   typedef blaze::DynamicVector<double>     VT;
+   typedef blaze::DynamicMatrix<double>     MT;
+   typedef blaze::CompressedVector<double>  SVT;
+
+   test_ = "Map operations with custom operations";
+
+   VT  a( 19UL );
+   MT  A( 6UL, 9UL );
+   SVT s( 19UL );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      a[i] = rand<double>( -2.0, 2.0 );
+   }
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = rand<double>( -2.0, 2.0 );
+      }
+   }
+
+   s[3] = 1.5;
+   s[7] = -2.0;
+
+   BLAZE_STATIC_ASSERT( ( blaze::DVecMapExpr<VT,Shift,false>::vectorizable == 0 ) );
+
+   {
+      VT c( map( a, Square() ) );
+      checkVector( "map( a, Square() )", c, apply( a, Square() ) );
+   }
+
+   {
+      VT c( map( a, Shift() ) );
+      checkVector( "map( a, Shift() )", c, apply( a, Shift() ) );
+   }
+
+   {
+      MT c( map( A, Square() ) );
+      checkMatrix( "map( A, Square() )", c, apply( A, Square() ) );
+   }
+
+   {
+      SVT c( map( s, Square() ) );
+      checkVector( "map( s, Square() )", c, apply( VT( s ), Square() ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an element-wise operation with the expected result.
+//
+// \param op The label of the tested operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected result
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   if( result.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size of " << op << " result\n"
+          << " Details:\n"
+          << "   Size          = " << result.size() << "\n"
+          << "   Expected size = " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( !isClose( result[i], expected[i] ) ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << op << " failed at index " << i << "\n"
+             << " Details:\n"
+             << "   Size           = " << result.size() << "\n"
+             << "   Result         = " << result[i] << "\n"
+             << "   Expected value = " << expected[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an element-wise operation with the expected result.
+//
+// \param op The label of the tested operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected result
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   if( result.rows() != expected.rows() || result.columns() != expected.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size of " << op << " result\n"
+          << " Details:\n"
+          << "   Size          = " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected size = " << expected.rows() << "x" << expected.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         if( !isClose( result(i,j), expected(i,j) ) ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << op << " failed at index (" << i << "," << j << ")\n"
+                << " Details:\n"
+                << "   Size           = " << result.rows() << "x" << result.columns() << "\n"
+                << "   Result         = " << result(i,j) << "\n"
+                << "   Expected value = " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scalar reference implementation of an element-wise operation on a dense vector.
+//
+// \param v The dense input vector.
+// \param op The element-wise operation.
+// \return The result vector.
+*/
+template< typename T  // Element type of the vector
+        , bool TF     // Transpose flag of the vector
+        , typename OP >  // Type of the element-wise operation
+blaze::DynamicVector<T,TF> OperationTest::apply( const blaze::DynamicVector<T,TF>& v, OP op )
+{
+   blaze::DynamicVector<T,TF> result( v.size() );
+
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      result[i] = op( v[i] );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar reference implementation of an element-wise operation on a dense matrix.
+//
+// \param m The dense input matrix.
+// \param op The element-wise operation.
+// \return The result matrix.
+*/
+template< typename T  // Element type of the matrix
+        , bool SO     // Storage order of the matrix
+        , typename OP >  // Type of the element-wise operation
+blaze::DynamicMatrix<T,SO> OperationTest::apply( const blaze::DynamicMatrix<T,SO>& m, OP op )
+{
+   blaze::DynamicMatrix<T,SO> result( m.rows(), m.columns() );
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      for( size_t j=0UL; j<m.columns(); ++j ) {
+         result(i,j) = op( m(i,j) );
+      }
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Relative comparison of two floating point values.
+//
+// \param a The first value.
+// \param b The second (reference) value.
+// \return \a true if the two values are considered equal, \a false if not.
+//
+// Two values are considered equal if they differ by at most 64 epsilon relative to the larger
+// of 1 and the magnitude of the reference value. Two NaN values and infinities of the same sign
+// are considered equal.
+*/
+template< typename T >  // Type of the floating point values
+bool OperationTest::isClose( T a, T b )
+{
+   if( a != a || b != b )
+      return ( a != a && b != b );
+   if( a == b )
+      return true;
+
+   const T scale( std::max( std::abs( b ), T(1) ) );
+   return std::abs( a - b ) <= T(64) * std::numeric_limits<T>::epsilon() * scale;
+}
+//*************************************************************************************************
+
+} // namespace mapexpr
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running map expression operation test..." << std::endl;
+
+   try
+   {
+      RUN_MAPEXPR_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during map expression operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
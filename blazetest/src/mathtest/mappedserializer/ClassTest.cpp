@@ -0,0 +1,436 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedserializer/ClassTest.cpp
+//  \brief Source file for the MappedSerializer class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <blaze/math/serialization/MappedSerializer.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/mappedserializer/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedSerializer class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                                   // Label of the currently performed test
+   , filename_( "mappedserializer.blazemap" )  // The name of the temporary matrix file
+{
+   testEmptyMatrices();
+   testRandomMatrices();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedSerializer class test.
+//
+// The destructor removes the temporary matrix file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory-mapped loading test with empty matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs memory-mapped loading tests with empty matrices. In case an error is
+// detected, i.e. in case the mapped matrix is not empty, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testEmptyMatrices()
+{
+   test_ = "Empty matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src;
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> src( 0UL, 5UL );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src;
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 5UL, 0UL );
+      runSparseTest( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory-mapped loading test with randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs memory-mapped loading tests with randomly initialized matrices. In
+// case an error is detected, i.e. in case a matrix cannot be reconstituted from file, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRandomMatrices()
+{
+   test_ = "Randomly initialized matrices";
+
+
+   //=====================================================================================
+   // Row-major DynamicMatrix source
+   //=====================================================================================
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<float,blaze::rowMajor> src( 33UL, 17UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 13UL, 64UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::rowMajor> src( 13UL, 7UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+
+   //=====================================================================================
+   // Column-major DynamicMatrix source
+   //=====================================================================================
+
+   {
+      blaze::DynamicMatrix<int,blaze::columnMajor> src( 7UL, 13UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<float,blaze::columnMajor> src( 33UL, 17UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 64UL, 13UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      runDenseTest( src );
+   }
+
+
+   //=====================================================================================
+   // Row-major CompressedMatrix source
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::rowMajor> src( 33UL, 17UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 100UL, 50UL );
+      randomize( src, 250UL );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> src( 13UL, 7UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+
+
+   //=====================================================================================
+   // Column-major CompressedMatrix source
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 7UL, 13UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::columnMajor> src( 33UL, 17UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 50UL, 100UL );
+      randomize( src, 250UL );
+      runSparseTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      runSparseTest( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing memory-mapped loading attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with failing memory-mapped loading attempts. In case no error
+// is detected, i.e. in case the test is failing, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Loading failures";
+
+   try {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 4UL, 4UL );
+      randomize( src );
+      testSerialization( src );
+
+      blaze::MappedDenseMatrix<int,blaze::columnMajor> dst( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 4UL, 4UL );
+      randomize( src );
+      testSerialization( src );
+
+      blaze::MappedSparseMatrix<int,blaze::rowMajor> dst( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix type difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 5UL, 4UL );
+      randomize( src );
+      testSerialization( src );
+
+      blaze::MappedDenseMatrix<float,blaze::rowMajor> dst( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<short,blaze::rowMajor> src( 5UL, 4UL );
+      randomize( src );
+      testSerialization( src );
+
+      blaze::MappedDenseMatrix<long int,blaze::rowMajor> dst( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element size difference succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 10UL, 10UL );
+      randomize( src, 20UL );
+      testSerialization( src );
+
+      std::vector<char> buffer;
+      {
+         std::ifstream in( filename_.c_str(), std::ifstream::binary );
+         buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+      }
+      {
+         std::ofstream out( filename_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+         out.write( &buffer[0], buffer.size() - 8UL );
+      }
+
+      blaze::MappedSparseMatrix<double,blaze::rowMajor> dst( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Truncated file succeeded\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedDenseMatrix<double,blaze::rowMajor> dst( "mappedserializer.nonexisting" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping of nonexisting file succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+} // namespace mappedserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedSerializer class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDSERIALIZER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedSerializer class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
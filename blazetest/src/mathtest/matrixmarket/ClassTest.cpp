@@ -0,0 +1,602 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixmarket/ClassTest.cpp
+//  \brief Source file for the MatrixMarket class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <blaze/math/serialization/MatrixMarket.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrixmarket/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixmarket {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MatrixMarket class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                          // Label of the currently performed test
+   , filename_( "matrixmarket.mtx" )  // The name of the temporary Matrix Market file
+   , pool_( 4UL )                     // The thread pool for the parallel tests
+{
+   testEmptyMatrices();
+   testRandomMatrices();
+   testFormats();
+   testUnsortedEntries();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the MatrixMarket class test.
+//
+// The destructor removes the temporary Matrix Market file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Round trip test with empty matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with empty matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEmptyMatrices()
+{
+   test_ = "Empty matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src;
+      runTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 0UL, 5UL );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 5UL, 7UL );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::columnMajor> src( 5UL, 0UL );
+      runTest( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Round trip test with randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with randomly initialized matrices. The larger
+// matrices result in files that are split into several chunks for the parallel reading. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRandomMatrices()
+{
+   test_ = "Randomly initialized matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<float,blaze::columnMajor> src( 33UL, 17UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 150UL, 120UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<double>,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::columnMajor> src( 33UL, 17UL );
+      randomize( src );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 500UL, 400UL );
+      randomize( src, 12000UL );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 400UL, 500UL );
+      randomize( src, 12000UL );
+      runTest( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> src( 13UL, 7UL );
+      randomize( src );
+      runTest( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading test of hand-crafted Matrix Market files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads hand-crafted Matrix Market files with different formats, fields, and
+// symmetry structures. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testFormats()
+{
+   typedef blaze::complex<double>  cplx;
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>    RSMat;
+   typedef blaze::CompressedMatrix<double,blaze::columnMajor> CSMat;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>       RDMat;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>    CDMat;
+
+
+   //=====================================================================================
+   // Coordinate format with comments and mixed case
+   //=====================================================================================
+
+   {
+      test_ = "Coordinate format with comments";
+
+      const std::string text( "%%MatrixMarket Matrix COORDINATE Real General\n"
+                              "% First comment\n"
+                              "%\n"
+                              "\n"
+                              "  3 4   3\r\n"
+                              "1 2 1.5\n"
+                              "  3 4 -2E+1 \n"
+                              "\n"
+                              "2 1 0.25" );
+
+      RDMat ref( 3UL, 4UL, 0.0 );
+      ref(0,1) =   1.5;
+      ref(1,0) =  0.25;
+      ref(2,3) = -20.0;
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CSMat>( text, ref );
+      runReadTest<RDMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+   }
+
+
+   //=====================================================================================
+   // Coordinate format with symmetric structures
+   //=====================================================================================
+
+   {
+      test_ = "Coordinate format with symmetric structure";
+
+      const std::string text( "%%MatrixMarket matrix coordinate real symmetric\n"
+                              "3 3 4\n"
+                              "1 1 1\n"
+                              "2 1 2\n"
+                              "3 1 3\n"
+                              "3 3 4\n" );
+
+      const double values[3][3] = { { 1, 2, 3 }, { 2, 0, 0 }, { 3, 0, 4 } };
+      const RDMat ref( values );
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CSMat>( text, ref );
+      runReadTest<RDMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+   }
+
+   {
+      test_ = "Coordinate format with skew-symmetric structure";
+
+      const std::string text( "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+                              "3 3 2\n"
+                              "2 1 5\n"
+                              "3 2 -7\n" );
+
+      const int values[3][3] = { { 0, -5, 0 }, { 5, 0, 7 }, { 0, -7, 0 } };
+      const blaze::DynamicMatrix<int> ref( values );
+
+      runReadTest< blaze::CompressedMatrix<int,blaze::rowMajor> >( text, ref );
+      runReadTest< blaze::CompressedMatrix<int,blaze::columnMajor> >( text, ref );
+      runReadTest< blaze::DynamicMatrix<int,blaze::rowMajor> >( text, ref );
+   }
+
+   {
+      test_ = "Coordinate format with hermitian structure";
+
+      const std::string text( "%%MatrixMarket matrix coordinate complex hermitian\n"
+                              "2 2 3\n"
+                              "1 1 1 0\n"
+                              "2 1 2 3\n"
+                              "2 2 4 0\n" );
+
+      blaze::DynamicMatrix<cplx> ref( 2UL, 2UL );
+      ref(0,0) = cplx( 1.0,  0.0 );
+      ref(0,1) = cplx( 2.0, -3.0 );
+      ref(1,0) = cplx( 2.0,  3.0 );
+      ref(1,1) = cplx( 4.0,  0.0 );
+
+      runReadTest< blaze::CompressedMatrix<cplx,blaze::rowMajor> >( text, ref );
+      runReadTest< blaze::CompressedMatrix<cplx,blaze::columnMajor> >( text, ref );
+      runReadTest< blaze::DynamicMatrix<cplx,blaze::columnMajor> >( text, ref );
+   }
+
+
+   //=====================================================================================
+   // Coordinate format with pattern and integer fields
+   //=====================================================================================
+
+   {
+      test_ = "Coordinate format with pattern field";
+
+      const std::string text( "%%MatrixMarket matrix coordinate pattern general\n"
+                              "2 3 3\n"
+                              "1 3\n"
+                              "2 1\n"
+                              "2 2\n" );
+
+      const float values[2][3] = { { 0, 0, 1 }, { 1, 1, 0 } };
+      const blaze::DynamicMatrix<float> ref( values );
+
+      runReadTest< blaze::CompressedMatrix<float,blaze::rowMajor> >( text, ref );
+      runReadTest< blaze::CompressedMatrix<float,blaze::columnMajor> >( text, ref );
+      runReadTest< blaze::DynamicMatrix<float,blaze::rowMajor> >( text, ref );
+   }
+
+   {
+      test_ = "Coordinate format with integer field";
+
+      const std::string text( "%%MatrixMarket matrix coordinate integer general\n"
+                              "2 2 2\n"
+                              "1 1 -3\n"
+                              "2 2 12\n" );
+
+      const double values[2][2] = { { -3, 0 }, { 0, 12 } };
+      const RDMat ref( values );
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+      runReadTest< blaze::CompressedMatrix<cplx,blaze::rowMajor> >( text, ref );
+   }
+
+
+   //=====================================================================================
+   // Array format
+   //=====================================================================================
+
+   {
+      test_ = "Array format with general structure";
+
+      const std::string text( "%%MatrixMarket matrix array real general\n"
+                              "% Column-major order\n"
+                              "2 3\n"
+                              "1\n4\n2\n5\n3\n6\n" );
+
+      const double values[2][3] = { { 1, 2, 3 }, { 4, 5, 6 } };
+      const RDMat ref( values );
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CSMat>( text, ref );
+      runReadTest<RDMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+   }
+
+   {
+      test_ = "Array format with symmetric structure";
+
+      const std::string text( "%%MatrixMarket matrix array real symmetric\n"
+                              "3 3\n"
+                              "1\n2\n3\n4\n5\n6\n" );
+
+      const double values[3][3] = { { 1, 2, 3 }, { 2, 4, 5 }, { 3, 5, 6 } };
+      const RDMat ref( values );
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CSMat>( text, ref );
+      runReadTest<RDMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+   }
+
+   {
+      test_ = "Array format with skew-symmetric structure";
+
+      const std::string text( "%%MatrixMarket matrix array real skew-symmetric\n"
+                              "3 3\n"
+                              "1\n2\n3\n" );
+
+      const double values[3][3] = { { 0, -1, -2 }, { 1, 0, -3 }, { 2, 3, 0 } };
+      const RDMat ref( values );
+
+      runReadTest<RSMat>( text, ref );
+      runReadTest<CDMat>( text, ref );
+   }
+
+   {
+      test_ = "Array format with complex field";
+
+      const std::string text( "%%MatrixMarket matrix array complex general\n"
+                              "1 2\n"
+                              "1 -1\n"
+                              "0.5 2\n" );
+
+      blaze::DynamicMatrix<cplx> ref( 1UL, 2UL );
+      ref(0,0) = cplx( 1.0, -1.0 );
+      ref(0,1) = cplx( 0.5,  2.0 );
+
+      runReadTest< blaze::CompressedMatrix<cplx,blaze::rowMajor> >( text, ref );
+      runReadTest< blaze::DynamicMatrix<cplx,blaze::columnMajor> >( text, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading test of a large coordinate file with unsorted and duplicate entries.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads a coordinate file with randomly ordered entries, including duplicate
+// entries, that is large enough to be split into several chunks. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUnsortedEntries()
+{
+   test_ = "Unsorted and duplicate entries";
+
+   const size_t m( 300UL );
+   const size_t n( 200UL );
+   const size_t entries( 20000UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref( m, n, 0 );
+
+   std::ostringstream text;
+   text << "%%MatrixMarket matrix coordinate integer general\n"
+        << m << " " << n << " " << entries << "\n";
+
+   for( size_t k=0UL; k<entries; ++k ) {
+      const size_t i( blaze::rand<size_t>( 0UL, m-1UL ) );
+      const size_t j( blaze::rand<size_t>( 0UL, n-1UL ) );
+      const int value( blaze::rand<int>( -100, 100 ) );
+      ref(i,j) += value;
+      text << i+1UL << " " << j+1UL << " " << value << "\n";
+   }
+
+   runReadTest< blaze::CompressedMatrix<int,blaze::rowMajor>    >( text.str(), ref );
+   runReadTest< blaze::CompressedMatrix<int,blaze::columnMajor> >( text.str(), ref );
+   runReadTest< blaze::DynamicMatrix<int,blaze::columnMajor>    >( text.str(), ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing reading attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with invalid Matrix Market files. In case no error is detected,
+// i.e. in case the test is failing, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Reading failures";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  RSMat;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  CDMat;
+
+   runFailureTest<RSMat>( "", "Reading of empty file" );
+   runFailureTest<RSMat>( "%%MatrixMarket tensor coordinate real general\n2 2 0\n",
+                          "Reading of invalid object" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real diagonal\n2 2 0\n",
+                          "Reading of invalid symmetry" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2\n",
+                          "Reading of missing number of entries" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n",
+                          "Reading of missing entry" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1\n2 2 2\n",
+                          "Reading of additional entry" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+                          "Reading of out-of-bounds row index" );
+   runFailureTest<CDMat>( "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 0 1\n",
+                          "Reading of zero column index" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 x\n",
+                          "Reading of invalid value" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1 1\n",
+                          "Reading of additional value" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real symmetric\n2 2 1\n1 2 1\n",
+                          "Reading of upper element of symmetric matrix" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n1 1 1\n",
+                          "Reading of diagonal element of skew-symmetric matrix" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate real symmetric\n2 3 0\n",
+                          "Reading of non-square symmetric matrix" );
+   runFailureTest<RSMat>( "%%MatrixMarket matrix coordinate complex general\n2 2 1\n1 1 1 1\n",
+                          "Reading of complex file into real matrix" );
+   runFailureTest< blaze::CompressedMatrix<int> >( "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1\n",
+                                                   "Reading of real file into integral matrix" );
+   runFailureTest<CDMat>( "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n",
+                          "Reading of incomplete array" );
+   runFailureTest<CDMat>( "%%MatrixMarket matrix array pattern general\n2 2\n",
+                          "Reading of pattern array" );
+
+   try {
+      RSMat dst;
+      blaze::readMatrixMarket( "matrixmarket.nonexisting", dst );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading of nonexisting file succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given text into the temporary Matrix Market file.
+//
+// \param text The content of the file.
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+void ClassTest::writeFile( const std::string& text )
+{
+   std::ofstream file( filename_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+   file.write( text.data(), text.size() );
+   file.close();
+
+   if( !file ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Temporary file could not be written\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace matrixmarket
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MatrixMarket class test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXMARKET_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MatrixMarket class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
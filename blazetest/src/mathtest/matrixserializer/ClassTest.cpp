@@ -64,6 +64,8 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testCompressedIndices();
+   testLegacyFormat();
    testFailures();
 }
 //*************************************************************************************************
@@ -313,6 +315,114 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serialization test with plain and delta-encoded sparse indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs serialization tests of sparse matrices both with plain and with
+// delta-encoded indices. The tests include matrices whose non-zero elements span several
+// blocks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompressedIndices()
+{
+   test_ = "Compressed indices";
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 7UL, 13UL );
+      randomize( src );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::StaticVector<double,3UL>,blaze::rowMajor> src( 13UL, 7UL );
+      randomize( src );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 300UL, 1000UL );
+      randomize( src, 80000UL );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 1000UL, 300UL );
+      randomize( src, 80000UL );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 5UL, 100000UL );
+      src(0UL,    0UL) = 1.0;
+      src(0UL,99999UL) = 2.0;
+      src(3UL,  127UL) = 3.0;
+      src(3UL,  128UL) = 4.0;
+      src(3UL,16511UL) = 5.0;
+      runCompressionTests( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with sparse matrices in the element-wise format of version 1.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of sparse matrices that have been serialized in
+// the element-wise format of version 1. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLegacyFormat()
+{
+   test_ = "Legacy format";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+   ref(0,1) = 1;
+   ref(0,3) = 2;
+   ref(2,0) = 3;
+
+   {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 1U ) << uint8_t( 3U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( 3UL )
+              << uint64_t( 2UL ) << size_t( 1UL ) << 1 << size_t( 3UL ) << 2
+              << uint64_t( 0UL )
+              << uint64_t( 1UL ) << size_t( 0UL ) << 3;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> dst;
+      testDeserialization( archive, dst );
+      compareMatrices( ref, dst );
+   }
+
+   {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 1U ) << uint8_t( 7U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( 3UL )
+              << uint64_t( 1UL ) << size_t( 2UL ) << 3
+              << uint64_t( 1UL ) << size_t( 0UL ) << 1
+              << uint64_t( 0UL )
+              << uint64_t( 1UL ) << size_t( 0UL ) << 2;
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dst;
+      testDeserialization( archive, dst );
+      compareMatrices( ref, dst );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -418,6 +528,50 @@ void ClassTest::testFailures()
    }
    catch( std::runtime_error& )
    {}
+
+   try {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 2U ) << uint8_t( 3U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 2UL ) << uint64_t( 3UL ) << uint64_t( 1UL )
+              << uint8_t( 0U ) << uint64_t( 65536UL )
+              << uint64_t( 1UL ) << uint64_t( 0UL )
+              << uint64_t( 5UL ) << 1;
+
+      blaze::CompressedMatrix<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid column index succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 2U ) << uint8_t( 3U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 2UL ) << uint64_t( 3UL ) << uint64_t( 2UL )
+              << uint8_t( 1U ) << uint64_t( 65536UL )
+              << uint64_t( 2UL ) << uint64_t( 0UL )
+              << uint64_t( 2UL ) << uint8_t( 1U ) << uint8_t( 0U ) << 1 << 2;
+
+      blaze::DynamicMatrix<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Repeated column index succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
 }
 //*************************************************************************************************
 
@@ -0,0 +1,594 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mixedprecision/OperationTest.cpp
+//  \brief Source file for the mixed precision operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/mixedprecision/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mixedprecision {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   for( size_t m=0UL; m<=19UL; ++m ) {
+      for( size_t n=0UL; n<=19UL; ++n ) {
+         testMatVecMult<float,double,blaze::rowMajor>            ( m, n );
+         testMatVecMult<float,double,blaze::columnMajor>         ( m, n );
+         testMatVecMult<int,double,blaze::rowMajor>              ( m, n );
+         testMatVecMult<int,double,blaze::columnMajor>           ( m, n );
+         testMatVecMult<int,float,blaze::rowMajor>               ( m, n );
+         testMatVecMult<int,float,blaze::columnMajor>            ( m, n );
+         testMatVecMult<blaze::float16,float,blaze::rowMajor>    ( m, n );
+         testMatVecMult<blaze::float16,float,blaze::columnMajor> ( m, n );
+         testMatVecMult<blaze::bfloat16,float,blaze::rowMajor>   ( m, n );
+         testMatVecMult<blaze::bfloat16,float,blaze::columnMajor>( m, n );
+      }
+   }
+
+   testMatVecMult<float,double,blaze::rowMajor>            ( 300UL, 533UL );
+   testMatVecMult<float,double,blaze::columnMajor>         ( 533UL, 300UL );
+   testMatVecMult<float,double,blaze::rowMajor>            ( 533UL, 300UL );
+   testMatVecMult<float,double,blaze::columnMajor>         ( 300UL, 533UL );
+   testMatVecMult<blaze::float16,float,blaze::rowMajor>    ( 300UL, 533UL );
+   testMatVecMult<blaze::float16,float,blaze::columnMajor> ( 533UL, 300UL );
+   testMatVecMult<blaze::bfloat16,float,blaze::rowMajor>   ( 533UL, 300UL );
+   testMatVecMult<blaze::bfloat16,float,blaze::columnMajor>( 300UL, 533UL );
+
+   for( size_t n=0UL; n<=67UL; ++n ) {
+      testInnerProduct<float,double>         ( n );
+      testInnerProduct<int,double>           ( n );
+      testInnerProduct<int,float>            ( n );
+      testInnerProduct<blaze::float16,float> ( n );
+      testInnerProduct<blaze::bfloat16,float>( n );
+   }
+
+   for( size_t m=0UL; m<=13UL; ++m ) {
+      for( size_t n=0UL; n<=37UL; n+=3UL ) {
+         for( size_t k=0UL; k<=7UL; ++k ) {
+            testMatMatMult<float,double>( m, n, k );
+            testMatMatMult<int,double>  ( m, n, k );
+            testMatMatMult<int,float>   ( m, n, k );
+         }
+      }
+   }
+
+   for( size_t n=0UL; n<=67UL; ++n ) {
+      testVecAddSub<float,double>         ( n );
+      testVecAddSub<int,double>           ( n );
+      testVecAddSub<int,float>            ( n );
+      testVecAddSub<blaze::float16,float> ( n );
+      testVecAddSub<blaze::bfloat16,float>( n );
+   }
+
+   for( size_t m=0UL; m<=19UL; ++m ) {
+      for( size_t n=0UL; n<=19UL; ++n ) {
+         testMatAddSub<float,double,blaze::rowMajor>            ( m, n );
+         testMatAddSub<float,double,blaze::columnMajor>         ( m, n );
+         testMatAddSub<int,double,blaze::rowMajor>              ( m, n );
+         testMatAddSub<int,double,blaze::columnMajor>           ( m, n );
+         testMatAddSub<blaze::float16,float,blaze::rowMajor>    ( m, n );
+         testMatAddSub<blaze::float16,float,blaze::columnMajor> ( m, n );
+         testMatAddSub<blaze::bfloat16,float,blaze::rowMajor>   ( m, n );
+         testMatAddSub<blaze::bfloat16,float,blaze::columnMajor>( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense matrix/dense vector multiplications.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a matrix with element type \a T1 with vectors of
+// element type \a T2 (\f$ \vec{y}=A*\vec{x} \f$ and \f$ \vec{y}^T=\vec{x}^T*A \f$, including
+// the addition and subtraction assignment) by comparing the results to the multiplication with
+// a copy of the matrix with element type \a T2.
+*/
+template< typename T1    // Element type of the matrix
+        , typename T2    // Element type of the vectors
+        , bool SO >      // Storage order of the matrix
+void OperationTest::testMatVecMult( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision multiplication of a " << m << "x" << n
+       << ( SO ? " column-major" : " row-major" ) << " matrix";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T1,SO> A( m, n );
+   randomize( A );
+
+   const blaze::DynamicMatrix<T2,SO> ref( A );
+
+   // Matrix/vector multiplication
+   {
+      blaze::DynamicVector<T2,blaze::columnVector> x( n ), y0( m );
+      randomize( x );
+      randomize( y0 );
+
+      blaze::DynamicVector<T2,blaze::columnVector> y( m ), expected( m );
+
+      y = A * x;
+      expected = ref * x;
+      checkVector( "Assignment", y, expected );
+
+      y = y0;
+      y += A * x;
+      expected = y0;
+      expected += ref * x;
+      checkVector( "Addition assignment", y, expected );
+
+      y = y0;
+      y -= A * x;
+      expected = y0;
+      expected -= ref * x;
+      checkVector( "Subtraction assignment", y, expected );
+   }
+
+   // Vector/matrix multiplication
+   {
+      blaze::DynamicVector<T2,blaze::rowVector> x( m ), y0( n );
+      randomize( x );
+      randomize( y0 );
+
+      blaze::DynamicVector<T2,blaze::rowVector> y( n ), expected( n );
+
+      y = x * A;
+      expected = x * ref;
+      checkVector( "Transpose assignment", y, expected );
+
+      y = y0;
+      y += x * A;
+      expected = y0;
+      expected += x * ref;
+      checkVector( "Transpose addition assignment", y, expected );
+
+      y = y0;
+      y -= x * A;
+      expected = y0;
+      expected -= x * ref;
+      checkVector( "Transpose subtraction assignment", y, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision inner product of two dense vectors.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product of a vector with element type \a T1 and a vector
+// with element type \a T2 in both orders of the operands.
+*/
+template< typename T1    // Element type of the lower precision vector
+        , typename T2 >  // Element type of the higher precision vector
+void OperationTest::testInnerProduct( size_t n )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision inner product of size " << n;
+   test_ = oss.str();
+
+   blaze::DynamicVector<T1,blaze::columnVector> a( n );
+   blaze::DynamicVector<T2,blaze::columnVector> b( n );
+   randomize( a );
+   randomize( b );
+
+   const blaze::DynamicVector<T2,blaze::columnVector> ref( a );
+   const T2 expected( trans( ref ) * b );
+
+   checkValue<T2>( "Inner product", trans( a ) * b, expected );
+   checkValue<T2>( "Swapped inner product", trans( b ) * a, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense matrix/dense matrix multiplication.
+//
+// \param m The number of rows of the left-hand side matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param k The number of columns of the left-hand side matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a row-major matrix with element type \a T1 with a
+// row-major matrix with element type \a T2 in both orders of the operands (including the
+// addition and subtraction assignment) by comparing the results to the multiplication with a
+// copy of the matrix with element type \a T2.
+*/
+template< typename T1    // Element type of the lower precision matrix
+        , typename T2 >  // Element type of the higher precision matrix
+void OperationTest::testMatMatMult( size_t m, size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision multiplication of a " << m << "x" << k << " and a "
+       << k << "x" << n << " matrix";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T1,blaze::rowMajor> A( m, k ), D( k, n );
+   blaze::DynamicMatrix<T2,blaze::rowMajor> B( k, n ), E( m, k ), C0( m, n );
+   randomize( A );
+   randomize( B );
+   randomize( D );
+   randomize( E );
+   randomize( C0 );
+
+   const blaze::DynamicMatrix<T2,blaze::rowMajor> refA( A ), refD( D );
+
+   blaze::DynamicMatrix<T2,blaze::rowMajor> C( m, n ), expected( m, n );
+
+   C = A * B;
+   expected = refA * B;
+   checkMatrix( "Assignment", C, expected );
+
+   C = C0;
+   C += A * B;
+   expected = C0;
+   expected += refA * B;
+   checkMatrix( "Addition assignment", C, expected );
+
+   C = C0;
+   C -= A * B;
+   expected = C0;
+   expected -= refA * B;
+   checkMatrix( "Subtraction assignment", C, expected );
+
+   C = E * D;
+   expected = E * refD;
+   checkMatrix( "Swapped assignment", C, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense vector addition and subtraction.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the addition and subtraction of a vector with element type \a T1 and a
+// vector with element type \a T2 in both orders of the operands (including the addition and
+// subtraction assignment) by comparing the results to the operations with a copy of the vector
+// with element type \a T2.
+*/
+template< typename T1    // Element type of the lower precision vector
+        , typename T2 >  // Element type of the higher precision vector
+void OperationTest::testVecAddSub( size_t n )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision addition/subtraction of size " << n;
+   test_ = oss.str();
+
+   blaze::DynamicVector<T1,blaze::columnVector> a( n );
+   blaze::DynamicVector<T2,blaze::columnVector> b( n ), y0( n );
+   randomize( a );
+   randomize( b );
+   randomize( y0 );
+
+   const blaze::DynamicVector<T2,blaze::columnVector> ref( a );
+
+   blaze::DynamicVector<T2,blaze::columnVector> y( n ), expected( n );
+
+   y = a + b;
+   expected = ref + b;
+   checkVector( "Addition", y, expected );
+
+   y = b - a;
+   expected = b - ref;
+   checkVector( "Subtraction", y, expected );
+
+   y = y0;
+   y += a - b;
+   expected = y0;
+   expected += ref - b;
+   checkVector( "Addition assignment", y, expected );
+
+   y = y0;
+   y -= b + a;
+   expected = y0;
+   expected -= b + ref;
+   checkVector( "Subtraction assignment", y, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mixed precision dense matrix addition and subtraction.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the addition and subtraction of a matrix with element type \a T1 and a
+// matrix with element type \a T2 in both orders of the operands (including the addition and
+// subtraction assignment) by comparing the results to the operations with a copy of the matrix
+// with element type \a T2.
+*/
+template< typename T1    // Element type of the lower precision matrix
+        , typename T2    // Element type of the higher precision matrix
+        , bool SO >      // Storage order of the matrices
+void OperationTest::testMatAddSub( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Mixed precision addition/subtraction of " << m << "x" << n
+       << ( SO ? " column-major" : " row-major" ) << " matrices";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<T1,SO> A( m, n );
+   blaze::DynamicMatrix<T2,SO> B( m, n ), C0( m, n );
+   randomize( A );
+   randomize( B );
+   randomize( C0 );
+
+   const blaze::DynamicMatrix<T2,SO> ref( A );
+
+   blaze::DynamicMatrix<T2,SO> C( m, n ), expected( m, n );
+
+   C = A + B;
+   expected = ref + B;
+   checkMatrix( "Addition", C, expected );
+
+   C = B - A;
+   expected = B - ref;
+   checkMatrix( "Subtraction", C, expected );
+
+   C = C0;
+   C += A - B;
+   expected = C0;
+   expected += ref - B;
+   checkMatrix( "Addition assignment", C, expected );
+
+   C = C0;
+   C -= B + A;
+   expected = C0;
+   expected -= B + ref;
+   checkMatrix( "Subtraction assignment", C, expected );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single result value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at position (" << i << "," << j << ")";
+         checkValue( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -10, 10 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense row vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,true>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -10, 10 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -10, 10 ) );
+}
+//*************************************************************************************************
+
+} // namespace mixedprecision
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running mixed precision operation test..." << std::endl;
+
+   try
+   {
+      RUN_MIXEDPRECISION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during mixed precision operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,641 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/OperationTest.cpp
+//  \brief Source file for the packed matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/packedmatrix/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testSetup();
+
+   for( size_t n=0UL; n<=33UL; ++n ) {
+      for( size_t k=0UL; k<=9UL; k+=3UL ) {
+         testSymmetric<double>( n, k );
+         testSymmetric<float> ( n, k );
+         testSymmetric<int>   ( n, k );
+         testLower<double>( n, k );
+         testLower<float> ( n, k );
+         testLower<int>   ( n, k );
+         testUpper<double>( n, k );
+         testUpper<float> ( n, k );
+         testUpper<int>   ( n, k );
+      }
+   }
+
+   testSymmetric<double>( 257UL, 37UL );
+   testLower<double>    ( 257UL, 37UL );
+   testUpper<double>    ( 257UL, 37UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricMatrix class template.
+//
+// \param n The number of rows and columns of the symmetric matrix.
+// \param k The number of columns of the right-hand side dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access of a symmetric matrix, its conversion to a dense
+// matrix, the symmetric matrix/vector (SYMV) and matrix/matrix (SYMM) multiplications and the
+// use of a symmetric matrix within a dense matrix expression.
+*/
+template< typename T >  // Element type
+void OperationTest::testSymmetric( size_t n, size_t k )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  CMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   RMT D( n, n );
+   VT x( n );
+   RMT B( n, k );
+   CMT TB( n, k );
+
+   randomize( D );
+   symmetrize( D );
+   randomize( x );
+   randomize( B );
+   randomize( TB );
+
+   blaze::SymmetricMatrix<T> A( D );
+
+   test_ = "SymmetricMatrix element access";
+
+   checkValue<size_t>( "Number of rows", A.rows(), n );
+   checkValue<size_t>( "Number of columns", A.columns(), n );
+   checkValue<size_t>( "Capacity", A.capacity(), n*(n+1UL)/2UL );
+   checkMatrix( "Element access", A, D );
+   checkMatrix( "Conversion", RMT( A ), D );
+
+   if( n > 1UL ) {
+      A(0UL,n-1UL) = T( 7 );
+      checkValue<T>( "Write access to the upper half", A(n-1UL,0UL), T( 7 ) );
+      A(n-1UL,0UL) = D(n-1UL,0UL);
+   }
+
+   test_ = "SymmetricMatrix/dense vector multiplication (SYMV)";
+
+   const VT y( D * x );
+
+   checkVector( "Multiplication", VT( A * x ), y );
+   checkVector( "Multiplication with a vector expression", VT( A * ( x + x ) ), VT( D * ( x + x ) ) );
+
+   VT z( 3UL );
+   multiply( z, A, x );
+   checkValue<size_t>( "Reused vector size", z.size(), n );
+   checkVector( "Reused multiplication", z, y );
+
+   z = x;
+   multiply( z, A, z );
+   checkVector( "Aliased multiplication", z, y );
+
+   test_ = "SymmetricMatrix/dense matrix multiplication (SYMM)";
+
+   checkMatrix( "Multiplication with a row-major matrix", RMT( A * B ), RMT( D * B ) );
+   checkMatrix( "Multiplication with a column-major matrix", RMT( A * TB ), RMT( D * TB ) );
+   checkMatrix( "Multiplication with itself", RMT( A * A ), RMT( D * D ) );
+
+   test_ = "SymmetricMatrix within dense matrix expressions";
+
+   checkMatrix( "Addition", RMT( A + D ), RMT( D + D ) );
+   checkMatrix( "Transpose", RMT( trans( A ) ), D );
+   checkVector( "Multiplication with a dense matrix", VT( D * A * x ), VT( D * D * x ) );
+
+   z = x;
+   z = A * z;
+   checkVector( "Aliased assignment", z, y );
+
+   z += A * x;
+   checkVector( "Addition assignment", z, VT( y + y ) );
+
+   RMT C( B );
+   C -= A * B;
+   checkMatrix( "Subtraction assignment", C, RMT( B - D * B ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LowerMatrix class template.
+//
+// \param n The number of rows and columns of the lower matrix.
+// \param k The number of columns of the right-hand side dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access of a lower matrix, its conversion to a dense matrix,
+// the triangular matrix/vector (TRMV) and matrix/matrix (TRMM) multiplications, the forward
+// substitution (TRSV) and the use of a lower matrix within a dense matrix expression.
+*/
+template< typename T >  // Element type
+void OperationTest::testLower( size_t n, size_t k )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  CMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   RMT D( n, n );
+   VT x( n );
+   RMT B( n, k );
+   CMT TB( n, k );
+
+   randomize( D );
+   lower( D );
+   randomize( x );
+   randomize( B );
+   randomize( TB );
+
+   blaze::LowerMatrix<T> A( D );
+
+   test_ = "LowerMatrix element access";
+
+   checkValue<size_t>( "Number of rows", A.rows(), n );
+   checkValue<size_t>( "Number of columns", A.columns(), n );
+   checkValue<size_t>( "Capacity", A.capacity(), n*(n+1UL)/2UL );
+   checkMatrix( "Element access", A, D );
+   checkMatrix( "Conversion", RMT( A ), D );
+
+   test_ = "LowerMatrix/dense vector multiplication (TRMV)";
+
+   const VT y( D * x );
+
+   checkVector( "Multiplication", VT( A * x ), y );
+
+   VT z( 3UL );
+   multiply( z, A, x );
+   checkValue<size_t>( "Reused vector size", z.size(), n );
+   checkVector( "Reused multiplication", z, y );
+
+   z = x;
+   multiply( z, A, z );
+   checkVector( "Aliased multiplication", z, y );
+
+   test_ = "LowerMatrix/dense matrix multiplication (TRMM)";
+
+   checkMatrix( "Multiplication with a row-major matrix", RMT( A * B ), RMT( D * B ) );
+   checkMatrix( "Multiplication with a column-major matrix", RMT( A * TB ), RMT( D * TB ) );
+
+   test_ = "LowerMatrix forward substitution (TRSV)";
+
+   VT s;
+   solve( s, A, y );
+   checkValue<size_t>( "Solution size", s.size(), n );
+   checkVector( "Solution", s, x );
+
+   s = y;
+   solve( s, A, s );
+   checkVector( "Aliased solution", s, x );
+
+   test_ = "LowerMatrix within dense matrix expressions";
+
+   checkMatrix( "Addition", RMT( A + D ), RMT( D + D ) );
+   checkMatrix( "Transpose", RMT( trans( A ) ), RMT( trans( D ) ) );
+   checkVector( "Multiplication with a dense matrix", VT( D * A * x ), VT( D * D * x ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the UpperMatrix class template.
+//
+// \param n The number of rows and columns of the upper matrix.
+// \param k The number of columns of the right-hand side dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access of an upper matrix, its conversion to a dense matrix,
+// the triangular matrix/vector (TRMV) and matrix/matrix (TRMM) multiplications, the backward
+// substitution (TRSV) and the use of an upper matrix within a dense matrix expression.
+*/
+template< typename T >  // Element type
+void OperationTest::testUpper( size_t n, size_t k )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  CMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   RMT D( n, n );
+   VT x( n );
+   RMT B( n, k );
+   CMT TB( n, k );
+
+   randomize( D );
+   upper( D );
+   randomize( x );
+   randomize( B );
+   randomize( TB );
+
+   blaze::UpperMatrix<T> A( D );
+
+   test_ = "UpperMatrix element access";
+
+   checkValue<size_t>( "Number of rows", A.rows(), n );
+   checkValue<size_t>( "Number of columns", A.columns(), n );
+   checkValue<size_t>( "Capacity", A.capacity(), n*(n+1UL)/2UL );
+   checkMatrix( "Element access", A, D );
+   checkMatrix( "Conversion", RMT( A ), D );
+
+   test_ = "UpperMatrix/dense vector multiplication (TRMV)";
+
+   const VT y( D * x );
+
+   checkVector( "Multiplication", VT( A * x ), y );
+
+   VT z( 3UL );
+   multiply( z, A, x );
+   checkValue<size_t>( "Reused vector size", z.size(), n );
+   checkVector( "Reused multiplication", z, y );
+
+   z = x;
+   multiply( z, A, z );
+   checkVector( "Aliased multiplication", z, y );
+
+   test_ = "UpperMatrix/dense matrix multiplication (TRMM)";
+
+   checkMatrix( "Multiplication with a row-major matrix", RMT( A * B ), RMT( D * B ) );
+   checkMatrix( "Multiplication with a column-major matrix", RMT( A * TB ), RMT( D * TB ) );
+
+   test_ = "UpperMatrix backward substitution (TRSV)";
+
+   VT s;
+   solve( s, A, y );
+   checkValue<size_t>( "Solution size", s.size(), n );
+   checkVector( "Solution", s, x );
+
+   s = y;
+   solve( s, A, s );
+   checkVector( "Aliased solution", s, x );
+
+   test_ = "UpperMatrix within dense matrix expressions";
+
+   checkMatrix( "Addition", RMT( A + D ), RMT( D + D ) );
+   checkMatrix( "Transpose", RMT( trans( A ) ), RMT( trans( D ) ) );
+   checkVector( "Multiplication with a dense matrix", VT( D * A * x ), VT( D * D * x ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setup of packed matrices from invalid dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the setup of a symmetric matrix from a non-symmetric matrix and the
+// setup of triangular matrices from non-triangular matrices is rejected.
+*/
+void OperationTest::testSetup()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>  RMT;
+
+   const RMT rectangular( 3UL, 4UL, 0.0 );
+
+   RMT D( 3UL, 3UL, 0.0 );
+   D(2,0) = 1.0;
+
+   test_ = "Setup of a SymmetricMatrix";
+
+   try {
+      blaze::SymmetricMatrix<double> A( D );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-symmetric matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::SymmetricMatrix<double> A( rectangular );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-square matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::SymmetricMatrix<double> A( 3UL );
+      A = D;
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Assignment of a non-symmetric matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   test_ = "Setup of a LowerMatrix";
+
+   try {
+      blaze::LowerMatrix<double> A( trans( D ) );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from an upper matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::LowerMatrix<double> A( rectangular );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-square matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   test_ = "Setup of an UpperMatrix";
+
+   try {
+      blaze::UpperMatrix<double> A( D );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a lower matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::UpperMatrix<double> A( rectangular );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Setup from a non-square matrix succeeded\n" );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   checkValue<size_t>( op + " size", result.size(), expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<ET>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   typedef typename MT1::ElementType  ET;
+
+   checkValue<size_t>( op + " rows", result.rows(), expected.rows() );
+   checkValue<size_t>( op + " columns", result.columns(), expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at index (" << i << "," << j << ")";
+         checkValue<ET>( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small random integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small random integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mirroring the lower half of a square dense matrix onto its upper half.
+//
+// \param A The dense matrix to be symmetrized.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::symmetrize( blaze::DenseMatrix<MT,false>& A )
+{
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=i+1UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = (~A)(j,i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Turning a square dense matrix into a lower triangular matrix with unit diagonal.
+//
+// \param A The dense matrix to be modified.
+// \return void
+//
+// All elements of the upper part are reset to 0, the diagonal elements are set to 1 or -1.
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::lower( blaze::DenseMatrix<MT,false>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      (~A)(i,i) = ET( ( i % 3UL == 1UL )?( -1 ):( 1 ) );
+      for( size_t j=i+1UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Turning a square dense matrix into an upper triangular matrix with unit diagonal.
+//
+// \param A The dense matrix to be modified.
+// \return void
+//
+// All elements of the lower part are reset to 0, the diagonal elements are set to 1 or -1.
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::upper( blaze::DenseMatrix<MT,false>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      for( size_t j=0UL; j<i; ++j )
+         (~A)(i,j) = ET();
+      (~A)(i,i) = ET( ( i % 3UL == 1UL )?( -1 ):( 1 ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running packed matrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during packed matrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
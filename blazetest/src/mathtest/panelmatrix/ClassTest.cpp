@@ -0,0 +1,347 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/panelmatrix/ClassTest.cpp
+//  \brief Source file for the PanelMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <blaze/math/serialization/PanelMatrix.h>
+#include <blazetest/mathtest/panelmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace panelmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PanelMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()                         // Label of the currently performed test
+   , filename_( "panelmatrix.bin" )  // The name of the temporary panel file
+   , pool_( 2UL )                    // The thread pool for the asynchronous reading of the panels
+{
+   testEmptyMatrices();
+   testRandomMatrices();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the PanelMatrix class test.
+//
+// The destructor removes the temporary panel file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication test with empty matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs out-of-core multiplication tests with empty matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEmptyMatrices()
+{
+   test_ = "Empty matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src;
+      runTest( src, 3UL );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 0UL, 5UL );
+      runTest( src, 3UL );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 7UL, 0UL );
+      runTest( src, 3UL );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 7UL, 5UL );
+      runTest( src, 3UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Out-of-core multiplication test with randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs out-of-core multiplication tests with randomly initialized matrices
+// and different numbers of rows per panel, including a single row per panel, panel sizes that
+// do not divide the number of rows, and a single panel. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRandomMatrices()
+{
+   test_ = "Randomly initialized matrices";
+
+   const size_t panelRows[] = { 1UL, 7UL, 16UL, 64UL, 100UL };
+
+   for( size_t i=0UL; i<sizeof( panelRows )/sizeof( size_t ); ++i )
+   {
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> src( 64UL, 13UL );
+         randomize( src, -10, 10 );
+         runTest( src, panelRows[i] );
+      }
+
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> src( 37UL, 64UL );
+         randomize( src, -10, 10 );
+         runTest( src, panelRows[i] );
+      }
+
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> src( 64UL, 50UL );
+         randomize( src, 300UL, -10, 10 );
+         runTest( src, panelRows[i] );
+      }
+
+      {
+         blaze::CompressedMatrix<double,blaze::rowMajor> src( 71UL, 33UL );
+         randomize( src, 200UL, -10, 10 );
+         runTest( src, panelRows[i] );
+      }
+
+      {
+         blaze::CompressedMatrix<float,blaze::columnMajor> src( 50UL, 64UL );
+         randomize( src, 300UL, -10, 10 );
+         runTest( src, panelRows[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing out-of-core operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with invalid panel files and invalid vector sizes. In case no
+// error is detected, i.e. in case the test is failing, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Out-of-core failures";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  SparsePanel;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DensePanel;
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 10UL, 10UL );
+      randomize( src, -10, 10 );
+      blaze::serializePanels( filename_, src, 4UL );
+
+      blaze::PanelMatrix<SparsePanel> A( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Opening of dense panels as sparse panels succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::CompressedMatrix<float,blaze::rowMajor> src( 10UL, 10UL );
+      randomize( src, 20UL, -10, 10 );
+      blaze::serializePanels( filename_, src, 4UL );
+
+      blaze::PanelMatrix<SparsePanel> A( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 100UL, 10UL );
+      randomize( src, 200UL, -10, 10 );
+      blaze::serializePanels( filename_, src, 10UL );
+
+      std::vector<char> buffer;
+      {
+         std::ifstream in( filename_.c_str(), std::ifstream::binary );
+         buffer.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+      }
+      {
+         std::ofstream out( filename_.c_str(), std::ofstream::binary | std::ofstream::trunc );
+         out.write( &buffer[0], buffer.size() / 2UL );
+      }
+
+      blaze::PanelMatrix<SparsePanel> A( filename_ );
+      blaze::DynamicVector<double,blaze::columnVector> x( 10UL, 1.0 ), y( 100UL );
+      A.multiply( pool_, x, y );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with truncated file succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 10UL, 5UL );
+      randomize( src, -10, 10 );
+      blaze::serializePanels( filename_, src, 4UL );
+
+      blaze::PanelMatrix<DensePanel> A( filename_ );
+      blaze::DynamicVector<double,blaze::columnVector> x( 5UL, 1.0 ), y( 5UL );
+      A.multiply( x, y );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication with invalid target vector succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 10UL, 5UL );
+      blaze::serializePanels( filename_, src, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serialization with empty panels succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      blaze::PanelMatrix<DensePanel> A( "panelmatrix.nonexisting" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Opening of nonexisting file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+} // namespace panelmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PanelMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PANELMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PanelMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
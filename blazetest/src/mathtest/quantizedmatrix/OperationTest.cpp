@@ -0,0 +1,512 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/quantizedmatrix/OperationTest.cpp
+//  \brief Source file for the quantized matrix operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/quantizedmatrix/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace quantizedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testQuantization();
+
+   for( size_t m=0UL; m<=19UL; ++m ) {
+      for( size_t n=0UL; n<=67UL; ++n ) {
+         testMatVecMult( m, n );
+      }
+   }
+
+   testMatVecMult( 300UL, 533UL );
+   testMatVecMult( 533UL, 300UL );
+
+   for( size_t m=0UL; m<=7UL; ++m ) {
+      for( size_t n=0UL; n<=7UL; ++n ) {
+         for( size_t k=0UL; k<=67UL; k+=3UL ) {
+            testMatMatMult( m, n, k );
+         }
+      }
+   }
+
+   testMatMatMult( 67UL, 45UL, 129UL );
+   testMatMatMult( 128UL, 64UL, 256UL );
+
+   testExtremeValues(     1UL );
+   testExtremeValues(    33UL );
+   testExtremeValues( 65536UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the quantization and dequantization of dense matrices and vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the per-row quantization of a dense matrix and the symmetric
+// quantization of a dense vector reproduce the original values up to half a quantization step.
+*/
+void OperationTest::testQuantization()
+{
+   test_ = "Quantization of a dense matrix";
+
+   {
+      blaze::DynamicMatrix<float,blaze::rowMajor> W( 5UL, 37UL );
+
+      for( size_t i=0UL; i<W.rows(); ++i ) {
+         for( size_t j=0UL; j<W.columns(); ++j ) {
+            W(i,j) = blaze::rand<float>() * 4.0F - 1.0F;
+         }
+      }
+
+      // Row of zeros and row with non-negative elements only
+      for( size_t j=0UL; j<W.columns(); ++j ) {
+         W(3UL,j) = 0.0F;
+         W(4UL,j) = std::abs( W(4UL,j) );
+      }
+
+      const blaze::QuantizedMatrix A( W );
+      const blaze::DynamicMatrix<float,blaze::rowMajor> D( dequantize( A ) );
+
+      checkValue<size_t>( "Number of rows", A.rows(), W.rows() );
+      checkValue<size_t>( "Number of columns", A.columns(), W.columns() );
+      checkValue<float>( "Scaling factor of the zero row", A.scale( 3UL ), 1.0F );
+      checkValue<int>( "Zero point of the zero row", A.zeroPoint( 3UL ), 0 );
+      checkValue<int>( "Zero point of the non-negative row", A.zeroPoint( 4UL ), -128 );
+
+      for( size_t i=0UL; i<W.rows(); ++i ) {
+         for( size_t j=0UL; j<W.columns(); ++j ) {
+            if( std::abs( D(i,j) - W(i,j) ) > 0.5001F * A.scale( i ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Incorrect dequantized value at (" << i << "," << j << ")\n"
+                   << " Details:\n"
+                   << "   Result   = " << D(i,j) << "\n"
+                   << "   Expected = " << W(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+         for( size_t j=W.columns(); j<A.spacing(); ++j ) {
+            checkValue<int>( "Padding element", A.data( i )[j], 0 );
+         }
+      }
+   }
+
+   test_ = "Quantization of a dense vector";
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> v( 29UL );
+      for( size_t j=0UL; j<v.size(); ++j )
+         v[j] = blaze::rand<double>() * 6.0 - 3.0;
+      v[7] = -4.0;
+
+      blaze::DynamicVector<blaze::int8_t,blaze::columnVector> x;
+      const float scale( quantize( x, v ) );
+
+      checkValue<size_t>( "Vector size", x.size(), v.size() );
+      checkValue<float>( "Scaling factor", scale, 4.0F / 127.0F );
+      checkValue<int>( "Largest element", x[7], -127 );
+
+      for( size_t j=0UL; j<v.size(); ++j ) {
+         if( std::abs( scale*x[j] - v[j] ) > 0.5001F * scale ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect quantized value at index " << j << "\n"
+                << " Details:\n"
+                << "   Result   = " << int( x[j] ) << "\n"
+                << "   Expected = " << v[j] / scale << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the quantized matrix/vector multiplication.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a randomly initialized quantized matrix with a
+// vector of 8-bit integral values by comparing the result to the according multiplication
+// with 32-bit integral operands.
+*/
+void OperationTest::testMatVecMult( size_t m, size_t n )
+{
+   std::ostringstream oss;
+   oss << "Quantized multiplication of a " << m << "x" << n << " matrix with a vector";
+   test_ = oss.str();
+
+   blaze::QuantizedMatrix A( m, n );
+   randomize( A );
+
+   blaze::DynamicVector<blaze::int8_t,blaze::columnVector> x( n );
+   randomize( x );
+
+   const blaze::DynamicVector<int,blaze::columnVector> ref( x );
+   const blaze::DynamicVector<int,blaze::columnVector> expected( reference( A ) * ref );
+
+   const blaze::DynamicVector<blaze::int32_t,blaze::columnVector> y( A * x );
+   checkValue<size_t>( "Vector size", y.size(), m );
+   checkVector( "Multiplication", y, expected );
+
+   blaze::DynamicVector<blaze::int32_t,blaze::columnVector> z( 3UL );
+   multiply( z, A, x );
+   checkValue<size_t>( "Reused vector size", z.size(), m );
+   checkVector( "Reused multiplication", z, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the quantized matrix/matrix multiplication.
+//
+// \param m The number of rows of the quantized matrix.
+// \param n The number of columns of the right-hand side matrix.
+// \param k The number of columns of the quantized matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a randomly initialized \a m by \a k quantized
+// matrix with a \a k by \a n matrix of 8-bit integral values by comparing the result to the
+// according multiplication with 32-bit integral operands.
+*/
+void OperationTest::testMatMatMult( size_t m, size_t n, size_t k )
+{
+   std::ostringstream oss;
+   oss << "Quantized multiplication of a " << m << "x" << k << " matrix with a "
+       << k << "x" << n << " matrix";
+   test_ = oss.str();
+
+   blaze::QuantizedMatrix A( m, k );
+   randomize( A );
+
+   blaze::DynamicMatrix<blaze::int8_t,blaze::columnMajor> B( k, n );
+   randomize( B );
+
+   const blaze::DynamicMatrix<int,blaze::columnMajor> ref( B );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> expected( reference( A ) * ref );
+
+   const blaze::DynamicMatrix<blaze::int32_t,blaze::rowMajor> C( A * B );
+   checkValue<size_t>( "Number of rows", C.rows(), m );
+   checkValue<size_t>( "Number of columns", C.columns(), n );
+   checkMatrix( "Multiplication", C, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the quantized multiplications with extreme values.
+//
+// \param n The number of columns of the quantized matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the quantized multiplications with operands consisting of the smallest
+// and largest 8-bit integral values, which would saturate in case the products were accumulated
+// in 16-bit integral values.
+*/
+void OperationTest::testExtremeValues( size_t n )
+{
+   std::ostringstream oss;
+   oss << "Quantized multiplication with extreme values of size " << n;
+   test_ = oss.str();
+
+   blaze::QuantizedMatrix A( 3UL, n );
+   A.zeroPoint( 2UL ) = 127;
+
+   blaze::DynamicVector<blaze::int8_t,blaze::columnVector> x( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      A(0UL,j) = -128;
+      A(1UL,j) = ( j % 2UL )?( -128 ):( 127 );
+      A(2UL,j) = -128;
+      x[j] = -128;
+   }
+
+   blaze::DynamicVector<int,blaze::columnVector> expected( 3UL );
+   expected[0] = 16384 * int( n );
+   expected[1] = ( n / 2UL ) * 16384 - ( n - n / 2UL ) * 16256;
+   expected[2] = 32640 * int( n );
+
+   checkVector( "Matrix/vector multiplication", A * x, expected );
+
+   blaze::DynamicMatrix<blaze::int8_t,blaze::columnMajor> B( n, 3UL );
+   for( size_t j=0UL; j<3UL; ++j )
+      for( size_t i=0UL; i<n; ++i )
+         B(i,j) = x[i];
+
+   const blaze::DynamicMatrix<blaze::int32_t,blaze::rowMajor> C( A * B );
+   for( size_t i=0UL; i<3UL; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         checkValue<int>( "Matrix/matrix multiplication", C(i,j), expected[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single result value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<int>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at index (" << i << "," << j << ")";
+         checkValue<int>( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a quantized matrix with random 8-bit values and zero points.
+//
+// \param A The quantized matrix to be initialized.
+// \return void
+*/
+void OperationTest::randomize( blaze::QuantizedMatrix& A )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      A.zeroPoint( i ) = blaze::rand<int>( -128, 127 );
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = blaze::int8_t( blaze::rand<int>( -128, 127 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with random 8-bit values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -128, 127 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with random 8-bit values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -128, 127 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the zero point adjusted 32-bit integral representation of a quantized matrix.
+//
+// \param A The quantized matrix.
+// \return The matrix with the elements \f$ q_{ij} - z_i \f$.
+*/
+const blaze::DynamicMatrix<int,blaze::rowMajor>
+   OperationTest::reference( const blaze::QuantizedMatrix& A )
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> res( A.rows(), A.columns() );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         res(i,j) = int( A(i,j) ) - A.zeroPoint( i );
+
+   return res;
+}
+//*************************************************************************************************
+
+} // namespace quantizedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running QuantizedMatrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_QUANTIZEDMATRIX_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during QuantizedMatrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
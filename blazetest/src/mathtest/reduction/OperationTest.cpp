@@ -0,0 +1,744 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/reduction/OperationTest.cpp
+//  \brief Source file for the reduction operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/reduction/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace reduction {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Custom, vectorizable addition for the test of the reduce() function.
+*/
+struct Plus
+{
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = blaze::IntrinsicTrait<T>::addition };
+   };
+
+   template< typename T >
+   inline T operator()( const T& a, const T& b ) const { return a + b; }
+
+   template< typename T >
+   inline T load( const T& a, const T& b ) const { return a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Custom, non-vectorizable operation selecting the value with the largest magnitude.
+*/
+struct AbsMax
+{
+   template< typename T >
+   struct SIMDEnabled {
+      enum { value = 0 };
+   };
+
+   template< typename T >
+   inline T operator()( const T& a, const T& b ) const {
+      return ( std::abs( b ) > std::abs( a ) )?( b ):( a );
+   }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   for( size_t n=0UL; n<=35UL; ++n ) {
+      testDenseVector<int>   ( n );
+      testDenseVector<float> ( n );
+      testDenseVector<double>( n );
+   }
+
+   testDenseVector<float> ( 1000UL );
+   testDenseVector<double>( 1000UL );
+
+   for( size_t m=0UL; m<=9UL; ++m ) {
+      for( size_t n=0UL; n<=19UL; n+=3UL ) {
+         testDenseMatrix<int>   ( m, n );
+         testDenseMatrix<float> ( m, n );
+         testDenseMatrix<double>( m, n );
+      }
+   }
+
+   testDenseMatrix<float> ( 67UL, 45UL );
+   testDenseMatrix<double>( 45UL, 67UL );
+
+   for( size_t n=0UL; n<=19UL; ++n ) {
+      testNorms<float> ( n );
+      testNorms<double>( n );
+   }
+
+   testSpecialValues();
+   testViews();
+   testCustomOperation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reduction operations on dense vectors.
+//
+// \param n The size of the dense vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reduction operations on dense vectors of size \a n. Since the size
+// is varied, both the vectorized kernels and the scalar remainder loops are tested. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense vectors
+void OperationTest::testDenseVector( size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>     TVT;
+
+   test_ = "Dense vector reduction operations";
+
+   const bool integral( std::numeric_limits<T>::is_integer );
+
+   VT a( n ), b( n ), c( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = rand<T>( T(-10), T(10) );
+      b[i] = rand<T>( T(-10), T(10) );
+      c[i] = ( integral )?( T( rand<int>( 0, 1 )*2 - 1 ) ):( rand<T>( T(0.9), T(1.1) ) );
+   }
+
+   checkValue( "sum( a )", sum( a ), reference( a, blaze::Add() ), absSum( a ) );
+   checkValue( "sum( trans( a ) )", sum( trans( a ) ), reference( a, blaze::Add() ), absSum( a ) );
+   checkValue( "prod( c )", prod( c ), reference( c, blaze::Mult() ), T(1) );
+   checkValue( "min( a )", min( a ), reference( a, blaze::Min() ), T(0) );
+   checkValue( "max( a )", max( a ), reference( a, blaze::Max() ), T(0) );
+   checkValue( "reduce( a, Max() )", reduce( a, blaze::Max() ),
+               reference( a, blaze::Max() ), T(0) );
+
+   {
+      const VT ab( a * b );
+      checkValue( "sum( a * b )", sum( a * b ), reference( ab, blaze::Add() ), absSum( ab ) );
+   }
+
+   {
+      const VT apb( a + b );
+      checkValue( "sum( a + b )", sum( a + b ), reference( apb, blaze::Add() ), absSum( apb ) );
+      checkValue( "max( a + b )", max( a + b ), reference( apb, blaze::Max() ), T(0) );
+   }
+
+   {
+      const TVT ta( trans( a ) );
+      checkValue( "min( trans( a ) )", min( ta ), reference( a, blaze::Min() ), T(0) );
+   }
+
+   size_t imin( 0UL ), imax( 0UL );
+   for( size_t i=1UL; i<n; ++i ) {
+      if( a[i] < a[imin] ) imin = i;
+      if( a[imax] < a[i] ) imax = i;
+   }
+
+   checkIndex( "argmin( a )", argmin( a ), imin );
+   checkIndex( "argmax( a )", argmax( a ), imax );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduction operations on dense matrices.
+//
+// \param m The number of rows of the dense matrices.
+// \param n The number of columns of the dense matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total, row-wise and column-wise reduction operations on row-major and
+// column-major dense matrices of size \f$ m \times n \f$. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense matrices
+void OperationTest::testDenseMatrix( size_t m, size_t n )
+{
+   using blaze::rand;
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>     MT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>  TMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector> VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>    TVT;
+
+   test_ = "Dense matrix reduction operations";
+
+   const bool integral( std::numeric_limits<T>::is_integer );
+
+   MT A( m, n ), C( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = rand<T>( T(-10), T(10) );
+         C(i,j) = ( integral )?( T( rand<int>( 0, 1 )*2 - 1 ) ):( rand<T>( T(0.9), T(1.1) ) );
+      }
+   }
+
+   const TMT B( A ), D( C );
+
+   // Reference results
+   VT  rowsum( m, T(0) ), rowmin( m, T(0) ), rowmax( m, T(0) ), rowprod( m, T(0) );
+   TVT colsum( n, T(0) ), colmin( n, T(0) ), colmax( n, T(0) ), colprod( n, T(0) );
+   VT  all( m*n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const TVT r( row( A, i ) ), s( row( C, i ) );
+      rowsum[i]  = reference( r, blaze::Add()  );
+      rowmin[i]  = reference( r, blaze::Min()  );
+      rowmax[i]  = reference( r, blaze::Max()  );
+      rowprod[i] = reference( s, blaze::Mult() );
+      subvector( all, i*n, n ) = trans( r );
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const VT r( column( A, j ) ), s( column( C, j ) );
+      colsum[j]  = reference( r, blaze::Add()  );
+      colmin[j]  = reference( r, blaze::Min()  );
+      colmax[j]  = reference( r, blaze::Max()  );
+      colprod[j] = reference( s, blaze::Mult() );
+   }
+
+   const T scale( T(10)*T( ( m > n )?( m ):( n ) ) );
+   const T total( reference( all, blaze::Add() ) );
+
+   // Total reductions
+   checkValue( "sum( A )", sum( A ), total, absSum( all ) );
+   checkValue( "sum( B )", sum( B ), total, absSum( all ) );
+   checkValue( "sum( trans( A ) )", sum( trans( A ) ), total, absSum( all ) );
+   checkValue( "sum( A + B )", sum( A + B ), T(2)*total, T(2)*absSum( all ) );
+   checkValue( "min( A )", min( A ), reference( all, blaze::Min() ), T(0) );
+   checkValue( "min( B )", min( B ), reference( all, blaze::Min() ), T(0) );
+   checkValue( "max( A )", max( A ), reference( all, blaze::Max() ), T(0) );
+   checkValue( "max( B )", max( B ), reference( all, blaze::Max() ), T(0) );
+
+   // Row-wise reductions
+   checkVector( "sum<rowwise>( A )", blaze::sum<rowwise>( A ), rowsum, scale );
+   checkVector( "sum<rowwise>( B )", blaze::sum<rowwise>( B ), rowsum, scale );
+   checkVector( "min<rowwise>( A )", blaze::min<rowwise>( A ), rowmin, T(0) );
+   checkVector( "min<rowwise>( B )", blaze::min<rowwise>( B ), rowmin, T(0) );
+   checkVector( "max<rowwise>( A )", blaze::max<rowwise>( A ), rowmax, T(0) );
+   checkVector( "max<rowwise>( B )", blaze::max<rowwise>( B ), rowmax, T(0) );
+   checkVector( "prod<rowwise>( C )", blaze::prod<rowwise>( C ), rowprod, T(1) );
+   checkVector( "prod<rowwise>( D )", blaze::prod<rowwise>( D ), rowprod, T(1) );
+   checkVector( "sum<rowwise>( A + B )", blaze::sum<rowwise>( A + B ),
+                VT( T(2)*rowsum ), T(2)*scale );
+
+   // Column-wise reductions
+   checkVector( "sum<columnwise>( A )", blaze::sum<columnwise>( A ), colsum, scale );
+   checkVector( "sum<columnwise>( B )", blaze::sum<columnwise>( B ), colsum, scale );
+   checkVector( "min<columnwise>( A )", blaze::min<columnwise>( A ), colmin, T(0) );
+   checkVector( "min<columnwise>( B )", blaze::min<columnwise>( B ), colmin, T(0) );
+   checkVector( "max<columnwise>( A )", blaze::max<columnwise>( A ), colmax, T(0) );
+   checkVector( "max<columnwise>( B )", blaze::max<columnwise>( B ), colmax, T(0) );
+   checkVector( "prod<columnwise>( C )", blaze::prod<columnwise>( C ), colprod, T(1) );
+   checkVector( "prod<columnwise>( D )", blaze::prod<columnwise>( D ), colprod, T(1) );
+   checkVector( "reduce<columnwise>( A, Add() )", blaze::reduce<columnwise>( A, blaze::Add() ),
+                colsum, scale );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the norm functions of dense vectors and dense matrices.
+//
+// \param n The size of the dense vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the norm functions of dense vectors of size \a n and of dense matrices
+// with \a n rows. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Element type of the dense vectors
+void OperationTest::testNorms( size_t n )
+{
+   using blaze::rand;
+
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>      MT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>   TMT;
+
+   test_ = "Norm functions";
+
+   VT a( n );
+   MT A( n, 3UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = rand<T>( T(-4), T(4) );
+      for( size_t j=0UL; j<3UL; ++j )
+         A(i,j) = rand<T>( T(-4), T(4) );
+   }
+
+   const TMT B( A );
+
+   T l1( 0 ), l2( 0 ), l3( 0 ), linf( 0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      l1  += std::abs( a[i] );
+      l2  += a[i] * a[i];
+      l3  += std::pow( std::abs( a[i] ), T(3) );
+      linf = std::max( linf, std::abs( a[i] ) );
+   }
+
+   checkValue( "l1Norm( a )", l1Norm( a ), l1, l1 );
+   checkValue( "sqrNorm( a )", sqrNorm( a ), l2, l2 );
+   checkValue( "l2Norm( a )", l2Norm( a ), std::sqrt( l2 ), std::sqrt( l2 ) );
+   checkValue( "length( a )", length( a ), std::sqrt( l2 ), std::sqrt( l2 ) );
+   checkValue( "sqrLength( a )", sqrLength( a ), l2, l2 );
+   checkValue( "linfNorm( a )", linfNorm( a ), linf, T(0) );
+   checkValue( "lpNorm( a, 1 )", lpNorm( a, 1 ), l1, l1 );
+   checkValue( "lpNorm( a, 2 )", lpNorm( a, 2 ), std::sqrt( l2 ), std::sqrt( l2 ) );
+   checkValue( "lpNorm( a, 3 )", lpNorm( a, 3 ),
+               std::pow( l3, T(1)/T(3) ), std::pow( l3, T(1)/T(3) ) );
+   checkValue( "l1Norm( a - a )", l1Norm( a - a ), T(0), T(0) );
+
+   try {
+      lpNorm( a, 0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid norm order of lpNorm() not detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   T m1( 0 ), m2( 0 ), minf( 0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         m1  += std::abs( A(i,j) );
+         m2  += A(i,j) * A(i,j);
+         minf = std::max( minf, std::abs( A(i,j) ) );
+      }
+   }
+
+   checkValue( "l1Norm( A )", l1Norm( A ), m1, m1 );
+   checkValue( "l1Norm( B )", l1Norm( B ), m1, m1 );
+   checkValue( "sqrNorm( A )", sqrNorm( A ), m2, m2 );
+   checkValue( "l2Norm( B )", l2Norm( B ), std::sqrt( m2 ), std::sqrt( m2 ) );
+   checkValue( "linfNorm( A )", linfNorm( A ), minf, T(0) );
+   checkValue( "linfNorm( B )", linfNorm( B ), minf, T(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduction operations for empty operands, ties and integral norms.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::testSpecialValues()
+{
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   test_ = "Special values";
+
+   {
+      blaze::DynamicVector<double> a;
+
+      checkValue( "sum( empty vector )", sum( a ), 0.0, 0.0 );
+      checkValue( "prod( empty vector )", prod( a ), 0.0, 0.0 );
+      checkValue( "min( empty vector )", min( a ), 0.0, 0.0 );
+      checkValue( "l2Norm( empty vector )", l2Norm( a ), 0.0, 0.0 );
+      checkIndex( "argmin( empty vector )", argmin( a ), 0UL );
+      checkIndex( "argmax( empty vector )", argmax( a ), 0UL );
+   }
+
+   {
+      blaze::DynamicMatrix<float> A( 0UL, 5UL );
+
+      checkValue( "sum( empty matrix )", sum( A ), 0.0F, 0.0F );
+      checkVector( "sum<rowwise>( empty matrix )", blaze::sum<rowwise>( A ),
+                   blaze::DynamicVector<float,blaze::columnVector>(), 0.0F );
+      checkVector( "sum<columnwise>( empty matrix )", blaze::sum<columnwise>( A ),
+                   blaze::DynamicVector<float,blaze::rowVector>( 5UL, 0.0F ), 0.0F );
+   }
+
+   {
+      blaze::DynamicVector<int> a( 11UL, 3 );
+      a[2] = -1; a[5] = -1; a[7] = 4; a[9] = 4;
+
+      checkIndex( "argmin( ties )", argmin( a ), 2UL );
+      checkIndex( "argmax( ties )", argmax( a ), 7UL );
+   }
+
+   {
+      blaze::DynamicVector<int> a( 25UL, 3 );
+      a[4] = -4;
+
+      checkValue( "l2Norm( integral vector )", l2Norm( a ), std::sqrt( 232.0 ), 20.0 );
+      checkValue( "l1Norm( integral vector )", l1Norm( a ), 76, 0 );
+      checkValue( "linfNorm( integral vector )", linfNorm( a ), 4, 0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduction operations on views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reduction of subvectors, rows, columns and submatrices, which may
+// start at unaligned positions. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testViews()
+{
+   using blaze::rand;
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>     TVT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      MT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>   TMT;
+
+   test_ = "Reduction of views";
+
+   VT a( 43UL );
+   MT A( 17UL, 23UL );
+
+   randomize( a, -5.0, 5.0 );
+   randomize( A, -5.0, 5.0 );
+
+   const TMT B( A );
+
+   {
+      const VT s( subvector( a, 3UL, 29UL ) );
+      checkValue( "sum( subvector( a ) )", sum( subvector( a, 3UL, 29UL ) ),
+                  reference( s, blaze::Add() ), absSum( s ) );
+      checkValue( "max( subvector( a ) )", max( subvector( a, 3UL, 29UL ) ),
+                  reference( s, blaze::Max() ), 0.0 );
+   }
+
+   {
+      const TVT r( row( A, 5UL ) );
+      checkValue( "sum( row( A ) )", sum( row( A, 5UL ) ),
+                  reference( r, blaze::Add() ), absSum( r ) );
+      checkValue( "min( row( B ) )", min( row( B, 5UL ) ), reference( r, blaze::Min() ), 0.0 );
+   }
+
+   {
+      const VT c( column( A, 7UL ) );
+      checkValue( "sum( column( B ) )", sum( column( B, 7UL ) ),
+                  reference( c, blaze::Add() ), absSum( c ) );
+      checkValue( "max( column( A ) )", max( column( A, 7UL ) ),
+                  reference( c, blaze::Max() ), 0.0 );
+   }
+
+   {
+      const MT S( submatrix( A, 3UL, 5UL, 9UL, 13UL ) );
+      checkValue( "sum( submatrix( A ) )", sum( submatrix( A, 3UL, 5UL, 9UL, 13UL ) ),
+                  sum( S ), 5.0*9.0*13.0 );
+      checkValue( "max( submatrix( B ) )", max( submatrix( B, 3UL, 5UL, 9UL, 13UL ) ),
+                  max( S ), 0.0 );
+      checkVector( "sum<rowwise>( submatrix( A ) )",
+                   blaze::sum<rowwise>( submatrix( A, 3UL, 5UL, 9UL, 13UL ) ),
+                   blaze::sum<rowwise>( S ), 5.0*13.0 );
+      checkVector( "sum<columnwise>( submatrix( B ) )",
+                   blaze::sum<columnwise>( submatrix( B, 3UL, 5UL, 9UL, 13UL ) ),
+                   blaze::sum<columnwise>( S ), 5.0*9.0 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reduce() function with custom reduction operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reduce() function with a custom vectorizable and a custom
+// non-vectorizable reduction operation. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testCustomOperation()
+{
+   using blaze::rowwise;
+
+   typedef blaze::DynamicVector<float,blaze::columnVector>  VT;
+   typedef blaze::DynamicMatrix<float,blaze::columnMajor>   MT;
+
+   test_ = "Custom reduction operations";
+
+   VT a( 37UL );
+   MT A( 13UL, 11UL );
+
+   randomize( a, -5.0F, 5.0F );
+   randomize( A, -5.0F, 5.0F );
+
+   checkValue( "reduce( a, Plus() )", reduce( a, Plus() ),
+               reference( a, blaze::Add() ), absSum( a ) );
+   checkValue( "reduce( a, AbsMax() )", reduce( a, AbsMax() ), reference( a, AbsMax() ), 0.0F );
+   checkValue( "reduce( A, Plus() )", reduce( A, Plus() ), sum( A ), 5.0F*13.0F*11.0F );
+   checkVector( "reduce<rowwise>( A, AbsMax() )", blaze::reduce<rowwise>( A, AbsMax() ),
+                blaze::reduce<rowwise>( blaze::DynamicMatrix<float>( A ), AbsMax() ), 0.0F );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a reduction operation with the expected result.
+//
+// \param op The label of the tested operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \param scale The magnitude of the accumulated values.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+//
+// Two values are considered equal if they differ by at most 64 epsilon relative to the larger
+// of 1 and the given \a scale. Integral results are required to be identical.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected, T scale ) const
+{
+   const T tolerance( T(64) * std::numeric_limits<T>::epsilon() *
+                      std::max( std::abs( scale ), T(1) ) );
+
+   if( std::abs( result - expected ) > tolerance ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << op << " failed\n"
+          << " Details:\n"
+          << "   Result         = " << result << "\n"
+          << "   Expected value = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a partial reduction with the expected result.
+//
+// \param op The label of the tested operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \param scale The magnitude of the accumulated values.
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected result
+void OperationTest::checkVector( const std::string& op, const VT1& result, const VT2& expected,
+                                 typename VT2::ElementType scale ) const
+{
+   if( result.size() != expected.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size of " << op << " result\n"
+          << " Details:\n"
+          << "   Size          = " << result.size() << "\n"
+          << "   Expected size = " << expected.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue( label.str(), result[i], expected[i], scale );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a computed index with the expected index.
+//
+// \param op The label of the tested operation.
+// \param result The computed index.
+// \param expected The expected index.
+// \return void
+// \exception std::runtime_error Index mismatch detected.
+*/
+void OperationTest::checkIndex( const std::string& op, size_t result, size_t expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << op << " failed\n"
+          << " Details:\n"
+          << "   Result         = " << result << "\n"
+          << "   Expected index = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scalar reference implementation of the reduction of a dense vector.
+//
+// \param v The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the sequential reduction (0 for an empty vector).
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+typename VT::ElementType OperationTest::reference( const VT& v, OP op )
+{
+   typedef typename VT::ElementType  ET;
+
+   if( v.size() == 0UL ) return ET();
+
+   ET redux( v[0UL] );
+   for( size_t i=1UL; i<v.size(); ++i )
+      redux = op( redux, v[i] );
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sum of the absolute values of the elements of a dense vector.
+//
+// \param v The given dense vector.
+// \return The sum of the absolute values.
+*/
+template< typename VT >  // Type of the dense vector
+typename VT::ElementType OperationTest::absSum( const VT& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   ET sum( 0 );
+   for( size_t i=0UL; i<v.size(); ++i )
+      sum += std::abs( v[i] );
+   return sum;
+}
+//*************************************************************************************************
+
+} // namespace reduction
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running reduction operation test..." << std::endl;
+
+   try
+   {
+      RUN_REDUCTION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during reduction operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
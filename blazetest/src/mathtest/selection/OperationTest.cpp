@@ -0,0 +1,830 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/selection/OperationTest.cpp
+//  \brief Source file for the selection operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/selection/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace selection {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   testSetup();
+
+   for( size_t n=0UL; n<=33UL; ++n ) {
+      testElements<double>( n, n );
+      testElements<double>( n, n/2UL );
+      testElements<float >( n, n );
+      testElements<int   >( n, n/3UL );
+   }
+
+   for( size_t n=1UL; n<=33UL; ++n ) {
+      for( ptrdiff_t stride=-4L; stride<=4L; ++stride ) {
+         if( stride == 0L ) continue;
+         testStridedSubvector<double>( n, stride );
+         testStridedSubvector<float >( n, stride );
+         testStridedSubvector<int   >( n, stride );
+      }
+   }
+
+   for( size_t m=0UL; m<=19UL; m+=3UL ) {
+      for( size_t n=0UL; n<=19UL; n+=2UL ) {
+         testRows<double,rowMajor   >( m, n );
+         testRows<double,columnMajor>( m, n );
+         testRows<float ,columnMajor>( m, n );
+         testRows<int   ,rowMajor   >( m, n );
+         testColumns<double,rowMajor   >( m, n );
+         testColumns<double,columnMajor>( m, n );
+         testColumns<float ,rowMajor   >( m, n );
+         testColumns<int   ,columnMajor>( m, n );
+      }
+   }
+
+   testElements<double>( 1025UL, 700UL );
+   testStridedSubvector<double>( 1025UL, -3L );
+   testRows<double,rowMajor>( 131UL, 67UL );
+   testColumns<double,rowMajor>( 67UL, 131UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DenseElements class template.
+//
+// \param n The size of the underlying dense vector.
+// \param k The number of selected elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations and the arithmetic
+// operations of a selection of \a k elements of a dense vector of size \a n. The result of
+// every write operation is compared to the complete expected vector in order to detect
+// modifications of elements outside of the selection.
+*/
+template< typename T >  // Element type
+void OperationTest::testElements( size_t n, size_t k )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>         RMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>     VT;
+   typedef blaze::CompressedVector<T,blaze::columnVector>  SVT;
+
+   std::ostringstream oss;
+   oss << "DenseElements (n=" << n << ",k=" << k << ")";
+   test_ = oss.str();
+
+   const Indices indices   ( selection( n, k, true  ) );
+   const Indices duplicates( selection( n, k, false ) );
+
+   VT x( n ), y( k );
+   RMT A( k, k );
+
+   randomize( x );
+   randomize( y );
+   randomize( A );
+
+   VT ref( k );
+   for( size_t i=0UL; i<k; ++i )
+      ref[i] = x[indices[i]];
+
+   checkValue<size_t>( "Size", elements( x, indices ).size(), k );
+   checkVector( "Gather", VT( elements( x, indices ) ), ref );
+   checkVector( "Gather from an array", VT( elements( x, &indices[0], k ) ), ref );
+   checkVector( "Addition", VT( elements( x, indices ) + y ), VT( ref + y ) );
+   checkVector( "Multiplication with a matrix", VT( A * elements( x, indices ) ), VT( A * ref ) );
+   checkValue<T>( "Inner product", trans( elements( x, indices ) ) * y, trans( ref ) * y );
+
+   VT z( x ), expected( x );
+
+   elements( z, indices ) = y;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] = y[i];
+   checkVector( "Assignment", z, expected );
+
+   z = x;
+   expected = x;
+   elements( z, duplicates ) = y;
+   for( size_t i=0UL; i<k; ++i )
+      expected[duplicates[i]] = y[i];
+   checkVector( "Assignment with duplicate indices", z, expected );
+
+   z = x;
+   elements( z, indices ) = T( 3 );
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] = T( 3 );
+   checkVector( "Homogeneous assignment", z, expected );
+
+   z = x;
+   SVT s( k );
+   if( k > 2UL ) s[2] = T( 5 );
+   elements( z, indices ) = s;
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] = s[i];
+   checkVector( "Assignment of a sparse vector", z, expected );
+
+   z = x;
+   elements( z, indices ) += y;
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] += y[i];
+   checkVector( "Addition assignment", z, expected );
+
+   elements( z, indices ) -= y;
+   checkVector( "Subtraction assignment", z, x );
+
+   elements( z, indices ) *= y;
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] *= y[i];
+   checkVector( "Multiplication assignment", z, expected );
+
+   z = x;
+   elements( z, indices ) *= T( 2 );
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] *= T( 2 );
+   checkVector( "Multiplication with a scalar", z, expected );
+
+   elements( z, indices ) /= T( 2 );
+   checkVector( "Division by a scalar", z, x );
+
+   elements( z, indices ) = A * elements( z, indices );
+   expected = x;
+   const VT tmp( A * ref );
+   for( size_t i=0UL; i<k; ++i )
+      expected[indices[i]] = tmp[i];
+   checkVector( "Aliased multiplication", z, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DenseStridedSubvector class template.
+//
+// \param n The size of the underlying dense vector.
+// \param stride The stride of the subvector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations and the arithmetic
+// operations of the longest strided subvector with the given stride of a dense vector of
+// size \a n. Subvectors with a positive stride start at the first element, subvectors with
+// a negative stride start at the last element of the vector.
+*/
+template< typename T >  // Element type
+void OperationTest::testStridedSubvector( size_t n, ptrdiff_t stride )
+{
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>      RMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>  VT;
+
+   std::ostringstream oss;
+   oss << "DenseStridedSubvector (n=" << n << ",stride=" << stride << ")";
+   test_ = oss.str();
+
+   const size_t index( ( stride > 0L )?( 0UL ):( n-1UL ) );
+   const size_t step ( ( stride > 0L )?( stride ):( -stride ) );
+   const size_t k    ( ( n-1UL ) / step + 1UL );
+
+   VT x( n ), y( k );
+   RMT A( k, k );
+
+   randomize( x );
+   randomize( y );
+   randomize( A );
+
+   VT ref( k );
+   for( size_t i=0UL; i<k; ++i )
+      ref[i] = x[index+i*stride];
+
+   checkValue<size_t>( "Size", subvector( x, index, k, stride ).size(), k );
+   checkVector( "Gather", VT( subvector( x, index, k, stride ) ), ref );
+   checkVector( "Addition", VT( subvector( x, index, k, stride ) + y ), VT( ref + y ) );
+   checkVector( "Multiplication with a matrix", VT( A * subvector( x, index, k, stride ) ), VT( A * ref ) );
+
+   VT reversed( n );
+   for( size_t i=0UL; i<n; ++i )
+      reversed[i] = x[n-1UL-i];
+   checkVector( "Reverse", VT( reverse( x ) ), reversed );
+
+   VT z( x ), expected( x );
+
+   subvector( z, index, k, stride ) = y;
+   for( size_t i=0UL; i<k; ++i )
+      expected[index+i*stride] = y[i];
+   checkVector( "Assignment", z, expected );
+
+   z = x;
+   subvector( z, index, k, stride ) += y;
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[index+i*stride] += y[i];
+   checkVector( "Addition assignment", z, expected );
+
+   subvector( z, index, k, stride ) -= y;
+   checkVector( "Subtraction assignment", z, x );
+
+   subvector( z, index, k, stride ) *= T( 2 );
+   expected = x;
+   for( size_t i=0UL; i<k; ++i )
+      expected[index+i*stride] *= T( 2 );
+   checkVector( "Multiplication with a scalar", z, expected );
+
+   subvector( z, index, k, stride ) /= T( 2 );
+   checkVector( "Division by a scalar", z, x );
+
+   subvector( z, index, k, stride ) = A * subvector( z, index, k, stride );
+   expected = x;
+   const VT tmp( A * ref );
+   for( size_t i=0UL; i<k; ++i )
+      expected[index+i*stride] = tmp[i];
+   checkVector( "Aliased multiplication", z, expected );
+
+   z = x;
+   reverse( z ) = z;
+   checkVector( "Aliased reversal", z, reversed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DenseRows class template.
+//
+// \param m The number of rows of the underlying dense matrix.
+// \param n The number of columns of the underlying dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations and the arithmetic
+// operations of a selection of rows of a dense matrix with the given storage order. The
+// result of every write operation is compared to the complete expected matrix in order to
+// detect modifications of elements outside of the selection.
+*/
+template< typename T  // Element type
+        , bool SO >   // Storage order
+void OperationTest::testRows( size_t m, size_t n )
+{
+   typedef blaze::DynamicMatrix<T,SO>                      MT;
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>         RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>      CMT;
+   typedef blaze::CompressedMatrix<T,blaze::rowMajor>      SMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>     VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>        TVT;
+
+   std::ostringstream oss;
+   oss << "DenseRows<" << ( SO ? "columnMajor" : "rowMajor" ) << "> (m=" << m << ",n=" << n << ")";
+   test_ = oss.str();
+
+   const size_t k( m/2UL + 1UL );
+   const Indices indices   ( selection( m, ( m > 0UL )?( k ):( 0UL ), true  ) );
+   const Indices duplicates( selection( m, ( m > 0UL )?( k ):( 0UL ), false ) );
+   const size_t s( indices.size() );
+
+   MT A( m, n );
+   RMT B( s, n ), W( n, n );
+   VT x( n );
+
+   randomize( A );
+   randomize( B );
+   randomize( W );
+   randomize( x );
+
+   RMT ref( s, n );
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = A(indices[i],j);
+
+   checkValue<size_t>( "Rows", rows( A, indices ).rows(), s );
+   checkValue<size_t>( "Columns", rows( A, indices ).columns(), n );
+   checkMatrix( "Row-major gather", RMT( rows( A, indices ) ), ref );
+   checkMatrix( "Column-major gather", CMT( rows( A, indices ) ), ref );
+   checkMatrix( "Addition", RMT( rows( A, indices ) + B ), RMT( ref + B ) );
+   checkMatrix( "Multiplication with a matrix", RMT( rows( A, indices ) * W ), RMT( ref * W ) );
+   checkVector( "Multiplication with a vector", VT( rows( A, indices ) * x ), VT( ref * x ) );
+   if( s > 1UL )
+      checkVector( "Row of a row selection", TVT( row( rows( A, indices ), 1UL ) ), TVT( row( ref, 1UL ) ) );
+   if( s > 1UL && n > 1UL )
+      checkMatrix( "Submatrix of a row selection", RMT( submatrix( rows( A, indices ), 1UL, 1UL, s-1UL, n-1UL ) ),
+                   RMT( submatrix( ref, 1UL, 1UL, s-1UL, n-1UL ) ) );
+
+   MT C( A ), expected( A );
+
+   rows( C, indices ) = B;
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(indices[i],j) = B(i,j);
+   checkMatrix( "Assignment of a row-major matrix", C, expected );
+
+   C = A;
+   rows( C, indices ) = CMT( B );
+   checkMatrix( "Assignment of a column-major matrix", C, expected );
+
+   C = A;
+   expected = A;
+   rows( C, duplicates ) = B;
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(duplicates[i],j) = B(i,j);
+   checkMatrix( "Assignment with duplicate indices", C, expected );
+
+   C = A;
+   SMT S( s, n );
+   if( s > 1UL && n > 2UL ) S(1,2) = T( 5 );
+   rows( C, indices ) = S;
+   expected = A;
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(indices[i],j) = S(i,j);
+   checkMatrix( "Assignment of a sparse matrix", C, expected );
+
+   C = A;
+   rows( C, indices ) += B;
+   expected = A;
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(indices[i],j) += B(i,j);
+   checkMatrix( "Addition assignment", C, expected );
+
+   rows( C, indices ) -= CMT( B );
+   checkMatrix( "Subtraction assignment", C, A );
+
+   rows( C, indices ) += S;
+   rows( C, indices ) -= S;
+   checkMatrix( "Sparse addition and subtraction assignment", C, A );
+
+   rows( C, indices ) *= T( 2 );
+   expected = A;
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(indices[i],j) *= T( 2 );
+   checkMatrix( "Multiplication with a scalar", C, expected );
+
+   rows( C, indices ) /= T( 2 );
+   checkMatrix( "Division by a scalar", C, A );
+
+   rows( C, indices ) = rows( C, indices ) * W;
+   expected = A;
+   const RMT tmp( ref * W );
+   for( size_t i=0UL; i<s; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         expected(indices[i],j) = tmp(i,j);
+   checkMatrix( "Aliased multiplication", C, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DenseColumns class template.
+//
+// \param m The number of rows of the underlying dense matrix.
+// \param n The number of columns of the underlying dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, the assignment operations and the arithmetic
+// operations of a selection of columns of a dense matrix with the given storage order. The
+// result of every write operation is compared to the complete expected matrix in order to
+// detect modifications of elements outside of the selection.
+*/
+template< typename T  // Element type
+        , bool SO >   // Storage order
+void OperationTest::testColumns( size_t m, size_t n )
+{
+   typedef blaze::DynamicMatrix<T,SO>                      MT;
+   typedef blaze::DynamicMatrix<T,blaze::rowMajor>         RMT;
+   typedef blaze::DynamicMatrix<T,blaze::columnMajor>      CMT;
+   typedef blaze::CompressedMatrix<T,blaze::columnMajor>   SMT;
+   typedef blaze::DynamicVector<T,blaze::columnVector>     VT;
+   typedef blaze::DynamicVector<T,blaze::rowVector>        TVT;
+
+   std::ostringstream oss;
+   oss << "DenseColumns<" << ( SO ? "columnMajor" : "rowMajor" ) << "> (m=" << m << ",n=" << n << ")";
+   test_ = oss.str();
+
+   const size_t k( n/2UL + 1UL );
+   const Indices indices   ( selection( n, ( n > 0UL )?( k ):( 0UL ), true  ) );
+   const Indices duplicates( selection( n, ( n > 0UL )?( k ):( 0UL ), false ) );
+   const size_t s( indices.size() );
+
+   MT A( m, n );
+   CMT B( m, s ), W( m, m );
+   TVT x( m );
+
+   randomize( A );
+   randomize( B );
+   randomize( W );
+   for( size_t i=0UL; i<m; ++i )
+      x[i] = T( blaze::rand<int>( -5, 5 ) );
+
+   CMT ref( m, s );
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         ref(i,j) = A(i,indices[j]);
+
+   checkValue<size_t>( "Rows", columns( A, indices ).rows(), m );
+   checkValue<size_t>( "Columns", columns( A, indices ).columns(), s );
+   checkMatrix( "Row-major gather", RMT( columns( A, indices ) ), ref );
+   checkMatrix( "Column-major gather", CMT( columns( A, indices ) ), ref );
+   checkMatrix( "Addition", CMT( columns( A, indices ) + B ), CMT( ref + B ) );
+   checkMatrix( "Multiplication with a matrix", CMT( W * columns( A, indices ) ), CMT( W * ref ) );
+   checkVector( "Multiplication with a vector", TVT( x * columns( A, indices ) ), TVT( x * ref ) );
+   if( s > 1UL )
+      checkVector( "Column of a column selection", VT( column( columns( A, indices ), 1UL ) ), VT( column( ref, 1UL ) ) );
+
+   MT C( A ), expected( A );
+
+   columns( C, indices ) = B;
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,indices[j]) = B(i,j);
+   checkMatrix( "Assignment of a column-major matrix", C, expected );
+
+   C = A;
+   columns( C, indices ) = RMT( B );
+   checkMatrix( "Assignment of a row-major matrix", C, expected );
+
+   C = A;
+   expected = A;
+   columns( C, duplicates ) = B;
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,duplicates[j]) = B(i,j);
+   checkMatrix( "Assignment with duplicate indices", C, expected );
+
+   C = A;
+   SMT S( m, s );
+   if( m > 2UL && s > 1UL ) S(2,1) = T( 5 );
+   columns( C, indices ) = S;
+   expected = A;
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,indices[j]) = S(i,j);
+   checkMatrix( "Assignment of a sparse matrix", C, expected );
+
+   C = A;
+   columns( C, indices ) += B;
+   expected = A;
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,indices[j]) += B(i,j);
+   checkMatrix( "Addition assignment", C, expected );
+
+   columns( C, indices ) -= RMT( B );
+   checkMatrix( "Subtraction assignment", C, A );
+
+   columns( C, indices ) += S;
+   columns( C, indices ) -= S;
+   checkMatrix( "Sparse addition and subtraction assignment", C, A );
+
+   columns( C, indices ) *= T( 2 );
+   expected = A;
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,indices[j]) *= T( 2 );
+   checkMatrix( "Multiplication with a scalar", C, expected );
+
+   columns( C, indices ) /= T( 2 );
+   checkMatrix( "Division by a scalar", C, A );
+
+   columns( C, indices ) = W * columns( C, indices );
+   expected = A;
+   const CMT tmp( W * ref );
+   for( size_t j=0UL; j<s; ++j )
+      for( size_t i=0UL; i<m; ++i )
+         expected(i,indices[j]) = tmp(i,j);
+   checkMatrix( "Aliased multiplication", C, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setup of the selection views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid index lists and invalid strides are rejected by means of a
+// \a std::invalid_argument exception.
+*/
+void OperationTest::testSetup()
+{
+   test_ = "Selection setup";
+
+   blaze::DynamicVector<double> x( 10UL );
+   blaze::DynamicMatrix<double> A( 5UL, 7UL );
+
+   const Indices invalid( 1UL, 10UL );
+
+   try {
+      elements( x, invalid );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid element index not detected\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      subvector( x, 0UL, 4UL, 3L );
+      subvector( x, 9UL, 4UL, -3L );
+   }
+   catch( std::invalid_argument& ) {
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Valid strided subvector rejected\n" );
+   }
+
+   try {
+      subvector( x, 1UL, 4UL, 3L );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid strided subvector not detected\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      subvector( x, 0UL, 4UL, 0L );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Zero stride not detected\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      rows( A, Indices( 1UL, 5UL ) );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid row index not detected\n" );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      columns( A, Indices( 1UL, 7UL ) );
+      throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid column index not detected\n" );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking a single value.
+//
+// \param op The label of the performed operation.
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T >  // Type of the result
+void OperationTest::checkValue( const std::string& op, T result, T expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect " << op << " result\n"
+          << " Details:\n"
+          << "   Result   = " << result << "\n"
+          << "   Expected = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a vector result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result vector.
+// \param expected The expected result vector.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void OperationTest::checkVector( const std::string& op, const VT1& result,
+                                 const VT2& expected ) const
+{
+   typedef typename VT1::ElementType  ET;
+
+   checkValue<size_t>( op + " size", result.size(), expected.size() );
+
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      std::ostringstream label;
+      label << op << " at index " << i;
+      checkValue<ET>( label.str(), result[i], expected[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a matrix result.
+//
+// \param op The label of the performed operation.
+// \param result The computed result matrix.
+// \param expected The expected result matrix.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename MT1    // Type of the result matrix
+        , typename MT2 >  // Type of the expected matrix
+void OperationTest::checkMatrix( const std::string& op, const MT1& result,
+                                 const MT2& expected ) const
+{
+   typedef typename MT1::ElementType  ET;
+
+   checkValue<size_t>( op + " rows", result.rows(), expected.rows() );
+   checkValue<size_t>( op + " columns", result.columns(), expected.columns() );
+
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j ) {
+         std::ostringstream label;
+         label << op << " at index (" << i << "," << j << ")";
+         checkValue<ET>( label.str(), result(i,j), expected(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense column vector with small random integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename VT >  // Type of the dense vector
+void OperationTest::randomize( blaze::DenseVector<VT,false>& v )
+{
+   typedef typename VT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~v).size(); ++i )
+      (~v)[i] = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a dense matrix with small random integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void OperationTest::randomize( blaze::DenseMatrix<MT,SO>& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   for( size_t i=0UL; i<(~A).rows(); ++i )
+      for( size_t j=0UL; j<(~A).columns(); ++j )
+         (~A)(i,j) = ET( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random list of indices.
+//
+// \param n The number of available indices.
+// \param k The number of indices in the list.
+// \param unique \a true in case every index may be contained at most once, \a false if not.
+// \return The list of \a k random indices in the range \f$ [0..n-1] \f$.
+//
+// In case of a list of unique indices \a k must not be larger than \a n. Otherwise the list
+// contains every index at most twice in case \a n is larger than 1.
+*/
+OperationTest::Indices OperationTest::selection( size_t n, size_t k, bool unique )
+{
+   Indices indices;
+
+   if( n == 0UL )
+      return indices;
+
+   Indices all;
+   for( size_t i=0UL; i<n; ++i )
+      all.push_back( i );
+
+   for( size_t i=n; i>1UL; --i )
+      std::swap( all[i-1UL], all[blaze::rand<size_t>( 0UL, i-1UL )] );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      indices.push_back( ( unique )?( all[i] ):( all[(i/2UL)%n] ) );
+   }
+
+   return indices;
+}
+//*************************************************************************************************
+
+} // namespace selection
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running selection operation test..." << std::endl;
+
+   try
+   {
+      RUN_SELECTION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during selection operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
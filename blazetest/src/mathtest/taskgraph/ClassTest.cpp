@@ -0,0 +1,285 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/taskgraph/ClassTest.cpp
+//  \brief Source file for the task graph evaluation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/ThreadPool.h>
+#include <blazetest/mathtest/taskgraph/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace taskgraph {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the task graph evaluation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testMatrixAddition();
+   testMatrixSubtraction();
+   testVectorAddition();
+   testNestedExpressions();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of matrix additions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent evaluation of the two multiplications of the matrix
+// additions \f$ D = A \cdot B + C \cdot E \f$ with both identical and different storage
+// orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrixAddition()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 31UL, 17UL ), B( 17UL, 23UL ), D1, D2;
+   blaze::DynamicMatrix<int,blaze::columnMajor> C( 31UL, 12UL ), E( 12UL, 23UL ), D3;
+   randomize( A, -10, 10 );
+   randomize( B, -10, 10 );
+   randomize( C, -10, 10 );
+   randomize( E, -10, 10 );
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref1( A * B + A * B );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref2( A * B + C * E );
+
+   BLAZE_TASK_GRAPH_SECTION( pool ) {
+      D1 = A * B + A * B;
+      D2 = A * B + C * E;
+      D3 = A * B + C * E;
+   }
+
+   if( D1 != ref1 || D2 != ref2 || D3 != ref2 ) {
+      std::ostringstream oss;
+      oss << " Test: Concurrent evaluation of D = A*B + C*E\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << D2 << "\n"
+          << "   Expected result:\n" << ref2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of matrix subtractions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent evaluation of the two multiplications of the matrix
+// subtractions \f$ D = A \cdot B - C \cdot E \f$ with both identical and different storage
+// orders. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrixSubtraction()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 19UL, 27UL ), B( 27UL, 21UL ), D1, D2;
+   blaze::DynamicMatrix<int,blaze::columnMajor> C( 19UL, 8UL ), E( 8UL, 21UL );
+   randomize( A, -10, 10 );
+   randomize( B, -10, 10 );
+   randomize( C, -10, 10 );
+   randomize( E, -10, 10 );
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref1( A * B - trans( trans( B ) * trans( A ) ) );
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref2( A * B - C * E );
+
+   BLAZE_TASK_GRAPH_SECTION( pool ) {
+      D1 = A * B - trans( trans( B ) * trans( A ) );
+      D2 = A * B - C * E;
+   }
+
+   if( D1 != ref1 || D2 != ref2 ) {
+      std::ostringstream oss;
+      oss << " Test: Concurrent evaluation of D = A*B - C*E\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << D2 << "\n"
+          << "   Expected result:\n" << ref2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of vector additions and subtractions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent evaluation of the two matrix/vector multiplications of
+// the expressions \f$ y = A \cdot x + B \cdot z \f$ and \f$ y = A \cdot x - B \cdot z \f$. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVectorAddition()
+{
+   blaze::ThreadPool pool( 2UL );
+
+   blaze::DynamicMatrix<int> A( 40UL, 25UL ), B( 40UL, 33UL );
+   blaze::DynamicVector<int> x( 25UL ), z( 33UL ), y1, y2;
+   randomize( A, -10, 10 );
+   randomize( B, -10, 10 );
+   randomize( x, -10, 10 );
+   randomize( z, -10, 10 );
+
+   const blaze::DynamicVector<int> ref1( A * x + B * z );
+   const blaze::DynamicVector<int> ref2( A * x - B * z );
+
+   BLAZE_TASK_GRAPH_SECTION( pool ) {
+      y1 = A * x + B * z;
+      y2 = A * x - B * z;
+   }
+
+   if( y1 != ref1 || y2 != ref2 ) {
+      std::ostringstream oss;
+      oss << " Test: Concurrent evaluation of y = A*x + B*z and y = A*x - B*z\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << y1 << "\n"
+          << "   Expected result:\n" << ref1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent evaluation of nested expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the concurrent evaluation of expressions with several levels of
+// independent subexpressions, including aliased expressions. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedExpressions()
+{
+   blaze::ThreadPool pool( 3UL );
+
+   blaze::DynamicMatrix<int> A( 24UL, 24UL ), B( 24UL, 24UL ), C( 24UL, 24UL ), D;
+   randomize( A, -5, 5 );
+   randomize( B, -5, 5 );
+   randomize( C, -5, 5 );
+
+   const blaze::DynamicMatrix<int> ref1( A * B + B * C - C * A + ( A * C - B * B ) );
+   const blaze::DynamicMatrix<int> ref2( A * B + A * C );
+
+   BLAZE_TASK_GRAPH_SECTION( pool ) {
+      D = A * B + B * C - C * A + ( A * C - B * B );
+      A = A * B + A * C;
+   }
+
+   if( D != ref1 || A != ref2 ) {
+      std::ostringstream oss;
+      oss << " Test: Concurrent evaluation of nested expressions\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result:\n" << D << "\n"
+          << "   Expected result:\n" << ref1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace taskgraph
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running task graph evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_TASKGRAPH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during task graph evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
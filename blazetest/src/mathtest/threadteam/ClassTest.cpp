@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/threadteam/ClassTest.cpp
+//  \brief Source file for the thread team SMP assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/StaticAssert.h>
+#include <blazetest/mathtest/threadteam/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace threadteam {
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_THREAD_TEAM_PARALLEL_MODE > 0 );
+
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread team SMP assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testNumThreads();
+   testDenseVector();
+   testSparseVector();
+   testDenseMatrix();
+   testSparseMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the getNumThreads() and setNumThreads() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the configuration of the number of threads of the SMP thread team. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNumThreads()
+{
+   blaze::setNumThreads( 4UL );
+
+   if( blaze::getNumThreads() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: Setting the number of threads\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Found number of threads    = " << blaze::getNumThreads() << "\n"
+          << "   Expected number of threads = 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread team based assignment, addition assignment, subtraction
+// assignment and multiplication assignment of dense vectors with both aligned and unaligned
+// operands. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseVector()
+{
+   const size_t N( 20011UL );
+
+   blaze::DynamicVector<int> a( N ), b( N ), c( N ), ref( N );
+   randomize( a, -10, 10 );
+   randomize( b, -10, 10 );
+   randomize( c, -10, 10 );
+
+   blaze::DynamicVector<int> x( a ), y( a );
+
+   BLAZE_SERIAL_SECTION {
+      ref = b + c;
+      ref += 2 * b;
+      ref -= c;
+      ref *= b;
+      subvector( ref, 3UL, N-7UL ) = subvector( c, 5UL, N-7UL );
+      x = ref;
+   }
+
+   y = b + c;
+   y += 2 * b;
+   y -= c;
+   y *= b;
+   subvector( y, 3UL, N-7UL ) = subvector( c, 5UL, N-7UL );
+
+   if( x != y ) {
+      std::ostringstream oss;
+      oss << " Test: SMP assignments of dense vectors\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Vector size = " << N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of sparse vectors to dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread team based assignment, addition assignment and subtraction
+// assignment of sparse vectors to dense vectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseVector()
+{
+   const size_t N( 30000UL );
+
+   blaze::CompressedVector<int> s( N );
+   for( size_t i=0UL; i<N; i+=7UL )
+      s[i] = static_cast<int>( i % 13UL ) - 6;
+
+   blaze::DynamicVector<int> a( N ), ref( N ), y( N );
+   randomize( a, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      ref = s;
+      ref += a + s;
+      ref -= s + a;
+   }
+
+   y = s;
+   y += a + s;
+   y -= s + a;
+
+   if( y != ref ) {
+      std::ostringstream oss;
+      oss << " Test: SMP assignments of sparse vectors\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Vector size = " << N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread team based assignment, addition assignment and subtraction
+// assignment of row-major and column-major dense matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseMatrix()
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 301UL, 257UL ), B( 301UL, 257UL ), R1, D1;
+   blaze::DynamicMatrix<int,blaze::columnMajor> C( 301UL, 257UL ), R2, D2;
+   randomize( A, -10, 10 );
+   randomize( B, -10, 10 );
+   randomize( C, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      R1 = A + B;
+      R1 += C;
+      R1 -= A;
+      R2 = A - C;
+      R2 += B;
+      R2 -= C;
+   }
+
+   D1 = A + B;
+   D1 += C;
+   D1 -= A;
+   D2 = A - C;
+   D2 += B;
+   D2 -= C;
+
+   if( D1 != R1 || D2 != R2 ) {
+      std::ostringstream oss;
+      oss << " Test: SMP assignments of dense matrices\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Row-major result correct    = " << ( D1 == R1 ) << "\n"
+          << "   Column-major result correct = " << ( D2 == R2 ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of sparse matrices to dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the thread team based assignment, addition assignment and subtraction
+// assignment of row-major and column-major sparse matrices to dense matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseMatrix()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> S( 300UL, 280UL );
+   for( size_t i=0UL; i<300UL; ++i )
+      for( size_t j=i%5UL; j<280UL; j+=5UL )
+         S(i,j) = static_cast<int>( ( i + j ) % 11UL ) - 5;
+
+   const blaze::CompressedMatrix<int,blaze::columnMajor> T( S );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> A( 300UL, 280UL ), R1, D1;
+   blaze::DynamicMatrix<int,blaze::columnMajor> R2, D2;
+   randomize( A, -10, 10 );
+
+   BLAZE_SERIAL_SECTION {
+      R1 = S;
+      R1 += A + T;
+      R1 -= S;
+      R2 = T;
+      R2 += A + S;
+      R2 -= T;
+   }
+
+   D1 = S;
+   D1 += A + T;
+   D1 -= S;
+   D2 = T;
+   D2 += A + S;
+   D2 -= T;
+
+   if( D1 != R1 || D2 != R2 ) {
+      std::ostringstream oss;
+      oss << " Test: SMP assignments of sparse matrices\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Row-major result correct    = " << ( D1 == R1 ) << "\n"
+          << "   Column-major result correct = " << ( D2 == R2 ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadteam
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread team SMP assignment test..." << std::endl;
+
+   try
+   {
+      RUN_THREADTEAM_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread team SMP assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
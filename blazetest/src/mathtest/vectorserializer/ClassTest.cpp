@@ -65,6 +65,8 @@ ClassTest::ClassTest()
 {
    testEmptyVectors();
    testRandomVectors();
+   testCompressedIndices();
+   testLegacyFormat();
    testFailures();
 }
 //*************************************************************************************************
@@ -227,6 +229,96 @@ void ClassTest::testRandomVectors()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serialization test with plain and delta-encoded sparse indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs serialization tests of sparse vectors both with plain and with
+// delta-encoded indices. The tests include vectors whose non-zero elements span several
+// blocks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompressedIndices()
+{
+   test_ = "Compressed indices";
+
+   {
+      blaze::CompressedVector<int> src( 13UL );
+      randomize( src );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedVector< blaze::StaticVector<double,3UL> > src( 13UL );
+      randomize( src );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedVector<double> src( 200000UL );
+      randomize( src, 70000UL );
+      runCompressionTests( src );
+   }
+
+   {
+      blaze::CompressedVector<float> src( 10000000UL );
+      src[      0UL] = 1.0F;
+      src[    127UL] = 2.0F;
+      src[    128UL] = 3.0F;
+      src[  16511UL] = 4.0F;
+      src[9999999UL] = 5.0F;
+      runCompressionTests( src );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with sparse vectors in the element-wise format of version 1.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of sparse vectors that have been serialized in
+// the element-wise format of version 1. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLegacyFormat()
+{
+   test_ = "Legacy format";
+
+   blaze::CompressedVector<int> ref( 7UL );
+   ref[1] = 1;
+   ref[4] = 2;
+
+   {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 1U ) << uint8_t( 2U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 7UL ) << uint64_t( 2UL )
+              << size_t( 1UL ) << 1 << size_t( 4UL ) << 2;
+
+      blaze::CompressedVector<int> dst;
+      testDeserialization( archive, dst );
+      compareVectors( ref, dst );
+   }
+
+   {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 1U ) << uint8_t( 2U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 7UL ) << uint64_t( 2UL )
+              << size_t( 1UL ) << 1 << size_t( 4UL ) << 2;
+
+      blaze::DynamicVector<int> dst;
+      testDeserialization( archive, dst );
+      compareVectors( ref, dst );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -314,6 +406,27 @@ void ClassTest::testFailures()
    }
    catch( std::runtime_error& )
    {}
+
+   try {
+      blaze::Archive<std::stringstream> archive;
+      archive << uint8_t( 2U ) << uint8_t( 2U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof(int) )
+              << uint64_t( 5UL ) << uint64_t( 2UL )
+              << uint8_t( 0U ) << uint64_t( 65536UL )
+              << uint64_t( 3UL ) << uint64_t( 1UL ) << 1 << 2;
+
+      blaze::CompressedVector<int> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decreasing index succeeded\n"
+          << " Details:\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
 }
 //*************************************************************************************************
 
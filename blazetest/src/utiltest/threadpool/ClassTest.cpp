@@ -0,0 +1,586 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/Future.h>
+#include <blaze/util/TaskGroup.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary function incrementing the given counter by the given value.
+//
+// \param counter The counter to be incremented.
+// \param value The increment.
+// \return void
+*/
+void increment( boost::atomic<size_t>* counter, size_t value )
+{
+   counter->fetch_add( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary function for the recursive parallel computation of the sum \f$ 1+...+n \f$.
+//
+// \param pool The executing thread pool.
+// \param first The first value of the range.
+// \param last The last value of the range.
+// \param result The resulting sum.
+// \return void
+*/
+void sum( blaze::ThreadPool& pool, size_t first, size_t last, size_t* result )
+{
+   if( last - first < 64UL ) {
+      size_t tmp( 0UL );
+      for( size_t i=first; i<last; ++i )
+         tmp += i;
+      *result = tmp;
+      return;
+   }
+
+   const size_t mid( first + ( last - first ) / 2UL );
+   size_t left( 0UL ), right( 0UL );
+
+   blaze::TaskGroup group( pool );
+   group.run( sum, boost::ref( pool ), first, mid, &left  );
+   group.run( sum, boost::ref( pool ), mid, last, &right );
+   group.wait();
+
+   *result = left + right;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary function scheduling the given number of increment tasks.
+//
+// \param pool The executing thread pool.
+// \param counter The counter to be incremented.
+// \param n The number of tasks to be scheduled.
+// \return void
+*/
+void produce( blaze::ThreadPool* pool, boost::atomic<size_t>* counter, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      pool->schedule( increment, counter, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary function appending the given value to the given sequence.
+//
+// \param sequence The sequence of values.
+// \param value The value to be appended.
+// \return void
+*/
+void append( std::vector<size_t>* sequence, size_t value )
+{
+   sequence->push_back( value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary function throwing a std::runtime_error exception.
+//
+// \return void
+// \exception std::runtime_error Always thrown.
+*/
+void fail()
+{
+   throw std::runtime_error( "Failing task" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of currently existing Functor instances.
+*/
+size_t instances = 0UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary functor for the test of the Task class.
+//
+// The Functor class counts its instances (including copies) and contains an array of \a N
+// bytes in order to test both the small buffer and the heap storage of the Task class.
+*/
+template< size_t N >
+struct Functor
+{
+   explicit Functor( size_t* calls ) : calls_( calls ) { data_[0] = 0; ++instances; }
+   Functor( const Functor& f ) : calls_( f.calls_ ) { data_[0] = 0; ++instances; }
+   ~Functor() { --instances; }
+   void operator()() { ++(*calls_); }
+
+   size_t* calls_;    //!< Counter for the number of calls.
+   char    data_[N];  //!< Dummy data.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testTask();
+   testSchedule();
+   testTaskGroup();
+   testResize();
+   testFuture();
+   testExternalThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Task class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the small buffer and heap storage of the Task class. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTask()
+{
+   size_t calls( 0UL );
+
+   {
+      const Functor<8UL>   smallFunctor( &calls );
+      const Functor<256UL> largeFunctor( &calls );
+
+      blaze::threadpool::Task small( smallFunctor );
+      blaze::threadpool::Task large( largeFunctor );
+      blaze::threadpool::Task copy( small );
+
+      copy = large;
+      small();
+      large();
+      copy();
+
+      if( instances != 5UL || calls != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: Copying and executing tasks\n"
+             << " Error: Invalid counter value\n"
+             << " Details:\n"
+             << "   Found counter    = " << instances << "\n"
+             << "   Expected counter = 5\n"
+             << "   Found calls      = " << calls << "\n"
+             << "   Expected calls   = 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      small.reset();
+
+      if( !small.isEmpty() || instances != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: Resetting a task\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Found counter    = " << instances << "\n"
+             << "   Expected counter = 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( instances != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: Final check of the instance counter\n"
+          << " Error: Invalid counter value\n"
+          << " Details:\n"
+          << "   Found counter    = " << instances << "\n"
+          << "   Expected counter = 0\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the schedule() function of the ThreadPool class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of fine-grained tasks and checks that all tasks are
+// executed exactly once. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testSchedule()
+{
+   const size_t N( 100000UL );
+
+   boost::atomic<size_t> counter( 0UL );
+
+   blaze::ThreadPool pool( 4UL );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.schedule( increment, &counter, 1UL );
+   }
+
+   pool.wait();
+
+   if( counter != N || !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: Scheduling " << N << " tasks\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Found counter    = " << counter << "\n"
+          << "   Expected counter = " << N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TaskGroup class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a recursive parallel computation via nested task groups. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTaskGroup()
+{
+   const size_t N( 100000UL );
+
+   blaze::ThreadPool pool( 3UL );
+
+   size_t result( 0UL );
+
+   blaze::TaskGroup group( pool );
+   group.run( sum, boost::ref( pool ), 0UL, N, &result );
+   group.wait();
+
+   if( result != N*(N-1UL)/2UL || group.pending() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: Recursive computation via nested task groups\n"
+          << " Error: Invalid result\n"
+          << " Details:\n"
+          << "   Result          = " << result << "\n"
+          << "   Expected result = " << N*(N-1UL)/2UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the ThreadPool class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly resizes a thread pool while scheduling tasks. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   const size_t sizes[] = { 2UL, 5UL, 1UL, 3UL, 3UL, 6UL, 2UL };
+   const size_t N( sizeof(sizes)/sizeof(size_t) );
+
+   boost::atomic<size_t> counter( 0UL );
+
+   blaze::ThreadPool pool( 1UL );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      pool.resize( sizes[i] );
+
+      for( size_t j=0UL; j<1000UL; ++j ) {
+         pool.schedule( increment, &counter, 1UL );
+      }
+
+      if( pool.size() != sizes[i] ) {
+         std::ostringstream oss;
+         oss << " Test: Resizing the thread pool\n"
+             << " Error: Invalid thread pool size\n"
+             << " Details:\n"
+             << "   Size          = " << pool.size() << "\n"
+             << "   Expected size = " << sizes[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   pool.wait();
+
+   if( counter != 1000UL*N ) {
+      std::ostringstream oss;
+      oss << " Test: Scheduling tasks during resize operations\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Found counter    = " << counter << "\n"
+          << "   Expected counter = " << 1000UL*N << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Future class and the launch() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the asynchronous execution of tasks, of the dependencies
+// between tasks and of the propagation of exceptions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFuture()
+{
+   blaze::ThreadPool pool( 3UL );
+
+   // Chain of dependent tasks
+   {
+      std::vector<size_t> sequence;
+
+      blaze::Future future( blaze::launch( pool, boost::bind( append, &sequence, 0UL ) ) );
+
+      for( size_t i=1UL; i<100UL; ++i ) {
+         future = blaze::launch( pool, boost::bind( append, &sequence, i ), future );
+      }
+
+      future.get();
+
+      bool ordered( sequence.size() == 100UL );
+      for( size_t i=0UL; ordered && i<100UL; ++i ) {
+         ordered = ( sequence[i] == i );
+      }
+
+      if( !future.isValid() || !future.isReady() || !ordered ) {
+         std::ostringstream oss;
+         oss << " Test: Chain of dependent tasks\n"
+             << " Error: Invalid execution order\n"
+             << " Details:\n"
+             << "   Number of executed tasks = " << sequence.size() << "\n"
+             << "   Expected number          = 100\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Two dependencies
+   {
+      boost::atomic<size_t> counter( 0UL );
+
+      const blaze::Future f1( blaze::launch( pool, boost::bind( increment, &counter, 1UL ) ) );
+      const blaze::Future f2( blaze::launch( pool, boost::bind( increment, &counter, 2UL ) ) );
+      const blaze::Future f3( blaze::launch( pool, boost::bind( increment, &counter, 4UL ), f1, f2 ) );
+
+      f3.wait();
+
+      if( !f1.isReady() || !f2.isReady() || counter != 7UL ) {
+         std::ostringstream oss;
+         oss << " Test: Task with two dependencies\n"
+             << " Error: Dependencies have not been completed\n"
+             << " Details:\n"
+             << "   Found counter    = " << counter << "\n"
+             << "   Expected counter = 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Propagation of exceptions
+   {
+      boost::atomic<size_t> counter( 0UL );
+
+      const blaze::Future f1( blaze::launch( pool, fail ) );
+      const blaze::Future f2( blaze::launch( pool, boost::bind( increment, &counter, 1UL ), f1 ) );
+
+      bool caught( false );
+
+      try {
+         f2.get();
+      }
+      catch( std::runtime_error& ) {
+         caught = true;
+      }
+
+      if( !caught || counter != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: Propagation of exceptions to dependent tasks\n"
+             << " Error: Exception has not been propagated\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Invalid futures
+   {
+      const blaze::Future future;
+      future.get();
+
+      if( future.isValid() || !future.isReady() ) {
+         std::ostringstream oss;
+         oss << " Test: Default constructed future\n"
+             << " Error: Invalid state of the future\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks from external threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks from a large number of short-lived external threads, which
+// are partially running concurrently. Terminated external threads return their scheduling
+// contexts to the thread pool, which are subsequently reused by new external threads. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testExternalThreads()
+{
+   const size_t rounds ( 50UL );
+   const size_t threads( 4UL );
+   const size_t tasks  ( 100UL );
+
+   boost::atomic<size_t> counter( 0UL );
+
+   blaze::ThreadPool pool( 2UL );
+
+   for( size_t i=0UL; i<rounds; ++i )
+   {
+      boost::thread_group group;
+
+      for( size_t j=0UL; j<threads; ++j ) {
+         group.create_thread( boost::bind( produce, &pool, &counter, tasks ) );
+      }
+
+      group.join_all();
+   }
+
+   pool.wait();
+
+   if( counter != rounds*threads*tasks ) {
+      std::ostringstream oss;
+      oss << " Test: Scheduling tasks from external threads\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Found counter    = " << counter << "\n"
+          << "   Expected counter = " << rounds*threads*tasks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,411 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadteam/ClassTest.cpp
+//  \brief Source file for the ThreadTeam class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/util/ThreadTeam.h>
+#include <blazetest/utiltest/threadteam/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadteam {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASSES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary job counting the executions of each rank.
+*/
+class Counting : public blaze::ThreadTeam::Job
+{
+ public:
+   Counting( boost::atomic<size_t>* counters, boost::atomic<size_t>* sizes )
+      : counters_( counters )  // Execution counters of all ranks
+      , sizes_   ( sizes )     // Sum of the team sizes passed to all ranks
+   {}
+
+   void operator()( size_t rank, size_t size ) const {
+      counters_[rank].fetch_add( 1UL );
+      sizes_->fetch_add( size );
+   }
+
+ private:
+   boost::atomic<size_t>* counters_;  //!< Execution counters of all ranks.
+   boost::atomic<size_t>* sizes_;     //!< Sum of the team sizes passed to all ranks.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary job running a nested job on the executing team.
+*/
+class Nesting : public blaze::ThreadTeam::Job
+{
+ public:
+   Nesting( blaze::ThreadTeam* team, const blaze::ThreadTeam::Job* inner )
+      : team_ ( team )   // The executing thread team
+      , inner_( inner )  // The nested job
+   {}
+
+   void operator()( size_t /*rank*/, size_t /*size*/ ) const {
+      team_->run( *inner_ );
+   }
+
+ private:
+   blaze::ThreadTeam* team_;               //!< The executing thread team.
+   const blaze::ThreadTeam::Job* inner_;   //!< The nested job.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary job throwing an exception in the given rank.
+*/
+class Throwing : public blaze::ThreadTeam::Job
+{
+ public:
+   explicit Throwing( size_t rank )
+      : rank_( rank )  // The throwing rank
+   {}
+
+   void operator()( size_t rank, size_t /*size*/ ) const {
+      if( rank == rank_ )
+         throw std::runtime_error( "Throwing job" );
+   }
+
+ private:
+   size_t rank_;  //!< The throwing rank.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadTeam class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstruction();
+   testRun();
+   testNesting();
+   testParking();
+   testException();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ThreadTeam constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the construction of thread teams of invalid and minimum size. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstruction()
+{
+   try {
+      blaze::ThreadTeam team( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: Construction of an empty thread team\n"
+          << " Error: Construction succeeded\n"
+          << " Details:\n"
+          << "   Found team size = " << team.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   boost::atomic<size_t> counters[1];
+   boost::atomic<size_t> sizes( 0UL );
+   counters[0] = 0UL;
+
+   blaze::ThreadTeam team( 1UL );
+   team.run( Counting( counters, &sizes ) );
+
+   if( team.size() != 1UL || counters[0] != 1UL || sizes != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: Construction of a single-member thread team\n"
+          << " Error: Invalid execution of a job\n"
+          << " Details:\n"
+          << "   Found team size = " << team.size() << "\n"
+          << "   Found counter   = " << counters[0] << "\n"
+          << "   Expected counter = 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the run() function of the ThreadTeam class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function executes a large number of consecutive jobs and checks that every member of
+// the team executes each job exactly once. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testRun()
+{
+   const size_t N( 1000UL );
+
+   boost::atomic<size_t> counters[4];
+   boost::atomic<size_t> sizes( 0UL );
+   for( size_t i=0UL; i<4UL; ++i )
+      counters[i] = 0UL;
+
+   blaze::ThreadTeam team( 4UL, 1000UL, true );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      team.run( Counting( counters, &sizes ) );
+   }
+
+   for( size_t i=0UL; i<4UL; ++i )
+   {
+      if( counters[i] != N || sizes != 4UL*4UL*N ) {
+         std::ostringstream oss;
+         oss << " Test: Running " << N << " jobs\n"
+             << " Error: Invalid number of executions\n"
+             << " Details:\n"
+             << "   Rank             = " << i << "\n"
+             << "   Found counter    = " << counters[i] << "\n"
+             << "   Expected counter = " << N << "\n"
+             << "   Found sizes      = " << sizes << "\n"
+             << "   Expected sizes   = " << 4UL*4UL*N << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested jobs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs a job from within a running job of the same team and checks that the
+// nested job is executed serially by each calling member. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNesting()
+{
+   boost::atomic<size_t> counters[3];
+   boost::atomic<size_t> sizes( 0UL );
+   for( size_t i=0UL; i<3UL; ++i )
+      counters[i] = 0UL;
+
+   blaze::ThreadTeam team( 3UL );
+
+   const Counting inner( counters, &sizes );
+   team.run( Nesting( &team, &inner ) );
+
+   if( counters[0] != 3UL || counters[1] != 0UL || counters[2] != 0UL || sizes != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: Running nested jobs\n"
+          << " Error: Invalid execution of the nested jobs\n"
+          << " Details:\n"
+          << "   Found counters    = ( " << counters[0] << " " << counters[1] << " " << counters[2] << " )\n"
+          << "   Expected counters = ( 3 0 0 )\n"
+          << "   Found sizes       = " << sizes << "\n"
+          << "   Expected sizes    = 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parking of idle worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that idle worker threads park after their spin phase and that parked
+// worker threads are woken up by the next job. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testParking()
+{
+   boost::atomic<size_t> counters[3];
+   boost::atomic<size_t> sizes( 0UL );
+   for( size_t i=0UL; i<3UL; ++i )
+      counters[i] = 0UL;
+
+   blaze::ThreadTeam team( 3UL, 0UL );
+
+   for( size_t i=0UL; i<2UL; ++i )
+   {
+      for( size_t j=0UL; j<1000UL && team.parked() != 2UL; ++j ) {
+         boost::this_thread::sleep( boost::posix_time::milliseconds( 1 ) );
+      }
+
+      if( team.parked() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: Parking of idle worker threads\n"
+             << " Error: Invalid number of parked worker threads\n"
+             << " Details:\n"
+             << "   Found parked threads    = " << team.parked() << "\n"
+             << "   Expected parked threads = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      team.run( Counting( counters, &sizes ) );
+   }
+
+   if( counters[0] != 2UL || counters[1] != 2UL || counters[2] != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: Waking up parked worker threads\n"
+          << " Error: Invalid number of executions\n"
+          << " Details:\n"
+          << "   Found counters    = ( " << counters[0] << " " << counters[1] << " " << counters[2] << " )\n"
+          << "   Expected counters = ( 2 2 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the exception handling of the ThreadTeam class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that an exception thrown by a worker thread is rethrown by the run()
+// function and that the team remains usable afterwards. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testException()
+{
+   blaze::ThreadTeam team( 3UL );
+
+   bool thrown( false );
+
+   try {
+      team.run( Throwing( 2UL ) );
+   }
+   catch( std::runtime_error& ) {
+      thrown = true;
+   }
+
+   boost::atomic<size_t> counters[3];
+   boost::atomic<size_t> sizes( 0UL );
+   for( size_t i=0UL; i<3UL; ++i )
+      counters[i] = 0UL;
+
+   team.run( Counting( counters, &sizes ) );
+
+   if( !thrown || counters[0] != 1UL || counters[1] != 1UL || counters[2] != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: Exception thrown by a worker thread\n"
+          << " Error: Exception not transported to the calling thread\n"
+          << " Details:\n"
+          << "   Exception thrown = " << thrown << "\n"
+          << "   Found counters   = ( " << counters[0] << " " << counters[1] << " " << counters[2] << " )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadteam
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadTeam class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADTEAM_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadTeam class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
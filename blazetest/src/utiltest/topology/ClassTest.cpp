@@ -0,0 +1,448 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/topology/ClassTest.cpp
+//  \brief Source file for the Topology class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/ThreadTeam.h>
+#include <blaze/util/Topology.h>
+#include <blazetest/utiltest/topology/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace topology {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Topology class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstruction();
+   testPlacement();
+   testSubset();
+   testCpuList();
+   testBinding();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Topology constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the detection of the system topology and the construction of a topology
+// from an explicit list of logical CPUs. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testConstruction()
+{
+   // Detection of the system topology
+   {
+      const blaze::Topology topology;
+
+      if( topology.size() == 0UL || topology.cores() == 0UL || topology.cores() > topology.size() ||
+          topology.sockets() == 0UL || topology.nodes() == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: Detection of the system topology\n"
+             << " Error: Invalid topology detected\n"
+             << " Details:\n"
+             << "   Found logical CPUs = " << topology.size() << "\n"
+             << "   Found cores        = " << topology.cores() << "\n"
+             << "   Found sockets      = " << topology.sockets() << "\n"
+             << "   Found NUMA nodes   = " << topology.nodes() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Construction of a synthetic topology
+   {
+      const blaze::Topology topology( createTopology() );
+
+      if( topology.size() != 8UL || topology.cores() != 4UL || topology.sockets() != 2UL ||
+          topology.nodes() != 2UL || topology.node( 5UL ) != 0UL || topology.node( 6UL ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: Construction of a synthetic topology\n"
+             << " Error: Invalid topology detected\n"
+             << " Details:\n"
+             << "   Found logical CPUs = " << topology.size() << " (expected 8)\n"
+             << "   Found cores        = " << topology.cores() << " (expected 4)\n"
+             << "   Found sockets      = " << topology.sockets() << " (expected 2)\n"
+             << "   Found NUMA nodes   = " << topology.nodes() << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Construction of a topology with duplicate logical CPUs
+   try {
+      std::vector<blaze::Topology::Cpu> cpus( 2UL );
+      cpus[0].id = 0UL; cpus[0].core = 0UL; cpus[0].socket = 0UL; cpus[0].node = 0UL;
+      cpus[1] = cpus[0];
+
+      const blaze::Topology topology( cpus );
+
+      std::ostringstream oss;
+      oss << " Test: Construction of a topology with duplicate logical CPUs\n"
+          << " Error: Construction succeeded\n"
+          << " Details:\n"
+          << "   Found logical CPUs = " << topology.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compact and spread placement of threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the compact and spread placement of threads on a synthetic topology
+// with two sockets, two cores per socket and two SMT siblings per core. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPlacement()
+{
+   const blaze::Topology topology( createTopology() );
+
+   {
+      const size_t expected[] = { 0UL, 4UL, 1UL, 5UL };
+      checkIds( "Compact placement of 4 threads", topology.place( 4UL, blaze::Topology::compact ), expected, 4UL );
+   }
+
+   {
+      const size_t expected[] = { 0UL, 2UL };
+      checkIds( "Spread placement of 2 threads", topology.place( 2UL, blaze::Topology::spread ), expected, 2UL );
+   }
+
+   {
+      const size_t expected[] = { 0UL, 1UL, 2UL, 3UL };
+      checkIds( "Spread placement of 4 threads", topology.place( 4UL, blaze::Topology::spread ), expected, 4UL );
+   }
+
+   {
+      const size_t expected[] = { 0UL, 4UL, 1UL, 2UL, 6UL, 3UL };
+      checkIds( "Spread placement of 6 threads", topology.place( 6UL, blaze::Topology::spread ), expected, 6UL );
+   }
+
+   {
+      const size_t expected[] = { 0UL, 0UL, 4UL, 4UL, 1UL, 5UL, 2UL, 6UL, 3UL, 7UL };
+      checkIds( "Compact placement of 10 threads", topology.place( 10UL, blaze::Topology::compact ), expected, 10UL );
+   }
+
+   try {
+      const std::vector<size_t> ids( blaze::Topology( std::vector<blaze::Topology::Cpu>() ).place( 2UL, blaze::Topology::compact ) );
+
+      std::ostringstream oss;
+      oss << " Test: Placement on an empty topology\n"
+          << " Error: Placement succeeded\n"
+          << " Details:\n"
+          << "   Found logical CPUs = " << ids.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restriction of a topology to a subset of the logical CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the restriction of a synthetic topology to a subset of its logical CPUs.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubset()
+{
+   std::vector<size_t> ids;
+   ids.push_back( 1UL );
+   ids.push_back( 3UL );
+   ids.push_back( 5UL );
+   ids.push_back( 9UL );
+
+   const blaze::Topology subset( createTopology().subset( ids ) );
+
+   if( subset.size() != 3UL || subset.cores() != 2UL || subset.sockets() != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: Restriction of a topology to a subset of the logical CPUs\n"
+          << " Error: Invalid topology detected\n"
+          << " Details:\n"
+          << "   Found logical CPUs = " << subset.size() << " (expected 3)\n"
+          << "   Found cores        = " << subset.cores() << " (expected 2)\n"
+          << "   Found sockets      = " << subset.sockets() << " (expected 2)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t expected[] = { 1UL, 5UL, 3UL };
+   checkIds( "Compact placement on a subset", subset.place( 3UL, blaze::Topology::compact ), expected, 3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parseCpuList() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the parsing of valid and invalid lists of logical CPUs. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCpuList()
+{
+   {
+      const size_t expected[] = { 0UL, 1UL, 2UL, 5UL, 7UL, 8UL };
+      checkIds( "Parsing a CPU list", blaze::parseCpuList( "0-2,5, 7-8\n" ), expected, 6UL );
+   }
+
+   const char* const invalid[] = { "3-1", "a", "1-", "-2", "1,x-3" };
+
+   for( size_t i=0UL; i<sizeof(invalid)/sizeof(invalid[0]); ++i )
+   {
+      try {
+         const std::vector<size_t> ids( blaze::parseCpuList( invalid[i] ) );
+
+         std::ostringstream oss;
+         oss << " Test: Parsing an invalid CPU list\n"
+             << " Error: Parsing succeeded\n"
+             << " Details:\n"
+             << "   CPU list          = \"" << invalid[i] << "\"\n"
+             << "   Found logical CPUs = " << ids.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binding of threads to logical CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the binding of the calling thread, of the threads of a thread pool and
+// of the worker threads of a thread team to the logical CPUs of the system. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBinding()
+{
+#if defined(__linux__)
+   const blaze::Topology topology;
+   const std::vector<size_t> cpus( topology.place( 2UL, blaze::Topology::spread ) );
+
+   // Binding the calling thread
+   {
+      const std::vector<size_t> all( topology.place( topology.size(), blaze::Topology::compact ) );
+
+      if( !blaze::bindCurrentThread( std::vector<size_t>( 1UL, cpus[0] ) ) ||
+          !blaze::bindCurrentThread( all ) || blaze::bindCurrentThread( std::vector<size_t>() ) ) {
+         std::ostringstream oss;
+         oss << " Test: Binding the calling thread\n"
+             << " Error: Invalid binding result\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Binding the threads of a thread pool
+   {
+      blaze::ThreadPool threadpool( 2UL );
+
+      if( !threadpool.setAffinity( cpus ) ) {
+         std::ostringstream oss;
+         oss << " Test: Binding the threads of a thread pool\n"
+             << " Error: Binding failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      threadpool.resize( 3UL );
+      threadpool.wait();
+   }
+
+   // Binding the worker threads of a thread team
+   {
+      blaze::ThreadTeam team( 3UL, 100UL, cpus );
+
+      if( !team.pinned() || team.cpus().size() != 3UL || team.cpus()[2] != cpus[0] ) {
+         std::ostringstream oss;
+         oss << " Test: Binding the worker threads of a thread team\n"
+             << " Error: Invalid binding of the team\n"
+             << " Details:\n"
+             << "   Pinned = " << team.pinned() << "\n"
+             << "   Number of CPUs = " << team.cpus().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::ThreadTeam unpinned( 2UL, 100UL, std::vector<size_t>() );
+
+      if( unpinned.pinned() || !unpinned.cpus().empty() ) {
+         std::ostringstream oss;
+         oss << " Test: Construction of an unpinned thread team\n"
+             << " Error: Invalid binding of the team\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given list of logical CPU IDs.
+//
+// \param test The label of the current test.
+// \param ids The list of logical CPU IDs to be checked.
+// \param expected The expected logical CPU IDs.
+// \param n The number of expected logical CPU IDs.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkIds( const std::string& test, const std::vector<size_t>& ids,
+                          const size_t* expected, size_t n ) const
+{
+   if( ids.size() != n || !std::equal( ids.begin(), ids.end(), expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test << "\n"
+          << " Error: Invalid logical CPUs\n"
+          << " Details:\n"
+          << "   Result:  ";
+      for( size_t i=0UL; i<ids.size(); ++i )
+         oss << " " << ids[i];
+      oss << "\n   Expected:";
+      for( size_t i=0UL; i<n; ++i )
+         oss << " " << expected[i];
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a synthetic topology.
+//
+// \return A topology with two sockets, two cores per socket and two SMT siblings per core.
+//
+// The logical CPUs 0-3 are the first SMT siblings of the four cores, the logical CPUs 4-7 the
+// second SMT siblings. Each socket forms a NUMA node.
+*/
+blaze::Topology ClassTest::createTopology()
+{
+   std::vector<blaze::Topology::Cpu> cpus( 8UL );
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      cpus[i].id     = i;
+      cpus[i].core   = ( i % 4UL ) % 2UL;
+      cpus[i].socket = ( i % 4UL ) / 2UL;
+      cpus[i].node   = cpus[i].socket;
+   }
+
+   return blaze::Topology( cpus );
+}
+//*************************************************************************************************
+
+} // namespace topology
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Topology class test..." << std::endl;
+
+   try
+   {
+      RUN_TOPOLOGY_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Topology class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,9 +37,8 @@
 // Includes
 //*************************************************************************************************
 
-#include <cmath>
 #include <stdexcept>
-#include <blaze/math/Functions.h>
+#include <blaze/math/DenseVector.h>
 #include <blaze/math/solvers/CG.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
@@ -116,10 +115,7 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
    r_ = A * x + b;
 
    // Initial convergence test
-   lastPrecision_ = 0;
-   for( size_t i=0; i<n; ++i ) {
-      lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-   }
+   lastPrecision_ = linfNorm( r_ );
 
    if( lastPrecision_ < threshold_ )
       converged = true;
@@ -140,10 +136,7 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
       x  += alpha * d_;
       r_ += alpha * h_;
 
-      lastPrecision_ = 0;
-      for( size_t i=0; i<n; ++i ) {
-         lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-      }
+      lastPrecision_ = linfNorm( r_ );
 
       if( lastPrecision_ < threshold_ ) {
          converged = true;
@@ -44,14 +44,137 @@
 // Includes
 //*************************************************************************************************
 
+#include <map>
 #include <stdexcept>
-#include <boost/scoped_ptr.hpp>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 #include <blaze/util/Assert.h>
+#include <blaze/util/TaskGroup.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/Topology.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  THREAD-LOCAL SCHEDULING CONTEXT
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*!\brief Registry of all existing thread pools.
+// \ingroup threads
+//
+// The registry maps the unique ID of every existing thread pool to the thread pool. It enables
+// terminating threads to safely return their scheduling contexts to the thread pools they have
+// been attached to: A thread pool removes itself from the registry before it is destroyed.
+// Note that the registry mutex must always be acquired before the mutex of a thread pool.
+*/
+struct Registry
+{
+   boost::mutex                 mutex_;  //!< Synchronization mutex.
+   std::map<size_t,ThreadPool*> pools_;  //!< The currently existing thread pools.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the registry of all existing thread pools.
+//
+// \return Reference to the thread pool registry.
+*/
+Registry& registry()
+{
+   static Registry pools;
+   return pools;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new, unique thread pool ID.
+//
+// \return The new thread pool ID.
+*/
+size_t createPoolID()
+{
+   static boost::atomic<size_t> counter( 0UL );
+   return ++counter;
+}
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  CLASS THREADPOOL::THREADCONTEXT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local handle to the scheduling contexts of a thread.
+// \ingroup threads
+//
+// Each thread keeps track of all thread pools it is attached to and caches the scheduling
+// context it most recently used together with the unique ID of the according thread pool. In
+// contrast to the address of a thread pool, the ID of a thread pool is never reused and
+// therefore the cached context can never refer to a destroyed pool. On termination of the
+// thread the scheduling contexts are returned to all thread pools that still exist.
+*/
+struct ThreadPool::ThreadContext
+{
+   //**Type definitions****************************************************************************
+   typedef std::pair<size_t,Worker*>  Attachment;   //!< Pool ID and according scheduling context.
+   typedef std::vector<Attachment>    Attachments;  //!< Type of the list of attachments.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Default constructor for the ThreadContext class.
+   */
+   ThreadContext()
+      : pool_       ( 0UL )   // The unique ID of the most recently used thread pool
+      , context_    ( NULL )  // The most recently used scheduling context
+      , attachments_()        // All thread pools the thread is attached to
+   {}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the ThreadContext class.
+   //
+   // The destructor is called on termination of the thread and detaches the thread from all
+   // thread pools that still exist.
+   */
+   ~ThreadContext()
+   {
+      Registry& reg( registry() );
+      boost::mutex::scoped_lock lock( reg.mutex_ );
+
+      for( Attachments::iterator a=attachments_.begin(); a!=attachments_.end(); ++a ) {
+         std::map<size_t,ThreadPool*>::iterator pool( reg.pools_.find( a->first ) );
+         if( pool != reg.pools_.end() )
+            pool->second->detachThread( *a->second );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t      pool_;         //!< The unique ID of the most recently used thread pool.
+   Worker*     context_;      //!< The most recently used scheduling context.
+   Attachments attachments_;  //!< All thread pools the thread is attached to.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  CONSTRUCTOR
@@ -67,15 +190,34 @@ namespace blaze {
 // initially idle until a task is scheduled.
 */
 ThreadPool::ThreadPool( size_t n )
-   : total_     ( 0 )  // Total number of threads in the thread pool
-   , expected_  ( 0 )  // Expected number of threads in the thread pool
-   , active_    ( 0 )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+   : id_           ( createPoolID() )  // Unique ID of the thread pool
+   , total_        ( 0 )               // Total number of threads in the thread pool
+   , expected_     ( 0 )               // Expected number of threads in the thread pool
+   , active_       ( 0 )               // Number of currently active/busy threads
+   , sleeping_     ( 0 )               // Number of threads waiting for a task
+   , queued_       ( 0 )               // Number of scheduled tasks that have not been started
+   , pending_      ( 0 )               // Number of scheduled tasks that have not been completed
+   , generation_   ( 0 )               // Generation of the scheduled tasks
+   , threads_      ()                  // The scheduling contexts of the pool threads
+   , externals_    ()                  // The scheduling contexts of external threads
+   , snapshots_    ()                  // All published lists of deque owners
+   , victims_      ( NULL )            // The current list of all deque owners
+   , cpus_         ()                  // The logical CPUs of the pool threads
+   , mutex_        ()                  // Synchronization mutex
+   , waitForTask_  ()                  // Wait condition for idle threads
+   , waitForThread_()                  // Wait condition for the thread management
 {
+   {
+      Lock lock( mutex_ );
+      publish();
+   }
+
+   {
+      Registry& reg( registry() );
+      boost::mutex::scoped_lock lock( reg.mutex_ );
+      reg.pools_[id_] = this;
+   }
+
    resize( n );
 }
 //*************************************************************************************************
@@ -92,36 +234,57 @@ ThreadPool::ThreadPool( size_t n )
 //*************************************************************************************************
 /*!\brief Destructor for the ThreadPool class.
 //
-// The destructor clears all remaining tasks from the task queue and waits for the currently
+// The destructor removes all remaining tasks from the thread pool and waits for the currently
 // active threads to complete their tasks.
 */
 ThreadPool::~ThreadPool()
 {
-   Lock lock( mutex_ );
+   // Preventing terminating threads from detaching from the thread pool
+   {
+      Registry& reg( registry() );
+      boost::mutex::scoped_lock lock( reg.mutex_ );
+      reg.pools_.erase( id_ );
+   }
 
-   // Removing all currently queued tasks
-   taskqueue_.clear();
+   {
+      Lock lock( mutex_ );
 
-   // Setting the expected number of threads
-   expected_ = 0;
+      // Removing all currently queued tasks
+      ++generation_;
 
-   // Notifying all idle threads
-   waitForTask_.notify_all();
+      // Setting the expected number of threads
+      expected_ = 0;
 
-   // Waiting for all threads to terminate
-   while( total_ != 0 ) {
-      waitForThread_.wait( lock );
+      // Notifying all idle threads
+      waitForTask_.notify_all();
+
+      // Waiting for all threads to terminate
+      while( total_ != 0 ) {
+         waitForThread_.wait( lock );
+      }
    }
 
    // Joining all threads
-   typedef Threads::Iterator  Iterator;
-   const Iterator end( threads_.end() );
-   for( Iterator thread=threads_.begin(); thread!=end; ++thread ) {
-      thread->join();
+   for( Workers::Iterator worker=threads_.begin(); worker!=threads_.end(); ++worker ) {
+      worker->thread_->join();
+   }
+
+   // Releasing all remaining task nodes
+   Workers* contexts[2] = { &threads_, &externals_ };
+   for( size_t i=0UL; i<2UL; ++i ) {
+      for( Workers::Iterator worker=contexts[i]->begin(); worker!=contexts[i]->end(); ++worker ) {
+         while( TaskNode* node = worker->deque_.pop() ) {
+            node->home_->releaseRemote( node );
+         }
+      }
    }
 
-   // Destroying all threads
-   threads_.clear();
+   // Resetting the thread-local context of the calling thread
+   ThreadContext* context( threadContext().get() );
+   if( context != NULL && context->pool_ == id_ ) {
+      context->pool_    = 0UL;
+      context->context_ = NULL;
+   }
 }
 //*************************************************************************************************
 
@@ -143,8 +306,8 @@ ThreadPool::~ThreadPool()
 //
 // This function changes the size of the thread pool, i.e. changes the total number of threads
 // contained in the pool. If \a n is smaller than the current size of the thread pool, the
-// according number of threads is removed from the pool, otherwise new threads are added to
-// the pool.
+// according number of threads is removed from the pool as soon as they have completed all
+// tasks of their own deque, otherwise new threads are added to the pool.
 */
 void ThreadPool::resize( size_t n )
 {
@@ -152,31 +315,18 @@ void ThreadPool::resize( size_t n )
    if( n == 0 )
       throw std::invalid_argument( "Invalid number of threads" );
 
-   // Adjusting the number of threads
-   {
-      Lock lock( mutex_ );
-
-      // Adding new threads to the thread pool
-      if( n > expected_ ) {
-         for( size_t i=expected_; i<n; ++i )
-            createThread();
-      }
+   Lock lock( mutex_ );
 
-      // Removing threads from the pool
-      else {
-         expected_ = n;
-         waitForTask_.notify_all();
-      }
+   // Adding new threads to the thread pool
+   if( n > expected_ ) {
+      for( size_t i=expected_; i<n; ++i )
+         createThread();
    }
 
-   // Joining and destroying any terminated thread
-   typedef Threads::Iterator  Iterator;
-   for( Iterator thread=threads_.begin(); thread!=threads_.end(); ) {
-      if( thread->hasTerminated() ) {
-         thread->join();
-         thread = threads_.erase( thread );
-      }
-      else ++thread;
+   // Removing threads from the pool
+   else {
+      expected_ = n;
+      waitForTask_.notify_all();
    }
 }
 //*************************************************************************************************
@@ -187,13 +337,15 @@ void ThreadPool::resize( size_t n )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. Note that this function
+// must not be called from within a task executed by the thread pool. In order to wait for the
+// completion of specific tasks within a running task, a TaskGroup has to be used.
 */
 void ThreadPool::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0 ) {
+   while( pending_.load( boost::memory_order_acquire ) != 0UL ) {
       waitForThread_.wait( lock );
    }
 }
@@ -206,12 +358,96 @@ void ThreadPool::wait()
 // \return void
 //
 // This function removes all currently scheduled tasks from the thread pool. The total number
-// of threads remains unchanged and all active threads continue completing their tasks.
+// of threads remains unchanged and all active threads continue completing their tasks. Note
+// that the removed tasks are discarded by the threads of the pool without execution, i.e. it
+// may take a short while until the isEmpty() function returns \a true.
 */
 void ThreadPool::clear()
+{
+   ++generation_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the threads of the thread pool to the given logical CPUs.
+//
+// \param cpus The operating system IDs of the logical CPUs.
+// \return \a true in case all threads have been bound successfully, \a false if not.
+//
+// This function binds the \f$ i \f$-th thread of the thread pool to the logical CPU
+// \f$ cpus[i \bmod |cpus|] \f$. The binding applies to all current threads of the pool as
+// well as to all threads added later on via resize(). In order to spread the threads across
+// sockets or to pack them densely, the list of CPUs can be created via the Topology class:
+
+   \code
+   blaze::ThreadPool threadpool( 4UL );
+   threadpool.setAffinity( blaze::Topology().place( 4UL, blaze::Topology::spread ) );
+   \endcode
+
+// In case the given list is empty, no further threads are bound (the binding of the current
+// threads remains unchanged). Note that the binding of threads is not supported on all
+// platforms. In that case, the function returns \a false.
+*/
+bool ThreadPool::setAffinity( const std::vector<size_t>& cpus )
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+
+   cpus_ = cpus;
+
+   if( cpus_.empty() )
+      return true;
+
+   bool success( true );
+
+   for( size_t i=0UL; i<threads_.size(); ++i ) {
+      Worker& worker( *threads_[i] );
+      if( worker.running_ && worker.thread_.get() != NULL &&
+          !bindThread( *worker.thread_->thread_, std::vector<size_t>( 1UL, cpus_[i%cpus_.size()] ) ) )
+         success = false;
+   }
+
+   return success;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Submitting a new task node to the deque of the given scheduling context.
+//
+// \param context The scheduling context of the calling thread.
+// \param node The task node to be submitted.
+// \return void
+//
+// This function pushes the given task node to the deque of the given scheduling context and
+// wakes up a waiting thread (if any). In case no thread is waiting for tasks, no lock is
+// acquired.
+*/
+void ThreadPool::submit( Worker& context, TaskNode* node )
+{
+   node->generation_ = generation_.load( boost::memory_order_relaxed );
+
+   pending_.fetch_add( 1UL, boost::memory_order_relaxed );
+   queued_.fetch_add( 1UL, boost::memory_order_relaxed );
+
+   context.deque_.push( node );
+
+   // Ensuring that either the task is visible to any thread about to wait for a task or
+   // that the waiting thread is visible to this thread (see executeTask())
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
+
+   if( sleeping_.load( boost::memory_order_relaxed ) != 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -224,16 +460,180 @@ void ThreadPool::clear()
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the scheduling context of the calling thread.
+//
+// \return Reference to the scheduling context of the calling thread.
+*/
+ThreadPool::Worker& ThreadPool::getContext()
+{
+   ThreadContext* context( threadContext().get() );
+
+   if( context == NULL )
+      return attachThread();
+
+   if( context->pool_ == id_ )
+      return *context->context_;
+
+   // Searching the previous attachments of the calling thread
+   typedef ThreadContext::Attachments::const_iterator ConstIterator;
+   for( ConstIterator a=context->attachments_.begin(); a!=context->attachments_.end(); ++a ) {
+      if( a->first == id_ ) {
+         context->pool_    = id_;
+         context->context_ = a->second;
+         return *a->second;
+      }
+   }
+
+   return attachThread();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Attaching the calling thread to the thread pool.
+//
+// \return Reference to the scheduling context of the calling thread.
+//
+// This function determines the scheduling context of the calling thread and stores it in the
+// thread-local context handle. In case the calling thread is not a thread of the pool, it is
+// assigned the scheduling context of a terminated external thread. Only in case there is no
+// such context, a new scheduling context is created. Therefore the number of external contexts
+// is limited by the maximum number of simultaneously attached external threads.
+*/
+ThreadPool::Worker& ThreadPool::attachThread()
+{
+   const boost::thread::id id( boost::this_thread::get_id() );
+   Worker* worker( NULL );
+
+   {
+      Lock lock( mutex_ );
+
+      // Searching the threads of the pool
+      for( Workers::Iterator w=threads_.begin(); w!=threads_.end(); ++w ) {
+         if( w->running_ && w->thread_->thread_->get_id() == id ) {
+            worker = *w;
+            break;
+         }
+      }
+
+      // Reusing the scheduling context of a terminated external thread
+      for( Workers::Iterator w=externals_.begin(); worker == NULL && w!=externals_.end(); ++w ) {
+         if( w->id_ == boost::thread::id() )
+            worker = *w;
+      }
+
+      // Creating a new scheduling context for the external thread
+      if( worker == NULL ) {
+         worker = new Worker( threads_.size() + externals_.size(), true );
+         externals_.pushBack( worker );
+         publish();
+      }
+
+      worker->id_ = id;
+   }
+
+   ThreadContext* context( threadContext().get() );
+   if( context == NULL ) {
+      context = new ThreadContext();
+      threadContext().reset( context );
+   }
+
+   // Removing the attachments to destroyed thread pools
+   {
+      Registry& reg( registry() );
+      boost::mutex::scoped_lock lock( reg.mutex_ );
+
+      ThreadContext::Attachments& attachments( context->attachments_ );
+      for( size_t i=0UL; i<attachments.size(); ) {
+         if( reg.pools_.find( attachments[i].first ) == reg.pools_.end() ) {
+            attachments[i] = attachments.back();
+            attachments.pop_back();
+         }
+         else ++i;
+      }
+   }
+
+   context->attachments_.push_back( ThreadContext::Attachment( id_, worker ) );
+   context->pool_    = id_;
+   context->context_ = worker;
+
+   return *worker;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detaching a terminating thread from the thread pool.
+//
+// \param worker The scheduling context of the terminating thread.
+// \return void
+//
+// This function is called on termination of a thread that is attached to the thread pool. In
+// case the thread is an external thread, its scheduling context is released for the reuse by
+// another external thread. Tasks that remain in the deque of the context can still be stolen
+// by the other threads and are executed by the next owner of the context.
+*/
+void ThreadPool::detachThread( Worker& worker )
+{
+   if( !worker.external_ ) return;
+
+   Lock lock( mutex_ );
+   worker.id_ = boost::thread::id();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the thread-local scheduling context handle of the calling thread.
+//
+// \return Reference to the thread-local handle.
+*/
+boost::thread_specific_ptr<ThreadPool::ThreadContext>& ThreadPool::threadContext()
+{
+   static boost::thread_specific_ptr<ThreadContext> context;
+   return context;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// This function must only be called while holding the thread pool mutex. In case a previously
+// removed thread has not been replaced yet, its scheduling context is reused.
 */
 void ThreadPool::createThread()
 {
-   threads_.pushBack( new Thread( this ) );
-   ++total_;
+   const size_t index( expected_ );
+
+   if( index == threads_.size() ) {
+      threads_.pushBack( new Worker( index, false ) );
+      publish();
+   }
+
+   Worker& worker( *threads_[index] );
+
    ++expected_;
+
+   // Reactivating a thread that has not yet been removed
+   if( worker.running_ ) return;
+
+   // Joining a previously removed thread
+   if( worker.thread_.get() != NULL ) {
+      worker.thread_->join();
+   }
+
+   worker.running_ = true;
+   worker.thread_.reset( new Thread( this ) );
+
+   // Binding the new thread to its logical CPU
+   if( !cpus_.empty() )
+      bindThread( *worker.thread_->thread_, std::vector<size_t>( 1UL, cpus_[index%cpus_.size()] ) );
+
+   ++total_;
    ++active_;
 }
 //*************************************************************************************************
@@ -242,7 +642,7 @@ void ThreadPool::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
-// \return void
+// \return \a true in case the thread remains in the thread pool, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
 // In case there is no task available, the thread blocks and waits for a new task to be
@@ -250,35 +650,180 @@ void ThreadPool::createThread()
 */
 bool ThreadPool::executeTask()
 {
-   threadpool::Task task;
+   Worker& context( getContext() );
 
-   // Acquiring a scheduled task
-   {
-      Lock lock( mutex_ );
+   // Acquiring and executing a scheduled task
+   for( size_t i=0UL; i<8UL; ++i ) {
+      if( TaskNode* node = findTask( context ) ) {
+         execute( context, node );
+         return true;
+      }
+      boost::this_thread::yield();
+   }
 
-      while( taskqueue_.isEmpty() )
-      {
-         --active_;
-         waitForThread_.notify_all();
+   // Waiting for a new task
+   Lock lock( mutex_ );
 
-         if( total_ > expected_ ) {
-            --total_;
-            return false;
-         }
+   if( context.index_ >= expected_ ) {
+      BLAZE_INTERNAL_ASSERT( context.deque_.isEmpty(), "Non-empty deque detected" );
+      context.running_ = false;
+      --total_;
+      --active_;
+      waitForThread_.notify_all();
+      return false;
+   }
 
-         waitForTask_.wait( lock );
-         ++active_;
-      }
+   sleeping_.fetch_add( 1UL, boost::memory_order_relaxed );
+   boost::atomic_thread_fence( boost::memory_order_seq_cst );
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+   if( !hasTasks() ) {
+      --active_;
+      waitForTask_.wait( lock );
+      ++active_;
    }
 
-   // Executing the task
-   task();
+   sleeping_.fetch_sub( 1UL, boost::memory_order_relaxed );
 
    return true;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Executing a single scheduled task on behalf of a waiting task group.
+//
+// \return \a true in case a task was executed, \a false if no task could be found.
+*/
+bool ThreadPool::executePending()
+{
+   Worker& context( getContext() );
+
+   if( TaskNode* node = findTask( context ) ) {
+      execute( context, node );
+      return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searching a task for the given scheduling context.
+//
+// \param context The scheduling context of the calling thread.
+// \return The found task node or NULL in case no task could be found.
+//
+// This function first tries to acquire a task from the deque of the given scheduling context.
+// In case the deque is empty, it tries to steal a task from the other deques, starting from a
+// randomly selected victim.
+*/
+ThreadPool::TaskNode* ThreadPool::findTask( Worker& context ) const
+{
+   if( TaskNode* node = context.deque_.pop() )
+      return node;
+
+   const Victims& victims( *victims_.load( boost::memory_order_acquire ) );
+   const size_t n( victims.size() );
+
+   if( n == 0UL )
+      return NULL;
+
+   const size_t start( context.random() % n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      Worker* victim( victims[(start+i)%n] );
+      if( victim == &context ) continue;
+      if( TaskNode* node = victim->deque_.steal() )
+         return node;
+   }
+
+   return NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any deque of the thread pool contains scheduled tasks.
+//
+// \return \a true in case tasks are available, \a false otherwise.
+*/
+bool ThreadPool::hasTasks() const
+{
+   const Victims& victims( *victims_.load( boost::memory_order_acquire ) );
+
+   for( Victims::const_iterator victim=victims.begin(); victim!=victims.end(); ++victim ) {
+      if( !(*victim)->deque_.isEmpty() )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given task node.
+//
+// \param context The scheduling context of the calling thread.
+// \param node The task node to be executed.
+// \return void
+//
+// This function executes the given task (in case it has not been removed from the thread pool
+// via clear()), releases the task node and notifies the parent task group of the task and any
+// thread waiting for the completion of all tasks.
+*/
+void ThreadPool::execute( Worker& context, TaskNode* node )
+{
+   queued_.fetch_sub( 1UL, boost::memory_order_relaxed );
+
+   if( node->generation_ == generation_.load( boost::memory_order_relaxed ) ) {
+      node->task_();
+   }
+
+   TaskGroup* group( node->group_ );
+
+   if( node->home_ == &context.nodes_ )
+      context.nodes_.release( node );
+   else
+      node->home_->releaseRemote( node );
+
+   if( group != NULL ) {
+      group->notify();
+   }
+
+   if( pending_.fetch_sub( 1UL, boost::memory_order_acq_rel ) == 1UL ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Publishing a new list of all deque owners.
+//
+// \return void
+//
+// This function must only be called while holding the thread pool mutex. Since other threads
+// may still access previous lists of deque owners, all lists are kept alive until the thread
+// pool is destroyed.
+*/
+void ThreadPool::publish()
+{
+   Victims* victims( new Victims() );
+   snapshots_.pushBack( victims );
+
+   victims->reserve( threads_.size() + externals_.size() );
+   for( Workers::Iterator worker=threads_.begin(); worker!=threads_.end(); ++worker ) {
+      victims->push_back( *worker );
+   }
+   for( Workers::Iterator worker=externals_.begin(); worker!=externals_.end(); ++worker ) {
+      victims->push_back( *worker );
+   }
+
+   victims_.store( victims, boost::memory_order_release );
+}
+//*************************************************************************************************
+
 } // namespace blaze
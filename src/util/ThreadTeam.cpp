@@ -0,0 +1,362 @@
+//=================================================================================================
+/*!
+//  \file src/util/ThreadTeam.cpp
+//  \brief Source file for the ThreadTeam class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Platform/compiler-specific includes
+//*************************************************************************************************
+
+#include <blaze/system/WarningDisable.h>
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <boost/bind.hpp>
+#include <blaze/util/Assert.h>
+#include <blaze/util/ThreadTeam.h>
+#include <blaze/util/Topology.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadTeam class.
+//
+// \param n The total number of team members \f$[1..\infty)\f$ (including the calling thread).
+// \param spin The number of spin iterations before an idle worker thread parks.
+// \param pin \a true in case the worker threads should be pinned to individual cores.
+// \exception std::invalid_argument Invalid team size.
+//
+// This constructor creates a team of \a n members, i.e. the team consists of the calling thread
+// and \a n-1 new worker threads. In between two jobs, the worker threads spin for \a spin
+// iterations on the broadcast slot of the team before they park. In case \a pin is set to
+// \a true, the worker threads are pinned to the logical CPUs available to the process according
+// to a compact placement (see the Topology class description).
+*/
+ThreadTeam::ThreadTeam( size_t n, size_t spin, bool pin )
+   : size_    ( n )       // Total number of members of the team
+   , spin_    ( spin )    // Number of spin iterations before a worker parks
+   , pinned_  ( false )   // Pinning flag of the worker threads
+   , cpus_    ()          // The logical CPUs of all ranks
+   , epoch_   ( 0UL )     // The broadcast slot of the team
+   , job_     ( NULL )    // The job of the current epoch
+   , running_ ( 0UL )     // Number of worker threads still executing the job
+   , parked_  ( 0UL )     // Number of parked worker threads
+   , shutdown_( false )   // Termination flag for the worker threads
+   , error_   ()          // The first exception thrown during the current job
+   , threads_ ()          // The worker threads of the team
+   , dispatch_()          // Mutex for the exclusive use of the team
+   , mutex_   ()          // Synchronization mutex for parking worker threads
+   , wakeup_  ()          // Wait condition for parked worker threads
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of team members" );
+
+   if( pin )
+      cpus_ = Topology().place( n, Topology::compact );
+
+   launch();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a ThreadTeam with explicitly placed worker threads.
+//
+// \param n The total number of team members \f$[1..\infty)\f$ (including the calling thread).
+// \param spin The number of spin iterations before an idle worker thread parks.
+// \param cpus The operating system IDs of the logical CPUs of the ranks.
+// \exception std::invalid_argument Invalid team size.
+//
+// This constructor creates a team of \a n members, i.e. the team consists of the calling thread
+// and \a n-1 new worker threads. The worker thread with rank \f$ r \f$ is bound to the logical
+// CPU \f$ cpus[r \bmod |cpus|] \f$. The calling thread (rank 0) is not bound by the team. In
+// case the given list of CPUs is empty, the worker threads are not bound.
+*/
+ThreadTeam::ThreadTeam( size_t n, size_t spin, const std::vector<size_t>& cpus )
+   : size_    ( n )       // Total number of members of the team
+   , spin_    ( spin )    // Number of spin iterations before a worker parks
+   , pinned_  ( false )   // Pinning flag of the worker threads
+   , cpus_    ()          // The logical CPUs of all ranks
+   , epoch_   ( 0UL )     // The broadcast slot of the team
+   , job_     ( NULL )    // The job of the current epoch
+   , running_ ( 0UL )     // Number of worker threads still executing the job
+   , parked_  ( 0UL )     // Number of parked worker threads
+   , shutdown_( false )   // Termination flag for the worker threads
+   , error_   ()          // The first exception thrown during the current job
+   , threads_ ()          // The worker threads of the team
+   , dispatch_()          // Mutex for the exclusive use of the team
+   , mutex_   ()          // Synchronization mutex for parking worker threads
+   , wakeup_  ()          // Wait condition for parked worker threads
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of team members" );
+
+   if( !cpus.empty() ) {
+      for( size_t rank=0UL; rank<n; ++rank )
+         cpus_.push_back( cpus[rank%cpus.size()] );
+   }
+
+   launch();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the ThreadTeam class.
+//
+// The destructor waits for the completion of the current job (if any) and terminates all
+// worker threads of the team.
+*/
+ThreadTeam::~ThreadTeam()
+{
+   Lock dispatch( dispatch_ );
+
+   shutdown_.store( true );
+   ++epoch_;
+   {
+      Lock lock( mutex_ );
+      wakeup_.notify_all();
+   }
+
+   threads_.join_all();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parallel execution of the given job by all members of the team.
+//
+// \param job The job to be executed.
+// \return void
+//
+// This function publishes the given job via the broadcast slot of the team, executes the job
+// as rank 0 and waits until all worker threads have completed the job. In case any member of
+// the team throws an exception, the first exception is rethrown by this function after all
+// members have completed the job. In case the team is currently busy (for instance in case the
+// function is called from within a running job of the same team), the job is executed serially
+// by the calling thread with rank 0 and a team size of 1.
+*/
+void ThreadTeam::run( const Job& job )
+{
+   if( size_ == 1UL || !dispatch_.try_lock() ) {
+      job( 0UL, 1UL );
+      return;
+   }
+
+   Lock dispatch( dispatch_, boost::adopt_lock );
+
+   // Publishing the job via the broadcast slot
+   error_ = boost::exception_ptr();
+   running_.store( size_-1UL, boost::memory_order_relaxed );
+   job_.store( &job, boost::memory_order_relaxed );
+   ++epoch_;
+
+   // Waking up parked worker threads
+   if( parked_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      wakeup_.notify_all();
+   }
+
+   // Participating in the execution of the job
+   execute( job, 0UL, size_ );
+
+   // Waiting for the completion of the job
+   for( size_t i=0UL; running_.load( boost::memory_order_acquire ) > 0UL; ++i ) {
+      if( i >= spin_ )
+         boost::this_thread::yield();
+   }
+
+   if( error_ ) {
+      const boost::exception_ptr error( error_ );
+      error_ = boost::exception_ptr();
+      boost::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Execution function of the worker threads of the team.
+//
+// \param rank The rank of the worker thread \f$ [1..size) \f$.
+// \return void
+*/
+void ThreadTeam::work( size_t rank )
+{
+   size_t epoch( 0UL );
+
+   while( true )
+   {
+      epoch = await( epoch );
+
+      if( shutdown_.load() )
+         break;
+
+      execute( *job_.load( boost::memory_order_relaxed ), rank, size_ );
+      running_.fetch_sub( 1UL, boost::memory_order_release );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the publication of a new job.
+//
+// \param epoch The epoch of the last executed job.
+// \return The epoch of the new job.
+//
+// This function first spins on the broadcast slot of the team. In case no new job is published
+// within the configured number of spin iterations, the calling worker thread parks until it
+// is woken up by the next published job.
+*/
+size_t ThreadTeam::await( size_t epoch )
+{
+   for( size_t i=0UL; i<spin_; ++i ) {
+      const size_t current( epoch_.load( boost::memory_order_acquire ) );
+      if( current != epoch )
+         return current;
+   }
+
+   Lock lock( mutex_ );
+   ++parked_;
+
+   size_t current( epoch_.load() );
+   while( current == epoch ) {
+      wakeup_.wait( lock );
+      current = epoch_.load();
+   }
+
+   --parked_;
+   return current;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution of a job by a single member of the team.
+//
+// \param job The job to be executed.
+// \param rank The rank of the executing team member.
+// \param size The total number of team members executing the job.
+// \return void
+//
+// In case the job throws an exception, the exception is stored in case it is the first
+// exception of the current job.
+*/
+void ThreadTeam::execute( const Job& job, size_t rank, size_t size )
+{
+   try {
+      job( rank, size );
+   }
+   catch( ... ) {
+      Lock lock( mutex_ );
+      if( !error_ )
+         error_ = boost::current_exception();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating and binding the worker threads of the team.
+//
+// \return void
+//
+// This function creates the \a n-1 worker threads of the team and binds them to the according
+// logical CPUs (if any). In case any worker thread cannot be bound, the team is marked as
+// unpinned. In case the creation of a worker thread fails, all previously created worker threads
+// are terminated and the exception is rethrown.
+*/
+void ThreadTeam::launch()
+{
+   pinned_ = !cpus_.empty();
+
+   try {
+      for( size_t rank=1UL; rank<size_; ++rank ) {
+         boost::thread* thread( threads_.create_thread( boost::bind( &ThreadTeam::work, this, rank ) ) );
+         if( pinned_ && !bindThread( *thread, std::vector<size_t>( 1UL, cpus_[rank] ) ) )
+            pinned_ = false;
+      }
+   }
+   catch( ... ) {
+      shutdown_.store( true );
+      ++epoch_;
+      {
+         Lock lock( mutex_ );
+         wakeup_.notify_all();
+      }
+      threads_.join_all();
+      throw;
+   }
+
+   if( !pinned_ )
+      cpus_.clear();
+}
+//*************************************************************************************************
+
+} // namespace blaze
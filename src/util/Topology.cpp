@@ -0,0 +1,581 @@
+//=================================================================================================
+/*!
+//  \file src/util/Topology.cpp
+//  \brief Source file for the Topology class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Platform/compiler-specific includes
+//*************************************************************************************************
+
+#include <blaze/system/WarningDisable.h>
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Topology.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*!\brief Ordering of logical CPUs by NUMA node, socket, core and ID.
+//
+// \param a The left-hand side logical CPU.
+// \param b The right-hand side logical CPU.
+// \return \a true in case \a a precedes \a b, \a false if not.
+*/
+bool precedes( const Topology::Cpu& a, const Topology::Cpu& b )
+{
+   if( a.node   != b.node   ) return a.node   < b.node;
+   if( a.socket != b.socket ) return a.socket < b.socket;
+   if( a.core   != b.core   ) return a.core   < b.core;
+   return a.id < b.id;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a single unsigned value from the given file.
+//
+// \param file The path of the file.
+// \param value The value read from the file.
+// \return \a true in case the value was read successfully, \a false if not.
+*/
+bool readValue( const std::string& file, size_t& value )
+{
+   std::ifstream in( file.c_str() );
+   in >> value;
+   return !in.fail();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a CPU list from the given file.
+//
+// \param file The path of the file.
+// \param list The CPU list read from the file.
+// \return \a true in case the list was read successfully, \a false if not.
+*/
+bool readList( const std::string& file, std::vector<size_t>& list )
+{
+   std::ifstream in( file.c_str() );
+   std::string line;
+
+   if( !std::getline( in, line ) )
+      return false;
+
+   try {
+      list = parseCpuList( line );
+   }
+   catch( std::invalid_argument& ) {
+      return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the IDs of all logical CPUs available to the calling process.
+//
+// \return The IDs of the available logical CPUs.
+*/
+std::vector<size_t> availableCpus()
+{
+   std::vector<size_t> ids;
+
+#if defined(__linux__)
+   cpu_set_t cpus;
+   CPU_ZERO( &cpus );
+   if( sched_getaffinity( 0, sizeof( cpu_set_t ), &cpus ) == 0 ) {
+      for( size_t id=0UL; id<static_cast<size_t>( CPU_SETSIZE ); ++id ) {
+         if( CPU_ISSET( id, &cpus ) )
+            ids.push_back( id );
+      }
+   }
+#endif
+
+   if( ids.empty() ) {
+      const size_t n( boost::thread::hardware_concurrency() );
+      for( size_t id=0UL; id<std::max<size_t>( n, 1UL ); ++id )
+         ids.push_back( id );
+   }
+
+   return ids;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if defined(__linux__)
+/*!\brief Binding the given native thread to the given logical CPUs.
+//
+// \param thread The native handle of the thread to be bound.
+// \param cpus The operating system IDs of the logical CPUs.
+// \return \a true in case the thread was bound successfully, \a false if not.
+*/
+bool bindNativeThread( pthread_t thread, const std::vector<size_t>& cpus )
+{
+   if( cpus.empty() )
+      return false;
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   for( size_t i=0UL; i<cpus.size(); ++i ) {
+      if( cpus[i] >= static_cast<size_t>( CPU_SETSIZE ) )
+         return false;
+      CPU_SET( cpus[i], &set );
+   }
+
+   return pthread_setaffinity_np( thread, sizeof( cpu_set_t ), &set ) == 0;
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given value to a string.
+//
+// \param value The value to be converted.
+// \return The string representation of the value.
+*/
+std::string toString( size_t value )
+{
+   std::ostringstream oss;
+   oss << value;
+   return oss.str();
+}
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the Topology class.
+//
+// This constructor detects the topology of all logical CPUs available to the calling process.
+*/
+Topology::Topology()
+   : cpus_()  // The logical CPUs ordered by NUMA node, socket, core and ID
+{
+   const std::string sysfs( "/sys/devices/system/" );
+   const std::vector<size_t> ids( availableCpus() );
+
+   for( size_t i=0UL; i<ids.size(); ++i )
+   {
+      const std::string path( sysfs + "cpu/cpu" + toString( ids[i] ) + "/topology/" );
+
+      Cpu cpu;
+      cpu.id   = ids[i];
+      cpu.node = 0UL;
+
+      if( !readValue( path + "core_id", cpu.core ) )
+         cpu.core = ids[i];
+      if( !readValue( path + "physical_package_id", cpu.socket ) )
+         cpu.socket = 0UL;
+
+      cpus_.push_back( cpu );
+   }
+
+   std::vector<size_t> nodes;
+   if( readList( sysfs + "node/online", nodes ) )
+   {
+      for( size_t i=0UL; i<nodes.size(); ++i )
+      {
+         std::vector<size_t> members;
+         if( !readList( sysfs + "node/node" + toString( nodes[i] ) + "/cpulist", members ) )
+            continue;
+
+         for( size_t j=0UL; j<cpus_.size(); ++j ) {
+            if( std::find( members.begin(), members.end(), cpus_[j].id ) != members.end() )
+               cpus_[j].node = nodes[i];
+         }
+      }
+   }
+
+   std::sort( cpus_.begin(), cpus_.end(), precedes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a topology consisting of the given logical CPUs.
+//
+// \param cpus The descriptions of the logical CPUs.
+// \exception std::invalid_argument Duplicate CPU ID.
+*/
+Topology::Topology( const std::vector<Cpu>& cpus )
+   : cpus_( cpus )  // The logical CPUs ordered by NUMA node, socket, core and ID
+{
+   std::sort( cpus_.begin(), cpus_.end(), precedes );
+
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      for( size_t j=i+1UL; j<cpus_.size(); ++j ) {
+         if( cpus_[i].id == cpus_[j].id )
+            throw std::invalid_argument( "Duplicate CPU ID" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of physical cores.
+//
+// \return The number of physical cores containing at least one of the logical CPUs.
+*/
+size_t Topology::cores() const
+{
+   size_t count( 0UL );
+
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      if( i == 0UL || cpus_[i].socket != cpus_[i-1UL].socket || cpus_[i].core != cpus_[i-1UL].core )
+         ++count;
+   }
+
+   return count;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of sockets.
+//
+// \return The number of sockets containing at least one of the logical CPUs.
+*/
+size_t Topology::sockets() const
+{
+   std::vector<size_t> ids;
+
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      if( std::find( ids.begin(), ids.end(), cpus_[i].socket ) == ids.end() )
+         ids.push_back( cpus_[i].socket );
+   }
+
+   return ids.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of NUMA nodes.
+//
+// \return The number of NUMA nodes containing at least one of the logical CPUs.
+*/
+size_t Topology::nodes() const
+{
+   size_t count( 0UL );
+
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      if( i == 0UL || cpus_[i].node != cpus_[i-1UL].node )
+         ++count;
+   }
+
+   return count;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the NUMA node of the given logical CPU.
+//
+// \param id The operating system ID of the logical CPU.
+// \return The ID of the NUMA node of the logical CPU.
+// \exception std::invalid_argument Unknown CPU ID.
+*/
+size_t Topology::node( size_t id ) const
+{
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      if( cpus_[i].id == id )
+         return cpus_[i].node;
+   }
+
+   throw std::invalid_argument( "Unknown CPU ID" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Restricting the topology to the given logical CPUs.
+//
+// \param ids The operating system IDs of the logical CPUs.
+// \return The topology consisting of all logical CPUs contained in the given list.
+//
+// This function returns the subset of the topology that consists of all logical CPUs whose IDs
+// are contained in the given list. IDs that are not part of the topology are ignored.
+*/
+Topology Topology::subset( const std::vector<size_t>& ids ) const
+{
+   std::vector<Cpu> cpus;
+
+   for( size_t i=0UL; i<cpus_.size(); ++i ) {
+      if( std::find( ids.begin(), ids.end(), cpus_[i].id ) != ids.end() )
+         cpus.push_back( cpus_[i] );
+   }
+
+   return Topology( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the logical CPUs for the given number of threads.
+//
+// \param n The number of threads.
+// \param placement The placement policy (compact or spread).
+// \return The IDs of the logical CPUs for the \a n threads.
+// \exception std::invalid_argument Empty topology.
+//
+// This function selects \a n logical CPUs according to the given placement policy (see the
+// class description for details). The resulting CPUs are ordered by NUMA node, i.e. the threads
+// of each NUMA node are assigned consecutive ranks. In case \a n exceeds the number of logical
+// CPUs, the logical CPUs are assigned to several threads in a round-robin fashion.
+*/
+std::vector<size_t> Topology::place( size_t n, Placement placement ) const
+{
+   if( cpus_.empty() )
+      throw std::invalid_argument( "Empty topology" );
+
+   // Computing the order of the logical CPUs (as indices into the list of logical CPUs)
+   std::vector<size_t> order;
+
+   if( placement == compact ) {
+      for( size_t i=0UL; i<cpus_.size(); ++i )
+         order.push_back( i );
+   }
+   else {
+      // Grouping the logical CPUs by socket and core
+      std::vector< std::vector< std::vector<size_t> > > sockets;
+      std::vector<size_t> socketIds;
+
+      for( size_t i=0UL; i<cpus_.size(); ++i )
+      {
+         const size_t s( std::find( socketIds.begin(), socketIds.end(), cpus_[i].socket ) - socketIds.begin() );
+
+         if( s == socketIds.size() ) {
+            socketIds.push_back( cpus_[i].socket );
+            sockets.push_back( std::vector< std::vector<size_t> >() );
+         }
+
+         std::vector< std::vector<size_t> >& cores( sockets[s] );
+
+         if( cores.empty() || cpus_[cores.back().front()].core != cpus_[i].core )
+            cores.push_back( std::vector<size_t>() );
+
+         cores.back().push_back( i );
+      }
+
+      // Round-robin distribution over the sockets, the cores and the SMT siblings
+      for( size_t level=0UL; order.size()<cpus_.size(); ++level ) {
+         for( size_t core=0UL; ; ++core )
+         {
+            bool found( false );
+
+            for( size_t s=0UL; s<sockets.size(); ++s ) {
+               if( core < sockets[s].size() ) {
+                  found = true;
+                  if( level < sockets[s][core].size() )
+                     order.push_back( sockets[s][core][level] );
+               }
+            }
+
+            if( !found ) break;
+         }
+      }
+   }
+
+   // Selecting the CPUs and ordering them by NUMA node
+   std::vector<size_t> selected;
+
+   for( size_t i=0UL; i<n; ++i )
+      selected.push_back( order[i%order.size()] );
+
+   std::sort( selected.begin(), selected.end() );
+
+   std::vector<size_t> ids;
+
+   for( size_t i=0UL; i<selected.size(); ++i )
+      ids.push_back( cpus_[selected[i]].id );
+
+   return ids;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Parsing a list of logical CPUs.
+// \ingroup threads
+//
+// \param list The CPU list in the format used by the Linux kernel (e.g. \c "0-3,8,10-11").
+// \return The operating system IDs of the listed logical CPUs.
+// \exception std::invalid_argument Invalid CPU list.
+*/
+std::vector<size_t> parseCpuList( const std::string& list )
+{
+   std::vector<size_t> ids;
+   std::istringstream iss( list );
+   std::string range;
+
+   while( std::getline( iss, range, ',' ) )
+   {
+      range.erase( std::remove( range.begin(), range.end(), ' ' ), range.end() );
+      range.erase( std::remove( range.begin(), range.end(), '\n' ), range.end() );
+
+      if( range.empty() )
+         continue;
+
+      const std::string::size_type dash( range.find( '-' ) );
+      const std::string first( range.substr( 0UL, dash ) );
+      const std::string last ( ( dash == std::string::npos )?( first ):( range.substr( dash+1UL ) ) );
+
+      if( first.empty() || last.empty() ||
+          first.find_first_not_of( "0123456789" ) != std::string::npos ||
+          last.find_first_not_of( "0123456789" ) != std::string::npos )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      const size_t begin( std::strtoul( first.c_str(), NULL, 10 ) );
+      const size_t end  ( std::strtoul( last.c_str(), NULL, 10 ) );
+
+      if( end < begin )
+         throw std::invalid_argument( "Invalid CPU list" );
+
+      for( size_t id=begin; id<=end; ++id )
+         ids.push_back( id );
+   }
+
+   return ids;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the given thread to the given logical CPUs.
+// \ingroup threads
+//
+// \param thread The thread to be bound.
+// \param cpus The operating system IDs of the logical CPUs.
+// \return \a true in case the thread was bound successfully, \a false if not.
+//
+// This function restricts the execution of the given thread to the given set of logical CPUs.
+// In case the binding of threads is not supported on the current platform, the given list of
+// logical CPUs is empty or the binding fails, the function returns \a false.
+*/
+bool bindThread( boost::thread& thread, const std::vector<size_t>& cpus )
+{
+#if defined(__linux__)
+   return bindNativeThread( thread.native_handle(), cpus );
+#else
+   UNUSED_PARAMETER( thread, cpus );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binding the calling thread to the given logical CPUs.
+// \ingroup threads
+//
+// \param cpus The operating system IDs of the logical CPUs.
+// \return \a true in case the thread was bound successfully, \a false if not.
+//
+// This function restricts the execution of the calling thread to the given set of logical CPUs.
+// In case the binding of threads is not supported on the current platform, the given list of
+// logical CPUs is empty or the binding fails, the function returns \a false.
+*/
+bool bindCurrentThread( const std::vector<size_t>& cpus )
+{
+#if defined(__linux__)
+   return bindNativeThread( pthread_self(), cpus );
+#else
+   UNUSED_PARAMETER( cpus );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze